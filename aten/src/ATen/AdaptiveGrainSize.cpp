@@ -0,0 +1,51 @@
+#include <ATen/AdaptiveGrainSize.h>
+
+#include <c10/util/flat_hash_map.h>
+#include <c10/util/llvmMathExtras.h>
+
+#include <mutex>
+
+namespace at {
+namespace internal {
+
+namespace {
+
+using GrainSizeKey = std::pair<const void*, int64_t>;
+
+struct KeyHash {
+  size_t operator()(const GrainSizeKey& key) const {
+    return std::hash<const void*>()(key.first) ^
+        (std::hash<int64_t>()(key.second) << 1);
+  }
+};
+
+// Read-mostly after warmup; a plain mutex is fine since hits take it only
+// briefly and misses are once per (op, bucket).
+std::mutex cache_mutex;
+ska::flat_hash_map<GrainSizeKey, int64_t, KeyHash>& cache() {
+  static ska::flat_hash_map<GrainSizeKey, int64_t, KeyHash> map;
+  return map;
+}
+
+} // namespace
+
+int64_t adaptive_numel_bucket(int64_t numel) {
+  return static_cast<int64_t>(llvm::Log2_64(static_cast<uint64_t>(numel) | 1));
+}
+
+int64_t lookup_adaptive_grain_size(const void* op_key, int64_t numel_bucket) {
+  std::lock_guard<std::mutex> lock(cache_mutex);
+  auto it = cache().find({op_key, numel_bucket});
+  return it == cache().end() ? -1 : it->second;
+}
+
+void store_adaptive_grain_size(
+    const void* op_key,
+    int64_t numel_bucket,
+    int64_t grain_size) {
+  std::lock_guard<std::mutex> lock(cache_mutex);
+  cache()[{op_key, numel_bucket}] = grain_size;
+}
+
+} // namespace internal
+} // namespace at
@@ -0,0 +1,84 @@
+#pragma once
+
+#include <ATen/Parallel.h>
+
+#include <chrono>
+#include <cstdint>
+
+namespace at {
+
+namespace internal {
+
+// Cache of calibrated grain sizes, keyed by (op key, numel bucket).  The op
+// key is an arbitrary stable address, conventionally a string literal naming
+// the kernel (bake the dtype into the literal, or pass one literal per dtype
+// instantiation, when per-dtype cost differs).  Buckets are log2(numel) so a
+// calibration is reused across nearby sizes.  Returns -1 on miss.
+TORCH_API int64_t lookup_adaptive_grain_size(
+    const void* op_key,
+    int64_t numel_bucket);
+TORCH_API void store_adaptive_grain_size(
+    const void* op_key,
+    int64_t numel_bucket,
+    int64_t grain_size);
+TORCH_API int64_t adaptive_numel_bucket(int64_t numel);
+
+// Each parallel task should run for roughly this long; long enough to
+// amortize submission overhead, short enough to load-balance.
+constexpr int64_t ADAPTIVE_TARGET_TASK_NS = 50000;
+
+// Elements timed on the calibration run.
+constexpr int64_t ADAPTIVE_PROBE_SIZE = 2048;
+
+} // namespace internal
+
+/*
+parallel_for_adaptive(op_key, begin, end, f)
+
+A drop-in variant of at::parallel_for for kernels whose per-element cost is
+not well served by the fixed internal::GRAIN_SIZE: cheap vectorized ops
+undershoot it on wide SIMD machines while expensive transcendental ops
+overshoot it.  On the first execution for a given (op_key, numel bucket) the
+head of the range is timed serially and a grain size is derived so each task
+costs about ADAPTIVE_TARGET_TASK_NS; subsequent calls hit the cache and go
+straight to parallel_for.
+
+`f` has the same contract as in at::parallel_for.
+*/
+template <class F>
+inline void parallel_for_adaptive(
+    const char* op_key,
+    const int64_t begin,
+    const int64_t end,
+    const F& f) {
+  namespace ig = internal;
+  if (begin >= end) {
+    return;
+  }
+  const int64_t range = end - begin;
+  const int64_t bucket = ig::adaptive_numel_bucket(range);
+  int64_t grain_size = ig::lookup_adaptive_grain_size(op_key, bucket);
+  int64_t calibrated_from = begin;
+  if (C10_UNLIKELY(grain_size < 0)) {
+    // Calibrate: run (and keep) a probe chunk serially under a timer.
+    const int64_t probe = std::min(range, ig::ADAPTIVE_PROBE_SIZE);
+    const auto start = std::chrono::steady_clock::now();
+    f(begin, begin + probe);
+    const auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now() - start).count();
+    calibrated_from = begin + probe;
+    // At least one element per task; the upper clamp keeps a pathological
+    // timer reading from serializing huge ranges.
+    const double ns_per_elem =
+        std::max<double>(static_cast<double>(elapsed) / probe, 1e-3);
+    grain_size = static_cast<int64_t>(ig::ADAPTIVE_TARGET_TASK_NS / ns_per_elem);
+    grain_size = std::max<int64_t>(grain_size, 1);
+    grain_size = std::min<int64_t>(grain_size, ig::GRAIN_SIZE * 64);
+    ig::store_adaptive_grain_size(op_key, bucket, grain_size);
+  }
+  if (calibrated_from < end) {
+    at::parallel_for(calibrated_from, end, grain_size, f);
+  }
+}
+
+} // namespace at
@@ -91,6 +91,7 @@ CPUGeneratorImpl::CPUGeneratorImpl(uint64_t seed_in)
 void CPUGeneratorImpl::set_current_seed(uint64_t seed) {
   next_float_normal_sample_.reset();
   next_double_normal_sample_.reset();
+  philox_offset_per_thread_ = 0;
   engine_ = mt19937(seed);
 }
 
@@ -313,6 +314,27 @@ void CPUGeneratorImpl::set_next_double_normal_sample(c10::optional<double> randn
   next_double_normal_sample_ = randn;
 }
 
+/**
+ * Reserves a slab of Philox counters and returns the (seed, offset) pair
+ * needed to construct an at::Philox4_32 engine for it.
+ *
+ * The Philox stream is counter based and independent of the mt19937 engine
+ * above, so a kernel that fills a tensor from several threads can pay for a
+ * single locked reservation per thread and then draw from its slab with no
+ * further synchronization. See reserve_philox_slab in
+ * native/cpu/DistributionTemplates.h for the intended usage.
+ *
+ * The increment counts 128-bit counter values, i.e. groups of four 32-bit
+ * randoms, matching CUDAGeneratorImpl::philox_engine_inputs.
+ *
+ * See Note [Acquire lock when using random generators]
+ */
+std::pair<uint64_t, uint64_t> CPUGeneratorImpl::philox_engine_inputs(uint64_t increment) {
+  uint64_t offset = this->philox_offset_per_thread_;
+  this->philox_offset_per_thread_ += increment;
+  return std::make_pair(engine_.seed(), offset);
+}
+
 /**
  * Get the engine of the CPUGeneratorImpl
  */
@@ -348,6 +370,7 @@ CPUGeneratorImpl* CPUGeneratorImpl::clone_impl() const {
   gen->set_engine(engine_);
   gen->set_next_float_normal_sample(next_float_normal_sample_);
   gen->set_next_double_normal_sample(next_double_normal_sample_);
+  gen->philox_offset_per_thread_ = philox_offset_per_thread_;
   return gen;
 }
 
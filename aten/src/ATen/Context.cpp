@@ -258,6 +258,14 @@ void Context::setAllowBF16ReductionCuBLAS(bool b) {
   allow_bf16_reduction_cublas = b;
 }
 
+bool Context::allowFastMathTranscendentalsCPU() const {
+  return allow_fastmath_transcendentals_cpu;
+}
+
+void Context::setAllowFastMathTranscendentalsCPU(bool b) {
+  allow_fastmath_transcendentals_cpu = b;
+}
+
 
 bool Context::hasMKL() {
 #if AT_MKL_ENABLED()
@@ -267,6 +267,12 @@ class TORCH_API Context {
   void setAllowFP16ReductionCuBLAS(bool);
   bool allowBF16ReductionCuBLAS() const;
   void setAllowBF16ReductionCuBLAS(bool);
+  // Allows CPU kernels to use relaxed-accuracy polynomial approximations
+  // (a few ulp instead of ~1 ulp) for transcendental functions such as exp,
+  // tanh and erf. See fast_exp/fast_erf/fast_tanh in
+  // aten/src/ATen/cpu/vec/vec_base.h. Off by default.
+  bool allowFastMathTranscendentalsCPU() const;
+  void setAllowFastMathTranscendentalsCPU(bool);
   at::QEngine qEngine() const;
   void setQEngine(at::QEngine e);
   static const std::vector<at::QEngine>& supportedQEngines();
@@ -320,6 +326,7 @@ class TORCH_API Context {
   bool allow_tf32_cudnn = true;
   bool allow_fp16_reduction_cublas = true;
   bool allow_bf16_reduction_cublas = true;
+  bool allow_fastmath_transcendentals_cpu = false;
   bool enabled_mkldnn = true;
   at::LinalgBackend linalg_preferred_backend =
       c10::utils::check_env("TORCH_LINALG_PREFER_CUSOLVER") == true
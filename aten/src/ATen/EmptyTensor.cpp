@@ -228,6 +228,29 @@ TensorBase empty_strided_symint_generic(
   return _empty_strided_generic<SymIntArrayRef>(size, stride, allocator, ks, scalar_type);
 }
 
+TensorBase empty_like_fast(const TensorBase& self) {
+  auto* self_impl = self.unsafeGetTensorImpl();
+  // Only plain dense strided CPU tensors qualify; everything else needs the
+  // TensorOptions/dispatch machinery of the regular factory. Named tensors
+  // are excluded so the slow path can propagate names, and non-dense inputs
+  // so it can infer output strides.
+  if (C10_UNLIKELY(
+          !self.device().is_cpu() || self.layout() != c10::kStrided ||
+          self_impl->has_symbolic_sizes_strides() ||
+          self_impl->has_named_tensor_meta() ||
+          self_impl->key_set().has(c10::DispatchKey::MkldnnCPU) ||
+          !self.is_non_overlapping_and_dense())) {
+    return TensorBase();
+  }
+  constexpr c10::DispatchKeySet cpu_ks(c10::DispatchKey::CPU);
+  return empty_strided_generic(
+      self.sizes(),
+      self.strides(),
+      c10::GetCPUAllocator(),
+      cpu_ks,
+      self.scalar_type());
+}
+
 TensorBase empty_cpu(IntArrayRef size, ScalarType dtype, bool pin_memory,
                      c10::optional<c10::MemoryFormat> memory_format_opt) {
   auto allocator = GetCPUAllocatorMaybePinned(pin_memory);
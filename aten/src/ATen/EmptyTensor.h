@@ -65,6 +65,15 @@ TORCH_API TensorBase empty_strided_symint_generic(
     c10::DispatchKeySet ks,
     ScalarType scalar_type);
 
+// Fast path for empty_like() with no overrides: dtype, layout and device are
+// read straight off the source TensorImpl and the allocation goes directly
+// through the CPU allocator, skipping TensorOptions merging and dispatch key
+// recomputation. Only plain dense strided CPU tensors qualify; anything else
+// (other devices, sparse/quantized/mkldnn, named tensors, symbolic shapes,
+// non-dense layouts) returns an undefined tensor and the caller must fall
+// back to the regular factory.
+TORCH_API TensorBase empty_like_fast(const TensorBase& self);
+
 TORCH_API TensorBase empty_cpu(
     IntArrayRef size,
     ScalarType dtype,
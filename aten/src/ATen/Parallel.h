@@ -26,6 +26,35 @@ TORCH_API int get_thread_num();
 // Checks whether the code runs in parallel region
 TORCH_API bool in_parallel_region();
 
+// Returns this thread's intra-op thread quota; 0 means uncapped
+TORCH_API int get_thread_quota();
+
+// Caps the number of threads that parallel regions launched from this
+// thread may occupy; 0 removes the cap. Honored by the native parallel
+// backend, which sizes its task fan-out by get_num_threads().
+TORCH_API void set_thread_quota(int quota);
+
+// RAII region capping intra-op parallelism, e.g. around one request's work
+// when several requests share the process. The quota travels across
+// at::launch/autograd thread boundaries via ThreadLocalState, so work
+// spawned on behalf of the region stays within its core budget.
+class TORCH_API ThreadQuotaGuard {
+ public:
+  explicit ThreadQuotaGuard(int quota) : old_quota_(get_thread_quota()) {
+    set_thread_quota(quota);
+  }
+
+  ~ThreadQuotaGuard() {
+    set_thread_quota(old_quota_);
+  }
+
+  ThreadQuotaGuard(const ThreadQuotaGuard&) = delete;
+  ThreadQuotaGuard& operator=(const ThreadQuotaGuard&) = delete;
+
+ private:
+  int old_quota_;
+};
+
 namespace internal {
 
 // Initialise num_threads lazily at first parallel call
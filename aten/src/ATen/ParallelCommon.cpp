@@ -40,8 +40,22 @@ size_t get_env_num_threads(const char* var_name, size_t def_value = 0) {
   return def_value;
 }
 
+// Per-thread cap on intra-op parallelism; 0 means uncapped. Kept here
+// rather than in a backend file so ThreadLocalState can capture it
+// regardless of which parallel backend is compiled in.
+thread_local int intraop_thread_quota = 0;
+
 } // namespace
 
+int get_thread_quota() {
+  return intraop_thread_quota;
+}
+
+void set_thread_quota(int quota) {
+  TORCH_CHECK(quota >= 0, "Expected non-negative thread quota, got ", quota);
+  intraop_thread_quota = quota;
+}
+
 std::string get_parallel_info() {
   std::ostringstream ss;
 
@@ -3,6 +3,7 @@
 #include <ATen/core/ivalue.h>
 #include <c10/macros/Macros.h>
 #include <functional>
+#include <utility>
 
 namespace at {
 
@@ -10,4 +11,55 @@ namespace at {
 TORCH_API c10::intrusive_ptr<c10::ivalue::Future> intraop_launch_future(
     std::function<void()> func);
 
+// Scheduling options for inter-op task submission via at::launch_future.
+struct TaskOptions {
+  enum class Priority : uint8_t { Low = 0, Normal = 1, High = 2 };
+
+  TaskOptions() = default;
+
+  // Scheduling priority; higher-priority tasks are dequeued before
+  // lower-priority ones. Running tasks are not preempted.
+  TaskOptions& priority(Priority priority) {
+    priority_ = priority;
+    return *this;
+  }
+  Priority priority() const {
+    return priority_;
+  }
+
+  // NUMA node the task should run on; -1 means no preference. Tasks with a
+  // hint run on a pool whose workers are bound to that node. Best-effort:
+  // falls back to the shared inter-op pool when NUMA is unavailable.
+  TaskOptions& numa_node(int node) {
+    numa_node_ = node;
+    return *this;
+  }
+  int numa_node() const {
+    return numa_node_;
+  }
+
+  // Static type of the IValue the task returns, used as the future's
+  // element type. Defaults to Any.
+  TaskOptions& result_type(c10::TypePtr type) {
+    result_type_ = std::move(type);
+    return *this;
+  }
+  const c10::TypePtr& result_type() const {
+    return result_type_;
+  }
+
+ private:
+  Priority priority_ = Priority::Normal;
+  int numa_node_ = -1;
+  c10::TypePtr result_type_ = nullptr;
+};
+
+// Launches an inter-op parallel task on the shared inter-op thread pool and
+// returns a future holding its result. Exceptions thrown by the task are
+// captured in the future. Unlike at::launch, the task can return a value,
+// and scheduling priority / NUMA placement can be requested via `options`.
+TORCH_API c10::intrusive_ptr<c10::ivalue::Future> launch_future(
+    std::function<c10::IValue()> func,
+    TaskOptions options = TaskOptions());
+
 } // namespace at
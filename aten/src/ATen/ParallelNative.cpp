@@ -7,11 +7,13 @@
 #ifndef C10_MOBILE
 #include <c10/core/thread_pool.h>
 #include <c10/util/irange.h>
+#include <c10/util/numa.h>
 #else
 #include <caffe2/utils/threadpool/pthreadpool-cpp.h>
 #endif // C10_MOBILE
 
 #include <atomic>
+#include <cstdlib>
 #include <utility>
 
 #ifdef _OPENMP
@@ -83,6 +85,42 @@ TaskThreadPoolBase& _get_intraop_pool() {
   return *pool;
 }
 
+// Whether intra-op tasks should be partitioned across NUMA nodes by their
+// position in the index range. Requires NUMA support and more than one node.
+bool _numa_partition_enabled() {
+  static const bool enabled = []() {
+    const char* var = std::getenv("TORCH_INTRAOP_NUMA_PARTITION");
+    return var && std::atoi(var) != 0 && c10::IsNUMAEnabled() &&
+        c10::GetNumNUMANodes() > 1;
+  }();
+  return enabled;
+}
+
+// Pins the executing pool thread to the NUMA node that owns this task's slice
+// of the index range. Tasks are chunked contiguously by task_id, so mapping
+// contiguous task ranges to nodes keeps each socket's threads on a contiguous
+// region of the iterated data. Setting the preferred memory node as well makes
+// first-touch pages (e.g. of freshly allocated outputs) land locally, so
+// later passes over the same data stay on-socket. The binding is cached per
+// thread and only re-issued when a task maps to a different node.
+void _maybe_bind_numa_node(size_t task_id, size_t num_tasks) {
+  if (!_numa_partition_enabled()) {
+    return;
+  }
+  static const auto num_nodes = static_cast<size_t>(c10::GetNumNUMANodes());
+  int node = static_cast<int>(task_id * num_nodes / num_tasks);
+  thread_local int bound_node = -1;
+  if (node != bound_node) {
+    c10::NUMARunOnNode(node);
+    c10::NUMABindMemory(node);
+    bound_node = node;
+  }
+}
+
+#else // C10_MOBILE
+
+inline void _maybe_bind_numa_node(size_t /* task_id */, size_t /* num_tasks */) {}
+
 #endif // C10_MOBILE
 
 // Run lambda function `fn` over `task_id` in [0, `range`) with threadpool.
@@ -156,12 +194,13 @@ void invoke_parallel(
     std::condition_variable cv;
   } state;
 
-  auto task = [f, &state, begin, end, chunk_size]
+  auto task = [f, &state, begin, end, chunk_size, num_tasks]
       (int /* unused */, size_t task_id) {
     int64_t local_start = begin + task_id * chunk_size;
     if (local_start < end) {
       int64_t local_end = std::min(end, (int64_t)(chunk_size + local_start));
       try {
+        _maybe_bind_numa_node(task_id, num_tasks);
         ParallelRegionGuard guard(task_id);
         f(local_start, local_end);
       } catch (...) {
@@ -238,17 +277,25 @@ void set_num_threads(int nthreads) {
 int get_num_threads() {
   at::internal::lazy_init_num_threads();
 #ifndef C10_MOBILE
+  // A thread quota region caps how many threads this caller's parallel
+  // work may fan out over, without touching the shared pool size. Clamping
+  // here is enough because calc_num_tasks_and_chunk_size sizes the task
+  // count by get_num_threads().
+  const int quota = get_thread_quota();
+  const auto clamp_to_quota = [quota](int nthreads) {
+    return quota > 0 ? std::min(nthreads, quota) : nthreads;
+  };
   // not initializing pool unnecessarily,
   // because pool cannot be resized after initialization
   int nthreads = num_intraop_threads.load();
   if (nthreads > 0) {
-    return nthreads;
+    return clamp_to_quota(nthreads);
   } else if (nthreads == NOT_SET) {
-    return intraop_default_num_threads();
+    return clamp_to_quota(intraop_default_num_threads());
   } else {
     TORCH_INTERNAL_ASSERT(nthreads == CONSUMED);
     // NOLINTNEXTLINE(cppcoreguidelines-narrowing-conversions,bugprone-narrowing-conversions)
-    return _get_intraop_pool().size() + 1;
+    return clamp_to_quota(_get_intraop_pool().size() + 1);
   }
 #else
   caffe2::PThreadPool* const pool = caffe2::pthreadpool();
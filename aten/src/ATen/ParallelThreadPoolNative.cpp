@@ -1,10 +1,18 @@
 #include <ATen/Config.h>
 #if AT_PARALLEL_OPENMP || AT_PARALLEL_NATIVE || AT_PARALLEL_NATIVE_TBB
 #include <ATen/Parallel.h>
+#include <ATen/ParallelFuture.h>
 #include <ATen/PTThreadPool.h>
 #include <ATen/ThreadLocalState.h>
+#include <ATen/core/jit_type.h>
+#include <c10/core/WorkStealingThreadPool.h>
+#include <c10/util/env.h>
+#include <c10/util/numa.h>
 
+#include <algorithm>
 #include <atomic>
+#include <mutex>
+#include <unordered_map>
 
 namespace at {
 
@@ -40,9 +48,46 @@ std::shared_ptr<TaskThreadPoolBase> create_c10_threadpool(
   TORCH_CHECK(device_id == 0);
   // Create new thread pool
   TORCH_CHECK(create_new);
+  // Opt-in work-stealing pool: per-worker Chase-Lev deques instead of the
+  // single-mutex queue, for workloads with many small task submissions.
+  if (c10::utils::check_env("TORCH_WORK_STEALING_POOL") == true) {
+    return std::make_shared<c10::WorkStealingThreadPool>(
+        pool_size, /* numa_node_id */ -1, []() {
+          c10::setThreadName("PTWorkStealThread");
+          at::init_num_threads();
+        });
+  }
   return std::make_shared<PTThreadPool>(pool_size);
 }
 
+// Lazily created pools for NUMA-hinted tasks, one per node; workers bind
+// to their node so task memory is allocated locally. Each pool gets a
+// share of the inter-op thread budget.
+TaskThreadPoolBase& get_numa_pool(int numa_node_id) {
+  static std::mutex numa_pools_mutex;
+  static std::unordered_map<int, std::shared_ptr<TaskThreadPoolBase>>
+      numa_pools;
+  std::lock_guard<std::mutex> guard(numa_pools_mutex);
+  auto it = numa_pools.find(numa_node_id);
+  if (it == numa_pools.end()) {
+    const int num_nodes = std::max(c10::GetNumNUMANodes(), 1);
+    const int pool_size = std::max(get_num_interop_threads() / num_nodes, 1);
+    it = numa_pools
+             .emplace(
+                 numa_node_id,
+                 std::make_shared<c10::ThreadPool>(
+                     pool_size,
+                     numa_node_id,
+                     [numa_node_id]() {
+                       c10::setThreadName("PTInterOpNUMA");
+                       c10::NUMABind(numa_node_id);
+                       at::init_num_threads();
+                     }))
+             .first;
+  }
+  return *it->second;
+}
+
 } // namespace
 
 C10_REGISTER_CREATOR(ThreadPoolRegistry, C10, create_c10_threadpool);
@@ -91,5 +136,29 @@ void launch(std::function<void()> func) {
   ));
 }
 
+c10::intrusive_ptr<c10::ivalue::Future> launch_future(
+    std::function<c10::IValue()> func,
+    TaskOptions options) {
+  auto type =
+      options.result_type() ? options.result_type() : c10::AnyType::get();
+  auto future = c10::make_intrusive<c10::ivalue::Future>(std::move(type));
+  auto task =
+      [func = std::move(func), future, state = ThreadLocalState()]() mutable {
+        ThreadLocalStateGuard guard(std::move(state));
+        try {
+          future->markCompleted(func());
+        } catch (...) {
+          future->setError(std::current_exception());
+        }
+      };
+  const int numa_node = options.numa_node();
+  auto& pool = (numa_node >= 0 && c10::IsNUMAEnabled())
+      ? get_numa_pool(numa_node)
+      : get_pool();
+  pool.run_with_priority(
+      std::move(task), static_cast<uint8_t>(options.priority()));
+  return future;
+}
+
 } // namespace at
 #endif
@@ -5,6 +5,8 @@
 #include <c10/util/Exception.h>
 #include <c10/util/irange.h>
 
+#include <mutex>
+
 #ifndef AT_PER_OPERATOR_HEADERS
 #include <ATen/Functions.h>
 #else
@@ -38,6 +40,38 @@ struct TORCH_API SparseTensorImpl : public TensorImpl {
   // because many algorithms proceed by merging two sorted lists (of indices).
   bool coalesced_ = false;
 
+  // NOTE [ Coalesce cache ]
+  //
+  // coalesce() is functional: on an uncoalesced tensor every call sorts the
+  // indices and builds a new tensor, even when the sparsity pattern never
+  // changes. Workloads that apply the same sparse tensor across many
+  // iterations (e.g. a fixed adjacency matrix) pay that sort on every
+  // iteration. To avoid this, the result of coalesce() is memoized here.
+  //
+  // The cache is keyed by the identity and version counter of indices_ and
+  // values_, so in-place mutation of either invalidates it; mutators that
+  // swap out the member tensors clear it explicitly. The identity and
+  // version counter of the cached result's own indices and values are
+  // recorded as well: the result is handed out directly to callers, so a
+  // caller that mutates it in place (e.g. coalesce().values().mul_(2))
+  // would otherwise poison the cache and make later coalesce() calls
+  // return the mutated tensor for an unchanged source. A mutex guards the
+  // cache because coalesce() is a logical read and may run concurrently on
+  // the same tensor from multiple threads. The cached tensor holds no
+  // reference back to this impl, so no reference cycle is created (see
+  // gh-52253 for why that matters), but it does keep the coalesced copy
+  // alive for as long as this tensor.
+  mutable std::mutex coalesce_cache_mutex_;
+  mutable Tensor cached_coalesced_;
+  mutable TensorImpl* cached_coalesced_indices_impl_ = nullptr;
+  mutable TensorImpl* cached_coalesced_values_impl_ = nullptr;
+  mutable uint32_t cached_coalesced_indices_version_ = 0;
+  mutable uint32_t cached_coalesced_values_version_ = 0;
+  mutable TensorImpl* cached_result_indices_impl_ = nullptr;
+  mutable TensorImpl* cached_result_values_impl_ = nullptr;
+  mutable uint32_t cached_result_indices_version_ = 0;
+  mutable uint32_t cached_result_values_version_ = 0;
+
   // compute_numel with integer multiplication overflow check, see gh-57542
   void refresh_numel() {
     TensorImpl::safe_refresh_numel();
@@ -224,6 +258,7 @@ struct TORCH_API SparseTensorImpl : public TensorImpl {
     }
     sparse_dim_ = sparse_dim;
     dense_dim_ = dense_dim;
+    clear_coalesce_cache();
     refresh_numel();
   }
 
@@ -273,6 +308,71 @@ struct TORCH_API SparseTensorImpl : public TensorImpl {
     refresh_numel();
   }
 
+  // Returns the memoized result of coalesce() if the source indices and
+  // values are unchanged since it was stored and the result itself has not
+  // been mutated by a previous caller, otherwise an undefined tensor. See
+  // NOTE [ Coalesce cache ].
+  Tensor cached_coalesced() const {
+    std::lock_guard<std::mutex> guard(coalesce_cache_mutex_);
+    if (cached_coalesced_.defined() &&
+        cached_coalesced_indices_impl_ == indices_.unsafeGetTensorImpl() &&
+        cached_coalesced_values_impl_ == values_.unsafeGetTensorImpl() &&
+        cached_coalesced_indices_version_ ==
+            indices_.unsafeGetTensorImpl()->version_counter().current_version() &&
+        cached_coalesced_values_version_ ==
+            values_.unsafeGetTensorImpl()->version_counter().current_version()) {
+      auto* result_impl =
+          static_cast<SparseTensorImpl*>(cached_coalesced_.unsafeGetTensorImpl());
+      if (cached_result_indices_impl_ ==
+              result_impl->indices_.unsafeGetTensorImpl() &&
+          cached_result_values_impl_ ==
+              result_impl->values_.unsafeGetTensorImpl() &&
+          cached_result_indices_version_ ==
+              result_impl->indices_.unsafeGetTensorImpl()
+                  ->version_counter()
+                  .current_version() &&
+          cached_result_values_version_ ==
+              result_impl->values_.unsafeGetTensorImpl()
+                  ->version_counter()
+                  .current_version()) {
+        return cached_coalesced_;
+      }
+    }
+    return Tensor();
+  }
+
+  // See NOTE [ Coalesce cache ].
+  void set_cached_coalesced(const Tensor& coalesced) const {
+    std::lock_guard<std::mutex> guard(coalesce_cache_mutex_);
+    cached_coalesced_ = coalesced;
+    cached_coalesced_indices_impl_ = indices_.unsafeGetTensorImpl();
+    cached_coalesced_values_impl_ = values_.unsafeGetTensorImpl();
+    cached_coalesced_indices_version_ =
+        indices_.unsafeGetTensorImpl()->version_counter().current_version();
+    cached_coalesced_values_version_ =
+        values_.unsafeGetTensorImpl()->version_counter().current_version();
+    auto* result_impl =
+        static_cast<SparseTensorImpl*>(coalesced.unsafeGetTensorImpl());
+    cached_result_indices_impl_ = result_impl->indices_.unsafeGetTensorImpl();
+    cached_result_values_impl_ = result_impl->values_.unsafeGetTensorImpl();
+    cached_result_indices_version_ = result_impl->indices_.unsafeGetTensorImpl()
+                                         ->version_counter()
+                                         .current_version();
+    cached_result_values_version_ = result_impl->values_.unsafeGetTensorImpl()
+                                        ->version_counter()
+                                        .current_version();
+  }
+
+  // See NOTE [ Coalesce cache ].
+  void clear_coalesce_cache() const {
+    std::lock_guard<std::mutex> guard(coalesce_cache_mutex_);
+    cached_coalesced_.reset();
+    cached_coalesced_indices_impl_ = nullptr;
+    cached_coalesced_values_impl_ = nullptr;
+    cached_result_indices_impl_ = nullptr;
+    cached_result_values_impl_ = nullptr;
+  }
+
   void set_coalesced(bool coalesced) {
     TORCH_CHECK(
         allow_tensor_metadata_change(),
@@ -291,6 +391,7 @@ struct TORCH_API SparseTensorImpl : public TensorImpl {
     AT_ASSERT(new_nnz <= nnz());
     indices_ = indices_.narrow(1, 0, new_nnz);
     values_ = values_.narrow(0, 0, new_nnz);
+    clear_coalesce_cache();
     if (new_nnz < 2) {
       coalesced_ = true;
     }
@@ -392,6 +493,9 @@ struct TORCH_API SparseTensorImpl : public TensorImpl {
     dest_sparse_impl->indices_ = src_sparse_impl->indices();
     dest_sparse_impl->values_ = src_sparse_impl->values();
     dest_sparse_impl->coalesced_ = src_sparse_impl->coalesced();
+    // The destination's cache (if any) refers to its previous indices and
+    // values; see NOTE [ Coalesce cache ].
+    dest_sparse_impl->clear_coalesce_cache();
   }
 
   const char* tensorimpl_type_name() const override;
@@ -292,6 +292,22 @@ void TensorIteratorBase::reorder_dimensions() {
 // Computes a common dtype using type promotion
 // See the [Common Dtype Computation] note
 ScalarType TensorIteratorBase::compute_common_dtype() {
+  // Fast path for the common binary case: two defined, non-scalar (dim > 0)
+  // inputs that are not wrapped numbers all land in the "dimensioned" category
+  // of the result type state machine, so the common dtype is just the
+  // promotion of their dtypes.
+  if (ninputs() == 2) {
+    const auto& a = tensor(noutputs());
+    const auto& b = tensor(noutputs() + 1);
+    if (a.defined() && b.defined() && a.dim() > 0 && b.dim() > 0 &&
+        !a.unsafeGetTensorImpl()->is_wrapped_number() &&
+        !b.unsafeGetTensorImpl()->is_wrapped_number()) {
+      common_dtype_ = promoteTypes(a.scalar_type(), b.scalar_type());
+      TORCH_INTERNAL_ASSERT(common_dtype_ != ScalarType::Undefined);
+      return common_dtype_;
+    }
+  }
+
   at::native::ResultTypeState state = {};
   for (const auto& op : operands_) {
     if (op.is_output) {
@@ -1694,6 +1710,73 @@ DimCounter::DimCounter(IntArrayRef shape, Range range)
   TORCH_INTERNAL_ASSERT(linear_offset == 0);
 }
 
+void TensorIteratorBase::reset() {
+  // Clear rather than reassign: SmallVector::clear() destroys elements but
+  // keeps any spilled heap buffer, which is the whole point of pooling.
+  shape_.clear();
+  perm_.clear();
+  has_coalesced_dimensions_ = false;
+  enforce_linear_iteration_ = false;
+  view_offsets_.clear();
+  names_.clear();
+  operands_.clear();
+  num_outputs_ = 0;
+  all_ops_same_shape_ = false;
+  all_ops_are_scalars_ = false;
+  common_dtype_ = ScalarType::Undefined;
+  common_device_ = kCPU;
+  accumulate_ = false;
+  final_output_ = true;
+  is_reduction_ = false;
+  is_meta_ = false;
+}
+
+namespace {
+
+// Thread-local freelist backing PooledTensorIterator.  Capped so a burst of
+// nested leases doesn't pin memory forever; overflow falls back to delete.
+class TensorIteratorPool {
+ public:
+  TensorIterator* acquire() {
+    if (!free_.empty()) {
+      TensorIterator* iter = free_.back().release();
+      free_.pop_back();
+      return iter;
+    }
+    return new TensorIterator();
+  }
+
+  void release(TensorIterator* iter) {
+    iter->reset();
+    if (free_.size() < kMaxPooled) {
+      free_.emplace_back(iter);
+    } else {
+      delete iter;
+    }
+  }
+
+ private:
+  static constexpr size_t kMaxPooled = 8;
+  std::vector<std::unique_ptr<TensorIterator>> free_;
+};
+
+TensorIteratorPool& thread_local_iterator_pool() {
+  thread_local TensorIteratorPool pool;
+  return pool;
+}
+
+} // namespace
+
+PooledTensorIterator PooledTensorIterator::acquire() {
+  return PooledTensorIterator(thread_local_iterator_pool().acquire());
+}
+
+PooledTensorIterator::~PooledTensorIterator() {
+  if (iter_ != nullptr) {
+    thread_local_iterator_pool().release(iter_);
+  }
+}
+
 bool DimCounter::is_done() const {
   return offset >= range.end;
 }
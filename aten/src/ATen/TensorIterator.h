@@ -240,6 +240,14 @@ struct TORCH_API TensorIteratorBase : public impl::MetaBase {
   TensorIteratorBase();
   void build(TensorIteratorConfig&);
 
+  /// Clears all state populated by build() so the iterator can be rebuilt.
+  /// Unlike constructing a fresh TensorIterator, this keeps the heap buffers
+  /// of the operand/shape SmallVectors alive (SmallVector::clear() does not
+  /// shrink), so a reused iterator does not re-allocate when it spills again.
+  /// Used by PooledTensorIterator; also callable directly by callers that
+  /// keep a long-lived iterator and rebuild it per call.
+  void reset();
+
   // The inner-loop function operates on the fastest moving dimension. It
   // implements element-wise operations in terms of 1-d strided tensors.
   //
@@ -984,4 +992,45 @@ struct TORCH_API SplitUntil32Bit {
   const TensorIteratorBase& iter;
 };
 
+/// A RAII lease on a thread-locally pooled TensorIterator.
+///
+/// Building a TensorIterator heap-allocates whenever operands_, shape_ or the
+/// per-operand stride vectors spill their inline SmallVector storage, which
+/// happens on every call for ops with many operands or high-rank inputs.
+/// Callers that build iterators in a tight loop (e.g. eager elementwise ops
+/// on small tensors) can acquire a pooled iterator instead: the spilled
+/// buffers survive across uses, so steady-state builds are allocation-free.
+///
+///   auto pooled = at::PooledTensorIterator::acquire();
+///   pooled->build_binary_op(out, a, b);
+///   some_kernel(*pooled);
+///
+/// On destruction the iterator is reset() (dropping all tensor references)
+/// and returned to the pool of the destroying thread.  The lease must not
+/// outlive the thread it was acquired on.
+class TORCH_API PooledTensorIterator final {
+ public:
+  static PooledTensorIterator acquire();
+  ~PooledTensorIterator();
+
+  PooledTensorIterator(PooledTensorIterator&& other) noexcept
+      : iter_(other.iter_) {
+    other.iter_ = nullptr;
+  }
+  PooledTensorIterator(const PooledTensorIterator&) = delete;
+  PooledTensorIterator& operator=(const PooledTensorIterator&) = delete;
+  PooledTensorIterator& operator=(PooledTensorIterator&&) = delete;
+
+  TensorIterator& operator*() const {
+    return *iter_;
+  }
+  TensorIterator* operator->() const {
+    return iter_;
+  }
+
+ private:
+  explicit PooledTensorIterator(TensorIterator* iter) : iter_(iter) {}
+  TensorIterator* iter_;
+};
+
 } // namespace at
@@ -80,6 +80,10 @@ class TORCH_API ThreadLocalState {
   // TLS for arbitrary python objects that is registered via hooks
   at::impl::ThreadLocalPythonObjects saved_objects_;
 
+  // Intra-op thread quota (see at::ThreadQuotaGuard), so work handed to
+  // other threads stays within the launching region's core budget
+  int intraop_thread_quota_;
+
   friend class ThreadLocalStateGuard;
 };
 
@@ -1,5 +1,6 @@
 #include <ATen/autocast_mode.h>
 
+#include <array>
 #include <mutex>
 #include <ATen/CachedTensorUtils.h>
 #include <c10/util/flat_hash_map.h>
@@ -81,8 +82,24 @@ namespace {
 // directly against incoming TensorImpl*s.
 using weakref_type = c10::weak_intrusive_ptr<TensorImpl, UndefinedTensorImpl>;
 using val_type = std::tuple<weakref_type, Tensor>;
-ska::flat_hash_map<TensorImpl*, val_type> cached_casts;
-std::mutex cached_casts_mutex;
+
+// The cache is sharded by TensorImpl* so concurrent threads casting
+// different weights (multi-threaded inference over a shared model) don't
+// serialize on one global mutex.  Each shard is padded to its own cache
+// line to avoid false sharing between the shard mutexes.
+constexpr size_t kCachedCastsShards = 16;
+struct alignas(64) CachedCastsShard {
+  std::mutex mutex;
+  ska::flat_hash_map<TensorImpl*, val_type> map;
+};
+std::array<CachedCastsShard, kCachedCastsShards> cached_casts_shards;
+
+CachedCastsShard& cached_casts_shard_for(TensorImpl* impl) {
+  // The low bits of a TensorImpl* are zero due to allocator alignment;
+  // shift them out so shards are populated evenly.
+  const auto ptr = reinterpret_cast<uintptr_t>(impl);
+  return cached_casts_shards[(ptr >> 6) % kCachedCastsShards];
+}
 
 
 // nesting tracks the nesting depth of the Python-side context manager.
@@ -109,6 +126,13 @@ thread_local at::ScalarType autocast_xla_dtype = at::kBFloat16;
 // should we enabled the cache inside autocast.
 thread_local bool cache_enabled = true;
 
+// Frozen autocast: the caller guarantees that fp32 source tensors are
+// immutable for the duration of the scope (inference over fixed weights),
+// so casts may be cached even for tensors the Apex leaf/requires_grad
+// heuristic would skip.  Inference weights typically don't require grad,
+// which means the cache never hits without this.
+thread_local bool frozen = false;
+
 // autocast_gpu_dtype is the lower_precision_fp used by AutocastGPU.
 thread_local at::ScalarType autocast_gpu_dtype = at::kHalf;
 
@@ -117,8 +141,10 @@ thread_local at::ScalarType autocast_privateuseone_dtype = at::kHalf;
 }
 
 void clear_cache() {
-  const std::lock_guard<std::mutex> lock(cached_casts_mutex);
-  cached_casts.clear();
+  for (auto& shard : cached_casts_shards) {
+    const std::lock_guard<std::mutex> lock(shard.mutex);
+    shard.map.clear();
+  }
 }
 
 int increment_nesting() {
@@ -193,6 +219,14 @@ void set_autocast_cache_enabled(bool enabled) {
   cache_enabled = enabled;
 }
 
+bool is_autocast_frozen() {
+  return frozen;
+}
+
+void set_autocast_frozen(bool new_frozen) {
+  frozen = new_frozen;
+}
+
 // Overload to catch Tensor args
 // TODO (possible optimization):
 // Move cast_cache to an inline function in a header with cached_casts declared as
@@ -200,20 +234,24 @@ void set_autocast_cache_enabled(bool enabled) {
 Tensor cached_cast(at::ScalarType to_type, const Tensor& arg, DeviceType device_type) {
   if (is_eligible(arg, device_type) && (arg.scalar_type() != to_type)) {
     // Heuristic:  Do what Apex does, and cache lower_precision_fp casts of fp32 model weights (leaves).
-    // See cached_casts declaration above for detailed strategy.
+    // In frozen autocast the caller vouches that fp32 sources are immutable,
+    // so the leaf/requires_grad restriction is dropped (see `frozen` above).
+    // See cached_casts_shards declaration above for detailed strategy.
     bool can_try_cache = (to_type == get_lower_precision_fp_from_device_type(device_type) &&
-                         arg.scalar_type() == at::kFloat && arg.requires_grad() &&
-                         arg.is_leaf() && !arg.is_view() && cache_enabled &&
+                         arg.scalar_type() == at::kFloat &&
+                         (frozen || (arg.requires_grad() && arg.is_leaf())) &&
+                         !arg.is_view() && cache_enabled &&
                          !at::caching::is_cached_tensor(arg));
 
     if (can_try_cache) {
-      const std::lock_guard<std::mutex> lock(cached_casts_mutex);
-      auto it = cached_casts.find(arg.unsafeGetTensorImpl());
-      if (it != cached_casts.end()) {
+      auto& shard = cached_casts_shard_for(arg.unsafeGetTensorImpl());
+      const std::lock_guard<std::mutex> lock(shard.mutex);
+      auto it = shard.map.find(arg.unsafeGetTensorImpl());
+      if (it != shard.map.end()) {
         return std::get<1>(it->second);
       } else {
         auto casted_arg = arg.to(to_type);
-        cached_casts.emplace(arg.unsafeGetTensorImpl(), val_type{weakref_type(arg.getIntrusivePtr()), casted_arg});
+        shard.map.emplace(arg.unsafeGetTensorImpl(), val_type{weakref_type(arg.getIntrusivePtr()), casted_arg});
         return casted_arg;
       }
     } else {
@@ -43,6 +43,13 @@ TORCH_API at::ScalarType get_autocast_privateuseone_dtype();
 TORCH_API void set_autocast_privateuseone_dtype(at::ScalarType dtype);
 TORCH_API bool is_autocast_cache_enabled();
 TORCH_API void set_autocast_cache_enabled(bool enabled);
+// Frozen autocast: a scoped promise that fp32 source tensors are immutable
+// (inference over fixed weights), letting cached_cast cache casts of
+// non-leaf / non-requires-grad tensors too.  Pair set(true)/set(false)
+// around the inference region; the cache is cleared on autocast exit as
+// usual.
+TORCH_API bool is_autocast_frozen();
+TORCH_API void set_autocast_frozen(bool frozen);
 
 namespace {
 inline bool is_autocast_eligible(
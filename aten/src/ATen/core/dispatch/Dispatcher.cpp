@@ -20,6 +20,13 @@ int64_t dispatch_trace_nesting_value() { return dispatch_trace_nesting_value_; }
 
 namespace detail {
 
+// See Note [Dispatch resolution cache] in Dispatcher.h
+std::atomic<uint64_t> dispatch_table_generation_{0};
+
+void bump_dispatch_table_generation() {
+  dispatch_table_generation_.fetch_add(1, std::memory_order_acq_rel);
+}
+
 class RegistrationListenerList final {
 public:
   std::function<void()> addListener(std::unique_ptr<OpRegistrationListener> listener) {
@@ -51,6 +58,8 @@ OpRegistrationListener::~OpRegistrationListener()= default;
 Dispatcher::Dispatcher()
 : operators_()
 , operatorLookupTable_()
+, internedOperatorTable_()
+, internedOperatorIds_()
 , backendFallbackKernels_()
 , listeners_(std::make_unique<detail::RegistrationListenerList>())
 , cond_var_()
@@ -77,6 +86,42 @@ c10::optional<OperatorHandle> Dispatcher::findOp(const OperatorName& overload_na
   });
 }
 
+// Note [Interned operator names]
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// findOp(OperatorName) hashes two strings on every call. That is fine for
+// one-off resolution, but callers which resolve the same names over and over
+// (serving stacks that load models or decode RPCs continuously) pay the
+// string hashing each time. internOperatorName assigns each distinct name a
+// small dense id once; findOp(id) is then a bounds-checked array read through
+// the same LeftRight synchronization as the name-keyed table. Ids are never
+// recycled: if the operator is deregistered the slot goes empty and is
+// refilled when an operator with that name is registered again, so a cached
+// id stays valid for the process lifetime.
+uint32_t Dispatcher::internOperatorName(const OperatorName& op_name) {
+  std::lock_guard<std::mutex> lock(guard_->mutex);
+  auto it = internedOperatorIds_.find(op_name);
+  if (it != internedOperatorIds_.end()) {
+    return it->second;
+  }
+  const auto id = static_cast<uint32_t>(internedOperatorIds_.size());
+  internedOperatorIds_.emplace(op_name, id);
+  auto handle = findOp(op_name);
+  internedOperatorTable_.write([&] (std::vector<c10::optional<OperatorHandle>>& internedOperatorTable) {
+    TORCH_INTERNAL_ASSERT(internedOperatorTable.size() == id);
+    internedOperatorTable.push_back(handle);
+  });
+  return id;
+}
+
+c10::optional<OperatorHandle> Dispatcher::findOp(uint32_t interned_id) {
+  return internedOperatorTable_.read([&] (const std::vector<c10::optional<OperatorHandle>>& internedOperatorTable) -> c10::optional<OperatorHandle> {
+    TORCH_CHECK(
+        interned_id < internedOperatorTable.size(),
+        "Invalid interned operator id: ", interned_id);
+    return internedOperatorTable[interned_id];
+  });
+}
+
 // NB: If you add more waitFor* implementations, you also have to add
 // appropriate notify_all() calls to the relevant register calls
 
@@ -164,6 +209,12 @@ OperatorHandle Dispatcher::findOrRegisterName_(const OperatorName& op_name) {
   operatorLookupTable_.write([&] (ska::flat_hash_map<OperatorName, OperatorHandle>& operatorLookupTable) {
     operatorLookupTable.emplace(op_name, handle);
   });
+  const auto interned = internedOperatorIds_.find(op_name);
+  if (interned != internedOperatorIds_.end()) {
+    internedOperatorTable_.write([&] (std::vector<c10::optional<OperatorHandle>>& internedOperatorTable) {
+      internedOperatorTable[interned->second] = handle;
+    });
+  }
 
   return handle;
 }
@@ -393,12 +444,22 @@ void Dispatcher::deregisterName_(
 // Test if the operator entry is completely dead, and if so remove it completely
 void Dispatcher::cleanup(const OperatorHandle& op, const OperatorName& op_name) {
   if (0 == op.operatorDef_->def_and_impl_count) {
+    // The entry is about to be freed and its address may be reused; drop any
+    // cached resolutions pointing into it. See Note [Dispatch resolution
+    // cache] in Dispatcher.h.
+    detail::bump_dispatch_table_generation();
     // NOTE: Making this call fast is the only reason OperatorHandle
     // stores operatorIterator_!
     operators_.erase(op.operatorIterator_);
     operatorLookupTable_.write([&] (ska::flat_hash_map<OperatorName, OperatorHandle>& operatorLookupTable) {
       operatorLookupTable.erase(op_name);
     });
+    const auto interned = internedOperatorIds_.find(op_name);
+    if (interned != internedOperatorIds_.end()) {
+      internedOperatorTable_.write([&] (std::vector<c10::optional<OperatorHandle>>& internedOperatorTable) {
+        internedOperatorTable[interned->second] = c10::nullopt;
+      });
+    }
   }
 }
 
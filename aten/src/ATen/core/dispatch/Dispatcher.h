@@ -9,6 +9,7 @@
 #include <ATen/record_function.h>
 #include <c10/util/Exception.h>
 #include <c10/util/LeftRight.h>
+#include <atomic>
 #include <list>
 #include <mutex>
 #include <condition_variable>
@@ -157,6 +158,14 @@ public:
   // Like findSchema, but also returns OperatorHandle even if there is no schema
   c10::optional<OperatorHandle> findOp(const OperatorName& operator_name);
 
+  // See Note [Interned operator names]. Returns a stable id for op_name;
+  // the same name always yields the same id for the process lifetime.
+  uint32_t internOperatorName(const OperatorName& op_name);
+
+  // Id-indexed variant of findOp for interned names; an array index instead
+  // of a string-pair hash. The id must come from internOperatorName.
+  c10::optional<OperatorHandle> findOp(uint32_t interned_id);
+
   // Returns a list of all operator names present in the operatorLookupTable_
   const std::vector<OperatorName> getAllOpNames();
 
@@ -184,6 +193,26 @@ public:
   void callBoxed(const OperatorHandle& op, Stack* stack) const;
   void callBoxedForDispatchKey(const OperatorHandle& op, DispatchKey dk, Stack* stack) const;
 
+  // A single entry in a callBatched() batch: a pre-resolved operator handle
+  // plus the boxed argument stack to invoke it with.
+  struct BatchedCall final {
+    const OperatorHandle* op;
+    Stack* stack;
+  };
+
+  // Invoke a sequence of boxed operator calls, resolving the dispatch key set
+  // only once (from the first call's arguments) and dispatching every kernel
+  // in the batch with that key set.  This skips per-call key extraction and
+  // per-call profiling observation, which dominate dispatch cost for long
+  // sequences of tiny ops.
+  //
+  // The caller is responsible for guaranteeing that every call in the batch
+  // would resolve to the same dispatch key set: in practice, all operands must
+  // live on the same backend with the same tensor-subclass/functionality keys,
+  // and no TLS dispatch state may change between the calls.  Debug builds
+  // assert this per call.
+  void callBatched(c10::ArrayRef<BatchedCall> calls) const;
+
   // TODO: This will only be useful if we write a backend fallback that plumbs dispatch keys (currently there are none)
   // See Note [Plumbing Keys Through The Dispatcher]
   void redispatchBoxed(const OperatorHandle& op, DispatchKeySet dispatchKeySet, Stack* stack) const;
@@ -326,9 +355,14 @@ private:
   std::list<OperatorDef> operators_;
 #if !defined(C10_MOBILE)
   LeftRight<ska::flat_hash_map<OperatorName, OperatorHandle>> operatorLookupTable_;
+  LeftRight<std::vector<c10::optional<OperatorHandle>>> internedOperatorTable_;
 #else
   RWSafeLeftRightWrapper<ska::flat_hash_map<OperatorName, OperatorHandle>> operatorLookupTable_;
+  RWSafeLeftRightWrapper<std::vector<c10::optional<OperatorHandle>>> internedOperatorTable_;
 #endif
+  // Assigned interned ids; guarded by guard_->mutex. See Note [Interned
+  // operator names].
+  ska::flat_hash_map<OperatorName, uint32_t> internedOperatorIds_;
   // Map from namespace to debug string (saying, e.g., where the library was defined)
   ska::flat_hash_map<std::string, std::string> libraries_;
 
@@ -535,6 +569,47 @@ private:
 namespace detail {
 template <class... Args> inline void unused_arg_(const Args&...) {}
 
+// Note [Dispatch resolution cache]
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// Mapping a resolved DispatchKeySet to a dispatch table slot
+// (OperatorEntry::lookup) recomputes the table index from the key bits on
+// every call, although steady-state loops call the same operators with the
+// same key sets over and over. This per-thread direct-mapped cache memoizes
+// (operator entry, resolved key set) -> KernelFunction*, in the spirit of
+// PyHandleCache in c10/core/PyHandleCache.h: a hit is a tag compare plus a
+// load, a miss falls through to the full lookup (which also performs the
+// validity checks) and claims the slot. Entries are tagged with a global
+// generation that is bumped whenever any dispatch table slot is rewritten or
+// an operator is deregistered, so registration changes (and freed operator
+// entries whose addresses get reused) invalidate every cached row. Fallthrough
+// mask changes need no special handling: they alter the resolved key set
+// itself, i.e. the cache key.
+extern TORCH_API std::atomic<uint64_t> dispatch_table_generation_;
+TORCH_API void bump_dispatch_table_generation();
+
+struct DispatchResolutionCache {
+  struct Entry {
+    const void* op{nullptr};
+    uint64_t key_bits{0};
+    uint64_t generation{0};
+    const KernelFunction* kernel{nullptr};
+  };
+  // Direct-mapped; must stay a power of two.
+  static constexpr size_t kNumEntries = 64;
+  Entry entries[kNumEntries];
+
+  C10_ALWAYS_INLINE static size_t slot(const void* op, uint64_t key_bits) {
+    const uint64_t h =
+        (reinterpret_cast<uintptr_t>(op) ^ key_bits) * 0x9E3779B97F4A7C15ull;
+    return static_cast<size_t>(h >> 32) & (kNumEntries - 1);
+  }
+};
+
+inline DispatchResolutionCache& dispatch_resolution_cache() {
+  thread_local DispatchResolutionCache cache;
+  return cache;
+}
+
 // CaptureKernelCall is intended to capture return values from Dispatcher
 // unboxed kernel calls. A record function may request to get outputs from the
 // kernel calls. For boxed kernels, it's straightforward, the returned values
@@ -663,7 +738,23 @@ C10_ALWAYS_INLINE_UNLESS_MOBILE Return Dispatcher::call(const TypedOperatorHandl
       std::cerr << "[call] op=[" << op.operator_name() << "], key=[" << toString(dispatchKeySet.highestPriorityTypeId()) << "]" << std::endl;
   }
 #endif
-  const KernelFunction& kernel = op.operatorDef_->op.lookup(dispatchKeySet);
+  // See Note [Dispatch resolution cache]
+  auto& cache = detail::dispatch_resolution_cache();
+  const uint64_t key_bits = dispatchKeySet.raw_repr();
+  auto& entry = cache.entries[detail::DispatchResolutionCache::slot(
+      &op.operatorDef_->op, key_bits)];
+  const uint64_t generation =
+      detail::dispatch_table_generation_.load(std::memory_order_acquire);
+  const KernelFunction* kernel_ptr;
+  if (C10_LIKELY(
+          entry.op == &op.operatorDef_->op && entry.key_bits == key_bits &&
+          entry.generation == generation)) {
+    kernel_ptr = entry.kernel;
+  } else {
+    kernel_ptr = &op.operatorDef_->op.lookup(dispatchKeySet);
+    entry = {&op.operatorDef_->op, key_bits, generation, kernel_ptr};
+  }
+  const KernelFunction& kernel = *kernel_ptr;
 #ifndef PYTORCH_DISABLE_PER_OP_PROFILING
   auto step_callbacks = at::getStepCallbacksUnlessEmpty(at::RecordScope::FUNCTION);
   if (C10_UNLIKELY(step_callbacks.has_value() && op.operatorDef_->op.isObserved())) {
@@ -725,6 +816,27 @@ inline void Dispatcher::callBoxed(const OperatorHandle& op, Stack* stack) const
   kernel.callBoxed(op, dispatchKeySet, stack);
 }
 
+inline void Dispatcher::callBatched(c10::ArrayRef<BatchedCall> calls) const {
+  if (calls.empty()) {
+    return;
+  }
+  // Resolve the dispatch key set once, from the first call.  All subsequent
+  // calls reuse it; see the contract on the declaration.
+  const auto& first_entry = calls.front().op->operatorDef_->op;
+  auto dispatchKeySet =
+      first_entry.dispatchKeyExtractor().getDispatchKeySetBoxed(calls.front().stack);
+  for (const auto& call : calls) {
+    const auto& entry = call.op->operatorDef_->op;
+    TORCH_INTERNAL_ASSERT_DEBUG_ONLY(
+        entry.dispatchKeyExtractor().getDispatchKeySetBoxed(call.stack) ==
+            dispatchKeySet,
+        "callBatched: ", call.op->operator_name(),
+        " resolves to a different dispatch key set than the first call in the batch");
+    const auto& kernel = entry.lookup(dispatchKeySet);
+    kernel.callBoxed(*call.op, dispatchKeySet, call.stack);
+  }
+}
+
 // NB: this doesn't count as a "true" dispatcher jump, so no instrumentation
 inline void Dispatcher::callBoxedForDispatchKey(const OperatorHandle& op, DispatchKey dk, Stack* stack) const {
   // note: this doesn't need the mutex because write operations on the list keep iterators intact.
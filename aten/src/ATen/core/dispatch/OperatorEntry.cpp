@@ -392,6 +392,9 @@ void OperatorEntry::updateDispatchTableEntry_(const c10::Dispatcher& dispatcher,
   }
   dispatchTable_[dispatch_ix] = computeDispatchTableEntry(dispatcher, dispatch_key);
   dispatchKeyExtractor_.setOperatorHasFallthroughForKey(dispatch_key, dispatchTable_[dispatch_ix].isFallthrough());
+  // Invalidate memoized kernel lookups; see Note [Dispatch resolution cache]
+  // in Dispatcher.h.
+  c10::detail::bump_dispatch_table_generation();
 }
 
 // synchronizes the dispatch table entries for a given dispatch key *and its
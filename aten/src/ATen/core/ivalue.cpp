@@ -7,6 +7,7 @@
 #include <ATen/core/jit_type.h>
 #include <ATen/core/stack.h>
 #include <ATen/core/type_factory.h>
+#include <c10/core/GradMode.h>
 #include <c10/util/StringUtil.h>
 #include <c10/util/hash.h>
 #include <c10/util/irange.h>
@@ -892,6 +893,130 @@ IValue IValue::deepcopy(c10::optional<at::Device> device) const {
   return deepcopy(memo, device);
 }
 
+namespace {
+
+// Collects every tensor that deepcopy would clone through its memo table.
+// Aliased tensors collapse to a single entry, matching the memoization rule
+// in deepcopy. Objects copied via __getstate__/__setstate__ produce their
+// own state, so their attributes are not collected. Tags that deepcopy
+// passes through by value (None, scalars, Device, ...) are skipped silently.
+void collectReachableTensors(
+    const IValue& value,
+    IValue::HashAliasedIValues& visited,
+    std::vector<IValue>& tensors) {
+  if (value.isTensor()) {
+    if (visited.insert(value).second) {
+      tensors.push_back(value);
+    }
+  } else if (value.isTuple()) {
+    if (!visited.insert(value).second) {
+      return;
+    }
+    for (const auto& elem : value.toTupleRef().elements()) {
+      collectReachableTensors(elem, visited, tensors);
+    }
+  } else if (value.isList()) {
+    if (!visited.insert(value).second) {
+      return;
+    }
+    for (const auto& elem : value.toListRef()) {
+      collectReachableTensors(elem, visited, tensors);
+    }
+  } else if (value.isGenericDict()) {
+    if (!visited.insert(value).second) {
+      return;
+    }
+    for (const auto& entry : value.toGenericDict()) {
+      collectReachableTensors(entry.key(), visited, tensors);
+      collectReachableTensors(entry.value(), visited, tensors);
+    }
+  } else if (value.isObject()) {
+    if (!visited.insert(value).second) {
+      return;
+    }
+    auto class_type = value.toObject()->type();
+    if (class_type->hasMethod("__getstate__") &&
+        class_type->hasMethod("__setstate__")) {
+      return;
+    }
+    for (const auto& slot : value.toObject()->slots()) {
+      collectReachableTensors(slot, visited, tensors);
+    }
+  }
+}
+
+} // namespace
+
+IValue IValue::deepcopy_bulk(c10::optional<at::Device> device) const {
+  IValue::HashAliasedIValueMap memo;
+
+  IValue::HashAliasedIValues visited;
+  std::vector<IValue> tensors;
+  collectReachableTensors(*this, visited, tensors);
+
+  // Group the copies by destination device and dtype so that each group is
+  // one arena allocation; the copies then fill pre-carved slices instead of
+  // going through the allocator once per tensor. The slices share the arena
+  // storage, so the arena lives as long as any copy does - the intended
+  // trade for cloning a module whose parameters live and die together.
+  struct Group {
+    std::vector<IValue> sources;
+    int64_t total_numel = 0;
+  };
+  std::vector<std::pair<std::pair<at::Device, at::ScalarType>, Group>> groups;
+  for (const auto& src_ivalue : tensors) {
+    const at::Tensor& src = src_ivalue.toTensor();
+    // Anything the arena cannot represent faithfully falls back to the
+    // regular per-tensor copy in deepcopy below.
+    if (!src.defined() || src.layout() != at::kStrided || src.is_quantized() ||
+        src.numel() == 0 || !src.is_non_overlapping_and_dense() ||
+        src.requires_grad() || src._fw_grad(/*level=*/0).defined() ||
+        src.device().is_meta()) {
+      continue;
+    }
+    auto key = std::make_pair(
+        device.has_value() ? *device : src.device(), src.scalar_type());
+    Group* group = nullptr;
+    for (auto& entry : groups) {
+      if (entry.first == key) {
+        group = &entry.second;
+        break;
+      }
+    }
+    if (group == nullptr) {
+      groups.emplace_back(key, Group());
+      group = &groups.back().second;
+    }
+    group->sources.push_back(src_ivalue);
+    group->total_numel += src.numel();
+  }
+
+  {
+    c10::NoGradGuard no_grad;
+    for (auto& entry : groups) {
+      auto& group = entry.second;
+      const at::Tensor& first = group.sources.front().toTensor();
+      at::Tensor arena = first.new_empty(
+          {group.total_numel}, first.options().device(entry.first.first));
+      int64_t offset = 0;
+      for (const auto& src_ivalue : group.sources) {
+        const at::Tensor& src = src_ivalue.toTensor();
+        // Sources are non-overlapping and dense, so their strides span
+        // exactly numel elements of the slice.
+        at::Tensor copy = arena.narrow(0, offset, src.numel())
+                              .as_strided(src.sizes(), src.strides());
+        copy.copy_(src);
+        memo[src_ivalue] = IValue(std::move(copy));
+        offset += src.numel();
+      }
+    }
+  }
+
+  // The pre-seeded memo entries short-circuit the tensor case; structure
+  // rebuilding and every other tag go through the regular path.
+  return deepcopy(memo, device);
+}
+
 IValue IValue::deepcopy(
     IValue::HashAliasedIValueMap& memo,
     c10::optional<at::Device> device) const {
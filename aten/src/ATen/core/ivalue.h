@@ -1120,6 +1120,14 @@ struct TORCH_API IValue final {
   IValue deepcopy(
       HashAliasedIValueMap& memo,
       c10::optional<at::Device> device = c10::nullopt) const;
+  // Like deepcopy(), but gathers the reachable tensors first and materializes
+  // their copies as slices of one arena allocation per (device, dtype)
+  // group, avoiding an allocator round trip per tensor. The copies share the
+  // arena storage, so prefer this for value graphs whose tensors live and
+  // die together, such as module cloning. Tensors the arena cannot represent
+  // (sparse, quantized, overlapping, autograd-tracked) fall back to the
+  // per-tensor path.
+  IValue deepcopy_bulk(c10::optional<at::Device> device = c10::nullopt) const;
 
  private:
   static c10::intrusive_ptr_target* null_to_undefined_tensor(
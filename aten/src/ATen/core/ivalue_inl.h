@@ -847,13 +847,27 @@ struct C10_EXPORT ivalue::Future final : c10::intrusive_ptr_target {
 
   friend c10::intrusive_ptr<Future>;
 
+ public:
+  // Runs the closure it is handed, somewhere, at some point; e.g. at::launch
+  // or a caller-owned task queue. An empty Executor means "inline on the
+  // thread that completed the future".
+  using Executor = std::function<void(std::function<void()>)>;
+
+ private:
   struct FutureCallback {
     std::function<void(Future&)> callback;
+    Executor executor; // empty means run inline upon completion
     bool uses_future; // whether the Future& passed in is actually used
 
     template <typename T>
     FutureCallback(T callback, bool uses_future)
         : callback(std::move(callback)), uses_future(uses_future) {}
+
+    template <typename T>
+    FutureCallback(T callback, Executor executor, bool uses_future)
+        : callback(std::move(callback)),
+          executor(std::move(executor)),
+          uses_future(uses_future) {}
   };
 
  public:
@@ -958,7 +972,7 @@ struct C10_EXPORT ivalue::Future final : c10::intrusive_ptr_target {
 
     finished_cv_.notify_all();
     for (auto& callback : cbs) {
-      invokeCallback(std::move(callback.callback), callback.uses_future);
+      runCallback(std::move(callback));
     }
   }
 
@@ -1049,6 +1063,37 @@ struct C10_EXPORT ivalue::Future final : c10::intrusive_ptr_target {
     callbacks_.emplace_back(std::move(callback), uses_future);
   }
 
+  /**
+   * Add a callback that is handed to `executor` instead of running inline on
+   * the thread that completes the future. Use this when the completer must
+   * not be blocked (e.g. a watchdog or comm thread finishing the future) and
+   * the continuation is heavy: pass `at::launch` to run it on the inter-op
+   * pool, or a caller-owned queue's post function. The executor receives a
+   * closure that holds a reference on this future and sets up the usual
+   * device/stream environment before running the callback. If the future has
+   * already completed, the callback is posted to the executor immediately.
+   */
+  template <typename T>
+  void addCallback(T callback, Executor executor, bool uses_future = true) {
+#if __cpp_lib_is_invocable >= 201703
+    static_assert(
+        std::is_invocable_r<void, T, Future&>::value,
+        "The callback must have signature void(Future&)");
+#endif
+    TORCH_CHECK(
+        executor, "addCallback() expects a non-empty executor function");
+
+    std::unique_lock<std::mutex> lock(mutex_);
+    if (completed()) {
+      lock.unlock();
+      runCallback(
+          FutureCallback(std::move(callback), std::move(executor), uses_future));
+      return;
+    }
+    callbacks_.emplace_back(
+        std::move(callback), std::move(executor), uses_future);
+  }
+
   /**
    * Add a callback to the future, and return another Future to hold the return
    * value of the callback. This is necessary when the callback provider needs
@@ -1082,6 +1127,43 @@ struct C10_EXPORT ivalue::Future final : c10::intrusive_ptr_target {
     return childFut;
   }
 
+  /**
+   * Like then(callback, type), but the callback runs on `executor` rather
+   * than inline on the completing thread; see the executor-taking overload of
+   * addCallback() for the intended use.
+   */
+  template <typename T>
+  c10::intrusive_ptr<Future> then(T callback, TypePtr type, Executor executor) {
+    using IValueWithStorages = std::tuple<IValue, std::vector<WeakStorage>>;
+#if __cpp_lib_is_invocable >= 201703
+    static_assert(
+        std::disjunction<
+            std::is_invocable_r<IValue, T, Future&>,
+            std::is_invocable_r<IValueWithStorages, T, Future&>>::value,
+        "The callback must have signature IValue(Future&) or "
+        "std::tuple<IValue, std::vector<Storage>>(Future&)");
+#endif
+    auto childFut = createInstance(::std::move(type));
+    addCallback(
+        [childFut, cb = std::move(callback)](Future& parentFut) mutable {
+          try {
+            if constexpr (::std::is_convertible_v<
+                              typename c10::invoke_result_t<T&&, Future&>,
+                              IValueWithStorages>) {
+              auto [ivalue, storages] = cb(parentFut);
+              childFut->markCompleted(
+                  ::std::move(ivalue), ::std::move(storages));
+            } else {
+              childFut->markCompleted(cb(parentFut));
+            }
+          } catch (std::exception&) {
+            childFut->setError(std::current_exception());
+          }
+        },
+        std::move(executor));
+    return childFut;
+  }
+
   template <typename T>
   c10::intrusive_ptr<Future> thenAsync(T callback, TypePtr type) {
 #if __cpp_lib_is_invocable >= 201703
@@ -1189,6 +1271,24 @@ struct C10_EXPORT ivalue::Future final : c10::intrusive_ptr_target {
     }
   }
 
+  // Runs a stored callback either inline or, if it carries an executor, by
+  // posting it there. The posted closure keeps a reference on this future so
+  // it outlives the completer and any other owners.
+  void runCallback(FutureCallback&& cb) {
+    if (cb.executor) {
+      auto executor = std::move(cb.executor);
+      executor([self =
+                    c10::intrusive_ptr<Future>::unsafe_reclaim_from_nonowning(
+                        this),
+                callback = std::move(cb.callback),
+                uses_future = cb.uses_future]() mutable {
+        self->invokeCallback(std::move(callback), uses_future);
+      });
+    } else {
+      invokeCallback(std::move(cb.callback), cb.uses_future);
+    }
+  }
+
   // This method should be called before this future's value is used, as it
   // ensures that the CUDA streams that are "current" at the callsite properly
   // synchronize with the value.
@@ -1228,7 +1328,7 @@ struct C10_EXPORT ivalue::Future final : c10::intrusive_ptr_target {
 
     finished_cv_.notify_all();
     for (auto& callback : cbs) {
-      invokeCallback(std::move(callback.callback), callback.uses_future);
+      runCallback(std::move(callback));
     }
   }
 
@@ -92,6 +92,33 @@ TEST(OperatorRegistrationTest, whenRegisteringWithNameAfterKernelInOptionsObject
   EXPECT_TRUE(called);
 }
 
+TEST(OperatorRegistrationTest, givenInternedOperatorName_whenLookingUpById_thenFindsSameOperator) {
+  bool called = false;
+  auto registrar = c10::RegisterOperators().op(c10::RegisterOperators::options().schema("_test::dummy(Tensor dummy) -> ()").catchAllKernel<MockKernel>(&called));
+
+  auto id = Dispatcher::singleton().internOperatorName({"_test::dummy", ""});
+  // Interning is idempotent.
+  EXPECT_EQ(id, Dispatcher::singleton().internOperatorName({"_test::dummy", ""}));
+
+  auto op = Dispatcher::singleton().findOp(id);
+  ASSERT_TRUE(op.has_value());
+  EXPECT_EQ(op->operator_name(), (OperatorName{"_test::dummy", ""}));
+  callOp(*op, dummyTensor(c10::DispatchKey::CPU));
+  EXPECT_TRUE(called);
+}
+
+TEST(OperatorRegistrationTest, givenInternedOperatorName_whenDeregisteringAndReregistering_thenIdStaysValid) {
+  auto id = Dispatcher::singleton().internOperatorName({"_test::dummy", ""});
+  {
+    auto registrar = c10::RegisterOperators().op("_test::dummy(Tensor dummy) -> ()");
+    EXPECT_TRUE(Dispatcher::singleton().findOp(id).has_value());
+  }
+  // Deregistered: the slot empties out but the id remains usable.
+  EXPECT_FALSE(Dispatcher::singleton().findOp(id).has_value());
+  auto registrar = c10::RegisterOperators().op("_test::dummy(Tensor dummy) -> ()");
+  EXPECT_TRUE(Dispatcher::singleton().findOp(id).has_value());
+}
+
 TEST(OperatorRegistrationTest, whenRegisteringWithoutSchema_thenFails) {
   expectThrows<c10::Error>([] {
     c10::RegisterOperators().op(c10::RegisterOperators::options().catchAllKernel<DummyKernel>());
@@ -900,6 +900,27 @@ inline Vectorized<T> fmsub(const Vectorized<T>& a, const Vectorized<T>& b, const
   return a * b - c;
 }
 
+// Relaxed-accuracy transcendentals. ISAs with a cheap FMA polynomial
+// implementation specialize these (see e.g. vec256_float.h); everything
+// else falls back to the full-precision member functions. Kernels must not
+// call these unconditionally -- they are only for code paths gated on
+// at::globalContext().allowFastMathTranscendentalsCPU(), since the
+// specializations trade a few ulp (and NaN propagation in exp) for speed.
+template <typename T>
+inline Vectorized<T> fast_exp(const Vectorized<T>& x) {
+  return x.exp();
+}
+
+template <typename T>
+inline Vectorized<T> fast_erf(const Vectorized<T>& x) {
+  return x.erf();
+}
+
+template <typename T>
+inline Vectorized<T> fast_tanh(const Vectorized<T>& x) {
+  return x.tanh();
+}
+
 template <int64_t scale = 1, typename T = void>
 std::enable_if_t<scale == 1 || scale == 2 || scale == 4 || scale == 8, Vectorized<T>>
 inline gather(T const* base_addr, const Vectorized<int_same_size_t<T>>& vindex) {
@@ -0,0 +1,106 @@
+#include <ATen/cuda/BatchedTransfer.h>
+
+#include <ATen/cuda/CUDAContext.h>
+#include <ATen/cuda/CachingHostAllocator.h>
+#include <c10/cuda/CUDAGuard.h>
+#include <c10/util/irange.h>
+
+#ifndef AT_PER_OPERATOR_HEADERS
+#include <ATen/Functions.h>
+#else
+#include <ATen/ops/empty.h>
+#endif
+
+#include <cstring>
+
+namespace at::cuda {
+
+namespace {
+
+// Matches the device allocator's block alignment, so every view handed back
+// is aligned well enough for any dtype and for vectorized kernels.
+constexpr size_t kStagingAlignment = 256;
+
+size_t align_up(size_t n) {
+  return (n + kStagingAlignment - 1) & ~(kStagingAlignment - 1);
+}
+
+} // namespace
+
+std::vector<Tensor> batched_copy_to_device(TensorList tensors, Device device) {
+  TORCH_CHECK(
+      device.is_cuda(),
+      "batched_copy_to_device expects a CUDA destination, but got ",
+      device);
+
+  // Lay the sources out back-to-back in one staging buffer.
+  size_t total = 0;
+  std::vector<size_t> offsets;
+  offsets.reserve(tensors.size());
+  for (const auto& t : tensors) {
+    TORCH_CHECK(
+        t.device().is_cpu() && t.layout() == kStrided,
+        "batched_copy_to_device expects strided CPU sources, but got a ",
+        t.layout(),
+        " tensor on ",
+        t.device());
+    offsets.push_back(total);
+    total += align_up(t.nbytes());
+  }
+
+  std::vector<Tensor> results(tensors.size());
+  if (total == 0) {
+    for (const auto i : c10::irange(tensors.size())) {
+      results[i] = at::empty(
+          tensors[i].sizes(), tensors[i].options().device(device));
+    }
+    return results;
+  }
+
+  auto staging = at::empty(
+      {static_cast<int64_t>(total)},
+      at::TensorOptions().dtype(kByte).pinned_memory(true));
+  auto* staging_data = static_cast<char*>(staging.data_ptr());
+  for (const auto i : c10::irange(tensors.size())) {
+    if (tensors[i].numel() == 0) {
+      continue;
+    }
+    // Materialize any lazy conj/neg and non-contiguity on the host; the
+    // device side then only ever sees plain contiguous bytes.
+    auto src = tensors[i].resolve_conj().resolve_neg().contiguous();
+    std::memcpy(
+        staging_data + offsets[i], src.const_data_ptr(), src.nbytes());
+  }
+
+  CUDAGuard device_guard(device);
+  auto device_buf = at::empty(
+      {static_cast<int64_t>(total)},
+      at::TensorOptions().dtype(kByte).device(device));
+  auto stream = getCurrentCUDAStream(device.index());
+  C10_CUDA_CHECK(cudaMemcpyAsync(
+      device_buf.data_ptr(),
+      staging_data,
+      total,
+      cudaMemcpyHostToDevice,
+      stream));
+  // Keep the pinned staging block from being recycled while the copy is in
+  // flight, same as the single-tensor path in copy_device_to_device.
+  CachingHostAllocator_recordEvent(
+      staging_data, staging.storage().data_ptr().get_context(), stream);
+
+  // Hand back dtype/shape-correct views into the one device allocation; the
+  // shared storage keeps it alive for as long as any result does.
+  for (const auto i : c10::irange(tensors.size())) {
+    const auto& t = tensors[i];
+    results[i] = device_buf
+                     .narrow(
+                         0,
+                         static_cast<int64_t>(offsets[i]),
+                         static_cast<int64_t>(t.nbytes()))
+                     .view(t.scalar_type())
+                     .view(t.sizes());
+  }
+  return results;
+}
+
+} // namespace at::cuda
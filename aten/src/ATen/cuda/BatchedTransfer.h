@@ -0,0 +1,30 @@
+#pragma once
+
+#include <ATen/core/Tensor.h>
+
+#include <vector>
+
+namespace at::cuda {
+
+// Copies a list of CPU tensors to `device` with one cudaMemcpyAsync instead
+// of one per tensor. The sources are packed back-to-back (256-byte aligned)
+// into a single pinned staging buffer on the calling thread, transferred in
+// one stream-ordered copy on the device's current stream, and returned as
+// dtype/shape-correct views into one contiguous device allocation.
+//
+// The transfer is asynchronous, with the same discipline as
+// Tensor.to(device, non_blocking=True): the results are safe to use from
+// work enqueued on the current stream, and the staging buffer comes from the
+// caching host allocator with the in-flight copy's event recorded, so it is
+// not recycled early. Intended for input pipelines (e.g. the DataLoader
+// pin_memory thread) that move dozens of small tensors per batch, where
+// per-copy launch overhead dominates below ~64KB.
+//
+// The returned tensors alias a single device buffer; in-place resizes of
+// them are not supported. Non-contiguous sources are packed via a contiguous
+// host-side copy first.
+TORCH_CUDA_CPP_API std::vector<Tensor> batched_copy_to_device(
+    TensorList tensors,
+    Device device);
+
+} // namespace at::cuda
@@ -9,8 +9,12 @@
 #include <c10/cuda/CUDACachingAllocator.h>
 #include <c10/cuda/CUDAFunctions.h>
 #include <c10/macros/Export.h>
+#include <c10/util/hash.h>
 #include <c10/util/irange.h>
 
+#include <mutex>
+#include <unordered_map>
+
 // cublasLT was introduced in CUDA 10.1 but we enable only for 11.1 that also
 // added bf16 support
 #if !defined(USE_ROCM) && !defined(_MSC_VER)
@@ -620,6 +624,43 @@ class CuBlasLtMatmulPreference : public CuBlasLtDescriptor<
     TORCH_CUDABLAS_CHECK(::cublasLtMatmulPreferenceSetAttribute(descriptor(), attr, &value, sizeof(T)));
   }
 };
+
+// Note [cuBLASLt algo cache]
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~
+// cublasLtMatmulAlgoGetHeuristic costs a few microseconds per call, which
+// shows up on latency-sensitive paths (e.g. decode steps of autoregressive
+// models) that issue the same bias-fused GEMM thousands of times. The chosen
+// algo only depends on the matmul configuration - transposes, problem sizes,
+// leading dimensions, data/compute types, epilogue, operand alignments and
+// the device - so we memoize it process-wide, keyed on a hash of those
+// fields. The workspace needs no caching of its own: it is a fixed
+// _getWorkspaceSize() allocation that the caching allocator serves from its
+// free lists after the first call on a stream.
+class CuBlasLtMatmulAlgoCache {
+ public:
+  c10::optional<cublasLtMatmulAlgo_t> find(uint64_t key) {
+    std::lock_guard<std::mutex> guard(mutex_);
+    auto it = map_.find(key);
+    if (it == map_.end()) {
+      return c10::nullopt;
+    }
+    return it->second;
+  }
+
+  void insert(uint64_t key, const cublasLtMatmulAlgo_t& algo) {
+    std::lock_guard<std::mutex> guard(mutex_);
+    map_.emplace(key, algo);
+  }
+
+ private:
+  std::mutex mutex_;
+  std::unordered_map<uint64_t, cublasLtMatmulAlgo_t> map_;
+};
+
+CuBlasLtMatmulAlgoCache& _getMatmulAlgoCache() {
+  static CuBlasLtMatmulAlgoCache cache;
+  return cache;
+}
 } // namespace
 
 template <typename Dtype>
@@ -697,23 +738,49 @@ void gemm_and_bias(
   auto& allocator = *::c10::cuda::CUDACachingAllocator::get();
   auto workspace = allocator.allocate(workspaceSize);
 
-  cublasLtMatmulHeuristicResult_t heuristicResult = {};
-  int returnedResult = 0;
   cublasLtHandle_t ltHandle =
       reinterpret_cast<cublasLtHandle_t>(at::cuda::getCurrentCUDABlasHandle());
-  TORCH_CUDABLAS_CHECK(cublasLtMatmulAlgoGetHeuristic(
-      ltHandle,
-      computeDesc.descriptor(),
-      Adesc.descriptor(),
-      Bdesc.descriptor(),
-      Cdesc.descriptor(),
-      Cdesc.descriptor(),
-      preference.descriptor(),
-      1,
-      &heuristicResult,
-      &returnedResult));
-  if (returnedResult == 0) {
-    TORCH_CUDABLAS_CHECK(CUBLAS_STATUS_NOT_SUPPORTED);
+  // See Note [cuBLASLt algo cache]
+  uint64_t algo_key = c10::get_hash(
+      c10::cuda::current_device(),
+      transpose_mat1,
+      transpose_mat2,
+      m,
+      n,
+      k,
+      mat1_ld,
+      mat2_ld,
+      result_ld,
+      abcType,
+      computeType,
+      epilogue,
+      a_alignment,
+      b_alignment,
+      c_alignment,
+      d_alignment);
+  cublasLtMatmulAlgo_t algo;
+  auto cached_algo = _getMatmulAlgoCache().find(algo_key);
+  if (cached_algo.has_value()) {
+    algo = *cached_algo;
+  } else {
+    cublasLtMatmulHeuristicResult_t heuristicResult = {};
+    int returnedResult = 0;
+    TORCH_CUDABLAS_CHECK(cublasLtMatmulAlgoGetHeuristic(
+        ltHandle,
+        computeDesc.descriptor(),
+        Adesc.descriptor(),
+        Bdesc.descriptor(),
+        Cdesc.descriptor(),
+        Cdesc.descriptor(),
+        preference.descriptor(),
+        1,
+        &heuristicResult,
+        &returnedResult));
+    if (returnedResult == 0) {
+      TORCH_CUDABLAS_CHECK(CUBLAS_STATUS_NOT_SUPPORTED);
+    }
+    algo = heuristicResult.algo;
+    _getMatmulAlgoCache().insert(algo_key, algo);
   }
 
   cublasStatus_t cublasStatus = cublasLtMatmul(
@@ -729,7 +796,7 @@ void gemm_and_bias(
       Cdesc.descriptor(),
       result_ptr,
       Cdesc.descriptor(),
-      &heuristicResult.algo,
+      &algo,
       workspace.mutable_get(),
       workspaceSize,
       at::cuda::getCurrentCUDAStream());
@@ -874,23 +941,48 @@ void scaled_gemm(
 
   CuBlasLtMatmulPreference preference;
   preference.setAttribute(CUBLASLT_MATMUL_PREF_MAX_WORKSPACE_BYTES, workspaceSize);
-  cublasLtMatmulHeuristicResult_t heuristicResult = {};
-  int returnedResult = 0;
   cublasLtHandle_t ltHandle =
       reinterpret_cast<cublasLtHandle_t>(at::cuda::getCurrentCUDABlasHandle());
-  TORCH_CUDABLAS_CHECK(cublasLtMatmulAlgoGetHeuristic(
-      ltHandle,
-      computeDesc.descriptor(),
-      Adesc.descriptor(),
-      Bdesc.descriptor(),
-      Cdesc.descriptor(),
-      Ddesc.descriptor(),
-      preference.descriptor(),
-      1,
-      &heuristicResult,
-      &returnedResult));
-  if (returnedResult == 0) {
-    TORCH_CUDABLAS_CHECK(CUBLAS_STATUS_NOT_SUPPORTED);
+  // See Note [cuBLASLt algo cache]
+  uint64_t algo_key = c10::get_hash(
+      c10::cuda::current_device(),
+      transa,
+      transb,
+      m,
+      n,
+      k,
+      mat1_ld,
+      mat2_ld,
+      result_ld,
+      mat1_dtype,
+      mat2_dtype,
+      bias_dtype,
+      result_dtype,
+      fastAccuMode,
+      bias_ptr != nullptr);
+  cublasLtMatmulAlgo_t algo;
+  auto cached_algo = _getMatmulAlgoCache().find(algo_key);
+  if (cached_algo.has_value()) {
+    algo = *cached_algo;
+  } else {
+    cublasLtMatmulHeuristicResult_t heuristicResult = {};
+    int returnedResult = 0;
+    TORCH_CUDABLAS_CHECK(cublasLtMatmulAlgoGetHeuristic(
+        ltHandle,
+        computeDesc.descriptor(),
+        Adesc.descriptor(),
+        Bdesc.descriptor(),
+        Cdesc.descriptor(),
+        Ddesc.descriptor(),
+        preference.descriptor(),
+        1,
+        &heuristicResult,
+        &returnedResult));
+    if (returnedResult == 0) {
+      TORCH_CUDABLAS_CHECK(CUBLAS_STATUS_NOT_SUPPORTED);
+    }
+    algo = heuristicResult.algo;
+    _getMatmulAlgoCache().insert(algo_key, algo);
   }
   float alpha_val = 1.0;
   float beta_val = 0.0;
@@ -907,7 +999,7 @@ void scaled_gemm(
       Cdesc.descriptor(),
       result_ptr,
       Ddesc.descriptor(),
-      &heuristicResult.algo,
+      &algo,
       workspace.mutable_get(),
       workspaceSize,
       at::cuda::getCurrentCUDAStream());
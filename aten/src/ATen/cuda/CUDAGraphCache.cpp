@@ -0,0 +1,190 @@
+#include <ATen/cuda/CUDAGraphCache.h>
+
+#include <c10/cuda/CUDACachingAllocator.h>
+#include <c10/util/hash.h>
+#include <c10/util/irange.h>
+
+#include <algorithm>
+#include <atomic>
+#include <vector>
+
+namespace at::cuda {
+
+namespace {
+
+// Replay recency is stamped from one process-wide tick so that the
+// out-of-memory eviction below can compare entries across caches.
+std::atomic<uint64_t> graph_cache_tick{1};
+
+// Live caches, so the caching allocator's OOM retry can shed graphs.
+std::mutex cache_registry_mutex;
+std::vector<CUDAGraphCache*> live_caches;
+
+void register_cache(CUDAGraphCache* cache) {
+  std::lock_guard<std::mutex> g(cache_registry_mutex);
+  live_caches.push_back(cache);
+}
+
+void unregister_cache(CUDAGraphCache* cache) {
+  std::lock_guard<std::mutex> g(cache_registry_mutex);
+  live_caches.erase(
+      std::find(live_caches.begin(), live_caches.end(), cache));
+}
+
+// Hooks into the caching allocator's retry path (see
+// trigger_free_memory_callbacks in CUDACachingAllocator.cpp): before the
+// allocator flushes its own cache on OOM, give back the memory held by the
+// least recently replayed graphs.
+struct EvictCachedGraphOnOOM : public c10::FreeMemoryCallback {
+  bool Execute() override {
+    std::lock_guard<std::mutex> g(cache_registry_mutex);
+    bool freed = false;
+    for (auto* cache : live_caches) {
+      freed |= cache->evict_lru();
+    }
+    return freed;
+  }
+};
+
+REGISTER_FREE_MEMORY_CALLBACK(evict_cached_cuda_graph, EvictCachedGraphOnOOM);
+
+} // namespace
+
+size_t CUDAGraphCache::ShapeKeyHash::operator()(const ShapeKey& key) const {
+  size_t seed = key.size();
+  for (auto v : key) {
+    seed = c10::hash_combine(seed, c10::get_hash(v));
+  }
+  return seed;
+}
+
+CUDAGraphCache::ShapeKey CUDAGraphCache::key_of(TensorList inputs) {
+  ShapeKey key;
+  for (const auto& t : inputs) {
+    key.push_back(static_cast<int64_t>(t.scalar_type()));
+    key.push_back(t.is_cuda() ? t.get_device() : -1);
+    key.push_back(t.dim());
+    for (auto s : t.sizes()) {
+      key.push_back(s);
+    }
+    for (auto s : t.strides()) {
+      key.push_back(s);
+    }
+  }
+  return key;
+}
+
+CUDAGraphCache::CUDAGraphCache(size_t max_graphs)
+    : max_graphs_(max_graphs), pool_(graph_pool_handle()) {
+  TORCH_CHECK(max_graphs > 0, "CUDAGraphCache needs a capacity of at least 1");
+  register_cache(this);
+}
+
+CUDAGraphCache::~CUDAGraphCache() {
+  unregister_cache(this);
+}
+
+bool CUDAGraphCache::replay_if_cached(TensorList inputs) {
+  std::lock_guard<std::mutex> g(mutex_);
+  auto it = graphs_.find(key_of(inputs));
+  if (it == graphs_.end()) {
+    return false;
+  }
+  auto& entry = it->second;
+  // The signature matched, so the placeholders pairwise match the inputs in
+  // dtype and geometry. Stage the fresh data on the current stream; the
+  // replay below is stream-ordered after the copies.
+  for (const auto i : c10::irange(inputs.size())) {
+    if (!entry.placeholders[i].is_same(inputs[i])) {
+      entry.placeholders[i].copy_(inputs[i], /*non_blocking=*/true);
+    }
+  }
+  entry.last_use = graph_cache_tick++;
+  entry.graph->replay();
+  return true;
+}
+
+CUDAGraph& CUDAGraphCache::begin_capture(TensorList inputs) {
+  std::lock_guard<std::mutex> g(mutex_);
+  TORCH_CHECK(
+      !capturing_,
+      "CUDAGraphCache::begin_capture called while another capture on this "
+      "cache is in progress");
+  auto key = key_of(inputs);
+  TORCH_CHECK(
+      graphs_.find(key) == graphs_.end(),
+      "CUDAGraphCache already holds a graph for this input signature");
+  pending_key_ = std::move(key);
+  pending_entry_.graph = std::make_unique<CUDAGraph>();
+  pending_entry_.placeholders = inputs.vec();
+  capturing_ = true;
+  pending_entry_.graph->capture_begin(pool_);
+  return *pending_entry_.graph;
+}
+
+void CUDAGraphCache::end_capture() {
+  std::lock_guard<std::mutex> g(mutex_);
+  TORCH_CHECK(
+      capturing_,
+      "CUDAGraphCache::end_capture called without a matching begin_capture");
+  pending_entry_.graph->capture_end();
+  pending_entry_.last_use = graph_cache_tick++;
+  graphs_.emplace(std::move(pending_key_), std::move(pending_entry_));
+  pending_entry_ = Entry();
+  capturing_ = false;
+  while (graphs_.size() > max_graphs_) {
+    evict_lru_locked();
+  }
+}
+
+size_t CUDAGraphCache::size() const {
+  std::lock_guard<std::mutex> g(mutex_);
+  return graphs_.size();
+}
+
+void CUDAGraphCache::set_max_graphs(size_t max_graphs) {
+  TORCH_CHECK(max_graphs > 0, "CUDAGraphCache needs a capacity of at least 1");
+  std::lock_guard<std::mutex> g(mutex_);
+  max_graphs_ = max_graphs;
+  while (graphs_.size() > max_graphs_) {
+    evict_lru_locked();
+  }
+}
+
+bool CUDAGraphCache::evict_lru() {
+  // try_lock rather than lock: this is called from the allocator's OOM
+  // retry, which may fire while this thread already holds mutex_ (e.g. an
+  // allocation made by copy_ in replay_if_cached). Skipping the eviction is
+  // always safe; the allocator falls back to flushing its own cache.
+  std::unique_lock<std::mutex> g(mutex_, std::try_to_lock);
+  if (!g.owns_lock()) {
+    return false;
+  }
+  return evict_lru_locked();
+}
+
+bool CUDAGraphCache::evict_lru_locked() {
+  if (graphs_.empty()) {
+    return false;
+  }
+  auto victim = graphs_.begin();
+  for (auto it = graphs_.begin(); it != graphs_.end(); ++it) {
+    if (it->second.last_use < victim->second.last_use) {
+      victim = it;
+    }
+  }
+  // ~CUDAGraph drops the graph's reference on the shared pool, making its
+  // blocks reusable by later captures (and releasable once the pool's last
+  // graph is gone).
+  graphs_.erase(victim);
+  return true;
+}
+
+void CUDAGraphCache::clear() {
+  std::lock_guard<std::mutex> g(mutex_);
+  TORCH_CHECK(
+      !capturing_, "CUDAGraphCache::clear called during an active capture");
+  graphs_.clear();
+}
+
+} // namespace at::cuda
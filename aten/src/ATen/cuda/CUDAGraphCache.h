@@ -0,0 +1,99 @@
+#pragma once
+
+#include <ATen/core/Tensor.h>
+#include <ATen/cuda/CUDAGraph.h>
+
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+namespace at::cuda {
+
+// A shape-bucketed cache of captured CUDA graphs, keyed by the signature
+// (dtype, device, sizes, strides) of the input tensors. All graphs in one
+// cache share a private memory pool obtained from graph_pool_handle(), so
+// ~20 recurring inference shapes cost one pool, not 20.
+//
+// Usage, per incoming batch:
+//
+//   if (!cache.replay_if_cached(inputs)) {
+//     auto& graph = cache.begin_capture(inputs);
+//     (void)graph;
+//     run_model(inputs);  // on the capture stream, reading `inputs`
+//     cache.end_capture();
+//   }
+//
+// begin_capture remembers `inputs` as the bucket's placeholder tensors;
+// replay_if_cached copies fresh data into them (non_blocking, on the current
+// stream) before replaying, so the caller does not need to keep per-shape
+// static tensors around. Output tensors captured by the graph are the
+// caller's to retain, exactly as with a hand-managed CUDAGraph.
+//
+// When the cache exceeds its capacity, or when the caching allocator runs
+// out of device memory, the least recently replayed graph is freed. All
+// methods are thread-safe, but capture itself (begin_capture..end_capture)
+// is one-at-a-time per cache.
+class TORCH_CUDA_CPP_API CUDAGraphCache {
+ public:
+  explicit CUDAGraphCache(size_t max_graphs = 32);
+  ~CUDAGraphCache();
+
+  CUDAGraphCache(const CUDAGraphCache&) = delete;
+  CUDAGraphCache& operator=(const CUDAGraphCache&) = delete;
+
+  // If a graph is cached for `inputs`' shape signature, copies `inputs` into
+  // the bucket's placeholder tensors, replays the graph on the current
+  // stream, and returns true. Returns false on a miss.
+  bool replay_if_cached(TensorList inputs);
+
+  // Begins capture of a new graph for `inputs`' shape signature, drawing
+  // memory from the cache's shared pool. `inputs` become the bucket's
+  // placeholder tensors: the captured region must read from them, and they
+  // must stay alive as long as the cached graph. Must be paired with
+  // end_capture on the same thread.
+  CUDAGraph& begin_capture(TensorList inputs);
+  void end_capture();
+
+  // id of the private memory pool shared by all graphs in this cache
+  MempoolId_t pool() const {
+    return pool_;
+  }
+
+  size_t size() const;
+  // Shrinks the cache immediately if it holds more than max_graphs.
+  void set_max_graphs(size_t max_graphs);
+  // Frees the least recently replayed graph. Returns false if the cache is
+  // empty. Called by the caching allocator's out-of-memory retry path.
+  bool evict_lru();
+  void clear();
+
+ private:
+  // Flattened (dtype, device, ndim, sizes, strides) of every input; exact
+  // equality, so distinct signatures can never alias a bucket.
+  using ShapeKey = std::vector<int64_t>;
+  struct ShapeKeyHash {
+    size_t operator()(const ShapeKey& key) const;
+  };
+  struct Entry {
+    std::unique_ptr<CUDAGraph> graph;
+    std::vector<Tensor> placeholders;
+    uint64_t last_use{0};
+  };
+
+  static ShapeKey key_of(TensorList inputs);
+  bool evict_lru_locked();
+
+  mutable std::mutex mutex_;
+  size_t max_graphs_;
+  MempoolId_t pool_;
+  std::unordered_map<ShapeKey, Entry, ShapeKeyHash> graphs_;
+
+  // in-flight capture state
+  bool capturing_{false};
+  ShapeKey pending_key_;
+  Entry pending_entry_;
+};
+
+} // namespace at::cuda
@@ -0,0 +1,260 @@
+#include <ATen/cuda/CUDAStreamScheduler.h>
+
+#include <ATen/cuda/CUDAContext.h>
+#include <ATen/cuda/CUDAEvent.h>
+#include <ATen/record_function.h>
+#include <c10/cuda/CUDACachingAllocator.h>
+#include <c10/util/irange.h>
+
+#include <memory>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+namespace at::cuda {
+namespace {
+
+// Note [Eager stream scheduler]
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// Eager mode launches every kernel on the current stream, so independent
+// branches of a model serialize even though the GPU could overlap them. The
+// scheduler intercepts op execution through a thread-local RecordFunction
+// callback - the hook the profiler already uses, so it sees every dispatched
+// op without a new dispatch key - and picks a stream per top-level op:
+//
+//  - an op whose inputs were produced inside the scope stays on the stream
+//    that produced most of them, so dependent chains run back to back with
+//    no synchronization;
+//  - an op with no tracked producers (factory ops, tensors created before
+//    the scope) is assigned round-robin, which fans independent branches
+//    out across the pool;
+//  - when an input does cross streams, the consuming stream waits on the
+//    event recorded when the producer ran. That is the only
+//    synchronization inserted.
+//
+// Producer records live in a map owned by the scope rather than in a field
+// on TensorImpl: the scheduler is scoped and opt-in, and growing every
+// TensorImpl for it would tax all modes. Each record holds a weak reference
+// to its impl, which both keeps the address from being reused and lets
+// lookups drop records for tensors that have died. Nested ops (scope depth
+// tracked per thread) are left alone - they run on whatever stream their
+// enclosing op was scheduled to.
+//
+// Cross-stream memory safety follows the usual caching-allocator contract:
+// every input consumed by a scheduled op is recordStream()'d against the
+// op's stream, and on scope exit the surrounding stream waits on all
+// outstanding producer events and is recorded against surviving outputs so
+// it may freely use and free them.
+
+struct ProducerRecord {
+  CUDAStream stream;
+  std::shared_ptr<CUDAEvent> event;
+  c10::weak_intrusive_ptr<c10::TensorImpl, c10::UndefinedTensorImpl> weak;
+};
+
+struct StreamSchedulerState {
+  explicit StreamSchedulerState(CUDAStream original)
+      : device_index(original.device_index()), original_stream(original) {}
+
+  c10::DeviceIndex device_index;
+  CUDAStream original_stream;
+  std::vector<CUDAStream> pool;
+  size_t next_stream = 0;
+  int64_t depth = 0;
+  at::CallbackHandle handle = at::INVALID_CALLBACK_HANDLE;
+  std::unordered_map<c10::TensorImpl*, ProducerRecord> producers;
+};
+
+thread_local std::unique_ptr<StreamSchedulerState> scheduler_state;
+
+struct SchedulerObserverContext : public at::ObserverContext {
+  bool scheduled = false;
+  c10::optional<CUDAStream> stream;
+};
+
+// Visits every defined CUDA tensor on `device_index` in a sequence of
+// IValues, looking through tensor lists.
+template <typename Container, typename F>
+void for_each_cuda_tensor(
+    const Container& values,
+    c10::DeviceIndex device_index,
+    const F& f) {
+  auto visit = [&](const at::Tensor& tensor) {
+    if (tensor.defined() && tensor.is_cuda() &&
+        tensor.device().index() == device_index) {
+      f(tensor);
+    }
+  };
+  for (const c10::IValue& value : values) {
+    if (value.isTensor()) {
+      visit(value.toTensor());
+    } else if (value.isTensorList()) {
+      for (const at::Tensor& tensor : value.toTensorList()) {
+        visit(tensor);
+      }
+    }
+  }
+}
+
+std::unique_ptr<at::ObserverContext> onFunctionEnter(
+    const at::RecordFunction& fn) {
+  auto ctx = std::make_unique<SchedulerObserverContext>();
+  auto* state = scheduler_state.get();
+  if (state == nullptr || state->depth++ > 0) {
+    return ctx;
+  }
+
+  // Prefer the stream that produced most of this op's inputs; dependent
+  // chains then need no events at all.
+  c10::optional<CUDAStream> chosen;
+  std::vector<std::pair<CUDAStream, int64_t>> votes;
+  for_each_cuda_tensor(
+      fn.inputs(), state->device_index, [&](const at::Tensor& tensor) {
+        auto it = state->producers.find(tensor.unsafeGetTensorImpl());
+        if (it == state->producers.end()) {
+          return;
+        }
+        if (it->second.weak.expired()) {
+          state->producers.erase(it);
+          return;
+        }
+        for (auto& vote : votes) {
+          if (vote.first == it->second.stream) {
+            vote.second++;
+            return;
+          }
+        }
+        votes.emplace_back(it->second.stream, 1);
+      });
+  int64_t best = 0;
+  for (const auto& vote : votes) {
+    if (vote.second > best) {
+      best = vote.second;
+      chosen = vote.first;
+    }
+  }
+  if (!chosen.has_value()) {
+    chosen = state->pool[state->next_stream++ % state->pool.size()];
+  }
+
+  // Wait for inputs produced on other streams and tell the allocator about
+  // the cross-stream use so their blocks are not reused too early.
+  for_each_cuda_tensor(
+      fn.inputs(), state->device_index, [&](const at::Tensor& tensor) {
+        auto it = state->producers.find(tensor.unsafeGetTensorImpl());
+        if (it != state->producers.end() && it->second.stream != *chosen) {
+          it->second.event->block(*chosen);
+        }
+        if (tensor.has_storage()) {
+          c10::cuda::CUDACachingAllocator::recordStream(
+              tensor.storage().data_ptr(), *chosen);
+        }
+      });
+
+  setCurrentCUDAStream(*chosen);
+  ctx->scheduled = true;
+  ctx->stream = chosen;
+  return ctx;
+}
+
+void onFunctionExit(const at::RecordFunction& fn, at::ObserverContext* raw_ctx) {
+  auto* state = scheduler_state.get();
+  if (state == nullptr) {
+    return;
+  }
+  state->depth--;
+  auto* ctx = static_cast<SchedulerObserverContext*>(raw_ctx);
+  if (ctx == nullptr || !ctx->scheduled) {
+    return;
+  }
+
+  // One event per op, shared by all of its outputs; it is only ever waited
+  // on if a consumer lands on a different stream.
+  std::shared_ptr<CUDAEvent> event;
+  for_each_cuda_tensor(
+      fn.outputs(), state->device_index, [&](const at::Tensor& tensor) {
+        if (!event) {
+          event = std::make_shared<CUDAEvent>(cudaEventDisableTiming);
+          event->record(*ctx->stream);
+        }
+        state->producers.insert_or_assign(
+            tensor.unsafeGetTensorImpl(),
+            ProducerRecord{
+                *ctx->stream,
+                event,
+                c10::weak_intrusive_ptr<
+                    c10::TensorImpl,
+                    c10::UndefinedTensorImpl>(tensor.getIntrusivePtr())});
+      });
+
+  // Host code between ops (and unscheduled nested work) keeps seeing the
+  // stream that was current when the scope was entered.
+  setCurrentCUDAStream(state->original_stream);
+}
+
+} // namespace
+
+void enableStreamScheduler(int64_t num_streams) {
+  TORCH_CHECK(
+      scheduler_state == nullptr,
+      "CUDA stream scheduler is already enabled on this thread");
+  TORCH_CHECK(
+      num_streams >= 1,
+      "CUDA stream scheduler needs at least one stream, got ",
+      num_streams);
+  auto original = getCurrentCUDAStream();
+  auto state = std::make_unique<StreamSchedulerState>(original);
+
+  // Order everything scheduled inside the scope after work already queued
+  // on the surrounding stream.
+  CUDAEvent entry_event(cudaEventDisableTiming);
+  entry_event.record(original);
+  state->pool.reserve(num_streams);
+  for (C10_UNUSED const auto i : c10::irange(num_streams)) {
+    auto stream =
+        getStreamFromPool(/*isHighPriority=*/false, state->device_index);
+    entry_event.block(stream);
+    state->pool.push_back(stream);
+  }
+
+  state->handle = at::addThreadLocalCallback(
+      at::RecordFunctionCallback(&onFunctionEnter, &onFunctionExit)
+          .needsInputs(true)
+          .needsOutputs(true)
+          .scopes({at::RecordScope::FUNCTION}));
+  scheduler_state = std::move(state);
+}
+
+void disableStreamScheduler() {
+  auto* state = scheduler_state.get();
+  TORCH_CHECK(
+      state != nullptr,
+      "CUDA stream scheduler is not enabled on this thread");
+  at::removeCallback(state->handle);
+
+  // Join the pool back into the surrounding stream: it waits on every
+  // outstanding producer event, and surviving outputs are recorded against
+  // it so it may use and free them.
+  std::unordered_set<CUDAEvent*> blocked;
+  for (auto& entry : state->producers) {
+    auto& record = entry.second;
+    if (blocked.insert(record.event.get()).second) {
+      record.event->block(state->original_stream);
+    }
+    auto alive = record.weak.lock();
+    if (alive && alive->has_storage()) {
+      c10::cuda::CUDACachingAllocator::recordStream(
+          alive->storage().data_ptr(), state->original_stream);
+    }
+  }
+
+  setCurrentCUDAStream(state->original_stream);
+  scheduler_state.reset();
+}
+
+bool isStreamSchedulerEnabled() {
+  return scheduler_state != nullptr;
+}
+
+} // namespace at::cuda
@@ -0,0 +1,38 @@
+#pragma once
+
+#include <c10/macros/Export.h>
+
+#include <cstdint>
+
+namespace at::cuda {
+
+// See Note [Eager stream scheduler] in CUDAStreamScheduler.cpp.
+//
+// Enables a thread-local scheduler that spreads eager CUDA ops over a small
+// pool of streams, tracking which stream produced each tensor and making a
+// consumer stream wait on an event only when one of its inputs was produced
+// on a different stream. Independent chains of ops (e.g. parallel branches
+// of a model) overlap on the GPU without CUDA graph capture.
+TORCH_CUDA_CPP_API void enableStreamScheduler(int64_t num_streams = 4);
+
+// Disables the scheduler on this thread. The stream that was current when
+// the scheduler was enabled waits for every op launched under it, so work
+// queued afterwards observes all scheduled results.
+TORCH_CUDA_CPP_API void disableStreamScheduler();
+
+TORCH_CUDA_CPP_API bool isStreamSchedulerEnabled();
+
+// RAII form of enable/disableStreamScheduler.
+struct TORCH_CUDA_CPP_API CUDAStreamSchedulerGuard {
+  explicit CUDAStreamSchedulerGuard(int64_t num_streams = 4) {
+    enableStreamScheduler(num_streams);
+  }
+  CUDAStreamSchedulerGuard(const CUDAStreamSchedulerGuard&) = delete;
+  CUDAStreamSchedulerGuard& operator=(const CUDAStreamSchedulerGuard&) =
+      delete;
+  ~CUDAStreamSchedulerGuard() {
+    disableStreamScheduler();
+  }
+};
+
+} // namespace at::cuda
@@ -6,17 +6,22 @@
 #include <ATen/detail/CUDAHooksInterface.h>
 #include <c10/core/thread_pool.h>
 #include <c10/cuda/CUDAAllocatorConfig.h>
+#include <c10/util/numa.h>
 
 #include <cuda_runtime_api.h>
 #include <stdint.h>
+#include <cctype>
 #include <deque>
+#include <fstream>
 #include <future>
 #include <memory>
 #include <mutex>
 #include <set>
+#include <string>
 #include <unordered_map>
 #include <unordered_set>
 #include <utility>
+#include <vector>
 
 namespace at::cuda {
 namespace {
@@ -114,6 +119,72 @@ struct BlockComparator {
   }
 };
 
+/**
+ * Note [NUMA-aware pinned allocation]
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ * On multi-socket machines, host-to-device bandwidth depends on the pinned
+ * buffer landing on the NUMA node that owns the GPU's PCIe root complex.
+ * Pinned pages cannot be migrated after the fact (mbind with MPOL_MF_MOVE
+ * fails on locked pages), so placement has to happen before the pages are
+ * pinned: for cudaHostAlloc we install a preferred thread-local memory
+ * policy around the driver call, and for the cudaHostRegister path we set
+ * the policy on the freshly malloc'd (still untouched) range so the pages
+ * fault onto the right node regardless of which thread-pool thread touches
+ * them.
+ *
+ * The target node is the one reported by the kernel for the GPU's PCI
+ * device. This is all best effort: if NUMA support is disabled
+ * (caffe2_cpu_numa_enabled is off), the topology is unknown (sysfs reports
+ * -1), or there is no primary context to pick a device from, we fall back
+ * to the default first-touch placement.
+ */
+int pinned_numa_node_for_device(c10::optional<DeviceIndex> device_opt) {
+#if defined(__linux__)
+  if (!device_opt.has_value() || !c10::IsNUMAEnabled()) {
+    return -1;
+  }
+  const auto device = *device_opt;
+
+  static std::mutex cache_mutex;
+  static std::unordered_map<DeviceIndex, int> cache;
+  {
+    std::lock_guard<std::mutex> g(cache_mutex);
+    auto it = cache.find(device);
+    if (it != cache.end()) {
+      return it->second;
+    }
+  }
+
+  int numa_node = -1;
+  // Enough for the "domain:bus:device.function" form plus the terminator.
+  char pci_bus_id[16] = {};
+  if (cudaDeviceGetPCIBusId(pci_bus_id, sizeof(pci_bus_id), device) ==
+      cudaSuccess) {
+    for (char* c = pci_bus_id; *c != '\0'; ++c) {
+      *c = static_cast<char>(std::tolower(static_cast<unsigned char>(*c)));
+    }
+    std::ifstream f(
+        std::string("/sys/bus/pci/devices/") + pci_bus_id + "/numa_node");
+    if (!(f >> numa_node)) {
+      numa_node = -1;
+    }
+  } else {
+    (void)cudaGetLastError(); // clear CUDA error
+  }
+  if (numa_node >= c10::GetNumNUMANodes()) {
+    numa_node = -1;
+  }
+
+  {
+    std::lock_guard<std::mutex> g(cache_mutex);
+    cache.emplace(device, numa_node);
+  }
+  return numa_node;
+#else
+  return -1;
+#endif
+}
+
 /**
  * Note [CUDAHostAllocator design]
  * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
@@ -179,12 +250,21 @@ class CUDAHostAllocator {
     // Round up the allocation to the nearest power of two to improve reuse.
     size_t roundSize = c10::llvm::PowerOf2Ceil(size);
     void* ptr = nullptr;
+    // Place the pinned pages on the NUMA node closest to the GPU; see
+    // Note [NUMA-aware pinned allocation].
+    const int numa_node = pinned_numa_node_for_device(primary_ctx_device_index);
     if (c10::cuda::CUDACachingAllocator::CUDAAllocatorConfig::
             pinned_use_cuda_host_register()) {
-      allocWithCudaHostRegister(&ptr, roundSize);
+      allocWithCudaHostRegister(&ptr, roundSize, numa_node);
     } else {
       // Use cudaHostAlloc for allocating pinned memory (global lock in driver)
+      if (numa_node >= 0) {
+        c10::NUMABindMemory(numa_node);
+      }
       C10_CUDA_CHECK(cudaHostAlloc(&ptr, roundSize, cudaHostAllocDefault));
+      if (numa_node >= 0) {
+        c10::NUMABindMemory(-1);
+      }
     }
 
     auto block = new Block();
@@ -402,12 +482,22 @@ class CUDAHostAllocator {
         "");
   }
 
-  inline void allocWithCudaHostRegister(void** ptr, size_t roundSize) {
+  inline void allocWithCudaHostRegister(
+      void** ptr,
+      size_t roundSize,
+      int numa_node) {
     // Here we do regular allocation, pre-fault/map the pages, and then do
     // cudaHostRegister with GPU mapping flags to lock the pages, so we
     // can minimize the cost for the cuda global lock.
     *ptr = malloc(roundSize);
 
+    // Bind the still-untouched range to the GPU's NUMA node so the pages
+    // fault onto it no matter which thread below touches them; see
+    // Note [NUMA-aware pinned allocation].
+    if (numa_node >= 0) {
+      c10::NUMAMove(*ptr, roundSize, numa_node);
+    }
+
     // Parallelize the mapping/registering of pages to reduce wall time
     size_t pageSize = (1 << 12); // 4kB pages
     size_t numMapThreads = c10::cuda::CUDACachingAllocator::
@@ -487,6 +577,25 @@ void CachingHostAllocator_emptyCache() {
   getCUDAHostAllocator().empty_cache();
 }
 
+void CachingHostAllocator_preWarm(size_t bytes, size_t block_bytes) {
+  TORCH_CHECK(
+      block_bytes > 0,
+      "CachingHostAllocator_preWarm: block_bytes must be positive");
+  const size_t rounded = c10::llvm::PowerOf2Ceil(block_bytes);
+  // Hold on to every block until the target size is reached so each
+  // allocation is forced to create a fresh block rather than recycle one we
+  // just warmed up; freeing with no streams recorded then parks them all on
+  // the free list.
+  std::vector<void*> ctxs;
+  ctxs.reserve(bytes / rounded + 1);
+  for (size_t warmed = 0; warmed < bytes; warmed += rounded) {
+    ctxs.push_back(getCUDAHostAllocator().allocate(block_bytes).second);
+  }
+  for (auto* ctx : ctxs) {
+    getCUDAHostAllocator().free(ctx);
+  }
+}
+
 struct CUDAHostAllocatorWrapper final : public at::Allocator {
   at::DataPtr allocate(size_t size) const override {
     auto ptr_and_ctx = getCUDAHostAllocator().allocate(size);
@@ -30,6 +30,17 @@ CachingHostAllocator_recordEvent(void* ptr, void* ctx, c10::cuda::CUDAStream str
 // Releases cached pinned memory allocations via cudaHostFree
 TORCH_CUDA_CPP_API void CachingHostAllocator_emptyCache();
 
+// Grows the cache of free pinned memory blocks to at least `bytes` bytes,
+// in blocks of `block_bytes` each (rounded up to the next power of two,
+// matching the allocator's own rounding). Calling this at startup with the
+// expected working set (e.g. a few batches' worth of DataLoader staging
+// buffers) moves the pinning cost out of the first iterations. The blocks
+// are placed on the free list and reused by subsequent allocations; they
+// are released by CachingHostAllocator_emptyCache like any other block.
+TORCH_CUDA_CPP_API void CachingHostAllocator_preWarm(
+    size_t bytes,
+    size_t block_bytes);
+
 inline TORCH_CUDA_CPP_API at::DataPtr HostAlloc(size_t size) {
   return getCachingHostAllocator()->allocate(size);
 }
@@ -0,0 +1,101 @@
+#include <ATen/cuda/CheckpointSnapshot.h>
+
+#include <ATen/cuda/CUDAContext.h>
+#include <c10/core/StreamGuard.h>
+#include <c10/cuda/CUDACachingAllocator.h>
+#include <c10/cuda/CUDAGuard.h>
+#include <c10/util/irange.h>
+
+#ifndef AT_PER_OPERATOR_HEADERS
+#include <ATen/Functions.h>
+#else
+#include <ATen/ops/empty.h>
+#endif
+
+#include <map>
+
+namespace at::cuda {
+
+bool CheckpointSnapshot::ready() const {
+  for (const auto& event : done_events_) {
+    if (!event.query()) {
+      return false;
+    }
+  }
+  return true;
+}
+
+void CheckpointSnapshot::synchronize() const {
+  for (const auto& event : done_events_) {
+    event.synchronize();
+  }
+}
+
+const std::vector<at::Tensor>& CheckpointSnapshot::host_tensors() const {
+  synchronize();
+  return host_tensors_;
+}
+
+CheckpointSnapshot snapshot_tensors_async(
+    at::TensorList tensors,
+    bool order_after_snapshot) {
+  CheckpointSnapshot snapshot;
+  snapshot.host_tensors_.resize(tensors.size());
+
+  // Group by device so each device pays for one pair of ordering events no
+  // matter how many tensors live on it.
+  std::map<c10::DeviceIndex, std::vector<size_t>> by_device;
+  for (const auto i : c10::irange(tensors.size())) {
+    const auto& t = tensors[i];
+    TORCH_CHECK(
+        t.is_cuda(),
+        "snapshot_tensors_async expects CUDA tensors, but got a tensor on ",
+        t.device());
+    by_device[t.get_device()].push_back(i);
+  }
+
+  for (const auto& entry : by_device) {
+    const auto device = entry.first;
+    CUDAGuard device_guard(device);
+    auto current_stream = getCurrentCUDAStream(device);
+    auto side_stream = getStreamFromPool(/*isHighPriority=*/false, device);
+
+    // The side stream must observe every write to the sources issued on the
+    // current stream before this call.
+    CUDAEvent pending_writes;
+    pending_writes.record(current_stream);
+    pending_writes.block(side_stream);
+
+    {
+      c10::cuda::CUDAStreamGuard stream_guard(side_stream);
+      for (const auto i : entry.second) {
+        const auto& src = tensors[i];
+        // Pinned staging buffer from the caching host allocator; copy_ with
+        // non_blocking=true records the host-allocator event that keeps the
+        // block from being recycled while the transfer is in flight.
+        auto host = at::empty(
+            src.sizes(),
+            src.options().device(at::kCPU).pinned_memory(true));
+        host.copy_(src, /*non_blocking=*/true);
+        // Keep the source's device memory out of reuse until the side
+        // stream's copy has completed, even if the caller drops the tensor.
+        c10::cuda::CUDACachingAllocator::recordStream(
+            src.storage().data_ptr(), side_stream);
+        snapshot.host_tensors_[i] = std::move(host);
+      }
+    }
+
+    CUDAEvent done;
+    done.record(side_stream);
+    if (order_after_snapshot) {
+      // Order later work on the current stream (e.g. the optimizer step)
+      // after the copies, with no host-side synchronization.
+      done.block(current_stream);
+    }
+    snapshot.done_events_.push_back(std::move(done));
+  }
+
+  return snapshot;
+}
+
+} // namespace at::cuda
@@ -0,0 +1,55 @@
+#pragma once
+
+#include <ATen/core/Tensor.h>
+#include <ATen/cuda/CUDAEvent.h>
+
+#include <vector>
+
+namespace at::cuda {
+
+// An in-flight asynchronous snapshot of device tensors into pinned host
+// memory, produced by snapshot_tensors_async() below. The host clones can be
+// handed to torch.save (or any serializer) once ready() reports true, letting
+// checkpoint I/O stream from host memory while training proceeds on the GPU.
+class TORCH_CUDA_CPP_API CheckpointSnapshot {
+ public:
+  CheckpointSnapshot() = default;
+  CheckpointSnapshot(CheckpointSnapshot&&) = default;
+  CheckpointSnapshot& operator=(CheckpointSnapshot&&) = default;
+
+  // True once all device-to-host copies have completed. Never blocks.
+  bool ready() const;
+
+  // Blocks the calling thread until all copies have completed.
+  void synchronize() const;
+
+  // Pinned host clones of the snapshotted tensors, in input order.
+  // Synchronizes first, so the contents are safe to read.
+  const std::vector<at::Tensor>& host_tensors() const;
+
+ private:
+  friend CheckpointSnapshot snapshot_tensors_async(
+      at::TensorList tensors,
+      bool order_after_snapshot);
+
+  std::vector<at::Tensor> host_tensors_;
+  // One completion event per source device involved in the snapshot.
+  std::vector<CUDAEvent> done_events_;
+};
+
+// Clones `tensors` (all CUDA) into freshly allocated pinned host buffers from
+// the caching host allocator. The copies run on a side stream per device that
+// first waits on that device's current stream, so each clone observes every
+// write issued before this call; the calling thread never blocks.
+//
+// When order_after_snapshot is true (the default), the current stream of each
+// involved device is made to wait on the snapshot's completion event, so
+// later kernels on it (e.g. the optimizer step mutating the parameters) are
+// ordered after the copies without any host synchronization. Pass false only
+// if the caller guarantees the sources are not mutated while the snapshot is
+// in flight.
+TORCH_CUDA_CPP_API CheckpointSnapshot snapshot_tensors_async(
+    at::TensorList tensors,
+    bool order_after_snapshot = true);
+
+} // namespace at::cuda
@@ -0,0 +1,79 @@
+#include <ATen/cuda/OptimizerStepGraph.h>
+
+#include <c10/cuda/CUDAFunctions.h>
+#include <c10/cuda/CUDAGuard.h>
+#include <c10/cuda/CUDAStream.h>
+
+namespace at::cuda {
+
+OptimizerStepGraph::OptimizerStepGraph() : pool_(graph_pool_handle()) {}
+
+OptimizerStepGraph::~OptimizerStepGraph() = default;
+
+OptimizerStepGraph::StateKey OptimizerStepGraph::key_of(TensorList state) {
+  StateKey key;
+  for (const auto& t : state) {
+    key.push_back(static_cast<int64_t>(t.scalar_type()));
+    key.push_back(t.is_cuda() ? t.get_device() : -1);
+    key.push_back(t.dim());
+    for (auto s : t.sizes()) {
+      key.push_back(s);
+    }
+    for (auto s : t.strides()) {
+      key.push_back(s);
+    }
+    key.push_back(reinterpret_cast<int64_t>(t.const_data_ptr()));
+  }
+  return key;
+}
+
+bool OptimizerStepGraph::step(
+    TensorList state,
+    const std::function<void()>& step_fn) {
+  std::lock_guard<std::mutex> g(mutex_);
+  auto key = key_of(state);
+  if (graph_ && key == key_) {
+    graph_->replay();
+    return true;
+  }
+  // Signature changed (or first call): drop the stale graph and re-capture.
+  graph_.reset();
+  key_ = std::move(key);
+
+  // capture_begin requires a non-default current stream, and no other work
+  // may be outstanding on the capture stream, so quiesce the device and
+  // capture on a side stream. cudaStreamCaptureModeThreadLocal keeps other
+  // threads' CUDA calls legal during the capture.
+  c10::cuda::device_synchronize();
+  auto capture_stream = c10::cuda::getStreamFromPool();
+  {
+    c10::cuda::CUDAStreamGuard stream_guard(capture_stream);
+    graph_ = std::make_unique<CUDAGraph>();
+    graph_->capture_begin(pool_, cudaStreamCaptureModeThreadLocal);
+    try {
+      step_fn();
+    } catch (...) {
+      graph_->capture_end();
+      graph_.reset();
+      throw;
+    }
+    graph_->capture_end();
+  }
+  // Capture records the step without executing it; replay once so this call
+  // performs the optimizer update like every other.
+  graph_->replay();
+  return false;
+}
+
+bool OptimizerStepGraph::captured() const {
+  std::lock_guard<std::mutex> g(mutex_);
+  return graph_ != nullptr;
+}
+
+void OptimizerStepGraph::reset() {
+  std::lock_guard<std::mutex> g(mutex_);
+  graph_.reset();
+  key_.clear();
+}
+
+} // namespace at::cuda
@@ -0,0 +1,74 @@
+#pragma once
+
+#include <ATen/core/Tensor.h>
+#include <ATen/cuda/CUDAGraph.h>
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace at::cuda {
+
+// Captures one optimizer step as a CUDA graph and replays it on every
+// subsequent call, collapsing the per-parameter launch overhead of the
+// foreach op family (_foreach_add_, _foreach_mul_, _foreach_addcdiv_, ...)
+// into a single graph launch. Built for steps whose tensors are stable:
+// params, grads and optimizer state (exp_avg, exp_avg_sq, momentum buffers)
+// are preallocated once and updated in place, which is exactly the shape of
+// torch.optim's fused/foreach paths.
+//
+// Usage, per training iteration:
+//
+//   step_graph.step(state_tensors, [&] { run_foreach_optimizer_step(); });
+//
+// `state_tensors` must list every tensor the closure reads or writes. On the
+// first call the closure is captured into a graph (and executed, via an
+// immediate replay); afterwards step() only replays. If any state tensor
+// changes dtype, geometry or storage pointer — a new parameter group, a
+// re-allocated grad, dynamic shapes — the stale graph is dropped and the
+// next call re-captures. All methods are thread-safe; captures on one
+// OptimizerStepGraph are serialized.
+class TORCH_CUDA_CPP_API OptimizerStepGraph {
+ public:
+  OptimizerStepGraph();
+  ~OptimizerStepGraph();
+
+  OptimizerStepGraph(const OptimizerStepGraph&) = delete;
+  OptimizerStepGraph& operator=(const OptimizerStepGraph&) = delete;
+
+  // Replays the captured step if `state` still matches the signature it was
+  // captured with; otherwise (re-)captures `step_fn` and runs it once.
+  // Returns true if this call replayed a previously captured graph, false if
+  // it had to (re-)capture.
+  bool step(TensorList state, const std::function<void()>& step_fn);
+
+  // True if the next matching step() call will replay rather than capture.
+  bool captured() const;
+
+  // Drops the captured graph; the next step() call re-captures. Call this
+  // after mutating the step in a way the signature cannot see (changed
+  // hyperparameters baked into the capture, a different op sequence).
+  void reset();
+
+  // id of the private memory pool the captured graph draws from
+  MempoolId_t pool() const {
+    return pool_;
+  }
+
+ private:
+  // Flattened (dtype, device, ndim, sizes, strides, data_ptr) of every state
+  // tensor. Unlike CUDAGraphCache's key, the storage pointer participates:
+  // the graph bakes addresses in, so a re-allocated tensor of the same shape
+  // must also force a re-capture.
+  using StateKey = std::vector<int64_t>;
+  static StateKey key_of(TensorList state);
+
+  mutable std::mutex mutex_;
+  MempoolId_t pool_;
+  std::unique_ptr<CUDAGraph> graph_;
+  StateKey key_;
+};
+
+} // namespace at::cuda
@@ -301,13 +301,14 @@ Tensor unwrapIfDead(const Tensor& tensor) {
 }
 
 void foreachTensorInplace(std::vector<IValue>& args, int64_t begin, int64_t end,
-    std::function<Tensor(const Tensor&)> func) {
+    const std::function<Tensor(const Tensor&)>& func) {
    auto func_with_bool = [&](const Tensor& tensor, bool unused) { return func(tensor); };
    foreachTensorInplaceWithFlag(args, begin, end, std::bitset<64>(), func_with_bool);
 }
 
 void foreachTensorInplaceWithFlag(std::vector<IValue>& args, int64_t begin, int64_t end,
-    const std::bitset<64> use_flag_relative, std::function<Tensor(const Tensor&, bool)> func){
+    const std::bitset<64> use_flag_relative,
+    const std::function<Tensor(const Tensor&, bool)>& func){
   TORCH_INTERNAL_ASSERT(begin >= 0);
   TORCH_INTERNAL_ASSERT(end >= 0);
   TORCH_INTERNAL_ASSERT(begin <= end);
@@ -315,7 +316,10 @@ void foreachTensorInplaceWithFlag(std::vector<IValue>& args, int64_t begin, int6
     const bool flag = use_flag_relative[relative_idx] == 1;
 
     const auto idx = relative_idx + begin;
-    auto ivalue = args[idx];
+    // NB: args[idx] is only reassigned after we are done inspecting it, so
+    // holding a reference (rather than refcount-bumping a copy per argument)
+    // is safe.
+    const auto& ivalue = args[idx];
     // Tensor?[] translates to a c10::List<IValue> so we need to peek inside List
     if (ivalue.isList()) {
       bool modified = false;
@@ -339,16 +343,18 @@ void foreachTensorInplaceWithFlag(std::vector<IValue>& args, int64_t begin, int6
         list[list_idx] = func(list[list_idx], flag);
       }
       args[idx] = list;
+      continue;
     }
     TORCH_INTERNAL_ASSERT(!ivalue.isGenericDict(), "No operators can accept GenericDict");
     if (!ivalue.isTensor()) {
       continue;
     }
     Tensor value = ivalue.toTensor();
+    const bool was_defined = value.defined();
     Tensor replacement = func(value, flag);
     args[idx] = std::move(replacement);
     // sanity checks
-    if (ivalue.toTensor().defined()) {
+    if (was_defined) {
       TORCH_INTERNAL_ASSERT(args[idx].toTensor().defined());
     }
   }
@@ -50,13 +50,40 @@ static DispatchKeySet keysForEnteringDynamicLayer(TransformType key) {
   }
 }
 
-DispatchKeySet keysToExcludeWhenEnteringDynamicLayer(TransformType key) {
+static DispatchKeySet computeKeysToExcludeWhenEnteringDynamicLayer(TransformType key) {
   DispatchKeySet exclude = all_dynlayer_keyset;
   exclude = exclude.remove(DispatchKey::FuncTorchDynamicLayerBackMode);
   exclude = exclude - keysForEnteringDynamicLayer(key);
   return exclude;
 }
 
+DispatchKeySet keysToExcludeWhenEnteringDynamicLayer(TransformType key) {
+  // This is a pure function of the transform type and sits on the hot path of
+  // every op dispatched under a functorch transform (via
+  // setup_dispatch_key_tls), so memoize the handful of possible results
+  // instead of rebuilding the keyset per op.
+  static const DispatchKeySet vmap_keyset =
+      computeKeysToExcludeWhenEnteringDynamicLayer(TransformType::Vmap);
+  static const DispatchKeySet grad_keyset =
+      computeKeysToExcludeWhenEnteringDynamicLayer(TransformType::Grad);
+  static const DispatchKeySet jvp_keyset =
+      computeKeysToExcludeWhenEnteringDynamicLayer(TransformType::Jvp);
+  static const DispatchKeySet functionalize_keyset =
+      computeKeysToExcludeWhenEnteringDynamicLayer(TransformType::Functionalize);
+  switch (key) {
+    case TransformType::Vmap:
+      return vmap_keyset;
+    case TransformType::Grad:
+      return grad_keyset;
+    case TransformType::Jvp:
+      return jvp_keyset;
+    case TransformType::Functionalize:
+      return functionalize_keyset;
+    default:
+      TORCH_INTERNAL_ASSERT(false, "Unsupported key: ", key);
+  }
+}
+
 void setup_dispatch_key_tls(TransformType key, DispatchKeySet also_include) {
   auto local_keyset = c10::impl::tls_local_dispatch_key_set();
   auto to_exclude = local_keyset.excluded_;
@@ -14,12 +14,14 @@ typedef id<MTLDevice> MTLDevice_t;
 typedef id<MTLLibrary> MTLLibrary_t;
 typedef id<MTLComputePipelineState> MTLComputePipelineState_t;
 typedef id<MTLLibrary> MTLLibrary_t;
+typedef id<MTLBinaryArchive> MTLBinaryArchive_t;
 #else
 typedef void* MTLDevice;
 typedef void* MTLDevice_t;
 typedef void* MTLLibrary_t;
 typedef void* MTLComputePipelineState_t;
 typedef void* MTLLibrary_t;
+typedef void* MTLBinaryArchive_t;
 #endif
 
 using namespace std;
@@ -74,7 +76,11 @@ class TORCH_API MPSDevice {
   static MPSDevice* _device;
   MTLDevice_t _mtl_device;
   MTLLibrary_t _mtl_indexing_library;
+  // on-disk cache of compiled pipeline states (see PYTORCH_MPS_KERNEL_CACHE_PATH)
+  MTLBinaryArchive_t _mtl_kernel_archive;
   MPSDevice();
+
+  MTLBinaryArchive_t getKernelCacheArchive();
 };
 
 TORCH_API bool is_available();
@@ -47,6 +47,49 @@ id<MTLLibrary> MPSDevice::getMetalIndexingLibrary() {
   return _mtl_indexing_library;
 }
 
+// Note [MPS kernel cache persistence]
+// Compiling Metal kernels from source costs a noticeable amount of time on
+// every process launch. When PYTORCH_MPS_KERNEL_CACHE_PATH points to a
+// writable file, we back the compiled pipeline states with an MTLBinaryArchive
+// stored at that path, so subsequent launches load the precompiled binaries
+// instead of recompiling from source. Note that MPSGraph executables cannot be
+// persisted the same way: the serialization APIs for MPSGraphExecutable are
+// only available in OS versions newer than the ones this backend targets, so
+// graph reuse across ops remains handled in-process by MPSGraphCache.
+// Any failure to load or store the archive falls back to source compilation.
+static NSURL* getKernelCacheURL() {
+  static const char* cache_path_str = getenv("PYTORCH_MPS_KERNEL_CACHE_PATH");
+  if (!cache_path_str) {
+    return nil;
+  }
+  return [NSURL fileURLWithPath:[NSString stringWithUTF8String:cache_path_str]];
+}
+
+id<MTLBinaryArchive> MPSDevice::getKernelCacheArchive() {
+  if (_mtl_kernel_archive) {
+    return _mtl_kernel_archive;
+  }
+  NSURL* cacheURL = getKernelCacheURL();
+  if (!cacheURL) {
+    return nil;
+  }
+  NSError* error = nil;
+  MTLBinaryArchiveDescriptor* archiveDescriptor = [[MTLBinaryArchiveDescriptor new] autorelease];
+  // only point the descriptor at the file if a previous run serialized one there
+  archiveDescriptor.url = [[NSFileManager defaultManager] fileExistsAtPath:cacheURL.path] ? cacheURL : nil;
+  _mtl_kernel_archive = [_mtl_device newBinaryArchiveWithDescriptor:archiveDescriptor error:&error];
+  if (!_mtl_kernel_archive && error) {
+    // a stale or corrupt archive shouldn't break kernel compilation; start over without one
+    TORCH_WARN("Failed to load MPS kernel cache from ",
+               [cacheURL.path UTF8String],
+               ", error: ",
+               [[error description] UTF8String]);
+    archiveDescriptor.url = nil;
+    _mtl_kernel_archive = [_mtl_device newBinaryArchiveWithDescriptor:archiveDescriptor error:&error];
+  }
+  return _mtl_kernel_archive;
+}
+
 id<MTLComputePipelineState> MPSDevice::metalIndexingPSO(const std::string& kernel) {
   TORCH_INTERNAL_ASSERT_DEBUG_ONLY(_mtl_device);
   NSError* error = nil;
@@ -65,8 +108,28 @@ id<MTLComputePipelineState> MPSDevice::metalIndexingPSO(const std::string& kerne
               ", error: ",
               [[error description] UTF8String]);
 
-  state = [_mtl_device newComputePipelineStateWithFunction:indexFunction error:&error];
-  TORCH_CHECK(state, error.localizedDescription.UTF8String);
+  id<MTLBinaryArchive> archive = getKernelCacheArchive();
+  if (archive) {
+    // See Note [MPS kernel cache persistence]. With the archive listed in the
+    // descriptor, Metal loads the precompiled binary if present and falls back
+    // to compiling from source otherwise.
+    MTLComputePipelineDescriptor* pipelineDescriptor = [[MTLComputePipelineDescriptor new] autorelease];
+    pipelineDescriptor.computeFunction = indexFunction;
+    pipelineDescriptor.binaryArchives = @[ archive ];
+    state = [_mtl_device newComputePipelineStateWithDescriptor:pipelineDescriptor
+                                                       options:MTLPipelineOptionNone
+                                                    reflection:nil
+                                                         error:&error];
+    TORCH_CHECK(state, error.localizedDescription.UTF8String);
+    // harvest the compiled binary into the archive so future launches skip compilation
+    if (![archive addComputePipelineFunctionsWithDescriptor:pipelineDescriptor error:&error] ||
+        ![archive serializeToURL:getKernelCacheURL() error:&error]) {
+      TORCH_WARN_ONCE("Failed to update MPS kernel cache, error: ", [[error description] UTF8String]);
+    }
+  } else {
+    state = [_mtl_device newComputePipelineStateWithFunction:indexFunction error:&error];
+    TORCH_CHECK(state, error.localizedDescription.UTF8String);
+  }
   psoCache[kernel] = state;
   return state;
 }
@@ -74,11 +137,13 @@ id<MTLComputePipelineState> MPSDevice::metalIndexingPSO(const std::string& kerne
 MPSDevice::~MPSDevice() {
   [_mtl_device release];
   [_mtl_indexing_library release];
+  [_mtl_kernel_archive release];
   _mtl_device = nil;
   _mtl_indexing_library = nil;
+  _mtl_kernel_archive = nil;
 }
 
-MPSDevice::MPSDevice() : _mtl_device(nil), _mtl_indexing_library(nil) {
+MPSDevice::MPSDevice() : _mtl_device(nil), _mtl_indexing_library(nil), _mtl_kernel_archive(nil) {
   // Check that MacOS 12.3+ version of MPS framework is available
   // Create the MPSGraph and check method introduced in 12.3+
   // which is used by MPS backend.
@@ -95,6 +95,10 @@ private:
   dispatch_queue_t _serialQueue = nullptr;
   // CommitAndContinue is enabled by default
   bool _enableCommitAndContinue = true;
+  // number of encodes to accumulate per commit (see PYTORCH_MPS_COMMIT_BATCH_SIZE)
+  uint32_t _commitBatchSize = 1;
+  // encodes accumulated on the command buffer since the last commit
+  uint32_t _pendingEncodes = 0;
 
   // use synchronize() to access any of these commit functions outside MPSStream
   void commit();
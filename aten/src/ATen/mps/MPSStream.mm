@@ -30,6 +30,16 @@ MPSStream::MPSStream(Stream stream) : _stream(stream) {
   // Choose level which optimizes for GPU
   _compilationDescriptor.optimizationLevel = MPSGraphOptimizationLevel0;
   _executionDescriptor.compilationDescriptor = _compilationDescriptor;
+
+  // batched commit mode: accumulate this many encodes on the command buffer
+  // before actually committing it, to amortize the commit overhead of
+  // workloads dominated by small ops (see synchronize()).
+  static const char* commit_batch_size_str = getenv("PYTORCH_MPS_COMMIT_BATCH_SIZE");
+  if (commit_batch_size_str) {
+    const long batchSize = strtol(commit_batch_size_str, nullptr, 0);
+    TORCH_CHECK(batchSize >= 1, "invalid commit batch size: ", commit_batch_size_str);
+    _commitBatchSize = static_cast<uint32_t>(batchSize);
+  }
 }
 
 MPSStream::~MPSStream() {
@@ -66,6 +76,13 @@ void MPSStream::synchronize(SyncType syncType) {
       // typically in GPU to GPU copies we won't commit explicitly
       break;
     case SyncType::COMMIT:
+      // in batched commit mode, defer the commit until enough encodes have
+      // accumulated, unless we're at the low watermark memory threshold where
+      // holding back committed work could fail allocations.
+      if (_commitBatchSize > 1 && ++_pendingEncodes < _commitBatchSize &&
+          getIMPSAllocator()->getLowWatermarkValue() > 1) {
+        break;
+      }
       commit();
       break;
     case SyncType::COMMIT_ADAPTIVE:
@@ -86,6 +103,7 @@ void MPSStream::synchronize(SyncType syncType) {
 }
 
 void MPSStream::commit() {
+  _pendingEncodes = 0;
   if (_enableCommitAndContinue) {
     [commandBuffer() commitAndContinue];
   } else {
@@ -94,6 +112,7 @@ void MPSStream::commit() {
 }
 
 void MPSStream::commitAndWait() {
+  _pendingEncodes = 0;
   if (_prevCommandBuffer) {
     // the previous command buffer (if exists) has already been committed,
     // so we just wait until it's completed and then dispose it.
@@ -112,6 +131,7 @@ void MPSStream::commitAndWait() {
 
 void MPSStream::commitAndContinue() {
   assert(_commandBuffer);
+  _pendingEncodes = 0;
   [_commandBuffer commitAndContinue];
 }
 
@@ -1,11 +1,7 @@
 #define TORCH_ASSERT_ONLY_METHOD_OPERATORS
 #include <ATen/core/Tensor.h>
-#include <ATen/Dispatch.h>
 #include <ATen/ScalarOps.h>
-#include <ATen/Parallel.h>
 #include <ATen/native/Pool.h>
-#include <c10/util/irange.h>
-#include <tuple>
 
 #ifndef AT_PER_OPERATOR_HEADERS
 #include <ATen/Functions.h>
@@ -50,8 +46,16 @@ TORCH_META_FUNC(avg_pool3d) (
   const int padH = padding.size() == 1 ? padT : safe_downcast<int, int64_t>(padding[1]);
   const int padW = padding.size() == 1 ? padT : safe_downcast<int, int64_t>(padding[2]);
 
-  TORCH_CHECK((input.ndimension() == 4 || input.ndimension() == 5),
-    "non-empty 4D or 5D (batch mode) tensor expected for input");
+  const auto memory_format = input.suggest_memory_format();
+  if (memory_format == at::MemoryFormat::ChannelsLast3d) {
+    TORCH_CHECK(input.ndimension() == 5,
+      "non-empty 5D (batch mode) tensor expected for input with channels_last_3d layout");
+  } else if (memory_format == at::MemoryFormat::Contiguous) {
+    TORCH_CHECK((input.ndimension() == 4 || input.ndimension() == 5),
+      "non-empty 4D or 5D (batch mode) tensor expected for input");
+  } else {
+    TORCH_CHECK(false, "Unsupport memory format. Supports only ChannelsLast3d, Contiguous");
+  }
 
   TORCH_CHECK(!divisor_override.has_value() || divisor_override.value() != 0,
     "divisor must be not zero");
@@ -84,7 +88,8 @@ TORCH_META_FUNC(avg_pool3d) (
     set_output_raw_strided(0, {nslices, otime, oheight, owidth}, {}, input.options());
   }
   else {
-    set_output_raw_strided(0, {nbatch, nslices, otime, oheight, owidth}, {}, input.options());
+    set_output_raw_strided(0, {nbatch, nslices, otime, oheight, owidth}, {},
+      input.options().memory_format(memory_format));
   }
 }
 
@@ -119,8 +124,16 @@ TORCH_META_FUNC(avg_pool3d_backward) (
   const int padH = padding.size() == 1 ? padT : safe_downcast<int, int64_t>(padding[1]);
   const int padW = padding.size() == 1 ? padT : safe_downcast<int, int64_t>(padding[2]);
 
-  TORCH_CHECK((input.ndimension() == 4 || input.ndimension() == 5),
-    "non-empty 4D or 5D (batch mode) tensor expected for input");
+  const auto memory_format = input.suggest_memory_format();
+  if (memory_format == at::MemoryFormat::ChannelsLast3d) {
+    TORCH_CHECK(input.ndimension() == 5,
+      "non-empty 5D (batch mode) tensor expected for input with channels_last_3d layout");
+  } else if (memory_format == at::MemoryFormat::Contiguous) {
+    TORCH_CHECK((input.ndimension() == 4 || input.ndimension() == 5),
+      "non-empty 4D or 5D (batch mode) tensor expected for input");
+  } else {
+    TORCH_CHECK(false, "Unsupport memory format. Supports only ChannelsLast3d, Contiguous");
+  }
 
   TORCH_CHECK(!divisor_override.has_value() || divisor_override.value() != 0, "divisor must be not zero");
 
@@ -146,116 +159,13 @@ TORCH_META_FUNC(avg_pool3d_backward) (
     "avg_pool3d_backward()");
 
   /* resize output */
-  set_output_raw_strided(0, input.sizes(), {}, input.options());
+  set_output_raw_strided(0, input.sizes(), {}, input.options().memory_format(memory_format));
 }
 
 } // namespace meta
 
 namespace native {
 
-namespace {
-
-template <typename scalar_t>
-static void avg_pool3d_out_frame(
-          scalar_t *input_p,
-          scalar_t *output_p,
-          int64_t nslices,
-          int64_t itime,
-          int64_t iwidth,
-          int64_t iheight,
-          int64_t otime,
-          int64_t owidth,
-          int64_t oheight,
-          int kT,
-          int kW,
-          int kH,
-          int dT,
-          int dW,
-          int dH,
-          int padT,
-          int padW,
-          int padH,
-          bool count_include_pad,
-          c10::optional<int64_t> divisor_override)
-{
-  at::parallel_for(0, nslices, 0, [&](int64_t start, int64_t end) {
-    for (const auto k : c10::irange(start, end)) {
-      // NOLINTNEXTLINE(cppcoreguidelines-init-variables)
-      int64_t i, j, ti;
-
-      /* local pointers. */
-      scalar_t *ip = input_p + k * itime * iwidth * iheight;
-      scalar_t *op = output_p + k * otime * owidth * oheight;
-      for (i = 0; i < otime * oheight * owidth; ++i)
-        *(op + i) = 0;
-
-      /* loop over output */
-      for (ti = 0; ti < otime; ti++)
-      {
-        for (i = 0; i < oheight; i++)
-        {
-          for (j = 0; j < owidth; j++)
-          {
-            /* compute pool range. */
-            int64_t tstart = ti * dT - padT;
-            int64_t hstart = i  * dH - padH;
-            int64_t wstart = j  * dW - padW;
-            int64_t tend = std::min(tstart + kT, itime + padT);
-            int64_t hend = std::min(hstart + kH, iheight + padH);
-            int64_t wend = std::min(wstart + kW, iwidth + padW);
-            int64_t pool_size = (tend - tstart) * (hend - hstart) * (wend - wstart);
-            tstart = std::max(tstart, (int64_t) 0);
-            hstart = std::max(hstart, (int64_t) 0);
-            wstart = std::max(wstart, (int64_t) 0);
-            tend = std::min(tend, itime);
-            hend = std::min(hend, iheight);
-            wend = std::min(wend, iwidth);
-
-            if (tstart >= tend || hstart >= hend || wstart >= wend) {
-              ++op;
-              continue;
-            }
-
-            // NOLINTNEXTLINE(cppcoreguidelines-init-variables)
-            int divide_factor;
-            if (divisor_override.has_value()) {
-              divide_factor = divisor_override.value();
-            } else {
-              if(count_include_pad) {
-                divide_factor = pool_size;
-              } else {
-                // NOLINTNEXTLINE(cppcoreguidelines-narrowing-conversions,bugprone-narrowing-conversions)
-                divide_factor = (tend - tstart) * (hend - hstart) * (wend - wstart);
-              }
-            }
-
-            /* compute local sum: */
-            scalar_t sum = 0.0;
-            // NOLINTNEXTLINE(cppcoreguidelines-init-variables)
-            int64_t x, y, z;
-
-            for (z = tstart; z < tend; z++)
-            {
-              for (y = hstart; y < hend; y++)
-              {
-                for (x = wstart; x < wend; x++)
-                {
-                  sum +=  *(ip + z * iwidth * iheight + y * iwidth + x);
-                }
-              }
-            }
-
-            /* set output to local max */
-            *op++ += sum / divide_factor;
-          }
-        }
-      }
-    }
-  });
-}
-
-} // anonymous namespace
-
 TORCH_IMPL_FUNC(avg_pool3d_out_cpu) (
   const Tensor& input_,
   IntArrayRef kernel_size,
@@ -280,161 +190,14 @@ TORCH_IMPL_FUNC(avg_pool3d_out_cpu) (
   const int padH = padding.size() == 1 ? padT : safe_downcast<int, int64_t>(padding[1]);
   const int padW = padding.size() == 1 ? padT : safe_downcast<int, int64_t>(padding[2]);
 
-  const int64_t nslices = input_.size(-4);
-  const int64_t itime = input_.size(-3);
-  const int64_t iheight = input_.size(-2);
-  const int64_t iwidth = input_.size(-1);
-
-  const int64_t otime = pooling_output_shape<int64_t>(itime, kT, padT, dT, 1, ceil_mode);
-  const int64_t oheight = pooling_output_shape<int64_t>(iheight, kH, padH, dH, 1, ceil_mode);
-  const int64_t owidth = pooling_output_shape<int64_t>(iwidth, kW, padW, dW, 1, ceil_mode);
-
-  /* get contiguous input */
-  Tensor input = input_.contiguous();
-
-  if (input.ndimension() == 4) /* non-batch mode */
-  {
-    AT_DISPATCH_FLOATING_TYPES_AND(at::ScalarType::Long, input.scalar_type(),
-      "avg_pool3d_out_frame",
-      [&] {
-        scalar_t *input_data = input.data_ptr<scalar_t>();
-        scalar_t *output_data = output.data_ptr<scalar_t>();
-
-        avg_pool3d_out_frame(
-          input_data, output_data, nslices,
-          itime, iwidth, iheight,
-          otime, owidth, oheight,
-          kT, kW, kH,
-          dT, dW, dH,
-          padT, padW, padH,
-          count_include_pad,
-          divisor_override);
-    });
-  }
-  else  /* batch mode */
-  {
-    const int64_t nbatch = input.size(0);
-    const int64_t istride = nslices * itime * iwidth * iheight;
-    const int64_t ostride = nslices * otime * owidth * oheight;
-
-    AT_DISPATCH_FLOATING_TYPES_AND(at::ScalarType::Long, input.scalar_type(),
-      "avg_pool3d_out_frame",
-      [&] {
-        scalar_t *input_data = input.data_ptr<scalar_t>();
-        scalar_t *output_data = output.data_ptr<scalar_t>();
-
-        at::parallel_for(0, nbatch, 0, [&](int64_t start, int64_t end) {
-          for (const auto p : c10::irange(start, end)) {
-            avg_pool3d_out_frame(
-              input_data + p * istride, output_data + p * ostride, nslices,
-              itime, iwidth, iheight,
-              otime, owidth, oheight,
-              kT, kW, kH,
-              dT, dW, dH,
-              padT, padW, padH,
-              count_include_pad,
-              divisor_override
-            );
-          }
-        });
-    });
-  }
-}
-
-namespace {
-
-template <typename scalar_t>
-static void avg_pool3d_backward_out_frame(
-          scalar_t *gradInput_p,
-          scalar_t *gradOutput_p,
-          int64_t nslices,
-          int64_t itime,
-          int64_t iwidth,
-          int64_t iheight,
-          int64_t otime,
-          int64_t owidth,
-          int64_t oheight,
-          int kT,
-          int kW,
-          int kH,
-          int dT,
-          int dW,
-          int dH,
-          int padT,
-          int padW,
-          int padH,
-          bool count_include_pad,
-          c10::optional<int64_t> divisor_override)
-{
-  at::parallel_for(0, nslices, 0, [&](int64_t start, int64_t end) {
-    for (const auto k : c10::irange(start, end)) {
-      // NOLINTNEXTLINE(cppcoreguidelines-init-variables)
-      int64_t i, j, ti;
-
-      /* local pointers */
-      scalar_t *ip = gradInput_p + k * itime * iwidth * iheight;
-      scalar_t *op = gradOutput_p + k * otime * owidth * oheight;
-      for (i = 0; i < itime*iwidth*iheight; i++)
-        *(ip + i) = 0;
-
-      /* loop over output */
-      for (ti = 0; ti < otime; ti++)
-      {
-        for (i = 0; i < oheight; i++)
-        {
-          for (j = 0; j < owidth; j++)
-          {
-            int64_t tstart = ti * dT - padT;
-            int64_t hstart = i  * dH - padH;
-            int64_t wstart = j  * dW - padW;
-            int64_t tend = std::min(tstart + kT, itime + padT);
-            int64_t hend = std::min(hstart + kH, iheight + padH);
-            int64_t wend = std::min(wstart + kW, iwidth + padW);
-            int64_t pool_size = (tend -tstart) * (hend - hstart) * (wend - wstart);
-            tstart = std::max(tstart, (int64_t) 0);
-            hstart = std::max(hstart, (int64_t) 0);
-            wstart = std::max(wstart, (int64_t) 0);
-            tend = std::min(tend, itime);
-            hend = std::min(hend, iheight);
-            wend = std::min(wend, iwidth);
-
-            // NOLINTNEXTLINE(cppcoreguidelines-init-variables)
-            int divide_factor;
-            if (divisor_override.has_value()) {
-              divide_factor = divisor_override.value();
-            } else {
-              if(count_include_pad) {
-                divide_factor = pool_size;
-              } else {
-                // NOLINTNEXTLINE(cppcoreguidelines-narrowing-conversions,bugprone-narrowing-conversions)
-                divide_factor = (tend - tstart) * (hend - hstart) * (wend - wstart);
-              }
-            }
-
-            /* scatter gradients out to footprint: */
-            scalar_t val  = *op++;
-
-            // NOLINTNEXTLINE(cppcoreguidelines-init-variables)
-            int64_t x,y,z;
-            for (z = tstart; z < tend; z++)
-            {
-              for (y = hstart; y < hend; y++)
-              {
-                for (x = wstart; x < wend; x++)
-                {
-                  *(ip + z * iheight * iwidth + y * iwidth + x) += val / divide_factor;
-                }
-              }
-            }
-          }
-        }
-      }
-    }
-  });
+  avg_pool3d_kernel(
+      kCPU, output, input_,
+      kW, kH, kT,
+      dW, dH, dT,
+      padW, padH, padT,
+      count_include_pad, divisor_override);
 }
 
-} // anonymous namespace
-
 TORCH_IMPL_FUNC(avg_pool3d_backward_out_cpu) (
   const Tensor& gradOutput_,
   const Tensor& input,
@@ -460,70 +223,22 @@ TORCH_IMPL_FUNC(avg_pool3d_backward_out_cpu) (
   const int padH = padding.size() == 1 ? padT : safe_downcast<int, int64_t>(padding[1]);
   const int padW = padding.size() == 1 ? padT : safe_downcast<int, int64_t>(padding[2]);
 
-  const int64_t nslices = input.size(-4);
-  const int64_t itime = input.size(-3);
-  const int64_t iheight = input.size(-2);
-  const int64_t iwidth = input.size(-1);
-
-  /* get contiguous gradOutput */
-  Tensor gradOutput = gradOutput_.contiguous();
-
-  const int64_t otime = gradOutput.size(-3);
-  const int64_t oheight = gradOutput.size(-2);
-  const int64_t owidth = gradOutput.size(-1);
+  TORCH_CHECK(input.dtype() == gradOutput_.dtype(),
+    "expected dtype ", input.dtype(), " for `gradOutput` but got dtype ", gradOutput_.dtype());
 
+  /* zero the gradient */
   gradInput.zero_();
 
-  /* backprop */
-  if (input.ndimension() == 4) /* non-batch mode*/
-  {
-    AT_DISPATCH_FLOATING_TYPES_AND(at::ScalarType::Long, input.scalar_type(),
-      "avg_pool3d_backward_out_frame",
-      [&] {
-       scalar_t *gradInput_data = gradInput.data_ptr<scalar_t>();
-       scalar_t *gradOutput_data = gradOutput.data_ptr<scalar_t>();
-
-       avg_pool3d_backward_out_frame(
-         gradInput_data, gradOutput_data,
-         nslices,
-         itime, iwidth, iheight,
-         otime, owidth, oheight,
-         kT, kW, kH,
-         dT, dW, dH,
-         padT, padW, padH,
-         count_include_pad,
-         divisor_override);
-    });
-  }
-  else /* batch mode */
-  {
-    const int64_t nbatch = input.size(0);
-    const int64_t istride = nslices * itime * iwidth * iheight;
-    const int64_t ostride = nslices * otime * owidth * oheight;
-
-    AT_DISPATCH_FLOATING_TYPES_AND(at::ScalarType::Long, input.scalar_type(),
-      "avg_pool3d_backward_out_frame",
-      [&] {
-        scalar_t *gradInput_data = gradInput.data_ptr<scalar_t>();
-        scalar_t *gradOutput_data = gradOutput.data_ptr<scalar_t>();
-
-        at::parallel_for(0, nbatch, 0, [&](int64_t start, int64_t end) {
-          for (const auto p : c10::irange(start, end)) {
-            avg_pool3d_backward_out_frame(
-              gradInput_data  + p * istride, gradOutput_data + p * ostride, nslices,
-              itime, iwidth, iheight,
-              otime, owidth, oheight,
-              kT, kW, kH,
-              dT, dW, dH,
-              padT, padW, padH,
-              count_include_pad,
-              divisor_override
-            );
-          }
-        });
-    });
-  }
+  avg_pool3d_backward_kernel(
+      kCPU, gradInput, gradOutput_,
+      kW, kH, kT,
+      dW, dH, dT,
+      padW, padH, padT,
+      count_include_pad, divisor_override);
 }
 
+DEFINE_DISPATCH(avg_pool3d_kernel);
+DEFINE_DISPATCH(avg_pool3d_backward_kernel);
+
 } // at::native
 } // at
@@ -19,6 +19,77 @@
 namespace at::native {
 
 namespace {
+
+// Below this matrix size a direct unblocked factorization beats a per-matrix
+// LAPACK call: for large batches of tiny matrices (e.g. 6x6 covariance
+// factorizations) the call and argument-checking overhead of LAPACK dwarfs
+// the actual FLOPs. Complex inputs stay on LAPACK.
+constexpr int64_t kSmallMatrixBatchedLimit = 16;
+
+bool use_small_matrix_batched_path(const Tensor& input) {
+  const auto n = input.size(-1);
+  return (input.scalar_type() == kFloat || input.scalar_type() == kDouble) &&
+      input.size(-2) == n && n > 0 && n <= kSmallMatrixBatchedLimit &&
+      batchCount(input) > 1;
+}
+
+/*
+  Unblocked Cholesky factorization of a single small matrix, matching the
+  semantics of LAPACK's POTF2: only the `upper` (or lower) triangle is read
+  and written, and `info` is set to the 1-based order of the first
+  non-positive leading minor. The matrix is stored column-major with
+  lda == n; the `upper` factorization runs the same loops on the transposed
+  (row-major) view of the storage.
+*/
+template <typename scalar_t>
+void cholesky_small_single(scalar_t* a, int64_t n, bool upper, int* info) {
+  // a(r, c) is at a[r * rs + c * cs]
+  const int64_t rs = upper ? n : 1;
+  const int64_t cs = upper ? 1 : n;
+  *info = 0;
+  for (const auto j : c10::irange(n)) {
+    scalar_t d = a[j * rs + j * cs];
+    for (const auto k : c10::irange(j)) {
+      d -= a[j * rs + k * cs] * a[j * rs + k * cs];
+    }
+    // The negated comparison also catches NaN, like the DISNAN check in POTF2
+    if (!(d > scalar_t(0))) {
+      *info = static_cast<int>(j + 1);
+      return;
+    }
+    d = std::sqrt(d);
+    a[j * rs + j * cs] = d;
+    const scalar_t dinv = scalar_t(1) / d;
+    for (int64_t i = j + 1; i < n; i++) {
+      scalar_t s = a[i * rs + j * cs];
+      for (const auto k : c10::irange(j)) {
+        s -= a[i * rs + k * cs] * a[j * rs + k * cs];
+      }
+      a[i * rs + j * cs] = s * dinv;
+    }
+  }
+}
+
+template <typename scalar_t>
+void apply_cholesky_small(const Tensor& input, const Tensor& info, bool upper) {
+  auto input_data = input.data_ptr<scalar_t>();
+  auto info_data = info.data_ptr<int>();
+  auto input_matrix_stride = matrixStride(input);
+  auto batch_size = batchCount(input);
+  auto n = input.size(-2);
+
+  at::parallel_for(
+      0,
+      batch_size,
+      std::max<int64_t>(1, at::internal::GRAIN_SIZE / (n * n * n)),
+      [&](int64_t start, int64_t end) {
+        for (const auto i : c10::irange(start, end)) {
+          cholesky_small_single<scalar_t>(
+              &input_data[i * input_matrix_stride], n, upper, &info_data[i]);
+        }
+      });
+}
+
 /*
   Computes the Cholesky decomposition of matrices stored in `input`.
   This is an in-place routine and the content of 'input' is overwritten with the result.
@@ -58,6 +129,14 @@ void apply_cholesky(const Tensor& input, const Tensor& info, bool upper) {
 
 // This is a type dispatching helper function for 'apply_cholesky'
 void cholesky_kernel(const Tensor& input, const Tensor& infos, bool upper) {
+#if AT_BUILD_WITH_LAPACK()
+  if (use_small_matrix_batched_path(input)) {
+    AT_DISPATCH_FLOATING_TYPES(input.scalar_type(), "cholesky_cpu_small", [&]{
+      apply_cholesky_small<scalar_t>(input, infos, upper);
+    });
+    return;
+  }
+#endif
   AT_DISPATCH_FLOATING_AND_COMPLEX_TYPES(input.scalar_type(), "cholesky_cpu", [&]{
     apply_cholesky<scalar_t>(input, infos, upper);
   });
@@ -881,6 +960,81 @@ void ldl_solve_kernel(
       });
 }
 
+/*
+  Unblocked partial-pivoting LU factorization of a single small square matrix,
+  matching the semantics of LAPACK's GETF2: pivot indices are 1-based, U is
+  stored on and above the diagonal with the unit-lower multipliers below it,
+  and `info` records the 1-based index of the first zero pivot while the
+  factorization continues. The matrix is stored column-major with lda == n.
+*/
+template <typename scalar_t>
+void lu_factor_small_single(scalar_t* a, int64_t n, int* pivots, int* info) {
+  // a(r, c) is at a[c * n + r]
+  *info = 0;
+  for (const auto k : c10::irange(n)) {
+    int64_t p = k;
+    auto max_abs = std::abs(a[k * n + k]);
+    for (int64_t i = k + 1; i < n; i++) {
+      const auto v = std::abs(a[k * n + i]);
+      if (v > max_abs) {
+        max_abs = v;
+        p = i;
+      }
+    }
+    pivots[k] = static_cast<int>(p + 1);
+    if (max_abs == 0) {
+      // The whole pivot column is zero, so the multipliers are zero too and
+      // the trailing update is a no-op; GETF2 keeps factorizing here as well.
+      if (*info == 0) {
+        *info = static_cast<int>(k + 1);
+      }
+      continue;
+    }
+    if (p != k) {
+      for (const auto c : c10::irange(n)) {
+        std::swap(a[c * n + k], a[c * n + p]);
+      }
+    }
+    const scalar_t pivot_inv = scalar_t(1) / a[k * n + k];
+    for (int64_t i = k + 1; i < n; i++) {
+      a[k * n + i] *= pivot_inv;
+    }
+    for (int64_t c = k + 1; c < n; c++) {
+      const scalar_t multiplier = a[c * n + k];
+      if (multiplier != scalar_t(0)) {
+        for (int64_t i = k + 1; i < n; i++) {
+          a[c * n + i] -= a[k * n + i] * multiplier;
+        }
+      }
+    }
+  }
+}
+
+template <typename scalar_t>
+void apply_lu_factor_small(const Tensor& input, const Tensor& pivots, const Tensor& infos) {
+  auto input_data = input.data_ptr<scalar_t>();
+  auto pivots_data = pivots.data_ptr<int>();
+  auto infos_data = infos.data_ptr<int>();
+  auto input_matrix_stride = matrixStride(input);
+  auto pivots_stride = pivots.size(-1);
+  auto batch_size = batchCount(input);
+  auto n = input.size(-1);
+
+  at::parallel_for(
+      0,
+      batch_size,
+      std::max<int64_t>(1, at::internal::GRAIN_SIZE / (n * n * n)),
+      [&](int64_t start, int64_t end) {
+        for (const auto i : c10::irange(start, end)) {
+          lu_factor_small_single<scalar_t>(
+              &input_data[i * input_matrix_stride],
+              n,
+              &pivots_data[i * pivots_stride],
+              &infos_data[i]);
+        }
+      });
+}
+
 /*
   Computes the LU decomposition of a m×n matrix or batch of matrices in 'input' tensor.
   This is an in-place routine, content of 'input', 'pivots', and 'infos' is overwritten.
@@ -941,6 +1095,14 @@ void apply_lu_factor(const Tensor& input, const Tensor& pivots, const Tensor& in
 
 // This is a type dispatching helper function for 'apply_lu'
 void lu_factor_kernel(const Tensor& input, const Tensor& pivots, const Tensor& infos, bool compute_pivots) {
+#if AT_BUILD_WITH_LAPACK()
+  if (compute_pivots && use_small_matrix_batched_path(input)) {
+    AT_DISPATCH_FLOATING_TYPES(input.scalar_type(), "lu_cpu_small", [&]{
+      apply_lu_factor_small<scalar_t>(input, pivots, infos);
+    });
+    return;
+  }
+#endif
   AT_DISPATCH_FLOATING_AND_COMPLEX_TYPES(input.scalar_type(), "lu_cpu", [&]{
     apply_lu_factor<scalar_t>(input, pivots, infos, compute_pivots);
   });
@@ -78,6 +78,12 @@ bool use_blas_gemm(
     TransposeType transa, TransposeType transb,
     int64_t m, int64_t n, int64_t k,
     int64_t lda, int64_t ldb, int64_t ldc) {
+  // Tiny fixed-size products are dominated by the BLAS call overhead; they
+  // are handled by the unrolled kernels behind gemm_stub instead
+  // (see Note [Small fixed-size GEMM kernels] in cpu/BlasKernel.cpp).
+  if (internal::is_fixed_size_gemm(transa, transb, m, n, k)) {
+    return false;
+  }
   const bool transa_ = transa != TransposeType::NoTranspose;
   const bool transb_ = transb != TransposeType::NoTranspose;
   return (
@@ -14,6 +14,21 @@ void normalize_last_dims(
   TransposeType transa, TransposeType transb,
   int64_t m, int64_t n, int64_t k,
   int64_t *lda, int64_t *ldb, int64_t *ldc);
+
+// Largest dimension handled by the unrolled fixed-size GEMM kernels
+// (see Note [Small fixed-size GEMM kernels] in cpu/BlasKernel.cpp).
+constexpr int64_t kMaxFixedSizeGemmDim = 8;
+
+// True if the product is a tiny square no-transpose GEMM that gemm_stub
+// handles with a kernel templated on the dimension. Used both to route such
+// products away from BLAS and to select the kernel inside the stub.
+inline bool is_fixed_size_gemm(
+    TransposeType transa, TransposeType transb,
+    int64_t m, int64_t n, int64_t k) {
+  return transa == TransposeType::NoTranspose &&
+      transb == TransposeType::NoTranspose &&
+      m == n && n == k && m >= 2 && m <= kMaxFixedSizeGemmDim;
+}
 }  // namespace internal
 
 using gemm_fn = void(*)(
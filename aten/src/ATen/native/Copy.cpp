@@ -25,7 +25,6 @@
 #include <ATen/ops/_propagate_xla_data.h>
 #include <ATen/ops/_propagate_xla_data_native.h>
 #include <ATen/ops/copy_native.h>
-#include <ATen/ops/empty.h>
 #include <ATen/ops/expand_copy.h>
 #endif
 
@@ -38,87 +37,22 @@ namespace {
 
 using namespace at;
 
+// special case copy where tensor is contiguous and src is a (possibly
+// batched) transposed matrix, i.e. contiguous once its last two dims are
+// swapped. This is what matmul inputs, attention weights and contiguous()
+// after .t()/.mT produce; the blocked kernel in cpu/CopyKernel.cpp is much
+// faster than the generic strided TensorIterator loop for it.
 bool copy_transpose_valid(const Tensor& self, const Tensor& src) {
   const int MIN_SZ = 60 * 60;
-  return self.is_contiguous() && src.numel() != 0 && src.dim() == 2 &&
-      src.stride(0) == 1 && src.stride(1) == src.size(0) &&
+  return self.is_contiguous() && src.numel() != 0 && src.dim() >= 2 &&
+      src.stride(-2) == 1 && src.stride(-1) == src.size(-2) &&
+      src.transpose(-2, -1).is_contiguous() &&
       self.scalar_type() == src.scalar_type() &&
       !isBitsType(self.scalar_type()) &&
       self.sizes().equals(src.sizes()) &&
       self.is_neg() == src.is_neg() &&
       self.is_conj() == src.is_conj() &&
-      self.numel() >= MIN_SZ;
-}
-
-#if !defined(C10_MOBILE)
-#define _AT_DISPATCH_CP_TYPES(TYPE, NAME, ...)                              \
-        AT_DISPATCH_ALL_TYPES_AND_COMPLEX_AND8(                             \
-            kComplexHalf, kHalf, kBool, kBFloat16, kFloat8_e5m2,            \
-            kFloat8_e4m3fn, kFloat8_e5m2fnuz, kFloat8_e4m3fnuz, TYPE, NAME, \
-            __VA_ARGS__)
-#else
-#define _AT_DISPATCH_CP_TYPES(TYPE, NAME, ...)     \
-        AT_DISPATCH_ALL_TYPES_AND_COMPLEX_AND4(    \
-            kComplexHalf, kHalf, kBool, kBFloat16, \
-            TYPE, NAME, __VA_ARGS__)
-#endif
-
-// special case copy where tensor is contiguous and src is a transposed matrix
-// This can be generalized to most copies, but it's trickier
-void copy_same_type_transpose_(Tensor& self, const Tensor& src) {
-  // NOLINTNEXTLINE(cppcoreguidelines-init-variables)
-  int64_t BLOCK_SZ;
-  if (self.scalar_type() == kByte) {
-    // NOLINTNEXTLINE(cppcoreguidelines-avoid-magic-numbers)
-    BLOCK_SZ = 120;
-  } else {
-    // NOLINTNEXTLINE(cppcoreguidelines-avoid-magic-numbers)
-    BLOCK_SZ = 60;
-  }
-  Tensor buf = empty({BLOCK_SZ, BLOCK_SZ}, self.options());
-
-  // The code below is implemented with the assumption that sizes are equal
-  TORCH_INTERNAL_ASSERT_DEBUG_ONLY(self.sizes().equals(src.sizes()));
-
-  _AT_DISPATCH_CP_TYPES(self.scalar_type(), "copy_", [&] {
-    scalar_t* sp = src.data_ptr<scalar_t>();
-    scalar_t* rp = self.data_ptr<scalar_t>();
-    scalar_t* bp = buf.data_ptr<scalar_t>();
-
-    int64_t NR = src.size(0);
-    int64_t NC = src.size(1);
-    for (int64_t R = 0; R < NR; R += BLOCK_SZ) {
-      for (int64_t C = 0; C < NC; C += BLOCK_SZ) {
-        scalar_t* spo = sp + R + C * NR;
-        scalar_t* rpo = rp + C + R * NC;
-
-        int nr = std::min(NR - R, BLOCK_SZ);
-        int nc = std::min(NC - C, BLOCK_SZ);
-
-        // 1. copy columns from src to buf
-        for (const auto c : c10::irange(nc)) {
-          memcpy(bp + c * BLOCK_SZ, spo + c * NR, nr * sizeof(scalar_t));
-        }
-
-        // 2. transpose buf in place
-        int rc_max = std::max(nr, nc);
-        int rc_min = std::min(nr, nc);
-        for (const auto r : c10::irange(rc_max)) {
-          int end = std::min(r, rc_min);
-          for (const auto c : c10::irange(end)) {
-            scalar_t tmp = bp[r + BLOCK_SZ * c];
-            bp[r + BLOCK_SZ * c] = bp[r * BLOCK_SZ + c];
-            bp[r * BLOCK_SZ + c] = tmp;
-          }
-        }
-
-        // 3. copy rows from buf to dst
-        for (const auto r : c10::irange(nr)) {
-          memcpy(rpo + r * NC, bp + r * BLOCK_SZ, nc * sizeof(scalar_t));
-        }
-      }
-    }
-  });
+      src.size(-2) * src.size(-1) >= MIN_SZ;
 }
 
 // Devices directly supported by this copy implementation. Other device types
@@ -287,7 +221,7 @@ static Tensor & copy_impl(Tensor & self, const Tensor & src, bool non_blocking)
 
   // TODO: if we need to, we can also enable this path for quantized tensor
   if (device_type == kCPU && copy_transpose_valid(self, src) && !self.is_quantized()) {
-    copy_same_type_transpose_(self, src);
+    transpose_copy_kernel(kCPU, self, src);
     return self;
   }
 
@@ -350,6 +284,7 @@ void _propagate_xla_data(const Tensor& input, const Tensor& output) {
 }
 
 DEFINE_DISPATCH(copy_stub);
+DEFINE_DISPATCH(transpose_copy_kernel);
 
 } // namespace native
 } // namespace at
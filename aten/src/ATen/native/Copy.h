@@ -14,6 +14,14 @@ using copy_fn = void (*)(TensorIterator&, bool non_blocking);
 
 DECLARE_DISPATCH(copy_fn, copy_stub);
 
+// Cache-blocked copy of a (possibly batched) transposed matrix into a
+// contiguous tensor; `src` must be contiguous once its last two dims are
+// swapped. See copy_transpose_valid in Copy.cpp for the full eligibility
+// check.
+using transpose_copy_fn = void (*)(const TensorBase&, const TensorBase&);
+
+DECLARE_DISPATCH(transpose_copy_fn, transpose_copy_kernel);
+
 TORCH_API void copy_ignoring_overlaps(const TensorBase &dst, const TensorBase &src);
 
 } // namespace native
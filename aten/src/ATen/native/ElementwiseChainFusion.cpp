@@ -0,0 +1,135 @@
+#define TORCH_ASSERT_ONLY_METHOD_OPERATORS
+#include <ATen/native/ElementwiseChainFusion.h>
+
+#include <ATen/Parallel.h>
+#include <ATen/TensorIterator.h>
+#include <ATen/core/Tensor.h>
+#include <c10/util/irange.h>
+
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+namespace at::native::chain_fusion {
+
+namespace {
+
+// Floats handled per block when materializing: 16KiB keeps the chained
+// tensor plus one dense operand comfortably inside L1.
+constexpr int64_t kBlockSize = 4096;
+
+struct PendingChain {
+  float* data = nullptr;
+  int64_t numel = 0;
+  std::vector<BlockFn> fns;
+  // Keeps every tensor participating in a deferred op (and therefore every
+  // buffer captured by a BlockFn) alive until materialization.
+  std::vector<Tensor> keepalive;
+
+  void reset() {
+    data = nullptr;
+    numel = 0;
+    fns.clear();
+    keepalive.clear();
+  }
+};
+
+thread_local bool chain_fusion_enabled = false;
+thread_local PendingChain pending_chain;
+
+} // namespace
+
+bool enabled() {
+  return chain_fusion_enabled;
+}
+
+void setEnabled(bool enabled) {
+  if (!enabled) {
+    flush();
+  }
+  chain_fusion_enabled = enabled;
+}
+
+bool tryRecordInplace(TensorIteratorBase& iter, BlockFn fn) {
+  if (!chain_fusion_enabled) {
+    return false;
+  }
+  if (iter.noutputs() != 1 || !iter.device().is_cpu() ||
+      iter.dtype(0) != kFloat) {
+    return false;
+  }
+  // Only in-place ops over the first input are chained: the output buffer of
+  // one link is then by construction the input buffer of the next, and a
+  // deferred op never leaves a second, unmaterialized buffer behind.
+  if (iter.ntensors() < 2 || iter.data_ptr(0) != iter.data_ptr(1)) {
+    return false;
+  }
+  // Like is_contiguous(), but scalar operands (stride 0) are fine: their
+  // value is baked into the functor and never read through the iterator.
+  if (iter.numel() > 1) {
+    if (iter.ndim() != 1) {
+      return false;
+    }
+    for (const auto i : c10::irange(iter.ntensors())) {
+      if (iter.strides(i)[0] != static_cast<int64_t>(sizeof(float)) &&
+          !iter.is_scalar(i)) {
+        return false;
+      }
+    }
+  }
+  // Extra operands must be same-numel dense tensors (read in lockstep by the
+  // BlockFn) or scalars the caller baked into the functor.
+  for (const auto i : c10::irange(iter.ntensors())) {
+    if (iter.dtype(i) != kFloat) {
+      return false;
+    }
+    if (iter.tensor_base(i).numel() != iter.numel() && !iter.is_scalar(i)) {
+      return false;
+    }
+  }
+  auto* data = static_cast<float*>(iter.data_ptr(0));
+  if (pending_chain.data != nullptr &&
+      (pending_chain.data != data || pending_chain.numel != iter.numel())) {
+    flush();
+  }
+  if (pending_chain.data == nullptr) {
+    pending_chain.data = data;
+    pending_chain.numel = iter.numel();
+  }
+  for (const auto i : c10::irange(iter.ntensors())) {
+    pending_chain.keepalive.emplace_back(iter.tensor(i));
+  }
+  pending_chain.fns.emplace_back(std::move(fn));
+  return true;
+}
+
+void flush() {
+  if (pending_chain.fns.empty()) {
+    return;
+  }
+  float* data = pending_chain.data;
+  const int64_t numel = pending_chain.numel;
+  auto fns = std::move(pending_chain.fns);
+  auto keepalive = std::move(pending_chain.keepalive);
+  pending_chain.reset();
+  at::parallel_for(
+      0, numel, at::internal::GRAIN_SIZE, [&](int64_t begin, int64_t end) {
+        for (int64_t b = begin; b < end; b += kBlockSize) {
+          const int64_t len = std::min(kBlockSize, end - b);
+          for (const auto& fn : fns) {
+            fn(data, b, len);
+          }
+        }
+      });
+}
+
+ChainFusionGuard::ChainFusionGuard() : prev_enabled_(chain_fusion_enabled) {
+  chain_fusion_enabled = true;
+}
+
+ChainFusionGuard::~ChainFusionGuard() {
+  flush();
+  chain_fusion_enabled = prev_enabled_;
+}
+
+} // namespace at::native::chain_fusion
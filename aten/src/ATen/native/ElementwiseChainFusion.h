@@ -0,0 +1,66 @@
+#pragma once
+
+#include <c10/macros/Macros.h>
+
+#include <cstdint>
+#include <functional>
+
+namespace at {
+struct TensorIteratorBase;
+}
+
+namespace at::native::chain_fusion {
+
+// Eager micro-fusion for elementwise chains.
+//
+// Chains like `x.mul_(a).add_(b).clamp_(0, 6)` make one full memory pass per
+// op in eager mode even though each op only reads what the previous one just
+// wrote. While this mode is enabled on a thread, eligible elementwise CPU
+// kernels defer their loop into a pending per-thread chain instead of
+// executing it; the chain is materialized as a single blocked pass that
+// applies every deferred op while the block is still L1-resident, so the
+// tensor crosses the memory bus once.
+//
+// The recorder cannot observe reads, so it is an explicit, scoped opt-in:
+// within a guard's scope the caller must not consume a tensor with deferred
+// ops other than through further chained ops. Everything stays exact -- the
+// same functors run, only blocked differently.
+//
+// Eligibility (checked by tryRecordInplace): float CPU, contiguous, one
+// output written in place over the first input, remaining operands either
+// same-shape dense tensors or scalars baked into the functor.
+
+// Applies one deferred op in place to [data + begin, data + begin + len).
+// Implementations are created inside CPU-capability-specific kernels so they
+// can use the widest Vectorized available; they are only ever invoked
+// through std::function, which keeps the capability namespaces apart.
+using BlockFn = std::function<void(float* data, int64_t begin, int64_t len)>;
+
+TORCH_API bool enabled();
+
+// Enables or disables deferral on the current thread. Disabling materializes
+// any pending chain. Prefer ChainFusionGuard in C++.
+TORCH_API void setEnabled(bool enabled);
+
+// Records `fn` as the next link of the pending chain if the mode is enabled
+// and `iter` is eligible (see above). Returns true if the op was deferred,
+// in which case the kernel must not compute anything; false means the caller
+// runs its normal loop. An eligible op whose output does not continue the
+// pending chain materializes it first and starts a new chain.
+TORCH_API bool tryRecordInplace(TensorIteratorBase& iter, BlockFn fn);
+
+// Materializes the pending chain (if any) with a single blocked pass.
+TORCH_API void flush();
+
+// RAII opt-in; the destructor materializes whatever is still pending.
+struct TORCH_API ChainFusionGuard {
+  ChainFusionGuard();
+  ~ChainFusionGuard();
+  ChainFusionGuard(const ChainFusionGuard&) = delete;
+  ChainFusionGuard& operator=(const ChainFusionGuard&) = delete;
+
+ private:
+  bool prev_enabled_;
+};
+
+} // namespace at::native::chain_fusion
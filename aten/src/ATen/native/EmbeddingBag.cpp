@@ -22,6 +22,7 @@
 
 #include <algorithm>
 #include <cstring>
+#include <limits>
 #include <tuple>
 #include <utility>
 #include <vector>
@@ -74,8 +75,18 @@ namespace {
 std::pair<Tensor, Tensor> promoteIndicesAndOffsets(
     const Tensor& indices,
     const Tensor& offsets) {
-  const auto commonType =
+  auto commonType =
       promoteTypes(offsets.scalar_type(), indices.scalar_type());
+  // The kernels are templated on the index type, so a mixed Int/Long pair
+  // only needs to agree on one type, not specifically on Long. When the
+  // indices are Int, resolve the pair down to Int instead: that converts the
+  // offsets (one entry per bag) rather than the indices (one entry per
+  // lookup), keeping the index bandwidth of int32 tables halved. Every valid
+  // offset is bounded by indices.numel(), so the demotion cannot overflow.
+  if (indices.scalar_type() == kInt && commonType == kLong &&
+      indices.numel() <= std::numeric_limits<int32_t>::max()) {
+    commonType = kInt;
+  }
   return {
       indices.scalar_type() == commonType ? indices
                                           : indices.toType(commonType),
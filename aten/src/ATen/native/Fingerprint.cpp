@@ -0,0 +1,81 @@
+#define TORCH_ASSERT_ONLY_METHOD_OPERATORS
+#include <ATen/core/Tensor.h>
+#include <ATen/Parallel.h>
+#include <ATen/native/Fingerprint.h>
+
+#ifndef AT_PER_OPERATOR_HEADERS
+#include <ATen/Functions.h>
+#include <ATen/NativeFunctions.h>
+#else
+#include <ATen/ops/_tensor_fingerprint_native.h>
+#include <ATen/ops/scalar_tensor.h>
+#endif
+
+#include <atomic>
+#include <cstring>
+
+namespace at {
+namespace native {
+
+// Note [Tensor fingerprint]
+// ~~~~~~~~~~~~~~~~~~~~~~~~~
+// _tensor_fingerprint computes a cheap 64-bit content hash of a tensor for
+// application-level dedup / semantic caches. The hash is defined over the
+// raw bytes of the contiguous representation: every aligned 64-bit word
+// contributes mix64(word ^ mix64(index + 1)), the contributions are summed,
+// and the sum is finalized together with the byte length. Because the
+// per-word contributions commute, the hash can be computed with any degree
+// of parallelism (CPU threads or CUDA blocks) and still produce the same
+// value everywhere, so CPU and CUDA fingerprints of equal bytes agree.
+// It is a fingerprint, not a cryptographic hash.
+//
+// The result is a 0-dim int64 tensor on the input's device; callers that
+// want the value on the host pay a single 8-byte transfer via item().
+
+namespace {
+
+uint64_t fingerprint_words(const uint8_t* data, int64_t nbytes) {
+  const int64_t n_words = nbytes / static_cast<int64_t>(sizeof(uint64_t));
+  std::atomic<uint64_t> acc{0};
+  at::parallel_for(
+      0, n_words, at::internal::GRAIN_SIZE, [&](int64_t begin, int64_t end) {
+        const uint64_t* words = reinterpret_cast<const uint64_t*>(data);
+        uint64_t local = 0;
+        for (int64_t i = begin; i < end; i++) {
+          local += fingerprint_mix64(
+              words[i] ^ fingerprint_mix64(static_cast<uint64_t>(i) + 1));
+        }
+        acc.fetch_add(local, std::memory_order_relaxed);
+      });
+  uint64_t sum = acc.load(std::memory_order_relaxed);
+  // Fold any trailing bytes into a zero-padded final word.
+  const int64_t tail = nbytes % static_cast<int64_t>(sizeof(uint64_t));
+  if (tail != 0) {
+    uint64_t last_word = 0;
+    std::memcpy(&last_word, data + n_words * sizeof(uint64_t), tail);
+    sum += fingerprint_mix64(
+        last_word ^ fingerprint_mix64(static_cast<uint64_t>(n_words) + 1));
+  }
+  return fingerprint_mix64(sum ^ static_cast<uint64_t>(nbytes));
+}
+
+} // namespace
+
+Tensor _tensor_fingerprint_cpu(const Tensor& self) {
+  TORCH_CHECK(
+      self.layout() == c10::kStrided,
+      "_tensor_fingerprint: only strided tensors are supported, got ",
+      self.layout());
+  // The fingerprint is defined over the contiguous byte image; for already
+  // contiguous tensors this is a no-op, for strided ones it is one
+  // device-local copy (still no host round trip).
+  auto t = self.contiguous();
+  const auto* data = static_cast<const uint8_t*>(t.const_data_ptr());
+  const int64_t nbytes = t.numel() * t.element_size();
+  const uint64_t fingerprint = fingerprint_words(data, nbytes);
+  return at::scalar_tensor(
+      static_cast<int64_t>(fingerprint), self.options().dtype(at::kLong));
+}
+
+} // namespace native
+} // namespace at
@@ -0,0 +1,23 @@
+#pragma once
+
+#include <c10/macros/Macros.h>
+
+#include <cstdint>
+
+namespace at {
+namespace native {
+
+// 64-bit finalizer (MurmurHash3 fmix64) shared by the CPU and CUDA
+// implementations of _tensor_fingerprint; see Note [Tensor fingerprint] in
+// Fingerprint.cpp.
+C10_HOST_DEVICE inline uint64_t fingerprint_mix64(uint64_t x) {
+  x ^= x >> 33;
+  x *= 0xff51afd7ed558ccdULL;
+  x ^= x >> 33;
+  x *= 0xc4ceb9fe1a85ec53ULL;
+  x ^= x >> 33;
+  return x;
+}
+
+} // namespace native
+} // namespace at
@@ -0,0 +1,30 @@
+#pragma once
+
+#include <ATen/core/Tensor.h>
+#include <ATen/native/DispatchStub.h>
+
+namespace at::native {
+
+// Fused CPU kernels for the _foreach_* operations that dominate optimizer
+// steps. The per-tensor loops in ForeachOpsKernels.cpp divert to these stubs
+// when every tensor is a contiguous float/double CPU tensor of matching
+// size; the kernels flatten the lists into fixed-size chunks processed by a
+// single parallel_for with vectorized inner loops.
+
+using foreach_scalar_fn = void (*)(TensorList, const Scalar&);
+using foreach_list_alpha_fn = void (*)(TensorList, TensorList, const Scalar&);
+using foreach_list_fn = void (*)(TensorList, TensorList);
+using foreach_unary_fn = void (*)(TensorList);
+using foreach_pointwise_fn =
+    void (*)(TensorList, TensorList, TensorList, const Scalar&);
+
+DECLARE_DISPATCH(foreach_scalar_fn, foreach_add_scalar_fused_stub);
+DECLARE_DISPATCH(foreach_scalar_fn, foreach_mul_scalar_fused_stub);
+DECLARE_DISPATCH(foreach_list_alpha_fn, foreach_add_list_fused_stub);
+DECLARE_DISPATCH(foreach_list_alpha_fn, foreach_lerp_list_fused_stub);
+DECLARE_DISPATCH(foreach_list_fn, foreach_mul_list_fused_stub);
+DECLARE_DISPATCH(foreach_unary_fn, foreach_sqrt_fused_stub);
+DECLARE_DISPATCH(foreach_pointwise_fn, foreach_addcmul_scalar_fused_stub);
+DECLARE_DISPATCH(foreach_pointwise_fn, foreach_addcdiv_scalar_fused_stub);
+
+} // namespace at::native
@@ -1,6 +1,7 @@
 #include <vector>
 #define TORCH_ASSERT_ONLY_METHOD_OPERATORS
 #include <ATen/core/Tensor.h>
+#include <ATen/native/ForeachKernels.h>
 #include <ATen/native/ForeachUtils.h>
 #include <c10/util/irange.h>
 
@@ -62,6 +63,48 @@
 
 namespace at::native {
 
+DEFINE_DISPATCH(foreach_add_scalar_fused_stub);
+DEFINE_DISPATCH(foreach_mul_scalar_fused_stub);
+DEFINE_DISPATCH(foreach_add_list_fused_stub);
+DEFINE_DISPATCH(foreach_lerp_list_fused_stub);
+DEFINE_DISPATCH(foreach_mul_list_fused_stub);
+DEFINE_DISPATCH(foreach_sqrt_fused_stub);
+DEFINE_DISPATCH(foreach_addcmul_scalar_fused_stub);
+DEFINE_DISPATCH(foreach_addcdiv_scalar_fused_stub);
+
+namespace {
+
+// Gate for the fused CPU kernels in cpu/ForeachOpsKernel.cpp: the same
+// conditions the CUDA fast path checks (shared dtype and device, matching
+// sizes and strides, no scalar type promotion), narrowed further to
+// contiguous float/double CPU tensors, which is what the vectorized kernels
+// cover. Everything else stays on the per-tensor loops.
+bool can_use_fused_cpu_foreach(
+    ArrayRef<TensorList> tensorLists,
+    ArrayRef<Scalar> scalarList = {}) {
+  const auto& ref = tensorLists[0];
+  if (ref.empty() || !ref[0].is_cpu()) {
+    return false;
+  }
+  const auto dtype = ref[0].scalar_type();
+  if (dtype != at::kFloat && dtype != at::kDouble) {
+    return false;
+  }
+  if (!can_use_fast_route(tensorLists, scalarList)) {
+    return false;
+  }
+  // can_use_fast_route guarantees matching strides across lists, so checking
+  // the reference list for contiguity covers all of them.
+  for (const auto& t : ref) {
+    if (!t.is_contiguous()) {
+      return false;
+    }
+  }
+  return true;
+}
+
+} // namespace
+
 #define FOREACH_BINARY_OP_TENSOR(OP)                            \
   void foreach_tensor_##OP##_tensor_kernel_slow_(               \
       TensorList tensors, const Tensor& scalar) {               \
@@ -327,17 +370,162 @@ namespace at::native {
         input, tensors1, tensors2, scalars);                              \
   }
 
-FOREACH_BINARY_OP_LIST_ALPHA(add);
+// Variants of the macros above for the operations with a fused CPU kernel:
+// identical to their plain counterparts except that the in-place entry point
+// diverts to the corresponding dispatch stub when the fused path applies.
+// Out-of-place variants keep the per-tensor loops; their cost is dominated by
+// the output allocations.
+
+#define FOREACH_BINARY_OP_SCALAR_FUSED(OP)                      \
+  void foreach_tensor_##OP##_scalar_kernel_slow_(               \
+      TensorList tensors, const Scalar& scalar) {               \
+    check_foreach_api_restrictions(tensors);                    \
+                                                                \
+    if (can_use_fused_cpu_foreach({tensors}, {scalar})) {       \
+      foreach_##OP##_scalar_fused_stub(kCPU, tensors, scalar);  \
+      return;                                                   \
+    }                                                           \
+    for (auto& t : tensors) {                                   \
+      t.OP##_(scalar);                                          \
+    }                                                           \
+  }                                                             \
+                                                                \
+  std::vector<Tensor> foreach_tensor_##OP##_scalar_kernel_slow( \
+      TensorList tensors, const Scalar& scalar) {               \
+    check_foreach_api_restrictions(tensors);                    \
+                                                                \
+    std::vector<Tensor> result;                                 \
+    result.reserve(tensors.size());                             \
+    for (const auto& t : tensors) {                             \
+      result.emplace_back(t.OP(scalar));                        \
+    }                                                           \
+                                                                \
+    return result;                                              \
+  }
+
+#define FOREACH_BINARY_OP_LIST_FUSED(OP)                      \
+  std::vector<Tensor> foreach_tensor_##OP##_list_kernel_slow( \
+      TensorList tensors1, TensorList tensors2) {             \
+    check_foreach_api_restrictions(tensors1, tensors2);       \
+                                                              \
+    std::vector<Tensor> result;                               \
+    result.reserve(tensors1.size());                          \
+    for (const auto i : c10::irange(tensors1.size())) {       \
+      result.emplace_back(tensors1[i].OP(tensors2[i]));       \
+    }                                                         \
+                                                              \
+    return result;                                            \
+  }                                                           \
+                                                              \
+  void foreach_tensor_##OP##_list_kernel_slow_(               \
+      TensorList tensors1, TensorList tensors2) {             \
+    check_foreach_api_restrictions(tensors1, tensors2);       \
+                                                              \
+    if (can_use_fused_cpu_foreach({tensors1, tensors2})) {    \
+      foreach_##OP##_list_fused_stub(kCPU, tensors1, tensors2); \
+      return;                                                 \
+    }                                                         \
+    for (const auto i : c10::irange(tensors1.size())) {       \
+      tensors1[i].OP##_(tensors2[i]);                         \
+    }                                                         \
+  }
+
+#define FOREACH_BINARY_OP_LIST_ALPHA_FUSED(OP)                         \
+  std::vector<Tensor> foreach_tensor_##OP##_list_kernel_slow(          \
+      TensorList tensors1, TensorList tensors2, const Scalar& alpha) { \
+    check_foreach_api_restrictions(tensors1, tensors2);                \
+                                                                       \
+    std::vector<Tensor> result;                                        \
+    result.reserve(tensors1.size());                                   \
+    for (const auto i : c10::irange(tensors1.size())) {                \
+      result.emplace_back(tensors1[i].OP(tensors2[i], alpha));         \
+    }                                                                  \
+                                                                       \
+    return result;                                                     \
+  }                                                                    \
+                                                                       \
+  void foreach_tensor_##OP##_list_kernel_slow_(                        \
+      TensorList tensors1, TensorList tensors2, const Scalar& alpha) { \
+    check_foreach_api_restrictions(tensors1, tensors2);                \
+                                                                       \
+    if (can_use_fused_cpu_foreach({tensors1, tensors2}, {alpha})) {    \
+      foreach_##OP##_list_fused_stub(kCPU, tensors1, tensors2, alpha); \
+      return;                                                          \
+    }                                                                  \
+    for (const auto i : c10::irange(tensors1.size())) {                \
+      tensors1[i].OP##_(tensors2[i], alpha);                           \
+    }                                                                  \
+  }
+
+#define FOREACH_UNARY_OP_FUSED(OP)                                     \
+  std::vector<Tensor> foreach_tensor_##OP##_slow(TensorList tensors) { \
+    check_foreach_api_restrictions(tensors);                           \
+                                                                       \
+    std::vector<Tensor> result;                                        \
+    result.reserve(tensors.size());                                    \
+    for (const auto& t : tensors) {                                    \
+      result.emplace_back(t.OP());                                     \
+    }                                                                  \
+                                                                       \
+    return result;                                                     \
+  }                                                                    \
+                                                                       \
+  void foreach_tensor_##OP##_slow_(TensorList tensors) {               \
+    check_foreach_api_restrictions(tensors);                           \
+                                                                       \
+    if (can_use_fused_cpu_foreach({tensors})) {                        \
+      foreach_##OP##_fused_stub(kCPU, tensors);                        \
+      return;                                                          \
+    }                                                                  \
+    for (auto& t : tensors) {                                          \
+      t.OP##_();                                                       \
+    }                                                                  \
+  }
+
+#define FOREACH_POINTWISE_OP_SCALAR_FUSED(OP)                             \
+  std::vector<Tensor> foreach_tensor_##OP##_scalar_slow(                  \
+      TensorList input,                                                   \
+      TensorList tensors1,                                                \
+      TensorList tensors2,                                                \
+      const Scalar& scalar) {                                             \
+    check_foreach_api_restrictions(input, tensors1, tensors2);            \
+                                                                          \
+    std::vector<Tensor> result;                                           \
+    for (const auto i : c10::irange(input.size())) {                      \
+      result.emplace_back(input[i].OP(tensors1[i], tensors2[i], scalar)); \
+    }                                                                     \
+                                                                          \
+    return result;                                                        \
+  }                                                                       \
+                                                                          \
+  void foreach_tensor_##OP##_scalar_slow_(                                \
+      TensorList input,                                                   \
+      TensorList tensors1,                                                \
+      TensorList tensors2,                                                \
+      const Scalar& scalar) {                                             \
+    check_foreach_api_restrictions(input, tensors1, tensors2);            \
+                                                                          \
+    if (can_use_fused_cpu_foreach({input, tensors1, tensors2}, {scalar})) { \
+      foreach_##OP##_scalar_fused_stub(                                   \
+          kCPU, input, tensors1, tensors2, scalar);                       \
+      return;                                                             \
+    }                                                                     \
+    for (const auto i : c10::irange(input.size())) {                      \
+      input[i].OP##_(tensors1[i], tensors2[i], scalar);                   \
+    }                                                                     \
+  }
+
+FOREACH_BINARY_OP_LIST_ALPHA_FUSED(add);
 FOREACH_BINARY_OP_LIST_ALPHA(sub);
-FOREACH_BINARY_OP_LIST_ALPHA(lerp);
+FOREACH_BINARY_OP_LIST_ALPHA_FUSED(lerp);
 
 FOREACH_BINARY_OP_TENSOR_ALPHA(add);
 FOREACH_BINARY_OP_TENSOR(mul);
 FOREACH_BINARY_OP_TENSOR(div);
 
-FOREACH_BINARY_OP_SCALAR(add);
+FOREACH_BINARY_OP_SCALAR_FUSED(add);
 FOREACH_BINARY_OP_SCALAR(sub);
-FOREACH_BINARY_OP_SCALAR(mul);
+FOREACH_BINARY_OP_SCALAR_FUSED(mul);
 FOREACH_BINARY_OP_SCALAR(div);
 FOREACH_BINARY_OP_SCALAR(clamp_min);
 FOREACH_BINARY_OP_SCALAR(clamp_max);
@@ -351,7 +539,7 @@ FOREACH_BINARY_OP_SCALARLIST(clamp_min);
 FOREACH_BINARY_OP_SCALARLIST(clamp_max);
 FOREACH_BINARY_OP_SCALARLIST(pow);
 
-FOREACH_BINARY_OP_LIST(mul);
+FOREACH_BINARY_OP_LIST_FUSED(mul);
 FOREACH_BINARY_OP_LIST(div);
 FOREACH_BINARY_OP_LIST(clamp_min);
 FOREACH_BINARY_OP_LIST(clamp_max);
@@ -368,7 +556,7 @@ void foreach_tensor_copy_list_kernel_slow_(
   }
 }
 
-FOREACH_UNARY_OP(sqrt);
+FOREACH_UNARY_OP_FUSED(sqrt);
 FOREACH_UNARY_OP(exp);
 FOREACH_UNARY_OP(abs);
 FOREACH_UNARY_OP(acos);
@@ -398,8 +586,8 @@ FOREACH_UNARY_OP(reciprocal);
 FOREACH_UNARY_OP(sigmoid);
 FOREACH_UNARY_OP(sign);
 
-FOREACH_POINTWISE_OP_SCALAR(addcdiv);
-FOREACH_POINTWISE_OP_SCALAR(addcmul);
+FOREACH_POINTWISE_OP_SCALAR_FUSED(addcdiv);
+FOREACH_POINTWISE_OP_SCALAR_FUSED(addcmul);
 
 FOREACH_POINTWISE_OP_SCALARLIST(addcdiv);
 FOREACH_POINTWISE_OP_SCALARLIST(addcmul);
@@ -0,0 +1,242 @@
+#define TORCH_ASSERT_ONLY_METHOD_OPERATORS
+#include <ATen/native/FusedDropoutAddLayerNorm.h>
+
+#include <ATen/CPUGeneratorImpl.h>
+#include <ATen/Dispatch.h>
+#include <ATen/OpMathType.h>
+#include <ATen/Parallel.h>
+#include <ATen/core/DistributionsHelper.h>
+#include <ATen/core/Tensor.h>
+#include <c10/util/irange.h>
+
+#ifndef AT_PER_OPERATOR_HEADERS
+#include <ATen/Functions.h>
+#include <ATen/NativeFunctions.h>
+#else
+#include <ATen/ops/_fused_dropout_add_layer_norm_backward_native.h>
+#include <ATen/ops/_fused_dropout_add_layer_norm_native.h>
+#include <ATen/ops/arange.h>
+#include <ATen/ops/empty.h>
+#include <ATen/ops/native_layer_norm_backward.h>
+#endif
+
+#include <cmath>
+#include <mutex>
+#include <tuple>
+
+namespace at {
+namespace native {
+
+// Fused transformer residual block: dropout on the sublayer output, add the
+// residual, layer norm over the last dimension, all in one pass instead of
+// three dispatches and three trips over activation memory. The dropout mask
+// is returned packed one bit per element (see FusedDropoutAddLayerNorm.h),
+// an 8x saving over the byte masks native_dropout keeps alive until the
+// backward. mean/rstd match native_layer_norm so the backward composes from
+// existing kernels.
+std::tuple<Tensor, Tensor, Tensor, Tensor> fused_dropout_add_layer_norm_cpu(
+    const Tensor& input,
+    const Tensor& residual,
+    const c10::optional<Tensor>& gamma_opt,
+    const c10::optional<Tensor>& beta_opt,
+    double p,
+    bool train,
+    double eps) {
+  c10::MaybeOwned<Tensor> gamma_maybe_owned =
+      at::borrow_from_optional_tensor(gamma_opt);
+  const Tensor& gamma = *gamma_maybe_owned;
+  c10::MaybeOwned<Tensor> beta_maybe_owned =
+      at::borrow_from_optional_tensor(beta_opt);
+  const Tensor& beta = *beta_maybe_owned;
+
+  auto M_D = _check_fused_dropout_add_layer_norm_inputs(
+      input, residual, gamma, beta, p);
+  const int64_t M = std::get<0>(M_D);
+  const int64_t D = std::get<1>(M_D);
+
+  auto input_c = input.expect_contiguous();
+  auto residual_c = residual.expect_contiguous();
+  auto gamma_c = gamma.expect_contiguous();
+  auto beta_c = beta.expect_contiguous();
+
+  const bool use_dropout = train && p > 0;
+  const int64_t mask_bytes = _fused_dropout_mask_bytes_per_row(D);
+
+  Tensor out = at::empty(input.sizes(), input.options());
+  Tensor mask = at::empty(
+      {use_dropout ? M : 0, mask_bytes}, input.options().dtype(kByte));
+  Tensor mean = at::empty({M}, input.options());
+  Tensor rstd = at::empty({M}, input.options());
+
+  if (use_dropout && M > 0) {
+    // The mask is drawn serially from the default generator (matching how
+    // the CPU distribution kernels use it); the fused add + norm below is
+    // what runs in parallel.
+    auto gen = at::get_generator_or_default<CPUGeneratorImpl>(
+        c10::nullopt, at::detail::getDefaultCPUGenerator());
+    std::lock_guard<std::mutex> lock(gen->mutex_);
+    at::uniform_real_distribution<double> standard_uniform(0.0, 1.0);
+    uint8_t* mask_data = mask.mutable_data_ptr<uint8_t>();
+    for (const auto i : c10::irange(M)) {
+      uint8_t* mask_row = mask_data + i * mask_bytes;
+      for (const auto b : c10::irange(mask_bytes)) {
+        uint8_t byte = 0;
+        const int64_t j_end = std::min<int64_t>(
+            D - b * kFusedDropoutMaskBitsPerByte, kFusedDropoutMaskBitsPerByte);
+        for (const auto bit : c10::irange(j_end)) {
+          if (standard_uniform(gen) >= p) {
+            byte |= static_cast<uint8_t>(1u << bit);
+          }
+        }
+        mask_row[b] = byte;
+      }
+    }
+  }
+
+  if (M > 0) {
+    AT_DISPATCH_FLOATING_TYPES_AND2(
+        kBFloat16,
+        kHalf,
+        input.scalar_type(),
+        "fused_dropout_add_layer_norm_cpu",
+        [&] {
+          using opmath_t = at::opmath_type<scalar_t>;
+          const scalar_t* input_data = input_c->const_data_ptr<scalar_t>();
+          const scalar_t* residual_data =
+              residual_c->const_data_ptr<scalar_t>();
+          const uint8_t* mask_data =
+              use_dropout ? mask.const_data_ptr<uint8_t>() : nullptr;
+          const scalar_t* gamma_data =
+              gamma.defined() ? gamma_c->const_data_ptr<scalar_t>() : nullptr;
+          const scalar_t* beta_data =
+              beta.defined() ? beta_c->const_data_ptr<scalar_t>() : nullptr;
+          scalar_t* out_data = out.mutable_data_ptr<scalar_t>();
+          scalar_t* mean_data = mean.mutable_data_ptr<scalar_t>();
+          scalar_t* rstd_data = rstd.mutable_data_ptr<scalar_t>();
+          const opmath_t dropout_scale = use_dropout
+              ? opmath_t(1) / (opmath_t(1) - static_cast<opmath_t>(p))
+              : opmath_t(1);
+
+          at::parallel_for(0, M, 1, [&](int64_t begin, int64_t end) {
+            for (const auto i : c10::irange(begin, end)) {
+              const scalar_t* in_row = input_data + i * D;
+              const scalar_t* res_row = residual_data + i * D;
+              const uint8_t* mask_row =
+                  mask_data ? mask_data + i * mask_bytes : nullptr;
+              scalar_t* out_row = out_data + i * D;
+              opmath_t sum = 0;
+              opmath_t sum_sq = 0;
+              for (const auto j : c10::irange(D)) {
+                opmath_t val = static_cast<opmath_t>(in_row[j]);
+                if (mask_row != nullptr) {
+                  const bool keep = (mask_row[j / kFusedDropoutMaskBitsPerByte] >>
+                                     (j % kFusedDropoutMaskBitsPerByte)) &
+                      1;
+                  val = keep ? val * dropout_scale : opmath_t(0);
+                }
+                val += static_cast<opmath_t>(res_row[j]);
+                out_row[j] = static_cast<scalar_t>(val);
+                sum += val;
+                sum_sq += val * val;
+              }
+              const opmath_t scale = opmath_t(1) / static_cast<opmath_t>(D);
+              const opmath_t mean_val = sum * scale;
+              opmath_t var = sum_sq * scale - mean_val * mean_val;
+              var = var < opmath_t(0) ? opmath_t(0) : var;
+              const opmath_t rstd_val =
+                  opmath_t(1) / std::sqrt(var + static_cast<opmath_t>(eps));
+              for (const auto j : c10::irange(D)) {
+                opmath_t val =
+                    (static_cast<opmath_t>(out_row[j]) - mean_val) * rstd_val;
+                if (gamma_data != nullptr) {
+                  val *= static_cast<opmath_t>(gamma_data[j]);
+                }
+                if (beta_data != nullptr) {
+                  val += static_cast<opmath_t>(beta_data[j]);
+                }
+                out_row[j] = static_cast<scalar_t>(val);
+              }
+              mean_data[i] = static_cast<scalar_t>(mean_val);
+              rstd_data[i] = static_cast<scalar_t>(rstd_val);
+            }
+          });
+        });
+  }
+
+  // Stats are shaped like native_layer_norm's so the backward composes with
+  // native_layer_norm_backward.
+  auto stat_sizes = input.sizes().vec();
+  stat_sizes.back() = 1;
+  return std::make_tuple(
+      std::move(out),
+      std::move(mask),
+      mean.view(stat_sizes),
+      rstd.view(stat_sizes));
+}
+
+std::tuple<Tensor, Tensor, Tensor, Tensor>
+fused_dropout_add_layer_norm_backward(
+    const Tensor& grad_out,
+    const Tensor& input,
+    const Tensor& residual,
+    const Tensor& mask,
+    const Tensor& mean,
+    const Tensor& rstd,
+    const c10::optional<Tensor>& gamma_opt,
+    const c10::optional<Tensor>& beta_opt,
+    double p,
+    bool train) {
+  c10::MaybeOwned<Tensor> gamma_maybe_owned =
+      at::borrow_from_optional_tensor(gamma_opt);
+  const Tensor& gamma = *gamma_maybe_owned;
+  c10::MaybeOwned<Tensor> beta_maybe_owned =
+      at::borrow_from_optional_tensor(beta_opt);
+  const Tensor& beta = *beta_maybe_owned;
+
+  const int64_t D = input.size(-1);
+  const bool use_dropout = train && p > 0 && mask.numel() > 0;
+
+  // Recompute the pre-norm activation from the packed mask instead of
+  // saving it in the forward: unpacking bits is memory bound on 1/8th of
+  // the data and cheaper than carrying a full activation tensor through to
+  // the backward.
+  Tensor keep;
+  Tensor X;
+  if (use_dropout) {
+    auto shifts = at::arange(kFusedDropoutMaskBitsPerByte, mask.options());
+    keep = mask.unsqueeze(-1)
+               .bitwise_right_shift(shifts)
+               .bitwise_and(1)
+               .flatten(-2)
+               .narrow(-1, 0, D)
+               .to(input.scalar_type())
+               .reshape(input.sizes());
+    const double dropout_scale = 1.0 / (1.0 - p);
+    X = input.mul(keep).mul_(dropout_scale).add_(residual);
+  } else {
+    X = input.add(residual);
+  }
+
+  auto grads = at::native_layer_norm_backward(
+      grad_out,
+      X,
+      {D},
+      mean,
+      rstd,
+      gamma_opt,
+      beta_opt,
+      {true, gamma.defined(), beta.defined()});
+  Tensor dX = std::get<0>(grads);
+
+  Tensor grad_input =
+      use_dropout ? dX.mul(keep).mul_(1.0 / (1.0 - p)) : dX;
+
+  return std::make_tuple(
+      std::move(grad_input),
+      std::move(dX),
+      std::get<1>(grads),
+      std::get<2>(grads));
+}
+
+} // namespace native
+} // namespace at
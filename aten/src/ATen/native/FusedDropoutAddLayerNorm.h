@@ -0,0 +1,71 @@
+#pragma once
+
+#include <ATen/core/Tensor.h>
+#include <c10/util/Exception.h>
+
+#include <tuple>
+
+namespace at {
+namespace native {
+
+// The dropout mask of _fused_dropout_add_layer_norm is packed one bit per
+// element, with each row padded to a whole byte so no byte straddles two
+// rows (rows are produced by independent blocks on CUDA). A mask for M rows
+// of width D is therefore an [M, ceil(D / 8)] uint8 tensor; bit j % 8 of
+// byte [i, j / 8] is 1 when element [i, j] was kept.
+constexpr int64_t kFusedDropoutMaskBitsPerByte = 8;
+
+inline int64_t _fused_dropout_mask_bytes_per_row(int64_t D) {
+  return (D + kFusedDropoutMaskBitsPerByte - 1) / kFusedDropoutMaskBitsPerByte;
+}
+
+// Validates the inputs of _fused_dropout_add_layer_norm and returns
+// (number of rows, row width).
+inline std::tuple<int64_t, int64_t> _check_fused_dropout_add_layer_norm_inputs(
+    const Tensor& input,
+    const Tensor& residual,
+    const Tensor& gamma,
+    const Tensor& beta,
+    double p) {
+  TORCH_CHECK(
+      input.dim() >= 1,
+      "_fused_dropout_add_layer_norm: expected at least 1-D input");
+  TORCH_CHECK(
+      residual.sizes() == input.sizes(),
+      "_fused_dropout_add_layer_norm: residual shape ",
+      residual.sizes(),
+      " does not match input shape ",
+      input.sizes());
+  TORCH_CHECK(
+      residual.scalar_type() == input.scalar_type(),
+      "_fused_dropout_add_layer_norm: expected residual of type ",
+      input.scalar_type(),
+      " but got ",
+      residual.scalar_type());
+  TORCH_CHECK(
+      p >= 0 && p < 1,
+      "_fused_dropout_add_layer_norm: dropout probability has to be in [0, 1), got ",
+      p);
+  const int64_t D = input.size(-1);
+  for (const Tensor& param : {gamma, beta}) {
+    if (param.defined()) {
+      TORCH_CHECK(
+          param.dim() == 1 && param.size(0) == D,
+          "_fused_dropout_add_layer_norm: expected affine parameters of shape [",
+          D,
+          "], got ",
+          param.sizes());
+      TORCH_CHECK(
+          param.scalar_type() == input.scalar_type(),
+          "_fused_dropout_add_layer_norm: expected affine parameters of type ",
+          input.scalar_type(),
+          " but got ",
+          param.scalar_type());
+    }
+  }
+  const int64_t M = D == 0 ? 0 : input.numel() / D;
+  return std::make_tuple(M, D);
+}
+
+} // namespace native
+} // namespace at
@@ -0,0 +1,200 @@
+#define TORCH_ASSERT_ONLY_METHOD_OPERATORS
+#include <ATen/native/FusedEmbeddingLayerNorm.h>
+
+#include <ATen/AccumulateType.h>
+#include <ATen/Dispatch.h>
+#include <ATen/OpMathType.h>
+#include <ATen/Parallel.h>
+#include <ATen/core/Tensor.h>
+#include <c10/util/irange.h>
+
+#ifndef AT_PER_OPERATOR_HEADERS
+#include <ATen/Functions.h>
+#include <ATen/NativeFunctions.h>
+#else
+#include <ATen/ops/_fused_embedding_layer_norm_backward_native.h>
+#include <ATen/ops/_fused_embedding_layer_norm_native.h>
+#include <ATen/ops/embedding_dense_backward.h>
+#include <ATen/ops/empty.h>
+#include <ATen/ops/native_layer_norm_backward.h>
+#include <ATen/ops/zeros_like.h>
+#endif
+
+#include <cmath>
+#include <tuple>
+
+namespace at {
+namespace native {
+
+// Fused transformer input block: token embedding lookup, positional
+// embedding add and layer norm in a single pass. Unfused, this is three
+// dispatches and three trips over the activation memory; here each row is
+// gathered, summed and normalized while it is still cache hot. The
+// returned mean/rstd match native_layer_norm so the backward can be
+// composed from existing kernels.
+std::tuple<Tensor, Tensor, Tensor> fused_embedding_layer_norm_cpu(
+    const Tensor& weight,
+    const Tensor& pos_weight,
+    const Tensor& indices,
+    const c10::optional<Tensor>& gamma_opt,
+    const c10::optional<Tensor>& beta_opt,
+    double eps) {
+  c10::MaybeOwned<Tensor> gamma_maybe_owned =
+      at::borrow_from_optional_tensor(gamma_opt);
+  const Tensor& gamma = *gamma_maybe_owned;
+  c10::MaybeOwned<Tensor> beta_maybe_owned =
+      at::borrow_from_optional_tensor(beta_opt);
+  const Tensor& beta = *beta_maybe_owned;
+
+  auto N_S_D = _check_fused_embedding_layer_norm_inputs(
+      weight, pos_weight, indices, gamma, beta);
+  const int64_t N = std::get<0>(N_S_D);
+  const int64_t S = std::get<1>(N_S_D);
+  const int64_t D = std::get<2>(N_S_D);
+
+  auto weight_c = weight.expect_contiguous();
+  auto pos_weight_c = pos_weight.expect_contiguous();
+  auto indices_c = indices.expect_contiguous();
+  auto gamma_c = gamma.expect_contiguous();
+  auto beta_c = beta.expect_contiguous();
+
+  auto out_sizes = indices.sizes().vec();
+  out_sizes.push_back(D);
+  Tensor out = at::empty(out_sizes, weight.options());
+  Tensor mean = at::empty({N}, weight.options());
+  Tensor rstd = at::empty({N}, weight.options());
+
+  if (N > 0) {
+    const int64_t num_weights = weight.size(0);
+    AT_DISPATCH_INDEX_TYPES(
+        indices.scalar_type(), "fused_embedding_layer_norm_cpu_index", [&] {
+          AT_DISPATCH_FLOATING_TYPES_AND2(
+              kBFloat16,
+              kHalf,
+              weight.scalar_type(),
+              "fused_embedding_layer_norm_cpu",
+              [&] {
+                using opmath_t = at::opmath_type<scalar_t>;
+                const scalar_t* weight_data =
+                    weight_c->const_data_ptr<scalar_t>();
+                const scalar_t* pos_data =
+                    pos_weight_c->const_data_ptr<scalar_t>();
+                const index_t* indices_data =
+                    indices_c->const_data_ptr<index_t>();
+                const scalar_t* gamma_data =
+                    gamma.defined() ? gamma_c->const_data_ptr<scalar_t>()
+                                    : nullptr;
+                const scalar_t* beta_data = beta.defined()
+                    ? beta_c->const_data_ptr<scalar_t>()
+                    : nullptr;
+                scalar_t* out_data = out.mutable_data_ptr<scalar_t>();
+                scalar_t* mean_data = mean.mutable_data_ptr<scalar_t>();
+                scalar_t* rstd_data = rstd.mutable_data_ptr<scalar_t>();
+
+                at::parallel_for(0, N, 1, [&](int64_t begin, int64_t end) {
+                  for (const auto i : c10::irange(begin, end)) {
+                    const index_t idx = indices_data[i];
+                    TORCH_CHECK(
+                        idx >= 0 && idx < num_weights,
+                        "_fused_embedding_layer_norm: index out of range, got ",
+                        idx);
+                    const scalar_t* w_row = weight_data + idx * D;
+                    const scalar_t* p_row = pos_data + (i % S) * D;
+                    scalar_t* out_row = out_data + i * D;
+                    opmath_t sum = 0;
+                    opmath_t sum_sq = 0;
+                    for (const auto j : c10::irange(D)) {
+                      const opmath_t val = static_cast<opmath_t>(w_row[j]) +
+                          static_cast<opmath_t>(p_row[j]);
+                      out_row[j] = static_cast<scalar_t>(val);
+                      sum += val;
+                      sum_sq += val * val;
+                    }
+                    const opmath_t scale = opmath_t(1) / static_cast<opmath_t>(D);
+                    const opmath_t mean_val = sum * scale;
+                    opmath_t var = sum_sq * scale - mean_val * mean_val;
+                    var = var < opmath_t(0) ? opmath_t(0) : var;
+                    const opmath_t rstd_val =
+                        opmath_t(1) / std::sqrt(var + static_cast<opmath_t>(eps));
+                    for (const auto j : c10::irange(D)) {
+                      opmath_t val =
+                          (static_cast<opmath_t>(out_row[j]) - mean_val) *
+                          rstd_val;
+                      if (gamma_data != nullptr) {
+                        val *= static_cast<opmath_t>(gamma_data[j]);
+                      }
+                      if (beta_data != nullptr) {
+                        val += static_cast<opmath_t>(beta_data[j]);
+                      }
+                      out_row[j] = static_cast<scalar_t>(val);
+                    }
+                    mean_data[i] = static_cast<scalar_t>(mean_val);
+                    rstd_data[i] = static_cast<scalar_t>(rstd_val);
+                  }
+                });
+              });
+        });
+  }
+
+  // Stats are shaped like native_layer_norm's so the backward composes with
+  // native_layer_norm_backward.
+  auto stat_sizes = indices.sizes().vec();
+  stat_sizes.push_back(1);
+  return std::make_tuple(
+      std::move(out), mean.view(stat_sizes), rstd.view(stat_sizes));
+}
+
+std::tuple<Tensor, Tensor, Tensor, Tensor> fused_embedding_layer_norm_backward(
+    const Tensor& grad_out,
+    const Tensor& weight,
+    const Tensor& pos_weight,
+    const Tensor& indices,
+    const Tensor& mean,
+    const Tensor& rstd,
+    const c10::optional<Tensor>& gamma_opt,
+    const c10::optional<Tensor>& beta_opt) {
+  c10::MaybeOwned<Tensor> gamma_maybe_owned =
+      at::borrow_from_optional_tensor(gamma_opt);
+  const Tensor& gamma = *gamma_maybe_owned;
+  c10::MaybeOwned<Tensor> beta_maybe_owned =
+      at::borrow_from_optional_tensor(beta_opt);
+  const Tensor& beta = *beta_maybe_owned;
+
+  const int64_t S = indices.size(-1);
+  const int64_t D = weight.size(1);
+
+  // Recompute the pre-norm activation instead of saving it in the forward:
+  // the gather is memory bound and cheaper than carrying a full activation
+  // tensor through to the backward.
+  auto x_sizes = indices.sizes().vec();
+  x_sizes.push_back(D);
+  Tensor X = weight.index_select(0, indices.reshape({-1})).view(x_sizes) +
+      pos_weight.narrow(0, 0, S);
+
+  auto grads = at::native_layer_norm_backward(
+      grad_out,
+      X,
+      {D},
+      mean,
+      rstd,
+      gamma_opt,
+      beta_opt,
+      {true, gamma.defined(), beta.defined()});
+  const Tensor& dX = std::get<0>(grads);
+
+  Tensor grad_weight = at::embedding_dense_backward(
+      dX, indices, weight.size(0), /*padding_idx=*/-1,
+      /*scale_grad_by_freq=*/false);
+
+  Tensor grad_pos = at::zeros_like(pos_weight);
+  grad_pos.narrow(0, 0, S).copy_(dX.reshape({-1, S, D}).sum(0));
+
+  return std::make_tuple(
+      std::move(grad_weight),
+      std::move(grad_pos),
+      std::get<1>(grads),
+      std::get<2>(grads));
+}
+
+} // namespace native
+} // namespace at
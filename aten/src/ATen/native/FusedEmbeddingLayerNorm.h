@@ -0,0 +1,78 @@
+#pragma once
+
+#include <ATen/core/Tensor.h>
+#include <c10/util/Exception.h>
+
+#include <tuple>
+
+namespace at {
+namespace native {
+
+// Validates the inputs of _fused_embedding_layer_norm and returns
+// (number of rows, sequence length, embedding dim).
+inline std::tuple<int64_t, int64_t, int64_t>
+_check_fused_embedding_layer_norm_inputs(
+    const Tensor& weight,
+    const Tensor& pos_weight,
+    const Tensor& indices,
+    const Tensor& gamma,
+    const Tensor& beta) {
+  TORCH_CHECK(
+      weight.dim() == 2,
+      "_fused_embedding_layer_norm: expected 2-D embedding weight, got ",
+      weight.dim(),
+      "-D");
+  TORCH_CHECK(
+      pos_weight.dim() == 2,
+      "_fused_embedding_layer_norm: expected 2-D positional weight, got ",
+      pos_weight.dim(),
+      "-D");
+  const int64_t D = weight.size(1);
+  TORCH_CHECK(
+      pos_weight.size(1) == D,
+      "_fused_embedding_layer_norm: positional embedding dim ",
+      pos_weight.size(1),
+      " does not match embedding dim ",
+      D);
+  TORCH_CHECK(
+      pos_weight.scalar_type() == weight.scalar_type(),
+      "_fused_embedding_layer_norm: expected positional weight of type ",
+      weight.scalar_type(),
+      " but got ",
+      pos_weight.scalar_type());
+  TORCH_CHECK(
+      indices.dim() >= 1,
+      "_fused_embedding_layer_norm: expected at least 1-D indices");
+  TORCH_CHECK(
+      isIntegralType(indices.scalar_type(), /*includeBool=*/false),
+      "_fused_embedding_layer_norm: expected integral indices, got ",
+      indices.scalar_type());
+  const int64_t S = indices.size(-1);
+  TORCH_CHECK(
+      S <= pos_weight.size(0),
+      "_fused_embedding_layer_norm: sequence length ",
+      S,
+      " exceeds the ",
+      pos_weight.size(0),
+      " available positional embeddings");
+  for (const Tensor& param : {gamma, beta}) {
+    if (param.defined()) {
+      TORCH_CHECK(
+          param.dim() == 1 && param.size(0) == D,
+          "_fused_embedding_layer_norm: expected affine parameters of shape [",
+          D,
+          "], got ",
+          param.sizes());
+      TORCH_CHECK(
+          param.scalar_type() == weight.scalar_type(),
+          "_fused_embedding_layer_norm: expected affine parameters of type ",
+          weight.scalar_type(),
+          " but got ",
+          param.scalar_type());
+    }
+  }
+  return std::make_tuple(indices.numel(), S, D);
+}
+
+} // namespace native
+} // namespace at
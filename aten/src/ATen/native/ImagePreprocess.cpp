@@ -0,0 +1,100 @@
+#define TORCH_ASSERT_ONLY_METHOD_OPERATORS
+#include <ATen/core/Tensor.h>
+#include <ATen/Parallel.h>
+
+#ifndef AT_PER_OPERATOR_HEADERS
+#include <ATen/Functions.h>
+#include <ATen/NativeFunctions.h>
+#else
+#include <ATen/ops/_fused_image_preprocess_native.h>
+#include <ATen/ops/empty.h>
+#include <ATen/ops/upsample_bilinear2d.h>
+#endif
+
+namespace at::native {
+
+// Fused crop -> resize -> normalize for batched image preprocessing.
+//
+// Takes a list of uint8 HWC images (the natural layout of decoded JPEGs),
+// applies the same crop box to each, resizes with bilinear interpolation and
+// writes the normalized float result directly into one channels-last batch,
+// optionally allocated in pinned memory for overlap-friendly H2D copies.
+// Images are processed in parallel; the resize itself stays on the uint8
+// AVX paths of UpSampleKernel.cpp (matching PIL's uint8 arithmetic) and each
+// worker's nested kernels run serially inside the outer parallel region, so
+// parallelism is across images rather than within one.
+Tensor fused_image_preprocess_cpu(
+    TensorList images,
+    int64_t top,
+    int64_t left,
+    int64_t crop_height,
+    int64_t crop_width,
+    int64_t output_height,
+    int64_t output_width,
+    const Tensor& mean,
+    const Tensor& std,
+    bool pin_memory) {
+  const auto num_images = static_cast<int64_t>(images.size());
+  TORCH_CHECK(num_images > 0,
+              "_fused_image_preprocess: expected at least one image");
+  TORCH_CHECK(crop_height > 0 && crop_width > 0,
+              "_fused_image_preprocess: crop size must be positive, got (",
+              crop_height, ", ", crop_width, ")");
+  TORCH_CHECK(output_height > 0 && output_width > 0,
+              "_fused_image_preprocess: output size must be positive, got (",
+              output_height, ", ", output_width, ")");
+
+  const auto channels = images[0].dim() == 3 ? images[0].size(2) : -1;
+  for (const auto i : c10::irange(images.size())) {
+    const auto& img = images[i];
+    TORCH_CHECK(img.dim() == 3 && img.size(2) == channels,
+                "_fused_image_preprocess: expected HWC images with ", channels,
+                " channels, but image ", i, " has shape ", img.sizes());
+    TORCH_CHECK(img.scalar_type() == kByte,
+                "_fused_image_preprocess: expected uint8 images, but image ",
+                i, " has dtype ", img.scalar_type());
+    TORCH_CHECK(top >= 0 && left >= 0 &&
+                top + crop_height <= img.size(0) &&
+                left + crop_width <= img.size(1),
+                "_fused_image_preprocess: crop box [", top, ":",
+                top + crop_height, ", ", left, ":", left + crop_width,
+                "] out of bounds for image ", i, " with shape ", img.sizes());
+  }
+  TORCH_CHECK(mean.numel() == channels && std.numel() == channels,
+              "_fused_image_preprocess: mean and std must have one value per "
+              "channel (", channels, "), got ", mean.numel(), " and ",
+              std.numel());
+
+  auto out = at::empty(
+      {num_images, channels, output_height, output_width},
+      images[0].options().dtype(kFloat).pinned_memory(pin_memory),
+      MemoryFormat::ChannelsLast);
+
+  // Fold the normalization into one multiply-add per element
+  auto inv_std = std.to(kFloat).reciprocal().reshape({1, channels, 1, 1});
+  auto mean_v = mean.to(kFloat).reshape({1, channels, 1, 1});
+
+  at::parallel_for(0, num_images, 1, [&](int64_t begin, int64_t end) {
+    for (const auto i : c10::irange(begin, end)) {
+      const auto& img = images[i];
+      auto crop = img.slice(0, top, top + crop_height)
+                     .slice(1, left, left + crop_width);
+      // A permuted HWC image is exactly a channels-last 1CHW tensor, so no
+      // data movement happens before the resize
+      auto chw = crop.permute({2, 0, 1}).unsqueeze(0);
+      auto out_slice = out.narrow(0, i, 1);
+      if (crop_height == output_height && crop_width == output_width) {
+        out_slice.copy_(chw);
+      } else {
+        out_slice.copy_(at::upsample_bilinear2d(
+            chw, {output_height, output_width}, /*align_corners=*/false,
+            c10::nullopt, c10::nullopt));
+      }
+      out_slice.sub_(mean_v).mul_(inv_std);
+    }
+  });
+
+  return out;
+}
+
+} // namespace at::native
@@ -17,9 +17,17 @@
 #include <ATen/native/ReduceOps.h>
 #include <ATen/native/ReduceOpsUtils.h>
 #include <ATen/native/Resize.h>
+#include <ATen/native/cpu/int_mm_kernel.h>
 #include <ATen/native/mkldnn/Matmul.h>
+#include <c10/core/impl/DeviceGuardImplInterface.h>
 #include <c10/util/accumulate.h>
+#include <c10/util/hash.h>
 #include <c10/util/irange.h>
+
+#include <chrono>
+#include <cstdlib>
+#include <mutex>
+#include <unordered_map>
 #include <variant>
 
 #ifndef AT_PER_OPERATOR_HEADERS
@@ -28,6 +36,9 @@
 #else
 #include <ATen/ops/_addmm_activation_native.h>
 #include <ATen/ops/_compute_linear_combination_native.h>
+#include <ATen/ops/_convert_weight_to_int4pack_native.h>
+#include <ATen/ops/_weight_int4pack_mm_native.h>
+#include <ATen/ops/_weight_int8pack_mm_native.h>
 #include <ATen/ops/_linalg_check_errors.h>
 #include <ATen/ops/_linalg_det.h>
 #include <ATen/ops/_linalg_det_native.h>
@@ -1897,6 +1908,135 @@ Tensor& vdot_out(const Tensor& self, const Tensor& other, Tensor& result) {
   return result.fill_(self.vdot(other));
 }
 
+/* Note [matmul lowering autotune]
+ * For an ND @ 2D matmul, should_fold below statically prefers folding the
+ * batch into the leading gemm dimension. That is usually right, but for
+ * some shapes (e.g. large batches of small square matrices) the batched
+ * bmm lowering measures faster. When PYTORCH_MATMUL_AUTOTUNE=1, the first
+ * call for a given (shape bucket, dtype, device) times both lowerings on
+ * detached inputs and caches the winner in a process-wide table -
+ * analogous to cuDNN benchmark mode, but for the matmul decomposition.
+ * Sizes are bucketed to the next power of two so that nearby dynamic
+ * shapes share an entry. Only cases where the choice is purely about
+ * performance participate: when the 2D operand requires grad, folding
+ * also bounds backward memory (see should_fold) and is kept.
+ */
+namespace {
+
+bool matmul_autotune_enabled() {
+  static const bool enabled = []() {
+    const char* env = std::getenv("PYTORCH_MATMUL_AUTOTUNE");
+    return env != nullptr && env[0] == '1';
+  }();
+  return enabled;
+}
+
+// True when flipping the fold lowering to bmm changes performance only:
+// an ND @ 2D product of non-empty tensors with no autograd or subclass
+// involvement.
+bool can_autotune_matmul_lowering(const Tensor& tensor1, const Tensor& tensor2) {
+  if (!matmul_autotune_enabled()) {
+    return false;
+  }
+  if (tensor1.dim() < 3 || tensor2.dim() != 2) {
+    return false;
+  }
+  if (tensor1.numel() == 0 || tensor2.numel() == 0) {
+    return false;
+  }
+  if (tensor1.requires_grad() || tensor2.requires_grad()) {
+    return false;
+  }
+  return !isTensorSubclassLike(tensor1) && !isTensorSubclassLike(tensor2);
+}
+
+uint64_t matmul_lowering_cache_key(const Tensor& tensor1, const Tensor& tensor2) {
+  auto bucket = [](int64_t size) -> size_t {
+    size_t b = 1;
+    while (b < static_cast<size_t>(size)) {
+      b <<= 1;
+    }
+    return b;
+  };
+  size_t seed = c10::hash_combine(
+      static_cast<size_t>(tensor1.device().type()),
+      static_cast<size_t>(tensor1.device().index() + 1));
+  seed = c10::hash_combine(seed, static_cast<size_t>(tensor1.scalar_type()));
+  for (auto size : tensor1.sizes()) {
+    seed = c10::hash_combine(seed, bucket(size));
+  }
+  // Separates the two shapes so ([a, b], [c]) != ([a], [b, c])
+  seed = c10::hash_combine(seed, 0x9e3779b9);
+  for (auto size : tensor2.sizes()) {
+    seed = c10::hash_combine(seed, bucket(size));
+  }
+  return seed;
+}
+
+void synchronize_matmul_device(const at::Device& device) {
+  if (device.is_cpu()) {
+    return;
+  }
+  const auto* impl = c10::impl::getDeviceGuardImpl(device.type());
+  impl->synchronizeStream(impl->getStream(device));
+}
+
+template <typename F>
+double time_matmul_candidate(const F& fn, const at::Device& device) {
+  constexpr int kTimedIters = 2;
+  // One warm-up run also populates allocator caches.
+  fn();
+  synchronize_matmul_device(device);
+  const auto start = std::chrono::steady_clock::now();
+  for (const auto i : c10::irange(kTimedIters)) {
+    (void)i;
+    fn();
+  }
+  synchronize_matmul_device(device);
+  return std::chrono::duration<double>(std::chrono::steady_clock::now() - start)
+      .count();
+}
+
+// Returns true when the bmm lowering measured faster than the folded gemm
+// for this shape bucket. The first call per bucket runs both candidates.
+bool bmm_lowering_wins(const Tensor& tensor1, const Tensor& tensor2) {
+  static std::mutex cache_mutex;
+  static std::unordered_map<uint64_t, bool> cache;
+  const uint64_t key = matmul_lowering_cache_key(tensor1, tensor2);
+  {
+    const std::lock_guard<std::mutex> lock(cache_mutex);
+    const auto it = cache.find(key);
+    if (it != cache.end()) {
+      return it->second;
+    }
+  }
+
+  // Benchmarks on detached tensors; eligibility guarantees no autograd
+  // graph is involved.
+  const auto t1 = tensor1.detach();
+  const auto t2 = tensor2.detach();
+  const auto sizes1 = t1.sizes();
+  const int64_t m1 = sizes1.back();
+  const int64_t n = sizes1.cend()[-2];
+  const int64_t p = t2.size(1);
+  const int64_t batch =
+      c10::multiply_integers(sizes1.begin(), sizes1.end() - 2);
+
+  const auto fold_time = time_matmul_candidate(
+      [&]() { auto out = t1.reshape({batch * n, m1}).mm(t2); }, t1.device());
+  const auto t1_batched = t1.reshape({batch, n, m1});
+  const auto t2_batched = t2.unsqueeze(0).expand({batch, m1, p});
+  const auto bmm_time = time_matmul_candidate(
+      [&]() { auto out = t1_batched.bmm(t2_batched); }, t1.device());
+
+  const bool bmm_wins = bmm_time < fold_time;
+  const std::lock_guard<std::mutex> lock(cache_mutex);
+  cache.emplace(key, bmm_wins);
+  return bmm_wins;
+}
+
+} // namespace
+
 static bool should_fold(const Tensor& tensor1, const Tensor& tensor2) {
   // We check that we can fold the larger tensor into a matrix and dispatch to mm or mv rather than
   // to bmm. We want to make sure we can do so without incurring in any extra copy
@@ -1994,7 +2134,12 @@ static Tensor _matmul_impl(
                    : tensor1.unsqueeze(0).mm(tensor2).squeeze_(0);
   } else if (dim_tensor1 == 2 && dim_tensor2 == 2) {
     return has_out ? at::mm_out(out, tensor1, tensor2) : tensor1.mm(tensor2);
-  } else if (should_fold(tensor1, tensor2)) {
+  } else if (should_fold(tensor1, tensor2) &&
+             !(can_autotune_matmul_lowering(tensor1, tensor2) &&
+               bmm_lowering_wins(tensor1, tensor2))) {
+    // See Note [matmul lowering autotune]: when enabled and the choice is
+    // purely about performance, a measured bmm win routes this call to the
+    // batched lowering below instead.
     // dim_tensor1 >=3 && (dim_tensor2 == 1 || dim_tensor2 == 2) ||
     // dim_tensor2 >=3 && (dim_tensor1 == 1 || dim_tensor1 == 2)
     // and at least one of the following two conditions hold
@@ -3350,5 +3495,111 @@ Tensor kron(const Tensor& self, const Tensor& other) {
   return KronImpl(self, other).kron();
 }
 
+DEFINE_DISPATCH(int4pack_mm_stub);
+DEFINE_DISPATCH(int8pack_mm_stub);
+
+// Packs a [N, K] int32 tensor holding 4-bit values (0..15) into a
+// [N, K / 2] uint8 tensor, two values per byte with the even column in the
+// high nibble. innerKTiles is accepted for API parity with the CUDA packing
+// but does not affect the CPU layout.
+Tensor _convert_weight_to_int4pack_cpu(const Tensor& in, int64_t innerKTiles) {
+  TORCH_CHECK(in.dim() == 2, __func__, " : expect weight to be 2D tensor.");
+  TORCH_CHECK(in.dtype() == at::kInt, __func__, " : expect weight to be kInt.");
+  TORCH_CHECK(in.is_contiguous(), __func__, " : expect weight to be contiguous.");
+  TORCH_CHECK(innerKTiles == 2 || innerKTiles == 4 || innerKTiles == 8,
+      __func__, " : innerKTiles need to be 2, 4, or 8, got ", innerKTiles);
+
+  const int64_t N = in.size(0);
+  const int64_t K = in.size(1);
+  TORCH_CHECK(K % 2 == 0, __func__, " : expect K to be even, got ", K);
+
+  auto weight_packed = at::empty({N, K / 2}, in.options().dtype(at::kByte));
+  const int32_t* in_data = in.const_data_ptr<int32_t>();
+  uint8_t* out_data = weight_packed.mutable_data_ptr<uint8_t>();
+
+  at::parallel_for(0, N, 1, [&](int64_t begin, int64_t end) {
+    for (const auto n : c10::irange(begin, end)) {
+      const int32_t* row = in_data + n * K;
+      uint8_t* packed_row = out_data + n * (K / 2);
+      for (const auto k : c10::irange(K / 2)) {
+        packed_row[k] = static_cast<uint8_t>(
+            ((row[2 * k] & 0xF) << 4) | (row[2 * k + 1] & 0xF));
+      }
+    }
+  });
+  return weight_packed;
+}
+
+Tensor _weight_int4pack_mm_cpu(
+    const Tensor& A,
+    const Tensor& B,
+    int64_t qGroupSize,
+    const Tensor& qScaleAndZeros) {
+  const int64_t M = A.size(0);
+  const int64_t N = B.size(0);
+  const int64_t K = A.size(1);
+
+  TORCH_CHECK(A.dtype() == kBFloat16 || A.dtype() == kHalf || A.dtype() == kFloat,
+      __func__, " : expect A to be either 32-bit or 16-bit float tensor.");
+  TORCH_CHECK(A.dim() == 2, __func__, " : expect A to be 2D tensor.");
+  TORCH_CHECK(A.is_contiguous(), __func__, " : expect A to be contiguous.");
+
+  TORCH_CHECK(B.dtype() == at::kByte, __func__, " : expect B to be uint8 tensor.");
+  TORCH_CHECK(B.dim() == 2, __func__, " : expect B to be 2D tensor.");
+  TORCH_CHECK(B.is_contiguous(), __func__, " : expect B to be contiguous.");
+  TORCH_CHECK(B.size(1) == K / 2, __func__,
+      " : expect B.size(1) to be ", K / 2, ", got ", B.size(1));
+
+  TORCH_CHECK(qGroupSize == 32 || qGroupSize == 64 || qGroupSize == 128 ||
+      qGroupSize == 256,
+      __func__, " : expect qGroupSize to be 32, 64, 128 or 256, got ", qGroupSize);
+  TORCH_CHECK(K % qGroupSize == 0, __func__,
+      " : expect K to be divisible by qGroupSize, got K:", K,
+      ", qGroupSize:", qGroupSize);
+
+  TORCH_CHECK(qScaleAndZeros.dim() == 3 &&
+      qScaleAndZeros.size(0) == K / qGroupSize && qScaleAndZeros.size(1) == N &&
+      qScaleAndZeros.size(2) == 2,
+      __func__, " : expect qScaleAndZeros to be 3D tensor of shape [",
+      K / qGroupSize, ", ", N, ", 2]");
+  TORCH_CHECK(qScaleAndZeros.dtype() == A.dtype(), __func__,
+      " : expect qScaleAndZeros to have the same dtype as A.");
+  TORCH_CHECK(qScaleAndZeros.is_contiguous(), __func__,
+      " : expect qScaleAndZeros to be contiguous.");
+
+  auto C = at::empty({M, N}, A.options());
+  int4pack_mm_stub(kCPU, C, A, B, qGroupSize, qScaleAndZeros);
+  return C;
+}
+
+Tensor _weight_int8pack_mm_cpu(
+    const Tensor& A,
+    const Tensor& B,
+    const Tensor& scales) {
+  const int64_t M = A.size(0);
+  const int64_t N = B.size(0);
+  const int64_t K = A.size(1);
+
+  TORCH_CHECK(A.dtype() == kBFloat16 || A.dtype() == kHalf || A.dtype() == kFloat,
+      __func__, " : expect A to be either 32-bit or 16-bit float tensor.");
+  TORCH_CHECK(A.dim() == 2, __func__, " : expect A to be 2D tensor.");
+  TORCH_CHECK(A.is_contiguous(), __func__, " : expect A to be contiguous.");
+
+  TORCH_CHECK(B.dtype() == at::kChar, __func__, " : expect B to be int8 tensor.");
+  TORCH_CHECK(B.dim() == 2, __func__, " : expect B to be 2D tensor.");
+  TORCH_CHECK(B.is_contiguous(), __func__, " : expect B to be contiguous.");
+  TORCH_CHECK(B.size(1) == K, __func__,
+      " : expect B.size(1) == ", K, ", got ", B.size(1));
+
+  TORCH_CHECK(scales.dim() == 1 && scales.size(0) == N, __func__,
+      " : expect scales to be 1D tensor with size ", N);
+  TORCH_CHECK(scales.dtype() == A.dtype(), __func__,
+      " : expect scales to have the same dtype as A.");
+
+  auto C = at::empty({M, N}, A.options());
+  int8pack_mm_stub(kCPU, C, A, B, scales);
+  return C;
+}
+
 } // namespace native
 } // namespace at
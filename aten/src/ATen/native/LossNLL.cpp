@@ -1,5 +1,6 @@
 #define TORCH_ASSERT_ONLY_METHOD_OPERATORS
 #include <ATen/core/Tensor.h>
+#include <ATen/AccumulateType.h>
 #include <ATen/Dispatch.h>
 #include <ATen/Parallel.h>
 #include <ATen/TensorIndexing.h>
@@ -15,8 +16,11 @@
 #include <ATen/Functions.h>
 #include <ATen/NativeFunctions.h>
 #else
+#include <ATen/ops/_fused_linear_cross_entropy_backward_native.h>
+#include <ATen/ops/_fused_linear_cross_entropy_native.h>
 #include <ATen/ops/cross_entropy_loss_native.h>
 #include <ATen/ops/empty.h>
+#include <ATen/ops/linear.h>
 #include <ATen/ops/log_softmax.h>
 #include <ATen/ops/nll_loss.h>
 #include <ATen/ops/nll_loss2d.h>
@@ -31,6 +35,8 @@
 #include <c10/core/TensorOptions.h>
 #include <c10/util/irange.h>
 
+#include <algorithm>
+#include <limits>
 #include <utility>
 
 namespace at {
@@ -742,5 +748,166 @@ Tensor nll_loss_nd_symint(
   return ret;
 }
 
+// Chunked fused output-projection + cross-entropy.  For large-vocabulary
+// language models the [N, V] logit tensor produced just to feed
+// cross_entropy_loss dominates peak activation memory.  This op computes
+// logits one vocab chunk at a time from the hidden states and the projection
+// weight, maintaining an online logsumexp (running max / scaled sum of
+// exponentials per row) plus the logit of each row's target class, so peak
+// memory is O(N * chunk_size) instead of O(N * V).  Only the per-row
+// logsumexp is saved for the backward, which recomputes each chunk's logits
+// and accumulates the three gradients in place.
+std::tuple<Tensor, Tensor> fused_linear_cross_entropy(
+    const Tensor& input,
+    const Tensor& weight,
+    const c10::optional<Tensor>& bias_opt,
+    const Tensor& target,
+    int64_t reduction,
+    int64_t ignore_index,
+    int64_t chunk_size) {
+  // See [Note: hacky wrapper removal for optional tensor]
+  c10::MaybeOwned<Tensor> bias_maybe_owned =
+      at::borrow_from_optional_tensor(bias_opt);
+  const Tensor& bias = *bias_maybe_owned;
+
+  TORCH_CHECK(
+      input.dim() == 2,
+      "_fused_linear_cross_entropy: expected 2-D input, got ",
+      input.dim(),
+      "-D");
+  TORCH_CHECK(
+      weight.dim() == 2 && weight.size(1) == input.size(1),
+      "_fused_linear_cross_entropy: expected weight of shape [num_classes, ",
+      input.size(1),
+      "], got ",
+      weight.sizes());
+  TORCH_CHECK(
+      target.dim() == 1 && target.size(0) == input.size(0),
+      "_fused_linear_cross_entropy: expected 1-D target of length ",
+      input.size(0),
+      ", got ",
+      target.sizes());
+  TORCH_CHECK(
+      target.scalar_type() == kLong,
+      "_fused_linear_cross_entropy: expected target dtype Long, got ",
+      target.scalar_type());
+  TORCH_CHECK(
+      !bias.defined() ||
+          (bias.dim() == 1 && bias.size(0) == weight.size(0)),
+      "_fused_linear_cross_entropy: expected 1-D bias of length ",
+      weight.size(0));
+  TORCH_CHECK(
+      chunk_size > 0,
+      "_fused_linear_cross_entropy: chunk_size must be positive, got ",
+      chunk_size);
+
+  const int64_t N = input.size(0);
+  const int64_t V = weight.size(0);
+  const auto acc_type = toAccumulateType(input.scalar_type(), input.is_cuda());
+
+  Tensor running_max = input.new_full(
+      {N},
+      -std::numeric_limits<double>::infinity(),
+      input.options().dtype(acc_type));
+  Tensor running_sum = input.new_zeros({N}, input.options().dtype(acc_type));
+  Tensor target_logit = input.new_zeros({N}, input.options().dtype(acc_type));
+
+  for (int64_t v0 = 0; v0 < V; v0 += chunk_size) {
+    const int64_t c = std::min(chunk_size, V - v0);
+    auto w_chunk = weight.narrow(0, v0, c);
+    Tensor logits = bias.defined()
+        ? at::linear(input, w_chunk, bias.narrow(0, v0, c))
+        : at::linear(input, w_chunk);
+
+    // Online logsumexp: rescale the running sum to the new max before adding
+    // this chunk's contribution.
+    Tensor new_max =
+        running_max.maximum(std::get<0>(logits.max(1)).to(acc_type));
+    running_sum = running_sum * (running_max - new_max).exp_() +
+        (logits - new_max.unsqueeze(1)).exp_().sum(1);
+    running_max = std::move(new_max);
+
+    // Pick up the target logits that fall inside this chunk.  Clamping keeps
+    // the gather index valid for rows whose target lies elsewhere (including
+    // ignore_index rows); their gathered value is discarded by the where.
+    auto in_chunk = target.ge(v0).logical_and_(target.lt(v0 + c));
+    auto local_t = (target - v0).clamp(0, c - 1);
+    target_logit = logits.gather(1, local_t.unsqueeze(1))
+                       .squeeze(1)
+                       .to(acc_type)
+                       .where(in_chunk, target_logit);
+  }
+
+  Tensor lse = running_max + running_sum.log_();
+  auto valid = target.ne(ignore_index);
+  Tensor losses = (lse - target_logit) * valid.to(acc_type);
+  Tensor loss;
+  if (reduction == Reduction::Mean) {
+    loss = losses.sum() / valid.sum().to(acc_type);
+  } else if (reduction == Reduction::Sum) {
+    loss = losses.sum();
+  } else {
+    loss = std::move(losses);
+  }
+  return std::make_tuple(loss.to(input.scalar_type()), std::move(lse));
+}
+
+std::tuple<Tensor, Tensor, Tensor> fused_linear_cross_entropy_backward(
+    const Tensor& grad_out,
+    const Tensor& input,
+    const Tensor& weight,
+    const c10::optional<Tensor>& bias_opt,
+    const Tensor& target,
+    const Tensor& logsumexp,
+    int64_t reduction,
+    int64_t ignore_index,
+    int64_t chunk_size) {
+  // See [Note: hacky wrapper removal for optional tensor]
+  c10::MaybeOwned<Tensor> bias_maybe_owned =
+      at::borrow_from_optional_tensor(bias_opt);
+  const Tensor& bias = *bias_maybe_owned;
+
+  const int64_t V = weight.size(0);
+  const auto acc_type = logsumexp.scalar_type();
+
+  // Per-row upstream gradient: zero for ignored rows, divided by the number
+  // of participating rows under mean reduction.
+  auto valid = target.ne(ignore_index);
+  Tensor grad_rows = grad_out.to(acc_type);
+  if (reduction == Reduction::Mean) {
+    grad_rows = grad_rows / valid.sum().to(acc_type);
+  }
+  grad_rows = grad_rows * valid.to(acc_type);
+
+  Tensor grad_input = input.new_zeros(input.sizes());
+  Tensor grad_weight = weight.new_zeros(weight.sizes());
+  Tensor grad_bias = bias.defined() ? bias.new_zeros(bias.sizes()) : Tensor();
+
+  for (int64_t v0 = 0; v0 < V; v0 += chunk_size) {
+    const int64_t c = std::min(chunk_size, V - v0);
+    auto w_chunk = weight.narrow(0, v0, c);
+    Tensor logits = bias.defined()
+        ? at::linear(input, w_chunk, bias.narrow(0, v0, c))
+        : at::linear(input, w_chunk);
+
+    // d loss / d logits = softmax(logits) - onehot(target), per row.
+    Tensor p = (logits - logsumexp.unsqueeze(1)).exp_();
+    auto in_chunk = target.ge(v0).logical_and_(target.lt(v0 + c));
+    auto local_t = (target - v0).clamp(0, c - 1);
+    p.scatter_add_(
+        1, local_t.unsqueeze(1), in_chunk.to(acc_type).neg_().unsqueeze(1));
+    p.mul_(grad_rows.unsqueeze(1));
+
+    Tensor p_cast = p.to(input.scalar_type());
+    grad_input.addmm_(p_cast, w_chunk);
+    grad_weight.narrow(0, v0, c).addmm_(p_cast.t(), input);
+    if (grad_bias.defined()) {
+      grad_bias.narrow(0, v0, c).add_(p_cast.sum(0));
+    }
+  }
+  return std::make_tuple(
+      std::move(grad_input), std::move(grad_weight), std::move(grad_bias));
+}
+
 } // namespace native
 } // namespace at
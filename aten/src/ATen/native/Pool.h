@@ -17,6 +17,13 @@ using max_pool2d_backward_fn = void(*)(const Tensor& grad_input, const Tensor& g
 DECLARE_DISPATCH(max_pool2d_fn, max_pool2d_kernel);
 DECLARE_DISPATCH(max_pool2d_backward_fn, max_pool2d_backward_kernel);
 
+// max pooling without the indices output (inference fast path), with an
+// optional relu fused into the final store
+using max_pool2d_no_indices_fn = void(*)(const Tensor& output, const Tensor& input,
+    int kW, int kH, int dW, int dH, int padW, int padH, int dilationW, int dilationH, bool fuse_relu);
+
+DECLARE_DISPATCH(max_pool2d_no_indices_fn, max_pool2d_no_indices_kernel);
+
 // averge pooling has same signature for forward and backward
 using avg_pool2d_fn = void(*)(const Tensor& output, const Tensor& input, int64_t kW, int64_t kH,
     int64_t dW, int64_t dH, int64_t padW, int64_t padH, bool count_include_pad, c10::optional<int64_t> divisor_override);
@@ -32,6 +39,16 @@ using max_pool3d_backward_fn = void(*)(Tensor& grad_input, const Tensor& grad_ou
 
 DECLARE_DISPATCH(max_pool3d_fn, max_pool3d_kernel);
 DECLARE_DISPATCH(max_pool3d_backward_fn, max_pool3d_backward_kernel);
+
+using avg_pool3d_fn = void(*)(const Tensor& output, const Tensor& input,
+    int64_t kW, int64_t kH, int64_t kD, int64_t dW, int64_t dH, int64_t dD,
+    int64_t padW, int64_t padH, int64_t padD, bool count_include_pad, c10::optional<int64_t> divisor_override);
+using avg_pool3d_backward_fn = void(*)(const Tensor& grad_input, const Tensor& grad_output,
+    int kW, int kH, int kD, int dW, int dH, int dD,
+    int padW, int padH, int padD, bool count_include_pad, c10::optional<int64_t> divisor_override);
+
+DECLARE_DISPATCH(avg_pool3d_fn, avg_pool3d_kernel);
+DECLARE_DISPATCH(avg_pool3d_backward_fn, avg_pool3d_backward_kernel);
 namespace {
 
 template <typename dest_t, typename src_t>
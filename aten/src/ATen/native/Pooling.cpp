@@ -2,6 +2,10 @@
 #include <ATen/core/Tensor.h>
 #include <ATen/TensorUtils.h>
 #include <ATen/NamedTensorUtils.h>
+#include <ATen/TensorSubclassLikeUtils.h>
+#include <ATen/core/grad_mode.h>
+#include <ATen/native/DispatchStub.h>
+#include <ATen/native/Pool.h>
 #include <ATen/native/xnnpack/Engine.h>
 #include <c10/util/Exception.h>
 
@@ -15,7 +19,10 @@
 #include <ATen/ops/adaptive_max_pool2d.h>
 #include <ATen/ops/avg_pool1d_native.h>
 #include <ATen/ops/avg_pool2d.h>
+#include <ATen/ops/empty.h>
 #include <ATen/ops/max_pool1d_with_indices_native.h>
+#include <ATen/ops/_max_pool2d_relu_native.h>
+#include <ATen/ops/max_pool2d.h>
 #include <ATen/ops/max_pool2d_native.h>
 #include <ATen/ops/max_pool2d_with_indices.h>
 #include <ATen/ops/max_pool3d_native.h>
@@ -24,12 +31,103 @@
 #include <ATen/ops/mkldnn_max_pool3d.h>
 #include <ATen/ops/quantized_max_pool2d.h>
 #include <ATen/ops/quantized_max_pool3d.h>
+#include <ATen/ops/relu.h>
 #endif
 
 #include <tuple>
 
 namespace at { namespace native {
 
+DEFINE_DISPATCH(max_pool2d_no_indices_kernel);
+
+namespace {
+
+// True when max_pool2d can skip computing the indices tensor: inference on
+// a plain CPU tensor. The backward formula scatters through the indices,
+// so autograd and forward-grad cases keep using max_pool2d_with_indices.
+bool can_use_max_pool2d_no_indices(const Tensor& self) {
+  return !((self.requires_grad() && at::GradMode::is_enabled()) ||
+           self._fw_grad(/*level */ 0).defined() ||
+           !self.device().is_cpu() ||
+           isTensorSubclassLike(self));
+}
+
+// Parameter expansion and shape checks mirror
+// TORCH_META_FUNC(max_pool2d_with_indices), minus the indices output.
+Tensor max_pool2d_no_indices_impl(
+    const Tensor& self,
+    IntArrayRef kernel_size,
+    IntArrayRef stride,
+    IntArrayRef padding,
+    IntArrayRef dilation,
+    bool ceil_mode,
+    bool fuse_relu) {
+  TORCH_CHECK(kernel_size.size() == 1 || kernel_size.size() == 2,
+    "max_pool2d: kernel_size must either be a single int, or a tuple of two ints")
+  const int kH = safe_downcast<int, int64_t>(kernel_size[0]);
+  const int kW = kernel_size.size() == 1 ? kH : safe_downcast<int, int64_t>(kernel_size[1]);
+
+  TORCH_CHECK(stride.empty() || stride.size() == 1 || stride.size() == 2,
+    "max_pool2d: stride must either be omitted, a single int, or a tuple of two ints")
+  const int dH = stride.empty() ? kH : safe_downcast<int, int64_t>(stride[0]);
+  const int dW = stride.empty() ? kW :
+                 stride.size() == 1 ? dH : safe_downcast<int, int64_t>(stride[1]);
+
+  TORCH_CHECK(padding.size() == 1 || padding.size() == 2,
+    "max_pool2d: padding must either be a single int, or a tuple of two ints");
+  const int padH = safe_downcast<int, int64_t>(padding[0]);
+  const int padW = padding.size() == 1 ? padH : safe_downcast<int, int64_t>(padding[1]);
+
+  TORCH_CHECK(dilation.size() == 1 || dilation.size() == 2,
+    "max_pool2d: dilation must be either a single int, or a tuple of two ints");
+  const int dilationH = safe_downcast<int, int64_t>(dilation[0]);
+  const int dilationW = dilation.size() == 1 ? dilationH : safe_downcast<int, int64_t>(dilation[1]);
+
+  const auto memory_format = self.suggest_memory_format();
+  if (memory_format == at::MemoryFormat::ChannelsLast) {
+    TORCH_CHECK(self.ndimension() == 4,
+      "non-empty 4D (batch mode) tensor expected for input with channels_last layout");
+  } else if (memory_format == at::MemoryFormat::Contiguous) {
+    TORCH_CHECK((self.ndimension() == 3 || self.ndimension() == 4),
+      "non-empty 3D or 4D (batch mode) tensor expected for input");
+  } else {
+    TORCH_CHECK(false, "Unsupport memory format. Supports only ChannelsLast, Contiguous");
+  }
+
+  const int64_t nbatch = self.ndimension() == 4 ? self.size(-4) : 1;
+  const int64_t nInputPlane = self.size(-3);
+  const int64_t inputHeight = self.size(-2);
+  const int64_t inputWidth = self.size(-1);
+
+  const int64_t outputHeight = pooling_output_shape<int64_t>(inputHeight, kH, padH, dH, dilationH, ceil_mode);
+  const int64_t outputWidth = pooling_output_shape<int64_t>(inputWidth, kW, padW, dW, dilationW, ceil_mode);
+
+  pool2d_shape_check(
+    self,
+    kH, kW, dH, dW, padH, padW, dilationH, dilationW,
+    nInputPlane,
+    inputHeight, inputWidth,
+    outputHeight, outputWidth, memory_format);
+
+  NoNamesGuard guard;
+  Tensor output = self.ndimension() == 3
+      ? at::empty({nInputPlane, outputHeight, outputWidth},
+                  self.options().memory_format(memory_format))
+      : at::empty({nbatch, nInputPlane, outputHeight, outputWidth},
+                  self.options().memory_format(memory_format));
+
+  max_pool2d_no_indices_kernel(
+      kCPU, output, self,
+      kW, kH, dW, dH, padW, padH, dilationW, dilationH, fuse_relu);
+
+  guard.reset();
+  namedinference::propagate_names(output, self);
+
+  return output;
+}
+
+} // namespace
+
 static void check1d(
     const char* function_name,
     const char* argument_name,
@@ -161,11 +259,37 @@ Tensor max_pool2d(
         self, kernel_size, padding, stride, dilation, ceil_mode);
   }
 #endif
+  if (can_use_max_pool2d_no_indices(self)) {
+    return max_pool2d_no_indices_impl(
+        self, kernel_size, stride, padding, dilation, ceil_mode,
+        /*fuse_relu*/ false);
+  }
   auto output_and_indices = at::max_pool2d_with_indices(
       self, kernel_size, stride, padding, dilation, ceil_mode);
   return std::get<0>(output_and_indices);
 }
 
+Tensor _max_pool2d_relu(
+    const Tensor& self,
+    IntArrayRef kernel_size,
+    IntArrayRef stride,
+    IntArrayRef padding,
+    IntArrayRef dilation,
+    bool ceil_mode) {
+  // relu(max(window)) == max(max(window), 0), so on the inference fast
+  // path the clamp folds into the pooling kernel's final store. Otherwise
+  // decompose so autograd, quantized and mkldnn inputs take their usual
+  // max_pool2d paths.
+  if (!self.is_quantized() && !self.is_mkldnn() &&
+      can_use_max_pool2d_no_indices(self)) {
+    return max_pool2d_no_indices_impl(
+        self, kernel_size, stride, padding, dilation, ceil_mode,
+        /*fuse_relu*/ true);
+  }
+  return at::relu(at::max_pool2d(
+      self, kernel_size, stride, padding, dilation, ceil_mode));
+}
+
 Tensor max_pool3d(
     const Tensor& self,
     IntArrayRef kernel_size,
@@ -4,9 +4,14 @@
 #include <ATen/core/Tensor.h>
 #include <ATen/Dispatch.h>
 #include <ATen/NumericUtils.h>
+#include <ATen/Parallel.h>
 #include <ATen/TensorOperators.h>
+#include <ATen/cpu/vec/vec.h>
 #include <c10/util/irange.h>
 
+#include <algorithm>
+#include <vector>
+
 #ifndef AT_PER_OPERATOR_HEADERS
 #include <ATen/Functions.h>
 #include <ATen/NativeFunctions.h>
@@ -28,6 +33,202 @@ DEFINE_DISPATCH(_segment_reduce_offsets_backward_stub);
 
 namespace {
 
+template <typename scalar_t>
+scalar_t segment_reduce_init_value(
+    ReductionType reduction,
+    const c10::optional<Scalar>& initial) {
+  if (initial.has_value()) {
+    return initial.value().to<scalar_t>();
+  } else if (reduction == ReductionType::MAX) {
+    return -std::numeric_limits<scalar_t>::infinity();
+  } else if (reduction == ReductionType::MIN) {
+    return std::numeric_limits<scalar_t>::infinity();
+  } else if (reduction == ReductionType::PROD) {
+    return static_cast<scalar_t>(1);
+  } else {
+    // MEAN and SUM
+    return static_cast<scalar_t>(0);
+  }
+}
+
+// Combines one contiguous row of values into a contiguous accumulator row.
+// NaN handling matches the serial kernel below: maximum/minimum propagate a
+// NaN from either operand.
+template <typename scalar_t>
+void segment_reduce_combine_row(
+    scalar_t* acc,
+    const scalar_t* row,
+    int64_t n,
+    ReductionType reduction) {
+  using Vec = at::vec::Vectorized<scalar_t>;
+  int64_t d = 0;
+  for (; d < n - (n % Vec::size()); d += Vec::size()) {
+    Vec a = Vec::loadu(acc + d);
+    Vec b = Vec::loadu(row + d);
+    Vec r;
+    if (reduction == ReductionType::MAX) {
+      r = at::vec::maximum(b, a);
+    } else if (reduction == ReductionType::MIN) {
+      r = at::vec::minimum(b, a);
+    } else if (reduction == ReductionType::PROD) {
+      r = a * b;
+    } else {
+      // MEAN and SUM
+      r = a + b;
+    }
+    r.store(acc + d);
+  }
+  for (; d < n; d++) {
+    const auto val = row[d];
+    if (reduction == ReductionType::MAX) {
+      acc[d] = at::_isnan(val) ? val : std::max<scalar_t>(acc[d], val);
+    } else if (reduction == ReductionType::MIN) {
+      acc[d] = at::_isnan(val) ? val : std::min<scalar_t>(acc[d], val);
+    } else if (reduction == ReductionType::PROD) {
+      acc[d] = acc[d] * val;
+    } else {
+      acc[d] = acc[d] + val;
+    }
+  }
+}
+
+/**
+ * Parallel forward path. The serial kernel below walks each segment once per
+ * inner index, which both serializes the whole reduction and strides through
+ * the data segment_count times. Here segments are instead reduced a whole
+ * contiguous row at a time with at::vec, and the (outer, segment) pairs are
+ * distributed over threads with at::parallel_for. To keep giant segments from
+ * serializing a thread, every segment is split into chunks of at most
+ * chunk_rows rows; each chunk reduces into its own partial row and a second
+ * pass combines the partials (with the user-provided initial value) and
+ * finalizes the output. Requires contiguous data, which the wrappers below
+ * already enforce.
+ */
+template <typename T, bool is_offsets_like = false>
+void _segment_reduce_lengths_cpu_parallel_kernel1(
+    ReductionType reduction,
+    const Tensor& data,
+    const T* lengths_data,
+    int64_t axis,
+    const c10::optional<Scalar>& initial,
+    Tensor& output,
+    int64_t segment_count,
+    int64_t lengths_stride_axis) {
+  int64_t outer_offset = 1, inner_offset = 1;
+  for (int64_t d = 0; d < axis; d++)
+      outer_offset *= output.size(d);
+  for (int64_t d = axis + 1; d < output.dim(); d++)
+      inner_offset *= output.size(d);
+  int64_t lengths_size_axis = is_offsets_like ? segment_count + 1 : segment_count;
+  auto data_stride_axis = data.stride(axis);
+  auto data_size_axis = data.size(axis);
+  auto output_stride_axis = output.stride(axis);
+  auto output_size_axis = output.size(axis);
+
+  // ===== step1: compute segment boundaries and carve them into chunks
+  const int64_t num_segments = outer_offset * segment_count;
+  const int64_t chunk_rows = std::max(
+      at::internal::GRAIN_SIZE / std::max(inner_offset, int64_t{1}), int64_t{1});
+  std::vector<int64_t> seg_start(num_segments);
+  std::vector<int64_t> seg_length(num_segments);
+  std::vector<int64_t> seg_chunk_offsets(num_segments + 1);
+  std::vector<int64_t> chunk_to_seg;
+  int64_t num_chunks = 0;
+  for (const auto outer_idx : c10::irange(outer_offset)) {
+    int64_t segment_start, segment_length;
+    int64_t segment_end = is_offsets_like ?
+                          lengths_data[outer_idx * lengths_stride_axis * lengths_size_axis] :
+                          0;
+    for (const auto dim_idx : c10::irange(segment_count)) {
+      segment_start = segment_end;
+      auto lengths_idx = outer_idx * lengths_stride_axis * lengths_size_axis + dim_idx;
+      if (is_offsets_like) {
+        segment_end = lengths_data[lengths_idx + 1];
+        segment_length = segment_end - segment_start;
+      } else {
+        segment_length = lengths_data[lengths_idx];
+        segment_end += segment_length;
+      }
+      TORCH_CHECK(segment_length >= 0);
+      const int64_t flat_seg = outer_idx * segment_count + dim_idx;
+      seg_start[flat_seg] = segment_start;
+      seg_length[flat_seg] = segment_length;
+      seg_chunk_offsets[flat_seg] = num_chunks;
+      const int64_t seg_chunks = (segment_length + chunk_rows - 1) / chunk_rows;
+      for (C10_UNUSED const auto c : c10::irange(seg_chunks)) {
+        chunk_to_seg.push_back(flat_seg);
+      }
+      num_chunks += seg_chunks;
+    }
+  }
+  seg_chunk_offsets[num_segments] = num_chunks;
+
+  AT_DISPATCH_FLOATING_TYPES_AND2(
+      kBFloat16, kHalf, data.scalar_type(), "_segment_reduce_cpu", [&]() {
+        auto* output_data = output.data_ptr<scalar_t>();
+        const auto* values_data = data.data_ptr<scalar_t>();
+        const scalar_t identity =
+            segment_reduce_init_value<scalar_t>(reduction, c10::nullopt);
+
+        // ===== step2: reduce each chunk into its own partial row
+        auto buffer = at::empty({num_chunks, inner_offset}, data.options());
+        auto* buffer_data = buffer.data_ptr<scalar_t>();
+        at::parallel_for(0, num_chunks, 1, [&](int64_t begin, int64_t end) {
+          for (const auto chunk_idx : c10::irange(begin, end)) {
+            const int64_t flat_seg = chunk_to_seg[chunk_idx];
+            const int64_t outer_idx = flat_seg / segment_count;
+            const int64_t chunk_in_seg = chunk_idx - seg_chunk_offsets[flat_seg];
+            const int64_t row_begin = seg_start[flat_seg] + chunk_in_seg * chunk_rows;
+            const int64_t row_end = std::min(
+                seg_start[flat_seg] + seg_length[flat_seg], row_begin + chunk_rows);
+            scalar_t* partial = buffer_data + chunk_idx * inner_offset;
+            std::fill(partial, partial + inner_offset, identity);
+            for (const auto j : c10::irange(row_begin, row_end)) {
+              const scalar_t* row = values_data
+                  + outer_idx * data_stride_axis * data_size_axis
+                  + j * data_stride_axis;
+              segment_reduce_combine_row(partial, row, inner_offset, reduction);
+            }
+          }
+        });
+
+        // ===== step3: combine partials per segment and finalize
+        const int64_t seg_grain = std::max(
+            at::internal::GRAIN_SIZE / std::max(inner_offset, int64_t{1}), int64_t{1});
+        at::parallel_for(0, num_segments, seg_grain, [&](int64_t begin, int64_t end) {
+          for (const auto flat_seg : c10::irange(begin, end)) {
+            const int64_t outer_idx = flat_seg / segment_count;
+            const int64_t dim_idx = flat_seg % segment_count;
+            scalar_t* out_row = output_data
+                + outer_idx * output_stride_axis * output_size_axis
+                + dim_idx * output_stride_axis;
+            const scalar_t init_value =
+                segment_reduce_init_value<scalar_t>(reduction, initial);
+            std::fill(out_row, out_row + inner_offset, init_value);
+            for (const auto chunk_idx : c10::irange(
+                     seg_chunk_offsets[flat_seg], seg_chunk_offsets[flat_seg + 1])) {
+              segment_reduce_combine_row(
+                  out_row,
+                  buffer_data + chunk_idx * inner_offset,
+                  inner_offset,
+                  reduction);
+            }
+            const int64_t segment_length = seg_length[flat_seg];
+            if (segment_length == 0 && !initial.has_value() &&
+                reduction == ReductionType::MEAN) {
+              std::fill(out_row, out_row + inner_offset, static_cast<scalar_t>(NAN));
+            } else if (reduction == ReductionType::MEAN && segment_length > 0) {
+              for (const auto d : c10::irange(inner_offset)) {
+                if (!at::_isnan(out_row[d])) {
+                  out_row[d] = out_row[d] / segment_length;
+                }
+              }
+            }
+          }
+        });
+      });
+}
+
 template <typename T, bool is_offsets_like=false>
 void _segment_reduce_lengths_cpu_kernel1(
     ReductionType reduction,
@@ -147,8 +348,13 @@ Tensor _segment_reduce_lengths_cpu_kernel(
 
   AT_DISPATCH_INDEX_TYPES(lengths.scalar_type(), "_segment_reduce_lengths_cpu_kernel1", [&]() {
     const auto* lengths_data = lengths.data_ptr<index_t>();
-    _segment_reduce_lengths_cpu_kernel1(
-        reduction, data, lengths_data, axis, initial, output, segment_count, lengths_stride_axis);
+    if (data.numel() >= at::internal::GRAIN_SIZE && at::get_num_threads() > 1) {
+      _segment_reduce_lengths_cpu_parallel_kernel1(
+          reduction, data, lengths_data, axis, initial, output, segment_count, lengths_stride_axis);
+    } else {
+      _segment_reduce_lengths_cpu_kernel1(
+          reduction, data, lengths_data, axis, initial, output, segment_count, lengths_stride_axis);
+    }
   });
 
   return output;
@@ -173,8 +379,13 @@ Tensor _segment_reduce_offsets_cpu_kernel(
 
   AT_DISPATCH_INDEX_TYPES(offsets.scalar_type(), "_segment_reduce_offsets_cpu_kernel1", [&]() {
     const auto* offsets_data = offsets.data_ptr<index_t>();
-    _segment_reduce_lengths_cpu_kernel1<index_t, /*is_offsets_like=*/true>(
-        reduction, data, offsets_data, axis, initial, output, segment_count, offsets_stride_axis);
+    if (data.numel() >= at::internal::GRAIN_SIZE && at::get_num_threads() > 1) {
+      _segment_reduce_lengths_cpu_parallel_kernel1<index_t, /*is_offsets_like=*/true>(
+          reduction, data, offsets_data, axis, initial, output, segment_count, offsets_stride_axis);
+    } else {
+      _segment_reduce_lengths_cpu_kernel1<index_t, /*is_offsets_like=*/true>(
+          reduction, data, offsets_data, axis, initial, output, segment_count, offsets_stride_axis);
+    }
   });
 
   return output;
@@ -571,6 +571,7 @@ Tensor special_log_softmax(const Tensor& input, const int64_t dim, c10::optional
 }
 
 DEFINE_DISPATCH(softmax_lastdim_kernel);
+DEFINE_DISPATCH(masked_softmax_dropout_lastdim_kernel);
 DEFINE_DISPATCH(log_softmax_lastdim_kernel);
 DEFINE_DISPATCH(softmax_backward_lastdim_kernel);
 DEFINE_DISPATCH(log_softmax_backward_lastdim_kernel);
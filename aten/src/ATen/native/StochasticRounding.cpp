@@ -0,0 +1,114 @@
+#define TORCH_ASSERT_ONLY_METHOD_OPERATORS
+#include <ATen/core/Tensor.h>
+
+#include <ATen/CPUGeneratorImpl.h>
+#include <ATen/Parallel.h>
+#include <ATen/Utils.h>
+#include <ATen/core/PhiloxRNGEngine.h>
+#include <c10/util/bit_cast.h>
+#include <c10/util/irange.h>
+
+#ifndef AT_PER_OPERATOR_HEADERS
+#include <ATen/NativeFunctions.h>
+#else
+#include <ATen/ops/_copy_stochastic_native.h>
+#include <ATen/ops/empty_like.h>
+#endif
+
+#include <cmath>
+#include <mutex>
+
+namespace at::native {
+
+// _copy_stochastic_ casts float optimizer state down to bfloat16 with
+// stochastic rounding: each value rounds up or down with probability
+// proportional to its distance from the two representable neighbours, so the
+// rounding error is zero in expectation. Plain truncation or round-to-nearest
+// biases small gradient updates toward zero and hurts convergence when Adam
+// moments are kept in bf16.
+
+void check_copy_stochastic(const Tensor& self, const Tensor& src) {
+  TORCH_CHECK(
+      self.scalar_type() == kBFloat16,
+      "_copy_stochastic_: expected a BFloat16 destination, but got ",
+      self.scalar_type());
+  TORCH_CHECK(
+      src.scalar_type() == kFloat,
+      "_copy_stochastic_: expected a Float source, but got ",
+      src.scalar_type());
+  TORCH_CHECK(
+      self.sizes().equals(src.sizes()),
+      "_copy_stochastic_: expected matching sizes, but got ",
+      self.sizes(),
+      " and ",
+      src.sizes());
+  TORCH_CHECK(
+      self.device() == src.device(),
+      "_copy_stochastic_: expected both tensors on one device, but got ",
+      self.device(),
+      " and ",
+      src.device());
+}
+
+namespace {
+
+// Adding a uniform 16-bit integer to the bits about to be truncated carries
+// into the kept bits exactly when the discarded fraction exceeds the draw,
+// which is the stochastic-rounding probability. Non-finite values take the
+// default round-to-nearest conversion, which preserves NaN payloads.
+inline BFloat16 round_stochastic(float val, uint32_t r16) {
+  if (C10_UNLIKELY(!std::isfinite(val))) {
+    return static_cast<BFloat16>(val);
+  }
+  auto bits = c10::bit_cast<uint32_t>(val);
+  bits += r16 & 0xFFFFu;
+  return BFloat16(static_cast<uint16_t>(bits >> 16), BFloat16::from_bits());
+}
+
+} // namespace
+
+Tensor& _copy_stochastic_cpu_(
+    Tensor& self,
+    const Tensor& src,
+    c10::optional<Generator> generator) {
+  check_copy_stochastic(self, src);
+  const int64_t numel = self.numel();
+  if (numel == 0) {
+    return self;
+  }
+
+  auto gen = get_generator_or_default<CPUGeneratorImpl>(
+      generator, detail::getDefaultCPUGenerator());
+  // NOLINTNEXTLINE(cppcoreguidelines-init-variables)
+  uint64_t seed = 0, offset = 0;
+  {
+    // See Note [Acquire lock when using random generators]
+    std::lock_guard<std::mutex> lock(gen->mutex_);
+    std::tie(seed, offset) = gen->philox_engine_inputs((numel + 3) / 4);
+  }
+
+  auto src_contig = src.expect_contiguous();
+  Tensor dst = self.is_contiguous()
+      ? self
+      : at::empty_like(self, self.options(), MemoryFormat::Contiguous);
+  const float* src_data = src_contig->const_data_ptr<float>();
+  BFloat16* dst_data = dst.data_ptr<BFloat16>();
+
+  // Each parallel chunk runs its own philox stream: the chunk's flat begin
+  // index is unique, so it doubles as the subsequence and no two threads
+  // share a counter.
+  at::parallel_for(
+      0, numel, at::internal::GRAIN_SIZE, [&](int64_t begin, int64_t end) {
+        at::Philox4_32 engine(seed, static_cast<uint64_t>(begin), offset);
+        for (const auto i : c10::irange(begin, end)) {
+          dst_data[i] = round_stochastic(src_data[i], engine());
+        }
+      });
+
+  if (!dst.is_same(self)) {
+    self.copy_(dst);
+  }
+  return self;
+}
+
+} // namespace at::native
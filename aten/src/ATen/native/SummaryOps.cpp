@@ -3,6 +3,7 @@
 
 #include <ATen/core/Tensor.h>
 #include <ATen/Dispatch.h>
+#include <ATen/Parallel.h>
 #include <c10/util/irange.h>
 
 #ifndef AT_PER_OPERATOR_HEADERS
@@ -10,6 +11,7 @@
 #include <ATen/NativeFunctions.h>
 #else
 #include <ATen/ops/bincount_native.h>
+#include <ATen/ops/sum.h>
 #include <ATen/ops/zeros.h>
 #endif
 
@@ -18,6 +20,55 @@ namespace at { namespace native {
 ///////////////// bincount /////////////////
 namespace {
 
+// Largest number of bins for which the parallel implementation is used. Each
+// thread accumulates into a private copy of the bins, so the copies should
+// stay roughly cache-resident; beyond this the per-thread arrays thrash and
+// their allocation and final reduction start to dominate.
+constexpr int64_t BINCOUNT_MAX_PARALLEL_BINS = 1 << 16;
+
+/* Accumulates bin counts for a contiguous input into output. When the input
+ * is large and the bins fit in cache, parallelizes over chunks of the input
+ * with a private bin array per thread, then sums the per-thread arrays into
+ * output (the same scheme HistogramKernel.cpp uses for histogramdd).
+ */
+template <typename input_t, typename out_t>
+void bincount_cpu_kernel(
+    Tensor& output,
+    const input_t* self_p,
+    int64_t self_size,
+    const out_t* weights_p) {
+  out_t* output_p = output.data_ptr<out_t>();
+  const int64_t nbins = output.numel();
+  const auto num_threads = at::get_num_threads();
+  if (num_threads > 1 && self_size >= at::internal::GRAIN_SIZE &&
+      nbins <= BINCOUNT_MAX_PARALLEL_BINS) {
+    Tensor thread_bins = at::zeros({num_threads, nbins}, output.options());
+    out_t* thread_bins_p = thread_bins.data_ptr<out_t>();
+    at::parallel_for(
+        0, self_size, at::internal::GRAIN_SIZE, [&](int64_t begin, int64_t end) {
+          out_t* local_bins = thread_bins_p + at::get_thread_num() * nbins;
+          if (weights_p) {
+            for (const auto i : c10::irange(begin, end)) {
+              local_bins[self_p[i]] += weights_p[i];
+            }
+          } else {
+            for (const auto i : c10::irange(begin, end)) {
+              local_bins[self_p[i]] += 1;
+            }
+          }
+        });
+    at::sum_out(output, thread_bins, /*dim=*/{0});
+  } else if (weights_p) {
+    for (const auto i : c10::irange(self_size)) {
+      output_p[self_p[i]] += weights_p[i];
+    }
+  } else {
+    for (const auto i : c10::irange(self_size)) {
+      output_p[self_p[i]] += 1;
+    }
+  }
+}
+
 template <typename input_t, typename weights_t>
 Tensor _bincount_cpu_template(
     const Tensor& self,
@@ -51,17 +102,13 @@ Tensor _bincount_cpu_template(
         weights.options().layout_opt(),
         weights.options().device_opt(),
         weights.options().pinned_memory_opt());
-    weights_t* output_p = output.data_ptr<weights_t>();
     const weights_t* weights_p = weights.data_ptr<weights_t>();
-    for (const auto i : c10::irange(self_size)) {
-      output_p[self_p[i]] += weights_p[i];
-    }
+    bincount_cpu_kernel<input_t, weights_t>(
+        output, self_p, self_size, weights_p);
   } else {
     output = at::zeros({nbins}, kLong);
-    int64_t* output_p = output.data_ptr<int64_t>();
-    for (const auto i : c10::irange(self_size)) {
-      output_p[self_p[i]] += 1L;
-    }
+    bincount_cpu_kernel<input_t, int64_t>(
+        output, self_p, self_size, /*weights_p=*/nullptr);
   }
   return output;
 }
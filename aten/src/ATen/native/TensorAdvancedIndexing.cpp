@@ -84,6 +84,7 @@
 #include <ATen/ops/_gather_sparse_backward_native.h>
 #include <ATen/ops/_index_put_impl.h>
 #include <ATen/ops/_index_put_impl_native.h>
+#include <ATen/ops/_index_select_cat_native.h>
 #include <ATen/ops/_sparse_coo_tensor_unsafe.h>
 #include <ATen/ops/_unsafe_index_native.h>
 #include <ATen/ops/_unsafe_index_put_native.h>
@@ -486,6 +487,7 @@ DEFINE_DISPATCH(masked_select_serial_stub);
 DEFINE_DISPATCH(masked_select_stub);
 DEFINE_DISPATCH(masked_scatter_stub);
 
+DEFINE_DISPATCH(index_select_cat_stub);
 DEFINE_DISPATCH(gather_stub);
 DEFINE_DISPATCH(scatter_stub);
 DEFINE_DISPATCH(scatter_fill_stub);
@@ -1397,6 +1399,46 @@ Tensor index_select_quantized_cpu_(const Tensor & self, int64_t dim, const Tenso
   return at::native::index_select_out_cpu_(self, dim, index, result);
 }
 
+// Fused index_select + cat along dim 1, for embedding-bag-style gathers:
+// each tensors[i] is a 2-D table whose rows are gathered by indices[i], and
+// the gathered rows are written directly into the concatenated output slice,
+// skipping the per-table intermediate an index_select/cat pair materializes.
+Tensor index_select_cat_cpu(TensorList tensors, TensorList indices) {
+  TORCH_CHECK(!tensors.empty(), "_index_select_cat: expected at least one tensor");
+  TORCH_CHECK(tensors.size() == indices.size(),
+      "_index_select_cat: got ", tensors.size(), " tensors but ",
+      indices.size(), " index tensors");
+  const int64_t batch = indices[0].numel();
+  int64_t total_dim = 0;
+  for (const auto i : c10::irange(tensors.size())) {
+    const auto& t = tensors[i];
+    const auto& index = indices[i];
+    TORCH_CHECK(t.dim() == 2, "_index_select_cat: tensors must be 2-D, got ",
+        t.dim(), "-D tensor at position ", i);
+    TORCH_CHECK(t.is_contiguous(),
+        "_index_select_cat: tensors must be contiguous");
+    TORCH_CHECK(t.scalar_type() == tensors[0].scalar_type(),
+        "_index_select_cat: expected all tensors to have dtype ",
+        tensors[0].scalar_type(), " but got ", t.scalar_type(),
+        " at position ", i);
+    TORCH_CHECK(index.dim() == 1 && index.numel() == batch,
+        "_index_select_cat: index tensors must be 1-D with matching lengths");
+    TORCH_CHECK(index.scalar_type() == ScalarType::Long ||
+        index.scalar_type() == ScalarType::Int,
+        "_index_select_cat: indices must be int or long");
+    TORCH_CHECK(index.scalar_type() == indices[0].scalar_type(),
+        "_index_select_cat: all index tensors must share one dtype");
+    TORCH_CHECK(index.is_contiguous(),
+        "_index_select_cat: index tensors must be contiguous");
+    total_dim += t.size(1);
+  }
+  Tensor result = at::empty({batch, total_dim}, tensors[0].options());
+  if (batch > 0 && total_dim > 0) {
+    index_select_cat_stub(kCPU, result, tensors, indices);
+  }
+  return result;
+}
+
 Tensor index_select_backward_symint(const Tensor& grad, c10::SymIntArrayRef self_sizes, int64_t dim, const Tensor& index) {
   // for composite compliance, use out-of-place variant of
   // `index_add` if index tensor is a Tensor Subclass.
@@ -1826,9 +1868,11 @@ TORCH_IMPL_FUNC(scatter_add)
   if (index.numel() == 0) return;
 
   // See Note [Enabling Deterministic Operations]
-  // Avoid gpuAtomicAdd for CUDA if deterministic mode is turned on
+  // Avoid gpuAtomicAdd for CUDA if deterministic mode is turned on. The CUDA
+  // stub takes a sort-based single-writer path in this case, which is much
+  // cheaper than rewriting the scatter as a flattened index_put_.
   if (globalContext().deterministicAlgorithms() && self.device().type() == DeviceType::CUDA) {
-    _scatter_via_index_put(self, dim, index, src, mut_out, /*accumulate*/true);
+    scatter_add_stub(self.device().type(), mut_out, dim, index, src);
   } else {
     if (can_use_expanded_index_path(mut_out, dim, index, src, /*is_scatter_like*/true)) {
       scatter_add_expanded_index_stub(self.device().type(), mut_out, index, src);
@@ -1994,16 +2038,6 @@ static Tensor & masked_select_out_impl_cpu(Tensor & result, const Tensor & self,
   std::tie(_mask, _self) = expand_outplace(mask, self);
 
   auto shape = _self->sizes();
-  int64_t numel = _mask->sum().item().toLong();
-  at::native::resize_output(result, {numel});
-  if (numel == 0) {
-    return result;
-  }
-
-  // Create strided view of result before feeding into TensorIterator
-  auto strides = DimVector(shape.size(), 0);
-  auto orig_stride = result.strides()[0];
-  auto result_strided = result.as_strided(shape, strides);
 
   // serial kernel
   // serial kernel requires that src is traversed in its logical order. However, TensorIterator might
@@ -2013,6 +2047,17 @@ static Tensor & masked_select_out_impl_cpu(Tensor & result, const Tensor & self,
   bool use_serial_kernel = (self.numel() < at::internal::GRAIN_SIZE || at::get_num_threads() == 1 ) &&
   _self->is_contiguous() && _mask->is_contiguous();
   if (use_serial_kernel) {
+    int64_t numel = _mask->sum().item().toLong();
+    at::native::resize_output(result, {numel});
+    if (numel == 0) {
+      return result;
+    }
+
+    // Create strided view of result before feeding into TensorIterator
+    auto strides = DimVector(shape.size(), 0);
+    auto orig_stride = result.strides()[0];
+    auto result_strided = result.as_strided(shape, strides);
+
     auto iter = TensorIteratorConfig()
       .set_check_mem_overlap(false)  // result is intentionally zero-strided above
       .check_all_same_dtype(false)
@@ -2027,15 +2072,61 @@ static Tensor & masked_select_out_impl_cpu(Tensor & result, const Tensor & self,
   }
 
   // Use a prefix sum to record the output locations of the masked elements,
-  // so as to parallel with TensorIterator.
+  // so as to parallel with TensorIterator. The scan itself is parallelized
+  // with the usual two-pass chunked algorithm: each thread computes an
+  // inclusive scan of its contiguous chunk along with the chunk total, a
+  // serial exclusive scan over the (at most num_threads) chunk totals
+  // produces per-chunk offsets, and a second pass adds the offset to each
+  // chunk. The grand total doubles as the output size, so the parallel path
+  // does not need a separate reduction over the mask to size the result.
   auto mask_long = at::empty(shape, self.options().dtype(at::kLong)).copy_(*_mask);
   auto mask_prefix_sum = at::empty(shape, self.options().dtype(at::kLong));
   auto mask_long_data = mask_long.data_ptr<int64_t>();
   auto mask_prefix_sum_data = mask_prefix_sum.data_ptr<int64_t>();
-  // TODO: Here can only use std::partial_sum for C++14,
-  // use std::exclusive_scan when PyTorch upgrades to C++17, which have better performance.
-  // std::exclusive_scan(mask_long_data, mask_long_data + mask_long.numel(), mask_prefix_sum_data, 0);
-  std::partial_sum(mask_long_data, mask_long_data + mask_long.numel(), mask_prefix_sum_data);
+  const auto mask_numel = mask_long.numel();
+  const auto num_threads = at::get_num_threads();
+  DimVector thread_begin(num_threads, -1);
+  DimVector chunk_offset(num_threads + 1);
+
+  at::parallel_for(0, mask_numel, at::internal::GRAIN_SIZE, [&](int64_t begin, int64_t end) {
+    const auto tid = at::get_thread_num();
+    thread_begin[tid] = begin;
+    int64_t sum = 0;
+    for (const auto i : c10::irange(begin, end)) {
+      sum += mask_long_data[i];
+      mask_prefix_sum_data[i] = sum;
+    }
+    chunk_offset[tid + 1] = sum;
+  });
+
+  // Convert chunk totals to cumulative offsets
+  for (const auto i : c10::irange(1, chunk_offset.size())) {
+    chunk_offset[i] += chunk_offset[i - 1];
+  }
+
+  int64_t numel = chunk_offset[num_threads];
+  at::native::resize_output(result, {numel});
+  if (numel == 0) {
+    return result;
+  }
+
+  at::parallel_for(0, mask_numel, at::internal::GRAIN_SIZE, [&](int64_t begin, int64_t end) {
+    const auto tid = at::get_thread_num();
+    // Work needs to be distributed the same on both passes
+    TORCH_INTERNAL_ASSERT_DEBUG_ONLY(begin == thread_begin[tid]);
+    const auto offset = chunk_offset[tid];
+    if (offset == 0) {
+      return;
+    }
+    for (const auto i : c10::irange(begin, end)) {
+      mask_prefix_sum_data[i] += offset;
+    }
+  });
+
+  // Create strided view of result before feeding into TensorIterator
+  auto strides = DimVector(shape.size(), 0);
+  auto orig_stride = result.strides()[0];
+  auto result_strided = result.as_strided(shape, strides);
 
   auto iter = TensorIteratorConfig()
     .set_check_mem_overlap(false)  // result is intentionally zero-strided above
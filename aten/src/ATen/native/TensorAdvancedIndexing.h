@@ -38,6 +38,10 @@ DECLARE_DISPATCH(scatter_reduce_two_fn, scatter_reduce_two_stub);
 
 TORCH_API Tensor& index_out(Tensor& result, const Tensor & self, const c10::List<c10::optional<at::Tensor>>& indices);
 
+using index_select_cat_fn = void(*)(const Tensor& /*result*/, TensorList /*tensors*/, TensorList /*indices*/);
+
+DECLARE_DISPATCH(index_select_cat_fn, index_select_cat_stub);
+
 using scatter_add_expanded_index_fn = void(*)(const Tensor&, const Tensor&, const Tensor&);
 using scatter_reduce_expanded_index_fn = void(*)(const Tensor&, const Tensor&, const Tensor&, const ReductionType& reduce, bool);
 using gather_expanded_index_fn = void (*)(const Tensor&, const Tensor&, const Tensor&);
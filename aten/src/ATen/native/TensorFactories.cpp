@@ -14,6 +14,7 @@
 #include <ATen/native/UnaryOps.h>
 #include <c10/core/ScalarType.h>
 #include <c10/core/TensorOptions.h>
+#include <c10/core/impl/cow/COW.h>
 #include <c10/util/Exception.h>
 #include <c10/util/irange.h>
 #include <c10/util/MathConstants.h>
@@ -32,6 +33,7 @@
 #include <ATen/ops/_cast_Short_native.h>
 #include <ATen/ops/_dim_arange_native.h>
 #include <ATen/ops/_efficientzerotensor_native.h>
+#include <ATen/ops/_lazy_clone_native.h>
 #include <ATen/ops/_empty_affine_quantized.h>
 #include <ATen/ops/_empty_per_channel_affine_quantized.h>
 #include <ATen/ops/arange.h>
@@ -382,6 +384,29 @@ Tensor empty_like(
     c10::optional<Device> device,
     c10::optional<bool> pin_memory,
     c10::optional<c10::MemoryFormat> optional_memory_format) {
+  // Fast path: when no option differs from self and the memory format is the
+  // default Preserve, the merged TensorOptions below would reproduce self's
+  // dtype/layout/device exactly, so skip the merging and dispatch-key
+  // recomputation and allocate directly (see at::detail::empty_like_fast).
+  // zeros_like() funnels through here with options copied from self, so it
+  // takes this path too.
+  const bool no_overrides =
+      (!dtype.has_value() || *dtype == self.scalar_type()) &&
+      (!layout.has_value() || *layout == self.layout()) &&
+      (!device.has_value() || *device == self.device()) &&
+      !pin_memory.value_or(false) &&
+      (!optional_memory_format.has_value() ||
+       *optional_memory_format == MemoryFormat::Preserve);
+  if (no_overrides &&
+      C10_LIKELY(!at::globalContext().deterministicAlgorithms())) {
+    auto fast = at::detail::empty_like_fast(self);
+    if (fast.defined()) {
+      // Freshly allocated, so the Conjugate/Negative/ZeroTensor bits the slow
+      // path clears are never set here.
+      return Tensor(std::move(fast));
+    }
+  }
+
   // See [Note: hacky wrapper removal for TensorOptions]
   TensorOptions options_ = TensorOptions().dtype(dtype).layout(layout).device(device).pinned_memory(pin_memory);
 
@@ -1713,6 +1738,26 @@ Tensor clone(const Tensor& src, c10::optional<c10::MemoryFormat> optional_memory
   return self;
 }
 
+// Lazy (copy-on-write) clone: O(1), shares the data allocation with the
+// source. The actual copy is deferred until either side is written, at which
+// point StorageImpl materializes its storage (see c10/core/impl/cow/COW.h).
+// Only works for storages with a plain data pointer; from_blob-style storages
+// with custom contexts are rejected.
+Tensor _lazy_clone(const Tensor& self) {
+  c10::StorageImpl* self_storage = self.storage().unsafeGetStorageImpl();
+  c10::intrusive_ptr<c10::StorageImpl> storage =
+      c10::impl::cow::lazy_clone_storage(*self_storage);
+  TORCH_CHECK(
+      storage != nullptr,
+      "_lazy_clone: this tensor's storage cannot be lazily cloned because its "
+      "data pointer has a non-trivial context");
+  auto tensor = c10::make_intrusive<c10::TensorImpl>(
+      c10::Storage(std::move(storage)), self.key_set(), self.dtype());
+  tensor->set_sizes_and_strides(
+      self.sym_sizes(), self.sym_strides(), self.sym_storage_offset());
+  return Tensor(std::move(tensor));
+}
+
 // ~~~~~~~~~~~~~~~~~~~~~~~~~ named tensor overloads ~~~~~~~~~~~~~~~~~~~~~~~~~~~
 // In the short term, these exist.
 // In the long term, we should move DimnameList into TensorOptions to avoid
@@ -78,6 +78,7 @@
 #include <ATen/ops/block_diag_native.h>
 #include <ATen/ops/broadcast_tensors_native.h>
 #include <ATen/ops/broadcast_to_native.h>
+#include <ATen/ops/_cat_view_native.h>
 #include <ATen/ops/cat.h>
 #include <ATen/ops/cat_meta.h>
 #include <ATen/ops/cat_native.h>
@@ -705,6 +706,54 @@ static bool sizes_match_except(IntArrayRef s1, IntArrayRef s2, int64_t dim_excep
   return true;
 }
 
+// Zero-copy companion to cat for inputs that are in-order adjacent views of
+// one storage, as produced by split/chunk/narrow. When the concatenated
+// result coincides with a strided window of the shared buffer, this returns
+// that window as a view of tensors[0]; otherwise it throws (strict=True) or
+// falls back to a copying cat (strict=False). The view result aliases the
+// inputs, which is why this cannot be a default cat fast path: cat
+// guarantees a fresh tensor.
+Tensor _cat_view(TensorList tensors, int64_t dim, bool strict) {
+  TORCH_CHECK(
+      !tensors.empty(), "_cat_view expected a non-empty list of Tensors");
+  const auto& first = tensors[0];
+  TORCH_CHECK(
+      first.dim() > 0, "_cat_view: zero-dimensional tensors cannot be concatenated");
+  dim = maybe_wrap_dim(dim, first.dim());
+
+  bool viewable = first.layout() == at::kStrided;
+  const auto strides = first.strides();
+  const int64_t step = first.stride(dim);
+  int64_t expected_offset = first.storage_offset() + first.size(dim) * step;
+  int64_t cat_dim_size = first.size(dim);
+  for (const auto i : c10::irange(static_cast<int64_t>(1), static_cast<int64_t>(tensors.size()))) {
+    if (!viewable) {
+      break;
+    }
+    const auto& t = tensors[i];
+    viewable = t.layout() == at::kStrided &&
+        t.scalar_type() == first.scalar_type() && t.device() == first.device() &&
+        t.is_conj() == first.is_conj() && t.is_neg() == first.is_neg() &&
+        sizes_match_except(first.sizes(), t.sizes(), dim) &&
+        t.strides().equals(strides) && t.is_alias_of(first) &&
+        t.storage_offset() == expected_offset;
+    if (viewable) {
+      expected_offset += t.size(dim) * step;
+      cat_dim_size += t.size(dim);
+    }
+  }
+
+  if (viewable) {
+    auto sizes = first.sizes().vec();
+    sizes[dim] = cat_dim_size;
+    return first.as_strided(sizes, strides, first.storage_offset());
+  }
+  TORCH_CHECK(
+      !strict,
+      "_cat_view: inputs are not in-order adjacent views of a single storage");
+  return at::cat(tensors, dim);
+}
+
 // Check to see if the shape of tensors is compatible
 // for being concatenated along a given dimension.
 static void check_cat_sparse_dims(Tensor const &t,
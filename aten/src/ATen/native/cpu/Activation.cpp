@@ -9,6 +9,7 @@
 #include <cmath>
 #include <functional>
 
+#include <ATen/Context.h>
 #include <ATen/Dispatch.h>
 #include <ATen/OpMathType.h>
 #include <ATen/core/TensorBase.h>
@@ -348,6 +349,7 @@ void GeluKernelImpl(TensorIteratorBase& it, GeluType approximate) {
   if (it.numel() > GELU_MIN_ELEMENTS_FOR_MULTI_THREADING) {
     grain_size = it.numel() / at::get_num_threads();
   }
+  const bool fast_math = at::globalContext().allowFastMathTranscendentalsCPU();
   if (approximate == GeluType::Tanh) {
     if (at::isReducedFloatingType(it.common_dtype())) {
       AT_DISPATCH_REDUCED_FLOATING_TYPES(it.common_dtype(), "GeluKernelImpl", [&]() {
@@ -371,8 +373,12 @@ void GeluKernelImpl(TensorIteratorBase& it, GeluType approximate) {
               auto x1_cube = x1 * x1 * x1;
               auto inner_vec0 = kBetaVec * (x0 + kKappaVec * x0_cube);
               auto inner_vec1 = kBetaVec * (x1 + kKappaVec * x1_cube);
-              auto res0 = kPointFiveVec * x0 * (kOneVec + inner_vec0.tanh());
-              auto res1 = kPointFiveVec * x1 * (kOneVec + inner_vec1.tanh());
+              auto res0 = kPointFiveVec * x0 *
+                  (kOneVec +
+                   (fast_math ? vec::fast_tanh(inner_vec0) : inner_vec0.tanh()));
+              auto res1 = kPointFiveVec * x1 *
+                  (kOneVec +
+                   (fast_math ? vec::fast_tanh(inner_vec1) : inner_vec1.tanh()));
               return convert_from_float<scalar_t>(res0, res1);
             },
             grain_size);
@@ -397,7 +403,9 @@ void GeluKernelImpl(TensorIteratorBase& it, GeluType approximate) {
             [&](Vec x_vec) {
               auto x_cube = x_vec * x_vec * x_vec;
               auto inner_vec = kBetaVec * (x_vec + kKappaVec * x_cube);
-              return kPointFiveVec * x_vec * (kOneVec + inner_vec.tanh());
+              return kPointFiveVec * x_vec *
+                  (kOneVec +
+                   (fast_math ? vec::fast_tanh(inner_vec) : inner_vec.tanh()));
             },
             grain_size);
       });
@@ -417,8 +425,12 @@ void GeluKernelImpl(TensorIteratorBase& it, GeluType approximate) {
             [&](Vectorized<scalar_t> x) -> Vectorized<scalar_t> {
               Vectorized<float> x0, x1;
               std::tie(x0, x1) = convert_to_float<scalar_t>(x);
-              auto res0 = x0 * kPointFiveVec * (kOneVec + (x0 * kAlphaVec).erf());
-              auto res1 = x1 * kPointFiveVec * (kOneVec + (x1 * kAlphaVec).erf());
+              auto arg0 = x0 * kAlphaVec;
+              auto arg1 = x1 * kAlphaVec;
+              auto res0 = x0 * kPointFiveVec *
+                  (kOneVec + (fast_math ? vec::fast_erf(arg0) : arg0.erf()));
+              auto res1 = x1 * kPointFiveVec *
+                  (kOneVec + (fast_math ? vec::fast_erf(arg1) : arg1.erf()));
               return convert_from_float<scalar_t>(res0, res1);
             },
             grain_size);
@@ -437,8 +449,9 @@ void GeluKernelImpl(TensorIteratorBase& it, GeluType approximate) {
               return x * scalar_t(0.5) * (scalar_t(1) + std::erf(x * kAlpha));
             },
             [&](Vec x_vec) {
+              auto arg_vec = x_vec * kAlphaVec;
               return x_vec * kPointFiveVec *
-                  (kOneVec + (x_vec * kAlphaVec).erf());
+                  (kOneVec + (fast_math ? vec::fast_erf(arg_vec) : arg_vec.erf()));
             },
             grain_size);
       });
@@ -10,6 +10,7 @@
 #include <ATen/cpu/vec/vec.h>
 #include <ATen/native/Math.h>
 #include <ATen/native/TensorIterator.h>
+#include <ATen/native/cpu/ElementwiseChainLoops.h>
 #include <ATen/native/cpu/LogAddExp.h>
 #include <ATen/native/cpu/Loops.h>
 #include <c10/macros/Macros.h>
@@ -149,6 +150,26 @@ void mul_kernel(TensorIteratorBase& iter) {
           });
     });
   } else {
+    if (dtype == kFloat && chain_fusion::enabled()) {
+      if (iter.is_scalar(2) && iter.data_ptr(2) != nullptr) {
+        const float b = iter.original_scalar_value<float>(2);
+        if (try_chain_unary(
+                iter,
+                [b](float a) -> float { return a * b; },
+                [b](Vectorized<float> a) { return a * Vectorized<float>(b); })) {
+          return;
+        }
+      } else {
+        const auto* b_data = static_cast<const float*>(iter.data_ptr(2));
+        if (try_chain_binary(
+                iter,
+                b_data,
+                [](float a, float b) -> float { return a * b; },
+                [](Vectorized<float> a, Vectorized<float> b) { return a * b; })) {
+          return;
+        }
+      }
+    }
     _AT_DISPATCH_MUL_TYPES(dtype, "mul_cpu", [&]() {
       cpu_kernel_vec(
           iter,
@@ -181,6 +202,31 @@ void div_true_kernel(TensorIteratorBase& iter) {
           });
     });
   } else {
+    if (dtype == kFloat && chain_fusion::enabled()) {
+      if (iter.is_scalar(2) && iter.data_ptr(2) != nullptr) {
+        const float b = iter.original_scalar_value<float>(2);
+        if (try_chain_unary(
+                iter,
+                [b](float a) __ubsan_ignore_float_divide_by_zero__ -> float {
+                  return a / b;
+                },
+                [b](Vectorized<float> a) { return a / Vectorized<float>(b); })) {
+          return;
+        }
+      } else {
+        const auto* b_data = static_cast<const float*>(iter.data_ptr(2));
+        if (try_chain_binary(
+                iter,
+                b_data,
+                [](float a, float b)
+                    __ubsan_ignore_float_divide_by_zero__ -> float {
+                      return a / b;
+                    },
+                [](Vectorized<float> a, Vectorized<float> b) { return a / b; })) {
+          return;
+        }
+      }
+    }
     AT_DISPATCH_FLOATING_AND_COMPLEX_TYPES_AND2(
         kBFloat16, kHalf, dtype, "div_cpu", [&]() {
           cpu_kernel_vec(
@@ -1,5 +1,7 @@
 #define TORCH_ASSERT_NO_OPERATORS
 #include <ATen/Dispatch.h>
+#include <ATen/cpu/vec/vec.h>
+#include <ATen/cpu/vec/functional.h>
 #include <ATen/native/CPUBlas.h>
 #include <c10/util/irange.h>
 #include <c10/util/Unroll.h>
@@ -53,6 +55,34 @@ auto sum(int64_t N, Func f) {
   return partial_sums[0];
 }
 
+// Dot product of two contiguous bf16/fp16 rows: each half of a low-precision
+// vector is widened to fp32 lanes and accumulated with fma, so the result
+// matches the precision of the scalar opmath path.
+template <typename scalar_t>
+std::enable_if_t<vec::is_reduced_floating_point_v<scalar_t>, float>
+dot_with_fp32_arith(const scalar_t* a, const scalar_t* b, int64_t len) {
+  using bVec = vec::Vectorized<scalar_t>;
+  using fVec = vec::Vectorized<float>;
+  constexpr int64_t K = bVec::size();
+  fVec acc0(0);
+  fVec acc1(0);
+  int64_t l = 0;
+  for (; l + K <= len; l += K) {
+    const bVec a_bvec = bVec::loadu(a + l);
+    const bVec b_bvec = bVec::loadu(b + l);
+    auto [a_fvec0, a_fvec1] = vec::convert_to_float<scalar_t>(a_bvec);
+    auto [b_fvec0, b_fvec1] = vec::convert_to_float<scalar_t>(b_bvec);
+    acc0 = vec::fmadd(a_fvec0, b_fvec0, acc0);
+    acc1 = vec::fmadd(a_fvec1, b_fvec1, acc1);
+  }
+  float dot = vec::vec_reduce_all(
+      [](fVec& x, fVec& y) { return x + y; }, acc0 + acc1);
+  for (; l < len; ++l) {
+    dot += static_cast<float>(a[l]) * static_cast<float>(b[l]);
+  }
+  return dot;
+}
+
 template <typename scalar_t, typename opmath_t>
 typename std::enable_if<std::is_same<scalar_t, opmath_t>::value, void>::type
 gemm_notrans_(
@@ -120,7 +150,8 @@ gemm_notrans_(
 }
 
 template <typename scalar_t, typename opmath_t>
-void gemm_transa_(
+typename std::enable_if<!vec::is_reduced_floating_point_v<scalar_t>, void>::type
+gemm_transa_(
     int64_t m, int64_t n, int64_t k,
     opmath_t alpha,
     const scalar_t *a, int64_t lda,
@@ -146,6 +177,35 @@ void gemm_transa_(
   }
 }
 
+// std::is_same<scalar_t, at::BFloat16> || std::is_same<scalar_t, at::Half>
+// Both operands are contiguous along k in this layout, so the dot products
+// run in vector registers with fp32 accumulation.
+template <typename scalar_t, typename opmath_t>
+typename std::enable_if<vec::is_reduced_floating_point_v<scalar_t>, void>::type
+gemm_transa_(
+    int64_t m, int64_t n, int64_t k,
+    opmath_t alpha,
+    const scalar_t *a, int64_t lda,
+    const scalar_t *b, int64_t ldb,
+    opmath_t beta,
+    scalar_t *c, int64_t ldc) {
+  // c = alpha * (a.T @ b) + beta * c
+  const scalar_t *a_ = a;
+  for (const auto i : c10::irange(m)) {
+    const scalar_t *b_ = b;
+    for (const auto j : c10::irange(n)) {
+      const auto dot = dot_with_fp32_arith(a_, b_, k);
+      b_ += ldb;
+      if (beta == opmath_t(0)) {
+        c[j*ldc+i] = alpha*dot;
+      } else {
+        c[j*ldc+i] = beta*c[j*ldc+i]+alpha*dot;
+      }
+    }
+    a_ += lda;
+  }
+}
+
 template <typename scalar_t, typename opmath_t>
 typename std::enable_if<std::is_same<scalar_t, opmath_t>::value, void>::type
 gemm_transb_(
@@ -237,6 +297,74 @@ void gemm_transab_(
   }
 }
 
+// Note [Small fixed-size GEMM kernels]
+// Workloads that apply thousands of tiny fixed-shape products (e.g. 3x3/4x4
+// pose transforms) spend more time in BLAS call overhead and generic loop
+// bookkeeping than in the arithmetic itself. For tiny square no-transpose
+// products we instead run a kernel templated on the dimension, so the
+// compiler sees constant trip counts and fully unrolls the loops.
+// use_blas_gemm() routes eligible sizes to gemm_stub rather than BLAS, and
+// gemm_core_ selects the matching instantiation at runtime; the shared
+// eligibility predicate is internal::is_fixed_size_gemm in CPUBlas.h.
+template <typename scalar_t, typename opmath_t, int N>
+void gemm_notrans_fixed_(
+    opmath_t alpha,
+    const scalar_t *a, int64_t lda,
+    const scalar_t *b, int64_t ldb,
+    opmath_t beta,
+    scalar_t *c, int64_t ldc) {
+  // c = beta * c + alpha * (a @ b), with every matrix N x N (column-major)
+  for (const auto j : c10::irange(N)) {
+    std::array<opmath_t, N> acc;
+    c10::ForcedUnroll<N>{}([&](int i) {
+      acc[i] = beta == opmath_t(0)
+          ? opmath_t(0)
+          : beta * static_cast<opmath_t>(c[j * ldc + i]);
+    });
+    c10::ForcedUnroll<N>{}([&](int l) {
+      const opmath_t b_val = alpha * static_cast<opmath_t>(b[j * ldb + l]);
+      c10::ForcedUnroll<N>{}([&](int i) {
+        acc[i] += static_cast<opmath_t>(a[l * lda + i]) * b_val;
+      });
+    });
+    c10::ForcedUnroll<N>{}([&](int i) {
+      c[j * ldc + i] = static_cast<scalar_t>(acc[i]);
+    });
+  }
+}
+
+// Runtime selection of the fixed-size instantiations; returns false if the
+// product is not eligible so the caller can fall through to the generic path.
+template <typename scalar_t, typename opmath_t>
+bool try_gemm_fixed_size_(
+    TransposeType transa, TransposeType transb,
+    int64_t m, int64_t n, int64_t k,
+    opmath_t alpha,
+    const scalar_t *a, int64_t lda,
+    const scalar_t *b, int64_t ldb,
+    opmath_t beta,
+    scalar_t *c, int64_t ldc) {
+  if (!internal::is_fixed_size_gemm(transa, transb, m, n, k)) {
+    return false;
+  }
+#define GEMM_FIXED_SIZE_CASE(N)                                         \
+  case N:                                                               \
+    gemm_notrans_fixed_<scalar_t, opmath_t, N>(                         \
+        alpha, a, lda, b, ldb, beta, c, ldc);                           \
+    return true;
+  switch (m) {
+    GEMM_FIXED_SIZE_CASE(2)
+    GEMM_FIXED_SIZE_CASE(3)
+    GEMM_FIXED_SIZE_CASE(4)
+    GEMM_FIXED_SIZE_CASE(5)
+    GEMM_FIXED_SIZE_CASE(6)
+    GEMM_FIXED_SIZE_CASE(7)
+    GEMM_FIXED_SIZE_CASE(8)
+  }
+#undef GEMM_FIXED_SIZE_CASE
+  return false;
+}
+
 template <typename scalar_t, typename opmath_t>
 void gemm_core_(
     TransposeType transa, TransposeType transb,
@@ -246,6 +374,11 @@ void gemm_core_(
     const scalar_t *b, int64_t ldb,
     opmath_t beta,
     scalar_t *c, int64_t ldc) {
+  // See Note [Small fixed-size GEMM kernels]
+  if (try_gemm_fixed_size_(
+          transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc)) {
+    return;
+  }
   if (transa == TransposeType::NoTranspose &&
       transb == TransposeType::NoTranspose) {
     return gemm_notrans_(m, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
@@ -5,6 +5,7 @@
 #include <ATen/native/TensorIterator.h>
 #include <ATen/native/cpu/CopyKernel.h>
 #include <ATen/native/cpu/Loops.h>
+#include <ATen/cpu/vec/functional.h>
 #include <c10/util/TypeCast.h>
 #include <ATen/native/cpu/zmath.h>
 #include <ATen/TensorIteratorInternal.h>
@@ -13,7 +14,11 @@
 namespace at::native {
 inline namespace CPU_CAPABILITY {
 
-static void float_bfloat16_copy_kernel(TensorIteratorBase &iter, bool requires_neg) {
+// Vectorized copy-with-conversion between float and the reduced floating
+// point types (BFloat16, Half), replacing the scalar cast loop for the
+// common contiguous-inner-dim case.
+template <typename reduced_t>
+static void reduced_float_copy_kernel(TensorIteratorBase &iter, bool requires_neg) {
   auto strides_out = iter.strides(0);
   auto strides_in = iter.strides(1);
   auto shape = iter.shape();
@@ -30,9 +35,9 @@ static void float_bfloat16_copy_kernel(TensorIteratorBase &iter, bool requires_n
       }
     };
   get_strides(strides.data(), strides_out, strides_in, iter.ndim());
-  if ((iter.dtype(0) == kFloat) && (iter.dtype(1) == kBFloat16)) {
+  if (iter.dtype(0) == kFloat) {
     using dest_t = float;
-    using scalar_t = BFloat16;
+    using scalar_t = reduced_t;
     using Vecd = Vectorized<dest_t>;
     using Vecs = Vectorized<scalar_t>;
     c10::SmallBuffer<char*, 2> ptrs(2);
@@ -61,7 +66,7 @@ static void float_bfloat16_copy_kernel(TensorIteratorBase &iter, bool requires_n
           if (strides_in[0] != 0) {
             Vecs data_vec = Vecs::loadu(data[1] + i * sizeof(scalar_t));
             Vecd data_vec0, data_vec1;
-            std::tie(data_vec0, data_vec1) = convert_bfloat16_float(data_vec);
+            std::tie(data_vec0, data_vec1) = convert_to_float<scalar_t>(data_vec);
             if (requires_neg) {
               data_vec0 = data_vec0.neg();
               data_vec1 = data_vec1.neg();
@@ -77,7 +82,7 @@ static void float_bfloat16_copy_kernel(TensorIteratorBase &iter, bool requires_n
           if (strides_in[0] != 0) {
             Vecs data_vec = Vecs::loadu(data[1] + i * sizeof(scalar_t), size0 - i);
             Vecd data_vec0, data_vec1;
-            std::tie(data_vec0, data_vec1) = convert_bfloat16_float(data_vec);
+            std::tie(data_vec0, data_vec1) = convert_to_float<scalar_t>(data_vec);
             if (requires_neg) {
               data_vec0 = data_vec0.neg();
               data_vec1 = data_vec1.neg();
@@ -98,8 +103,8 @@ static void float_bfloat16_copy_kernel(TensorIteratorBase &iter, bool requires_n
     parallel_for(0, iter.numel(), grain_size, [&] (int64_t begin, int64_t end) {
       at::internal::serial_for_each(shape, strides, ptrs.data(), 2, loop, {begin, end});
     });
-  } else if ((iter.dtype(0) == kBFloat16) && (iter.dtype(1) == kFloat)) {
-    using dest_t = BFloat16;
+  } else {
+    using dest_t = reduced_t;
     using scalar_t = float;
     using Vecd = Vectorized<dest_t>;
     using Vecs = Vectorized<scalar_t>;
@@ -130,7 +135,7 @@ static void float_bfloat16_copy_kernel(TensorIteratorBase &iter, bool requires_n
           if (strides_in[0] != 0) {
             Vecs data_vec0 = Vecs::loadu(data[1] + i * sizeof(scalar_t));
             Vecs data_vec1 = Vecs::loadu(data[1] + (i + Vecs::size()) * sizeof(scalar_t));
-            auto data_vec = convert_float_bfloat16(data_vec0, data_vec1);
+            auto data_vec = convert_from_float<dest_t>(data_vec0, data_vec1);
             if (requires_neg) {
               data_vec = data_vec.neg();
             }
@@ -144,7 +149,7 @@ static void float_bfloat16_copy_kernel(TensorIteratorBase &iter, bool requires_n
           if (strides_in[0] != 0) {
             Vecs data_vec0 = Vecs::loadu(data[1] + i * sizeof(scalar_t), ((size0 - i) > Vecs::size())?  Vecs::size() : (size0 - i));
             Vecs data_vec1 = Vecs::loadu(data[1] + (i + Vecs::size()) * sizeof(scalar_t), ((size0 - i) > Vecs::size())?  (size0 - i - Vecs::size()) : 0);
-            auto data_vec = convert_float_bfloat16(data_vec0, data_vec1);
+            auto data_vec = convert_from_float<dest_t>(data_vec0, data_vec1);
             if (requires_neg) {
               data_vec = data_vec.neg();
             }
@@ -262,7 +267,12 @@ void copy_kernel(TensorIterator& iter, bool /*non_blocking*/) {
      sizeof(float) == strides_out[0] && (sizeof(BFloat16) == strides_in[0] || strides_in[0] == 0)) ||
     (iter.dtype(1) == kFloat && iter.dtype(0) == kBFloat16 &&
     sizeof(BFloat16) == strides_out[0] && (sizeof(float) == strides_in[0] || strides_in[0] == 0)))) {
-    float_bfloat16_copy_kernel(iter, requires_neg);
+    reduced_float_copy_kernel<BFloat16>(iter, requires_neg);
+  } else if (!requires_conj && ((iter.dtype(1) == kHalf && iter.dtype(0) == kFloat &&
+     sizeof(float) == strides_out[0] && (sizeof(Half) == strides_in[0] || strides_in[0] == 0)) ||
+    (iter.dtype(1) == kFloat && iter.dtype(0) == kHalf &&
+    sizeof(Half) == strides_out[0] && (sizeof(float) == strides_in[0] || strides_in[0] == 0)))) {
+    reduced_float_copy_kernel<Half>(iter, requires_neg);
   } else {
     _AT_DISPATCH_ALL_TYPES(dtype, "copy_", [&] {
       using dest_t = scalar_t;
@@ -293,8 +303,98 @@ void copy_kernel(TensorIterator& iter, bool /*non_blocking*/) {
   }
 }
 
+#if !defined(C10_MOBILE)
+#define _AT_DISPATCH_CP_TYPES(TYPE, NAME, ...)                              \
+        AT_DISPATCH_ALL_TYPES_AND_COMPLEX_AND8(                             \
+            kComplexHalf, kHalf, kBool, kBFloat16, kFloat8_e5m2,            \
+            kFloat8_e4m3fn, kFloat8_e5m2fnuz, kFloat8_e4m3fnuz, TYPE, NAME, \
+            __VA_ARGS__)
+#else
+#define _AT_DISPATCH_CP_TYPES(TYPE, NAME, ...)     \
+        AT_DISPATCH_ALL_TYPES_AND_COMPLEX_AND4(    \
+            kComplexHalf, kHalf, kBool, kBFloat16, \
+            TYPE, NAME, __VA_ARGS__)
+#endif
+
+// Cache-blocked transpose of one (NR, NC) matrix stored column-major
+// (element (r, c) at sp[r + c * NR]) into a row-major destination. Full
+// tiles go through vec::transpose_mxn, which for float resolves to the
+// in-register AVX2 8x8 / AVX512 16x16 shuffle kernels; other dtypes get the
+// generic unrolled tile, which still keeps both streams cache resident.
+template <typename scalar_t>
+static void transpose_copy_matrix(
+    const scalar_t* sp,
+    scalar_t* rp,
+    int64_t R,
+    int64_t nr,
+    int64_t NR,
+    int64_t NC) {
+  constexpr int64_t kTile = std::is_same_v<scalar_t, float>
+      ? static_cast<int64_t>(vec::Vectorized<float>::size())
+      : 8;
+  // Edge of the square block a tile sweep works on; sized so a block of src
+  // columns plus the matching dst rows stay L1 resident.
+  constexpr int64_t kBlock = 4 * kTile;
+  for (int64_t C = 0; C < NC; C += kBlock) {
+    const int64_t nc = std::min(kBlock, NC - C);
+    for (int64_t r = 0; r < nr; r += kTile) {
+      const int64_t mr = std::min(kTile, nr - r);
+      for (int64_t c = 0; c < nc; c += kTile) {
+        const int64_t mc = std::min(kTile, nc - c);
+        if (mr == kTile && mc == kTile) {
+          vec::transpose_mxn<scalar_t, kTile, kTile>(
+              sp + (C + c) * NR + (R + r),
+              NR,
+              rp + (R + r) * NC + (C + c),
+              NC);
+        } else {
+          for (const auto j : c10::irange(mr)) {
+            for (const auto i : c10::irange(mc)) {
+              rp[(R + r + j) * NC + (C + c + i)] =
+                  sp[(R + r + j) + (C + c + i) * NR];
+            }
+          }
+        }
+      }
+    }
+  }
+}
+
+void transpose_copy_kernel_impl(const TensorBase& self, const TensorBase& src) {
+  // Validated by copy_transpose_valid: same sizes and dtype, self
+  // contiguous, src contiguous with its last two dims swapped.
+  const int64_t NR = src.size(-2);
+  const int64_t NC = src.size(-1);
+  const int64_t batch = src.numel() / (NR * NC);
+  _AT_DISPATCH_CP_TYPES(self.scalar_type(), "transpose_copy_kernel", [&] {
+    const scalar_t* sp = src.const_data_ptr<scalar_t>();
+    scalar_t* rp = self.mutable_data_ptr<scalar_t>();
+    // Parallelize over batches and row blocks; each task transposes a full
+    // stripe of rows so no two tasks write the same dst cache line.
+    constexpr int64_t kRowBlock = 256;
+    const int64_t row_blocks = divup(NR, kRowBlock);
+    const int64_t grain_size = std::max<int64_t>(
+        1, at::internal::GRAIN_SIZE / (kRowBlock * NC));
+    at::parallel_for(
+        0, batch * row_blocks, grain_size, [&](int64_t begin, int64_t end) {
+          for (const auto task : c10::irange(begin, end)) {
+            const int64_t b = task / row_blocks;
+            const int64_t R = (task % row_blocks) * kRowBlock;
+            transpose_copy_matrix<scalar_t>(
+                sp + b * NR * NC,
+                rp + b * NR * NC,
+                R,
+                std::min(kRowBlock, NR - R),
+                NR,
+                NC);
+          }
+        });
+  });
+}
+
 } // namespace CPU_CAPABILITY
 
 REGISTER_DISPATCH(copy_stub, &copy_kernel);
+REGISTER_DISPATCH(transpose_copy_kernel, &transpose_copy_kernel_impl);
 
 } // namespace at::native
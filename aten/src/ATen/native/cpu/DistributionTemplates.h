@@ -4,6 +4,7 @@
 #include <ATen/Dispatch.h>
 #include <ATen/ExpandBase.h>
 #include <ATen/core/DistributionsHelper.h>
+#include <ATen/core/PhiloxRNGEngine.h>
 #include <ATen/native/TensorIterator.h>
 #include <ATen/native/cpu/Loops.h>
 #include <limits>
@@ -21,6 +22,24 @@ namespace templates {
 namespace cpu {
 namespace {
 
+// ================================================= Philox slabs =====================================================
+
+// The kernels below run serially under the generator mutex because the
+// mt19937 engine produces a single sequential stream. Kernels that want to
+// draw random numbers from several threads at once (e.g. MC-dropout style
+// inference) can instead carve the generator's Philox counter space into
+// per-thread slabs: one locked reservation buys `increment` 128-bit counter
+// values (four 32-bit randoms each), and the returned engine can then be used
+// lock-free until the slab drains. Slabs reserved by different threads never
+// overlap, so the only synchronization cost is the single reservation.
+template<typename RNG>
+at::Philox4_32 reserve_philox_slab(RNG generator, uint64_t increment) {
+  // See Note [Acquire lock when using random generators]
+  std::lock_guard<std::mutex> lock(generator->mutex_);
+  auto seed_offset = generator->philox_engine_inputs(increment);
+  return at::Philox4_32(seed_offset.first, 0, seed_offset.second);
+}
+
 // ==================================================== Random ========================================================
 
 template<typename RNG>
@@ -0,0 +1,69 @@
+#pragma once
+
+#include <ATen/TensorIterator.h>
+#include <ATen/cpu/vec/vec.h>
+#include <ATen/native/ElementwiseChainFusion.h>
+
+// Kernel-side helpers for chain_fusion (see ElementwiseChainFusion.h). Each
+// helper wraps the kernel's scalar and vector functors into a BlockFn
+// compiled with this translation unit's CPU capability and hands it to the
+// recorder. Kernels call these before their normal cpu_kernel_vec loop and
+// bail out when the op was deferred.
+
+namespace at::native {
+inline namespace CPU_CAPABILITY {
+
+// Unary view of the op: extra scalar operands are baked into the functors.
+template <typename scalar_op_t, typename vec_op_t>
+bool try_chain_unary(
+    TensorIteratorBase& iter,
+    scalar_op_t scalar_op,
+    vec_op_t vec_op) {
+  if (!chain_fusion::enabled()) {
+    return false;
+  }
+  return chain_fusion::tryRecordInplace(
+      iter, [scalar_op, vec_op](float* data, int64_t begin, int64_t len) {
+        using fVec = vec::Vectorized<float>;
+        float* ptr = data + begin;
+        int64_t d = 0;
+        for (; d <= len - fVec::size(); d += fVec::size()) {
+          vec_op(fVec::loadu(ptr + d)).store(ptr + d);
+        }
+        for (; d < len; d++) {
+          ptr[d] = scalar_op(ptr[d]);
+        }
+      });
+}
+
+// Binary with a same-shape dense tensor operand, read in lockstep. `other`
+// stays valid until materialization because the recorder keeps all of the
+// iterator's tensors alive.
+template <typename scalar_op_t, typename vec_op_t>
+bool try_chain_binary(
+    TensorIteratorBase& iter,
+    const float* other,
+    scalar_op_t scalar_op,
+    vec_op_t vec_op) {
+  if (!chain_fusion::enabled()) {
+    return false;
+  }
+  return chain_fusion::tryRecordInplace(
+      iter,
+      [other, scalar_op, vec_op](float* data, int64_t begin, int64_t len) {
+        using fVec = vec::Vectorized<float>;
+        float* ptr = data + begin;
+        const float* other_ptr = other + begin;
+        int64_t d = 0;
+        for (; d <= len - fVec::size(); d += fVec::size()) {
+          vec_op(fVec::loadu(ptr + d), fVec::loadu(other_ptr + d))
+              .store(ptr + d);
+        }
+        for (; d < len; d++) {
+          ptr[d] = scalar_op(ptr[d], other_ptr[d]);
+        }
+      });
+}
+
+} // namespace CPU_CAPABILITY
+} // namespace at::native
@@ -266,6 +266,214 @@ void cpu_flash_attention(
 
 }
 
+// Jagged variant of cpu_flash_attention for nested tensor input. The
+// query/key/value buffers are packed as (total_seq x num_heads x head_size)
+// without padding; per-sequence extents come from the cumulative sequence
+// length tensors. The tiling is the same as the dense kernel, except the
+// query slices are clamped to each sequence's own length, so short sequences
+// do not pay for the batch maximum.
+template <typename scalar_t, int64_t q_split_size, int64_t kv_split_size>
+void cpu_flash_attention_varlen(
+    const Tensor& output,
+    const Tensor& logsumexp,
+    const at::Tensor& query,
+    const at::Tensor& key,
+    const at::Tensor& value,
+    const Tensor& cum_seq_q,
+    const Tensor& cum_seq_k,
+    int64_t max_q,
+    int64_t max_k,
+    bool is_causal,
+    c10::optional<double> scale) {
+  constexpr bool is_reduced_type = is_reduced_floating_point_v<scalar_t>;
+  using accum_t = at::opmath_type<scalar_t>;
+  using Vec = vec::Vectorized<accum_t>;
+  accum_t scaling_factor =
+      sdp::calculate_scale(query, scale).as_float_unchecked();
+
+  TORCH_CHECK((query.size(2) == value.size(2)) && (key.size(2) == value.size(2)),
+        "scaled_dot_product_attention_flash_attention: Q/K/V should have the same head size");
+  int64_t batchSize = cum_seq_q.numel() - 1;
+  int64_t num_head = query.size(1);
+  int64_t headSize = query.size(2);
+
+  // Strides (packed layout: total_seq x num_heads x head_size)
+  int64_t qStrideM = query.stride(0);
+  int64_t qStrideH = query.stride(1);
+  int64_t kStrideN = key.stride(0);
+  int64_t kStrideH = key.stride(1);
+  int64_t vStrideN = value.stride(0);
+  int64_t vStrideH = value.stride(1);
+  int64_t oStrideM = output.stride(0);
+  int64_t oStrideH = output.stride(1);
+  int64_t lStrideM = logsumexp.stride(0);
+  int64_t lStrideH = logsumexp.stride(1);
+
+  int64_t qSplitSize = q_split_size > max_q ? max_q : q_split_size;
+  int64_t kvSplitSize = kv_split_size > max_k ? max_k : kv_split_size;
+  int64_t qSlice = (max_q - 1) / qSplitSize + 1;
+  int64_t num_thread = at::get_num_threads();
+
+  const auto accumulate_dtype = toOpMathType(query.scalar_type());
+
+  // allocate per thread temp buf (accumulate type)
+  int64_t size_per_thread =
+      /* qk     */ qSplitSize * kvSplitSize +
+      /* qk_max */ qSplitSize +
+      /* qk_sum */ qSplitSize +
+      /* dst    */ qSplitSize * headSize;
+
+  at::Tensor buf = at::empty({num_thread, size_per_thread}, query.options().dtype(accumulate_dtype));
+  at::Tensor buf_reduced = at::empty({num_thread, qSplitSize, is_reduced_type ? kvSplitSize : 0}, query.options());
+
+  // Data ptrs
+  scalar_t* q_data = query.data_ptr<scalar_t>();
+  scalar_t* k_data = key.data_ptr<scalar_t>();
+  scalar_t* v_data = value.data_ptr<scalar_t>();
+  scalar_t* out_data = output.data_ptr<scalar_t>();
+  accum_t* lse_data = logsumexp.data_ptr<accum_t>();
+  accum_t* buf_data = buf.data_ptr<accum_t>();
+  scalar_t* buf_reduced_data = is_reduced_type ? buf_reduced.data_ptr<scalar_t>() : nullptr;
+  const int64_t* cum_seq_q_data = cum_seq_q.data_ptr<int64_t>();
+  const int64_t* cum_seq_k_data = cum_seq_k.data_ptr<int64_t>();
+
+  at::parallel_for(0, batchSize * num_head * qSlice, 1, [&](int64_t begin, int64_t end) {
+    int64_t i = 0, j = 0, k = 0;
+    data_index_init(begin, i, batchSize, j, num_head, k, qSlice);
+    int ompIdx = at::get_thread_num();
+    accum_t* buf_ptr = buf_data + ompIdx * size_per_thread;
+    accum_t* qk_data = buf_ptr;
+    accum_t* qk_max_data = qk_data + qSplitSize * kvSplitSize;
+    accum_t* qk_sum_data = qk_max_data + qSplitSize;
+    accum_t* dst_data = qk_sum_data + qSplitSize;
+    scalar_t* qk_reduced_data = is_reduced_type ? buf_reduced_data + ompIdx * qSplitSize * kvSplitSize : nullptr;
+
+    for (const auto z : c10::irange(begin, end)) {
+      (void)z; // Suppress unused variable
+      // Per-sequence extents and offsets into the packed buffers
+      int64_t qOffset = cum_seq_q_data[i];
+      int64_t kvOffset = cum_seq_k_data[i];
+      int64_t qSize = cum_seq_q_data[i + 1] - qOffset;
+      int64_t kvSize = cum_seq_k_data[i + 1] - kvOffset;
+      int64_t m = k * qSplitSize;
+      // Query slices are tiled to the batch maximum; slices that fall
+      // beyond this sequence's length have no work.
+      if (m >= qSize || kvSize == 0) {
+        data_index_step(i, batchSize, j, num_head, k, qSlice);
+        continue;
+      }
+      int64_t qBlockSize = std::min(qSplitSize, qSize - m);
+      // Initialize max and sum
+      fill_stub(qk_max_data,
+          -std::numeric_limits<accum_t>::infinity(), qBlockSize);
+      fill_stub(qk_sum_data,
+          static_cast<accum_t>(0), qBlockSize);
+      int64_t num_keys = is_causal ? std::min(m + qBlockSize, kvSize) : kvSize;
+      for (int64_t n = 0; n < num_keys; n += kvSplitSize) {
+        int64_t kvBlockSize = std::min(kvSplitSize, kvSize - n);
+        // Calculate scale * q @ k.T
+        cpublas::gemm(
+            TransposeType::Transpose,
+            TransposeType::NoTranspose,
+            kvBlockSize,
+            qBlockSize,
+            headSize,
+            scaling_factor,
+            k_data + (kvOffset + n) * kStrideN + j * kStrideH,
+            kStrideN,
+            q_data + (qOffset + m) * qStrideM + j * qStrideH,
+            qStrideM,
+            static_cast<accum_t>(0),
+            qk_data,
+            kvBlockSize);
+        // Apply causal mask, fill unused with -inf
+        if (is_causal && num_keys - n <= kvSplitSize) {
+          for (const auto row : c10::irange(qBlockSize)) {
+            int64_t last_col = m + row - n;
+            accum_t* row_ptr = qk_data + row * kvBlockSize;
+            fill_stub(row_ptr + last_col + 1,
+                -std::numeric_limits<accum_t>::infinity(),
+                kvBlockSize - last_col - 1);
+          }
+        }
+        // Update coefficients with Softmax
+        accum_t tmp_max = 0, tmp_sum = 0, sum_old = 0, exp_tmp = 0;
+        for (int64_t row = 0; row < qBlockSize; ++row) {
+          sum_old = qk_sum_data[row];
+          // max per row
+          tmp_max = vec::reduce_all<accum_t>(
+            [](Vec& x, Vec& y) { return vec::maximum(x, y); },
+            qk_data + row * kvBlockSize, kvBlockSize);
+          tmp_max = qk_max_data[row] > tmp_max ? qk_max_data[row] : tmp_max;
+          // qk <- exp(qk - max)
+          vec::map<accum_t>(
+            [tmp_max](Vec x) { return (x - Vec(tmp_max)).exp(); },
+            qk_data + row * kvBlockSize, qk_data + row * kvBlockSize, kvBlockSize);
+          // sum per row
+          tmp_sum = vec::reduce_all<accum_t>(
+            [](Vec& x, Vec& y) { return x + y; },  qk_data + row * kvBlockSize, kvBlockSize);
+          // exp_tmp <- exp(max[row] - max)
+          exp_tmp = std::exp(qk_max_data[row] - tmp_max);
+          // sum[row] <- sum + exp_tmp * sum[row]
+          qk_sum_data[row] = tmp_sum + exp_tmp * qk_sum_data[row];
+          // max[row] <- max
+          qk_max_data[row] = tmp_max;
+          // qk <- qk / sum[row]
+          accum_t sum_new = qk_sum_data[row];
+          vec::map<accum_t>(
+            [sum_new](Vec x) { return x / Vec(sum_new); },
+            qk_data + row * kvBlockSize, qk_data + row * kvBlockSize, kvBlockSize);
+          if (is_reduced_type) {
+            convert<accum_t, scalar_t>(
+              qk_data + row * kvBlockSize,
+              qk_reduced_data + row * kvBlockSize,
+              kvBlockSize);
+          }
+          // dst <- dst * sum_old / sum_new * exp_tmp
+          if (n > 0) {
+            accum_t sum_cor = sum_old / sum_new;
+            vec::map<accum_t>(
+              [sum_cor, exp_tmp](Vec x)
+              { return x * Vec(sum_cor) * Vec(exp_tmp); },
+              dst_data + row * headSize, dst_data + row * headSize, headSize);
+          }
+        }
+        // Calculate Softmax(q @ k.T) @ v
+        cpublas::gemm(
+            TransposeType::NoTranspose,
+            TransposeType::NoTranspose,
+            headSize,
+            qBlockSize,
+            kvBlockSize,
+            static_cast<accum_t>(1),
+            v_data + (kvOffset + n) * vStrideN + j * vStrideH,
+            vStrideN,
+            conditional_data_ptr(qk_data, qk_reduced_data),
+            kvBlockSize,
+            n == 0 ? static_cast<accum_t>(0) : static_cast<accum_t>(1),
+            dst_data,
+            headSize);
+      }
+      // reorder MHA output with strides
+      for (int64_t row = 0; row < qBlockSize; ++row) {
+        vec::map<scalar_t>(
+          [](Vec x) { return x; },
+          out_data + (qOffset + m + row) * oStrideM + j * oStrideH,
+          dst_data + row * headSize,
+          headSize);
+      }
+      // Store logsumexp for backward
+      accum_t* lse_ptr = lse_data + (qOffset + m) * lStrideM + j * lStrideH;
+      for (const auto row : c10::irange(qBlockSize)) {
+        lse_ptr[row * lStrideM] = qk_max_data[row]
+            + std::log(qk_sum_data[row]);
+      }
+      // Move to the next query
+      data_index_step(i, batchSize, j, num_head, k, qSlice);
+    }
+  });
+}
+
 template <typename scalar_t, int64_t q_split_size, int64_t kv_split_size>
 void cpu_flash_attention_backward(
     const at::Tensor& grad_q,
@@ -574,6 +782,35 @@ void flash_attention_kernel_impl(
   });
 }
 
+void flash_attention_varlen_kernel_impl(
+    const Tensor& output,
+    const Tensor& logsumexp,
+    const at::Tensor& query,
+    const at::Tensor& key,
+    const at::Tensor& value,
+    const Tensor& cum_seq_q,
+    const Tensor& cum_seq_k,
+    int64_t max_q,
+    int64_t max_k,
+    bool is_causal,
+    c10::optional<double> scale) {
+  AT_DISPATCH_FLOATING_TYPES_AND(kBFloat16, query.scalar_type(), "flash_attention_varlen", [&] {
+    if (max_q >= 768) {
+      cpu_flash_attention_varlen<scalar_t, 256, 512>(
+        output, logsumexp, query, key, value,
+        cum_seq_q, cum_seq_k, max_q, max_k, is_causal, scale);
+    } else if (max_q >= 192) {
+      cpu_flash_attention_varlen<scalar_t, 64, 512>(
+        output, logsumexp, query, key, value,
+        cum_seq_q, cum_seq_k, max_q, max_k, is_causal, scale);
+    } else {
+      cpu_flash_attention_varlen<scalar_t, 32, 512>(
+        output, logsumexp, query, key, value,
+        cum_seq_q, cum_seq_k, max_q, max_k, is_causal, scale);
+    }
+  });
+}
+
 void flash_attention_backward_kernel_impl(
     const at::Tensor& grad_q,
     const at::Tensor& grad_k,
@@ -625,6 +862,7 @@ void flash_attention_backward_kernel_impl(
 } // anonymous namespace
 
 ALSO_REGISTER_AVX512_DISPATCH(flash_attention_kernel, &flash_attention_kernel_impl);
+ALSO_REGISTER_AVX512_DISPATCH(flash_attention_varlen_kernel, &flash_attention_varlen_kernel_impl);
 ALSO_REGISTER_AVX512_DISPATCH(flash_attention_backward_kernel, &flash_attention_backward_kernel_impl);
 
 } // at::native
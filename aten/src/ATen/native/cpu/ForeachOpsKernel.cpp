@@ -0,0 +1,243 @@
+#define TORCH_ASSERT_NO_OPERATORS
+#include <ATen/native/ForeachKernels.h>
+
+#include <ATen/Dispatch.h>
+#include <ATen/Parallel.h>
+#include <ATen/cpu/vec/functional.h>
+#include <ATen/cpu/vec/vec.h>
+#include <ATen/native/Lerp.h>
+#include <c10/util/irange.h>
+
+#include <algorithm>
+#include <vector>
+
+namespace at::native {
+
+namespace {
+
+// The tensor lists are flattened into fixed-size chunks so one parallel_for
+// spreads the whole multi-tensor apply over threads: many small tensors no
+// longer run one after another, and a single large tensor still splits
+// across cores. All kernels assume the gate in ForeachOpsKernels.cpp has
+// verified contiguous same-dtype CPU tensors of matching sizes.
+
+constexpr int64_t kForeachChunkSize = 32768;
+
+struct ForeachChunk {
+  int64_t tensor_idx;
+  int64_t offset;
+  int64_t length;
+};
+
+std::vector<ForeachChunk> build_foreach_chunks(TensorList tensors) {
+  std::vector<ForeachChunk> chunks;
+  for (const auto i : c10::irange(tensors.size())) {
+    const int64_t numel = tensors[i].numel();
+    for (int64_t offset = 0; offset < numel; offset += kForeachChunkSize) {
+      chunks.push_back(
+          {static_cast<int64_t>(i),
+           offset,
+           std::min(kForeachChunkSize, numel - offset)});
+    }
+  }
+  return chunks;
+}
+
+template <typename scalar_t>
+std::vector<scalar_t*> foreach_data_ptrs(TensorList tensors) {
+  std::vector<scalar_t*> ptrs(tensors.size());
+  for (const auto i : c10::irange(tensors.size())) {
+    ptrs[i] = tensors[i].data_ptr<scalar_t>();
+  }
+  return ptrs;
+}
+
+template <typename scalar_t, typename vec_op_t>
+void foreach_unary_(TensorList self, const vec_op_t& vec_op) {
+  const auto chunks = build_foreach_chunks(self);
+  const auto self_ptrs = foreach_data_ptrs<scalar_t>(self);
+  at::parallel_for(
+      0,
+      static_cast<int64_t>(chunks.size()),
+      1,
+      [&](int64_t begin, int64_t end) {
+        for (const auto c : c10::irange(begin, end)) {
+          const auto& chunk = chunks[c];
+          scalar_t* ptr = self_ptrs[chunk.tensor_idx] + chunk.offset;
+          vec::map<scalar_t>(vec_op, ptr, ptr, chunk.length);
+        }
+      });
+}
+
+template <typename scalar_t, typename vec_op_t>
+void foreach_binary_list_(
+    TensorList self,
+    TensorList other,
+    const vec_op_t& vec_op) {
+  const auto chunks = build_foreach_chunks(self);
+  const auto self_ptrs = foreach_data_ptrs<scalar_t>(self);
+  const auto other_ptrs = foreach_data_ptrs<scalar_t>(other);
+  at::parallel_for(
+      0,
+      static_cast<int64_t>(chunks.size()),
+      1,
+      [&](int64_t begin, int64_t end) {
+        for (const auto c : c10::irange(begin, end)) {
+          const auto& chunk = chunks[c];
+          scalar_t* self_ptr = self_ptrs[chunk.tensor_idx] + chunk.offset;
+          const scalar_t* other_ptr =
+              other_ptrs[chunk.tensor_idx] + chunk.offset;
+          vec::map2<scalar_t>(
+              vec_op, self_ptr, self_ptr, other_ptr, chunk.length);
+        }
+      });
+}
+
+template <typename scalar_t, typename vec_op_t>
+void foreach_pointwise_(
+    TensorList self,
+    TensorList tensors1,
+    TensorList tensors2,
+    const vec_op_t& vec_op) {
+  const auto chunks = build_foreach_chunks(self);
+  const auto self_ptrs = foreach_data_ptrs<scalar_t>(self);
+  const auto t1_ptrs = foreach_data_ptrs<scalar_t>(tensors1);
+  const auto t2_ptrs = foreach_data_ptrs<scalar_t>(tensors2);
+  at::parallel_for(
+      0,
+      static_cast<int64_t>(chunks.size()),
+      1,
+      [&](int64_t begin, int64_t end) {
+        for (const auto c : c10::irange(begin, end)) {
+          const auto& chunk = chunks[c];
+          scalar_t* self_ptr = self_ptrs[chunk.tensor_idx] + chunk.offset;
+          const scalar_t* t1_ptr = t1_ptrs[chunk.tensor_idx] + chunk.offset;
+          const scalar_t* t2_ptr = t2_ptrs[chunk.tensor_idx] + chunk.offset;
+          vec::map3<scalar_t>(
+              vec_op, self_ptr, self_ptr, t1_ptr, t2_ptr, chunk.length);
+        }
+      });
+}
+
+void foreach_add_scalar_kernel(TensorList self, const Scalar& scalar) {
+  AT_DISPATCH_FLOATING_TYPES(
+      self[0].scalar_type(), "foreach_add_scalar_cpu", [&]() {
+        using Vec = vec::Vectorized<scalar_t>;
+        const Vec a(scalar.to<scalar_t>());
+        foreach_unary_<scalar_t>(self, [a](Vec x) { return x + a; });
+      });
+}
+
+void foreach_mul_scalar_kernel(TensorList self, const Scalar& scalar) {
+  AT_DISPATCH_FLOATING_TYPES(
+      self[0].scalar_type(), "foreach_mul_scalar_cpu", [&]() {
+        using Vec = vec::Vectorized<scalar_t>;
+        const Vec a(scalar.to<scalar_t>());
+        foreach_unary_<scalar_t>(self, [a](Vec x) { return x * a; });
+      });
+}
+
+void foreach_sqrt_kernel(TensorList self) {
+  AT_DISPATCH_FLOATING_TYPES(
+      self[0].scalar_type(), "foreach_sqrt_cpu", [&]() {
+        using Vec = vec::Vectorized<scalar_t>;
+        foreach_unary_<scalar_t>(self, [](Vec x) { return x.sqrt(); });
+      });
+}
+
+void foreach_add_list_kernel(
+    TensorList self,
+    TensorList other,
+    const Scalar& alpha) {
+  AT_DISPATCH_FLOATING_TYPES(
+      self[0].scalar_type(), "foreach_add_list_cpu", [&]() {
+        using Vec = vec::Vectorized<scalar_t>;
+        const Vec a(alpha.to<scalar_t>());
+        foreach_binary_list_<scalar_t>(
+            self, other, [a](Vec x, Vec y) { return vec::fmadd(y, a, x); });
+      });
+}
+
+void foreach_mul_list_kernel(TensorList self, TensorList other) {
+  AT_DISPATCH_FLOATING_TYPES(
+      self[0].scalar_type(), "foreach_mul_list_cpu", [&]() {
+        using Vec = vec::Vectorized<scalar_t>;
+        foreach_binary_list_<scalar_t>(
+            self, other, [](Vec x, Vec y) { return x * y; });
+      });
+}
+
+void foreach_lerp_list_kernel(
+    TensorList self,
+    TensorList other,
+    const Scalar& weight) {
+  AT_DISPATCH_FLOATING_TYPES(
+      self[0].scalar_type(), "foreach_lerp_list_cpu", [&]() {
+        using Vec = vec::Vectorized<scalar_t>;
+        const scalar_t w = weight.to<scalar_t>();
+        // Same two-sided formula as the per-tensor lerp kernel (see
+        // Lerp.h) so results match the slow path bit for bit.
+        if (is_lerp_weight_small(w)) {
+          const Vec w_vec(w);
+          foreach_binary_list_<scalar_t>(
+              self, other, [w_vec](Vec x, Vec y) {
+                return x + w_vec * (y - x);
+              });
+        } else {
+          const Vec one_minus_w_vec(scalar_t(1) - w);
+          foreach_binary_list_<scalar_t>(
+              self, other, [one_minus_w_vec](Vec x, Vec y) {
+                return y - (y - x) * one_minus_w_vec;
+              });
+        }
+      });
+}
+
+void foreach_addcmul_scalar_kernel(
+    TensorList self,
+    TensorList tensors1,
+    TensorList tensors2,
+    const Scalar& value) {
+  AT_DISPATCH_FLOATING_TYPES(
+      self[0].scalar_type(), "foreach_addcmul_scalar_cpu", [&]() {
+        using Vec = vec::Vectorized<scalar_t>;
+        const Vec v(value.to<scalar_t>());
+        foreach_pointwise_<scalar_t>(
+            self, tensors1, tensors2, [v](Vec a, Vec b, Vec c) {
+              return vec::fmadd(v, b * c, a);
+            });
+      });
+}
+
+void foreach_addcdiv_scalar_kernel(
+    TensorList self,
+    TensorList tensors1,
+    TensorList tensors2,
+    const Scalar& value) {
+  AT_DISPATCH_FLOATING_TYPES(
+      self[0].scalar_type(), "foreach_addcdiv_scalar_cpu", [&]() {
+        using Vec = vec::Vectorized<scalar_t>;
+        const Vec v(value.to<scalar_t>());
+        foreach_pointwise_<scalar_t>(
+            self, tensors1, tensors2, [v](Vec a, Vec b, Vec c) {
+              return vec::fmadd(v, b / c, a);
+            });
+      });
+}
+
+} // namespace
+
+REGISTER_DISPATCH(foreach_add_scalar_fused_stub, &foreach_add_scalar_kernel);
+REGISTER_DISPATCH(foreach_mul_scalar_fused_stub, &foreach_mul_scalar_kernel);
+REGISTER_DISPATCH(foreach_add_list_fused_stub, &foreach_add_list_kernel);
+REGISTER_DISPATCH(foreach_lerp_list_fused_stub, &foreach_lerp_list_kernel);
+REGISTER_DISPATCH(foreach_mul_list_fused_stub, &foreach_mul_list_kernel);
+REGISTER_DISPATCH(foreach_sqrt_fused_stub, &foreach_sqrt_kernel);
+REGISTER_DISPATCH(
+    foreach_addcmul_scalar_fused_stub,
+    &foreach_addcmul_scalar_kernel);
+REGISTER_DISPATCH(
+    foreach_addcdiv_scalar_fused_stub,
+    &foreach_addcdiv_scalar_kernel);
+
+} // namespace at::native
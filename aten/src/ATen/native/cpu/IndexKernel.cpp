@@ -3,6 +3,8 @@
 
 #include <cmath>
 #include <iostream>
+#include <memory>
+#include <tuple>
 
 #include <ATen/Context.h>
 #include <ATen/Dispatch.h>
@@ -11,6 +13,7 @@
 #include <ATen/native/cpu/AtomicAddFloat.h>
 #include <ATen/native/cpu/IndexKernelUtils.h>
 #include <ATen/native/cpu/Loops.h>
+#include <ATen/native/cpu/RadixSortUtils.h>
 #include <ATen/cpu/vec/vec.h>
 #include <c10/util/irange.h>
 #include <c10/core/Scalar.h>
@@ -149,6 +152,114 @@ void take_kernel(
     });
 }
 
+// The sort-based accumulate path handles the flat scatter case: a single
+// index tensor and a destination operand that does not advance with the
+// iteration, so every write lands at dst_base + index * stride. This covers
+// e.g. fully indexed 1-d destinations (point-cloud voxelization and
+// embedding-bag style scatters).
+bool can_use_sorted_index_put_accum(TensorIterator& iter) {
+  if (iter.ntensors() != 3) {
+    return false;
+  }
+  // Sorting only pays off (and only helps with write conflicts) for large
+  // parallel runs.
+  if (iter.numel() < internal::GRAIN_SIZE || at::get_num_threads() <= 1) {
+    return false;
+  }
+  for (const auto s : iter.strides(0)) {
+    if (s != 0) {
+      return false;
+    }
+  }
+  return true;
+}
+
+// Accumulates duplicate indices without atomics or serialization: gather
+// (index, value) pairs, radix-sort them by index, then reduce each run of
+// equal indices and do a single read-modify-write per destination element.
+// The sort is stable and segments are always reduced whole and in original
+// iteration order, so the result does not depend on the thread count.
+template <typename scalar_t>
+void cpu_index_put_sorted_accum_kernel(
+    TensorIterator& iter,
+    IntArrayRef index_size,
+    IntArrayRef index_stride) {
+  const int64_t numel = iter.numel();
+  const int64_t size = index_size[0];
+  const int64_t stride = index_stride[0];
+  char* const dst_base = reinterpret_cast<char*>(iter.data_ptr(0));
+
+  auto keys = std::make_unique<uint64_t[]>(numel);
+  auto vals = std::make_unique<scalar_t[]>(numel);
+  auto positions = std::make_unique<int64_t[]>(numel);
+
+  // Gather normalized indices and source values in iteration order. Each
+  // range keeps its own cursor because the loop body is not told its global
+  // offset; serial_for_each on disjoint ranges may run concurrently (this is
+  // exactly how for_each parallelizes).
+  at::parallel_for(
+      0, numel, internal::GRAIN_SIZE, [&](int64_t begin, int64_t end) {
+        int64_t pos = begin;
+        auto loop = [&](char** data, const int64_t* strides, int64_t n) {
+          char* src = data[1];
+          char* index_bytes = data[2];
+          for (const auto i : c10::irange(n)) {
+            int64_t value =
+                *reinterpret_cast<int64_t*>(index_bytes + i * strides[2]);
+            TORCH_CHECK_INDEX(
+                value >= -size && value < size,
+                "index ", value,
+                " is out of bounds for dimension 0 with size ", size);
+            if (value < 0) {
+              value += size;
+            }
+            keys[pos] = static_cast<uint64_t>(value);
+            vals[pos] = *reinterpret_cast<scalar_t*>(src + i * strides[1]);
+            positions[pos] = pos;
+            ++pos;
+          }
+        };
+        iter.serial_for_each(loop, {begin, end});
+      });
+
+  auto tmp_keys = std::make_unique<uint64_t[]>(numel);
+  auto tmp_positions = std::make_unique<int64_t[]>(numel);
+  uint64_t* sorted_keys = nullptr;
+  int64_t* sorted_positions = nullptr;
+  std::tie(sorted_keys, sorted_positions) = radix_sort_pairs(
+      keys.get(),
+      positions.get(),
+      tmp_keys.get(),
+      tmp_positions.get(),
+      numel);
+
+  at::parallel_for(
+      0, numel, internal::GRAIN_SIZE, [&](int64_t begin, int64_t end) {
+        int64_t i = begin;
+        if (i > 0) {
+          // A segment straddling the range start belongs to the thread that
+          // owns its first element; skip it here so every segment is reduced
+          // whole, by exactly one thread.
+          const uint64_t prev = sorted_keys[i - 1];
+          while (i < end && sorted_keys[i] == prev) {
+            ++i;
+          }
+        }
+        while (i < end) {
+          const uint64_t key = sorted_keys[i];
+          auto* dst = reinterpret_cast<scalar_t*>(
+              dst_base + static_cast<int64_t>(key) * stride);
+          scalar_t sum = *dst;
+          int64_t j = i;
+          for (; j < numel && sorted_keys[j] == key; ++j) {
+            sum += vals[sorted_positions[j]];
+          }
+          *dst = sum;
+          i = j;
+        }
+      });
+}
+
 void index_put_kernel(TensorIterator& iter, IntArrayRef index_size, IntArrayRef index_stride, bool accumulate) {
   // NOTE: duplicate indices are only supported if accumulate is true.
   AT_DISPATCH_ALL_TYPES_AND_COMPLEX_AND4(kComplexHalf, kHalf, kBool, kBFloat16,
@@ -158,6 +269,15 @@ void index_put_kernel(TensorIterator& iter, IntArrayRef index_size, IntArrayRef
     // must enable serial execution if deterministic algorithms are enabled.
     const bool is_deterministic = at::globalContext().deterministicAlgorithms();
     if (accumulate) {
+      if constexpr (std::is_same_v<scalar_t, float> || std::is_same_v<scalar_t, double>) {
+        // Sort-based scatter: parallel without atomics, and deterministic
+        // (thread-count independent), so it is usable in deterministic mode
+        // too, where accumulation otherwise runs serially.
+        if (can_use_sorted_index_put_accum(iter)) {
+          cpu_index_put_sorted_accum_kernel<scalar_t>(iter, index_size, index_stride);
+          return;
+        }
+      }
       bool use_parallel_for = (!is_deterministic) && (
         (iter.numel() >= internal::GRAIN_SIZE) && (at::get_num_threads() > 1));
       if (use_parallel_for && iter.dtype() == ScalarType::Float) {
@@ -0,0 +1,90 @@
+#define TORCH_ASSERT_NO_OPERATORS
+#include <ATen/native/TensorAdvancedIndexing.h>
+
+#include <ATen/Dispatch.h>
+#include <ATen/Parallel.h>
+#include <ATen/core/Tensor.h>
+#include <ATen/cpu/vec/functional.h>
+#include <ATen/cpu/vec/vec.h>
+#include <c10/util/irange.h>
+
+#include <algorithm>
+#include <vector>
+
+namespace at::native {
+
+namespace {
+
+template <typename scalar_t>
+inline void copy_row_vectorized(scalar_t* dst, const scalar_t* src, int64_t n) {
+  using Vec = vec::Vectorized<scalar_t>;
+  int64_t d = 0;
+  for (; d <= n - Vec::size(); d += Vec::size()) {
+    Vec::loadu(src + d).store(dst + d);
+  }
+  for (; d < n; d++) {
+    dst[d] = src[d];
+  }
+}
+
+template <typename scalar_t, typename index_t>
+void index_select_cat_impl(
+    const Tensor& result,
+    TensorList tensors,
+    TensorList indices) {
+  const int64_t batch = indices[0].numel();
+  const int64_t total_dim = result.size(1);
+  scalar_t* result_data = result.data_ptr<scalar_t>();
+
+  // Per-table source pointers, row widths, and output column offsets.
+  const auto ntables = tensors.size();
+  std::vector<const scalar_t*> src_data(ntables);
+  std::vector<const index_t*> idx_data(ntables);
+  std::vector<int64_t> row_width(ntables);
+  std::vector<int64_t> num_rows(ntables);
+  std::vector<int64_t> col_offset(ntables);
+  int64_t offset = 0;
+  for (const auto j : c10::irange(ntables)) {
+    src_data[j] = tensors[j].const_data_ptr<scalar_t>();
+    idx_data[j] = indices[j].const_data_ptr<index_t>();
+    row_width[j] = tensors[j].size(1);
+    num_rows[j] = tensors[j].size(0);
+    col_offset[j] = offset;
+    offset += row_width[j];
+  }
+
+  at::parallel_for(0, batch, internal::GRAIN_SIZE / std::max<int64_t>(total_dim, 1),
+      [&](int64_t begin, int64_t end) {
+    for (const auto b : c10::irange(begin, end)) {
+      scalar_t* out_row = result_data + b * total_dim;
+      for (const auto j : c10::irange(ntables)) {
+        const int64_t idx = static_cast<int64_t>(idx_data[j][b]);
+        TORCH_CHECK(idx >= 0 && idx < num_rows[j],
+            "_index_select_cat: index ", idx, " out of range for tensor ", j,
+            " with ", num_rows[j], " rows");
+        copy_row_vectorized(
+            out_row + col_offset[j],
+            src_data[j] + idx * row_width[j],
+            row_width[j]);
+      }
+    }
+  });
+}
+
+void index_select_cat_kernel(
+    const Tensor& result,
+    TensorList tensors,
+    TensorList indices) {
+  AT_DISPATCH_ALL_TYPES_AND2(ScalarType::Half, ScalarType::BFloat16,
+      result.scalar_type(), "index_select_cat", [&] {
+    AT_DISPATCH_INDEX_TYPES(indices[0].scalar_type(), "index_select_cat_index", [&] {
+      index_select_cat_impl<scalar_t, index_t>(result, tensors, indices);
+    });
+  });
+}
+
+} // anonymous namespace
+
+REGISTER_DISPATCH(index_select_cat_stub, &index_select_cat_kernel);
+
+} // namespace at::native
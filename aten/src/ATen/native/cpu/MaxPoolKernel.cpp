@@ -466,6 +466,197 @@ void cpu_max_pool_channels_last(
   }
 }
 
+// Index-free variant of cpu_max_pool for 2d: skips computing and storing
+// the indices tensor, a full extra output write in the common inference
+// case. `fuse_relu` folds relu into the final store: since the window max
+// is monotone, relu(max(window)) == max(max(window), 0). NaN still
+// propagates (NaN is taken as the window max and NaN < 0 is false).
+template <typename scalar_t>
+void cpu_max_pool2d_no_indices(
+    const Tensor& output_,
+    const Tensor& input_,
+    int kW, int kH,
+    int dW, int dH,
+    int padW, int padH,
+    int dilationW, int dilationH,
+    bool fuse_relu) {
+  auto input = input_.contiguous();
+  auto output = output_.contiguous();
+
+  auto input_data = input.data_ptr<scalar_t>();
+  auto output_data = output.data_ptr<scalar_t>();
+
+  int64_t ndim = input.ndimension();
+  // treat batch size and channels as one dimension
+  //   ndim == 3: CHW
+  //   ndim == 4: NCHW
+  int64_t channels = ndim == 3 ? input.size(0) : input.size(0) * input.size(1);
+  int64_t input_height = input.size(-2);
+  int64_t input_width = input.size(-1);
+  int64_t output_height = output.size(-2);
+  int64_t output_width = output.size(-1);
+
+  using opmath_t = at::opmath_type<scalar_t>;
+  // parallel on dim N, C
+  at::parallel_for(0, channels, 0, [&](int64_t begin, int64_t end) {
+    for (int64_t c = begin; c < end; c++) {
+      scalar_t* input_ptr = input_data + c * input_height * input_width;
+      scalar_t* output_ptr = output_data + c * output_height * output_width;
+
+      for (int64_t oh = 0; oh < output_height; oh++) {
+        int64_t ih0 = oh * dH - padH;
+        int64_t ih1 = std::min(ih0 + (kH - 1) * dilationH + 1, input_height);
+        while(ih0 < 0) { ih0 += dilationH; }
+
+        for (int64_t ow = 0; ow < output_width; ow++) {
+          int64_t iw0 = ow * dW - padW;
+          int64_t iw1 = std::min(iw0 + (kW - 1) * dilationW + 1, input_width);
+          while(iw0 < 0) { iw0 += dilationW; }
+
+          // compute local max
+          opmath_t maxval;
+          if (std::numeric_limits<opmath_t>::has_infinity) {
+            maxval = -std::numeric_limits<opmath_t>::infinity();
+          } else {
+            maxval = std::numeric_limits<opmath_t>::min();
+          }
+
+          for (int64_t ih = ih0; ih < ih1; ih += dilationH) {
+            for (int64_t iw = iw0; iw < iw1; iw += dilationW) {
+              opmath_t val = input_ptr[ih * input_width + iw];
+              if ((val > maxval) || is_nan(static_cast<double>(val))) {
+                maxval = val;
+              }
+            }
+          }
+
+          if (fuse_relu && maxval < opmath_t(0)) {
+            maxval = opmath_t(0);
+          }
+          output_ptr[oh * output_width + ow] = scalar_t(maxval);
+        }
+      }
+    }
+  });
+
+  if (!output_.is_contiguous()) {
+    output_.copy_(output);
+  }
+}
+
+template <typename scalar_t>
+void cpu_max_pool2d_no_indices_channels_last(
+    const Tensor& output_,
+    const Tensor& input_,
+    int kW, int kH,
+    int dW, int dH,
+    int padW, int padH,
+    int dilationW, int dilationH,
+    bool fuse_relu) {
+  int64_t ndim = input_.ndimension();
+  TORCH_CHECK(ndim == 4, "max pooling 2d with channels last format supports tensors with 4 dims");
+
+  auto memory_format = at::MemoryFormat::ChannelsLast;
+  auto input = input_.contiguous(memory_format);
+  auto output = output_.contiguous(memory_format);
+
+  auto input_data = input.data_ptr<scalar_t>();
+  auto output_data = output.data_ptr<scalar_t>();
+
+  int64_t nbatch = input.size(0);
+  int64_t channels = input.size(1);
+  int64_t input_height = input.size(-2);
+  int64_t input_width = input.size(-1);
+  int64_t output_height = output.size(-2);
+  int64_t output_width = output.size(-1);
+
+  using Vec = vec::Vectorized<scalar_t>;
+  // parallel on dim N, H, W; vectorize on dim C. No index buffers are
+  // needed, so the accumulator lives directly in the output row.
+  at::parallel_for(0, nbatch * output_height * output_width, 0, [&](int64_t begin, int64_t end) {
+    int64_t n = 0;
+    int64_t oh = 0;
+    int64_t ow = 0;
+    data_index_init(begin, n, nbatch, oh, output_height, ow, output_width);
+
+    int64_t size = channels;
+    int64_t len = size - (size % Vec::size());
+
+    for (int64_t i = begin; i < end; i++) {
+      int64_t ih0 = oh * dH - padH;
+      int64_t iw0 = ow * dW - padW;
+      int64_t ih1 = std::min(ih0 + (kH - 1) * dilationH + 1, input_height);
+      int64_t iw1 = std::min(iw0 + (kW - 1) * dilationW + 1, input_width);
+      while(ih0 < 0) { ih0 += dilationH; }
+      while(iw0 < 0) { iw0 += dilationW; }
+
+      scalar_t* out = output_data + i * channels;
+
+      // Pass I: init out lane
+      scalar_t fill;
+      if (std::numeric_limits<scalar_t>::has_infinity) {
+        fill = -std::numeric_limits<scalar_t>::infinity();
+      } else {
+        fill = std::numeric_limits<scalar_t>::min();
+      }
+      Vec fill_vec = Vec(fill);
+      int64_t d1 = 0;
+      for (; d1 < len; d1 += Vec::size()) {
+        fill_vec.store(out + d1);
+      }
+      for (; d1 < size; d1++) {
+        out[d1] = fill;
+      }
+
+      // Pass II: compute local max
+      for (int64_t ih = ih0; ih < ih1; ih += dilationH) {
+        for (int64_t iw = iw0; iw < iw1; iw += dilationW) {
+          scalar_t* in = input_data + (n * input_height * input_width +
+              ih * input_width + iw) * channels;
+
+          int64_t d2 = 0;
+          for (; d2 < len; d2 += Vec::size()) {
+            Vec val_vec = Vec::loadu(in + d2);
+            Vec maxval_vec = Vec::loadu(out + d2);
+            // true = all ones, false = all zeros
+            Vec mask = (val_vec > maxval_vec) | is_nan_vec(val_vec);
+            Vec out_vec = Vec::blendv(maxval_vec, val_vec, mask);
+            out_vec.store(out + d2);
+          }
+          for (; d2 < size; d2++) {
+            scalar_t val = in[d2];
+            if ((val > out[d2]) || is_nan(static_cast<double>(val))) {
+              out[d2] = val;
+            }
+          }
+        }
+      }
+
+      // Pass III: optionally fold relu into the result
+      if (fuse_relu) {
+        Vec zero_vec = Vec(scalar_t(0));
+        int64_t d3 = 0;
+        for (; d3 < len; d3 += Vec::size()) {
+          Vec out_vec = Vec::loadu(out + d3);
+          Vec mask = out_vec < zero_vec;
+          Vec::blendv(out_vec, zero_vec, mask).store(out + d3);
+        }
+        for (; d3 < size; d3++) {
+          if (out[d3] < scalar_t(0)) {
+            out[d3] = scalar_t(0);
+          }
+        }
+      }
+
+      // move on to next output index
+      data_index_step(n, nbatch, oh, output_height, ow, output_width);
+    }
+  });
+
+  if (!output_.is_contiguous(memory_format)) {
+    output_.copy_(output);
+  }
+}
 
 template <typename scalar_t, bool is_3d>
 void cpu_max_pool_backward(
@@ -620,6 +811,32 @@ void max_pool2d_kernel_impl(
   }
 }
 
+void max_pool2d_no_indices_kernel_impl(
+    const Tensor& output,
+    const Tensor& input,
+    int kW, int kH,
+    int dW, int dH,
+    int padW, int padH,
+    int dilationW, int dilationH,
+    bool fuse_relu) {
+  switch (input.suggest_memory_format()) {
+    case at::MemoryFormat::Contiguous: {
+      AT_DISPATCH_ALL_TYPES_AND2(ScalarType::BFloat16, ScalarType::Half, input.scalar_type(), "max_pool2d_no_indices", [&] {
+        cpu_max_pool2d_no_indices<scalar_t>(output, input, kW, kH, dW, dH, padW, padH, dilationW, dilationH, fuse_relu);
+      });
+      break;
+    }
+    case at::MemoryFormat::ChannelsLast: {
+      AT_DISPATCH_ALL_TYPES_AND2(ScalarType::BFloat16, ScalarType::Half, input.scalar_type(), "max_pool2d_no_indices_channels_last", [&] {
+        cpu_max_pool2d_no_indices_channels_last<scalar_t>(output, input, kW, kH, dW, dH, padW, padH, dilationW, dilationH, fuse_relu);
+      });
+      break;
+    }
+    default:
+      TORCH_CHECK(false, "Unsupported memory format. Supports only ChannelsLast, Contiguous");
+  }
+}
+
 void max_pool3d_kernel_impl(
     Tensor& output,
     Tensor& indices,
@@ -739,6 +956,7 @@ void max_pool3d_backward_kernel_impl(
 } // anonymous namespace
 
 REGISTER_DISPATCH(max_pool2d_kernel, &max_pool2d_kernel_impl);
+REGISTER_DISPATCH(max_pool2d_no_indices_kernel, &max_pool2d_no_indices_kernel_impl);
 REGISTER_DISPATCH(max_pool2d_backward_kernel, &max_pool2d_backward_kernel_impl);
 REGISTER_DISPATCH(max_pool3d_kernel, &max_pool3d_kernel_impl);
 REGISTER_DISPATCH(max_pool3d_backward_kernel, &max_pool3d_backward_kernel_impl);
@@ -0,0 +1,147 @@
+#pragma once
+#include <ATen/Parallel.h>
+#include <c10/util/bit_cast.h>
+#include <c10/util/irange.h>
+
+#include <algorithm>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace at {
+namespace native {
+
+/* A parallel LSD radix sort over (key, index) pairs, shared by the 1-d sort
+ * kernel and the sort-based index_put_ accumulation path. Unlike the fbgemm
+ * sort it is always available, and it covers floating point keys by mapping
+ * them to unsigned integers with the same ordering.
+ *
+ * Each 8-bit pass splits the input into one contiguous chunk per thread,
+ * counts digit occurrences into a per-chunk histogram, turns the histograms
+ * into per-chunk scatter offsets with a digit-major exclusive prefix sum,
+ * and then scatters in parallel; chunks write disjoint ranges, and walking
+ * each chunk in order keeps the sort stable. Passes in which every key
+ * shares the same digit are skipped, so sorting keys with a small range
+ * only pays for the low passes.
+ */
+
+// The unsigned integer type of the same width as scalar_t whose natural
+// ordering matches scalar_t's after radix_encode below.
+template <typename scalar_t>
+struct RadixBits {
+  using type = std::make_unsigned_t<scalar_t>;
+};
+template <>
+struct RadixBits<float> {
+  using type = uint32_t;
+};
+template <>
+struct RadixBits<double> {
+  using type = uint64_t;
+};
+template <typename scalar_t>
+using radix_bits_t = typename RadixBits<scalar_t>::type;
+
+template <typename scalar_t>
+radix_bits_t<scalar_t> radix_encode(scalar_t value) {
+  using bits_t = radix_bits_t<scalar_t>;
+  constexpr bits_t msb = static_cast<bits_t>(1) << (8 * sizeof(bits_t) - 1);
+  if constexpr (std::is_floating_point<scalar_t>::value) {
+    // Negative floats compare inverted to their bit patterns, positive
+    // floats compare like their bit patterns with the sign bit cleared.
+    const auto bits = c10::bit_cast<bits_t>(value);
+    return (bits & msb) ? ~bits : bits ^ msb;
+  } else if constexpr (std::is_signed<scalar_t>::value) {
+    return static_cast<bits_t>(value) ^ msb;
+  } else {
+    return static_cast<bits_t>(value);
+  }
+}
+
+template <typename scalar_t>
+scalar_t radix_decode(radix_bits_t<scalar_t> bits) {
+  using bits_t = radix_bits_t<scalar_t>;
+  constexpr bits_t msb = static_cast<bits_t>(1) << (8 * sizeof(bits_t) - 1);
+  if constexpr (std::is_floating_point<scalar_t>::value) {
+    return c10::bit_cast<scalar_t>(
+        static_cast<bits_t>((bits & msb) ? bits ^ msb : ~bits));
+  } else if constexpr (std::is_signed<scalar_t>::value) {
+    return static_cast<scalar_t>(bits ^ msb);
+  } else {
+    return static_cast<scalar_t>(bits);
+  }
+}
+
+// Sorts the n (key, value) pairs in keys/vals ascending by key, using
+// tmp_keys/tmp_vals as scratch. Returns pointers to the buffers holding the
+// sorted result, which are the input or the scratch buffers depending on
+// how many passes ran.
+template <typename bits_t>
+std::pair<bits_t*, int64_t*> radix_sort_pairs(
+    bits_t* keys,
+    int64_t* vals,
+    bits_t* tmp_keys,
+    int64_t* tmp_vals,
+    int64_t n) {
+  constexpr int kNumBuckets = 256;
+  const int64_t chunk_size = divup(n, at::get_num_threads());
+  const int64_t num_chunks = divup(n, chunk_size);
+  std::vector<int64_t> histograms(num_chunks * kNumBuckets);
+
+  for (const auto pass : c10::irange(sizeof(bits_t))) {
+    const int shift = pass * 8;
+    std::fill(histograms.begin(), histograms.end(), 0);
+    at::parallel_for(0, num_chunks, 1, [&](int64_t cbegin, int64_t cend) {
+      for (const auto chunk : c10::irange(cbegin, cend)) {
+        int64_t* hist = histograms.data() + chunk * kNumBuckets;
+        const int64_t begin = chunk * chunk_size;
+        const int64_t end = std::min(n, begin + chunk_size);
+        for (const auto i : c10::irange(begin, end)) {
+          hist[(keys[i] >> shift) & 0xFF]++;
+        }
+      }
+    });
+
+    // Digit-major exclusive prefix sum: replaces each count with the
+    // position at which its chunk starts writing that digit.
+    bool single_digit_pass = false;
+    int64_t offset = 0;
+    for (const auto digit : c10::irange(kNumBuckets)) {
+      int64_t digit_count = 0;
+      for (const auto chunk : c10::irange(num_chunks)) {
+        int64_t& slot = histograms[chunk * kNumBuckets + digit];
+        digit_count += slot;
+        const int64_t count = slot;
+        slot = offset;
+        offset += count;
+      }
+      if (digit_count == n) {
+        single_digit_pass = true;
+      }
+    }
+    if (single_digit_pass) {
+      // Every key has the same digit in this pass; the scatter would be an
+      // identity permutation.
+      continue;
+    }
+
+    at::parallel_for(0, num_chunks, 1, [&](int64_t cbegin, int64_t cend) {
+      for (const auto chunk : c10::irange(cbegin, cend)) {
+        int64_t* offsets = histograms.data() + chunk * kNumBuckets;
+        const int64_t begin = chunk * chunk_size;
+        const int64_t end = std::min(n, begin + chunk_size);
+        for (const auto i : c10::irange(begin, end)) {
+          const int64_t dst = offsets[(keys[i] >> shift) & 0xFF]++;
+          tmp_keys[dst] = keys[i];
+          tmp_vals[dst] = vals[i];
+        }
+      }
+    });
+    std::swap(keys, tmp_keys);
+    std::swap(vals, tmp_vals);
+  }
+  return std::make_pair(keys, vals);
+}
+
+} // namespace native
+} // namespace at
@@ -115,6 +115,49 @@ static inline void vectorized_outer_reduction(char** data, int64_t inner_stride,
   });
 }
 
+// Tiled variant of the outer reduction above: stream the rows once and keep
+// one partial accumulator per output column in an L1-resident buffer, instead
+// of re-walking all `size0` rows for every 4 * Vec::size() column group. The
+// group-at-a-time walk keeps its partials in registers but re-reads the whole
+// input size1 / (4 * Vec::size()) times, so for wide outputs (e.g. summing
+// the columns of a row-major matrix) it runs far below memory bandwidth; here
+// every input row is loaded contiguously exactly once and the extra partial
+// traffic stays in L1.
+template <typename func_t, typename vec_func_t>
+static inline void vectorized_outer_reduction_tiled(char** data, int64_t inner_stride, int64_t size0, int64_t size1, func_t op, vec_func_t vop) {
+  VEC_LOOP_HEADER(func_t, data)
+  // Partials for one column tile; 1024 elements keeps the buffer L1-resident
+  // for every dtype this kernel is instantiated with.
+  constexpr int64_t kTileWidth = 1024;
+  alignas(64) scalar_t partials[kTileWidth];
+  const char* in_ptr = data[1];
+  for (int64_t col = 0; col < size1; col += kTileWidth) {
+    const int64_t width = std::min(kTileWidth, size1 - col);
+    const int64_t vec_width = width - width % Vec::size();
+    scalar_t* out = (scalar_t*)out_ptr + col;
+    const char* in_col = in_ptr + col * sizeof(scalar_t);
+    // Seed the partials from the output, which the caller filled with the
+    // identity (or the partial result of a previous chunk).
+    for (const auto j : c10::irange(width)) {
+      partials[j] = out[j];
+    }
+    for (const auto i : c10::irange(size0)) {
+      const scalar_t* row = (const scalar_t*)(in_col + i * inner_stride);
+      int64_t j = 0;
+      for (; j < vec_width; j += Vec::size()) {
+        auto acc = Vec::loadu(partials + j);
+        vop(acc, Vec::loadu(row + j)).store(partials + j);
+      }
+      for (; j < width; j++) {
+        partials[j] = op(partials[j], row[j]);
+      }
+    }
+    for (const auto j : c10::irange(width)) {
+      out[j] = partials[j];
+    }
+  }
+}
+
 template<typename traits, typename res_t>
 static void set_result(const int index, const res_t result, const TensorIteratorBase &iter, const int num_outputs) {
   // static_assert(std::is_same<res_t, typename traits::arg2_t>::value, "data types must match");
@@ -271,7 +314,14 @@ void binary_kernel_reduce_vec(TensorIteratorBase& iter, func_t op, vec_func_t vo
     } else if (is_outer_reduction<traits>(strides)) {
       // input and output are contiguous in dim 1
       int64_t inner_stride = strides[1]; // stride of input in dim 0
-      vectorized_outer_reduction(data, inner_stride, size0, size1, op, vop);
+      using Vec = Vectorized<typename traits::result_type>;
+      if (size1 > 4 * int64_t(Vec::size())) {
+        // more than one column group: the group-at-a-time walk would
+        // re-stream the input, the row-tiled walk reads it once
+        vectorized_outer_reduction_tiled(data, inner_stride, size0, size1, op, vop);
+      } else {
+        vectorized_outer_reduction(data, inner_stride, size0, size1, op, vop);
+      }
     } else {
       UNARY_OUTER_LOOP(data, outer_strides, size1, [&] {
         char* ptrs[3] = { data[0], data[0], data[1] };
@@ -6,6 +6,7 @@
 #include <iterator>
 #include <numeric>
 
+#include <ATen/Context.h>
 #include <ATen/Dispatch.h>
 #include <ATen/Parallel.h>
 #include <ATen/TensorIterator.h>
@@ -14,6 +15,7 @@
 #include <ATen/cpu/vec/functional.h>
 #include <ATen/cpu/vec/vec.h>
 #include <c10/util/Optional.h>
+#include <c10/util/SmallVector.h>
 #include <c10/util/irange.h>
 #include <ATen/OpMathType.h>
 
@@ -114,6 +116,7 @@ _vec_softmax_lastdim(
     int64_t outer_size,
     int64_t dim_size) {
   using Vec = vec::Vectorized<scalar_t>;
+  const bool fast_math = at::globalContext().allowFastMathTranscendentalsCPU();
   int64_t grain_size = internal::GRAIN_SIZE / (16 * dim_size);
   parallel_for(0, outer_size, grain_size, [&](int64_t begin, int64_t end) {
     for (const auto i : c10::irange(begin, end)) {
@@ -123,11 +126,19 @@ _vec_softmax_lastdim(
           [](Vec& x, Vec& y) { return vec::maximum(x, y); },
           input_data,
           dim_size);
-      vec::map(
-          [max_input](Vec x) { return (x - Vec(max_input)).exp(); },
-          output_data,
-          input_data,
-          dim_size);
+      if (fast_math) {
+        vec::map(
+            [max_input](Vec x) { return vec::fast_exp(x - Vec(max_input)); },
+            output_data,
+            input_data,
+            dim_size);
+      } else {
+        vec::map(
+            [max_input](Vec x) { return (x - Vec(max_input)).exp(); },
+            output_data,
+            input_data,
+            dim_size);
+      }
       scalar_t tmp_sum = vec::reduce_all<scalar_t>(
           [](Vec x, Vec y) { return x + y; }, output_data, dim_size);
       tmp_sum = 1 / tmp_sum;
@@ -149,6 +160,7 @@ _vec_softmax_lastdim(
     int64_t dim_size) {
   using Vec = vec::Vectorized<scalar_t>;
   using fVec = vec::Vectorized<float>;
+  const bool fast_math = at::globalContext().allowFastMathTranscendentalsCPU();
   int64_t grain_size = internal::GRAIN_SIZE / (16 * dim_size);
   parallel_for(0, outer_size, grain_size, [&](int64_t begin, int64_t end) {
     // thread local temp buffer.
@@ -180,7 +192,8 @@ _vec_softmax_lastdim(
       fVec sum_fvec = fVec(float(0));
       int64_t d1 = 0;
       for (; d1 < dim_size - (dim_size % fVec::size()); d1 += fVec::size()) {
-        fVec data_fvec = (fVec::loadu(buffer_data + d1) - fVec(max_val)).exp();
+        fVec shifted_fvec = fVec::loadu(buffer_data + d1) - fVec(max_val);
+        fVec data_fvec = fast_math ? vec::fast_exp(shifted_fvec) : shifted_fvec.exp();
         sum_fvec += data_fvec;
         data_fvec.store(buffer_data + d1);
       }
@@ -206,6 +219,190 @@ _vec_softmax_lastdim(
   });
 }
 
+// Element offset of `row` in a mask that has been expanded to the input's
+// sizes; broadcast dims show up as stride 0. Only the dims before the softmax
+// dim participate.
+inline int64_t _mask_row_offset(
+    int64_t row,
+    const int64_t* outer_sizes,
+    const int64_t* mask_outer_strides,
+    int64_t outer_ndim) {
+  int64_t offset = 0;
+  for (int64_t d = outer_ndim - 1; d >= 0; d--) {
+    offset += (row % outer_sizes[d]) * mask_outer_strides[d];
+    row /= outer_sizes[d];
+  }
+  return offset;
+}
+
+template <typename scalar_t>
+inline typename std::enable_if_t<std::is_same_v<scalar_t, at::opmath_type<scalar_t>>, void>
+_vec_masked_softmax_dropout_lastdim(
+    const scalar_t* input_data_base,
+    scalar_t* output_data_base,
+    const scalar_t* mask_data_base,
+    const int64_t* outer_sizes,
+    const int64_t* mask_outer_strides,
+    int64_t outer_ndim,
+    const scalar_t* dropout_data_base,
+    scalar_t dropout_scale,
+    int64_t outer_size,
+    int64_t dim_size) {
+  using Vec = vec::Vectorized<scalar_t>;
+  int64_t grain_size = internal::GRAIN_SIZE / (16 * dim_size);
+  parallel_for(0, outer_size, grain_size, [&](int64_t begin, int64_t end) {
+    for (const auto i : c10::irange(begin, end)) {
+      const scalar_t* input_data = input_data_base + i * dim_size;
+      scalar_t* output_data = output_data_base + i * dim_size;
+      const scalar_t* mask_data = mask_data_base == nullptr
+          ? nullptr
+          : mask_data_base +
+              _mask_row_offset(i, outer_sizes, mask_outer_strides, outer_ndim);
+      scalar_t max_input;
+      if (mask_data != nullptr) {
+        max_input = vec::map2_reduce_all<scalar_t>(
+            [](Vec x, Vec m) { return x + m; },
+            [](Vec x, Vec y) { return vec::maximum(x, y); },
+            input_data,
+            mask_data,
+            dim_size);
+        vec::map2(
+            [max_input](Vec x, Vec m) { return (x + m - Vec(max_input)).exp(); },
+            output_data,
+            input_data,
+            mask_data,
+            dim_size);
+      } else {
+        max_input = vec::reduce_all<scalar_t>(
+            [](Vec& x, Vec& y) { return vec::maximum(x, y); },
+            input_data,
+            dim_size);
+        vec::map(
+            [max_input](Vec x) { return (x - Vec(max_input)).exp(); },
+            output_data,
+            input_data,
+            dim_size);
+      }
+      scalar_t tmp_sum = vec::reduce_all<scalar_t>(
+          [](Vec x, Vec y) { return x + y; }, output_data, dim_size);
+      // Fold the dropout scaling into the normalization so the keep-mask
+      // multiply is the only extra work in the final sweep.
+      tmp_sum = dropout_scale / tmp_sum;
+      if (dropout_data_base != nullptr) {
+        const scalar_t* dropout_data = dropout_data_base + i * dim_size;
+        vec::map2(
+            [tmp_sum](Vec x, Vec keep) { return x * keep * Vec(tmp_sum); },
+            output_data,
+            output_data,
+            dropout_data,
+            dim_size);
+      } else {
+        vec::map(
+            [tmp_sum](Vec x) { return x * Vec(tmp_sum); },
+            output_data,
+            output_data,
+            dim_size);
+      }
+    }
+  });
+}
+
+template <typename scalar_t>
+inline typename std::enable_if_t<!std::is_same_v<scalar_t, at::opmath_type<scalar_t>>, void>
+_vec_masked_softmax_dropout_lastdim(
+    const scalar_t* input_data_base,
+    scalar_t* output_data_base,
+    const scalar_t* mask_data_base,
+    const int64_t* outer_sizes,
+    const int64_t* mask_outer_strides,
+    int64_t outer_ndim,
+    const scalar_t* dropout_data_base,
+    float dropout_scale,
+    int64_t outer_size,
+    int64_t dim_size) {
+  using Vec = vec::Vectorized<scalar_t>;
+  using fVec = vec::Vectorized<float>;
+  int64_t grain_size = internal::GRAIN_SIZE / (16 * dim_size);
+  parallel_for(0, outer_size, grain_size, [&](int64_t begin, int64_t end) {
+    // thread local temp buffer.
+    auto buffer = std::make_unique<float []>(dim_size);
+    float* buffer_data = buffer.get();
+
+    for (const auto i : c10::irange(begin, end)) {
+      const scalar_t* input_data = input_data_base + i * dim_size;
+      scalar_t* output_data = output_data_base + i * dim_size;
+      const scalar_t* mask_data = mask_data_base == nullptr
+          ? nullptr
+          : mask_data_base +
+              _mask_row_offset(i, outer_sizes, mask_outer_strides, outer_ndim);
+      // add the mask, reduce to max and cache float input data
+      fVec max_fvec = fVec(-std::numeric_limits<float>::infinity());
+      int64_t d0 = 0;
+      for (; d0 < dim_size - (dim_size % Vec::size()); d0 += Vec::size()) {
+        auto [data_fvec0, data_fvec1] =
+            vec::convert_to_float<scalar_t>(Vec::loadu(input_data + d0));
+        if (mask_data != nullptr) {
+          auto [mask_fvec0, mask_fvec1] =
+              vec::convert_to_float<scalar_t>(Vec::loadu(mask_data + d0));
+          data_fvec0 += mask_fvec0;
+          data_fvec1 += mask_fvec1;
+        }
+        max_fvec = vec::maximum(max_fvec, data_fvec0);
+        max_fvec = vec::maximum(max_fvec, data_fvec1);
+        data_fvec0.store(buffer_data + d0);
+        data_fvec1.store(buffer_data + d0 + fVec::size());
+      }
+      float max_val = vec::vec_reduce_all([](fVec& x, fVec& y) { return vec::maximum(x, y); }, max_fvec);
+      for (; d0 < dim_size; d0++) {
+        float data_val = float(input_data[d0]) +
+            (mask_data != nullptr ? float(mask_data[d0]) : 0.f);
+        max_val = std::max(max_val, data_val);
+        buffer_data[d0] = data_val;
+      }
+
+      // map (x - max).exp() and reduce to sum
+      fVec sum_fvec = fVec(float(0));
+      int64_t d1 = 0;
+      for (; d1 < dim_size - (dim_size % fVec::size()); d1 += fVec::size()) {
+        fVec data_fvec = (fVec::loadu(buffer_data + d1) - fVec(max_val)).exp();
+        sum_fvec += data_fvec;
+        data_fvec.store(buffer_data + d1);
+      }
+      float sum_val = vec::vec_reduce_all([](fVec& x, fVec& y) { return x + y; }, sum_fvec);
+      for (; d1 < dim_size; d1++) {
+        float data_val = std::exp(buffer_data[d1] - max_val);
+        sum_val += data_val;
+        buffer_data[d1] = data_val;
+      }
+
+      sum_val = dropout_scale / sum_val;
+      const scalar_t* dropout_data = dropout_data_base == nullptr
+          ? nullptr
+          : dropout_data_base + i * dim_size;
+      int64_t d2 = 0;
+      for (; d2 < dim_size - (dim_size % Vec::size()); d2 += Vec::size()) {
+        fVec out_fvec0 = fVec::loadu(buffer_data + d2) * fVec(sum_val);
+        fVec out_fvec1 = fVec::loadu(buffer_data + d2 + fVec::size()) * fVec(sum_val);
+        if (dropout_data != nullptr) {
+          auto [keep_fvec0, keep_fvec1] =
+              vec::convert_to_float<scalar_t>(Vec::loadu(dropout_data + d2));
+          out_fvec0 *= keep_fvec0;
+          out_fvec1 *= keep_fvec1;
+        }
+        Vec out_vec = vec::convert_from_float<scalar_t>(out_fvec0, out_fvec1);
+        out_vec.store(output_data + d2);
+      }
+      for (; d2 < dim_size; d2++) {
+        float out_val = buffer_data[d2] * sum_val;
+        if (dropout_data != nullptr) {
+          out_val *= float(dropout_data[d2]);
+        }
+        output_data[d2] = scalar_t(out_val);
+      }
+    }
+  });
+}
+
 template <typename scalar_t, bool log_softmax>
 inline void _vec_host_softmax_backward_lastdim(
     scalar_t* grad_input_data_base,
@@ -1206,6 +1403,57 @@ static void softmax_lastdim_kernel_impl(
       [&] { vec_host_softmax_lastdim<scalar_t, false>::apply(result, self); });
 }
 
+static void masked_softmax_dropout_lastdim_kernel_impl(
+    const Tensor& result,
+    const Tensor& self,
+    const c10::optional<Tensor>& mask,
+    const c10::optional<Tensor>& dropout_mask,
+    double dropout_scale) {
+  int64_t dim_size = self.size(-1);
+  int64_t outer_size = self.numel() / dim_size;
+  int64_t outer_ndim = self.dim() - 1;
+
+  // Broadcast the mask up front; broadcast dims get stride 0, so per-row
+  // offsets are a plain stride dot product over the outer dims.
+  c10::optional<Tensor> mask_expanded;
+  c10::SmallVector<int64_t, 8> outer_sizes;
+  c10::SmallVector<int64_t, 8> mask_outer_strides;
+  if (mask.has_value()) {
+    mask_expanded = mask->expand_as(self);
+    TORCH_INTERNAL_ASSERT(mask_expanded->stride(-1) == 1);
+    for (const auto d : c10::irange(outer_ndim)) {
+      outer_sizes.push_back(self.size(d));
+      mask_outer_strides.push_back(mask_expanded->stride(d));
+    }
+  }
+  if (dropout_mask.has_value()) {
+    TORCH_INTERNAL_ASSERT(
+        dropout_mask->is_contiguous() &&
+        dropout_mask->sizes() == self.sizes() &&
+        dropout_mask->scalar_type() == self.scalar_type());
+  }
+
+  AT_DISPATCH_FLOATING_TYPES_AND2(
+      at::ScalarType::BFloat16, at::ScalarType::Half, self.scalar_type(),
+      "masked_softmax_dropout_lastdim_kernel_impl", [&] {
+        _vec_masked_softmax_dropout_lastdim<scalar_t>(
+            self.const_data_ptr<scalar_t>(),
+            result.data_ptr<scalar_t>(),
+            mask_expanded.has_value()
+                ? mask_expanded->const_data_ptr<scalar_t>()
+                : nullptr,
+            outer_sizes.data(),
+            mask_outer_strides.data(),
+            outer_ndim,
+            dropout_mask.has_value()
+                ? dropout_mask->const_data_ptr<scalar_t>()
+                : nullptr,
+            static_cast<at::opmath_type<scalar_t>>(dropout_scale),
+            outer_size,
+            dim_size);
+      });
+}
+
 static void softmax_kernel_impl(const Tensor& result, const Tensor& self, int64_t dim) {
   AT_DISPATCH_FLOATING_TYPES_AND2(at::ScalarType::BFloat16, at::ScalarType::Half, self.scalar_type(),
     "softmax_kernel_impl",
@@ -1286,6 +1534,9 @@ static void log_softmax_backward_kernel_impl(
 } // anonymous namespace
 
 ALSO_REGISTER_AVX512_DISPATCH(softmax_lastdim_kernel, &softmax_lastdim_kernel_impl);
+ALSO_REGISTER_AVX512_DISPATCH(
+    masked_softmax_dropout_lastdim_kernel,
+    &masked_softmax_dropout_lastdim_kernel_impl);
 ALSO_REGISTER_AVX512_DISPATCH(log_softmax_lastdim_kernel, &log_softmax_lastdim_kernel_impl);
 ALSO_REGISTER_AVX512_DISPATCH(
     softmax_backward_lastdim_kernel,
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <ATen/native/DispatchStub.h>
+#include <c10/util/Optional.h>
 #include <cstdint>
 
 namespace at {
@@ -16,6 +17,22 @@ DECLARE_DISPATCH(forward_fn, log_softmax_lastdim_kernel);
 DECLARE_DISPATCH(backward_fn, softmax_backward_lastdim_kernel);
 DECLARE_DISPATCH(backward_fn, log_softmax_backward_lastdim_kernel);
 
+// Fused attention softmax over the last dim:
+//   output = softmax(input + mask, -1) [* dropout_mask * dropout_scale]
+// with max/exp/sum and the normalization kept cache resident per row, so the
+// attention matrix is only streamed through memory once instead of once per
+// op. `mask` is an additive float mask broadcastable to `input` (contiguous in
+// the last dim); `dropout_mask` is an optional precomputed 0/1 keep-mask with
+// the same dtype and shape as `input`. `output` may alias `input`.
+using masked_softmax_dropout_fn = void (*)(
+    const Tensor& /* output */,
+    const Tensor& /* input */,
+    const c10::optional<Tensor>& /* mask */,
+    const c10::optional<Tensor>& /* dropout_mask */,
+    double /* dropout_scale */);
+
+DECLARE_DISPATCH(masked_softmax_dropout_fn, masked_softmax_dropout_lastdim_kernel);
+
 using forward_fn_with_dim = void(*)(const Tensor &, const Tensor &, const int64_t);
 using backward_fn_with_dim =
     void (*)(const Tensor&, const Tensor&, const Tensor&, const int64_t);
@@ -13,8 +13,14 @@
 #include <ATen/native/StridedRandomAccessor.h>
 #include <ATen/native/CompositeRandomAccessor.h>
 #include <ATen/native/TopKImpl.h>
+#include <ATen/native/cpu/RadixSortUtils.h>
 #include <c10/core/WrapDimMinimal.h>
+#include <c10/util/bit_cast.h>
 #include <c10/util/irange.h>
+
+#include <atomic>
+#include <utility>
+#include <vector>
 #ifdef USE_FBGEMM
 #include <fbgemm/Utils.h>
 #endif
@@ -141,6 +147,84 @@ static void parallel_sort1d_kernel(
 }
 #endif
 
+static bool can_use_lsd_radix_sort(
+    const TensorBase& values,
+    const bool descending) {
+  // Like the fbgemm path, restricted to large 1-d ascending sorts; LSD
+  // radix sort is stable, so the stable flag needs no check.
+  if (values.dim() != 1 || descending) {
+    return false;
+  }
+  if (values.numel() < at::internal::GRAIN_SIZE) {
+    return false;
+  }
+  const auto dtype = values.scalar_type();
+  return at::isIntegralType(dtype, /*includeBool=*/false) ||
+      dtype == ScalarType::Float || dtype == ScalarType::Double;
+}
+
+// Returns false without touching the outputs when the input contains NaN
+// (radix order would put negative NaNs first; the comparison sort handles
+// them), in which case the caller falls through to the comparison path.
+static bool lsd_radix_sort1d_kernel(
+    const TensorBase& values,
+    const TensorBase& indices) {
+  bool sorted = false;
+  AT_DISPATCH_ALL_TYPES(values.scalar_type(), "lsd_radix_sort1d_cpu", [&] {
+    using bits_t = radix_bits_t<scalar_t>;
+    const int64_t elements = values.numel();
+    scalar_t* const values_p = values.data_ptr<scalar_t>();
+    int64_t* const indices_p = indices.data_ptr<int64_t>();
+
+    if (std::is_floating_point<scalar_t>::value) {
+      std::atomic<bool> has_nan{false};
+      at::parallel_for(
+          0, elements, at::internal::GRAIN_SIZE, [&](int64_t begin, int64_t end) {
+            if (has_nan.load(std::memory_order_relaxed)) {
+              return;
+            }
+            for (const auto i : c10::irange(begin, end)) {
+              if (_isnan<scalar_t>(values_p[i])) {
+                has_nan.store(true, std::memory_order_relaxed);
+                return;
+              }
+            }
+          });
+      if (has_nan.load(std::memory_order_relaxed)) {
+        return;
+      }
+    }
+
+    std::vector<bits_t> keys(elements);
+    std::vector<bits_t> tmp_keys(elements);
+    std::vector<int64_t> tmp_vals(elements);
+    at::parallel_for(
+        0, elements, at::internal::GRAIN_SIZE, [&](int64_t begin, int64_t end) {
+          for (const auto i : c10::irange(begin, end)) {
+            keys[i] = radix_encode(values_p[i]);
+          }
+        });
+
+    bits_t* sorted_keys = nullptr;
+    int64_t* sorted_vals = nullptr;
+    std::tie(sorted_keys, sorted_vals) = radix_sort_pairs(
+        keys.data(), indices_p, tmp_keys.data(), tmp_vals.data(), elements);
+
+    at::parallel_for(
+        0, elements, at::internal::GRAIN_SIZE, [&](int64_t begin, int64_t end) {
+          for (const auto i : c10::irange(begin, end)) {
+            values_p[i] = radix_decode<scalar_t>(sorted_keys[i]);
+          }
+          if (sorted_vals != indices_p) {
+            std::copy(
+                sorted_vals + begin, sorted_vals + end, indices_p + begin);
+          }
+        });
+    sorted = true;
+  });
+  return sorted;
+}
+
 static void sort_kernel(
     const TensorBase& self,
     const TensorBase& values,
@@ -161,6 +245,10 @@ static void sort_kernel(
     return;
   }
 #endif
+  if (can_use_lsd_radix_sort(values, descending) &&
+      lsd_radix_sort1d_kernel(values, indices)) {
+    return;
+  }
   _dim_apply(
     values, indices, dim,
     "sort_cpu", [&](
@@ -201,6 +289,94 @@ static void sort_kernel(
   );
 }
 
+/* Parallel block-select topk for large 1-d inputs. topk_impl_loop
+ * parallelizes over slices, so a single large slice - the common
+ * "top k of N scores" retrieval shape - runs on one thread. This path
+ * splits the input into one contiguous chunk per thread, selects each
+ * chunk's top k locally, and then selects the final top k from the
+ * per-chunk candidates; the union of per-chunk winners is guaranteed to
+ * contain the global winners. The final merge handles at most
+ * num_threads * k pairs and stays serial.
+ */
+static bool can_use_parallel_topk1d(const TensorBase& self, int64_t k) {
+  if (self.dim() != 1 || k == 0) {
+    return false;
+  }
+  const int64_t n = self.numel();
+  const auto num_threads = at::get_num_threads();
+  if (num_threads <= 1 || n < at::internal::GRAIN_SIZE) {
+    return false;
+  }
+  // Every chunk must be able to contribute k candidates, and the local
+  // selections only pay off when k is small relative to the chunks.
+  if (k * num_threads * 2 > n) {
+    return false;
+  }
+  return self.is_contiguous();
+}
+
+template <typename scalar_t, typename accscalar_t>
+void parallel_topk1d_kernel(
+    const TensorBase& values,
+    const TensorBase& indices,
+    const TensorBase& self,
+    int64_t k,
+    bool largest) {
+  using elem_t = std::pair<accscalar_t, int64_t>;
+  // As in topk_impl_loop, nan sorts as top for numpy compatibility.
+  const auto comp = [largest](const elem_t& x, const elem_t& y) -> bool {
+    if (largest) {
+      return (_isnan<accscalar_t>(x.first) && !_isnan<accscalar_t>(y.first)) ||
+          (x.first > y.first);
+    }
+    return (!_isnan<accscalar_t>(x.first) && _isnan<accscalar_t>(y.first)) ||
+        (x.first < y.first);
+  };
+
+  const int64_t n = self.numel();
+  const scalar_t* const self_p = self.data_ptr<scalar_t>();
+  const int64_t chunk_size = divup(n, at::get_num_threads());
+  const int64_t num_chunks = divup(n, chunk_size);
+
+  std::vector<elem_t> candidates(num_chunks * k);
+  std::vector<int64_t> candidate_counts(num_chunks);
+  at::parallel_for(0, num_chunks, 1, [&](int64_t cbegin, int64_t cend) {
+    for (const auto chunk : c10::irange(cbegin, cend)) {
+      const int64_t begin = chunk * chunk_size;
+      const int64_t end = std::min(n, begin + chunk_size);
+      std::vector<elem_t> local(end - begin);
+      for (const auto i : c10::irange(begin, end)) {
+        local[i - begin] = {accscalar_t(self_p[i]), i};
+      }
+      const int64_t local_k = std::min(k, end - begin);
+      std::partial_sort(local.begin(), local.begin() + local_k, local.end(), comp);
+      std::copy(
+          local.begin(), local.begin() + local_k,
+          candidates.begin() + chunk * k);
+      candidate_counts[chunk] = local_k;
+    }
+  });
+
+  // Compacts the per-chunk winners (the last chunk may have fewer than k)
+  // and selects the final top k among them.
+  std::vector<elem_t> merged;
+  merged.reserve(num_chunks * k);
+  for (const auto chunk : c10::irange(num_chunks)) {
+    merged.insert(
+        merged.end(),
+        candidates.begin() + chunk * k,
+        candidates.begin() + chunk * k + candidate_counts[chunk]);
+  }
+  std::partial_sort(merged.begin(), merged.begin() + k, merged.end(), comp);
+
+  scalar_t* const values_p = values.data_ptr<scalar_t>();
+  int64_t* const indices_p = indices.data_ptr<int64_t>();
+  for (const auto j : c10::irange(k)) {
+    values_p[j] = scalar_t(merged[j].first);
+    indices_p[j] = merged[j].second;
+  }
+}
+
 static void topk_kernel(
     const TensorBase &values,
     const TensorBase &indices,
@@ -210,6 +386,17 @@ static void topk_kernel(
     bool largest,
     bool sorted) {
   auto sizes = self.sizes();
+  if (can_use_parallel_topk1d(self, k) && values.is_contiguous() &&
+      indices.is_contiguous()) {
+    AT_DISPATCH_ALL_TYPES_AND2(ScalarType::BFloat16, ScalarType::Half, self.scalar_type(), "parallel_topk1d_cpu", [&] {
+      if (self.scalar_type() == ScalarType::BFloat16) {
+        parallel_topk1d_kernel<scalar_t, float>(values, indices, self, k, largest);
+      } else {
+        parallel_topk1d_kernel<scalar_t, scalar_t>(values, indices, self, k, largest);
+      }
+    });
+    return;
+  }
   auto iter = TensorIteratorConfig()
     .check_all_same_dtype(false)
     .resize_outputs(false)
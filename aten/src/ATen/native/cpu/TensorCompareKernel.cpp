@@ -18,6 +18,7 @@
 #include <c10/util/irange.h>
 #include <ATen/native/ReduceOpsUtils.h>
 #include <ATen/native/Resize.h>
+#include <ATen/native/cpu/ElementwiseChainLoops.h>
 #include <ATen/native/cpu/Loops.h>
 
 #ifndef AT_PER_OPERATOR_HEADERS
@@ -354,6 +355,20 @@ static void clamp_kernel_impl(TensorIteratorBase& iter) {
 }
 
 static void clamp_scalar_kernel_impl(TensorIteratorBase& iter, const Scalar& min_, const Scalar& max_) {
+  if (iter.common_dtype() == kFloat && chain_fusion::enabled()) {
+    const float min = min_.to<float>();
+    const float max = max_.to<float>();
+    if (try_chain_unary(
+            iter,
+            [min, max](float a) -> float {
+              return std::min(std::max(a, min), max);
+            },
+            [min, max](Vectorized<float> a) {
+              return vec::clamp(a, Vectorized<float>(min), Vectorized<float>(max));
+            })) {
+      return;
+    }
+  }
   AT_DISPATCH_ALL_TYPES_AND2(kBFloat16, kHalf, iter.common_dtype(), "clamp_scalar_cpu", [&]() {
     const auto min = min_.to<scalar_t>();
     const auto max = max_.to<scalar_t>();
@@ -370,6 +385,17 @@ static void clamp_scalar_kernel_impl(TensorIteratorBase& iter, const Scalar& min
 }
 
 static void clamp_max_scalar_kernel_impl(TensorIteratorBase& iter, Scalar max_) {
+  if (iter.common_dtype() == kFloat && chain_fusion::enabled()) {
+    const float max = max_.to<float>();
+    if (try_chain_unary(
+            iter,
+            [max](float a) -> float { return std::min(a, max); },
+            [max](Vectorized<float> a) {
+              return vec::clamp_max(a, Vectorized<float>(max));
+            })) {
+      return;
+    }
+  }
   AT_DISPATCH_ALL_TYPES_AND2(kBFloat16, kHalf, iter.common_dtype(), "clamp_max_scalar_cpu", [&]() {
     const auto max = max_.to<scalar_t>();
     const Vectorized<scalar_t> max_vec(max);
@@ -384,6 +410,17 @@ static void clamp_max_scalar_kernel_impl(TensorIteratorBase& iter, Scalar max_)
 }
 
 static void clamp_min_scalar_kernel_impl(TensorIteratorBase& iter, Scalar min_) {
+  if (iter.common_dtype() == kFloat && chain_fusion::enabled()) {
+    const float min = min_.to<float>();
+    if (try_chain_unary(
+            iter,
+            [min](float a) -> float { return std::max(a, min); },
+            [min](Vectorized<float> a) {
+              return vec::clamp_min(a, Vectorized<float>(min));
+            })) {
+      return;
+    }
+  }
   AT_DISPATCH_ALL_TYPES_AND2(kBFloat16, kHalf, iter.common_dtype(), "clamp_min_scalar_cpu", [&]() {
     const auto min = min_.to<scalar_t>();
     const Vectorized<scalar_t> min_vec(min);
@@ -528,36 +528,62 @@ void GroupNormKernelImpl(
 }
 
 
+// Accumulates ds = sum(dY * X) and db = sum(dY) for a single channel in one
+// sweep over the row, keeping both partial sums in vector registers.
 template <typename T, typename opmath_t>
-typename std::enable_if<std::is_same<T, opmath_t>::value, void>::type
-ComputeInternalGradients(
-    int64_t N,
-    int64_t C,
-    int64_t HxW,
-    const T* dY,
-    const T* X,
-    opmath_t* ds,
-    opmath_t* db) {
+inline typename std::enable_if<std::is_same<T, opmath_t>::value,
+    std::tuple<opmath_t, opmath_t>>::type
+RowwiseInternalGradients(const T* dY_ptr, const T* X_ptr, int64_t HxW) {
   using Vec = at::vec::Vectorized<opmath_t>;
-  at::parallel_for(0, N * C, 1, [=](int64_t start, int64_t end) {
-    for (const auto i : c10::irange(start, end)) {
-      const T* dY_ptr = dY + i * HxW;
-      const T* X_ptr = X + i * HxW;
-      ds[i] = at::vec::map2_reduce_all<T>(
-          [](Vec x, Vec y) { return x * y; },
-          [](Vec x, Vec y) { return x + y; },
-          dY_ptr,
-          X_ptr,
-          HxW);
-      db[i] = at::vec::reduce_all<T>(
-          [](Vec& x, Vec& y) { return x + y; }, dY_ptr, HxW);
-    }
-  });
+  constexpr int64_t K = Vec::size();
+  const int64_t inner_size = HxW / K * K;
+  Vec ds_vec(0);
+  Vec db_vec(0);
+  for (int64_t j = 0; j < inner_size; j += K) {
+    const Vec dy_vec = Vec::loadu(dY_ptr + j);
+    const Vec x_vec = Vec::loadu(X_ptr + j);
+    ds_vec = ds_vec + dy_vec * x_vec;
+    db_vec = db_vec + dy_vec;
+  }
+  opmath_t ds_val = vec::vec_reduce_all([](Vec& x, Vec& y) { return x + y; }, ds_vec);
+  opmath_t db_val = vec::vec_reduce_all([](Vec& x, Vec& y) { return x + y; }, db_vec);
+  for (const auto j : c10::irange(inner_size, HxW)) {
+    ds_val += dY_ptr[j] * X_ptr[j];
+    db_val += dY_ptr[j];
+  }
+  return std::tuple<opmath_t, opmath_t>(ds_val, db_val);
+}
+
+template <typename T, typename opmath_t>
+inline typename std::enable_if<!std::is_same<T, opmath_t>::value,
+    std::tuple<opmath_t, opmath_t>>::type
+RowwiseInternalGradients(const T* dY_ptr, const T* X_ptr, int64_t HxW) {
+  using Vec = vec::Vectorized<T>;
+  using fVec = vec::Vectorized<opmath_t>;
+  constexpr int64_t K = Vec::size();
+  const int64_t inner_size = HxW / K * K;
+  fVec ds_vec(0);
+  fVec db_vec(0);
+  for (int64_t j = 0; j < inner_size; j += K) {
+    const Vec dy_bvec = Vec::loadu(dY_ptr + j);
+    const Vec x_bvec = Vec::loadu(X_ptr + j);
+    auto [x_fvec0, x_fvec1] = convert_to_float<T>(x_bvec);
+    auto [dy_fvec0, dy_fvec1] = convert_to_float<T>(dy_bvec);
+    ds_vec = ds_vec + dy_fvec0 * x_fvec0;
+    ds_vec = ds_vec + dy_fvec1 * x_fvec1;
+    db_vec = db_vec + dy_fvec0 + dy_fvec1;
+  }
+  opmath_t ds_val = vec::vec_reduce_all([](fVec& x, fVec& y) { return x + y; }, ds_vec);
+  opmath_t db_val = vec::vec_reduce_all([](fVec& x, fVec& y) { return x + y; }, db_vec);
+  for (const auto j : c10::irange(inner_size, HxW)) {
+    ds_val += opmath_t(dY_ptr[j]) * opmath_t(X_ptr[j]);
+    db_val += opmath_t(dY_ptr[j]);
+  }
+  return std::tuple<opmath_t, opmath_t>(ds_val, db_val);
 }
 
 template <typename T, typename opmath_t>
-typename std::enable_if<!std::is_same<T, opmath_t>::value, void>::type
-ComputeInternalGradients(
+void ComputeInternalGradients(
     int64_t N,
     int64_t C,
     int64_t HxW,
@@ -565,39 +591,10 @@ ComputeInternalGradients(
     const T* X,
     opmath_t* ds,
     opmath_t* db) {
-  using Vec = vec::Vectorized<T>;
-  using fVec = vec::Vectorized<opmath_t>;
   at::parallel_for(0, N * C, 1, [=](int64_t start, int64_t end) {
-    constexpr int64_t K = Vec::size();
-    const int64_t inner_size = HxW / K * K;
-    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-member-init)
-    std::array<opmath_t, K / 2> ds_arr;
-    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-member-init)
-    std::array<opmath_t, K / 2> db_arr;
     for (const auto i : c10::irange(start, end)) {
-      const T* dY_ptr = dY + i * HxW;
-      const T* X_ptr = X + i * HxW;
-      fVec ds_vec(0);
-      fVec db_vec(0);
-      for (int64_t j = 0; j < inner_size; j += K) {
-        const Vec dy_bvec = Vec::loadu(dY_ptr + j);
-        const Vec x_bvec = Vec::loadu(X_ptr + j);
-        auto [x_fvec0, x_fvec1] = convert_to_float<T>(x_bvec);
-        auto [dy_fvec0, dy_fvec1] = convert_to_float<T>(dy_bvec);
-        ds_vec = ds_vec + dy_fvec0 * x_fvec0;
-        ds_vec = ds_vec + dy_fvec1 * x_fvec1;
-        db_vec = db_vec + dy_fvec0 + dy_fvec1;
-      }
-      ds_vec.store(ds_arr.data());
-      db_vec.store(db_arr.data());
-      opmath_t ds_val = std::accumulate(ds_arr.cbegin(), ds_arr.cend(), opmath_t(0));
-      opmath_t db_val = std::accumulate(db_arr.cbegin(), db_arr.cend(), opmath_t(0));
-      for (const auto j : c10::irange(inner_size, HxW)) {
-        ds_val += opmath_t(dY_ptr[j]) * opmath_t(X_ptr[j]);
-        db_val += opmath_t(dY_ptr[j]);
-      }
-      ds[i] = ds_val;
-      db[i] = db_val;
+      std::tie(ds[i], db[i]) =
+          RowwiseInternalGradients<T, opmath_t>(dY + i * HxW, X + i * HxW, HxW);
     }
   });
 }
@@ -651,6 +648,11 @@ CalcDsDb(
   db_acc.store(db_arr);
 }
 
+// Fused dX backward: each (n, g) iteration first fills ds/db for the group's
+// channels while the corresponding slab of dY/X is streamed into cache, then
+// reuses the hot slab to write dX, instead of making a separate full sweep
+// over dY/X beforehand. The ds/db buffers are later consumed by
+// GammaBackward/BetaBackward.
 template <typename T, typename PT, typename opmath_t>
 void GroupNormInputBackward(
     int64_t N,
@@ -662,9 +664,10 @@ void GroupNormInputBackward(
     const PT* mean,
     const PT* rstd,
     const PT* gamma,
-    const opmath_t* ds,
-    const opmath_t* db,
+    opmath_t* ds,
+    opmath_t* db,
     T* dX) {
+  using fVec = at::vec::Vectorized<opmath_t>;
   const int64_t G = group;
   const int64_t D = C / G;
   const opmath_t s = opmath_t(1) / static_cast<opmath_t>(D * HxW);
@@ -678,9 +681,13 @@ void GroupNormInputBackward(
     std::array<opmath_t, at::vec::Vectorized<opmath_t>::size()> db_arr;
     for (const auto i : c10::irange(start, end)) {
       const int64_t g = i % G;
-      const opmath_t* ds_ptr = ds + i * D;
-      const opmath_t* db_ptr = db + i * D;
+      opmath_t* ds_ptr = ds + i * D;
+      opmath_t* db_ptr = db + i * D;
       const PT* gamma_ptr = gamma_null ? nullptr : (gamma + g * D);
+      for (const auto j : c10::irange(D)) {
+        std::tie(ds_ptr[j], db_ptr[j]) = RowwiseInternalGradients<T, opmath_t>(
+            dY + (i * D + j) * HxW, X + (i * D + j) * HxW, HxW);
+      }
       CalcDsDb(ds_ptr, db_ptr, gamma_ptr, d, K, ds_arr.data(), db_arr.data());
       opmath_t ds_val = std::accumulate(ds_arr.cbegin(), ds_arr.cend(), opmath_t(0));
       opmath_t db_val = std::accumulate(db_arr.cbegin(), db_arr.cend(), opmath_t(0));
@@ -699,9 +706,14 @@ void GroupNormInputBackward(
         const T* X_ptr = X + (i * D + j) * HxW;
         T* dX_ptr = dX + (i * D + j) * HxW;
         const opmath_t c1 = opmath_t(rstd[i]) * (gamma_null ? opmath_t(1) : opmath_t(gamma[c]));
-        for (const auto k : c10::irange(HxW)) {
-          dX_ptr[k] = c1 * opmath_t(dY_ptr[k]) + c2 * opmath_t(X_ptr[k]) + c3;
-        }
+        vec::map2<T>(
+            [c1, c2, c3](fVec dy_vec, fVec x_vec) {
+              return dy_vec * fVec(c1) + x_vec * fVec(c2) + fVec(c3);
+            },
+            dX_ptr,
+            dY_ptr,
+            X_ptr,
+            HxW);
       }
     }
   });
@@ -910,9 +922,8 @@ void GroupNormBackwardKernelImplInternal(
   Tensor db = at::empty({N, C}, X.options().dtype(c10::CppTypeToScalarType<opmath_t>::value));
   opmath_t* ds_data = ds.data_ptr<opmath_t>();
   opmath_t* db_data = db.data_ptr<opmath_t>();
-  ComputeInternalGradients<T, opmath_t>(N, C, HxW, dY_data, X_data, ds_data, db_data);
-
   if (dX_data != nullptr) {
+    // GroupNormInputBackward fills ds/db as part of its fused (n, g) pass.
     GroupNormInputBackward<T, PT, opmath_t>(
         N,
         C,
@@ -926,6 +937,8 @@ void GroupNormBackwardKernelImplInternal(
         ds_data,
         db_data,
         dX_data);
+  } else {
+    ComputeInternalGradients<T, opmath_t>(N, C, HxW, dY_data, X_data, ds_data, db_data);
   }
   if (dgamma_data != nullptr) {
     GammaBackward(
@@ -0,0 +1,141 @@
+#define TORCH_ASSERT_ONLY_METHOD_OPERATORS
+#include <ATen/native/cpu/int_mm_kernel.h>
+
+#include <ATen/Dispatch.h>
+#include <ATen/OpMathType.h>
+#include <ATen/Parallel.h>
+#include <ATen/core/Tensor.h>
+#include <c10/util/irange.h>
+
+#include <algorithm>
+
+namespace at::native {
+
+namespace {
+
+// Weight-only quantized GEMM kernels: the packed int4/int8 weights are
+// dequantized in registers inside the inner loop, so the full-precision
+// weight matrix never touches memory. Scale (and zero) handling is hoisted
+// out of the k loop by accumulating sum(a*q) and sum(a) per quantization
+// group:
+//
+//   sum_k a_k * ((q_k - 8) * scale + zero)
+//     = scale * (sum(a*q) - 8 * sum(a)) + zero * sum(a)
+//
+// which leaves the inner loop as plain multiply-accumulates that the
+// per-capability builds of this file auto-vectorize.
+
+template <typename T>
+void int4pack_mm_kernel_impl(
+    Tensor& C,
+    const Tensor& A,
+    const Tensor& B,
+    int64_t qGroupSize,
+    const Tensor& qScaleAndZeros) {
+  using opmath_t = at::opmath_type<T>;
+  const T* A_data = A.const_data_ptr<T>();
+  const uint8_t* B_data = B.const_data_ptr<uint8_t>();
+  const T* qsz_data = qScaleAndZeros.const_data_ptr<T>();
+  T* C_data = C.mutable_data_ptr<T>();
+
+  const int64_t M = A.size(0);
+  const int64_t K = A.size(1);
+  const int64_t N = B.size(0);
+  const int64_t n_groups = K / qGroupSize;
+
+  const int64_t grain_size =
+      std::max<int64_t>(int64_t(1), at::internal::GRAIN_SIZE / K);
+  at::parallel_for(0, M * N, grain_size, [&](int64_t begin, int64_t end) {
+    for (const auto i : c10::irange(begin, end)) {
+      const int64_t m = i / N;
+      const int64_t n = i % N;
+      const T* a_row = A_data + m * K;
+      const uint8_t* b_row = B_data + n * (K / 2);
+      opmath_t acc = 0;
+      for (const auto g : c10::irange(n_groups)) {
+        const opmath_t scale =
+            static_cast<opmath_t>(qsz_data[(g * N + n) * 2]);
+        const opmath_t zero =
+            static_cast<opmath_t>(qsz_data[(g * N + n) * 2 + 1]);
+        opmath_t sum_aq = 0;
+        opmath_t sum_a = 0;
+        const int64_t k_begin = g * qGroupSize;
+        for (int64_t k = k_begin; k < k_begin + qGroupSize; k += 2) {
+          const uint8_t packed = b_row[k / 2];
+          const opmath_t a0 = static_cast<opmath_t>(a_row[k]);
+          const opmath_t a1 = static_cast<opmath_t>(a_row[k + 1]);
+          sum_aq += a0 * static_cast<opmath_t>(packed >> 4) +
+              a1 * static_cast<opmath_t>(packed & 0xF);
+          sum_a += a0 + a1;
+        }
+        acc += scale * (sum_aq - opmath_t(8) * sum_a) + zero * sum_a;
+      }
+      C_data[m * N + n] = static_cast<T>(acc);
+    }
+  });
+}
+
+template <typename T>
+void int8pack_mm_kernel_impl(
+    Tensor& C,
+    const Tensor& A,
+    const Tensor& B,
+    const Tensor& scales) {
+  using opmath_t = at::opmath_type<T>;
+  const T* A_data = A.const_data_ptr<T>();
+  const int8_t* B_data = B.const_data_ptr<int8_t>();
+  const T* scales_data = scales.const_data_ptr<T>();
+  T* C_data = C.mutable_data_ptr<T>();
+
+  const int64_t M = A.size(0);
+  const int64_t K = A.size(1);
+  const int64_t N = B.size(0);
+
+  const int64_t grain_size =
+      std::max<int64_t>(int64_t(1), at::internal::GRAIN_SIZE / K);
+  at::parallel_for(0, M * N, grain_size, [&](int64_t begin, int64_t end) {
+    for (const auto i : c10::irange(begin, end)) {
+      const int64_t m = i / N;
+      const int64_t n = i % N;
+      const T* a_row = A_data + m * K;
+      const int8_t* b_row = B_data + n * K;
+      opmath_t acc = 0;
+      for (const auto k : c10::irange(K)) {
+        acc += static_cast<opmath_t>(a_row[k]) *
+            static_cast<opmath_t>(b_row[k]);
+      }
+      C_data[m * N + n] =
+          static_cast<T>(acc * static_cast<opmath_t>(scales_data[n]));
+    }
+  });
+}
+
+void int4pack_mm_kernel(
+    Tensor& C,
+    const Tensor& A,
+    const Tensor& B,
+    int64_t qGroupSize,
+    const Tensor& qScaleAndZeros) {
+  AT_DISPATCH_FLOATING_TYPES_AND2(
+      kBFloat16, kHalf, A.scalar_type(), "int4pack_mm_cpu", [&] {
+        int4pack_mm_kernel_impl<scalar_t>(C, A, B, qGroupSize, qScaleAndZeros);
+      });
+}
+
+void int8pack_mm_kernel(
+    Tensor& C,
+    const Tensor& A,
+    const Tensor& B,
+    const Tensor& scales) {
+  AT_DISPATCH_FLOATING_TYPES_AND2(
+      kBFloat16, kHalf, A.scalar_type(), "int8pack_mm_cpu", [&] {
+        int8pack_mm_kernel_impl<scalar_t>(C, A, B, scales);
+      });
+}
+
+} // anonymous namespace
+
+REGISTER_DISPATCH(int4pack_mm_stub, &int4pack_mm_kernel);
+REGISTER_DISPATCH(int8pack_mm_stub, &int8pack_mm_kernel);
+
+} // namespace at::native
@@ -0,0 +1,16 @@
+#pragma once
+
+#include <ATen/core/Tensor.h>
+#include <ATen/native/DispatchStub.h>
+
+namespace at::native {
+
+using int4pack_mm_fn =
+    void (*)(Tensor&, const Tensor&, const Tensor&, int64_t, const Tensor&);
+using int8pack_mm_fn =
+    void (*)(Tensor&, const Tensor&, const Tensor&, const Tensor&);
+
+DECLARE_DISPATCH(int4pack_mm_fn, int4pack_mm_stub);
+DECLARE_DISPATCH(int8pack_mm_fn, int8pack_mm_stub);
+
+} // namespace at::native
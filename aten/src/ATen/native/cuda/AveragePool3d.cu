@@ -18,6 +18,8 @@
 #else
 #include <ATen/ops/avg_pool3d_native.h>
 #include <ATen/ops/avg_pool3d_backward_native.h>
+#include <ATen/ops/empty.h>
+#include <ATen/ops/zeros.h>
 #endif
 
 
@@ -390,7 +392,9 @@ TORCH_IMPL_FUNC(avg_pool3d_out_cuda) (
   const int64_t owidth = pooling_output_shape<int64_t>(iwidth, kW, padW, dW, 1, ceil_mode);
 
   Tensor work_input = input.contiguous();
-  Tensor work_output = output;
+  // the CUDA kernels expect NCDHW data; materialize a contiguous output when
+  // the structured meta allocated it in channels_last_3d and copy back below
+  Tensor work_output = output.is_contiguous() ? output : at::empty(output.sizes(), output.options());
   if (input.ndimension() == 5) {
     // Collapse batch and feature dimensions.
     work_input = work_input.reshape({nbatch * nslices, itime, iheight, iwidth});
@@ -438,6 +442,10 @@ TORCH_IMPL_FUNC(avg_pool3d_out_cuda) (
       }
     }
   );
+
+  if (!output.is_contiguous()) {
+    output.copy_(work_output.view(output.sizes()));
+  }
 }
 
 #undef LAUNCH_UPDATE_OUTPUT_KERNEL_WIDTH
@@ -507,7 +515,11 @@ TORCH_IMPL_FUNC(avg_pool3d_backward_out_cuda) (
 
   const bool kernelsOverlap = (dT < kT) || (dH < kH) || (dW < kW);
 
-  Tensor work_grad_input = gradInput;
+  // the CUDA kernels expect NCDHW data; materialize a contiguous gradient when
+  // the structured meta allocated it in channels_last_3d and copy back below
+  Tensor work_grad_input = gradInput.is_contiguous()
+      ? gradInput
+      : at::zeros(gradInput.sizes(), gradInput.options());
   Tensor work_grad_output = gradOutput.contiguous();
 
   if (input.ndimension() == 5) {
@@ -601,6 +613,10 @@ TORCH_IMPL_FUNC(avg_pool3d_backward_out_cuda) (
       }
     );
   }
+
+  if (!gradInput.is_contiguous()) {
+    gradInput.copy_(work_grad_input.view(gradInput.sizes()));
+  }
 }
 
 } // at::native
@@ -30,6 +30,8 @@
 
 #include <c10/macros/Macros.h>
 
+#include <limits>
+
 #if CUB_SUPPORTS_SCAN_BY_KEY()
 #include <thrust/iterator/reverse_iterator.h>
 #endif
@@ -50,8 +52,16 @@ constexpr int MODE_MAX = 2;
 std::pair<Tensor, Tensor> promoteIndicesAndOffsets(
     const Tensor& indices,
     const Tensor& offsets) {
-  const auto commonType =
+  auto commonType =
       promoteTypes(offsets.scalar_type(), indices.scalar_type());
+  // Resolve mixed Int/Long pairs down to Int when the indices are Int: the
+  // kernels only need the two types to agree, and converting the per-bag
+  // offsets is far cheaper than converting the per-lookup indices. Valid
+  // offsets are bounded by indices.numel(), so the demotion cannot overflow.
+  if (indices.scalar_type() == kInt && commonType == kLong &&
+      indices.numel() <= std::numeric_limits<int32_t>::max()) {
+    commonType = kInt;
+  }
   return {
       indices.scalar_type() == commonType ? indices
                                           : indices.toType(commonType),
@@ -0,0 +1,107 @@
+#define TORCH_ASSERT_ONLY_METHOD_OPERATORS
+#include <ATen/core/Tensor.h>
+#include <ATen/cuda/CUDAContext.h>
+#include <ATen/native/Fingerprint.h>
+#include <ATen/native/cuda/block_reduce.cuh>
+#include <c10/cuda/CUDAException.h>
+
+#ifndef AT_PER_OPERATOR_HEADERS
+#include <ATen/Functions.h>
+#include <ATen/NativeFunctions.h>
+#else
+#include <ATen/ops/_tensor_fingerprint_native.h>
+#include <ATen/ops/empty.h>
+#include <ATen/ops/zeros.h>
+#endif
+
+#include <algorithm>
+
+namespace at {
+namespace native {
+
+// CUDA implementation of _tensor_fingerprint; the hash definition and the
+// reason the per-word contributions commute are described in
+// Note [Tensor fingerprint] in Fingerprint.cpp. Everything runs on the
+// device, so no tensor bytes ever cross PCIe; only the caller's final
+// item() moves 8 bytes to the host.
+
+namespace {
+
+constexpr int kFingerprintThreads = 256;
+constexpr int64_t kFingerprintMaxBlocks = 4096;
+
+__global__ void tensor_fingerprint_kernel(
+    const uint8_t* data,
+    int64_t nbytes,
+    unsigned long long* acc) {
+  const int64_t n_words = nbytes / static_cast<int64_t>(sizeof(uint64_t));
+  const uint64_t* words = reinterpret_cast<const uint64_t*>(data);
+  uint64_t local = 0;
+  for (int64_t i = blockIdx.x * static_cast<int64_t>(blockDim.x) + threadIdx.x;
+       i < n_words;
+       i += static_cast<int64_t>(gridDim.x) * blockDim.x) {
+    local += fingerprint_mix64(
+        words[i] ^ fingerprint_mix64(static_cast<uint64_t>(i) + 1));
+  }
+  __shared__ uint64_t shared[C10_WARP_SIZE];
+  const uint64_t block_sum = cuda_utils::BlockReduceSum<uint64_t>(local, shared);
+  if (threadIdx.x == 0) {
+    atomicAdd(acc, static_cast<unsigned long long>(block_sum));
+  }
+}
+
+__global__ void tensor_fingerprint_finalize_kernel(
+    const uint8_t* data,
+    int64_t nbytes,
+    const unsigned long long* acc,
+    int64_t* out) {
+  uint64_t sum = static_cast<uint64_t>(*acc);
+  const int64_t n_words = nbytes / static_cast<int64_t>(sizeof(uint64_t));
+  const int64_t tail = nbytes % static_cast<int64_t>(sizeof(uint64_t));
+  if (tail != 0) {
+    const uint8_t* tail_ptr = data + n_words * sizeof(uint64_t);
+    uint64_t last_word = 0;
+    for (int64_t b = 0; b < tail; b++) {
+      last_word |= static_cast<uint64_t>(tail_ptr[b]) << (8 * b);
+    }
+    sum += fingerprint_mix64(
+        last_word ^ fingerprint_mix64(static_cast<uint64_t>(n_words) + 1));
+  }
+  *out = static_cast<int64_t>(
+      fingerprint_mix64(sum ^ static_cast<uint64_t>(nbytes)));
+}
+
+} // namespace
+
+Tensor _tensor_fingerprint_cuda(const Tensor& self) {
+  TORCH_CHECK(
+      self.layout() == c10::kStrided,
+      "_tensor_fingerprint: only strided tensors are supported, got ",
+      self.layout());
+  auto t = self.contiguous();
+  const auto* data = static_cast<const uint8_t*>(t.const_data_ptr());
+  const int64_t nbytes = t.numel() * t.element_size();
+  const int64_t n_words = nbytes / static_cast<int64_t>(sizeof(uint64_t));
+
+  auto acc = at::zeros({1}, self.options().dtype(at::kLong));
+  auto out = at::empty({}, self.options().dtype(at::kLong));
+  auto* acc_data = reinterpret_cast<unsigned long long*>(
+      acc.mutable_data_ptr<int64_t>());
+  auto stream = at::cuda::getCurrentCUDAStream();
+
+  if (n_words > 0) {
+    const int64_t blocks = std::min(
+        (n_words + kFingerprintThreads - 1) / kFingerprintThreads,
+        kFingerprintMaxBlocks);
+    tensor_fingerprint_kernel<<<blocks, kFingerprintThreads, 0, stream>>>(
+        data, nbytes, acc_data);
+    C10_CUDA_KERNEL_LAUNCH_CHECK();
+  }
+  tensor_fingerprint_finalize_kernel<<<1, 1, 0, stream>>>(
+      data, nbytes, acc_data, out.mutable_data_ptr<int64_t>());
+  C10_CUDA_KERNEL_LAUNCH_CHECK();
+  return out;
+}
+
+} // namespace native
+} // namespace at
@@ -0,0 +1,236 @@
+#define TORCH_ASSERT_ONLY_METHOD_OPERATORS
+#include <ATen/native/FusedDropoutAddLayerNorm.h>
+
+#include <ATen/AccumulateType.h>
+#include <ATen/Dispatch.h>
+#include <ATen/OpMathType.h>
+#include <ATen/core/Tensor.h>
+#include <ATen/cuda/CUDAContext.h>
+#include <ATen/cuda/CUDAGeneratorImpl.h>
+#include <ATen/cuda/CUDAGraphsUtils.cuh>
+#include <ATen/cuda/Exceptions.h>
+#include <ATen/native/cuda/block_reduce.cuh>
+#include <c10/cuda/CUDAException.h>
+#include <curand_kernel.h>
+
+#ifndef AT_PER_OPERATOR_HEADERS
+#include <ATen/Functions.h>
+#include <ATen/NativeFunctions.h>
+#else
+#include <ATen/ops/_fused_dropout_add_layer_norm_native.h>
+#include <ATen/ops/empty.h>
+#endif
+
+#include <tuple>
+
+namespace at {
+namespace native {
+
+namespace {
+
+constexpr int kFusedDropoutAddLayerNormThreads = 256;
+
+// One block per row: apply dropout to the sublayer output, add the residual,
+// write the pre-norm value, block-reduce mean/variance and normalize while
+// the row is register/L2 resident. Each thread owns whole 8-element mask
+// bytes of its row, drawing two curand_uniform4 per byte from a Philox
+// subsequence keyed by the global thread id, so the mask is reproducible for
+// a given seed/offset independent of grid size. See
+// fused_dropout_add_layer_norm_cpu for the op-level contract.
+template <typename scalar_t, bool use_dropout>
+__global__ void fused_dropout_add_layer_norm_kernel(
+    const scalar_t* __restrict__ input,
+    const scalar_t* __restrict__ residual,
+    const scalar_t* __restrict__ gamma,
+    const scalar_t* __restrict__ beta,
+    scalar_t* __restrict__ out,
+    uint8_t* __restrict__ mask,
+    at::acc_type<scalar_t, true>* __restrict__ mean_out,
+    at::acc_type<scalar_t, true>* __restrict__ rstd_out,
+    int64_t D,
+    int64_t mask_bytes,
+    at::opmath_type<scalar_t> p,
+    at::opmath_type<scalar_t> eps,
+    PhiloxCudaState philox_args) {
+  using opmath_t = at::opmath_type<scalar_t>;
+  __shared__ opmath_t shared[C10_WARP_SIZE];
+  __shared__ opmath_t mean_shared;
+  __shared__ opmath_t rstd_shared;
+
+  const int64_t row = blockIdx.x;
+  const scalar_t* in_row = input + row * D;
+  const scalar_t* res_row = residual + row * D;
+  scalar_t* out_row = out + row * D;
+
+  curandStatePhilox4_32_10_t state;
+  opmath_t dropout_scale = 1;
+  if (use_dropout) {
+    auto seeds = at::cuda::philox::unpack(philox_args);
+    curand_init(
+        std::get<0>(seeds),
+        blockIdx.x * blockDim.x + threadIdx.x,
+        std::get<1>(seeds),
+        &state);
+    dropout_scale = opmath_t(1) / (opmath_t(1) - p);
+  }
+
+  opmath_t sum = 0;
+  opmath_t sum_sq = 0;
+  for (int64_t b = threadIdx.x; b < mask_bytes; b += blockDim.x) {
+    uint8_t byte = 0xff;
+    if (use_dropout) {
+      const float4 lo = curand_uniform4(&state);
+      const float4 hi = curand_uniform4(&state);
+      byte = (lo.x >= p) | ((lo.y >= p) << 1) | ((lo.z >= p) << 2) |
+          ((lo.w >= p) << 3) | ((hi.x >= p) << 4) | ((hi.y >= p) << 5) |
+          ((hi.z >= p) << 6) | ((hi.w >= p) << 7);
+      mask[row * mask_bytes + b] = byte;
+    }
+    const int64_t j_begin = b * kFusedDropoutMaskBitsPerByte;
+    const int64_t j_end =
+        j_begin + kFusedDropoutMaskBitsPerByte < D
+        ? j_begin + kFusedDropoutMaskBitsPerByte
+        : D;
+    for (int64_t j = j_begin; j < j_end; ++j) {
+      opmath_t val = static_cast<opmath_t>(in_row[j]);
+      if (use_dropout) {
+        const bool keep = (byte >> (j - j_begin)) & 1;
+        val = keep ? val * dropout_scale : opmath_t(0);
+      }
+      val += static_cast<opmath_t>(res_row[j]);
+      out_row[j] = static_cast<scalar_t>(val);
+      sum += val;
+      sum_sq += val * val;
+    }
+  }
+  sum = cuda_utils::BlockReduceSum(sum, shared);
+  __syncthreads();
+  sum_sq = cuda_utils::BlockReduceSum(sum_sq, shared);
+  if (threadIdx.x == 0) {
+    const opmath_t scale = opmath_t(1) / static_cast<opmath_t>(D);
+    const opmath_t mean_val = sum * scale;
+    opmath_t var = sum_sq * scale - mean_val * mean_val;
+    var = var < opmath_t(0) ? opmath_t(0) : var;
+    mean_shared = mean_val;
+    rstd_shared = rsqrt(var + eps);
+    mean_out[row] = mean_val;
+    rstd_out[row] = rstd_shared;
+  }
+  __syncthreads();
+
+  const opmath_t mean_val = mean_shared;
+  const opmath_t rstd_val = rstd_shared;
+  for (int64_t j = threadIdx.x; j < D; j += blockDim.x) {
+    opmath_t val = (static_cast<opmath_t>(out_row[j]) - mean_val) * rstd_val;
+    if (gamma != nullptr) {
+      val *= static_cast<opmath_t>(gamma[j]);
+    }
+    if (beta != nullptr) {
+      val += static_cast<opmath_t>(beta[j]);
+    }
+    out_row[j] = static_cast<scalar_t>(val);
+  }
+}
+
+} // namespace
+
+std::tuple<Tensor, Tensor, Tensor, Tensor> fused_dropout_add_layer_norm_cuda(
+    const Tensor& input,
+    const Tensor& residual,
+    const c10::optional<Tensor>& gamma_opt,
+    const c10::optional<Tensor>& beta_opt,
+    double p,
+    bool train,
+    double eps) {
+  c10::MaybeOwned<Tensor> gamma_maybe_owned =
+      at::borrow_from_optional_tensor(gamma_opt);
+  const Tensor& gamma = *gamma_maybe_owned;
+  c10::MaybeOwned<Tensor> beta_maybe_owned =
+      at::borrow_from_optional_tensor(beta_opt);
+  const Tensor& beta = *beta_maybe_owned;
+
+  auto M_D = _check_fused_dropout_add_layer_norm_inputs(
+      input, residual, gamma, beta, p);
+  const int64_t M = std::get<0>(M_D);
+  const int64_t D = std::get<1>(M_D);
+
+  auto input_c = input.expect_contiguous();
+  auto residual_c = residual.expect_contiguous();
+  auto gamma_c = gamma.expect_contiguous();
+  auto beta_c = beta.expect_contiguous();
+
+  const bool use_dropout = train && p > 0;
+  const int64_t mask_bytes = _fused_dropout_mask_bytes_per_row(D);
+
+  Tensor out = at::empty(input.sizes(), input.options());
+  Tensor mask = at::empty(
+      {use_dropout ? M : 0, mask_bytes}, input.options().dtype(kByte));
+  // layer_norm_backward_cuda reads the stats in the accumulation dtype
+  // (float for Half/BFloat16), so save them that way, as layer_norm_cuda
+  // does.
+  auto acc_type = at::toAccumulateType(input.scalar_type(), /*is_cuda=*/true);
+  Tensor mean = at::empty({M}, input.options().dtype(acc_type));
+  Tensor rstd = at::empty({M}, input.options().dtype(acc_type));
+
+  if (M > 0) {
+    cudaStream_t stream = at::cuda::getCurrentCUDAStream();
+    PhiloxCudaState rng_engine_inputs;
+    if (use_dropout) {
+      auto gen = at::get_generator_or_default<CUDAGeneratorImpl>(
+          c10::nullopt, cuda::detail::getDefaultCUDAGenerator());
+      // Two curand_uniform4 calls per mask byte owned by a thread.
+      const int64_t counter_offset = 2 *
+          ((mask_bytes + kFusedDropoutAddLayerNormThreads - 1) /
+           kFusedDropoutAddLayerNormThreads);
+      // See Note [Acquire lock when using random generators]
+      std::lock_guard<std::mutex> lock(gen->mutex_);
+      rng_engine_inputs = gen->philox_cuda_state(counter_offset);
+    }
+    AT_DISPATCH_FLOATING_TYPES_AND2(
+        kBFloat16,
+        kHalf,
+        input.scalar_type(),
+        "fused_dropout_add_layer_norm_cuda",
+        [&] {
+          using opmath_t = at::opmath_type<scalar_t>;
+          auto launch = [&](auto use_dropout_t) {
+            fused_dropout_add_layer_norm_kernel<
+                scalar_t,
+                decltype(use_dropout_t)::value>
+                <<<M, kFusedDropoutAddLayerNormThreads, 0, stream>>>(
+                    input_c->const_data_ptr<scalar_t>(),
+                    residual_c->const_data_ptr<scalar_t>(),
+                    gamma.defined() ? gamma_c->const_data_ptr<scalar_t>()
+                                    : nullptr,
+                    beta.defined() ? beta_c->const_data_ptr<scalar_t>()
+                                   : nullptr,
+                    out.mutable_data_ptr<scalar_t>(),
+                    use_dropout ? mask.mutable_data_ptr<uint8_t>() : nullptr,
+                    mean.mutable_data_ptr<at::acc_type<scalar_t, true>>(),
+                    rstd.mutable_data_ptr<at::acc_type<scalar_t, true>>(),
+                    D,
+                    mask_bytes,
+                    static_cast<opmath_t>(p),
+                    static_cast<opmath_t>(eps),
+                    rng_engine_inputs);
+            C10_CUDA_KERNEL_LAUNCH_CHECK();
+          };
+          if (use_dropout) {
+            launch(std::true_type{});
+          } else {
+            launch(std::false_type{});
+          }
+        });
+  }
+
+  auto stat_sizes = input.sizes().vec();
+  stat_sizes.back() = 1;
+  return std::make_tuple(
+      std::move(out),
+      std::move(mask),
+      mean.view(stat_sizes),
+      rstd.view(stat_sizes));
+}
+
+} // namespace native
+} // namespace at
@@ -0,0 +1,176 @@
+#define TORCH_ASSERT_ONLY_METHOD_OPERATORS
+#include <ATen/native/FusedEmbeddingLayerNorm.h>
+
+#include <ATen/AccumulateType.h>
+#include <ATen/Dispatch.h>
+#include <ATen/OpMathType.h>
+#include <ATen/core/Tensor.h>
+#include <ATen/cuda/CUDAContext.h>
+#include <ATen/cuda/Exceptions.h>
+#include <ATen/native/cuda/block_reduce.cuh>
+#include <c10/cuda/CUDAException.h>
+
+#ifndef AT_PER_OPERATOR_HEADERS
+#include <ATen/Functions.h>
+#include <ATen/NativeFunctions.h>
+#else
+#include <ATen/ops/_fused_embedding_layer_norm_native.h>
+#include <ATen/ops/empty.h>
+#endif
+
+#include <tuple>
+
+namespace at {
+namespace native {
+
+namespace {
+
+constexpr int kFusedEmbeddingLayerNormThreads = 256;
+
+// One block per output row: gathers the token and positional rows, writes
+// their sum, block-reduces mean/variance and normalizes while the row is
+// still resident. See fused_embedding_layer_norm_cpu for the op-level
+// contract.
+template <typename scalar_t, typename index_t>
+__global__ void fused_embedding_layer_norm_kernel(
+    const scalar_t* __restrict__ weight,
+    const scalar_t* __restrict__ pos_weight,
+    const index_t* __restrict__ indices,
+    const scalar_t* __restrict__ gamma,
+    const scalar_t* __restrict__ beta,
+    scalar_t* __restrict__ out,
+    at::acc_type<scalar_t, true>* __restrict__ mean_out,
+    at::acc_type<scalar_t, true>* __restrict__ rstd_out,
+    int64_t num_weights,
+    int64_t S,
+    int64_t D,
+    at::opmath_type<scalar_t> eps) {
+  using opmath_t = at::opmath_type<scalar_t>;
+  __shared__ opmath_t shared[C10_WARP_SIZE];
+  __shared__ opmath_t mean_shared;
+  __shared__ opmath_t rstd_shared;
+
+  const int64_t row = blockIdx.x;
+  const index_t idx = indices[row];
+  CUDA_KERNEL_ASSERT(idx >= 0 && idx < num_weights);
+  const scalar_t* w_row = weight + idx * D;
+  const scalar_t* p_row = pos_weight + (row % S) * D;
+  scalar_t* out_row = out + row * D;
+
+  opmath_t sum = 0;
+  opmath_t sum_sq = 0;
+  for (int64_t j = threadIdx.x; j < D; j += blockDim.x) {
+    const opmath_t val =
+        static_cast<opmath_t>(w_row[j]) + static_cast<opmath_t>(p_row[j]);
+    out_row[j] = static_cast<scalar_t>(val);
+    sum += val;
+    sum_sq += val * val;
+  }
+  sum = cuda_utils::BlockReduceSum(sum, shared);
+  __syncthreads();
+  sum_sq = cuda_utils::BlockReduceSum(sum_sq, shared);
+  if (threadIdx.x == 0) {
+    const opmath_t scale = opmath_t(1) / static_cast<opmath_t>(D);
+    const opmath_t mean_val = sum * scale;
+    opmath_t var = sum_sq * scale - mean_val * mean_val;
+    var = var < opmath_t(0) ? opmath_t(0) : var;
+    mean_shared = mean_val;
+    rstd_shared = rsqrt(var + eps);
+    mean_out[row] = mean_val;
+    rstd_out[row] = rstd_shared;
+  }
+  __syncthreads();
+
+  const opmath_t mean_val = mean_shared;
+  const opmath_t rstd_val = rstd_shared;
+  for (int64_t j = threadIdx.x; j < D; j += blockDim.x) {
+    opmath_t val =
+        (static_cast<opmath_t>(out_row[j]) - mean_val) * rstd_val;
+    if (gamma != nullptr) {
+      val *= static_cast<opmath_t>(gamma[j]);
+    }
+    if (beta != nullptr) {
+      val += static_cast<opmath_t>(beta[j]);
+    }
+    out_row[j] = static_cast<scalar_t>(val);
+  }
+}
+
+} // namespace
+
+std::tuple<Tensor, Tensor, Tensor> fused_embedding_layer_norm_cuda(
+    const Tensor& weight,
+    const Tensor& pos_weight,
+    const Tensor& indices,
+    const c10::optional<Tensor>& gamma_opt,
+    const c10::optional<Tensor>& beta_opt,
+    double eps) {
+  c10::MaybeOwned<Tensor> gamma_maybe_owned =
+      at::borrow_from_optional_tensor(gamma_opt);
+  const Tensor& gamma = *gamma_maybe_owned;
+  c10::MaybeOwned<Tensor> beta_maybe_owned =
+      at::borrow_from_optional_tensor(beta_opt);
+  const Tensor& beta = *beta_maybe_owned;
+
+  auto N_S_D = _check_fused_embedding_layer_norm_inputs(
+      weight, pos_weight, indices, gamma, beta);
+  const int64_t N = std::get<0>(N_S_D);
+  const int64_t S = std::get<1>(N_S_D);
+  const int64_t D = std::get<2>(N_S_D);
+
+  auto weight_c = weight.expect_contiguous();
+  auto pos_weight_c = pos_weight.expect_contiguous();
+  auto indices_c = indices.expect_contiguous();
+  auto gamma_c = gamma.expect_contiguous();
+  auto beta_c = beta.expect_contiguous();
+
+  auto out_sizes = indices.sizes().vec();
+  out_sizes.push_back(D);
+  Tensor out = at::empty(out_sizes, weight.options());
+  // layer_norm_backward_cuda reads the stats in the accumulation dtype
+  // (float for Half/BFloat16), so save them that way, as layer_norm_cuda
+  // does.
+  auto acc_type = at::toAccumulateType(weight.scalar_type(), /*is_cuda=*/true);
+  Tensor mean = at::empty({N}, weight.options().dtype(acc_type));
+  Tensor rstd = at::empty({N}, weight.options().dtype(acc_type));
+
+  if (N > 0) {
+    cudaStream_t stream = at::cuda::getCurrentCUDAStream();
+    AT_DISPATCH_INDEX_TYPES(
+        indices.scalar_type(), "fused_embedding_layer_norm_cuda_index", [&] {
+          AT_DISPATCH_FLOATING_TYPES_AND2(
+              kBFloat16,
+              kHalf,
+              weight.scalar_type(),
+              "fused_embedding_layer_norm_cuda",
+              [&] {
+                fused_embedding_layer_norm_kernel<scalar_t, index_t>
+                    <<<N, kFusedEmbeddingLayerNormThreads, 0, stream>>>(
+                        weight_c->const_data_ptr<scalar_t>(),
+                        pos_weight_c->const_data_ptr<scalar_t>(),
+                        indices_c->const_data_ptr<index_t>(),
+                        gamma.defined()
+                            ? gamma_c->const_data_ptr<scalar_t>()
+                            : nullptr,
+                        beta.defined() ? beta_c->const_data_ptr<scalar_t>()
+                                       : nullptr,
+                        out.mutable_data_ptr<scalar_t>(),
+                        mean.mutable_data_ptr<at::acc_type<scalar_t, true>>(),
+                        rstd.mutable_data_ptr<at::acc_type<scalar_t, true>>(),
+                        weight.size(0),
+                        S,
+                        D,
+                        static_cast<at::opmath_type<scalar_t>>(eps));
+                C10_CUDA_KERNEL_LAUNCH_CHECK();
+              });
+        });
+  }
+
+  auto stat_sizes = indices.sizes().vec();
+  stat_sizes.push_back(1);
+  return std::make_tuple(
+      std::move(out), mean.view(stat_sizes), rstd.view(stat_sizes));
+}
+
+} // namespace native
+} // namespace at
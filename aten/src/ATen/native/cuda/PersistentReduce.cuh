@@ -0,0 +1,359 @@
+#pragma once
+
+#include <ATen/cuda/CUDAContext.h>
+#include <ATen/cuda/CUDAGraphsUtils.cuh>
+#include <c10/cuda/CUDAGuard.h>
+#include <c10/util/env.h>
+
+#if !defined(USE_ROCM) && defined(PYTORCH_C10_DRIVER_API_SUPPORTED)
+#include <c10/cuda/driver_api.h>
+#endif
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+
+namespace at {
+namespace native {
+
+struct ReduceConfig; // defined in Reduce.cuh; complete at instantiation time
+
+namespace persistent_reduce {
+
+// Note [Persistent reduction kernels]
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// Decode-style inference loops run tens of thousands of tiny reductions per
+// second (e.g. a sum over hidden=4096 per token), and each pays full kernel
+// launch latency. When PYTORCH_CUDA_PERSISTENT_REDUCTIONS=1, single-block
+// reductions are instead fed to a resident kernel through a work queue in
+// mapped pinned memory:
+//
+//  - submit() copies the fully-built ReduceOp into a queue slot, then
+//    enqueues a cuStreamWriteValue64 of the item's sequence number on the
+//    submitting stream. The write lands only after the item's producers
+//    have run, so the resident kernel never reads inputs early, and its
+//    arrival also publishes the slot contents.
+//  - a cuStreamWaitValue64 on the submitting stream blocks later work until
+//    the resident kernel bumps the queue's done counter, preserving
+//    ordinary stream-ordering for consumers. Neither memop is a kernel
+//    launch; in a tight loop the reduction itself is the only device work.
+//  - the resident kernel spins briefly when the queue drains and then
+//    parks (exits), so it can never hang cudaDeviceSynchronize. A per-queue
+//    host thread owns (re)launching: it polls while items are outstanding
+//    and revives the kernel whenever it parked with work still queued, so a
+//    park racing with a submission costs one poll interval, not progress.
+//
+// One queue exists per (reduction instantiation, device, stream); the
+// resident block's geometry is pinned by the first submission and later
+// submissions that don't match it (or that exceed the queue's shared memory
+// allotment, or that arrive during graph capture) simply fall back to a
+// regular launch. Only single-block reductions (grid 1x1, no global
+// reduce, output_vec_size 1) are eligible, which is exactly the tiny-input
+// regime where launch overhead dominates.
+
+#if !defined(USE_ROCM) && defined(PYTORCH_C10_DRIVER_API_SUPPORTED)
+
+constexpr uint64_t kQueueSlots = 64; // power of two
+constexpr int kIdleSpinsBeforePark = 4096;
+constexpr unsigned int kSpinSleepNs = 256;
+
+struct alignas(128) PersistentQueueControl {
+  // host -> device: highest sequence number whose producers have completed
+  // on the submitting stream (written via cuStreamWriteValue64)
+  volatile unsigned long long gate_seq;
+  // device -> host: last completed item (also the target of the
+  // cuStreamWaitValue64 issued at submission)
+  alignas(128) volatile unsigned long long done_seq;
+  // device -> host: nonzero when the kernel has exited; holds the sequence
+  // number the next launch must start from
+  alignas(128) volatile unsigned long long parked_at;
+};
+
+template <typename R>
+struct alignas(128) PersistentSlot {
+  R reduction;
+};
+
+template <int nt, typename R>
+C10_LAUNCH_BOUNDS_1(nt)
+__global__ void persistent_reduce_kernel(
+    PersistentQueueControl* ctl,
+    PersistentSlot<R>* slots,
+    unsigned long long start_seq) {
+  __shared__ typename std::aligned_storage<sizeof(R), alignof(R)>::type args;
+  __shared__ int parked;
+  const int tid = threadIdx.x + threadIdx.y * blockDim.x;
+  unsigned long long seq = start_seq;
+  while (true) {
+    if (tid == 0) {
+      parked = 0;
+      int spins = 0;
+      while (ctl->gate_seq < seq) {
+        if (++spins > kIdleSpinsBeforePark) {
+          parked = 1;
+          break;
+        }
+#if defined(__CUDA_ARCH__) && __CUDA_ARCH__ >= 700
+        __nanosleep(kSpinSleepNs);
+#endif
+      }
+      if (parked) {
+        ctl->parked_at = seq;
+        __threadfence_system();
+      }
+    }
+    __syncthreads();
+    if (parked) {
+      return;
+    }
+    // Stage the item's ReduceOp into shared memory so only one block-wide
+    // read crosses the bus per item.
+    {
+      const char* src = reinterpret_cast<const char*>(
+          &slots[(seq - 1) % kQueueSlots].reduction);
+      char* dst = reinterpret_cast<char*>(&args);
+      for (unsigned i = tid; i < sizeof(R); i += blockDim.x * blockDim.y) {
+        dst[i] = src[i];
+      }
+    }
+    __syncthreads();
+    reinterpret_cast<R*>(&args)->template run<1>();
+    __syncthreads();
+    if (tid == 0) {
+      __threadfence_system();
+      ctl->done_seq = seq;
+    }
+    seq++;
+  }
+}
+
+inline bool persistent_reduction_enabled() {
+  static bool enabled =
+      c10::utils::check_env("PYTORCH_CUDA_PERSISTENT_REDUCTIONS") == true;
+  return enabled;
+}
+
+template <int nt, typename R>
+class PersistentReduceQueue {
+ public:
+  PersistentReduceQueue(int device, dim3 block, int shared_memory)
+      : device_(device), block_(block), shared_memory_(shared_memory) {
+    at::cuda::CUDAGuard guard(device_);
+    int least_priority = 0, greatest_priority = 0;
+    C10_CUDA_CHECK(cudaDeviceGetStreamPriorityRange(
+        &least_priority, &greatest_priority));
+    C10_CUDA_CHECK(cudaStreamCreateWithPriority(
+        &launch_stream_, cudaStreamNonBlocking, greatest_priority));
+    C10_CUDA_CHECK(cudaHostAlloc(
+        reinterpret_cast<void**>(&ctl_),
+        sizeof(PersistentQueueControl),
+        cudaHostAllocMapped | cudaHostAllocPortable));
+    C10_CUDA_CHECK(cudaHostAlloc(
+        reinterpret_cast<void**>(&slots_),
+        sizeof(PersistentSlot<R>) * kQueueSlots,
+        cudaHostAllocMapped | cudaHostAllocPortable));
+    std::memset(ctl_, 0, sizeof(PersistentQueueControl));
+    // The kernel is launched lazily: "parked before item 1".
+    ctl_->parked_at = 1;
+    void* dev_ctl = nullptr;
+    void* dev_slots = nullptr;
+    C10_CUDA_CHECK(cudaHostGetDevicePointer(&dev_ctl, ctl_, 0));
+    C10_CUDA_CHECK(cudaHostGetDevicePointer(&dev_slots, slots_, 0));
+    dev_ctl_ = static_cast<PersistentQueueControl*>(dev_ctl);
+    dev_slots_ = static_cast<PersistentSlot<R>*>(dev_slots);
+    gate_devptr_ = reinterpret_cast<CUdeviceptr>(&dev_ctl_->gate_seq);
+    done_devptr_ = reinterpret_cast<CUdeviceptr>(&dev_ctl_->done_seq);
+    // Probe stream memop support once, on our own stream, before anything
+    // depends on it.
+    usable_ = c10::cuda::DriverAPI::get()->cuStreamWriteValue64_(
+                  launch_stream_, gate_devptr_, 0, 0) == CUDA_SUCCESS;
+    if (usable_) {
+      // Leaked with the queue itself; see get_queue().
+      relauncher_ = std::thread([this] { relaunch_loop(); });
+      relauncher_.detach();
+    }
+  }
+
+  PersistentReduceQueue(const PersistentReduceQueue&) = delete;
+  PersistentReduceQueue& operator=(const PersistentReduceQueue&) = delete;
+
+  bool matches(dim3 block, int shared_memory) const {
+    return usable_ && block.x == block_.x && block.y == block_.y &&
+        shared_memory <= shared_memory_;
+  }
+
+  // Enqueues `reduction` and makes `stream` wait for its completion.
+  // Caller has checked matches().
+  bool submit(const R& reduction, cudaStream_t stream) {
+    std::lock_guard<std::mutex> g(mutex_);
+    const unsigned long long seq = next_seq_ + 1;
+    // Backpressure: never overwrite a slot the kernel hasn't drained. Only
+    // reachable with kQueueSlots reductions already in flight.
+    while (seq - ctl_->done_seq > kQueueSlots) {
+      std::this_thread::yield();
+    }
+    slots_[(seq - 1) % kQueueSlots].reduction = reduction;
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    auto* driver = c10::cuda::DriverAPI::get();
+    if (driver->cuStreamWriteValue64_(stream, gate_devptr_, seq, 0) !=
+        CUDA_SUCCESS) {
+      // Nothing observable was enqueued; let the caller fall back.
+      return false;
+    }
+    C10_CUDA_DRIVER_CHECK(driver->cuStreamWaitValue64_(
+        stream, done_devptr_, seq, CU_STREAM_WAIT_VALUE_GEQ));
+    next_seq_ = seq;
+    {
+      std::lock_guard<std::mutex> lg(relaunch_mutex_);
+      submitted_seq_ = seq;
+    }
+    relaunch_cv_.notify_one();
+    return true;
+  }
+
+ private:
+  void relaunch_loop() {
+    while (true) {
+      unsigned long long target = 0;
+      {
+        std::unique_lock<std::mutex> lk(relaunch_mutex_);
+        relaunch_cv_.wait(lk, [&] { return submitted_seq_ > drained_seq_; });
+        target = submitted_seq_;
+      }
+      // Keep the kernel alive until everything submitted so far is done.
+      // The kernel parks on its own whenever its queue looks empty, so a
+      // park racing with a submission just costs one poll interval here.
+      while (ctl_->done_seq < target) {
+        const unsigned long long parked_at = ctl_->parked_at;
+        if (parked_at != 0 && parked_at <= target) {
+          ctl_->parked_at = 0;
+          std::atomic_thread_fence(std::memory_order_seq_cst);
+          at::cuda::CUDAGuard guard(device_);
+          persistent_reduce_kernel<nt, R>
+              <<<dim3(1, 1, 1), block_, shared_memory_, launch_stream_>>>(
+                  dev_ctl_, dev_slots_, parked_at);
+          C10_CUDA_KERNEL_LAUNCH_CHECK();
+        }
+        std::this_thread::sleep_for(std::chrono::microseconds(20));
+        {
+          std::lock_guard<std::mutex> lk(relaunch_mutex_);
+          target = submitted_seq_;
+        }
+      }
+      {
+        std::lock_guard<std::mutex> lk(relaunch_mutex_);
+        drained_seq_ = target;
+      }
+    }
+  }
+
+  int device_;
+  dim3 block_;
+  int shared_memory_;
+  bool usable_ = false;
+  cudaStream_t launch_stream_ = nullptr;
+  PersistentQueueControl* ctl_ = nullptr; // fields are individually volatile
+  PersistentSlot<R>* slots_ = nullptr;
+  PersistentQueueControl* dev_ctl_ = nullptr;
+  PersistentSlot<R>* dev_slots_ = nullptr;
+  CUdeviceptr gate_devptr_ = 0;
+  CUdeviceptr done_devptr_ = 0;
+
+  std::mutex mutex_; // serializes submit()
+  unsigned long long next_seq_ = 0;
+
+  std::thread relauncher_;
+  std::mutex relaunch_mutex_;
+  std::condition_variable relaunch_cv_;
+  unsigned long long submitted_seq_ = 0;
+  unsigned long long drained_seq_ = 0;
+};
+
+// One queue per (instantiation, device, stream). Queues and their relaunch
+// threads are intentionally leaked, like other CUDA singletons, to avoid
+// shutdown ordering problems.
+template <int nt, typename R>
+PersistentReduceQueue<nt, R>* get_queue(
+    int device,
+    cudaStream_t stream,
+    dim3 block,
+    int shared_memory) {
+  using Key = std::pair<int, cudaStream_t>;
+  struct KeyHash {
+    size_t operator()(const Key& k) const {
+      return std::hash<int>()(k.first) ^
+          std::hash<void*>()(reinterpret_cast<void*>(k.second));
+    }
+  };
+  static std::mutex m;
+  static auto* queues =
+      new std::unordered_map<Key, PersistentReduceQueue<nt, R>*, KeyHash>();
+  std::lock_guard<std::mutex> g(m);
+  auto it = queues->find({device, stream});
+  if (it == queues->end()) {
+    it = queues
+             ->emplace(
+                 Key{device, stream},
+                 new PersistentReduceQueue<nt, R>(device, block, shared_memory))
+             .first;
+  }
+  return it->second;
+}
+
+// Routes `reduction` through the persistent queue if it is eligible and the
+// mode is enabled. Returns false when the caller should launch normally.
+// Reductions whose ReduceOp cannot be memcpy'd through the work queue are
+// excluded by overload resolution rather than a static_assert, so they
+// simply keep using regular launches.
+template <int max_threads, typename R>
+typename std::enable_if<!std::is_trivially_copyable<R>::value, bool>::type
+try_persistent_reduce(const ReduceConfig&, const R&) {
+  return false;
+}
+
+template <int max_threads, typename R>
+typename std::enable_if<std::is_trivially_copyable<R>::value, bool>::type
+try_persistent_reduce(const ReduceConfig& config, const R& reduction) {
+  if (!persistent_reduction_enabled()) {
+    return false;
+  }
+  if (config.output_vec_size != 1 || config.should_global_reduce()) {
+    return false;
+  }
+  const dim3 grid = config.grid();
+  if (grid.x != 1 || grid.y != 1) {
+    return false;
+  }
+  // Stream memops are not graph-capturable work items.
+  if (at::cuda::currentStreamCaptureStatus() != at::cuda::CaptureStatus::None) {
+    return false;
+  }
+  const auto stream = at::cuda::getCurrentCUDAStream();
+  auto* queue = get_queue<max_threads, R>(
+      stream.device_index(),
+      stream.stream(),
+      config.block(),
+      config.shared_memory_size());
+  if (!queue->matches(config.block(), config.shared_memory_size())) {
+    return false;
+  }
+  return queue->submit(reduction, stream.stream());
+}
+
+#else // !defined(USE_ROCM) && defined(PYTORCH_C10_DRIVER_API_SUPPORTED)
+
+template <int max_threads, typename R>
+bool try_persistent_reduce(const ReduceConfig&, const R&) {
+  return false;
+}
+
+#endif
+
+} // namespace persistent_reduce
+} // namespace native
+} // namespace at
@@ -18,6 +18,7 @@
 #include <thrust/pair.h>
 
 #include <ATen/native/cuda/jit_utils.h>
+#include <ATen/native/cuda/PersistentReduce.cuh>
 
 namespace at { namespace native {
 
@@ -1229,6 +1230,13 @@ inline void gpu_reduce_kernel(TensorIterator& iter, const ops_t& ops, ident_t id
   reduce.accumulate = iter.should_accumulate();
   reduce.final_output = iter.is_final_output();
 
+  // Small single-block reductions can skip the launch entirely; see
+  // Note [Persistent reduction kernels] in PersistentReduce.cuh.
+  if (persistent_reduce::try_persistent_reduce<
+          mnt_wrapper<scalar_t>::MAX_NUM_THREADS>(config, reduce)) {
+    return;
+  }
+
   launch_reduce_kernel<mnt_wrapper<scalar_t>::MAX_NUM_THREADS>(config, reduce);
 }
 
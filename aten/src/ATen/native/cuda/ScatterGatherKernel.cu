@@ -14,6 +14,14 @@
 #include <ATen/cuda/detail/OffsetCalculator.cuh>
 #include <ATen/cuda/Atomic.cuh>
 #include <ATen/cuda/CUDAContext.h>
+#include <ATen/cuda/cub.h>
+
+#ifndef AT_PER_OPERATOR_HEADERS
+#include <ATen/Functions.h>
+#else
+#include <ATen/ops/arange.h>
+#include <ATen/ops/empty.h>
+#endif
 
 namespace at::native {
 
@@ -468,6 +476,158 @@ struct cuda_scatter_fill_base_kernel {
   }
 }; // struct cuda_scatter_fill_base_kernel
 
+// Deterministic scatter_add: instead of racing atomicAdds, materialize one
+// (destination offset, source value) pair per index element, stable-sort the
+// pairs by destination with cub, and let the thread that owns the first
+// element of each run of equal destinations reduce the whole run. A single
+// writer per output element and a fixed (source-order) summation order make
+// the result independent of the launch configuration, at the cost of the
+// sort and ~40 bytes of scratch per index element.
+
+template <typename scalar_t>
+struct _cuda_scatter_add_materialize_kernel {
+  void operator() (
+    TensorIterator& iter,
+    int64_t index_size,
+    int64_t index_stride,
+    const char* self_base,
+    int64_t* keys,
+    scalar_t* vals,
+    int64_t& pos
+  ) {
+    if (!iter.can_use_32bit_indexing()) {
+      for (auto& sub_iter : iter.with_32bit_indexing()) {
+        (*this)(sub_iter, index_size, index_stride, self_base, keys, vals, pos);
+      }
+      return;
+    }
+
+    char* self_ptr = (char*)iter.data_ptr(0);
+    char* src_ptr = (char*)iter.data_ptr(1);
+    char* index_ptr = (char*)iter.data_ptr(2);
+
+    // Keys are byte offsets of the destination element relative to the
+    // (fixed) base of the output, so runs of equal keys are exactly the
+    // elements that would have contended on one atomicAdd.
+    const int64_t self_offset = self_ptr - self_base;
+    int64_t* keys_out = keys + pos;
+    scalar_t* vals_out = vals + pos;
+
+    auto offset_calc = make_offset_calculator<3>(iter);
+    auto loop = [=]C10_DEVICE(int i) {
+      auto offsets = offset_calc.get(i);
+
+      int64_t idx_dim = *(int64_t*)(index_ptr + offsets[2]);
+      CUDA_KERNEL_ASSERT(idx_dim >= 0 && idx_dim < index_size
+        && "index out of bounds");
+
+      keys_out[i] = self_offset + offsets[0] +
+          idx_dim * index_stride * static_cast<int64_t>(sizeof(scalar_t));
+      vals_out[i] = *(scalar_t*)(src_ptr + offsets[1]);
+    };
+
+    _launch_scatter_gather_kernel<num_threads(), thread_work_size()>(iter.numel(), loop);
+    pos += iter.numel();
+  }
+}; // struct _cuda_scatter_add_materialize_kernel
+
+template <typename scalar_t>
+void _launch_scatter_add_segment_kernel(
+  char* self_base,
+  const int64_t* sorted_keys,
+  const int64_t* sorted_positions,
+  const scalar_t* vals,
+  int64_t n
+) {
+  constexpr int64_t max_launch = std::numeric_limits<int32_t>::max();
+  for (int64_t chunk_begin = 0; chunk_begin < n; chunk_begin += max_launch) {
+    const int64_t chunk_size = std::min(n - chunk_begin, max_launch);
+    auto loop = [=]C10_DEVICE(int i) {
+      const int64_t begin = chunk_begin + i;
+      const int64_t key = sorted_keys[begin];
+      if (begin > 0 && sorted_keys[begin - 1] == key) {
+        // Not the first element of its run; the owning thread covers it.
+        return;
+      }
+      scalar_t* dst = (scalar_t*)(self_base + key);
+      scalar_t sum = *dst;
+      for (int64_t j = begin; j < n && sorted_keys[j] == key; ++j) {
+        sum += vals[sorted_positions[j]];
+      }
+      *dst = sum;
+    };
+    _launch_scatter_gather_kernel<num_threads(), thread_work_size()>(chunk_size, loop);
+  }
+}
+
+void scatter_add_deterministic_cuda_kernel(
+  const Tensor& self, int64_t dim,
+  const Tensor& index, const Tensor& src
+) {
+  at::assert_no_internal_overlap(self);
+
+  auto index_sizes = ensure_nonempty_vec(index.sizes().vec());
+  auto src_strides = ensure_nonempty_vec(src.strides().vec());
+
+  // Same restriding as cuda_scatter_gather_base_kernel: iterate over
+  // index.shape with self's stride along dim zeroed out.
+  auto self_restrided = restride_dim(self, dim, index_sizes);
+  auto src_restrided = src.as_strided(index_sizes, src_strides);
+
+  auto iter = TensorIteratorConfig()
+    .set_check_mem_overlap(false)
+    .check_all_same_dtype(false)
+    .resize_outputs(false)
+    .add_output(self_restrided)
+    .add_input(src_restrided)
+    .add_input(index)
+    .build();
+
+  const int64_t n = iter.numel();
+  if (n == 0) {
+    return;
+  }
+
+  auto index_size = ensure_nonempty_size(self, dim);
+  auto index_stride = ensure_nonempty_stride(self, dim);
+
+  auto keys = at::empty({n}, index.options());
+  auto sorted_keys = at::empty({n}, index.options());
+  auto positions = at::arange(n, index.options());
+  auto sorted_positions = at::empty({n}, index.options());
+
+  AT_DISPATCH_ALL_TYPES_AND_COMPLEX_AND3(
+    at::ScalarType::Half, at::ScalarType::Bool, at::ScalarType::BFloat16,
+    iter.dtype(),
+    "scatter_add_deterministic_cuda", [&] {
+      auto vals = at::empty({n}, src.options());
+      char* self_base = (char*)iter.data_ptr(0);
+
+      int64_t pos = 0;
+      _cuda_scatter_add_materialize_kernel<scalar_t>()(
+        iter, index_size, index_stride, self_base,
+        keys.mutable_data_ptr<int64_t>(),
+        vals.mutable_data_ptr<scalar_t>(),
+        pos);
+
+      // cub's radix sort is stable, so within one destination the values
+      // stay in iteration order: the summation order below is fixed.
+      at::cuda::cub::radix_sort_pairs(
+        keys.const_data_ptr<int64_t>(),
+        sorted_keys.mutable_data_ptr<int64_t>(),
+        positions.const_data_ptr<int64_t>(),
+        sorted_positions.mutable_data_ptr<int64_t>(),
+        n);
+
+      _launch_scatter_add_segment_kernel<scalar_t>(
+        self_base,
+        sorted_keys.const_data_ptr<int64_t>(),
+        sorted_positions.const_data_ptr<int64_t>(),
+        vals.const_data_ptr<scalar_t>(),
+        n);
+    });
+}
+
 void gather_cuda_kernel(const Tensor& result, const Tensor& self, int64_t dim, const Tensor& index) {
   cuda_scatter_gather_base_kernel</*is_scatter_like=*/false>()(
     result, dim, index, self,
@@ -490,8 +650,12 @@ void scatter_fill_cuda_kernel(const Tensor& self, int64_t dim, const Tensor& ind
 
 void scatter_add_cuda_kernel(const Tensor& self, int64_t dim, const Tensor& index, const Tensor& src) {
   // See Note [Writing Nondeterministic Operations]
-  // Nondeterministic because of atomicAdd usage
-  globalContext().alertNotDeterministic("scatter_add_cuda_kernel");
+  // The atomicAdd path is nondeterministic; with deterministic algorithms
+  // enabled, take the sort-based single-writer path instead.
+  if (globalContext().deterministicAlgorithms()) {
+    scatter_add_deterministic_cuda_kernel(self, dim, index, src);
+    return;
+  }
   cuda_scatter_gather_base_kernel</*is_scatter_like=*/true, /*cast_to_opaque=*/false>()(
     self, dim, index, src,
     "scatter_add_cuda_", reduce_add);
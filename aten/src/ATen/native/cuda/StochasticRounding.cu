@@ -0,0 +1,116 @@
+#define TORCH_ASSERT_ONLY_METHOD_OPERATORS
+#include <ATen/core/Tensor.h>
+
+#include <ATen/cuda/CUDAGeneratorImpl.h>
+#include <ATen/cuda/CUDAGraphsUtils.cuh>
+#include <c10/cuda/CUDAGuard.h>
+#include <c10/macros/Macros.h>
+
+#ifndef AT_PER_OPERATOR_HEADERS
+#include <ATen/NativeFunctions.h>
+#else
+#include <ATen/ops/_copy_stochastic_native.h>
+#include <ATen/ops/empty_like.h>
+#endif
+
+#include <curand_kernel.h>
+
+#include <mutex>
+
+namespace at::native {
+
+// Declared in StochasticRounding.cpp, shared between the CPU and CUDA paths.
+void check_copy_stochastic(const Tensor& self, const Tensor& src);
+
+namespace {
+
+constexpr int kBlockSize = 256;
+constexpr int kUnroll = 4;
+
+__device__ __forceinline__ BFloat16
+round_stochastic(float val, uint32_t r16) {
+  if (C10_UNLIKELY(!::isfinite(val))) {
+    return static_cast<BFloat16>(val);
+  }
+  uint32_t bits = __float_as_uint(val);
+  bits += r16 & 0xFFFFu;
+  return BFloat16(static_cast<uint16_t>(bits >> 16), BFloat16::from_bits());
+}
+
+// Grid-stride kernel consuming four elements per curand4 draw, mirroring the
+// fused dropout kernel's philox usage so the host-side counter_offset below
+// matches the per-thread consumption exactly.
+__global__ void copy_stochastic_kernel(
+    const float* src,
+    BFloat16* dst,
+    int64_t numel,
+    PhiloxCudaState philox_args) {
+  auto seeds = at::cuda::philox::unpack(philox_args);
+  const int64_t idx = blockIdx.x * blockDim.x + threadIdx.x;
+  curandStatePhilox4_32_10_t state;
+  curand_init(std::get<0>(seeds), idx, std::get<1>(seeds), &state);
+
+  const int64_t stride = static_cast<int64_t>(blockDim.x) * gridDim.x * kUnroll;
+  for (int64_t base = idx * kUnroll; base < numel; base += stride) {
+    uint4 rand = curand4(&state);
+    uint32_t r[kUnroll] = {rand.x, rand.y, rand.z, rand.w};
+#pragma unroll
+    for (int k = 0; k < kUnroll; k++) {
+      const int64_t i = base + k;
+      if (i < numel) {
+        dst[i] = round_stochastic(src[i], r[k]);
+      }
+    }
+  }
+}
+
+} // namespace
+
+Tensor& _copy_stochastic_cuda_(
+    Tensor& self,
+    const Tensor& src,
+    c10::optional<Generator> generator) {
+  check_copy_stochastic(self, src);
+  const int64_t numel = self.numel();
+  if (numel == 0) {
+    return self;
+  }
+
+  const cuda::OptionalCUDAGuard device_guard(device_of(self));
+  auto gen = get_generator_or_default<CUDAGeneratorImpl>(
+      generator, cuda::detail::getDefaultCUDAGenerator());
+
+  auto src_contig = src.expect_contiguous();
+  Tensor dst = self.is_contiguous()
+      ? self
+      : at::empty_like(self, self.options(), MemoryFormat::Contiguous);
+
+  const uint32_t grid = std::min<int64_t>(
+      (numel + kBlockSize * kUnroll - 1) / (kBlockSize * kUnroll), 1024);
+  // Each thread draws ceil(numel / total_unrolled_threads) rounds of curand4,
+  // each of which advances the philox counter by four.
+  const int64_t rounds_per_thread =
+      (numel + static_cast<int64_t>(grid) * kBlockSize * kUnroll - 1) /
+      (static_cast<int64_t>(grid) * kBlockSize * kUnroll);
+  PhiloxCudaState rng_engine_inputs;
+  {
+    // See Note [Acquire lock when using random generators]
+    std::lock_guard<std::mutex> lock(gen->mutex_);
+    rng_engine_inputs = gen->philox_cuda_state(rounds_per_thread * 4);
+  }
+
+  auto stream = at::cuda::getCurrentCUDAStream();
+  copy_stochastic_kernel<<<grid, kBlockSize, 0, stream>>>(
+      src_contig->const_data_ptr<float>(),
+      dst.data_ptr<BFloat16>(),
+      numel,
+      rng_engine_inputs);
+  C10_CUDA_KERNEL_LAUNCH_CHECK();
+
+  if (!dst.is_same(self)) {
+    self.copy_(dst);
+  }
+  return self;
+}
+
+} // namespace at::native
@@ -7,6 +7,7 @@
 #include <ATen/NativeFunctions.h>
 #else
 #include <ATen/ops/cudnn_convolution_add_relu_native.h>
+#include <ATen/ops/cudnn_convolution_bn_relu_native.h>
 #include <ATen/ops/cudnn_convolution_native.h>
 #include <ATen/ops/cudnn_convolution_relu_native.h>
 #include <ATen/ops/cudnn_convolution_transpose_native.h>
@@ -127,6 +128,22 @@ Tensor cudnn_convolution_add_relu(
   AT_ERROR("cudnn_convolution_add_relu: ATen not compiled with cuDNN support");
 }
 
+Tensor cudnn_convolution_bn_relu(
+    const Tensor& input_t,
+    const Tensor& weight_t,
+    const c10::optional<Tensor>& bias_t,
+    const c10::optional<Tensor>& bn_weight_opt,
+    const c10::optional<Tensor>& bn_bias_opt,
+    const Tensor& bn_running_mean,
+    const Tensor& bn_running_var,
+    double bn_eps,
+    IntArrayRef stride,
+    IntArrayRef padding,
+    IntArrayRef dilation,
+    int64_t groups) {
+  AT_ERROR("cudnn_convolution_bn_relu: ATen not compiled with cuDNN support");
+}
+
 #endif  // AT_CUDNN_ENABLED
 
 }}
@@ -16,6 +16,7 @@
 #include <ATen/NativeFunctions.h>
 #else
 #include <ATen/ops/cudnn_convolution_add_relu_native.h>
+#include <ATen/ops/cudnn_convolution_bn_relu_native.h>
 #include <ATen/ops/cudnn_convolution_native.h>
 #include <ATen/ops/cudnn_convolution_relu_native.h>
 #include <ATen/ops/cudnn_convolution_transpose_native.h>
@@ -576,6 +577,68 @@ Tensor cudnn_convolution_add_relu(
   return output_t;
 }
 
+// Fused conv2d -> batch_norm (eval) -> relu entry point. An eval-mode
+// batchnorm is an affine transform per output channel, so it folds exactly
+// into the convolution: w' = w * s and b' = (b - mean) * s + beta with
+// s = gamma / sqrt(var + eps). The folded call then reuses the fused
+// conv+bias+relu execution plans (and their plan cache) built by the v8
+// frontend, instead of launching separate normalization and activation
+// kernels after the convolution. Folding is done in fp32 so fp16/bf16
+// weights do not lose precision to the intermediate scale.
+Tensor cudnn_convolution_bn_relu(
+    const Tensor& input_t,
+    const Tensor& weight_t,
+    const c10::optional<Tensor>& bias_t,
+    const c10::optional<Tensor>& bn_weight_opt,
+    const c10::optional<Tensor>& bn_bias_opt,
+    const Tensor& bn_running_mean,
+    const Tensor& bn_running_var,
+    double bn_eps,
+    IntArrayRef stride,
+    IntArrayRef padding,
+    IntArrayRef dilation,
+    int64_t groups) {
+  const int64_t out_channels = weight_t.size(0);
+  TORCH_CHECK(
+      bn_running_mean.numel() == out_channels &&
+          bn_running_var.numel() == out_channels,
+      "cudnn_convolution_bn_relu: expected running stats with ",
+      out_channels,
+      " elements, but got ",
+      bn_running_mean.numel(),
+      " and ",
+      bn_running_var.numel());
+
+  Tensor scale = (bn_running_var.to(kFloat) + bn_eps).rsqrt();
+  if (bn_weight_opt.has_value() && bn_weight_opt->defined()) {
+    TORCH_CHECK(
+        bn_weight_opt->numel() == out_channels,
+        "cudnn_convolution_bn_relu: expected bn weight with ",
+        out_channels,
+        " elements, but got ",
+        bn_weight_opt->numel());
+    scale = scale * bn_weight_opt->to(kFloat);
+  }
+
+  std::vector<int64_t> scale_shape(weight_t.dim(), 1);
+  scale_shape[0] = out_channels;
+  Tensor folded_weight =
+      (weight_t.to(kFloat) * scale.reshape(scale_shape))
+          .to(weight_t.scalar_type());
+
+  Tensor folded_bias = bias_t.has_value() && bias_t->defined()
+      ? bias_t->to(kFloat)
+      : at::zeros({out_channels}, bn_running_mean.options().dtype(kFloat));
+  folded_bias = (folded_bias - bn_running_mean.to(kFloat)) * scale;
+  if (bn_bias_opt.has_value() && bn_bias_opt->defined()) {
+    folded_bias = folded_bias + bn_bias_opt->to(kFloat);
+  }
+  folded_bias = folded_bias.to(weight_t.scalar_type());
+
+  return cudnn_convolution_relu(
+      input_t, folded_weight, folded_bias, stride, padding, dilation, groups);
+}
+
 REGISTER_CUDA_DISPATCH(cudnn_convolution_backward_stub, &cudnn_convolution_backward);
 REGISTER_CUDA_DISPATCH(cudnn_convolution_transpose_backward_stub, &cudnn_convolution_transpose_backward);
 
@@ -20,6 +20,7 @@ C10_DIAGNOSTIC_POP()
 #include <cudnn_frontend_get_plan.h>
 #include <ATen/core/Tensor.h>
 #include <ATen/TensorUtils.h>
+#include <ATen/cuda/CUDAContext.h>
 #include <ATen/cuda/Exceptions.h>
 #include <ATen/native/ConvUtils.h>
 #include <ATen/native/cudnn/ConvShared.h>
@@ -31,8 +32,12 @@ C10_DIAGNOSTIC_POP()
 #include <c10/cuda/CUDAException.h>
 #include <c10/cuda/CUDACachingAllocator.h>
 
-#include <unordered_map>
+#include <fstream>
+#include <iomanip>
 #include <list>
+#include <mutex>
+#include <sstream>
+#include <unordered_map>
 
 #ifndef AT_PER_OPERATOR_HEADERS
 #include <ATen/Functions.h>
@@ -279,6 +284,121 @@ void update(const KeyType& key, T& results) {
 thread_local BenchmarkCache<cudnn_frontend::ExecutionPlan, CacheKeyWrapper> benchmark_cache;
 thread_local BenchmarkCache<cudnn_frontend::ExecutionPlan, CacheKeyFusedWrapper> benchmark_cache_fused;
 
+// Note [cuDNN benchmark persistence]
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// The in-process BenchmarkCache means every fresh process pays seconds of
+// find-mode benchmarking before serving at full speed. When
+// TORCH_CUDNN_V8_API_PLAN_CACHE_PATH names a file, benchmark-mode results
+// are also persisted across processes: each discovered winner is appended
+// as (conv params, execution plan tag), and a later process that misses
+// the in-memory cache rebuilds the tagged plan from the current heuristic
+// configs instead of re-benchmarking. Entries are keyed by the raw bytes
+// of the existing POD cache key (ParamsWrapper zeroes padding, so they are
+// byte-stable) plus the SM architecture, and the file header pins the
+// cuDNN version; a mismatched header invalidates the whole file.
+// Validation is implicit: a persisted tag that no longer resolves to a
+// buildable, runnable plan simply falls through to the normal benchmark
+// path, which then persists the fresh winner.
+std::string cudnn_plan_cache_path() {
+  static std::string path = []() -> std::string {
+    const char* val = getenv("TORCH_CUDNN_V8_API_PLAN_CACHE_PATH");
+    return val ? val : "";
+  }();
+  return path;
+}
+
+template <typename KeyType>
+std::string persistent_key(const KeyType& key) {
+  const auto* prop = at::cuda::getCurrentDeviceProperties();
+  std::ostringstream oss;
+  oss << "sm" << prop->major << prop->minor << "_" << std::hex
+      << std::setfill('0');
+  const auto* bytes = reinterpret_cast<const uint8_t*>(&key.pod);
+  for (const auto i : c10::irange(sizeof(key.pod))) {
+    oss << std::setw(2) << static_cast<int>(bytes[i]);
+  }
+  return oss.str();
+}
+
+struct PersistentPlanCache {
+  PersistentPlanCache() {
+    load();
+  }
+
+  bool enabled() const {
+    return !cudnn_plan_cache_path().empty();
+  }
+
+  c10::optional<std::string> find(const std::string& key) {
+    std::lock_guard<std::mutex> guard(mutex_);
+    auto it = tags_.find(key);
+    if (it == tags_.end()) {
+      return c10::nullopt;
+    }
+    return it->second;
+  }
+
+  void store(const std::string& key, const std::string& tag) {
+    if (!enabled()) {
+      return;
+    }
+    std::lock_guard<std::mutex> guard(mutex_);
+    if (!tags_.emplace(key, tag).second) {
+      return;
+    }
+    std::ofstream file(cudnn_plan_cache_path(), std::ios::app);
+    if (!file) {
+      TORCH_WARN_ONCE(
+          "Could not write cuDNN plan cache file ", cudnn_plan_cache_path());
+      return;
+    }
+    if (file.tellp() == 0) {
+      file << file_header() << "\n";
+    }
+    file << key << " " << tag << "\n";
+  }
+
+ private:
+  static std::string file_header() {
+    std::ostringstream oss;
+    oss << "torch-cudnn-v8-plan-cache-v1 cudnn " << cudnnGetVersion();
+    return oss.str();
+  }
+
+  void load() {
+    if (!enabled()) {
+      return;
+    }
+    std::ifstream file(cudnn_plan_cache_path());
+    if (!file) {
+      return; // first process; the file is created on the first store
+    }
+    std::string line;
+    if (!std::getline(file, line) || line != file_header()) {
+      TORCH_WARN_ONCE(
+          "Ignoring cuDNN plan cache file ",
+          cudnn_plan_cache_path(),
+          " recorded with a different cuDNN version.");
+      return;
+    }
+    while (std::getline(file, line)) {
+      auto sep = line.find(' ');
+      if (sep == std::string::npos || sep == 0 || sep + 1 >= line.size()) {
+        continue; // torn line from a concurrent writer; skip it
+      }
+      tags_.emplace(line.substr(0, sep), line.substr(sep + 1));
+    }
+  }
+
+  std::mutex mutex_;
+  std::unordered_map<std::string, std::string> tags_;
+};
+
+PersistentPlanCache& persistent_plan_cache() {
+  static PersistentPlanCache cache;
+  return cache;
+}
+
 } // namespace
 
 void run_conv_plan(cudnnHandle_t handle, const Tensor& x, const Tensor& y, const Tensor& w, const cudnn_frontend::ExecutionPlan& plan) {
@@ -562,6 +682,7 @@ void try_plans(cudnn_frontend::executionPlans_t& plans, const CacheKeyWrapper& k
     try {
       run_conv_plan(handle, x, y, w, plan);
       benchmark_cache.update(key, plan);
+      persistent_plan_cache().store(persistent_key(key), plan.getTag());
       return;
     } catch (cudnn_frontend::cudnnException &e) {} catch (CuDNNError &e) {}
       catch (c10::OutOfMemoryError &e) {
@@ -576,6 +697,7 @@ void try_plans_fused(cudnn_frontend::executionPlans_t& plans, const CacheKeyFuse
     try {
       run_conv_plan_fused(handle, x, y, w, z, b, plan);
       benchmark_cache_fused.update(key, plan);
+      persistent_plan_cache().store(persistent_key(key), plan.getTag());
       return;
     } catch (cudnn_frontend::cudnnException &e) {} catch (CuDNNError &e) {}
       catch (c10::OutOfMemoryError &e) {
@@ -627,6 +749,96 @@ bool try_configs_fused(cudnn_frontend::EngineConfigList& configs, const std::str
   return false;
 }
 
+// Like try_configs, but only runs the config whose built plan carries the
+// persisted tag. See Note [cuDNN benchmark persistence]
+bool try_configs_matching_tag(cudnn_frontend::EngineConfigList& configs, const std::string& plan_tag, const std::string& opgraph_tag, const CacheKeyWrapper& key, const cudnnHandle_t handle, const Tensor& x, const Tensor& y, const Tensor& w) {
+  for (auto & config : configs) {
+    try {
+      auto plan = cudnn_frontend::ExecutionPlanBuilder()
+                    .setHandle(handle)
+                    .setEngineConfig(config, opgraph_tag)
+                    .build();
+      if (plan.getTag() != plan_tag) {
+        continue;
+      }
+      run_conv_plan(handle, x, y, w, plan);
+      benchmark_cache.update(key, plan);
+      return true;
+    } catch (cudnn_frontend::cudnnException &e) {} catch(CuDNNError &e) {}
+      catch (c10::OutOfMemoryError &e) {
+        (void)cudaGetLastError(); // clear CUDA error
+    }
+  }
+  return false;
+}
+
+bool try_configs_matching_tag_fused(cudnn_frontend::EngineConfigList& configs, const std::string& plan_tag, const std::string& opgraph_tag, const CacheKeyFusedWrapper& key, const cudnnHandle_t handle, const Tensor& x, const Tensor& y, const Tensor& w, const Tensor& z, const Tensor& b) {
+  for (auto & config : configs) {
+    try {
+      auto plan = cudnn_frontend::ExecutionPlanBuilder()
+                    .setHandle(handle)
+                    .setEngineConfig(config, opgraph_tag)
+                    .build();
+      if (plan.getTag() != plan_tag) {
+        continue;
+      }
+      run_conv_plan_fused(handle, x, y, w, z, b, plan);
+      benchmark_cache_fused.update(key, plan);
+      return true;
+    } catch (cudnn_frontend::cudnnException &e) {} catch(CuDNNError &e) {}
+      catch (c10::OutOfMemoryError &e) {
+        (void)cudaGetLastError(); // clear CUDA error
+    }
+  }
+  return false;
+}
+
+bool try_persisted_plan(const cudnnBackendDescriptorType_t operation, const CacheKeyWrapper& key, const cudnnHandle_t handle, const Tensor& x, const Tensor& y, const Tensor& w, const IntArrayRef padding, const IntArrayRef stride, const IntArrayRef dilation, const bool deterministic, const bool allow_tf32) {
+  if (!persistent_plan_cache().enabled()) {
+    return false;
+  }
+  auto plan_tag = persistent_plan_cache().find(persistent_key(key));
+  if (!plan_tag.has_value()) {
+    return false;
+  }
+  std::string opgraph_tag;
+  cudnn_frontend::EngineConfigList configs = get_configs_from_heuristics(handle, operation,
+                                                                         opgraph_tag,
+                                                                         x, y, w, key,
+                                                                         padding, stride, dilation,
+                                                                         deterministic, allow_tf32, false);
+  if (try_configs_matching_tag(configs, *plan_tag, opgraph_tag, key, handle, x, y, w)) { return true; }
+  configs = get_configs_from_heuristics(handle, operation,
+                                        opgraph_tag,
+                                        x, y, w, key,
+                                        padding, stride, dilation,
+                                        deterministic, allow_tf32, true);
+  return try_configs_matching_tag(configs, *plan_tag, opgraph_tag, key, handle, x, y, w);
+}
+
+bool try_persisted_plan_fused(const CacheKeyFusedWrapper& key, const cudnnHandle_t handle, const Tensor& x, const Tensor& y, const Tensor& w, const Tensor& z, const Tensor& b, const float alpha, const IntArrayRef padding, const IntArrayRef stride, const IntArrayRef dilation, const bool deterministic, const bool allow_tf32) {
+  if (!persistent_plan_cache().enabled()) {
+    return false;
+  }
+  auto plan_tag = persistent_plan_cache().find(persistent_key(key));
+  if (!plan_tag.has_value()) {
+    return false;
+  }
+  std::string opgraph_tag;
+  cudnn_frontend::EngineConfigList configs = get_configs_from_heuristics_fused(handle,
+                                                                               opgraph_tag,
+                                                                               x, y, w, z, b, alpha, key,
+                                                                               padding, stride, dilation,
+                                                                               deterministic, allow_tf32, false);
+  if (try_configs_matching_tag_fused(configs, *plan_tag, opgraph_tag, key, handle, x, y, w, z, b)) { return true; }
+  configs = get_configs_from_heuristics_fused(handle,
+                                              opgraph_tag,
+                                              x, y, w, z, b, alpha, key,
+                                              padding, stride, dilation,
+                                              deterministic, allow_tf32, true);
+  return try_configs_matching_tag_fused(configs, *plan_tag, opgraph_tag, key, handle, x, y, w, z, b);
+}
+
 void run_single_conv(const cudnnBackendDescriptorType_t operation,
   const Tensor& x, const Tensor& y, const Tensor& w,
   const IntArrayRef padding, const IntArrayRef stride, const IntArrayRef dilation, const int64_t groups,
@@ -661,6 +873,9 @@ void run_single_conv(const cudnnBackendDescriptorType_t operation,
     if (try_configs(configs, opgraph_tag, key, handle, x, y, w)) { return; }
     TORCH_CHECK(false, "GET was unable to find an engine to execute this computation");
   } else {
+    // A winner persisted by an earlier process skips re-benchmarking.
+    // See Note [cuDNN benchmark persistence]
+    if (try_persisted_plan(operation, key, handle, x, y, w, padding, stride, dilation, deterministic, allow_tf32)) { return; }
     cudnn_frontend::executionPlans_t plans = get_plans_from_find(handle, operation,
                                                                  x, y, w, key,
                                                                  padding, stride, dilation,
@@ -707,6 +922,8 @@ void run_fused_conv(const Tensor& x, const Tensor& y, const Tensor& w, const Ten
     if (try_configs_fused(configs, opgraph_tag, key, handle, x, y, w, z, b)) { return; }
     TORCH_CHECK(false, "GET was unable to find an engine to execute this computation");
   } else {
+    // See Note [cuDNN benchmark persistence]
+    if (try_persisted_plan_fused(key, handle, x, y, w, z, b, alpha, padding, stride, dilation, deterministic, allow_tf32)) { return; }
     cudnn_frontend::executionPlans_t plans = get_plans_from_find_fused(handle,
                                                                        x, y, w, z, b, alpha, key,
                                                                        padding, stride, dilation,
@@ -14,6 +14,10 @@
 #include <ATen/ops/_fft_c2c_native.h>
 #include <ATen/ops/_fft_c2r_native.h>
 #include <ATen/ops/_fft_r2c_native.h>
+#include <ATen/ops/_mkl_fft_clear_plan_cache_native.h>
+#include <ATen/ops/_mkl_fft_get_plan_cache_max_size_native.h>
+#include <ATen/ops/_mkl_fft_get_plan_cache_size_native.h>
+#include <ATen/ops/_mkl_fft_set_plan_cache_max_size_native.h>
 #include <ATen/ops/empty.h>
 #endif
 
@@ -322,14 +326,38 @@ Tensor _fft_c2c_mkl(const Tensor& self, IntArrayRef dim, int64_t normalization,
   return out;
 }
 
+// PocketFFT manages its own plans internally, so there is no descriptor
+// cache to manage (cf. the MKL build below).
+int64_t _mkl_fft_get_plan_cache_max_size() {
+  AT_ERROR("fft: ATen not compiled with MKL support");
+}
+
+void _mkl_fft_set_plan_cache_max_size(int64_t max_size) {
+  AT_ERROR("fft: ATen not compiled with MKL support");
+}
+
+int64_t _mkl_fft_get_plan_cache_size() {
+  AT_ERROR("fft: ATen not compiled with MKL support");
+}
+
+void _mkl_fft_clear_plan_cache() {
+  AT_ERROR("fft: ATen not compiled with MKL support");
+}
+
 }}
 
 #elif AT_MKL_ENABLED()
 #include <ATen/Dispatch.h>
+#include <ATen/native/utils/ParamsHash.h>
 
 #include <algorithm>
+#include <cstring>
+#include <limits>
+#include <list>
+#include <mutex>
 #include <numeric>
 #include <cmath>
+#include <unordered_map>
 
 #include <mkl_dfti.h>
 #include <ATen/mkl/Exceptions.h>
@@ -422,6 +450,188 @@ static DftiDescriptor _plan_mkl_fft(
   return descriptor;
 }
 
+// Maximum signal rank a cached plan may have. Transforms of higher rank are
+// rare and simply bypass the cache.
+constexpr int64_t MKL_FFT_MAX_SIGNAL_NDIM = 5;
+
+// This struct is used to let us easily compute hashes of the parameters.
+// It will be the **key** to the plan cache, mirroring CuFFTParams
+// (native/cuda/CuFFTPlanCache.h).
+struct MklFftParams
+{
+  int64_t signal_ndim_; // 1 <= signal_ndim <= MKL_FFT_MAX_SIGNAL_NDIM
+  // These include additional batch dimension as well.
+  int64_t sizes_[MKL_FFT_MAX_SIGNAL_NDIM + 1];
+  int64_t in_strides_[MKL_FFT_MAX_SIGNAL_NDIM + 1];
+  int64_t out_strides_[MKL_FFT_MAX_SIGNAL_NDIM + 1];
+  int64_t normalization_;
+  bool complex_input_;
+  bool complex_output_;
+  bool forward_;
+  ScalarType value_type_;
+
+  MklFftParams() = default;
+
+  MklFftParams(IntArrayRef in_strides, IntArrayRef out_strides, IntArrayRef sizes,
+      bool complex_input, bool complex_output,
+      int64_t normalization, bool forward, ScalarType value_type) {
+    // Padding bits must be zeroed for hashing
+    memset(this, 0, sizeof(*this));
+    signal_ndim_ = static_cast<int64_t>(sizes.size()) - 1;
+    normalization_ = normalization;
+    complex_input_ = complex_input;
+    complex_output_ = complex_output;
+    forward_ = forward;
+    value_type_ = value_type;
+
+    TORCH_INTERNAL_ASSERT(in_strides.size() == sizes.size());
+    TORCH_INTERNAL_ASSERT(out_strides.size() == sizes.size());
+    TORCH_INTERNAL_ASSERT(1 <= signal_ndim_ && signal_ndim_ <= MKL_FFT_MAX_SIGNAL_NDIM);
+
+    std::copy(sizes.cbegin(), sizes.cend(), sizes_);
+    std::copy(in_strides.cbegin(), in_strides.cend(), in_strides_);
+    std::copy(out_strides.cbegin(), out_strides.cend(), out_strides_);
+  }
+};
+
+static_assert(std::is_trivial<MklFftParams>::value, "");
+
+// Reconstruct a committed descriptor from a cache key
+static DftiDescriptor _plan_mkl_fft(const MklFftParams& params) {
+  const auto ndim = params.signal_ndim_ + 1;
+  return _plan_mkl_fft(
+      IntArrayRef(params.in_strides_, ndim),
+      IntArrayRef(params.out_strides_, ndim),
+      IntArrayRef(params.sizes_, ndim),
+      params.complex_input_, params.complex_output_,
+      params.normalization_, params.forward_, params.value_type_);
+}
+
+constexpr int64_t MKL_FFT_MAX_PLAN_NUM = std::numeric_limits<int64_t>::max();
+// The default max cache size mirrors CUFFT_DEFAULT_CACHE_SIZE; users can
+// configure it via torch._mkl_fft_set_plan_cache_max_size.
+constexpr int64_t MKL_FFT_DEFAULT_CACHE_SIZE = 4096;
+
+// LRU cache of committed DFTI descriptors, keyed on the transform parameters.
+// Mirrors CuFFTParamsLRUCache (native/cuda/CuFFTPlanCache.h), except there is
+// a single process-wide cache rather than one per device.
+// This is **NOT** thread-safe. Please use the member mutex when using it
+// **AND** the value returned from lookup.
+// The contract of using this cache is that lookup should only be used when
+// the max_size is positive.
+class MklFftPlanLRUCache {
+public:
+  using kv_t = typename std::pair<MklFftParams, DftiDescriptor>;
+  using map_t = typename std::unordered_map<std::reference_wrapper<MklFftParams>,
+                                            typename std::list<kv_t>::iterator,
+                                            ParamsHash<MklFftParams>,
+                                            ParamsEqual<MklFftParams>>;
+  using map_kkv_iter_t = typename map_t::iterator;
+
+  MklFftPlanLRUCache() : MklFftPlanLRUCache(MKL_FFT_DEFAULT_CACHE_SIZE) {}
+
+  MklFftPlanLRUCache(int64_t max_size) {
+    _set_max_size(max_size);
+  }
+
+  // If key is in this cache, return the cached descriptor. Otherwise, emplace
+  // the descriptor in this cache and return it.
+  const DftiDescriptor &lookup(MklFftParams params) {
+    AT_ASSERT(_max_size > 0);
+
+    map_kkv_iter_t map_it = _cache_map.find(params);
+    // Hit, put to list front
+    if (map_it != _cache_map.end()) {
+      _usage_list.splice(_usage_list.begin(), _usage_list, map_it->second);
+      return map_it->second->second;
+    }
+
+    // Miss
+    // remove if needed
+    if (_usage_list.size() >= _max_size) {
+      auto last = _usage_list.end();
+      last--;
+      _cache_map.erase(last->first);
+      _usage_list.pop_back();
+    }
+
+    // construct new plan at list front, then insert into _cache_map
+    _usage_list.emplace_front(params, _plan_mkl_fft(params));
+    auto kv_it = _usage_list.begin();
+    _cache_map.emplace(std::piecewise_construct,
+                std::forward_as_tuple(kv_it->first),
+                std::forward_as_tuple(kv_it));
+    return kv_it->second;
+  }
+
+  void clear() {
+    _cache_map.clear();
+    _usage_list.clear();
+  }
+
+  void resize(int64_t new_size) {
+    _set_max_size(new_size);
+    auto cur_size = _usage_list.size();
+    if (cur_size > _max_size) {
+      auto delete_it = _usage_list.end();
+      for (size_t i = 0; i < cur_size - _max_size; i++) {
+        delete_it--;
+        _cache_map.erase(delete_it->first);
+      }
+      _usage_list.erase(delete_it, _usage_list.end());
+    }
+  }
+
+  size_t size() const { return _cache_map.size(); }
+
+  size_t max_size() const noexcept { return _max_size; }
+
+  std::mutex mutex;
+
+private:
+  // Only sets size and does value check. Does not resize the data structures.
+  void _set_max_size(int64_t new_size) {
+    TORCH_CHECK(new_size >= 0,
+             "MKL FFT plan cache size must be non-negative, but got ", new_size);
+    TORCH_CHECK(new_size <= MKL_FFT_MAX_PLAN_NUM,
+             "MKL FFT plan cache size can not be larger than ", MKL_FFT_MAX_PLAN_NUM, ", but got ", new_size);
+    _max_size = static_cast<size_t>(new_size);
+  }
+
+  std::list<kv_t> _usage_list;
+  map_t _cache_map;
+  size_t _max_size;
+};
+
+static MklFftPlanLRUCache& mkl_fft_get_plan_cache() {
+  static MklFftPlanLRUCache plan_cache;
+  return plan_cache;
+}
+
+int64_t _mkl_fft_get_plan_cache_max_size() {
+  auto& plan_cache = mkl_fft_get_plan_cache();
+  std::lock_guard<std::mutex> guard(plan_cache.mutex);
+  return plan_cache.max_size();
+}
+
+void _mkl_fft_set_plan_cache_max_size(int64_t max_size) {
+  auto& plan_cache = mkl_fft_get_plan_cache();
+  std::lock_guard<std::mutex> guard(plan_cache.mutex);
+  plan_cache.resize(max_size);
+}
+
+int64_t _mkl_fft_get_plan_cache_size() {
+  auto& plan_cache = mkl_fft_get_plan_cache();
+  std::lock_guard<std::mutex> guard(plan_cache.mutex);
+  return plan_cache.size();
+}
+
+void _mkl_fft_clear_plan_cache() {
+  auto& plan_cache = mkl_fft_get_plan_cache();
+  std::lock_guard<std::mutex> guard(plan_cache.mutex);
+  plan_cache.clear();
+}
+
 // Execute a general fft operation (can be c2c, onesided r2c or onesided c2r)
 static Tensor& _exec_fft(Tensor& out, const Tensor& self, IntArrayRef out_sizes,
                          IntArrayRef dim, int64_t normalization, bool forward) {
@@ -474,15 +684,28 @@ static Tensor& _exec_fft(Tensor& out, const Tensor& self, IntArrayRef out_sizes,
   const auto value_type = c10::toRealValueType(input.scalar_type());
   out.resize_(batched_out_sizes, MemoryFormat::Contiguous);
 
-  auto descriptor = _plan_mkl_fft(
-      input.strides(), out.strides(), signal_size, input.is_complex(),
-      out.is_complex(), normalization, forward, value_type);
-
   // run the FFT
-  if (forward) {
-    MKL_DFTI_CHECK(DftiComputeForward(descriptor.get(), input.data_ptr(), out.data_ptr()));
+  auto run_fft = [&](const DftiDescriptor& descriptor) {
+    if (forward) {
+      MKL_DFTI_CHECK(DftiComputeForward(descriptor.get(), input.data_ptr(), out.data_ptr()));
+    } else {
+      MKL_DFTI_CHECK(DftiComputeBackward(descriptor.get(), input.data_ptr(), out.data_ptr()));
+    }
+  };
+
+  auto& plan_cache = mkl_fft_get_plan_cache();
+  std::unique_lock<std::mutex> guard(plan_cache.mutex);
+  if (signal_ndim <= MKL_FFT_MAX_SIGNAL_NDIM && plan_cache.max_size() > 0) {
+    // A committed descriptor is read-only during compute, but keep the lock
+    // held so a concurrent eviction cannot free it mid-transform.
+    run_fft(plan_cache.lookup(MklFftParams(
+        input.strides(), out.strides(), signal_size, input.is_complex(),
+        out.is_complex(), normalization, forward, value_type)));
   } else {
-    MKL_DFTI_CHECK(DftiComputeBackward(descriptor.get(), input.data_ptr(), out.data_ptr()));
+    guard.unlock();
+    run_fft(_plan_mkl_fft(
+        input.strides(), out.strides(), signal_size, input.is_complex(),
+        out.is_complex(), normalization, forward, value_type));
   }
 
   // Inplace reshaping to original batch shape and inverting the dimension permutation
@@ -595,5 +818,21 @@ Tensor& _fft_c2c_mkl_out(const Tensor& self, IntArrayRef dim, int64_t normalizat
   AT_ERROR("fft: ATen not compiled with FFT support");
 }
 
+int64_t _mkl_fft_get_plan_cache_max_size() {
+  AT_ERROR("fft: ATen not compiled with FFT support");
+}
+
+void _mkl_fft_set_plan_cache_max_size(int64_t max_size) {
+  AT_ERROR("fft: ATen not compiled with FFT support");
+}
+
+int64_t _mkl_fft_get_plan_cache_size() {
+  AT_ERROR("fft: ATen not compiled with FFT support");
+}
+
+void _mkl_fft_clear_plan_cache() {
+  AT_ERROR("fft: ATen not compiled with FFT support");
+}
+
 }} // namespace at::native
 #endif
@@ -1,3 +1,4 @@
+#include <cstring>
 #include <vector>
 
 #include <ATen/native/ConvUtils.h>
@@ -26,10 +27,6 @@ c10::intrusive_ptr<mkldnn::ConvOpContext> createConvPrePackOpContext(
     int64_t groups,
     std::vector<int64_t> input_size,
     std::string attr) {
-  auto it = fusion_attr_map.find(attr);
-  TORCH_CHECK(it != fusion_attr_map.end(), "Fusion behavior undefined.");
-  ideep::attr_t op_attr = it->second;
-
   return mkldnn::MkldnnConvOpContext::create_context(
       std::move(weight),
       std::move(bias),
@@ -38,7 +35,22 @@ c10::intrusive_ptr<mkldnn::ConvOpContext> createConvPrePackOpContext(
       std::move(dilation),
       groups,
       std::move(input_size),
-      op_attr);
+      std::move(attr));
+}
+
+c10::intrusive_ptr<mkldnn::ConvOpContext> deserializeConvPrePackOpContext(
+    SerializationTypeConvPrePack&& state) {
+  return mkldnn::MkldnnConvOpContext::create_context(
+      std::move(std::get<0>(state)),
+      std::move(std::get<1>(state)),
+      /*padding*/ std::move(std::get<3>(state)),
+      /*stride*/ std::move(std::get<2>(state)),
+      std::move(std::get<4>(state)),
+      std::get<5>(state),
+      std::move(std::get<6>(state)),
+      std::move(std::get<7>(state)),
+      std::get<8>(state),
+      std::get<9>(state));
 }
 
 ContextConv create(
@@ -49,7 +61,9 @@ ContextConv create(
     const IntArrayRef dilation,
     const int64_t groups,
     const IntArrayRef input_size,
-    const ideep::attr_t& attr) {
+    const ideep::attr_t& attr,
+    const c10::optional<Tensor>& serialized_packed_weight,
+    const std::string& packed_format_tag) {
   auto k = weight.ndimension();
   int64_t dim = k - 2;
   const auto padding_expanded = expand_param_if_needed(padding, "padding", dim);
@@ -82,7 +96,20 @@ ContextConv create(
 
   ideep::tensor packed_weight;
   packed_weight.init(expected_weight_desc);
-  packed_weight.feed_from(w);
+  // A serialized packed blob is only adopted when it was produced by the same
+  // oneDNN build on the same effective ISA and has the expected size; anything
+  // else falls back to repacking from the original weight.
+  if (serialized_packed_weight.has_value() &&
+      packed_format_tag == get_packed_weight_format_tag() &&
+      static_cast<size_t>(serialized_packed_weight->nbytes()) ==
+          packed_weight.get_size()) {
+    std::memcpy(
+        packed_weight.get_data_handle(),
+        serialized_packed_weight->data_ptr(),
+        packed_weight.get_size());
+  } else {
+    packed_weight.feed_from(w);
+  }
 
   return ContextConv{
       std::move(packed_weight),
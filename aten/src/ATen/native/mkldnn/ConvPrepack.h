@@ -22,6 +22,13 @@ c10::intrusive_ptr<mkldnn::ConvOpContext> createConvPrePackOpContext(
     std::vector<int64_t> input_size,
     std::string attr);
 
+// Restores an op context from its serialized state. The packed weight blob in
+// the state is reused directly when its format tag matches this machine,
+// avoiding the weight reorder on first inference; otherwise the weight is
+// repacked from the original tensor.
+c10::intrusive_ptr<mkldnn::ConvOpContext> deserializeConvPrePackOpContext(
+    SerializationTypeConvPrePack&& state);
+
 Tensor conv_run(
     const Tensor& input,
     const c10::intrusive_ptr<mkldnn::ConvOpContext>& op_context);
@@ -34,7 +41,9 @@ ContextConv create(
     const IntArrayRef dilation,
     const int64_t groups,
     const IntArrayRef input_size,
-    const ideep::attr_t& attr);
+    const ideep::attr_t& attr,
+    const c10::optional<Tensor>& serialized_packed_weight = c10::nullopt,
+    const std::string& packed_format_tag = std::string());
 
 Tensor run(ContextConv& context, const Tensor& input);
 
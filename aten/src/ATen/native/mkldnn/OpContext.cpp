@@ -3,10 +3,21 @@
 #if AT_MKLDNN_ENABLED()
 #include <ATen/native/mkldnn/ConvPrepack.h>
 
+#include <cstring>
+#include <sstream>
+
 namespace at {
 namespace native {
 namespace mkldnn {
 
+std::string get_packed_weight_format_tag() {
+  const dnnl_version_t* ver = dnnl_version();
+  std::ostringstream ss;
+  ss << "dnnl:" << ver->major << "." << ver->minor << "." << ver->patch
+     << ":isa:" << static_cast<int>(dnnl::get_effective_cpu_isa());
+  return ss.str();
+}
+
 c10::intrusive_ptr<ConvOpContext> MkldnnConvOpContext::create_context(
     at::Tensor&& weight,
     c10::optional<at::Tensor>&& bias,
@@ -15,9 +26,23 @@ c10::intrusive_ptr<ConvOpContext> MkldnnConvOpContext::create_context(
     std::vector<int64_t>&& dilation,
     int64_t groups,
     std::vector<int64_t>&& input_size,
-    const ideep::attr_t& attr) {
+    std::string&& attr,
+    const c10::optional<Tensor>& serialized_packed_weight,
+    const std::string& packed_format_tag) {
+  auto it = fusion_attr_map.find(attr);
+  TORCH_CHECK(it != fusion_attr_map.end(), "Fusion behavior undefined.");
+
   auto op_context = mkldnn::internal::convolution::create(
-      weight, bias, padding, stride, dilation, groups, input_size, attr);
+      weight,
+      bias,
+      padding,
+      stride,
+      dilation,
+      groups,
+      input_size,
+      it->second,
+      serialized_packed_weight,
+      packed_format_tag);
 
   auto conv_op_context = c10::make_intrusive<MkldnnConvOpContext>(
       std::move(weight),
@@ -27,6 +52,7 @@ c10::intrusive_ptr<ConvOpContext> MkldnnConvOpContext::create_context(
       std::move(dilation),
       groups,
       std::move(input_size),
+      std::move(attr),
       std::move(op_context));
 
   return conv_op_context;
@@ -40,6 +66,19 @@ void MkldnnConvOpContext::run(const Tensor& input, void* output) {
   mkldnn::internal::convolution::run(op_context_, input, output);
 }
 
+c10::optional<Tensor> MkldnnConvOpContext::get_packed_weight() {
+  auto& packed_weight = op_context_.weight_packed_;
+  if (packed_weight.is_empty()) {
+    return c10::nullopt;
+  }
+  auto blob = at::empty(
+      {static_cast<int64_t>(packed_weight.get_size())},
+      at::TensorOptions().device(c10::kCPU).dtype(c10::kByte));
+  std::memcpy(
+      blob.data_ptr(), packed_weight.get_data_handle(), packed_weight.get_size());
+  return blob;
+}
+
 } // namespace mkldnn
 } // namespace native
 } // namespace at
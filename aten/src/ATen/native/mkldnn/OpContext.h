@@ -15,6 +15,12 @@ const static std::map<std::string, ideep::attr_t> fusion_attr_map = {
     {"relu", ideep::attr_t::fuse_relu()},
 };
 
+// Identifies the packed weight blob layout produced by this build (oneDNN
+// version plus the effective CPU ISA). A serialized blob is only adopted on
+// load when the tag matches the loading machine; otherwise the weight is
+// repacked from the original tensor.
+std::string get_packed_weight_format_tag();
+
 using SerializationTypeConvPrePack = std::tuple<
     Tensor,
     c10::optional<Tensor>,
@@ -23,6 +29,8 @@ using SerializationTypeConvPrePack = std::tuple<
     std::vector<int64_t>,
     int64_t,
     std::vector<int64_t>,
+    std::string,
+    c10::optional<Tensor>,
     std::string>;
 
 class ConvOpContext : public torch::jit::CustomClassHolder {
@@ -46,11 +54,17 @@ class ConvOpContext : public torch::jit::CustomClassHolder {
         dilation_,
         groups_,
         input_size_,
-        attr_);
+        attr_,
+        get_packed_weight(),
+        get_packed_weight_format_tag());
   }
 
   virtual Tensor run(const Tensor& input) = 0;
   virtual void run(const Tensor& input, void* output) = 0;
+
+  // Packed weight blob as a byte tensor, for serialization. Only meaningful
+  // together with the format tag returned by get_packed_weight_format_tag().
+  virtual c10::optional<Tensor> get_packed_weight() = 0;
 };
 
 class MkldnnConvOpContext final : public ConvOpContext {
@@ -66,6 +80,7 @@ class MkldnnConvOpContext final : public ConvOpContext {
       std::vector<int64_t>&& dilation,
       uint64_t groups,
       std::vector<int64_t>&& input_size,
+      std::string&& attr,
       ContextConv&& op_context)
       : op_context_(std::move(op_context)) {
     orig_weight_ = std::move(weight);
@@ -75,12 +90,15 @@ class MkldnnConvOpContext final : public ConvOpContext {
     dilation_ = std::move(dilation);
     groups_ = groups;
     input_size_ = std::move(input_size);
+    attr_ = std::move(attr);
   }
 
   Tensor run(const Tensor& input) override;
 
   void run(const Tensor& input, void* output) override;
 
+  c10::optional<Tensor> get_packed_weight() override;
+
   static c10::intrusive_ptr<ConvOpContext> create_context(
       Tensor&& weight,
       c10::optional<Tensor>&& bias,
@@ -89,7 +107,9 @@ class MkldnnConvOpContext final : public ConvOpContext {
       std::vector<int64_t>&& dilation,
       int64_t groups,
       std::vector<int64_t>&& input_size,
-      const ideep::attr_t& attr);
+      std::string&& attr,
+      const c10::optional<Tensor>& serialized_packed_weight = c10::nullopt,
+      const std::string& packed_format_tag = std::string());
 };
 
 } // namespace mkldnn
@@ -38,17 +38,31 @@ TORCH_LIBRARY(mkldnn, m) {
               -> SerializationTypeConvPrePack { // __getstate__
             return op_context->unpack();
           },
-          [](SerializationTypeConvPrePack state)
+          // __setstate__ takes c10::IValue because older archives carry the
+          // 8-field state without the packed weight blob and format tag.
+          [](c10::IValue v)
               -> c10::intrusive_ptr<ConvOpContext> { // __setstate__
-            return createConvPrePackOpContext(
-                std::move(std::get<0>(state)),
-                std::move(std::get<1>(state)),
-                std::move(std::get<2>(state)),
-                std::move(std::get<3>(state)),
-                std::move(std::get<4>(state)),
-                std::move(std::get<5>(state)),
-                std::move(std::get<6>(state)),
-                std::move(std::get<7>(state)));
+            const auto& elements = v.toTupleRef().elements();
+            TORCH_INTERNAL_ASSERT(
+                elements.size() == 8 || elements.size() == 10,
+                "Unexpected serialized state for ConvOpContext");
+            c10::optional<Tensor> packed_weight;
+            std::string packed_format_tag;
+            if (elements.size() == 10) {
+              packed_weight = elements[8].toOptional<Tensor>();
+              packed_format_tag = elements[9].toStringRef();
+            }
+            return deserializeConvPrePackOpContext(std::make_tuple(
+                elements[0].toTensor(),
+                elements[1].toOptional<Tensor>(),
+                elements[2].toIntVector(),
+                elements[3].toIntVector(),
+                elements[4].toIntVector(),
+                elements[5].toInt(),
+                elements[6].toIntVector(),
+                elements[7].toStringRef(),
+                std::move(packed_weight),
+                std::move(packed_format_tag)));
           });
 
   m.def(TORCH_SELECTIVE_SCHEMA(
@@ -3,7 +3,9 @@
 #include <ATen/ATen.h>
 #include <ATen/NativeFunctions.h>
 #include <ATen/NestedTensorImpl.h>
+#include <ATen/OpMathType.h>
 #include <ATen/native/nested/NestedTensorUtils.h>
+#include <ATen/native/transformers/attention.h>
 
 #include <c10/util/string_view.h>
 #include <c10/util/Exception.h>
@@ -246,5 +248,110 @@ Tensor NestedTensor_to_mask(const Tensor& nt, c10::optional<int64_t> mask_dim, c
   return result;
 }
 
+namespace {
+
+// Builds the (batch_size + 1) cumulative sequence length tensor for one
+// nested input laid out as (batch, seq*, ...) and reports the maximum and
+// total sequence length. The kernel consumes int64 offsets on CPU, so no
+// device round trip is needed here (unlike the CUDA preprocessing).
+std::tuple<Tensor, int64_t, int64_t> cumulative_and_max_seq_len_cpu(
+    const Tensor& qkv) {
+  auto* impl = get_nested_tensor_impl(qkv);
+  const auto& sizes = impl->get_nested_sizes();
+  const int64_t batch_size = sizes.size(0);
+  auto cumulative_seqlen =
+      at::zeros({batch_size + 1}, TensorOptions().dtype(at::kLong));
+  auto* sizes_ptr = sizes.data_ptr<int64_t>();
+  auto* cumulative_seqlen_ptr = cumulative_seqlen.data_ptr<int64_t>();
+  const auto sizes_stride = sizes.stride(0);
+  int64_t sum = 0;
+  int64_t max_seqlen = 0;
+  for (const auto i : c10::irange(batch_size)) {
+    int64_t current_seq_len = sizes_ptr[i * sizes_stride];
+    sum += current_seq_len;
+    max_seqlen = std::max(max_seqlen, current_seq_len);
+    cumulative_seqlen_ptr[i + 1] = sum;
+  }
+  return std::make_tuple(std::move(cumulative_seqlen), max_seqlen, sum);
+}
+
+} // namespace
+
+std::tuple<
+    Tensor,
+    Tensor,
+    Tensor,
+    Tensor,
+    c10::SymInt,
+    c10::SymInt,
+    Tensor,
+    Tensor,
+    Tensor>
+_scaled_dot_product_flash_attention_nestedtensor_cpu(
+    const Tensor& query,
+    const Tensor& key,
+    const Tensor& value,
+    double dropout_p,
+    bool is_causal,
+    bool return_debug_mask,
+    c10::optional<double> scale) {
+  const auto dtype = query.scalar_type();
+
+  TORCH_CHECK(query.is_nested() && key.is_nested() && value.is_nested(),
+    "scaled_dot_product_attention_flash_attention: Expected query, key and value to all be nested tensors");
+  TORCH_CHECK(c10::isFloatingType(dtype) && dtype != ScalarType::Half,
+    "scaled_dot_product_attention_flash_attention: Expected data type in FP32, FP64, BF16, but got ", dtype, " instead.");
+  TORCH_CHECK(query.dim() == 4 && key.dim() == 4 && value.dim() == 4,
+    "scaled_dot_product_attention_flash_attention: Accept only 4 dims inputs shape of {B, H, T, K}");
+  TORCH_CHECK(dropout_p == 0.0,
+    "scaled_dot_product_attention_flash_attention: Currently do not support dropout > 0");
+  TORCH_CHECK(return_debug_mask == false,
+    "scaled_dot_product_attention_flash_attention: Currently do not support 'return_debug_mask'");
+
+  // Inputs are (B, H, T*, K) with ragged T; repack them as (B, T*, H, K) so
+  // the buffer is a dense (total_seq, num_head, head_size) matrix the varlen
+  // kernel can index with the cumulative offsets.
+  auto q_t = query.transpose(1, 2).contiguous();
+  auto k_t = key.transpose(1, 2).contiguous();
+  auto v_t = value.transpose(1, 2).contiguous();
+
+  auto [cum_seq_q, max_q, total_q] = cumulative_and_max_seq_len_cpu(q_t);
+  auto [cum_seq_k, max_k, total_k] = cumulative_and_max_seq_len_cpu(k_t);
+
+  const int64_t num_head = q_t.size(2);
+  const int64_t head_size = q_t.size(3);
+  TORCH_CHECK((head_size == v_t.size(3)) && (k_t.size(3) == v_t.size(3)),
+    "scaled_dot_product_attention_flash_attention: Q/K/V should have the same head size");
+
+  auto q_buf = get_buffer(q_t).view({total_q, num_head, head_size});
+  auto k_buf = get_buffer(k_t).view({total_k, num_head, head_size});
+  auto v_buf = get_buffer(v_t).view({total_k, num_head, head_size});
+
+  auto output_buffer = at::empty({total_q, num_head, head_size}, query.options());
+  const auto accumulate_dtype = toOpMathType(dtype);
+  auto logsumexp = at::empty({total_q, num_head},
+      query.options().dtype(accumulate_dtype));
+
+  flash_attention_varlen_kernel(kCPU, output_buffer, logsumexp,
+      q_buf, k_buf, v_buf, cum_seq_q, cum_seq_k, max_q, max_k,
+      is_causal, scale);
+
+  // Repack (total_seq, num_head, head_size) back into a (B, H, T*, K) nested
+  // tensor sharing the output buffer.
+  auto attention =
+      wrap_buffer(
+          output_buffer.view(-1),
+          get_nested_tensor_impl(q_t)->get_nested_sizes().clone())
+          .transpose(1, 2);
+
+  at::Tensor philox_seed = at::empty({}, at::kLong);
+  at::Tensor philox_offset = at::empty({}, at::kLong);
+  at::Tensor debug_attn_mask = at::empty({}, query.options());
+
+  return std::make_tuple(std::move(attention), std::move(logsumexp),
+      std::move(cum_seq_q), std::move(cum_seq_k), max_q, max_k,
+      std::move(philox_seed), std::move(philox_offset), std::move(debug_attn_mask));
+}
+
 } // namespace native
 } // namespace at
@@ -27,6 +27,87 @@
 int register_linear_params();
 
 #ifdef USE_FBGEMM
+namespace {
+
+// Note [Dynamic linear activation workspace]
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// PackAWithQuantRowOffset mallocs a packed-A tile buffer and a row-offset
+// buffer on every call unless the caller supplies them. For the small and
+// medium GEMMs typical of dynamic quantized text models those allocator
+// round trips show up in profiles, so each thread keeps a workspace that is
+// sized once and handed to fbgemm on every call, the same way the dnnlowp
+// operators in caffe2/quantization/server reuse their packing buffers.
+struct ActivationQuantWorkspace {
+  std::vector<uint8_t> packed_a;
+  std::vector<int32_t> row_offsets;
+
+  uint8_t* packed_a_buffer(size_t len) {
+    if (packed_a.size() < len) {
+      packed_a.resize(len);
+    }
+    return packed_a.data();
+  }
+
+  int32_t* row_offset_buffer(size_t len) {
+    if (row_offsets.size() < len) {
+      row_offsets.resize(len);
+    }
+    return row_offsets.data();
+  }
+};
+
+ActivationQuantWorkspace& activation_quant_workspace() {
+  static thread_local ActivationQuantWorkspace workspace;
+  return workspace;
+}
+
+// Note [Caching activation min/max across linear layers]
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// Transformer blocks feed the same activation tensor into several dynamic
+// linear layers (the q/k/v projections and the like), and each of them
+// rescans the whole tensor with FindMinMax before quantizing. The min/max of
+// a buffer cannot change between those calls unless the tensor is mutated,
+// so the last scan is memoized per thread. An entry is only reused when the
+// cached weak storage pointer still locks to the same live StorageImpl
+// (which rules out allocator address reuse), the version counter is
+// unchanged (which rules out in-place mutation), and the element count
+// matches. Inference tensors carry no version counter and skip the cache.
+struct ActivationMinMaxCache {
+  c10::optional<c10::weak_intrusive_ptr<c10::StorageImpl>> storage;
+  int64_t version = -1;
+  int64_t numel = -1;
+  float min = 0.f;
+  float max = 0.f;
+};
+
+void find_min_max_cached(const at::Tensor& input, float* x_min, float* x_max) {
+  static thread_local ActivationMinMaxCache cache;
+  const bool cacheable = !input.is_inference();
+  if (cacheable && cache.storage.has_value() &&
+      cache.version == input._version() && cache.numel == input.numel()) {
+    auto locked = cache.storage->lock();
+    if (locked && locked.get() == input.storage().unsafeGetStorageImpl()) {
+      *x_min = cache.min;
+      *x_max = cache.max;
+      return;
+    }
+  }
+  fbgemm::FindMinMax(
+      /*m=*/input.const_data_ptr<float>(),
+      /*min=*/x_min,
+      /*max=*/x_max,
+      /*len=*/input.numel());
+  if (cacheable) {
+    cache.storage = input.storage().getWeakStorageImpl();
+    cache.version = input._version();
+    cache.numel = input.numel();
+    cache.min = *x_min;
+    cache.max = *x_max;
+  }
+}
+
+} // namespace
+
 template <bool ReluFused>
 at::Tensor PackedLinearWeight::apply_dynamic_impl(
     at::Tensor input,
@@ -62,14 +143,12 @@ at::Tensor PackedLinearWeight::apply_dynamic_impl(
       "The number of rows in the packB should be equal to K: " +
           std::to_string(K));
 
-  // Calculate statistics for quantization of the input Tensor
+  // Calculate statistics for quantization of the input Tensor, reusing the
+  // previous scan when several linear layers consume the same activation.
+  // See Note [Caching activation min/max across linear layers].
   // NOLINTNEXTLINE(cppcoreguidelines-init-variables)
   float x_min, x_max;
-  fbgemm::FindMinMax(
-      /*m=*/input_ptr,
-      /*min=*/&x_min,
-      /*max=*/&x_max,
-      /*len=*/input.numel());
+  find_min_max_cached(input_contig, &x_min, &x_max);
 
   // Input tensor is quantized as 8-bit unsigned values
   static constexpr int precision = 8;
@@ -135,18 +214,24 @@ at::Tensor PackedLinearWeight::apply_dynamic_impl(
     //  Note this is not executed eagerly, but rather within the fbgemmPacked
     //  call below.
 
+    // See Note [Dynamic linear activation workspace]
+    auto& workspace = activation_quant_workspace();
     fbgemm::PackAWithQuantRowOffset<uint8_t> packA(
         /*trans=*/fbgemm::matrix_op_t::NoTranspose,
         /*nRow=*/M,
         /*nCol=*/K,
         /*smat=*/input_ptr,
         /*ld=*/K,
-        /*pmat=*/nullptr, // Currently, packA manages ownership of `pmat`.
+        /*pmat=*/
+        workspace.packed_a_buffer(
+            fbgemm::PackAWithQuantRowOffset<uint8_t>::packedBufferSize()),
         // NOLINTNEXTLINE(bugprone-narrowing-conversions,cppcoreguidelines-narrowing-conversions)
         /*scale=*/q_params.scale,
-        /*zero_pt=*/q_params.zero_point);
-    // TODO: Consider a way to pre-allocate and reuse
-    // pmat buffer.
+        /*zero_pt=*/q_params.zero_point,
+        /*groups=*/1,
+        /*row_offset=*/
+        workspace.row_offset_buffer(
+            fbgemm::PackAWithQuantRowOffset<uint8_t>::rowOffsetBufferSize()));
 
     // This is the end of the pipeline, pass the resulting matrix through.
     fbgemm::DoNothing<float, float> doNothingObj{};
@@ -618,6 +618,58 @@ void addmm_out_sparse_csr_native_cpu(
       });
 }
 
+#if !AT_USE_MKL_SPARSE()
+// Routes CSR @ strided -> strided through the vectorized spmm_reduce kernel
+// when dtype and layout permit. Compared to addmm_out_sparse_csr_native_cpu
+// it splits threads by nnz rather than by row (utils::parallel_sparse_csr
+// inspects crow_indices and precomputes the partition before the multiply)
+// and uses vectorized inner loops over the feature dimension, which matters
+// for workloads that multiply one large adjacency matrix against dense
+// features every iteration. Returns false to let the caller fall back to the
+// scalar path.
+static bool addmm_out_sparse_csr_spmm_cpu(
+    const Tensor& sparse,
+    const Tensor& dense,
+    Tensor& result,
+    const Scalar& beta,
+    const Scalar& alpha) {
+  // The kernel assumes a row-major contiguous output and non-hybrid values.
+  if (!result.is_contiguous() || sparse.values().dim() != 1) {
+    return false;
+  }
+  const auto scalar_type = result.scalar_type();
+  if (scalar_type != dense.scalar_type() ||
+      scalar_type != sparse.values().scalar_type()) {
+    return false;
+  }
+  // Matches the dispatch of spmm_reduce_kernel.
+  if (scalar_type != kFloat && scalar_type != kDouble &&
+      scalar_type != kBFloat16) {
+    return false;
+  }
+
+  const auto crow = sparse.crow_indices();
+  const auto col = sparse.col_indices();
+  const auto values = sparse.values();
+
+  // The kernel overwrites rows with nonzeros and skips empty rows, so the
+  // output must start zeroed and any beta * self contribution has to be
+  // applied separately.
+  if (beta.toComplexDouble() == 0.) {
+    result.zero_();
+    spmm_reduce_stub(kCPU, result, crow, col, values, dense, ReductionType::SUM);
+    if (alpha.toComplexDouble() != 1.) {
+      result.mul_(alpha);
+    }
+  } else {
+    auto mm = at::zeros_like(result);
+    spmm_reduce_stub(kCPU, mm, crow, col, values, dense, ReductionType::SUM);
+    result.mul_(beta).add_(mm, alpha);
+  }
+  return true;
+}
+#endif // !AT_USE_MKL_SPARSE()
+
 // Functions for matrix multiplication.
 // result = beta * self + alpha (mat1 @ mat2)
 Tensor& addmm_out_sparse_compressed_cpu(
@@ -732,6 +784,9 @@ Tensor& addmm_out_sparse_compressed_cpu(
   } else if (mat1.layout() == kSparseCsr) {
     if (mat2.layout() == kStrided) {
       if (result.layout() == kStrided) {
+        if (addmm_out_sparse_csr_spmm_cpu(mat1, mat2, result, beta, alpha)) {
+          return result;
+        }
         AT_DISPATCH_FLOATING_AND_COMPLEX_TYPES(
             result.scalar_type(), "addmm_sparse_dense", [&] {
               addmm_out_sparse_csr_native_cpu<scalar_t>(
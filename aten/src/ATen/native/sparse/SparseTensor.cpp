@@ -7,6 +7,7 @@
 #include <ATen/Layout.h>
 #include <ATen/Parallel.h>
 #include <ATen/SparseTensorImpl.h>
+#include <ATen/core/grad_mode.h>
 #include <ATen/native/SparseTensorUtils.h>
 #include <ATen/native/sparse/SparseStubs.h>
 #include <ATen/native/IndexingUtils.h>
@@ -593,7 +594,23 @@ SparseTensor coalesce(const SparseTensor& self) {
   if (self.is_coalesced()) {
     return self;
   }
-  return at::_coalesce(self);
+  // See NOTE [ Coalesce cache ] in ATen/SparseTensorImpl.h. The cache is
+  // bypassed when the result would be attached to the autograd graph, as a
+  // memoized output would carry the grad_fn of the call that created it.
+  const bool may_use_cache =
+      !(at::GradMode::is_enabled() && self.requires_grad());
+  auto* impl = get_sparse_impl(self);
+  if (may_use_cache) {
+    auto cached = impl->cached_coalesced();
+    if (cached.defined()) {
+      return cached;
+    }
+  }
+  auto result = at::_coalesce(self);
+  if (may_use_cache) {
+    impl->set_cached_coalesced(result);
+  }
+  return result;
 }
 
 SparseTensor _coalesce_sparse_cpu(const SparseTensor& self) {
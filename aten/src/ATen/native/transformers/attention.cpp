@@ -8,6 +8,7 @@
 #include <ATen/NestedTensorImpl.h>
 #include <ATen/TensorIndexing.h>
 #include <ATen/TensorSubclassLikeUtils.h>
+#include <ATen/native/cpu/SoftmaxKernel.h>
 #include <ATen/native/transformers/attention.h>
 #include <ATen/native/transformers/sdp_utils_cpp.h>
 #include <c10/util/typeid.h>
@@ -33,6 +34,8 @@
 #include <ATen/ops/_nested_tensor_softmax_with_shape.h>
 #include <ATen/ops/_scaled_dot_product_attention_math.h>
 #include <ATen/ops/_scaled_dot_product_attention_math_native.h>
+#include <ATen/ops/_scaled_dot_product_attention_varlen_native.h>
+#include <ATen/ops/_scaled_dot_product_attention_with_kv_cache_native.h>
 #include <ATen/ops/_scaled_dot_product_efficient_attention.h>
 #include <ATen/ops/_scaled_dot_product_flash_attention.h>
 #include <ATen/ops/_scaled_dot_product_flash_attention_backward_native.h>
@@ -46,11 +49,14 @@
 #include <ATen/ops/cat.h>
 #include <ATen/ops/chunk_native.h>
 #include <ATen/ops/dropout.h>
+#include <ATen/ops/empty_like.h>
+#include <ATen/ops/linear.h>
 #include <ATen/ops/linear_native.h>
 #include <ATen/ops/matmul.h>
 #include <ATen/ops/matmul_native.h>
 #include <ATen/ops/ones.h>
 #include <ATen/ops/pad.h>
+#include <ATen/ops/scaled_dot_product_attention.h>
 #include <ATen/ops/scaled_dot_product_attention_native.h>
 #include <ATen/ops/softmax.h>
 #include <ATen/ops/split_native.h>
@@ -69,6 +75,7 @@ DEFINE_DISPATCH(_fused_sdp_choice_stub);
 DEFINE_DISPATCH(transform_bias_rescale_qkv_stub);
 DEFINE_DISPATCH(flash_attention_kernel);
 DEFINE_DISPATCH(flash_attention_backward_kernel);
+DEFINE_DISPATCH(flash_attention_varlen_kernel);
 
 namespace {
 
@@ -88,6 +95,36 @@ Tensor transform_0213(const Tensor& a) {
       .view({a.size(0), a.size(2), a.size(1) * a.size(3)});
 }
 
+// Whether the math fallback can hand `attn` to the fused CPU
+// masked-softmax(-dropout) kernel (cpu/SoftMaxKernel.cpp) instead of running
+// mask-add, softmax and dropout as separate passes over the attention matrix.
+// The kernel is forward-only, so anything that needs an autograd graph keeps
+// using the composite ops.
+bool can_use_fused_masked_softmax_dropout(
+    const Tensor& attn,
+    const c10::optional<Tensor>& attn_mask) {
+  if (!attn.is_cpu() || attn.is_nested() || !attn.is_contiguous() ||
+      attn.numel() == 0 || attn.requires_grad() ||
+      at::areAnyTensorSubclassLike({attn})) {
+    return false;
+  }
+  const auto dtype = attn.scalar_type();
+  if (dtype != at::kFloat && dtype != at::kDouble && dtype != at::kBFloat16 &&
+      dtype != at::kHalf) {
+    return false;
+  }
+  if (attn_mask.has_value()) {
+    if (attn_mask->requires_grad() || attn_mask->is_nested() ||
+        at::areAnyTensorSubclassLike({*attn_mask}) ||
+        attn_mask->scalar_type() != dtype || attn_mask->dim() < 1 ||
+        attn_mask->dim() > attn.dim() ||
+        attn_mask->size(-1) != attn.size(-1) || attn_mask->stride(-1) != 1) {
+      return false;
+    }
+  }
+  return true;
+}
+
 } // namespace
 
 
@@ -324,8 +361,48 @@ std::tuple<Tensor, Tensor> native_multi_head_attention_cpu(
       ? get_nested_tensor_impl(query)->get_nested_sizes().size(0)
       : query.sizes()[0];
   auto T = query.is_nested() ? 0 : query.sizes()[1];
-  const auto dim_per_head = D / num_head;
 #endif
+  const auto dim_per_head = D / num_head;
+
+  // Head-parallel hot path: self-attention without a mask or attention
+  // weights can run through the fused CPU flash kernel, which partitions
+  // (batch, head, query-block) work items across at::parallel_for with
+  // per-thread accumulation buffers.  The bmm-based fallback below only
+  // parallelizes inside each full-size GEMM/softmax call, which leaves most
+  // cores idle for batch-size-1 latency-bound inference.
+  if ((query.is_same(key) && key.is_same(value)) && !query.is_nested() &&
+      !need_weights) {
+    // We have not done the linear projection yet, but SDP expects
+    // 4-dimensional input; create cheap views for the backend checks only.
+    auto q =
+        query.view({query.size(0), -1, num_head, dim_per_head}).transpose(1, 2);
+
+    sdp::sdp_params kernel_params{q, q, q, mask, 0.0, false};
+    // The transformer_encoder API mask has shape (Batch_Size, Seq_len_q),
+    // which does not broadcast the way SDP expects, so masked calls keep
+    // using masked_softmax below.
+    if (!mask.has_value() &&
+        sdp::select_sdp_backend_cpp(kernel_params) ==
+            sdp::SDPBackend::flash_attention) {
+      auto x = at::linear(query, qkv_weight, qkv_bias);
+      auto chunks = x.chunk(3, -1);
+      auto x_size_0 = x.size(0);
+
+      chunks[0] = (chunks[0].view({x_size_0, -1, num_head, dim_per_head}))
+                      .transpose(1, 2);
+      chunks[1] = (chunks[1].view({x_size_0, -1, num_head, dim_per_head}))
+                      .transpose(1, 2);
+      chunks[2] = (chunks[2].view({x_size_0, -1, num_head, dim_per_head}))
+                      .transpose(1, 2);
+      auto y = at::scaled_dot_product_attention(
+          chunks[0], chunks[1], chunks[2], mask, 0.0, false, c10::nullopt);
+
+      auto past_sdp = y.transpose(1, 2).reshape({x_size_0, -1, embed_dim});
+      return std::make_tuple(
+          at::linear(past_sdp, proj_weight, proj_bias), Tensor());
+    }
+    // Math backend selected (or an error): fall through to the bmm chain.
+  }
 
   // shape: [B, T, 3 x D]
   auto qkv = qkv_projection(query, key, value, embed_dim, qkv_weight);
@@ -678,6 +755,148 @@ Tensor scaled_dot_product_attention(
   }
 }
 
+// KV-cache-aware variant of scaled_dot_product_attention for incremental
+// decoding. key/value hold only the new token(s); key_cache/value_cache are
+// preallocated to the maximum sequence length and cache_len is the number of
+// positions already filled. The new keys/values are written into the caches in
+// place and attention runs over a narrowed view of the valid prefix, so no
+// tensor is reallocated or concatenated as the sequence grows. Backend
+// selection (flash / efficient / math) is unchanged: this routes through
+// scaled_dot_product_attention on the cache views.
+//
+// Note that is_causal uses the same top-left alignment convention as
+// scaled_dot_product_attention; for single-token decode steps the query may
+// attend to every cached position, so no mask is needed.
+Tensor _scaled_dot_product_attention_with_kv_cache(
+    const Tensor& query,
+    const Tensor& key,
+    const Tensor& value,
+    Tensor& key_cache,
+    Tensor& value_cache,
+    int64_t cache_len,
+    const c10::optional<Tensor>& attn_mask,
+    double dropout_p,
+    bool is_causal,
+    c10::optional<double> scale) {
+  TORCH_CHECK(
+      query.dim() == 4 && key.dim() == 4 && value.dim() == 4 &&
+          key_cache.dim() == 4 && value_cache.dim() == 4,
+      "_scaled_dot_product_attention_with_kv_cache: expect query, key, value and the caches ",
+      "to be 4-D tensors of shape {B, H, T, E}");
+  TORCH_CHECK(
+      key.scalar_type() == key_cache.scalar_type() &&
+          value.scalar_type() == value_cache.scalar_type(),
+      "_scaled_dot_product_attention_with_kv_cache: key/value and their caches must have the same dtype");
+  const int64_t new_len = key.size(2);
+  const int64_t max_len = key_cache.size(2);
+  TORCH_CHECK(
+      value.size(2) == new_len && value_cache.size(2) == max_len,
+      "_scaled_dot_product_attention_with_kv_cache: key and value (and their caches) must cover ",
+      "the same number of positions");
+  TORCH_CHECK(
+      key_cache.size(0) == key.size(0) && key_cache.size(1) == key.size(1) &&
+          key_cache.size(3) == key.size(3) &&
+          value_cache.size(0) == value.size(0) &&
+          value_cache.size(1) == value.size(1) &&
+          value_cache.size(3) == value.size(3),
+      "_scaled_dot_product_attention_with_kv_cache: caches must match key/value in all dims but the sequence dim");
+  TORCH_CHECK(
+      cache_len >= 0 && cache_len + new_len <= max_len,
+      "_scaled_dot_product_attention_with_kv_cache: cache overflow, cache_len:", cache_len,
+      " + new tokens:", new_len, " exceeds cache capacity:", max_len);
+
+  // In-place append; narrow returns a view so nothing is reallocated.
+  key_cache.narrow(2, cache_len, new_len).copy_(key);
+  value_cache.narrow(2, cache_len, new_len).copy_(value);
+
+  const int64_t total_len = cache_len + new_len;
+  return at::scaled_dot_product_attention(
+      query,
+      key_cache.narrow(2, 0, total_len),
+      value_cache.narrow(2, 0, total_len),
+      attn_mask,
+      dropout_p,
+      is_causal,
+      scale);
+}
+
+// Math-backend fallback for varlen SDPA (see the CUDA implementation in
+// transformers/cuda/attention.cu, which routes to the flash varlen kernel).
+// Inputs are packed as [total_tokens, num_heads, head_dim] with per-sequence
+// boundaries in cum_seq_q / cum_seq_k, so mixed-length batches run without
+// padding. Each sequence is a narrowed view into the packed buffer; is_causal
+// uses the bottom-right alignment of the flash varlen kernels, which is what
+// a decode step appending new tokens onto an existing prefix needs.
+Tensor _scaled_dot_product_attention_varlen_cpu(
+    const Tensor& query,
+    const Tensor& key,
+    const Tensor& value,
+    const Tensor& cum_seq_q,
+    const Tensor& cum_seq_k,
+    int64_t max_q,
+    int64_t max_k,
+    double dropout_p,
+    bool is_causal,
+    c10::optional<double> scale) {
+  TORCH_CHECK(
+      query.dim() == 3 && key.dim() == 3 && value.dim() == 3,
+      "_scaled_dot_product_attention_varlen: expect query, key and value to be packed ",
+      "3-D tensors of shape {total_tokens, num_heads, head_dim}");
+  TORCH_CHECK(
+      cum_seq_q.dim() == 1 && cum_seq_k.dim() == 1 &&
+          cum_seq_q.numel() == cum_seq_k.numel() && cum_seq_q.numel() >= 2,
+      "_scaled_dot_product_attention_varlen: cum_seq_q and cum_seq_k must be 1-D ",
+      "tensors of batch_size + 1 cumulative offsets");
+  TORCH_CHECK(
+      cum_seq_q.scalar_type() == at::kInt && cum_seq_k.scalar_type() == at::kInt,
+      "_scaled_dot_product_attention_varlen: cumulative offsets must be int32");
+
+  const auto cum_seq_q_contig = cum_seq_q.contiguous();
+  const auto cum_seq_k_contig = cum_seq_k.contiguous();
+  const int32_t* cu_q = cum_seq_q_contig.const_data_ptr<int32_t>();
+  const int32_t* cu_k = cum_seq_k_contig.const_data_ptr<int32_t>();
+  const int64_t batch_size = cum_seq_q_contig.numel() - 1;
+
+  auto out =
+      at::empty({query.size(0), query.size(1), value.size(2)}, query.options());
+  for (const auto b : c10::irange(batch_size)) {
+    const int64_t q_off = cu_q[b];
+    const int64_t q_len = cu_q[b + 1] - cu_q[b];
+    const int64_t k_off = cu_k[b];
+    const int64_t k_len = cu_k[b + 1] - cu_k[b];
+    TORCH_CHECK(
+        q_len >= 0 && q_len <= max_q && k_len >= 0 && k_len <= max_k,
+        "_scaled_dot_product_attention_varlen: cumulative offsets must be ",
+        "non-decreasing with per-sequence lengths at most max_q/max_k");
+    if (q_len == 0) {
+      continue;
+    }
+    auto q_b = query.narrow(0, q_off, q_len).transpose(0, 1).unsqueeze(0);
+    auto k_b = key.narrow(0, k_off, k_len).transpose(0, 1).unsqueeze(0);
+    auto v_b = value.narrow(0, k_off, k_len).transpose(0, 1).unsqueeze(0);
+    c10::optional<Tensor> attn_mask;
+    if (is_causal) {
+      // Bottom-right aligned causal mask: the last query token attends to the
+      // whole sequence, matching the flash varlen kernel convention.
+      attn_mask = convert_boolean_attn_mask(
+          at::ones({q_len, k_len}, query.options().dtype(at::kBool))
+              .tril(k_len - q_len),
+          query.dtype());
+    }
+    auto out_b = std::get<0>(at::_scaled_dot_product_attention_math(
+        q_b,
+        k_b,
+        v_b,
+        attn_mask,
+        dropout_p,
+        /*is_causal=*/false,
+        c10::nullopt /*dropout_mask*/,
+        scale));
+    out.narrow(0, q_off, q_len).copy_(out_b.squeeze(0).transpose(0, 1));
+  }
+  return out;
+}
+
 std::tuple<Tensor, Tensor> _scaled_dot_product_attention_math(
         const Tensor& query_, const Tensor& key, const Tensor& value,
         const c10::optional<Tensor>& attn_mask_, double dropout_p, bool is_causal,
@@ -709,6 +928,20 @@ std::tuple<Tensor, Tensor> _scaled_dot_product_attention_math(
         attn_mask = convert_boolean_attn_mask(attn_mask, query.dtype());
     }
     auto attn = at::matmul(query, key.transpose(-2, -1) * scaling_factor);
+    if (!dropout_mask.has_value() &&
+        can_use_fused_masked_softmax_dropout(attn, attn_mask)) {
+      c10::optional<Tensor> keep_mask;
+      double dropout_scale = 1.0;
+      if (dropout_p > 0.0) {
+        // Same keep-mask distribution as at::dropout; the 1/(1-p) scaling is
+        // folded into the softmax normalization inside the kernel.
+        keep_mask = at::empty_like(attn).bernoulli_(1.0 - dropout_p);
+        dropout_scale = dropout_p == 1.0 ? 0.0 : 1.0 / (1.0 - dropout_p);
+      }
+      masked_softmax_dropout_lastdim_kernel(
+          kCPU, attn, attn, attn_mask, keep_mask, dropout_scale);
+      return std::make_tuple(at::matmul(attn, value), attn);
+    }
     if (attn_mask.has_value()) {
       if (at::areAnyTensorSubclassLike({attn, *attn_mask})) {
         attn = attn.add(*attn_mask);
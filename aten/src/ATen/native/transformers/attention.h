@@ -69,8 +69,20 @@ using flash_attention_backward_fn = void (*)(
     const Tensor& philox_seed, const Tensor& philox_offset,
     c10::optional<double> scale);
 
+// Jagged (varlen) variant operating on the packed buffers of nested tensors.
+// query is (total_q, num_heads, head_size), key/value are (total_kv,
+// num_heads, head_size), and the per-sequence extents are given by the
+// cumulative sequence length tensors (batch_size + 1, int64).
+using flash_attention_varlen_fn = void (*)(
+    const Tensor& output, const Tensor& logsumexp,
+    const Tensor& query, const Tensor& key, const Tensor& value,
+    const Tensor& cum_seq_q, const Tensor& cum_seq_k,
+    int64_t max_q, int64_t max_k, bool is_causal,
+    c10::optional<double> scale);
+
 DECLARE_DISPATCH(flash_attention_fn, flash_attention_kernel);
 DECLARE_DISPATCH(flash_attention_backward_fn, flash_attention_backward_kernel);
+DECLARE_DISPATCH(flash_attention_varlen_fn, flash_attention_varlen_kernel);
 
 } // namespace native
 } // namespace at
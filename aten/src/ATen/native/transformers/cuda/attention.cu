@@ -35,6 +35,7 @@
 #include <ATen/ops/_masked_softmax.h>
 #include <ATen/ops/_native_multi_head_attention_native.h>
 #include <ATen/ops/scaled_dot_product_attention_native.h>
+#include <ATen/ops/_scaled_dot_product_attention_varlen_native.h>
 #include <ATen/ops/_scaled_dot_product_efficient_attention.h>
 #include <ATen/ops/_scaled_dot_product_efficient_attention_native.h>
 #include <ATen/ops/_scaled_dot_product_flash_attention.h>
@@ -873,6 +874,50 @@ _flash_attention_forward(
       Tensor());
 }
 
+// Varlen SDPA for batches whose sequences have differing lengths (e.g.
+// speculative-decode verification). query is packed as [Nnz_q, num_heads,
+// head_dim] with per-sequence boundaries given by cum_seq_q (and likewise for
+// key/value with cum_seq_k), so no padding tokens are computed. This is the
+// same packed layout the nested-tensor path produces in
+// sdpa_nested_preprocessing; here the caller provides the offsets directly.
+Tensor _scaled_dot_product_attention_varlen_cuda(
+    const Tensor& query,
+    const Tensor& key,
+    const Tensor& value,
+    const Tensor& cum_seq_q,
+    const Tensor& cum_seq_k,
+    int64_t max_q,
+    int64_t max_k,
+    double dropout_p,
+    bool is_causal,
+    c10::optional<double> scale) {
+  TORCH_CHECK(
+      query.dim() == 3 && key.dim() == 3 && value.dim() == 3,
+      "_scaled_dot_product_attention_varlen: expect query, key and value to be packed ",
+      "3-D tensors of shape {total_tokens, num_heads, head_dim}");
+  TORCH_CHECK(
+      cum_seq_q.dim() == 1 && cum_seq_k.dim() == 1 &&
+          cum_seq_q.numel() == cum_seq_k.numel() && cum_seq_q.numel() >= 2,
+      "_scaled_dot_product_attention_varlen: cum_seq_q and cum_seq_k must be 1-D ",
+      "tensors of batch_size + 1 cumulative offsets");
+  TORCH_CHECK(
+      cum_seq_q.scalar_type() == at::kInt && cum_seq_k.scalar_type() == at::kInt,
+      "_scaled_dot_product_attention_varlen: cumulative offsets must be int32");
+  auto out_and_aux = _flash_attention_forward(
+      query,
+      key,
+      value,
+      cum_seq_q,
+      cum_seq_k,
+      max_q,
+      max_k,
+      dropout_p,
+      is_causal,
+      false /*return_debug_mask*/,
+      scale);
+  return std::get<0>(out_and_aux);
+}
+
 std::tuple<Tensor, Tensor, Tensor, Tensor, c10::SymInt, c10::SymInt> _efficient_attention_forward(
     const at::Tensor& query, // [b, seqlen, num_heads, K]
     const at::Tensor& key, // [b, seqlen, num_heads, K]
@@ -32,27 +32,64 @@ bool check_head_dim_size_cpp(sdp_params const& params, bool debug) {
   return true;
 }
 
+bool check_all_tensors_nested_cpp(sdp_params const& params, bool debug) {
+  // The CPU varlen kernel operates on the packed buffers of all three
+  // inputs, so partially nested input combinations are not supported.
+  if (!(params.query.is_nested() && params.key.is_nested() &&
+        params.value.is_nested())) {
+    if (debug) {
+      TORCH_WARN(
+          "Flash attention on CPU requires query, key and value to all be nested tensors when any of them is nested.");
+    }
+    return false;
+  }
+  return true;
+}
+
 bool use_flash_attention_cpp(sdp_params const& params, bool debug) {
   constexpr auto cpp_supported_flash_dtypes =
       array_of<at::ScalarType>(at::kFloat, at::kDouble, at::kBFloat16);
 
   // Define gate functions that determine if a flash kernel can be run
-  constexpr auto constraints = array_of<bool (*)(sdp_params const&, bool)>(
-      check_runtime_disabled_flash,
-      check_nested_tensor,
-      check_for_dropout,
-      check_tensor_shapes,
-      check_batch_size_and_num_heads_dense,
-      check_for_attn_mask,
-      check_head_dim_size_cpp,
-      check_nonzero_sequence_lengths_dense,
-      check_last_dim_stride_equals_1_dense);
-  for (auto& constraint : constraints) {
+  constexpr auto general_constraints =
+      array_of<bool (*)(sdp_params const&, bool)>(
+          check_runtime_disabled_flash,
+          check_for_dropout,
+          check_tensor_shapes,
+          check_for_attn_mask,
+          check_head_dim_size_cpp);
+  for (auto& constraint : general_constraints) {
     if (!constraint(params, debug)) {
       return false;
     }
   }
 
+  if (has_for_nested_inputs(params)) {
+    constexpr auto nested_constraints =
+        array_of<bool (*)(sdp_params const&, bool)>(
+            check_all_tensors_nested_cpp,
+            // There is no nested backward kernel on CPU
+            check_requires_grad_and_nested,
+            check_batch_size_nested,
+            check_for_seq_len_0_nested_tensor);
+    for (auto& constraint : nested_constraints) {
+      if (!constraint(params, debug)) {
+        return false;
+      }
+    }
+  } else {
+    constexpr auto dense_constraints =
+        array_of<bool (*)(sdp_params const&, bool)>(
+            check_batch_size_and_num_heads_dense,
+            check_nonzero_sequence_lengths_dense,
+            check_last_dim_stride_equals_1_dense);
+    for (auto& constraint : dense_constraints) {
+      if (!constraint(params, debug)) {
+        return false;
+      }
+    }
+  }
+
   return check_tensor_dtype(params, cpp_supported_flash_dtypes, debug);
 }
 } // namespace
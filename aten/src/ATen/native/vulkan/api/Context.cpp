@@ -1,5 +1,6 @@
 #include <ATen/native/vulkan/api/Context.h>
 
+#include <cstdlib>
 #include <sstream>
 
 namespace at {
@@ -101,7 +102,24 @@ bool available() {
 Context* context() {
   static const std::unique_ptr<Context> context([]() -> Context* {
     try {
-      const uint32_t submit_frequency = 16u;
+      // Number of compute dispatches to record into a command buffer before it
+      // is submitted to the GPU. Larger values batch more work per submission
+      // and coalesce fences (syncs only wait on the single fence of the final
+      // submission), at the cost of the GPU starting work later. Models
+      // dominated by small ops benefit from recording an entire invocation
+      // into one command buffer.
+      uint32_t submit_frequency = 16u;
+      static const char* submit_frequency_str =
+          getenv("PYTORCH_VULKAN_CMD_SUBMIT_FREQUENCY");
+      if (submit_frequency_str) {
+        const long submit_frequency_val =
+            strtol(submit_frequency_str, nullptr, 0);
+        TORCH_CHECK(
+            submit_frequency_val >= 1,
+            "invalid command buffer submit frequency: ",
+            submit_frequency_str);
+        submit_frequency = static_cast<uint32_t>(submit_frequency_val);
+      }
 
       const CommandPoolConfig cmd_config{
           32u, // cmdPoolInitialSize
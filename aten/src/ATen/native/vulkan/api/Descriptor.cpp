@@ -149,13 +149,20 @@ VkDescriptorSet DescriptorSetPile::get_descriptor_set() {
   // No-ops if there are descriptor sets available
   allocate_new_batch();
 
+  // Note that the handle stays in the pile so that it can be handed out again
+  // after reset(); every use rewrites the set's bindings via
+  // vkUpdateDescriptorSets (see DescriptorSet::get_bind_handle) so stale
+  // bindings cannot leak between uses.
   const VkDescriptorSet handle = descriptors_[in_use_];
-  descriptors_[in_use_] = VK_NULL_HANDLE;
 
   in_use_++;
   return handle;
 }
 
+void DescriptorSetPile::reset() {
+  in_use_ = 0u;
+}
+
 void DescriptorSetPile::allocate_new_batch() {
   // No-ops if there are still descriptor sets availble
   if (in_use_ < descriptors_.size() &&
@@ -163,7 +170,14 @@ void DescriptorSetPile::allocate_new_batch() {
     return;
   }
 
-  std::vector<VkDescriptorSetLayout> layouts(descriptors_.size());
+  // Grow the pile by one batch while keeping previously allocated descriptor
+  // sets around, so that reset() can recycle all of them on the next flush
+  // cycle instead of abandoning them in the pool.
+  if (in_use_ >= descriptors_.size()) {
+    descriptors_.resize(descriptors_.size() + pile_size_);
+  }
+
+  std::vector<VkDescriptorSetLayout> layouts(pile_size_);
   fill(layouts.begin(), layouts.end(), set_layout_);
 
   const VkDescriptorSetAllocateInfo allocate_info{
@@ -174,10 +188,8 @@ void DescriptorSetPile::allocate_new_batch() {
       layouts.data(), // pSetLayouts
   };
 
-  VK_CHECK(
-      vkAllocateDescriptorSets(device_, &allocate_info, descriptors_.data()));
-
-  in_use_ = 0u;
+  VK_CHECK(vkAllocateDescriptorSets(
+      device_, &allocate_info, descriptors_.data() + in_use_));
 }
 
 //
@@ -250,8 +262,15 @@ DescriptorSet DescriptorPool::get_descriptor_set(
 }
 
 void DescriptorPool::flush() {
-  VK_CHECK(vkResetDescriptorPool(device_, pool_, 0u));
-  piles_.clear();
+  // Recycle descriptor sets across flushes (i.e. across model invocations)
+  // instead of resetting the pool. Resetting would invalidate every set and
+  // force each pile to re-allocate from scratch on the next invocation;
+  // rewinding the piles keeps the allocated sets around so steady-state
+  // inference allocates no new descriptor sets at all. The caller guarantees
+  // the GPU is idle (see Context::flush), so rewriting the sets is safe.
+  for (auto& pile : piles_) {
+    pile.second.reset();
+  }
 }
 
 } // namespace api
@@ -80,6 +80,7 @@ class DescriptorSetPile final {
 
  public:
   VkDescriptorSet get_descriptor_set();
+  void reset();
 
  private:
   void allocate_new_batch();
@@ -12,6 +12,10 @@ namespace at {
 
 extern const std::string kParamCommsCallName = "record_param_comms";
 
+namespace detail {
+std::atomic<size_t> record_function_callback_count{0};
+} // namespace detail
+
 namespace {
 
 // Used to generate unique callback handles
@@ -172,6 +176,8 @@ class LocalCallbackManager {
   LocalCallbackManager();
 
  public:
+  ~LocalCallbackManager();
+
   const RecordFunctionTLS& getTLS() const;
   StepCallbacks getActiveCallbacks(const RecordScope scope);
   c10::optional<StepCallbacks> getActiveCallbacksUnlessEmpty(const RecordScope scope);
@@ -225,6 +231,7 @@ std::pair<size_t, RecordFunctionCallbacks> GlobalCallbackManager::getSnapshot()
 CallbackHandle GlobalCallbackManager::addCallback(RecordFunctionCallback cb) {
   std::lock_guard<std::mutex> guard(update_mutex_);
   ++version_;
+  ++detail::record_function_callback_count;
   auto handle = next_unique_callback_handle();
   global_callbacks_.emplace_back(std::move(cb), handle);
   return handle;
@@ -249,6 +256,7 @@ void GlobalCallbackManager::removeCallback(CallbackHandle handle) {
   std::lock_guard<std::mutex> guard(update_mutex_);
   if (extractCallback(global_callbacks_, handle).has_value()) {
     ++version_;
+    --detail::record_function_callback_count;
   } else {
     LOG(WARNING) << "Requested callback is not found";
   }
@@ -257,6 +265,7 @@ void GlobalCallbackManager::removeCallback(CallbackHandle handle) {
 void GlobalCallbackManager::clearCallbacks() {
   std::lock_guard<std::mutex> guard(update_mutex_);
   ++version_;
+  detail::record_function_callback_count -= global_callbacks_.size();
   global_callbacks_.clear();
 }
 
@@ -380,6 +389,13 @@ LocalCallbackManager::LocalCallbackManager() {
   rebuild_all(GlobalCallbackManager::get().getSnapshot());
 }
 
+LocalCallbackManager::~LocalCallbackManager() {
+  // Callbacks still registered when the thread exits would otherwise be
+  // counted forever.
+  detail::record_function_callback_count -=
+      registered_callbacks_.sorted_tls_callbacks_.size();
+}
+
 const RecordFunctionTLS& LocalCallbackManager::getTLS() const {
   return registered_callbacks_;
 }
@@ -404,6 +420,10 @@ c10::optional<StepCallbacks> LocalCallbackManager::getActiveCallbacksUnlessEmpty
 }
 
 void LocalCallbackManager::setTLS(const RecordFunctionTLS& tls) {
+  // Modular arithmetic keeps this correct when the new set is smaller.
+  detail::record_function_callback_count +=
+      tls.sorted_tls_callbacks_.size() -
+      registered_callbacks_.sorted_tls_callbacks_.size();
   registered_callbacks_ = tls;
   rebuild_all(GlobalCallbackManager::get().getSnapshot());
 }
@@ -417,6 +437,7 @@ CallbackHandle LocalCallbackManager::addCallback(
   auto handle = next_unique_callback_handle();
   auto& callbacks = registered_callbacks_.sorted_tls_callbacks_;
   callbacks.emplace_back(std::move(callback), handle);
+  ++detail::record_function_callback_count;
   rebuild_callback_scopes(
       GlobalCallbackManager::get().getSnapshot(), callbacks.back().callback_);
   return handle;
@@ -439,6 +460,7 @@ bool LocalCallbackManager::removeCallback(CallbackHandle handle) {
   auto& callbacks = registered_callbacks_.sorted_tls_callbacks_;
   auto callback = extractCallback(callbacks, handle);
   if (callback.has_value()) {
+    --detail::record_function_callback_count;
     rebuild_callback_scopes(
         GlobalCallbackManager::get().getSnapshot(), *callback);
   }
@@ -446,6 +468,8 @@ bool LocalCallbackManager::removeCallback(CallbackHandle handle) {
 }
 
 void LocalCallbackManager::clearCallbacks() {
+  detail::record_function_callback_count -=
+      registered_callbacks_.sorted_tls_callbacks_.size();
   registered_callbacks_.sorted_tls_callbacks_.clear();
   rebuild_all(GlobalCallbackManager::get().getSnapshot());
 }
@@ -610,10 +634,18 @@ c10::optional<c10::FunctionSchema> RecordFunction::operator_schema() const {
 }
 
 StepCallbacks getStepCallbacks(RecordScope scope) {
+  if (C10_LIKELY(!detail::hasAnyRegisteredCallbacks())) {
+    // No callbacks are registered anywhere, so the guard can never become
+    // active; skip the thread local lookup and sampling bookkeeping. The
+    // thread id is only observable from active RecordFunctions, so it need
+    // not be populated here.
+    return StepCallbacks(0, scope);
+  }
   return LocalCallbackManager::get().getActiveCallbacks(scope);
 }
 
-c10::optional<StepCallbacks> getStepCallbacksUnlessEmpty(RecordScope scope) {
+c10::optional<StepCallbacks> getStepCallbacksUnlessEmptySlow(
+    RecordScope scope) {
   return LocalCallbackManager::get().getActiveCallbacksUnlessEmpty(scope);
 }
 
@@ -499,9 +499,33 @@ struct TORCH_API RecordFunction {
 
 TORCH_API StepCallbacks getStepCallbacks(RecordScope scope);
 
-TORCH_API c10::optional<StepCallbacks> getStepCallbacksUnlessEmpty(
+namespace detail {
+// Number of registered RecordFunction callbacks: global callbacks plus the
+// local callbacks of every live thread. Only the zero / nonzero distinction
+// is used: when no callbacks exist anywhere, a single relaxed load is enough
+// to skip the RecordFunction machinery (thread local lookup and sampling
+// bookkeeping) on every op. Updated only on callback (de)registration,
+// which is rare.
+TORCH_API extern std::atomic<size_t> record_function_callback_count;
+
+inline bool hasAnyRegisteredCallbacks() {
+  return record_function_callback_count.load(std::memory_order_relaxed) != 0;
+}
+} // namespace detail
+
+TORCH_API c10::optional<StepCallbacks> getStepCallbacksUnlessEmptySlow(
     RecordScope scope);
 
+// Hot path for op dispatch: with no callbacks registered anywhere this
+// inlines to a relaxed atomic load and a branch.
+inline c10::optional<StepCallbacks> getStepCallbacksUnlessEmpty(
+    RecordScope scope) {
+  if (C10_LIKELY(!detail::hasAnyRegisteredCallbacks())) {
+    return c10::nullopt;
+  }
+  return getStepCallbacksUnlessEmptySlow(scope);
+}
+
 namespace detail {
 template <typename Inputs, typename F, typename... Args>
 void record_function_with_scope(
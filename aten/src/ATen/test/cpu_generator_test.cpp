@@ -210,6 +210,26 @@ TEST(CPUGeneratorImpl, TestPhiloxEngineIndex) {
   ASSERT_NE(engine1(), engine2());
 }
 
+TEST(CPUGeneratorImpl, TestPhiloxEngineInputs) {
+  // Test Description:
+  //   Tests the Philox counter slab reservation on CPUGeneratorImpl.
+  //   Consecutive reservations must hand out disjoint counter ranges,
+  //   and re-seeding the generator must rewind the counter to zero.
+  auto gen = at::detail::createCPUGenerator();
+  auto cpu_gen = check_generator<CPUGeneratorImpl>(gen);
+  auto slab1 = cpu_gen->philox_engine_inputs(4);
+  auto slab2 = cpu_gen->philox_engine_inputs(8);
+  auto slab3 = cpu_gen->philox_engine_inputs(4);
+  ASSERT_EQ(slab1.first, slab2.first);
+  ASSERT_EQ(slab1.second, 0);
+  ASSERT_EQ(slab2.second, 4);
+  ASSERT_EQ(slab3.second, 12);
+  cpu_gen->set_current_seed(123);
+  auto slab4 = cpu_gen->philox_engine_inputs(4);
+  ASSERT_EQ(slab4.first, 123);
+  ASSERT_EQ(slab4.second, 0);
+}
+
 /**
  * MT19937 CPU Engine Tests
  */
@@ -240,3 +240,17 @@ TEST(TensorIteratorTest, CpuKernelMultipleOutputs_##name) {
   EXPECT_TRUE(out2.equal(expected2));                                                               \
 }
 AT_FORALL_SCALAR_TYPES(MULTIPLE_OUTPUTS_TEST_ITER_FOR_TYPE)
+
+// A pooled iterator can be acquired, rebuilt across leases, and still
+// produces correct results; reset() drops tensor references between uses.
+TEST(TensorIteratorTest, PooledIteratorReuse) {
+  auto a = at::randn({5, 5});
+  auto b = at::randn({5, 5});
+  for (int i = 0; i < 3; i++) {
+    Tensor out = at::empty({5, 5});
+    auto pooled = at::PooledTensorIterator::acquire();
+    pooled->build_binary_op(out, a, b);
+    at::native::cpu_kernel(*pooled, [](float x, float y) { return x + y; });
+    EXPECT_TRUE(out.allclose(a + b));
+  }
+}
@@ -2,10 +2,14 @@
 
 #include <ATen/ATen.h>
 #include <ATen/DLConvertor.h>
+#include <ATen/AdaptiveGrainSize.h>
 #include <ATen/Parallel.h>
 #include <ATen/ParallelFuture.h>
+#include <ATen/ThreadLocalState.h>
 
+#include <atomic>
 #include <iostream>
+#include <thread>
 // NOLINTNEXTLINE(modernize-deprecated-headers)
 #include <string.h>
 #include <sstream>
@@ -107,6 +111,42 @@ TEST(TestParallel, Exceptions) {
     std::runtime_error);
 }
 
+TEST(TestParallel, ThreadQuotaGuard) {
+  ASSERT_EQ(at::get_thread_quota(), 0);
+  {
+    at::ThreadQuotaGuard guard(1);
+    ASSERT_EQ(at::get_thread_quota(), 1);
+#if AT_PARALLEL_NATIVE
+    // Fan-out is sized by get_num_threads, so the quota serializes the region
+    ASSERT_EQ(at::get_num_threads(), 1);
+#endif
+    // Work inside the region still covers the whole range
+    std::atomic<int64_t> total{0};
+    at::parallel_for(0, 100, 1, [&](int64_t begin, int64_t end) {
+      total += end - begin;
+#if AT_PARALLEL_NATIVE
+      ASSERT_EQ(at::get_thread_num(), 0);
+#endif
+    });
+    ASSERT_EQ(total.load(), 100);
+  }
+  ASSERT_EQ(at::get_thread_quota(), 0);
+
+  // The quota travels with ThreadLocalState across launched tasks
+  {
+    at::ThreadQuotaGuard guard(2);
+    at::ThreadLocalState state;
+    std::thread t([&state]() {
+      at::ThreadLocalStateGuard state_guard(state);
+      ASSERT_EQ(at::get_thread_quota(), 2);
+    });
+    t.join();
+  }
+
+  // NOLINTNEXTLINE(hicpp-avoid-goto,cppcoreguidelines-avoid-goto)
+  ASSERT_THROW(at::set_thread_quota(-1), c10::Error);
+}
+
 TEST(TestParallel, IntraOpLaunchFuture) {
   int v1 = 0;
   int v2 = 0;
@@ -124,3 +164,30 @@ TEST(TestParallel, IntraOpLaunchFuture) {
 
   ASSERT_TRUE(v1 == 1 && v2 == 2);
 }
+
+TEST(TestParallel, AdaptiveGrainSize) {
+  // NB: keyed by address, so reuse one object rather than repeating the
+  // literal (identical literals need not be pooled).
+  static const char kKey[] = "test_adaptive_fill";
+  std::vector<int> data(1 << 16, 0);
+  // First call calibrates and caches a grain size for this key/bucket.
+  at::parallel_for_adaptive(kKey, 0, (int64_t)data.size(),
+    [&](int64_t begin, int64_t end) {
+      for (int64_t i = begin; i < end; i++) {
+        data[i] += 1;
+      }
+    });
+  ASSERT_TRUE(std::all_of(data.begin(), data.end(), [](int v) { return v == 1; }));
+
+  const auto bucket = at::internal::adaptive_numel_bucket((int64_t)data.size());
+  EXPECT_GT(at::internal::lookup_adaptive_grain_size(kKey, bucket), 0);
+
+  // Second call hits the cache and still covers the whole range.
+  at::parallel_for_adaptive(kKey, 0, (int64_t)data.size(),
+    [&](int64_t begin, int64_t end) {
+      for (int64_t i = begin; i < end; i++) {
+        data[i] += 1;
+      }
+    });
+  EXPECT_TRUE(std::all_of(data.begin(), data.end(), [](int v) { return v == 2; }));
+}
@@ -0,0 +1,144 @@
+"""Trace-driven replay benchmark for the CUDA caching allocator.
+
+Replays an allocation trace recorded with
+``torch.cuda.memory._record_memory_history()`` (saved via
+``torch.cuda.memory._dump_snapshot()``) against the live caching allocator,
+without running any kernels. This makes it cheap to evaluate allocator
+config knobs (``roundup_power2_divisions``, ``expandable_segments``,
+``garbage_collection_threshold``, ...) for a given workload's allocation
+mix: each replay takes seconds instead of re-running the serving job.
+
+Example::
+
+    # in the serving job
+    torch.cuda.memory._record_memory_history()
+    ... run representative traffic ...
+    torch.cuda.memory._dump_snapshot("serving.pickle")
+
+    # offline, on any GPU with enough memory for the trace's peak
+    python allocator_replay.py serving.pickle \
+        --config "" \
+        --config "roundup_power2_divisions:4" \
+        --config "expandable_segments:True" \
+        --config "garbage_collection_threshold:0.8"
+
+For every config it reports peak allocated vs peak reserved bytes, the
+fragmentation at peak (1 - allocated/reserved), and the number of segment
+allocations, i.e. cudaMalloc calls.
+"""
+
+import argparse
+import pickle
+
+import torch
+
+
+def load_events(path, device):
+    with open(path, "rb") as f:
+        snapshot = pickle.load(f)
+    traces = snapshot["device_traces"]
+    if device is None:
+        # Picks the device with the most recorded events.
+        device = max(range(len(traces)), key=lambda i: len(traces[i]))
+    events = traces[device]
+    if not events:
+        raise SystemExit(f"no allocation events recorded for device {device}")
+    return events
+
+
+def replay(events, device):
+    """Replays alloc/free events, returning the number of skipped events.
+
+    Frees arrive as free_requested/free_completed pairs; only the completion
+    changes allocator state, so that is what gets replayed. Allocations that
+    fail (e.g. the replay device is smaller than the recording device) are
+    skipped along with their frees.
+    """
+    live = {}
+    skipped = 0
+    for event in events:
+        action = event["action"]
+        if action == "alloc":
+            try:
+                live[event["addr"]] = torch.cuda.caching_allocator_alloc(
+                    event["size"], device
+                )
+            except RuntimeError:
+                skipped += 1
+        elif action == "free_completed":
+            ptr = live.pop(event["addr"], None)
+            if ptr is not None:
+                torch.cuda.caching_allocator_delete(ptr)
+    # Blocks still live at the end of the trace.
+    for ptr in live.values():
+        torch.cuda.caching_allocator_delete(ptr)
+    return skipped
+
+
+def run_config(events, device, config):
+    if config:
+        torch.cuda.memory._set_allocator_settings(config)
+    torch.cuda.empty_cache()
+    torch.cuda.reset_peak_memory_stats(device)
+    segments_before = torch.cuda.memory_stats(device).get("segment.all.allocated", 0)
+
+    skipped = replay(events, device)
+
+    stats = torch.cuda.memory_stats(device)
+    peak_allocated = stats["allocated_bytes.all.peak"]
+    peak_reserved = stats["reserved_bytes.all.peak"]
+    fragmentation = (
+        1.0 - peak_allocated / peak_reserved if peak_reserved else 0.0
+    )
+    return {
+        "config": config or "<default>",
+        "peak_allocated_mb": peak_allocated / (1024 * 1024),
+        "peak_reserved_mb": peak_reserved / (1024 * 1024),
+        "fragmentation": fragmentation,
+        "cuda_mallocs": stats.get("segment.all.allocated", 0) - segments_before,
+        "alloc_retries": stats.get("num_alloc_retries", 0),
+        "skipped_events": skipped,
+    }
+
+
+def main():
+    parser = argparse.ArgumentParser(
+        description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter
+    )
+    parser.add_argument("trace", help="snapshot pickle from _dump_snapshot()")
+    parser.add_argument(
+        "--device", type=int, default=None, help="trace device index to replay"
+    )
+    parser.add_argument(
+        "--config",
+        action="append",
+        default=[],
+        help="PYTORCH_CUDA_ALLOC_CONF string to evaluate; repeatable. "
+        'An empty string ("") replays with the current settings.',
+    )
+    args = parser.parse_args()
+
+    events = load_events(args.trace, args.device)
+    device = torch.cuda.current_device()
+    configs = args.config or [""]
+
+    header = (
+        f"{'config':<45} {'peak alloc (MB)':>16} {'peak resv (MB)':>15} "
+        f"{'frag':>6} {'cudaMallocs':>12} {'retries':>8}"
+    )
+    print(f"replaying {len(events)} events on device {device}")
+    print(header)
+    print("-" * len(header))
+    for config in configs:
+        result = run_config(events, device, config)
+        print(
+            f"{result['config']:<45} {result['peak_allocated_mb']:>16.1f} "
+            f"{result['peak_reserved_mb']:>15.1f} {result['fragmentation']:>6.3f} "
+            f"{result['cuda_mallocs']:>12} {result['alloc_retries']:>8}"
+        )
+        if result["skipped_events"]:
+            print(f"  warning: skipped {result['skipped_events']} failed allocations")
+
+
+if __name__ == "__main__":
+    main()
@@ -27,6 +27,7 @@ from pt import (  # noqa: F401  # noqa: F401
     split_test,
     sum_test,
     tensor_to_test,
+    transpose_copy_test,
 )
 
 import operator_benchmark as op_bench
@@ -146,6 +146,16 @@ embeddingbag_short_configs = op_bench.cross_product_configs(
     tags=["short"],
 )
 
+embeddingbag_index_dtype_configs = op_bench.cross_product_configs(
+    embeddingbags=[1000, 100000],
+    dim=[64, 256],
+    mode=["sum"],
+    input_size=[1024, 16384],
+    index_dtype=["int32", "int64"],
+    device=["cpu"],
+    tags=["short"],
+)
+
 embedding_short_configs = op_bench.cross_product_configs(
     num_embeddings=[10, 120, 1000, 2300],
     embedding_dim=[64],
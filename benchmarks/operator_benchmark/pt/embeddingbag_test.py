@@ -49,6 +49,40 @@ op_bench.generate_pt_gradient_test(
 )
 
 
+class EmbeddingBagIndexDtypeBenchmark(op_bench.TorchBenchmarkBase):
+    """Compares gather bandwidth for int32- vs int64-indexed tables.
+
+    Indices and offsets share the index dtype, so the native kernels run
+    without any promotion copy."""
+
+    def init(self, embeddingbags, dim, mode, input_size, index_dtype, device):
+        self.embedding = torch.nn.EmbeddingBag(
+            num_embeddings=embeddingbags,
+            embedding_dim=dim,
+            mode=mode,
+            include_last_offset=True,
+        ).to(device=device)
+        numpy.random.seed((1 << 32) - 1)
+        dtype = torch.int32 if index_dtype == "int32" else torch.int64
+        input = torch.tensor(
+            numpy.random.randint(0, embeddingbags, input_size),
+            device=device,
+            dtype=dtype,
+        )
+        bag_size = 64
+        offset = torch.arange(0, input.numel() + 1, bag_size, dtype=dtype, device=device)
+        self.inputs = {"input": input, "offset": offset}
+        self.set_module_name("embeddingbag_index_dtype")
+
+    def forward(self, input, offset):
+        return self.embedding(input, offset)
+
+
+op_bench.generate_pt_test(
+    configs.embeddingbag_index_dtype_configs, EmbeddingBagIndexDtypeBenchmark
+)
+
+
 class EmbeddingBenchmark(op_bench.TorchBenchmarkBase):
     def init(self, num_embeddings, embedding_dim, input_size, device):
         self.embedding = torch.nn.Embedding(
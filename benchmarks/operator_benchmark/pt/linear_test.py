@@ -24,5 +24,30 @@ op_bench.generate_pt_test(
 )
 
 
+linear_reduced_precision_configs = op_bench.cross_product_configs(
+    N=[16, 64],
+    IN=[256, 1024],
+    OUT=[256, 1024],
+    device=["cpu"],
+    dtype=[torch.bfloat16, torch.half],
+    tags=["short"],
+)
+
+
+class LinearReducedPrecisionBenchmark(op_bench.TorchBenchmarkBase):
+    def init(self, N, IN, OUT, device, dtype):
+        self.inputs = {"input_one": torch.rand(N, IN, device=device).to(dtype=dtype)}
+        self.linear = nn.Linear(IN, OUT).to(device=device).to(dtype=dtype)
+        self.set_module_name("linear_reduced_precision")
+
+    def forward(self, input_one):
+        return self.linear(input_one)
+
+
+op_bench.generate_pt_test(
+    linear_reduced_precision_configs, LinearReducedPrecisionBenchmark
+)
+
+
 if __name__ == "__main__":
     op_bench.benchmark_runner.main()
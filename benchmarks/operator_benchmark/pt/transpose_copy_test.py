@@ -0,0 +1,54 @@
+import torch
+
+import operator_benchmark as op_bench
+
+
+"""Microbenchmarks for materializing transposed tensors via contiguous()."""
+
+
+# Configs for transposed contiguous() copies
+transpose_copy_long_configs = op_bench.cross_product_configs(
+    B=[1, 8],
+    M=[1024, 4096],
+    N=[1024, 4096],
+    dtype=[torch.float, torch.bfloat16, torch.uint8],
+    tags=["long"],
+)
+
+
+transpose_copy_short_configs = op_bench.config_list(
+    attr_names=["B", "M", "N"],
+    attrs=[
+        [1, 128, 128],
+        [1, 1024, 1024],
+        [8, 512, 512],
+    ],
+    cross_product_configs={
+        "dtype": [torch.float],
+    },
+    tags=["short"],
+)
+
+
+class TransposeCopyBenchmark(op_bench.TorchBenchmarkBase):
+    def init(self, B, M, N, dtype):
+        # input is contiguous once its last two dims are swapped, which is
+        # the pattern the blocked transpose copy kernel handles
+        input_data = (
+            torch.randn(B, N, M).to(dtype=dtype).transpose(-2, -1).squeeze(0)
+        )
+        self.inputs = {"input_data": input_data}
+        self.set_module_name("transpose_copy")
+
+    def forward(self, input_data):
+        return input_data.contiguous()
+
+
+op_bench.generate_pt_test(
+    transpose_copy_short_configs + transpose_copy_long_configs,
+    TransposeCopyBenchmark,
+)
+
+
+if __name__ == "__main__":
+    op_bench.benchmark_runner.main()
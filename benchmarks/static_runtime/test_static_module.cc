@@ -653,6 +653,40 @@ TEST(StaticRuntime, CleanUpMemory) {
   }
 }
 
+TEST(StaticRuntime, ShapePlanCache) {
+  const int embedding_size = 32;
+  const int num_features = 50;
+  torch::jit::Module mod = getDeepAndWideSciptModel();
+
+  torch::jit::StaticModuleOptions opts;
+  opts.enable_shape_plan_cache = true;
+  torch::jit::StaticModule smod(mod, false, opts);
+  torch::jit::StaticRuntime runtime(smod);
+
+  // Oscillate between batch-size buckets; each bucket should keep its own
+  // memory plan once it has been seen.
+  for (int batch_size : {1, 8, 128, 8, 1, 128, 100}) {
+    for (int i = 0; i < 2; ++i) {
+      auto ad_emb_packed = torch::randn({batch_size, 1, embedding_size});
+      auto user_emb = torch::randn({batch_size, 1, embedding_size});
+      auto wide = torch::randn({batch_size, num_features});
+
+      // run jit graph executor
+      std::vector<at::IValue> inputs({ad_emb_packed, user_emb, wide});
+      auto output_1 = getTensor(mod.forward(inputs));
+
+      // run static runtime
+      std::vector<c10::IValue> input_tensors({ad_emb_packed, user_emb, wide});
+      auto outputs = runtime(input_tensors, {}).toTupleRef().elements();
+      ASSERT_TRUE(outputs.size() > 0);
+      auto output_2 = outputs[0].toTensor();
+      runtime.check_for_memory_leak();
+      EXPECT_TRUE(torch::allclose(
+          output_1, output_2, /*rtol=*/1e-5, /*atol=*/1e-5));
+    }
+  }
+}
+
 TEST(StaticRuntime, ManageOutputTensors) {
   const std::string test_graph = R"IR(
     graph(%0 : Tensor):
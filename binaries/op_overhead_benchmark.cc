@@ -0,0 +1,237 @@
+// Microbenchmark for fixed framework overheads: operator dispatch,
+// TensorIterator setup and RecordFunction, measured in wall time and -
+// on Linux - hardware instruction and cache-miss counts read through
+// perf_event_open. The instruction counts are deterministic enough to gate
+// upgrades on: pass --max_*_instructions thresholds and the binary exits
+// non-zero when a benchmark regresses past its threshold.
+
+#include <torch/torch.h>
+#include <ATen/TensorIterator.h>
+#include <ATen/record_function.h>
+
+#include "c10/util/Flags.h"
+
+#include <chrono>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#if defined(__linux__)
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#include <cstring>
+#endif
+
+C10_DEFINE_int(iter, 100000, "Number of measured iterations per benchmark");
+C10_DEFINE_int(warmup_iter, 1000, "Number of warmup iterations per benchmark");
+C10_DEFINE_double(
+    max_dispatch_instructions,
+    0.0,
+    "If > 0, fail when the dispatch benchmark exceeds this many instructions per call");
+C10_DEFINE_double(
+    max_iterator_instructions,
+    0.0,
+    "If > 0, fail when the TensorIterator benchmark exceeds this many instructions per call");
+C10_DEFINE_double(
+    max_record_function_instructions,
+    0.0,
+    "If > 0, fail when the RecordFunction benchmark exceeds this many instructions per call");
+C10_DEFINE_double(
+    max_small_add_instructions,
+    0.0,
+    "If > 0, fail when the small add benchmark exceeds this many instructions per call");
+
+namespace {
+
+#if defined(__linux__)
+// A single hardware perf counter for the calling thread, userspace only.
+class PerfCounter {
+ public:
+  explicit PerfCounter(uint64_t config) {
+    perf_event_attr attr;
+    memset(&attr, 0, sizeof(attr));
+    attr.type = PERF_TYPE_HARDWARE;
+    attr.size = sizeof(attr);
+    attr.config = config;
+    attr.disabled = 1;
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+    fd_ = syscall(__NR_perf_event_open, &attr, 0, -1, -1, 0);
+  }
+  PerfCounter(const PerfCounter&) = delete;
+  PerfCounter& operator=(const PerfCounter&) = delete;
+  ~PerfCounter() {
+    if (valid()) {
+      close(fd_);
+    }
+  }
+
+  bool valid() const {
+    return fd_ >= 0;
+  }
+
+  void start() {
+    if (valid()) {
+      ioctl(fd_, PERF_EVENT_IOC_RESET, 0);
+      ioctl(fd_, PERF_EVENT_IOC_ENABLE, 0);
+    }
+  }
+
+  int64_t stop() {
+    if (!valid()) {
+      return -1;
+    }
+    ioctl(fd_, PERF_EVENT_IOC_DISABLE, 0);
+    int64_t value = -1;
+    if (read(fd_, &value, sizeof(value)) != sizeof(value)) {
+      return -1;
+    }
+    return value;
+  }
+
+ private:
+  int fd_ = -1;
+};
+#endif
+
+struct BenchResult {
+  double us_per_iter = 0;
+  // -1 when the counter could not be read (non-Linux, or perf_event_open
+  // not permitted).
+  double instructions_per_iter = -1;
+  double cache_misses_per_iter = -1;
+};
+
+template <typename F>
+BenchResult runBench(const F& fn, int iter, int warmup_iter) {
+  for (int idx = 0; idx < warmup_iter; ++idx) {
+    fn();
+  }
+
+#if defined(__linux__)
+  PerfCounter instructions(PERF_COUNT_HW_INSTRUCTIONS);
+  PerfCounter cache_misses(PERF_COUNT_HW_CACHE_MISSES);
+  instructions.start();
+  cache_misses.start();
+#endif
+  typedef std::chrono::high_resolution_clock clock;
+  typedef std::chrono::microseconds us;
+  std::chrono::time_point<clock> start_time = clock::now();
+  for (int idx = 0; idx < iter; ++idx) {
+    fn();
+  }
+  auto duration = static_cast<double>(
+      std::chrono::duration_cast<us>(clock::now() - start_time).count());
+
+  BenchResult result;
+  result.us_per_iter = duration / iter;
+#if defined(__linux__)
+  const auto insns = instructions.stop();
+  const auto misses = cache_misses.stop();
+  if (insns >= 0) {
+    result.instructions_per_iter = static_cast<double>(insns) / iter;
+  }
+  if (misses >= 0) {
+    result.cache_misses_per_iter = static_cast<double>(misses) / iter;
+  }
+#endif
+  return result;
+}
+
+bool checkThreshold(
+    const std::string& name,
+    const BenchResult& result,
+    double max_instructions) {
+  std::cout << name << ": " << result.us_per_iter << " us/iter";
+  if (result.instructions_per_iter >= 0) {
+    std::cout << ", " << result.instructions_per_iter << " instructions/iter"
+              << ", " << result.cache_misses_per_iter
+              << " cache misses/iter";
+  }
+  std::cout << std::endl;
+
+  if (max_instructions <= 0) {
+    return true;
+  }
+  if (result.instructions_per_iter < 0) {
+    std::cout << "  WARNING: threshold set but perf counters unavailable"
+              << std::endl;
+    return true;
+  }
+  if (result.instructions_per_iter > max_instructions) {
+    std::cout << "  FAIL: " << result.instructions_per_iter
+              << " instructions/iter exceeds threshold " << max_instructions
+              << std::endl;
+    return false;
+  }
+  return true;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+  if (!c10::ParseCommandLineFlags(&argc, &argv)) {
+    std::cout << "Failed to parse command line flags" << std::endl;
+    return -1;
+  }
+
+  // Keeps the measured loops single-threaded and deterministic.
+  at::set_num_threads(1);
+
+  auto a = torch::ones({1});
+  auto b = torch::ones({1});
+  auto out = torch::empty({1});
+
+  // Dispatcher round trip through an op whose kernel does almost nothing.
+  auto dispatch_result = runBench(
+      [&]() { at::_debug_has_internal_overlap(a); },
+      FLAGS_iter,
+      FLAGS_warmup_iter);
+
+  // TensorIterator construction only; no kernel runs.
+  auto iterator_result = runBench(
+      [&]() { auto iter = at::TensorIterator::binary_op(out, a, b); },
+      FLAGS_iter,
+      FLAGS_warmup_iter);
+
+  // RecordFunction machinery with no observers registered, the state every
+  // op call pays for.
+  auto record_function_result = runBench(
+      []() {
+        auto step_callbacks =
+            at::getStepCallbacksUnlessEmpty(at::RecordScope::FUNCTION);
+        if (step_callbacks.has_value()) {
+          at::RecordFunction guard(std::move(*step_callbacks));
+          guard.before("Test", -1);
+        }
+      },
+      FLAGS_iter,
+      FLAGS_warmup_iter);
+
+  // End-to-end fixed cost of a 1-element op: dispatch, TensorIterator and
+  // kernel launch together.
+  auto small_add_result = runBench(
+      [&]() { at::add_out(out, a, b); }, FLAGS_iter, FLAGS_warmup_iter);
+
+  bool ok = true;
+  ok &= checkThreshold(
+      "dispatch (_debug_has_internal_overlap)",
+      dispatch_result,
+      FLAGS_max_dispatch_instructions);
+  ok &= checkThreshold(
+      "TensorIterator setup (binary_op)",
+      iterator_result,
+      FLAGS_max_iterator_instructions);
+  ok &= checkThreshold(
+      "RecordFunction (no observers)",
+      record_function_result,
+      FLAGS_max_record_function_instructions);
+  ok &= checkThreshold(
+      "small add (add_out, 1 element)",
+      small_add_result,
+      FLAGS_max_small_add_instructions);
+
+  return ok ? 0 : 1;
+}
@@ -98,8 +98,10 @@ libtorch_profiler_sources = [
     "torch/csrc/autograd/profiler_kineto.cpp",
     "torch/csrc/profiler/collection.cpp",
     "torch/csrc/profiler/data_flow.cpp",
+    "torch/csrc/profiler/interning.cpp",
     "torch/csrc/profiler/kineto_shim.cpp",
     "torch/csrc/profiler/kineto_client_interface.cpp",
+    "torch/csrc/profiler/op_stats.cpp",
     "torch/csrc/profiler/orchestration/observer.cpp",
     "torch/csrc/profiler/orchestration/python_tracer.cpp",
     "torch/csrc/profiler/standalone/execution_trace_observer.cpp",
@@ -127,8 +129,10 @@ core_trainer_sources = [
     "torch/csrc/autograd/input_metadata.cpp",
     "torch/csrc/autograd/functions/accumulate_grad.cpp",
     "torch/csrc/autograd/functions/basic_ops.cpp",
+    "torch/csrc/autograd/functions/checkpoint.cpp",
     "torch/csrc/autograd/functions/tensor.cpp",
     "torch/csrc/autograd/functions/utils.cpp",
+    "torch/csrc/autograd/activation_offload.cpp",
     "torch/csrc/autograd/input_buffer.cpp",
     "torch/csrc/autograd/record_function_ops.cpp",
     "torch/csrc/autograd/saved_variable.cpp",
@@ -148,6 +152,7 @@ torch_mobile_core = [
     # TODO: Remove this dependency
     "torch/csrc/jit/backends/backend_debug_info.cpp",
     "torch/csrc/jit/mobile/compatibility/model_compatibility.cpp",
+    "torch/csrc/jit/mobile/direct_ops.cpp",
     "torch/csrc/jit/mobile/function.cpp",
     "torch/csrc/jit/mobile/import.cpp",
     "torch/csrc/jit/mobile/flatbuffer_loader.cpp",
@@ -247,8 +252,11 @@ core_sources_full_mobile_no_backend_interface_xplat = [
     "torch/csrc/jit/passes/loop_unrolling.cpp",
     "torch/csrc/jit/passes/lower_grad_of.cpp",
     "torch/csrc/jit/passes/lower_tuples.cpp",
+    "torch/csrc/jit/passes/memory_planning.cpp",
     "torch/csrc/jit/passes/normalize_ops.cpp",
+    "torch/csrc/jit/passes/parallelize_independent_subgraphs.cpp",
     "torch/csrc/jit/passes/peephole_dict_idioms.cpp",
+    "torch/csrc/jit/passes/reorder_for_locality.cpp",
     "torch/csrc/jit/passes/peephole_list_idioms.cpp",
     "torch/csrc/jit/passes/value_refinement_utils.cpp",
     "torch/csrc/jit/passes/peephole_alias_sensitive.cpp",
@@ -263,11 +271,13 @@ core_sources_full_mobile_no_backend_interface_xplat = [
     "torch/csrc/jit/passes/fold_linear_bn.cpp",
     "torch/csrc/jit/passes/dbr_quantization/remove_redundant_aliases.cpp",
     "torch/csrc/jit/passes/frozen_concat_linear.cpp",
+    "torch/csrc/jit/passes/frozen_constant_dedup.cpp",
     "torch/csrc/jit/passes/frozen_conv_add_relu_fusion.cpp",
     "torch/csrc/jit/passes/frozen_conv_folding.cpp",
     "torch/csrc/jit/passes/frozen_linear_folding.cpp",
     "torch/csrc/jit/passes/frozen_linear_transpose.cpp",
     "torch/csrc/jit/passes/frozen_ops_to_mkldnn.cpp",
+    "torch/csrc/jit/passes/frozen_weight_layouts.cpp",
     "torch/csrc/jit/passes/frozen_graph_optimizations.cpp",
     "torch/csrc/jit/passes/remove_expands.cpp",
     "torch/csrc/jit/passes/remove_dropout.cpp",
@@ -304,6 +314,7 @@ core_sources_full_mobile_no_backend_interface_xplat = [
     "torch/csrc/jit/runtime/argument_spec.cpp",
     "torch/csrc/jit/runtime/autodiff.cpp",
     "torch/csrc/jit/runtime/graph_executor.cpp",
+    "torch/csrc/jit/runtime/inference_session.cpp",
     "torch/csrc/jit/runtime/interpreter/frame.cpp",
     "torch/csrc/jit/runtime/interpreter/preprocess_graph.cpp",
     "torch/csrc/jit/runtime/interpreter.cpp",
@@ -320,6 +331,7 @@ core_sources_full_mobile_no_backend_interface_xplat = [
     "torch/csrc/jit/runtime/symbolic_shape_registry_util.cpp",
     "torch/csrc/jit/runtime/jit_trace.cpp",
     "torch/csrc/jit/serialization/callstack_debug_info_serialization.cpp",
+    "torch/csrc/jit/serialization/constant_dedup.cpp",
     "torch/csrc/jit/serialization/import.cpp",
     "torch/csrc/jit/serialization/import_export_helpers.cpp",
     "torch/csrc/jit/serialization/import_source.cpp",
@@ -383,6 +395,7 @@ core_sources_full_mobile_no_backend_interface = core_sources_full_mobile_no_back
     # TODO: Remove this dependency
     "torch/csrc/jit/backends/backend_debug_info.cpp",
     "torch/csrc/jit/mobile/compatibility/model_compatibility.cpp",
+    "torch/csrc/jit/mobile/direct_ops.cpp",
     "torch/csrc/jit/mobile/function.cpp",
     "torch/csrc/jit/mobile/import.cpp",
     "torch/csrc/jit/mobile/flatbuffer_loader.cpp",
@@ -421,6 +434,7 @@ lazy_tensor_core_sources = [
     "torch/csrc/lazy/core/config.cpp",
     "torch/csrc/lazy/core/debug_util.cpp",
     "torch/csrc/lazy/core/hash.cpp",
+    "torch/csrc/lazy/core/hash_cons.cpp",
     "torch/csrc/lazy/core/helpers.cpp",
     "torch/csrc/lazy/core/ir.cpp",
     "torch/csrc/lazy/core/ir_dump_util.cpp",
@@ -618,6 +632,7 @@ libtorch_extra_sources = libtorch_core_jit_sources + [
     # To be included for eager symbolication in lite interpreter
     # when it is built in libtorch
     "torch/csrc/jit/mobile/debug_info.cpp",
+    "torch/csrc/jit/mobile/direct_ops.cpp",
     "torch/csrc/jit/mobile/function.cpp",
     "torch/csrc/jit/mobile/flatbuffer_loader.cpp",
     "torch/csrc/jit/mobile/import.cpp",
@@ -652,6 +667,7 @@ libtorch_cuda_core_sources = [
     "torch/csrc/CudaIPCTypes.cpp",
     "torch/csrc/cuda/comm.cpp",
     "torch/csrc/cuda/memory_snapshot.cpp",
+    "torch/csrc/cuda/memory_watermarks.cpp",
     "torch/csrc/inductor/aoti_model_container_runner_cuda.cpp",
     "torch/csrc/inductor/aoti_torch/shim_cuda.cpp",
     "torch/csrc/jit/codegen/fuser/cuda/fused_kernel.cpp",
@@ -659,6 +675,8 @@ libtorch_cuda_core_sources = [
     "torch/csrc/autograd/functions/comm.cpp",
     "torch/csrc/jit/passes/frozen_conv_add_relu_fusion_cuda.cpp",
     "torch/csrc/jit/tensorexpr/cuda_codegen.cpp",
+    "torch/csrc/jit/runtime/allocation_hints_cuda.cpp",
+    "torch/csrc/jit/runtime/inference_session_cuda.cpp",
     "torch/csrc/jit/runtime/register_cuda_ops.cpp",
 ]
 
@@ -686,6 +704,7 @@ libtorch_cuda_sources = libtorch_cuda_core_sources + libtorch_cuda_distributed_s
 
 torch_cpp_srcs = [
     "torch/csrc/api/src/cuda.cpp",  # this just forwards stuff, no real CUDA
+    "torch/csrc/api/src/data/datasets/csv.cpp",
     "torch/csrc/api/src/data/datasets/mnist.cpp",
     "torch/csrc/api/src/data/samplers/distributed.cpp",
     "torch/csrc/api/src/data/samplers/random.cpp",
@@ -1249,6 +1268,7 @@ aten_native_source_non_codegen_list = [
     "aten/src/ATen/native/Distance.cpp",
     "aten/src/ATen/native/Distributions.cpp",
     "aten/src/ATen/native/Dropout.cpp",
+    "aten/src/ATen/native/ElementwiseChainFusion.cpp",
     "aten/src/ATen/native/Embedding.cpp",
     "aten/src/ATen/native/EmbeddingBag.cpp",
     "aten/src/ATen/native/Fill.cpp",
@@ -1260,6 +1280,7 @@ aten_native_source_non_codegen_list = [
     "aten/src/ATen/native/GridSampler.cpp",
     "aten/src/ATen/native/Histogram.cpp",
     "aten/src/ATen/native/Im2Col.cpp",
+    "aten/src/ATen/native/ImagePreprocess.cpp",
     "aten/src/ATen/native/IndexingUtils.cpp",
     "aten/src/ATen/native/Integration.cpp",
     "aten/src/ATen/native/Itertools.cpp",
@@ -1307,6 +1328,7 @@ aten_native_source_non_codegen_list = [
     "aten/src/ATen/native/Sorting.cpp",
     "aten/src/ATen/native/SparseTensorUtils.cpp",
     "aten/src/ATen/native/SpectralOps.cpp",
+    "aten/src/ATen/native/StochasticRounding.cpp",
     "aten/src/ATen/native/SummaryOps.cpp",
     "aten/src/ATen/native/TensorAdvancedIndexing.cpp",
     "aten/src/ATen/native/TensorCompare.cpp",
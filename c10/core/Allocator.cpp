@@ -19,6 +19,22 @@ at::DataPtr InefficientStdFunctionContext::makeDataPtr(
       device};
 }
 
+DataPtr Allocator::clone(const void* data, std::size_t n) const {
+  DataPtr new_data = allocate(n);
+  copy_data(new_data.mutable_get(), data, n);
+  return new_data;
+}
+
+void Allocator::copy_data(
+    void* dest,
+    const void* src,
+    std::size_t count) const {
+  TORCH_CHECK(
+      false,
+      "This allocator does not support cloning data, which is needed to "
+      "materialize a lazily cloned (copy-on-write) storage");
+}
+
 // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables,modernize-avoid-c-arrays,cppcoreguidelines-avoid-c-arrays)
 C10_API at::Allocator* allocator_array[at::COMPILE_TIME_MAX_DEVICE_TYPES];
 // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables,modernize-avoid-c-arrays,cppcoreguidelines-avoid-c-arrays)
@@ -165,6 +165,14 @@ struct C10_API Allocator {
   virtual DeleterFnPtr raw_deleter() const {
     return nullptr;
   }
+
+  // Clones the n bytes at data into a freshly allocated buffer. Used to
+  // materialize copy-on-write storages (see c10/core/impl/cow/COW.h).
+  DataPtr clone(const void* data, std::size_t n) const;
+
+  // Device-appropriate memcpy used by clone(). The base implementation
+  // throws; allocators whose storages can be lazily cloned must override it.
+  virtual void copy_data(void* dest, const void* src, std::size_t count) const;
   void* raw_allocate(size_t n) {
     auto dptr = allocate(n);
     AT_ASSERT(dptr.get() == dptr.get_context());
@@ -0,0 +1,79 @@
+#include <c10/core/CPUAllocationArena.h>
+
+#include <c10/core/CPUAllocator.h>
+#include <c10/core/alignment.h>
+#include <c10/core/impl/alloc_cpu.h>
+#include <c10/util/Exception.h>
+
+namespace c10 {
+
+namespace {
+
+thread_local CPUAllocationArena* thread_arena = nullptr;
+
+inline size_t align_up(size_t nbytes) {
+  return (nbytes + gAlignment - 1) & ~(gAlignment - 1);
+}
+
+} // namespace
+
+CPUAllocationArena::CPUAllocationArena(size_t slab_bytes)
+    : slab_bytes_(align_up(slab_bytes)) {}
+
+CPUAllocationArena::~CPUAllocationArena() {
+  for (void* slab : slabs_) {
+    free_cpu(slab);
+  }
+}
+
+void* CPUAllocationArena::bump(size_t nbytes) const {
+  nbytes = align_up(nbytes);
+  if (C10_UNLIKELY(nbytes > remaining_)) {
+    // Oversized requests get a dedicated slab so they don't strand the
+    // remainder of the current one.
+    if (nbytes > slab_bytes_) {
+      void* slab = alloc_cpu(nbytes);
+      slabs_.push_back(slab);
+      allocated_bytes_ += nbytes;
+      return slab;
+    }
+    void* slab = alloc_cpu(slab_bytes_);
+    slabs_.push_back(slab);
+    cur_ = static_cast<char*>(slab);
+    remaining_ = slab_bytes_;
+  }
+  void* result = cur_;
+  cur_ += nbytes;
+  remaining_ -= nbytes;
+  allocated_bytes_ += nbytes;
+  return result;
+}
+
+at::DataPtr CPUAllocationArena::allocate(size_t nbytes) const {
+  if (nbytes == 0) {
+    return {nullptr, nullptr, &NoDelete, at::Device(at::DeviceType::CPU)};
+  }
+  void* data = bump(nbytes);
+  // The arena reclaims everything on destruction; per-allocation free is a
+  // no-op by design.
+  return {data, data, &NoDelete, at::Device(at::DeviceType::CPU)};
+}
+
+at::DeleterFnPtr CPUAllocationArena::raw_deleter() const {
+  return &NoDelete;
+}
+
+CPUAllocationArenaGuard::CPUAllocationArenaGuard(CPUAllocationArena* arena)
+    : prev_(thread_arena) {
+  thread_arena = arena;
+}
+
+CPUAllocationArenaGuard::~CPUAllocationArenaGuard() {
+  thread_arena = prev_;
+}
+
+CPUAllocationArena* ThreadLocalCPUAllocationArena() {
+  return thread_arena;
+}
+
+} // namespace c10
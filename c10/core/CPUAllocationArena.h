@@ -0,0 +1,75 @@
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+#include <c10/core/Allocator.h>
+#include <c10/macros/Export.h>
+
+namespace c10 {
+
+// A bump-pointer region allocator for short-lived CPU tensors.
+//
+// Request-scoped inference workloads allocate hundreds of intermediates and
+// free them all at request end; routing those through malloc/free per tensor
+// is measurable latency. A CPUAllocationArena hands out allocations from
+// large slabs with a bump pointer and frees every slab at once when the arena
+// is destroyed. Individual DataPtr deleters are no-ops.
+//
+// Contract: allocations made from an arena must not be used after the arena
+// is destroyed. The intended usage is a per-request arena whose lifetime
+// encloses all tensors produced within the request:
+//
+//   {
+//     c10::CPUAllocationArena arena;
+//     c10::CPUAllocationArenaGuard guard(&arena);
+//     ... run the request; all CPU tensor allocations come from the arena ...
+//   }  // guard pops; arena destruction releases everything in one shot
+//
+// The guard installs the arena as a thread-local override consulted by
+// c10::GetCPUAllocator(), so the swap only affects the current thread and
+// nests correctly.
+class C10_API CPUAllocationArena final : public at::Allocator {
+ public:
+  static constexpr size_t kDefaultSlabBytes = 1ULL << 22; // 4 MiB
+
+  explicit CPUAllocationArena(size_t slab_bytes = kDefaultSlabBytes);
+  CPUAllocationArena(const CPUAllocationArena&) = delete;
+  CPUAllocationArena& operator=(const CPUAllocationArena&) = delete;
+  ~CPUAllocationArena() override;
+
+  at::DataPtr allocate(size_t nbytes) const override;
+  at::DeleterFnPtr raw_deleter() const override;
+
+  // Total bytes handed out since construction (for diagnostics).
+  size_t allocated_bytes() const {
+    return allocated_bytes_;
+  }
+
+ private:
+  void* bump(size_t nbytes) const;
+
+  size_t slab_bytes_;
+  mutable std::vector<void*> slabs_;
+  mutable char* cur_ = nullptr;
+  mutable size_t remaining_ = 0;
+  mutable size_t allocated_bytes_ = 0;
+};
+
+// RAII guard that makes `arena` the CPU allocator for the current thread.
+// Nested guards restore the previous override on destruction.
+class C10_API CPUAllocationArenaGuard final {
+ public:
+  explicit CPUAllocationArenaGuard(CPUAllocationArena* arena);
+  CPUAllocationArenaGuard(const CPUAllocationArenaGuard&) = delete;
+  CPUAllocationArenaGuard& operator=(const CPUAllocationArenaGuard&) = delete;
+  ~CPUAllocationArenaGuard();
+
+ private:
+  CPUAllocationArena* prev_;
+};
+
+// Returns the arena installed on the current thread, or nullptr.
+C10_API CPUAllocationArena* ThreadLocalCPUAllocationArena();
+
+} // namespace c10
@@ -1,4 +1,5 @@
 #include <c10/core/Allocator.h>
+#include <c10/core/CPUAllocationArena.h>
 #include <c10/core/CPUAllocator.h>
 #include <c10/core/DeviceType.h>
 #include <c10/core/alignment.h>
@@ -7,6 +8,8 @@
 #include <c10/mobile/CPUProfilingAllocator.h>
 #include <c10/util/Logging.h>
 
+#include <cstring>
+
 // TODO: rename flag to C10
 C10_DEFINE_bool(
     caffe2_report_cpu_memory_usage,
@@ -40,6 +43,10 @@ struct C10_API DefaultCPUAllocator final : at::Allocator {
   at::DeleterFnPtr raw_deleter() const override {
     return &ReportAndDelete;
   }
+
+  void copy_data(void* dest, const void* src, std::size_t count) const override {
+    std::memcpy(dest, src, count);
+  }
 };
 
 ProfiledCPUMemoryReporter& profiledCPUMemoryReporter() {
@@ -142,11 +149,20 @@ class DefaultMobileCPUAllocator final : public at::Allocator {
   DeleterFnPtr raw_deleter() const override {
     return deleter;
   }
+
+  void copy_data(void* dest, const void* src, std::size_t count) const override {
+    std::memcpy(dest, src, count);
+  }
 };
 
 void NoDelete(void*) {}
 
 at::Allocator* GetCPUAllocator() {
+  // A thread-local arena installed via CPUAllocationArenaGuard overrides the
+  // process-wide CPU allocator for the current thread; see CPUAllocationArena.h.
+  if (C10_UNLIKELY(ThreadLocalCPUAllocationArena() != nullptr)) {
+    return ThreadLocalCPUAllocationArena();
+  }
   return GetAllocator(DeviceType::CPU);
 }
 
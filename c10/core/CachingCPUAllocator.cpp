@@ -0,0 +1,262 @@
+#include <c10/core/CachingCPUAllocator.h>
+
+#include <c10/core/CPUAllocator.h>
+#include <c10/core/alignment.h>
+#include <c10/core/impl/alloc_cpu.h>
+#include <c10/util/Exception.h>
+#include <c10/util/irange.h>
+#include <c10/util/llvmMathExtras.h>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstring>
+#include <mutex>
+#include <vector>
+
+namespace c10 {
+namespace caching_cpu_allocator {
+
+namespace {
+
+// Cached sizes span [512B, 64MB] in power-of-two classes. The block header
+// that records the size class lives in the gAlignment-sized slack we request
+// on top of the rounded size, so user data stays max-aligned.
+constexpr size_t kMinBlockSize = 512;
+constexpr size_t kMaxCachedSize = 64ULL * 1024 * 1024;
+constexpr size_t kNumSizeClasses = 18; // log2(64MB) - log2(512B) + 1
+// Per-thread cap per size class before spilling to the global pool.
+constexpr size_t kMaxBlocksPerThreadClass = 8;
+
+struct BlockHeader {
+  uint32_t size_class;
+  uint32_t cached; // nonzero if eligible for the freelists
+};
+
+struct Stats {
+  std::atomic<size_t> allocated_bytes{0};
+  std::atomic<size_t> cached_bytes{0};
+  std::atomic<size_t> hits{0};
+  std::atomic<size_t> misses{0};
+  std::atomic<size_t> uncached{0};
+};
+
+Stats& stats() {
+  static Stats s;
+  return s;
+}
+
+size_t class_bytes(size_t size_class) {
+  return kMinBlockSize << size_class;
+}
+
+// Returns the size class for nbytes, or SIZE_MAX if it is uncacheable.
+size_t size_class_for(size_t nbytes) {
+  if (nbytes > kMaxCachedSize) {
+    return SIZE_MAX;
+  }
+  size_t rounded = std::max(nbytes, kMinBlockSize);
+  size_t cls = llvm::Log2_64_Ceil(rounded) - llvm::Log2_64(kMinBlockSize);
+  TORCH_INTERNAL_ASSERT_DEBUG_ONLY(cls < kNumSizeClasses);
+  return cls;
+}
+
+class GlobalPool {
+ public:
+  void* pop(size_t size_class) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto& list = freelists_[size_class];
+    if (list.empty()) {
+      return nullptr;
+    }
+    void* block = list.back();
+    list.pop_back();
+    return block;
+  }
+
+  void push(size_t size_class, void* block) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    freelists_[size_class].push_back(block);
+  }
+
+  void release_all() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (auto& list : freelists_) {
+      for (void* block : list) {
+        stats().cached_bytes -= class_bytes(
+            static_cast<BlockHeader*>(block)->size_class);
+        free_cpu(block);
+      }
+      list.clear();
+    }
+  }
+
+ private:
+  std::mutex mutex_;
+  std::array<std::vector<void*>, kNumSizeClasses> freelists_;
+};
+
+GlobalPool& global_pool() {
+  static GlobalPool* pool = new GlobalPool(); // leaked: outlives thread caches
+  return *pool;
+}
+
+struct ThreadCache {
+  std::array<std::vector<void*>, kNumSizeClasses> freelists;
+
+  void* pop(size_t size_class) {
+    auto& list = freelists[size_class];
+    if (list.empty()) {
+      return nullptr;
+    }
+    void* block = list.back();
+    list.pop_back();
+    return block;
+  }
+
+  // Returns false if the class is full and the block should spill.
+  bool push(size_t size_class, void* block) {
+    auto& list = freelists[size_class];
+    if (list.size() >= kMaxBlocksPerThreadClass) {
+      return false;
+    }
+    list.push_back(block);
+    return true;
+  }
+
+  void release_all() {
+    for (auto& list : freelists) {
+      for (void* block : list) {
+        stats().cached_bytes -= class_bytes(
+            static_cast<BlockHeader*>(block)->size_class);
+        free_cpu(block);
+      }
+      list.clear();
+    }
+  }
+
+  ~ThreadCache() {
+    // Thread exit: hand cached blocks to the global pool for other threads.
+    for (const auto cls : c10::irange(kNumSizeClasses)) {
+      for (void* block : freelists[cls]) {
+        global_pool().push(cls, block);
+      }
+      freelists[cls].clear();
+    }
+  }
+};
+
+ThreadCache& thread_cache() {
+  thread_local ThreadCache cache;
+  return cache;
+}
+
+void* user_data(void* block) {
+  return static_cast<char*>(block) + gAlignment;
+}
+
+BlockHeader* header_of(void* data) {
+  return reinterpret_cast<BlockHeader*>(static_cast<char*>(data) - gAlignment);
+}
+
+void delete_block(void* data);
+
+struct CachingCPUAllocatorImpl final : at::Allocator {
+  at::DataPtr allocate(size_t nbytes) const override {
+    if (nbytes == 0) {
+      return {nullptr, nullptr, &delete_block, at::Device(at::DeviceType::CPU)};
+    }
+    size_t cls = size_class_for(nbytes);
+    void* block = nullptr;
+    if (C10_UNLIKELY(cls == SIZE_MAX)) {
+      stats().uncached++;
+      block = alloc_cpu(nbytes + gAlignment);
+      auto* header = static_cast<BlockHeader*>(block);
+      header->size_class = 0;
+      header->cached = 0;
+      stats().allocated_bytes += nbytes;
+      void* data = user_data(block);
+      profiledCPUMemoryReporter().New(data, nbytes);
+      return {data, data, &delete_block, at::Device(at::DeviceType::CPU)};
+    }
+    block = thread_cache().pop(cls);
+    if (block == nullptr) {
+      block = global_pool().pop(cls);
+    }
+    if (block != nullptr) {
+      stats().hits++;
+      stats().cached_bytes -= class_bytes(cls);
+    } else {
+      stats().misses++;
+      block = alloc_cpu(class_bytes(cls) + gAlignment);
+      auto* header = static_cast<BlockHeader*>(block);
+      header->size_class = static_cast<uint32_t>(cls);
+      header->cached = 1;
+    }
+    stats().allocated_bytes += class_bytes(cls);
+    void* data = user_data(block);
+    profiledCPUMemoryReporter().New(data, class_bytes(cls));
+    return {data, data, &delete_block, at::Device(at::DeviceType::CPU)};
+  }
+
+  at::DeleterFnPtr raw_deleter() const override {
+    return &delete_block;
+  }
+};
+
+void delete_block(void* data) {
+  if (data == nullptr) {
+    return;
+  }
+  profiledCPUMemoryReporter().Delete(data);
+  BlockHeader* header = header_of(data);
+  void* block = header;
+  if (C10_UNLIKELY(!header->cached)) {
+    free_cpu(block);
+    return;
+  }
+  size_t cls = header->size_class;
+  stats().allocated_bytes -= class_bytes(cls);
+  stats().cached_bytes += class_bytes(cls);
+  if (!thread_cache().push(cls, block)) {
+    global_pool().push(cls, block);
+  }
+}
+
+std::atomic<bool> enabled{false};
+
+} // namespace
+
+void enable() {
+  if (enabled.exchange(true)) {
+    return;
+  }
+  SetCPUAllocator(get(), /*priority=*/1);
+}
+
+bool isEnabled() {
+  return enabled.load();
+}
+
+void emptyCache() {
+  thread_cache().release_all();
+  global_pool().release_all();
+}
+
+CachingCPUAllocatorStats getStats() {
+  CachingCPUAllocatorStats out;
+  out.allocated_bytes = stats().allocated_bytes.load();
+  out.cached_bytes = stats().cached_bytes.load();
+  out.hits = stats().hits.load();
+  out.misses = stats().misses.load();
+  out.uncached_allocations = stats().uncached.load();
+  return out;
+}
+
+at::Allocator* get() {
+  static CachingCPUAllocatorImpl allocator;
+  return &allocator;
+}
+
+} // namespace caching_cpu_allocator
+} // namespace c10
@@ -0,0 +1,64 @@
+#pragma once
+
+#include <cstddef>
+
+#include <c10/core/Allocator.h>
+#include <c10/macros/Export.h>
+
+namespace c10 {
+
+// An opt-in caching allocator for CPU tensors, analogous in spirit to
+// CUDACachingAllocator: freed blocks are parked on size-class freelists and
+// reused instead of being returned to the system allocator. This keeps hot
+// 1-16MB activation buffers on already-faulted (and, where the kernel grants
+// them, transparent-huge-page-backed) memory, avoiding the page-fault and TLB
+// churn of repeated malloc/free under high-throughput serving.
+//
+// Design:
+//  - Sizes are rounded up to power-of-two size classes between kMinBlockSize
+//    and kMaxCachedSize; larger requests bypass the cache entirely.
+//  - Each thread owns a small cache per size class; overflow and cross-thread
+//    frees spill to a mutex-protected global pool.
+//  - emptyCache() releases all pooled blocks back to the system.
+//  - getStats() mirrors the shape of CUDACachingAllocator device stats at the
+//    granularity that makes sense on CPU.
+//
+// The allocator is inert until enabled:
+//
+//   c10::caching_cpu_allocator::enable();   // installs via SetCPUAllocator
+//
+// This is distinct from the mobile c10::CPUCachingAllocator, which is a
+// pointer-table cache wired into the mobile allocator only.
+namespace caching_cpu_allocator {
+
+struct C10_API CachingCPUAllocatorStats {
+  // Bytes currently handed out to live tensors.
+  size_t allocated_bytes = 0;
+  // Bytes parked on freelists (thread caches + global pool).
+  size_t cached_bytes = 0;
+  // Cumulative allocation requests served from a freelist.
+  size_t hits = 0;
+  // Cumulative allocation requests that went to the system allocator.
+  size_t misses = 0;
+  // Cumulative requests too large to be cached.
+  size_t uncached_allocations = 0;
+};
+
+// Installs the caching allocator as the process CPU allocator. Idempotent.
+C10_API void enable();
+
+// True if enable() has been called.
+C10_API bool isEnabled();
+
+// Releases every cached block (global pool and the calling thread's cache)
+// back to the system allocator.
+C10_API void emptyCache();
+
+C10_API CachingCPUAllocatorStats getStats();
+
+// The allocator instance itself, for callers that want to install it with a
+// custom priority via SetCPUAllocator.
+C10_API at::Allocator* get();
+
+} // namespace caching_cpu_allocator
+} // namespace c10
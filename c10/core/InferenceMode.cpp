@@ -1,6 +1,12 @@
 #include <c10/core/InferenceMode.h>
 
+#include <atomic>
+
 namespace c10 {
+
+namespace {
+std::atomic<uint64_t> tensor_fast_path_count_{0};
+} // namespace
 // Invariant:
 //   is_enabled() ==
 //   !c10::impl::tls_is_dispatch_key_included(DispatchKey::ADInplaceOrView);
@@ -9,4 +15,12 @@ namespace c10 {
 bool InferenceMode::is_enabled() {
   return AutogradState::get_tls_state().get_inference_mode();
 }
+
+uint64_t InferenceMode::tensor_fast_path_count() {
+  return tensor_fast_path_count_.load(std::memory_order_relaxed);
+}
+
+void InferenceMode::_bump_tensor_fast_path_count() {
+  tensor_fast_path_count_.fetch_add(1, std::memory_order_relaxed);
+}
 } // namespace c10
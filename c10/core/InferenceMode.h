@@ -4,6 +4,8 @@
 #include <c10/core/impl/LocalDispatchKeySet.h>
 #include <c10/macros/Export.h>
 
+#include <cstdint>
+
 namespace c10 {
 
 // A RAII, thread local (!) guard that enables or disables inference mode upon
@@ -77,6 +79,16 @@ struct C10_API InferenceMode {
   }
   static bool is_enabled();
 
+  // Number of TensorImpls constructed through the inference fast path, i.e.
+  // without a version counter or autograd dispatch keys. Useful to verify
+  // that a workload running under InferenceMode actually creates its tensors
+  // through the trimmed path. The counter uses relaxed atomics, so the value
+  // is approximate while other threads are creating tensors.
+  static uint64_t tensor_fast_path_count();
+
+  // Called from the TensorImpl constructors; not a public API.
+  static void _bump_tensor_fast_path_count();
+
  private:
   AutogradState prev_mode;
   c10::impl::LocalDispatchKeySet prev_keyset;
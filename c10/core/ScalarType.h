@@ -548,7 +548,38 @@ static inline bool canCast(const ScalarType from, const ScalarType to) {
   return true;
 }
 
-static inline ScalarType promoteTypes(ScalarType a, ScalarType b) {
+namespace detail {
+
+// Bits, Quantized and Float8 are 14 dtypes that do not participate in type
+// promotion and are excluded from the compact matrix in promoteTypesImpl.
+constexpr int num_bits_types = static_cast<int>(ScalarType::Bits16) -
+    static_cast<int>(ScalarType::Bits1x8) + 1;
+
+constexpr int num_float8_types = static_cast<int>(ScalarType::Float8_e4m3fnuz) -
+    static_cast<int>(ScalarType::Float8_e5m2) + 1;
+
+constexpr int num_qint_types =
+    static_cast<int>(ScalarType::QInt32) - static_cast<int>(ScalarType::QInt8) + 1;
+
+constexpr int num_quint_types = static_cast<int>(ScalarType::QUInt2x4) -
+    static_cast<int>(ScalarType::QUInt4x2) + 1;
+
+constexpr int num_quantized_types = num_qint_types + num_quint_types;
+
+constexpr int num_missing_types =
+    num_bits_types + num_float8_types + num_quantized_types;
+
+// The compact promotion matrix excludes the 14 missing types above and
+// Undefined, leaving the 13 promotable types.
+constexpr int NUM_PROMOTE_TYPES =
+    static_cast<int>(ScalarType::NumOptions) - num_missing_types - 1;
+
+// Promotion rules for a single pair of dtypes.  Pairs that promoteTypes
+// either rejects with an error (mixed quantized, Float8) or has no rule for
+// (bits, Undefined operands) all map to Undefined here; promoteTypes sorts
+// out on its cold path which of those should throw.  This is only ever
+// evaluated at compile time, to build promoteTypesLookup below.
+constexpr ScalarType promoteTypesImpl(ScalarType a, ScalarType b) {
   // This is generated according to NumPy's promote_types
   constexpr auto u1 = ScalarType::Byte;
   constexpr auto i1 = ScalarType::Char;
@@ -565,7 +596,7 @@ static inline ScalarType promoteTypes(ScalarType a, ScalarType b) {
   constexpr auto bf = ScalarType::BFloat16;
   constexpr auto ud = ScalarType::Undefined;
   if (a == ud || b == ud) {
-    return ScalarType::Undefined;
+    return ud;
   }
 
   // If the two types are equal, return that type
@@ -573,50 +604,13 @@ static inline ScalarType promoteTypes(ScalarType a, ScalarType b) {
     return a;
   }
 
-  // Handle identically equal types
-  if (isQIntType(a) || isQIntType(b)) {
-    TORCH_CHECK(
-        false,
-        "promoteTypes with quantized numbers is not handled yet; figure out what the correct rules should be, offending types: ",
-        toString(a),
-        " ",
-        toString(b));
+  // Quantized, bits and Float8 types occupy the enum range [QInt8, NumOptions)
+  // except for BFloat16; none of them promote with anything.
+  if ((static_cast<int>(a) >= static_cast<int>(ScalarType::QInt8) && a != bf) ||
+      (static_cast<int>(b) >= static_cast<int>(ScalarType::QInt8) && b != bf)) {
+    return ud;
   }
 
-  if (isBitsType(a) || isBitsType(b)) {
-    return ScalarType::Undefined;
-  }
-
-  if (isFloat8Type(a) || isFloat8Type(b)) {
-    TORCH_CHECK(
-        false,
-        "Promotion for Float8 Types is not supported, attempted to promote ",
-        toString(a),
-        " and ",
-        toString(b));
-  }
-
-  // Bits, Quantized and Float8 are 14 dtypes already handled and not included
-  // in the promotion table below.
-  static constexpr int num_bits_types = static_cast<int>(ScalarType::Bits16) -
-      static_cast<int>(ScalarType::Bits1x8) + 1;
-
-  static constexpr int num_float8_types =
-      static_cast<int>(ScalarType::Float8_e4m3fnuz) -
-      static_cast<int>(ScalarType::Float8_e5m2) + 1;
-
-  static constexpr int num_qint_types = static_cast<int>(ScalarType::QInt32) -
-      static_cast<int>(ScalarType::QInt8) + 1;
-
-  static constexpr int num_quint_types =
-      static_cast<int>(ScalarType::QUInt2x4) -
-      static_cast<int>(ScalarType::QUInt4x2) + 1;
-
-  static constexpr int num_quantized_types = num_qint_types + num_quint_types;
-
-  static constexpr int num_missing_types =
-      num_bits_types + num_float8_types + num_quantized_types;
-
   // Bfloat16 is at position 15 in the ScalerType enum, There are three types
   // below bf16 not included in the table, Qint8, QUInt8, QInt32. Every other
   // type above bf16, i.e. {Bits, Quantized, Float8} are not included in the
@@ -630,17 +624,11 @@ static inline ScalarType promoteTypes(ScalarType a, ScalarType b) {
   b = b == bf ? static_cast<ScalarType>(static_cast<int>(b) - num_qint_types)
               : b;
 
-  // We decrease the promotion table by the number of missing types -> 14
-  // and then subtract 1 more from the table since we don't store ud to ud
-  // mapping.
-  static constexpr int NUM_PROMOTE_TYPES =
-      static_cast<int>(ScalarType::NumOptions) - num_missing_types - 1;
-
   // this matrix has to be consistent with
   // AT_FORALL_SCALAR_TYPES_WITH_COMPLEX_AND_QINTS undefined is used where we
   // are not sure about the correct value for type promotion.
   // clang-format off
-  static constexpr std::
+  constexpr std::
   array<std::array<ScalarType, NUM_PROMOTE_TYPES>, NUM_PROMOTE_TYPES>
       _promoteTypesLookup = {{
       /*        u1  i1  i2  i4  i8  f2  f4  f8  c2  c4  c8  b1  bf*/
@@ -662,6 +650,98 @@ static inline ScalarType promoteTypes(ScalarType a, ScalarType b) {
   return _promoteTypesLookup[static_cast<int>(a)][static_cast<int>(b)];
 }
 
+// Full NumScalarTypes x NumScalarTypes promotion matrix, expanded at compile
+// time from promoteTypesImpl so the hot path of promoteTypes is a single
+// unconditional load with no index remapping.
+constexpr std::array<std::array<ScalarType, NumScalarTypes>, NumScalarTypes>
+makePromoteTypesLookup() {
+  std::array<std::array<ScalarType, NumScalarTypes>, NumScalarTypes> table{};
+  for (int i = 0; i < NumScalarTypes; ++i) {
+    for (int j = 0; j < NumScalarTypes; ++j) {
+      table[i][j] = promoteTypesImpl(
+          static_cast<ScalarType>(i), static_cast<ScalarType>(j));
+    }
+  }
+  return table;
+}
+
+inline constexpr auto promoteTypesLookup = makePromoteTypesLookup();
+
+constexpr bool validatePromoteTypesLookup() {
+  constexpr auto ud = ScalarType::Undefined;
+  for (int i = 0; i < NumScalarTypes; ++i) {
+    for (int j = 0; j < NumScalarTypes; ++j) {
+      // Promotion is symmetric.
+      if (promoteTypesLookup[i][j] != promoteTypesLookup[j][i]) {
+        return false;
+      }
+    }
+    // Promotion is idempotent (except on Undefined, where both operands
+    // being Undefined still yields Undefined).
+    if (promoteTypesLookup[i][i] != static_cast<ScalarType>(i) &&
+        static_cast<ScalarType>(i) != ud) {
+      return false;
+    }
+  }
+  // Spot-check the category rules from tensor_attributes.rst: bool defers to
+  // everything, mixed-sign integers widen, integers defer to floating point,
+  // floating point defers to complex.
+  return promoteTypesLookup[static_cast<int>(ScalarType::Bool)]
+                           [static_cast<int>(ScalarType::Byte)] ==
+      ScalarType::Byte &&
+      promoteTypesLookup[static_cast<int>(ScalarType::Byte)]
+                        [static_cast<int>(ScalarType::Char)] ==
+      ScalarType::Short &&
+      promoteTypesLookup[static_cast<int>(ScalarType::Long)]
+                        [static_cast<int>(ScalarType::Half)] ==
+      ScalarType::Half &&
+      promoteTypesLookup[static_cast<int>(ScalarType::Half)]
+                        [static_cast<int>(ScalarType::BFloat16)] ==
+      ScalarType::Float &&
+      promoteTypesLookup[static_cast<int>(ScalarType::Double)]
+                        [static_cast<int>(ScalarType::ComplexFloat)] ==
+      ScalarType::ComplexDouble;
+}
+
+static_assert(
+    validatePromoteTypesLookup(),
+    "promoteTypesLookup is not a symmetric, idempotent extension of the "
+    "type promotion rules");
+
+} // namespace detail
+
+static inline ScalarType promoteTypes(ScalarType a, ScalarType b) {
+  const auto result =
+      detail::promoteTypesLookup[static_cast<int>(a)][static_cast<int>(b)];
+  if (C10_UNLIKELY(result == ScalarType::Undefined)) {
+    // The table collapses "no promotion rule" and "promotion is an error"
+    // into Undefined; recover the historical behavior here, off the hot path.
+    if (a == ScalarType::Undefined || b == ScalarType::Undefined) {
+      return ScalarType::Undefined;
+    }
+    if (isQIntType(a) || isQIntType(b)) {
+      TORCH_CHECK(
+          false,
+          "promoteTypes with quantized numbers is not handled yet; figure out what the correct rules should be, offending types: ",
+          toString(a),
+          " ",
+          toString(b));
+    }
+    if (isBitsType(a) || isBitsType(b)) {
+      return ScalarType::Undefined;
+    }
+    if (isFloat8Type(a) || isFloat8Type(b)) {
+      TORCH_CHECK(
+          false,
+          "Promotion for Float8 Types is not supported, attempted to promote ",
+          toString(a),
+          " and ",
+          toString(b));
+    }
+  }
+  return result;
+}
+
 inline std::ostream& operator<<(
     std::ostream& stream,
     at::ScalarType scalar_type) {
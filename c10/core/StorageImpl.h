@@ -3,6 +3,8 @@
 #include <c10/core/Allocator.h>
 #include <c10/core/SymInt.h>
 #include <c10/core/impl/PyObjectSlot.h>
+#include <c10/core/impl/cow/COW.h>
+#include <c10/core/impl/cow/COWDeleter.h>
 
 #include <c10/util/intrusive_ptr.h>
 
@@ -110,7 +112,11 @@ struct C10_API StorageImpl : public c10::intrusive_ptr_target {
     return resizable_;
   }
 
+  // Mutable access materializes lazily cloned (copy-on-write) storages: the
+  // first write to any storage sharing a COW data allocation copies the data
+  // (or reclaims it, for the last reference). See c10/core/impl/cow/COW.h.
   at::DataPtr& mutable_data_ptr() {
+    maybe_materialize_cow();
     return data_ptr_;
   }
 
@@ -134,6 +140,7 @@ struct C10_API StorageImpl : public c10::intrusive_ptr_target {
   }
 
   void* mutable_data() {
+    maybe_materialize_cow();
     return data_ptr_.mutable_get();
   }
 
@@ -212,6 +219,14 @@ struct C10_API StorageImpl : public c10::intrusive_ptr_target {
   }
 
  private:
+  // The deleter compare is a single inline pointer check, so non-COW
+  // storages (the overwhelmingly common case) pay nothing here.
+  void maybe_materialize_cow() {
+    if (C10_UNLIKELY(data_ptr_.get_deleter() == &impl::cow::cow_deleter)) {
+      impl::cow::materialize_cow_storage(*this);
+    }
+  }
+
   DataPtr data_ptr_;
   SymInt size_bytes_;
   bool size_bytes_is_heap_allocated_;
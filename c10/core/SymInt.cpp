@@ -61,9 +61,9 @@ bool SymInt::has_hint() const {
   }
 
 // clang-format off
-DEFINE_BINARY(operator+, std::plus<>(), add, SymInt)
-DEFINE_BINARY(operator-, std::minus<>(), sub, SymInt)
-DEFINE_BINARY(operator*, std::multiplies<>(), mul, SymInt)
+DEFINE_BINARY(add_slow_path, std::plus<>(), add, SymInt)
+DEFINE_BINARY(sub_slow_path, std::minus<>(), sub, SymInt)
+DEFINE_BINARY(mul_slow_path, std::multiplies<>(), mul, SymInt)
 DEFINE_BINARY(operator/, std::divides<>(), floordiv, SymInt)
 DEFINE_BINARY(operator%, std::modulus<>(), mod, SymInt)
 DEFINE_BINARY(sym_eq, std::equal_to<>(), eq, SymBool)
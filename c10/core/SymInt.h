@@ -172,9 +172,31 @@ class C10_API SymInt {
 #endif
   }
 
-  SymInt operator+(const SymInt& sci) const;
-  SymInt operator-(const SymInt& sci) const;
-  SymInt operator*(const SymInt& sci) const;
+  // Addition, subtraction and multiplication are inlined for the common case
+  // where neither operand holds a SymNode: the packed payloads are combined
+  // directly, and the SymInt(int64_t) constructor re-checks the result for
+  // range.  Shape math in eager kernels is dominated by these three ops on
+  // plain ints, so avoiding the out-of-line call (and its redundant
+  // maybe_as_int checks) matters; anything involving a node takes the slow
+  // path, which dispatches to the SymNode.
+  SymInt operator+(const SymInt& sci) const {
+    if (C10_LIKELY(!is_heap_allocated() && !sci.is_heap_allocated())) {
+      return SymInt(data_ + sci.data_);
+    }
+    return add_slow_path(sci);
+  }
+  SymInt operator-(const SymInt& sci) const {
+    if (C10_LIKELY(!is_heap_allocated() && !sci.is_heap_allocated())) {
+      return SymInt(data_ - sci.data_);
+    }
+    return sub_slow_path(sci);
+  }
+  SymInt operator*(const SymInt& sci) const {
+    if (C10_LIKELY(!is_heap_allocated() && !sci.is_heap_allocated())) {
+      return SymInt(data_ * sci.data_);
+    }
+    return mul_slow_path(sci);
+  }
   SymInt operator/(const SymInt& sci) const;
   SymInt operator%(const SymInt& sci) const;
   void operator*=(const SymInt& sci);
@@ -190,22 +212,42 @@ class C10_API SymInt {
   SymBool sym_gt(const SymInt&) const;
   SymBool sym_ge(const SymInt&) const;
 
+  // Guarded comparisons get the same plain-int fast path as arithmetic;
+  // contiguity and numel checks are almost entirely comparisons.
   bool operator==(const SymInt& o) const {
+    if (C10_LIKELY(!is_heap_allocated() && !o.is_heap_allocated())) {
+      return data_ == o.data_;
+    }
     return sym_eq(o).guard_bool(__FILE__, __LINE__);
   }
   bool operator!=(const SymInt& o) const {
+    if (C10_LIKELY(!is_heap_allocated() && !o.is_heap_allocated())) {
+      return data_ != o.data_;
+    }
     return sym_ne(o).guard_bool(__FILE__, __LINE__);
   }
   bool operator<(const SymInt& o) const {
+    if (C10_LIKELY(!is_heap_allocated() && !o.is_heap_allocated())) {
+      return data_ < o.data_;
+    }
     return sym_lt(o).guard_bool(__FILE__, __LINE__);
   }
   bool operator<=(const SymInt& o) const {
+    if (C10_LIKELY(!is_heap_allocated() && !o.is_heap_allocated())) {
+      return data_ <= o.data_;
+    }
     return sym_le(o).guard_bool(__FILE__, __LINE__);
   }
   bool operator>(const SymInt& o) const {
+    if (C10_LIKELY(!is_heap_allocated() && !o.is_heap_allocated())) {
+      return data_ > o.data_;
+    }
     return sym_gt(o).guard_bool(__FILE__, __LINE__);
   }
   bool operator>=(const SymInt& o) const {
+    if (C10_LIKELY(!is_heap_allocated() && !o.is_heap_allocated())) {
+      return data_ >= o.data_;
+    }
     return sym_ge(o).guard_bool(__FILE__, __LINE__);
   }
 
@@ -255,6 +297,13 @@ class C10_API SymInt {
  private:
   void promote_to_negative();
 
+  // Out-of-line continuations of the inline arithmetic operators, taken when
+  // at least one operand holds a SymNode.  Defined via DEFINE_BINARY in
+  // SymInt.cpp.
+  SymInt add_slow_path(const SymInt& sci) const;
+  SymInt sub_slow_path(const SymInt& sci) const;
+  SymInt mul_slow_path(const SymInt& sci) const;
+
   // Constraints on the internal representation:
   //
   // - Should represent positive and small negative ints
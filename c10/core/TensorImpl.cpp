@@ -120,6 +120,8 @@ TensorImpl::TensorImpl(
   // Inference tensor doesn't have version counter.
   if (!is_inference()) {
     version_counter_ = VariableVersion(/*version=*/0);
+  } else {
+    InferenceMode::_bump_tensor_fast_path_count();
   }
 }
 
@@ -179,6 +181,8 @@ TensorImpl::TensorImpl(
   // Inference tensor doesn't have version counter.
   if (!is_inference()) {
     version_counter_ = VariableVersion(/*version=*/0);
+  } else {
+    InferenceMode::_bump_tensor_fast_path_count();
   }
   // we would also like to check that non-cpu devices have an index, but some
   // Caffe2 operators create Storages with default devices.
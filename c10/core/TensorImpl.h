@@ -1869,6 +1869,36 @@ struct C10_API TensorImpl : public c10::intrusive_ptr_target {
     }
   }
 
+  /**
+   * Adopt a complete geometry wholesale, stealing its storage. When the donor
+   * geometry has spilled out of line (rank above the inline capacity, see
+   * c10/core/impl/SizesAndStrides.h), this transfers the heap allocation
+   * instead of copying sizes and strides element by element. The geometry is
+   * taken as-is: it must already describe a valid tensor (this is how
+   * geometries obtained from another TensorImpl come), so no stride fixup is
+   * performed. The donor is left empty.
+   *
+   * WARNING: Like the ArrayRef overload above, this does not check that the
+   * geometry is in bounds for the allocated storage.
+   */
+  void set_sizes_and_strides(
+      c10::impl::SizesAndStrides&& new_sizes_and_strides,
+      c10::optional<int64_t> storage_offset = c10::nullopt) {
+    TORCH_CHECK(
+        allow_tensor_metadata_change(),
+        "set_sizes_and_strides ",
+        err_msg_tensor_metadata_change_not_allowed);
+    TORCH_CHECK(
+        !has_symbolic_sizes_strides_,
+        "set_sizes_and_strides() called on tensor with symbolic shape")
+    sizes_and_strides_ = std::move(new_sizes_and_strides);
+    refresh_numel();
+    refresh_contiguous();
+    if (storage_offset.has_value()) {
+      storage_offset_ = *storage_offset;
+    }
+  }
+
   /**
    * Set whether a tensor allows changes to its metadata (e.g. sizes / strides /
    * storage / storage_offset). See NOTE [ Metadata Change for a Detached Tensor
@@ -0,0 +1,220 @@
+#include <c10/core/WorkStealingThreadPool.h>
+
+#include <c10/util/Exception.h>
+#include <c10/util/irange.h>
+#include <c10/util/numa.h>
+#include <c10/util/thread_name.h>
+
+#include <array>
+#include <chrono>
+
+namespace c10 {
+
+// A bounded Chase-Lev style deque. The steal end (top) is lock-free; the
+// owner end (bottom) is guarded by a spinlock because, unlike the textbook
+// structure, two kinds of threads operate on it: the owning worker (pop) and
+// external submitters (push). The spinlock is per-deque and round-robin
+// submission keeps it essentially uncontended, which is what removes the
+// process-wide futex that c10::ThreadPool serializes on.
+//
+// Slots hold heap-allocated closures; a stealer publishes its claim with a
+// CAS on `top` and only the winner dereferences the pointer.
+struct WorkStealingThreadPool::Deque {
+  static constexpr size_t kCapacity = 1024; // must be a power of two
+  static constexpr size_t kMask = kCapacity - 1;
+
+  std::atomic<int64_t> top{0};
+  std::atomic<int64_t> bottom{0};
+  std::atomic_flag bottom_lock = ATOMIC_FLAG_INIT;
+  std::array<std::atomic<std::function<void()>*>, kCapacity> buffer{};
+
+  struct BottomGuard {
+    explicit BottomGuard(Deque& deque) : deque_(deque) {
+      while (deque_.bottom_lock.test_and_set(std::memory_order_acquire)) {
+      }
+    }
+    ~BottomGuard() {
+      deque_.bottom_lock.clear(std::memory_order_release);
+    }
+    Deque& deque_;
+  };
+
+  // On success takes ownership of *task; on failure (deque full) leaves the
+  // task with the caller, who spills it to the overflow queue.
+  bool push(std::unique_ptr<std::function<void()>>& task) {
+    BottomGuard guard(*this);
+    int64_t b = bottom.load(std::memory_order_relaxed);
+    int64_t t = top.load(std::memory_order_acquire);
+    if (b - t >= static_cast<int64_t>(kCapacity)) {
+      return false;
+    }
+    buffer[static_cast<size_t>(b) & kMask].store(
+        task.release(), std::memory_order_relaxed);
+    bottom.store(b + 1, std::memory_order_release);
+    return true;
+  }
+
+  std::unique_ptr<std::function<void()>> pop() {
+    BottomGuard guard(*this);
+    int64_t b = bottom.load(std::memory_order_relaxed) - 1;
+    bottom.store(b, std::memory_order_seq_cst);
+    int64_t t = top.load(std::memory_order_seq_cst);
+    if (t > b) {
+      // Empty; undo.
+      bottom.store(b + 1, std::memory_order_relaxed);
+      return nullptr;
+    }
+    std::function<void()>* task =
+        buffer[static_cast<size_t>(b) & kMask].load(std::memory_order_relaxed);
+    if (t == b) {
+      // Last element: race against stealers for it.
+      if (!top.compare_exchange_strong(
+              t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed)) {
+        task = nullptr; // a stealer won
+      }
+      bottom.store(b + 1, std::memory_order_relaxed);
+    }
+    return std::unique_ptr<std::function<void()>>(task);
+  }
+
+  std::unique_ptr<std::function<void()>> steal() {
+    int64_t t = top.load(std::memory_order_seq_cst);
+    int64_t b = bottom.load(std::memory_order_seq_cst);
+    if (t >= b) {
+      return nullptr;
+    }
+    std::function<void()>* task =
+        buffer[static_cast<size_t>(t) & kMask].load(std::memory_order_relaxed);
+    if (!top.compare_exchange_strong(
+            t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed)) {
+      return nullptr; // lost the race
+    }
+    return std::unique_ptr<std::function<void()>>(task);
+  }
+};
+
+WorkStealingThreadPool::WorkStealingThreadPool(
+    int pool_size,
+    int numa_node_id,
+    const std::function<void()>& init_thread) {
+  const auto num_threads = pool_size < 0
+      ? static_cast<int>(defaultNumThreads())
+      : pool_size;
+  deques_.reserve(num_threads);
+  for (C10_UNUSED const auto i : c10::irange(num_threads)) {
+    deques_.push_back(std::make_unique<Deque>());
+  }
+  threads_.reserve(num_threads);
+  for (const auto i : c10::irange(num_threads)) {
+    threads_.emplace_back([this, i, init_thread, numa_node_id]() {
+      if (init_thread) {
+        init_thread();
+      } else {
+        setThreadName("WorkStealThread");
+        NUMABind(numa_node_id);
+      }
+      main_loop(i);
+    });
+  }
+}
+
+WorkStealingThreadPool::~WorkStealingThreadPool() {
+  running_.store(false);
+  {
+    std::lock_guard<std::mutex> lock(sleep_mutex_);
+    sleep_cv_.notify_all();
+  }
+  for (auto& thread : threads_) {
+    thread.join();
+  }
+  // Drop anything never executed.
+  for (auto& deque : deques_) {
+    while (auto task = deque->pop()) {
+    }
+  }
+}
+
+void WorkStealingThreadPool::run(std::function<void()> func) {
+  TORCH_CHECK(!deques_.empty(), "WorkStealingThreadPool has no threads");
+  auto task = std::make_unique<std::function<void()>>(std::move(func));
+  const size_t target =
+      next_submit_.fetch_add(1, std::memory_order_relaxed) % deques_.size();
+  if (!deques_[target]->push(task)) {
+    overflows_.fetch_add(1, std::memory_order_relaxed);
+    std::lock_guard<std::mutex> lock(overflow_mutex_);
+    overflow_.push(std::move(*task));
+  }
+  sleep_cv_.notify_one();
+}
+
+size_t WorkStealingThreadPool::size() const {
+  return threads_.size();
+}
+
+size_t WorkStealingThreadPool::numAvailable() const {
+  return num_idle_.load(std::memory_order_relaxed);
+}
+
+bool WorkStealingThreadPool::inThreadPool() const {
+  for (const auto& thread : threads_) {
+    if (thread.get_id() == std::this_thread::get_id()) {
+      return true;
+    }
+  }
+  return false;
+}
+
+uint64_t WorkStealingThreadPool::steal_count() const {
+  return steals_.load(std::memory_order_relaxed);
+}
+
+uint64_t WorkStealingThreadPool::overflow_count() const {
+  return overflows_.load(std::memory_order_relaxed);
+}
+
+bool WorkStealingThreadPool::try_run_one(size_t index) {
+  // Own deque first (LIFO keeps caches warm) ...
+  if (auto task = deques_[index]->pop()) {
+    (*task)();
+    return true;
+  }
+  // ... then the overflow queue ...
+  {
+    std::unique_lock<std::mutex> lock(overflow_mutex_);
+    if (!overflow_.empty()) {
+      auto task = std::move(overflow_.front());
+      overflow_.pop();
+      lock.unlock();
+      task();
+      return true;
+    }
+  }
+  // ... then steal, scanning from our right-hand neighbour.
+  for (const auto offset : c10::irange(size_t(1), deques_.size())) {
+    const size_t victim = (index + offset) % deques_.size();
+    if (auto task = deques_[victim]->steal()) {
+      steals_.fetch_add(1, std::memory_order_relaxed);
+      (*task)();
+      return true;
+    }
+  }
+  return false;
+}
+
+void WorkStealingThreadPool::main_loop(size_t index) {
+  while (running_.load(std::memory_order_relaxed)) {
+    if (try_run_one(index)) {
+      continue;
+    }
+    num_idle_.fetch_add(1, std::memory_order_relaxed);
+    {
+      std::unique_lock<std::mutex> lock(sleep_mutex_);
+      // Timed wait: a steal target may have been populated between our scan
+      // and going to sleep; the timeout bounds that window.
+      sleep_cv_.wait_for(lock, std::chrono::milliseconds(1));
+    }
+    num_idle_.fetch_sub(1, std::memory_order_relaxed);
+  }
+}
+
+} // namespace c10
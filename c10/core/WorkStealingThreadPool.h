@@ -0,0 +1,79 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <vector>
+
+#include <c10/core/thread_pool.h>
+#include <c10/macros/Export.h>
+
+namespace c10 {
+
+// A work-stealing alternative to c10::ThreadPool.
+//
+// ThreadPool funnels every task through one mutex + condition variable; with
+// many small parallel_for regions on wide machines the futex on that mutex
+// becomes the bottleneck. Here each worker owns a Chase-Lev deque: the worker
+// pushes and pops at the bottom without synchronization beyond the deque's
+// atomics, and idle workers steal from the top of other workers' deques.
+// External submitters distribute tasks round-robin onto the deques (taking a
+// brief per-deque spinlock, which is uncontended in the common case); if a
+// deque is full the task spills to a mutex-protected overflow queue.
+//
+// Steal and overflow counts are exported for monitoring via steal_count() /
+// overflow_count().
+class C10_API WorkStealingThreadPool : public TaskThreadPoolBase {
+ public:
+  explicit WorkStealingThreadPool(
+      int pool_size,
+      int numa_node_id = -1,
+      const std::function<void()>& init_thread = nullptr);
+
+  ~WorkStealingThreadPool() override;
+
+  void run(std::function<void()> func) override;
+
+  size_t size() const override;
+
+  size_t numAvailable() const override;
+
+  bool inThreadPool() const override;
+
+  // Cumulative number of tasks executed after being stolen from another
+  // worker's deque.
+  uint64_t steal_count() const;
+
+  // Cumulative number of tasks that spilled to the overflow queue because a
+  // worker deque was full.
+  uint64_t overflow_count() const;
+
+ private:
+  struct Deque;
+
+  void main_loop(size_t index);
+  bool try_run_one(size_t index);
+
+  std::vector<std::unique_ptr<Deque>> deques_;
+  std::vector<std::thread> threads_;
+
+  // Spill queue for deque overflow; also drained by idle workers.
+  std::queue<std::function<void()>> overflow_;
+  mutable std::mutex overflow_mutex_;
+
+  // Workers sleep here when there is nothing to run or steal.
+  std::mutex sleep_mutex_;
+  std::condition_variable sleep_cv_;
+
+  std::atomic<bool> running_{true};
+  std::atomic<size_t> num_idle_{0};
+  std::atomic<size_t> next_submit_{0};
+  std::atomic<uint64_t> steals_{0};
+  std::atomic<uint64_t> overflows_{0};
+};
+
+} // namespace c10
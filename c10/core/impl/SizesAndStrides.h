@@ -7,7 +7,13 @@
 #include <c10/util/ArrayRef.h>
 #include <c10/util/SmallVector.h>
 
+// Number of dimensions stored inline before spilling to the heap. Can be
+// overridden at build time (SIZES_AND_STRIDES_MAX_INLINE_SIZE in CMake) for
+// workloads where tensors of higher rank dominate; the value changes the
+// TensorImpl layout and must be consistent across everything linking c10.
+#ifndef C10_SIZES_AND_STRIDES_MAX_INLINE_SIZE
 #define C10_SIZES_AND_STRIDES_MAX_INLINE_SIZE 5
+#endif
 
 namespace c10 {
 namespace impl {
@@ -19,8 +25,8 @@ namespace impl {
 // the number of strides. The memory layout is as follows:
 //
 // 1 size_t for the size
-// 5 eightbytes of inline sizes and 5 eightbytes of inline strides, OR pointer
-// to out-of-line array
+// C10_SIZES_AND_STRIDES_MAX_INLINE_SIZE (default 5) eightbytes of inline
+// sizes and as many inline strides, OR pointer to out-of-line array
 class C10_API SizesAndStrides {
  public:
   // TODO: different iterator types for sizes & strides to prevent
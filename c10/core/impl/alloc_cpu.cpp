@@ -21,10 +21,20 @@ C10_DEFINE_bool(
     false,
     "If set, fill memory with deterministic junk when allocating on CPU");
 
+C10_DEFINE_bool(
+    caffe2_cpu_allocator_numa_interleave,
+    false,
+    "If set, interleave the pages of large CPU allocations across all NUMA "
+    "nodes instead of binding them to the allocating thread's node");
+
 namespace c10 {
 
 namespace {
 
+// Allocations below this size fit comfortably on one node and are cheaper to
+// keep local to the allocating thread than to interleave.
+constexpr size_t kNumaInterleaveMinNbytes = 8 * 1024 * 1024;
+
 // Fill the data memory region of num bytes with a particular garbage pattern.
 // The garbage value is chosen to be NaN if interpreted as floating point value,
 // or a very large integer.
@@ -91,8 +101,16 @@ void* alloc_cpu(size_t nbytes) {
       ")");
 #endif
 
-  // move data to a thread's NUMA node
-  NUMAMove(data, nbytes, GetCurrentNUMANode());
+  if (FLAGS_caffe2_cpu_allocator_numa_interleave &&
+      nbytes >= kNumaInterleaveMinNbytes && GetNumNUMANodes() > 1) {
+    // Large buffers are typically consumed by intra-op loops whose threads
+    // span every socket; spreading their pages keeps a single memory
+    // controller from becoming the bottleneck.
+    NUMAInterleave(data, nbytes);
+  } else {
+    // move data to a thread's NUMA node
+    NUMAMove(data, nbytes, GetCurrentNUMANode());
+  }
   CHECK(
       !FLAGS_caffe2_cpu_allocator_do_zero_fill ||
       !FLAGS_caffe2_cpu_allocator_do_junk_fill)
@@ -20,6 +20,11 @@ namespace c10::impl::cow {
 C10_API c10::intrusive_ptr<StorageImpl> lazy_clone_storage(
     StorageImpl& storage);
 
+// Replaces a COW storage's data with a private copy, or reclaims the original
+// allocation when this is the last reference. Called from StorageImpl on the
+// first mutable data access; the storage must hold a COW DataPtr.
+C10_API void materialize_cow_storage(StorageImpl& storage);
+
 // Check if a storage has a simple DataPtr with no abnormal context
 C10_API bool has_simple_data_ptr(const c10::StorageImpl& storage);
 
@@ -78,18 +78,46 @@ bool ThreadPool::inThreadPool() const {
 }
 
 void ThreadPool::run(std::function<void()> func) {
+  run_with_priority(std::move(func), kNormalPriority);
+}
+
+void ThreadPool::run_with_priority(std::function<void()> func, uint8_t priority) {
   if (threads_.empty()) {
     throw std::runtime_error("No threads to run a task");
   }
+  if (priority >= kNumPriorities) {
+    priority = kNumPriorities - 1;
+  }
   std::unique_lock<std::mutex> lock(mutex_);
 
   // Set task and signal condition variable so that a worker thread will
   // wake up and use the task.
-  tasks_.emplace(std::move(func));
+  tasks_[priority].emplace(std::move(func));
   complete_ = false;
   condition_.notify_one();
 }
 
+bool ThreadPool::tasks_empty() const {
+  for (const auto& queue : tasks_) {
+    if (!queue.empty()) {
+      return false;
+    }
+  }
+  return true;
+}
+
+ThreadPool::task_element_t ThreadPool::pop_task() {
+  // Drain higher priorities first; each level is FIFO.
+  for (size_t p = kNumPriorities; p-- > 0;) {
+    if (!tasks_[p].empty()) {
+      task_element_t task = std::move(tasks_[p].front());
+      tasks_[p].pop();
+      return task;
+    }
+  }
+  throw std::runtime_error("pop_task() called on an empty task queue");
+}
+
 void ThreadPool::waitWorkComplete() {
   std::unique_lock<std::mutex> lock(mutex_);
   completed_.wait(lock, [&]() { return complete_; });
@@ -100,7 +128,7 @@ void ThreadPool::main_loop(std::size_t index) {
   while (running_) {
     // Wait on condition variable while the task is empty and
     // the pool is still running.
-    condition_.wait(lock, [&]() { return !tasks_.empty() || !running_; });
+    condition_.wait(lock, [&]() { return !tasks_empty() || !running_; });
     // If pool is no longer running, break out of loop.
     if (!running_) {
       break;
@@ -112,8 +140,7 @@ void ThreadPool::main_loop(std::size_t index) {
     // useful in the event that the function contains
     // shared_ptr arguments bound via bind.
     {
-      task_element_t tasks = std::move(tasks_.front());
-      tasks_.pop();
+      task_element_t tasks = pop_task();
       // Decrement count, indicating thread is no longer available.
       --available_;
 
@@ -145,7 +172,7 @@ void ThreadPool::main_loop(std::size_t index) {
 
     // Increment count, indicating thread is available.
     ++available_;
-    if (tasks_.empty() && available_ == total_) {
+    if (tasks_empty() && available_ == total_) {
       complete_ = true;
       completed_.notify_one();
     }
@@ -1,7 +1,9 @@
 #pragma once
 
+#include <array>
 #include <atomic>
 #include <condition_variable>
+#include <cstdint>
 #include <functional>
 #include <mutex>
 #include <queue>
@@ -15,8 +17,23 @@ namespace c10 {
 
 class C10_API TaskThreadPoolBase {
  public:
+  // Task priorities for run_with_priority(). Higher values are dequeued
+  // before lower ones by pools that implement priority scheduling.
+  static constexpr uint8_t kLowPriority = 0;
+  static constexpr uint8_t kNormalPriority = 1;
+  static constexpr uint8_t kHighPriority = 2;
+  static constexpr size_t kNumPriorities = 3;
+
   virtual void run(std::function<void()> func) = 0;
 
+  // Submits a task with a scheduling priority. The priority is a hint:
+  // the default implementation ignores it and enqueues in FIFO order.
+  virtual void run_with_priority(
+      std::function<void()> func,
+      uint8_t /* priority */) {
+    run(std::move(func));
+  }
+
   virtual size_t size() const = 0;
 
   /**
@@ -49,7 +66,9 @@ class C10_API ThreadPool : public c10::TaskThreadPoolBase {
         : run_with_id(true), no_id(nullptr), with_id(std::move(f)) {}
   };
 
-  std::queue<task_element_t> tasks_;
+  // One FIFO queue per priority level; workers drain higher priorities
+  // first. Already-running tasks are not preempted.
+  std::array<std::queue<task_element_t>, kNumPriorities> tasks_;
   std::vector<std::thread> threads_;
   mutable std::mutex mutex_;
   std::condition_variable condition_;
@@ -78,13 +97,17 @@ class C10_API ThreadPool : public c10::TaskThreadPoolBase {
 
   void run(std::function<void()> func) override;
 
+  void run_with_priority(std::function<void()> func, uint8_t priority)
+      override;
+
   template <typename Task>
   void runTaskWithID(Task task) {
     std::unique_lock<std::mutex> lock(mutex_);
 
     // Set task and signal condition variable so that a worker thread will
     // wake up and use the task.
-    tasks_.emplace(static_cast<std::function<void(std::size_t)>>(task));
+    tasks_[kNormalPriority].emplace(
+        static_cast<std::function<void(std::size_t)>>(task));
     complete_ = false;
     condition_.notify_one();
   }
@@ -95,6 +118,10 @@ class C10_API ThreadPool : public c10::TaskThreadPoolBase {
  private:
   // @brief Entry point for pool threads.
   void main_loop(std::size_t index);
+
+  // The following two require mutex_ to be held.
+  bool tasks_empty() const;
+  task_element_t pop_task();
 };
 
 class C10_API TaskThreadPool : public c10::ThreadPool {
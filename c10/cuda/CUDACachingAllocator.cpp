@@ -210,11 +210,19 @@ struct Block {
                      // expandable_segment_ is null. When false
                      // This Block will be aligned to the segment size
                      // of its expandable_segment_.
+  bool address_stable{false}; // address pinned by setAddressStable; if freed
+                              // while set, the block is parked in
+                              // stable_reserved_blocks instead of returning
+                              // to its pool, so the address is never
+                              // reassigned until the pin is cleared.
   Block* prev{nullptr}; // prev block if split from a larger allocation
   Block* next{nullptr}; // next block if split from a larger allocation
   int event_count{0}; // number of outstanding CUDA events
   int gc_count{0}; // counter for prioritizing older / less useful blocks for
                    // garbage collection
+  uint64_t last_use_tick{0}; // allocator tick when this block last returned
+                             // to its pool; lower means colder. Used by
+                             // releaseSomeCachedBlocks to free coldest first.
   std::shared_ptr<GatheredContext> context_when_allocated;
   // only set for the first block in the segment (when prev == null)
   // this records the frame information when cudaMalloc was called
@@ -864,6 +872,17 @@ class DeviceCachingAllocator {
   // whether they came from graph_pools or one of the BlockPools above.
   ska::flat_hash_set<Block*> active_blocks;
 
+  // Blocks freed while address-pinned (Block::address_stable), parked here
+  // by ptr instead of returning to their pool so their addresses are never
+  // reassigned. Released back to circulation by releaseReservedStableBlock.
+  ska::flat_hash_map<void*, Block*> stable_reserved_blocks;
+
+  // Graph-aware allocation hints (see setAllocationHints): rounded sizes
+  // the next run is predicted to allocate, each consumed by the first
+  // allocation requesting it, plus how the predictions worked out.
+  ska::flat_hash_map<size_t, uint64_t> pending_hint_sizes;
+  AllocationHintStats hint_stats;
+
   // captures_underway tracks if a capture might be underway on any stream.
   // Most of the time it's zero, in which case malloc can avoid calling
   // cudaStreamGetCaptureInfo in the hot path.
@@ -881,6 +900,10 @@ class DeviceCachingAllocator {
 
   size_t allowed_memory_maximum = 0;
 
+  // Monotone count of blocks returned to the cache, used to stamp
+  // Block::last_use_tick so releaseSomeCachedBlocks can free coldest first.
+  uint64_t allocator_tick = 0;
+
   // all live expandable segments
   std::vector<ExpandableSegment*> expandable_segments_;
   std::vector<int> devices_with_peer_access_;
@@ -914,6 +937,12 @@ class DeviceCachingAllocator {
   // rather than the global memory.
   ska::flat_hash_map<cudaStream_t, MempoolId_t> stream_to_pool_map;
 
+  // Streams routed to a private pool outside of graph capture; see
+  // assignStreamToPool. Kept separate from stream_to_pool_map because that
+  // map's lifetime is tied to captures_underway, which also gates event
+  // processing.
+  ska::flat_hash_map<cudaStream_t, MempoolId_t> user_stream_to_pool_map;
+
   // XXX - maybe we should generalize and have multiple events
   std::vector<OutOfMemoryObserver> oom_observers_;
 
@@ -1025,6 +1054,23 @@ class DeviceCachingAllocator {
         // Trigger callbacks and retry search
         || (trigger_free_memory_callbacks(params) && get_free_block(params));
 
+    // Allocation-hint accounting (see setAllocationHints): each hinted
+    // size is consumed by the first allocation requesting it, and counts
+    // as a hit only when the pre-split exact-size block was there.
+    if (C10_UNLIKELY(!pending_hint_sizes.empty())) {
+      auto hint_it = pending_hint_sizes.find(size);
+      if (hint_it != pending_hint_sizes.end()) {
+        if (--hint_it->second == 0) {
+          pending_hint_sizes.erase(hint_it);
+        }
+        if (block_found && params.block->size == size) {
+          ++hint_stats.hits;
+        } else {
+          ++hint_stats.misses;
+        }
+      }
+    }
+
     // Can't reuse an existing block; try to get a new one.
     if (!block_found) {
       // Do garbage collection if the flag is set.
@@ -1336,6 +1382,71 @@ class DeviceCachingAllocator {
     block->stream_uses.insert(stream);
   }
 
+  /** pins or unpins the address of an allocated block; see setAddressStable
+   ** in CUDACachingAllocator.h **/
+  void setBlockAddressStable(Block* block, bool stable) {
+    std::lock_guard<std::recursive_mutex> lock(mutex);
+    block->address_stable = stable;
+  }
+
+  bool blockIsAddressStable(Block* block) {
+    std::lock_guard<std::recursive_mutex> lock(mutex);
+    return block->address_stable;
+  }
+
+  bool isReservedStable(void* ptr) {
+    std::lock_guard<std::recursive_mutex> lock(mutex);
+    return stable_reserved_blocks.count(ptr) != 0;
+  }
+
+  /** unpins a block parked by free_block and returns it to its pool, merging
+   ** with free neighbours as if it had just been freed. Returns false if ptr
+   ** does not name a reserved address-stable block on this device. **/
+  bool releaseReservedStableBlock(void* ptr) {
+    std::lock_guard<std::recursive_mutex> lock(mutex);
+    auto it = stable_reserved_blocks.find(ptr);
+    if (it == stable_reserved_blocks.end()) {
+      return false;
+    }
+    Block* block = it->second;
+    stable_reserved_blocks.erase(it);
+    block->address_stable = false;
+
+    auto& pool = *block->pool;
+    int64_t net_change_inactive_split_blocks = 0;
+    int64_t net_change_inactive_split_size = 0;
+    const std::array<Block*, 2> merge_candidates = {block->prev, block->next};
+    for (Block* merge_candidate : merge_candidates) {
+      const int64_t subsumed_size =
+          try_merge_blocks(block, merge_candidate, pool);
+      if (subsumed_size > 0) {
+        net_change_inactive_split_blocks -= 1;
+        net_change_inactive_split_size -= subsumed_size;
+      }
+    }
+    block->last_use_tick = ++allocator_tick;
+    bool inserted = pool.blocks.insert(block).second;
+    TORCH_INTERNAL_ASSERT(inserted);
+    if (block->is_split()) {
+      net_change_inactive_split_blocks += 1;
+      net_change_inactive_split_size += block->size;
+    }
+    // The active/allocated stats were settled when the block was parked;
+    // only the inactive_split bookkeeping is owed now that it is a normal
+    // free block again.
+    if (!block->expandable_segment_) {
+      StatTypes stat_types = get_stat_types_for_pool(pool);
+      for_each_selected_stat_type(stat_types, [&](size_t stat_type) {
+        update_stat(
+            stats.inactive_split[stat_type], net_change_inactive_split_blocks);
+        update_stat(
+            stats.inactive_split_bytes[stat_type],
+            net_change_inactive_split_size);
+      });
+    }
+    return true;
+  }
+
   /** set memory fraction to limit maximum allocated memory **/
   void setMemoryFraction(double fraction) {
     size_t device_free = 0;
@@ -1352,6 +1463,92 @@ class DeviceCachingAllocator {
     release_cached_blocks(context);
   }
 
+  /** incrementally returns roughly target_bytes of cached blocks to the
+   ** system allocator, coldest first. Unlike emptyCache this does not
+   ** synchronize on outstanding events, so blocks still guarded by events
+   ** stay cached and the cost is bounded by the number of blocks freed. **/
+  size_t releaseSomeCachedBlocks(size_t target_bytes) {
+    std::lock_guard<std::recursive_mutex> lock(mutex);
+    // Gather the whole (non-split, non-expandable) free blocks and order
+    // them by how long ago they last returned to the cache.
+    std::vector<Block*> candidates;
+    for (BlockPool* pool : {&large_blocks, &small_blocks}) {
+      for (Block* block : pool->blocks) {
+        if (!block->prev && !block->next && !block->expandable_segment_) {
+          candidates.push_back(block);
+        }
+      }
+    }
+    std::sort(candidates.begin(), candidates.end(), [](Block* a, Block* b) {
+      return a->last_use_tick < b->last_use_tick;
+    });
+    size_t released = 0;
+    for (Block* block : candidates) {
+      if (released >= target_bytes) {
+        break;
+      }
+      released += block->size;
+      release_block(block);
+    }
+    return released;
+  }
+
+  /** records the allocation sizes the next run is predicted to make on
+   ** `stream` and pre-splits cached blocks into exact fits for them, so
+   ** those allocations skip the best-fit search and split. Best-effort:
+   ** nothing is requested from the system allocator, expandable segments
+   ** are left to the regular mapping logic, and a hint with no suitable
+   ** cached block simply falls through to the normal malloc path (counted
+   ** as a miss when the allocation arrives). **/
+  void setAllocationHints(
+      int device,
+      cudaStream_t stream,
+      const std::vector<size_t>& sizes) {
+    std::lock_guard<std::recursive_mutex> lock(mutex);
+    pending_hint_sizes.clear();
+    for (const size_t orig_size : sizes) {
+      if (orig_size == 0) {
+        continue;
+      }
+      const size_t size = round_size(orig_size);
+      ++pending_hint_sizes[size];
+      ++hint_stats.hinted;
+      presplit_block_for_hint(device, size, stream);
+    }
+  }
+
+  AllocationHintStats getAllocationHintStats() {
+    std::lock_guard<std::recursive_mutex> lock(mutex);
+    return hint_stats;
+  }
+
+  /** returns the physical pages backing free ranges of expandable segments
+   ** to the driver while keeping their virtual address reservations, so
+   ** fragmentation can be reclaimed without flushing the whole cache. **/
+  size_t compactExpandableSegments() {
+    std::lock_guard<std::recursive_mutex> lock(mutex);
+    const size_t agg = static_cast<size_t>(StatType::AGGREGATE);
+    const int64_t reserved_before = stats.reserved_bytes[agg].current;
+    for (BlockPool* pool : {&large_blocks, &small_blocks}) {
+      std::vector<Block*> to_unmap;
+      for (Block* block : pool->blocks) {
+        if (block->expandable_segment_) {
+          // unmapping will mutate the free pool, so gather first to avoid
+          // invalidating the iterator (same as release_blocks)
+          to_unmap.push_back(block);
+        }
+      }
+      for (Block* block : to_unmap) {
+        unmap_block(block);
+        if (!block->prev && !block->next) {
+          release_expandable_segment(block);
+        }
+      }
+    }
+    return static_cast<size_t>(
+        reserved_before - stats.reserved_bytes[agg].current);
+  }
+
   /** Retrieves size of largest unused block held by the memory cache **/
   void cacheInfo(size_t* largest) {
     std::lock_guard<std::recursive_mutex> lock(mutex);
@@ -1838,6 +2035,63 @@ class DeviceCachingAllocator {
     }
   }
 
+  // Routes every subsequent allocation on `stream` to the private pool
+  // `mempool_id`, creating the pool on first use. Unlike
+  // beginAllocateStreamToPool this is independent of graph capture (event
+  // processing keeps running), so it can back long-lived tenant streams.
+  void assignStreamToPool(cudaStream_t stream, MempoolId_t mempool_id) {
+    std::lock_guard<std::recursive_mutex> lock(mutex);
+    auto it = graph_pools.find(mempool_id);
+    if (it == graph_pools.end()) {
+      graph_pools.emplace(mempool_id, std::make_unique<PrivatePool>());
+    } else {
+      // Sharing one pool between several streams is allowed (it trades some
+      // isolation for capacity); each assignment holds a reference.
+      TORCH_INTERNAL_ASSERT(it->second->use_count > 0);
+      it->second->use_count++;
+    }
+    bool inserted = user_stream_to_pool_map.insert({stream, mempool_id}).second;
+    TORCH_CHECK(inserted, "stream is already assigned to a private pool");
+  }
+
+  // Detaches `stream` from its private pool. Each assignment holds one
+  // reference on the pool; dropping the last one makes the pool's cached
+  // segments eligible for release, through the same path releasePool uses
+  // for graph pools. Outstanding allocations stay valid either way.
+  void unassignStreamFromPool(cudaStream_t stream) {
+    std::lock_guard<std::recursive_mutex> lock(mutex);
+    auto it = user_stream_to_pool_map.find(stream);
+    TORCH_CHECK(
+        it != user_stream_to_pool_map.end(),
+        "stream has no private pool assigned");
+    auto mempool_id = it->second;
+    user_stream_to_pool_map.erase(it);
+    releasePool(mempool_id);
+  }
+
+  // On-demand usage numbers for one private pool; see PoolStats.
+  PoolStats getPoolStats(MempoolId_t mempool_id) {
+    std::lock_guard<std::recursive_mutex> lock(mutex);
+    auto it = graph_pools.find(mempool_id);
+    TORCH_CHECK(it != graph_pools.end(), "Could not find pool of id");
+    PrivatePool* pool = it->second.get();
+    PoolStats stats;
+    for (const BlockPool* bp : {&pool->large_blocks, &pool->small_blocks}) {
+      for (const Block* b : bp->blocks) {
+        stats.reserved_bytes += static_cast<uint64_t>(b->size);
+        stats.free_block_count++;
+      }
+    }
+    for (const Block* b : active_blocks) {
+      if (b->pool->owner_PrivatePool == pool) {
+        stats.reserved_bytes += static_cast<uint64_t>(b->size);
+        stats.allocated_bytes += static_cast<uint64_t>(b->size);
+        stats.active_block_count++;
+      }
+    }
+    return stats;
+  }
+
   void addPeerAccess(int dev_to_access) {
     if (std::find(
             devices_with_peer_access_.begin(),
@@ -2065,6 +2319,28 @@ class DeviceCachingAllocator {
     size_t requested_size = block->requested_size;
 
     auto& pool = *block->pool;
+
+    if (block->address_stable) {
+      // The caller pinned this address (see setAddressStable in
+      // CUDACachingAllocator.h): park the block outside the free pools,
+      // where splitting, merging and new allocations cannot reach it, until
+      // the pin is cleared via releaseReservedStableBlock.
+      active_blocks.erase(block);
+      block->last_use_tick = ++allocator_tick;
+      bool inserted = stable_reserved_blocks.emplace(block->ptr, block).second;
+      TORCH_INTERNAL_ASSERT(inserted);
+      StatTypes stable_stat_types = get_stat_types_for_pool(pool);
+      for_each_selected_stat_type(stable_stat_types, [&](size_t stat_type) {
+        update_stat(stats.active[stat_type], -1);
+        update_stat(
+            stats.active_bytes[stat_type],
+            -static_cast<std::int64_t>(original_block_size));
+        update_stat(
+            stats.requested_bytes[stat_type],
+            -static_cast<std::int64_t>(requested_size));
+      });
+      return;
+    }
     int64_t net_change_inactive_split_blocks = 0;
     int64_t net_change_inactive_split_size = 0;
 
@@ -2079,6 +2355,7 @@ class DeviceCachingAllocator {
     }
 
     active_blocks.erase(block);
+    block->last_use_tick = ++allocator_tick;
     // Makes sure the Block* isn't already present in the pool we're freeing it
     // back into.
     bool inserted = pool.blocks.insert(block).second;
@@ -2119,7 +2396,8 @@ class DeviceCachingAllocator {
    * or 0 on failure. */
   size_t try_merge_blocks(Block* dst, Block* src, BlockPool& pool) {
     if (!src || src->allocated || src->event_count > 0 ||
-        !src->stream_uses.empty() || dst->mapped != src->mapped) {
+        !src->stream_uses.empty() || src->address_stable ||
+        dst->mapped != src->mapped) {
       return 0;
     }
 
@@ -2150,6 +2428,20 @@ class DeviceCachingAllocator {
   }
 
   BlockPool& get_pool(size_t size, cudaStream_t stream) {
+    // Streams with a user-assigned private pool (see assignStreamToPool)
+    // always allocate from it, independent of graph capture.
+    if (C10_UNLIKELY(!user_stream_to_pool_map.empty())) {
+      auto it0 = user_stream_to_pool_map.find(stream);
+      if (it0 != user_stream_to_pool_map.end()) {
+        auto it1 = graph_pools.find(it0->second);
+        TORCH_INTERNAL_ASSERT(it1 != graph_pools.end());
+        if (size <= kSmallSize) {
+          return it1->second->small_blocks;
+        } else {
+          return it1->second->large_blocks;
+        }
+      }
+    }
 #if !defined(USE_ROCM) || ROCM_VERSION >= 50300
     // captures_underway is a conservative guess that the current stream may be
     // capturing. It's only > 0 if some thread has begun and not yet ended a
@@ -2203,6 +2495,50 @@ class DeviceCachingAllocator {
     }
   }
 
+  // Carves an exact `size` free block out of the pool serving (size,
+  // stream), so the hinted allocation later finds a ready fit at the front
+  // of its search. Both halves stay free in the pool; requires the lock.
+  void presplit_block_for_hint(int device, size_t size, cudaStream_t stream) {
+    BlockPool& pool = get_pool(size, stream);
+    const size_t alloc_size = get_allocation_size(size);
+    AllocParams params(device, size, stream, &pool, alloc_size, stats);
+    params.stat_types = get_stat_types_for_pool(pool);
+    if (!get_free_block(params)) {
+      return;
+    }
+    Block* block = params.block;
+    // Expandable segments grow on demand in alloc_block; splitting them
+    // here would bypass that mapping logic, so leave them to malloc. An
+    // exact fit or an unsplittable block is already as good as it gets.
+    if (block->expandable_segment_ || !should_split(block, size)) {
+      pool.blocks.insert(block);
+      return;
+    }
+    const bool already_split = block->is_split();
+    Block* remaining = block;
+    block = new Block(device, stream, size, &pool, block->ptr);
+    block->prev = remaining->prev;
+    if (block->prev) {
+      block->prev->next = block;
+    }
+    block->next = remaining;
+    remaining->prev = block;
+    remaining->ptr = static_cast<char*>(remaining->ptr) + size;
+    remaining->size -= size;
+    pool.blocks.insert(remaining);
+    pool.blocks.insert(block);
+    // One more inactive split block exists now; if the block was whole
+    // before, both halves newly count as split bytes.
+    for_each_selected_stat_type(params.stat_types, [&](size_t stat_type) {
+      update_stat(stats.inactive_split[stat_type], already_split ? 1 : 2);
+      if (!already_split) {
+        update_stat(
+            stats.inactive_split_bytes[stat_type],
+            static_cast<std::int64_t>(block->size + remaining->size));
+      }
+    });
+  }
+
   bool get_free_block(AllocParams& p) {
     BlockPool& pool = *p.pool;
 
@@ -2944,6 +3280,68 @@ class NativeCachingAllocator : public CUDAAllocator {
       da->emptyCache();
   }
 
+  size_t releaseSomeCache(int device, size_t target_bytes) override {
+    assertValidDevice(device);
+    return device_allocator[device]->releaseSomeCachedBlocks(target_bytes);
+  }
+
+  size_t compactExpandableSegments(int device) override {
+    assertValidDevice(device);
+    return device_allocator[device]->compactExpandableSegments();
+  }
+
+  void setAllocationHints(
+      int device,
+      cudaStream_t stream,
+      const std::vector<size_t>& sizes) override {
+    assertValidDevice(device);
+    device_allocator[device]->setAllocationHints(device, stream, sizes);
+  }
+
+  AllocationHintStats getAllocationHintStats(int device) override {
+    assertValidDevice(device);
+    return device_allocator[device]->getAllocationHintStats();
+  }
+
+  void setAddressStable(void* ptr, bool stable) override {
+    TORCH_CHECK(ptr, "setAddressStable: got a null pointer");
+    Block* block = get_allocated_block(ptr);
+    if (block) {
+      device_allocator[block->device]->setBlockAddressStable(block, stable);
+      return;
+    }
+    if (!stable) {
+      // The tensor may already have been freed while pinned, leaving its
+      // block parked; unpinning returns it to its pool.
+      for (auto& da : device_allocator) {
+        if (da->releaseReservedStableBlock(ptr)) {
+          return;
+        }
+      }
+    }
+    TORCH_CHECK(
+        false,
+        "setAddressStable: pointer was not allocated by the CUDA caching "
+        "allocator: ",
+        ptr);
+  }
+
+  bool isAddressStable(void* ptr) override {
+    if (!ptr) {
+      return false;
+    }
+    Block* block = get_allocated_block(ptr);
+    if (block) {
+      return device_allocator[block->device]->blockIsAddressStable(block);
+    }
+    for (auto& da : device_allocator) {
+      if (da->isReservedStable(ptr)) {
+        return true;
+      }
+    }
+    return false;
+  }
+
   void* getBaseAllocation(void* ptr, size_t* outSize) override {
     Block* block = get_allocated_block(ptr);
     if (!block) {
@@ -3077,6 +3475,14 @@ class NativeCachingAllocator : public CUDAAllocator {
       return &local_raw_delete;
     }
   }
+  void copy_data(void* dest, const void* src, std::size_t count) const override {
+    C10_CUDA_CHECK(cudaMemcpyAsync(
+        dest,
+        src,
+        count,
+        cudaMemcpyDeviceToDevice,
+        cuda::getCurrentCUDAStream()));
+  }
   void cacheInfo(int dev_id, size_t* largestBlock) override {
     device_allocator[dev_id]->cacheInfo(largestBlock);
   }
@@ -3123,6 +3529,25 @@ class NativeCachingAllocator : public CUDAAllocator {
     device_allocator[device]->releasePool(std::move(mempool_id));
   }
 
+  // Per-stream private pools; see CUDAAllocator::assignStreamToPool.
+  void assignStreamToPool(
+      int device,
+      cudaStream_t stream,
+      MempoolId_t mempool_id) override {
+    assertValidDevice(device);
+    device_allocator[device]->assignStreamToPool(stream, std::move(mempool_id));
+  }
+
+  void unassignStreamFromPool(int device, cudaStream_t stream) override {
+    assertValidDevice(device);
+    device_allocator[device]->unassignStreamFromPool(stream);
+  }
+
+  PoolStats getPoolStats(int device, MempoolId_t mempool_id) override {
+    assertValidDevice(device);
+    return device_allocator[device]->getPoolStats(std::move(mempool_id));
+  }
+
   void* raw_alloc(size_t nbytes) override {
     if (nbytes == 0) {
       return nullptr;
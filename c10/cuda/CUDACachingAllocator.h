@@ -12,6 +12,7 @@
 #include <mutex>
 #include <set>
 #include <unordered_set>
+#include <vector>
 
 namespace c10 {
 
@@ -102,6 +103,34 @@ struct DeviceStats {
   int64_t max_split_size = 0;
 };
 
+// Aggregate usage numbers for one private memory pool (see
+// assignStreamToPool). Unlike DeviceStats these are not maintained
+// per-allocation; they are computed on demand by walking the pool.
+struct PoolStats {
+  // SUM: bytes of segments owned by the pool (both free and allocated)
+  uint64_t reserved_bytes = 0;
+  // SUM: bytes in blocks currently allocated out of the pool
+  uint64_t allocated_bytes = 0;
+  // COUNT: blocks currently allocated out of the pool
+  uint64_t active_block_count = 0;
+  // COUNT: cached free blocks held by the pool
+  uint64_t free_block_count = 0;
+};
+
+// Outcome counters for graph-aware allocation hints (see
+// setAllocationHints). A hit means a hinted-size allocation was served by
+// an exact-size cached block; a sustained miss rate means the predicted
+// allocation sequence no longer matches what the graph actually does.
+struct AllocationHintStats {
+  // COUNT: hinted allocation sizes received
+  uint64_t hinted = 0;
+  // COUNT: hinted-size allocations served by an exact-size free block
+  uint64_t hits = 0;
+  // COUNT: hinted-size allocations that fell back to the regular
+  // search/split/cudaMalloc path
+  uint64_t misses = 0;
+};
+
 typedef std::shared_ptr<GatheredContext> (*CreateContextFn)(void);
 
 // Struct containing info of an allocation block (i.e. a fractional part of a
@@ -223,6 +252,79 @@ class CUDAAllocator : public Allocator {
   virtual bool initialized() = 0;
   virtual void setMemoryFraction(double fraction, int device) = 0;
   virtual void emptyCache() = 0;
+  // Incremental alternative to emptyCache for `device`: frees whole cached
+  // blocks, coldest first (ordered by when they last returned to the cache),
+  // until roughly target_bytes have been given back to the system allocator.
+  // Does not synchronize on outstanding events, so the cost is bounded by
+  // the number of blocks freed and it is cheap enough to call periodically
+  // from a background thread. Returns the number of bytes released.
+  virtual size_t releaseSomeCache(int device, size_t target_bytes) {
+    TORCH_CHECK(
+        false,
+        name(),
+        " does not yet support releaseSomeCache. "
+        "If you need it, please file an issue describing your use case.");
+  }
+  // With expandable_segments, returns the physical pages backing currently
+  // free ranges of each segment on `device` to the driver while keeping the
+  // virtual address reservations, so long-running processes can reclaim
+  // fragmentation without a full emptyCache. Returns the bytes unmapped.
+  virtual size_t compactExpandableSegments(int device) {
+    TORCH_CHECK(
+        false,
+        name(),
+        " does not yet support compactExpandableSegments. "
+        "If you need it, please file an issue describing your use case.");
+  }
+  // Address pinning for CUDA graph users. Graph replay bakes device
+  // addresses into the captured work, so a graph stays valid only while the
+  // tensors it reads and writes keep their addresses. Marking a pointer
+  // address-stable guarantees the allocator never reassigns its block: if
+  // the allocation is freed while pinned, the block is parked outside the
+  // free pools — immune to splitting, merging, reuse and emptyCache — until
+  // the pin is cleared, at which point it returns to circulation.
+  // isAddressStable is the query side, so graph code can assert stability
+  // before replaying. Both take the tensor's device pointer.
+  virtual void setAddressStable(void* ptr, bool stable) {
+    TORCH_CHECK(
+        false,
+        name(),
+        " does not yet support setAddressStable. "
+        "If you need it, please file an issue describing your use case.");
+  }
+  virtual bool isAddressStable(void* ptr) {
+    TORCH_CHECK(
+        false,
+        name(),
+        " does not yet support isAddressStable. "
+        "If you need it, please file an issue describing your use case.");
+  }
+  // Graph-aware allocation hints. A graph executor that has settled on an
+  // optimized plan knows the sizes of the allocations the next run will
+  // make (see ProfilingGraphExecutorImpl); forwarding them here lets the
+  // allocator pre-split cached blocks into exact fits on `stream`, so the
+  // mid-graph allocation path finds a ready block instead of paying for a
+  // best-fit search and split. Purely best-effort: no device memory is
+  // requested from the system, and a wrong prediction costs nothing
+  // beyond the counters in getAllocationHintStats, which exist so callers
+  // can validate their predictions before trusting them.
+  virtual void setAllocationHints(
+      int device,
+      cudaStream_t stream,
+      const std::vector<size_t>& sizes) {
+    TORCH_CHECK(
+        false,
+        name(),
+        " does not yet support setAllocationHints. "
+        "If you need it, please file an issue describing your use case.");
+  }
+  virtual AllocationHintStats getAllocationHintStats(int device) {
+    TORCH_CHECK(
+        false,
+        name(),
+        " does not yet support getAllocationHintStats. "
+        "If you need it, please file an issue describing your use case.");
+  }
   virtual void cacheInfo(int dev_id, size_t* largestBlock) = 0;
   virtual void* getBaseAllocation(void* ptr, size_t* size) = 0;
   virtual void recordStream(const DataPtr&, CUDAStream stream) = 0;
@@ -236,6 +338,38 @@ class CUDAAllocator : public Allocator {
       MempoolId_t mempool_id) = 0;
   virtual void endAllocateStreamToPool(int device, cudaStream_t stream) = 0;
   virtual void releasePool(int device, MempoolId_t mempool_id) = 0;
+  // Per-stream private pools. Unlike the beginAllocateStreamToPool capture
+  // machinery above, these are independent of CUDA graph capture: every
+  // allocation on the assigned stream is served from the given pool and freed
+  // blocks return to it, so concurrent streams never exchange blocks (and
+  // never inherit the cross-stream event dependencies such reuse creates).
+  // Useful for multi-tenant setups where each tenant owns a stream. The pool
+  // is created on first assignment; once the last stream is unassigned, its
+  // cached segments become eligible for release.
+  virtual void assignStreamToPool(
+      int device,
+      cudaStream_t stream,
+      MempoolId_t mempool_id) {
+    TORCH_CHECK(
+        false,
+        name(),
+        " does not yet support assignStreamToPool. "
+        "If you need it, please file an issue describing your use case.");
+  }
+  virtual void unassignStreamFromPool(int device, cudaStream_t stream) {
+    TORCH_CHECK(
+        false,
+        name(),
+        " does not yet support unassignStreamFromPool. "
+        "If you need it, please file an issue describing your use case.");
+  }
+  virtual PoolStats getPoolStats(int device, MempoolId_t mempool_id) {
+    TORCH_CHECK(
+        false,
+        name(),
+        " does not yet support getPoolStats. "
+        "If you need it, please file an issue describing your use case.");
+  }
   // returns true if the allocated blocks are equal to expected live allocations
   virtual bool checkPoolLiveAllocations(
       int device,
@@ -336,6 +470,33 @@ inline void emptyCache() {
   return get()->emptyCache();
 }
 
+inline size_t releaseSomeCache(int device, size_t target_bytes) {
+  return get()->releaseSomeCache(device, target_bytes);
+}
+
+inline size_t compactExpandableSegments(int device) {
+  return get()->compactExpandableSegments(device);
+}
+
+inline void setAddressStable(void* ptr, bool stable) {
+  return get()->setAddressStable(ptr, stable);
+}
+
+inline bool isAddressStable(void* ptr) {
+  return get()->isAddressStable(ptr);
+}
+
+inline void setAllocationHints(
+    int device,
+    cudaStream_t stream,
+    const std::vector<size_t>& sizes) {
+  return get()->setAllocationHints(device, stream, sizes);
+}
+
+inline AllocationHintStats getAllocationHintStats(int device) {
+  return get()->getAllocationHintStats(device);
+}
+
 inline void cacheInfo(int dev_id, size_t* largestBlock) {
   return get()->cacheInfo(dev_id, largestBlock);
 }
@@ -388,6 +549,22 @@ inline void endAllocateStreamToPool(int device, cudaStream_t stream) {
   return get()->endAllocateStreamToPool(device, stream);
 }
 
+// Per-stream private pools; see CUDAAllocator::assignStreamToPool.
+inline void assignStreamToPool(
+    int device,
+    cudaStream_t stream,
+    MempoolId_t mempool_id) {
+  return get()->assignStreamToPool(device, stream, mempool_id);
+}
+
+inline void unassignStreamFromPool(int device, cudaStream_t stream) {
+  return get()->unassignStreamFromPool(device, stream);
+}
+
+inline PoolStats getPoolStats(int device, MempoolId_t mempool_id) {
+  return get()->getPoolStats(device, mempool_id);
+}
+
 inline void recordHistory(
     bool enabled,
     CreateContextFn context_recorder,
@@ -26,6 +26,8 @@
   _(cuMemSetAccess)               \
   _(cuMemUnmap)                   \
   _(cuMemCreate)                  \
+  _(cuStreamWriteValue64)         \
+  _(cuStreamWaitValue64)          \
   _(cuGetErrorString)
 
 #define C10_NVML_DRIVER_API(_)        \
@@ -228,6 +228,16 @@ using namespace c10::hip;
 #define C10_ALWAYS_INLINE inline
 #endif
 
+/// C10_COLD - Functions annotated with this are considered unlikely to be
+/// called (e.g. error reporting) and are optimized for size rather than
+/// speed; on supporting compilers they are also moved to a cold text
+/// section, keeping them out of the instruction cache of the hot path.
+#if __has_attribute(cold) || defined(__GNUC__)
+#define C10_COLD __attribute__((cold))
+#else
+#define C10_COLD
+#endif
+
 #if defined(_MSC_VER)
 #define C10_ATTR_VISIBILITY_HIDDEN
 #elif defined(__GNUC__)
@@ -0,0 +1,52 @@
+#include <c10/core/CPUAllocationArena.h>
+#include <c10/core/CPUAllocator.h>
+
+#include <gtest/gtest.h>
+
+namespace {
+
+TEST(CPUAllocationArenaTest, GuardSwapsThreadAllocator) {
+  ASSERT_EQ(c10::ThreadLocalCPUAllocationArena(), nullptr);
+  c10::CPUAllocationArena arena;
+  {
+    c10::CPUAllocationArenaGuard guard(&arena);
+    EXPECT_EQ(c10::ThreadLocalCPUAllocationArena(), &arena);
+    EXPECT_EQ(c10::GetCPUAllocator(), &arena);
+  }
+  EXPECT_EQ(c10::ThreadLocalCPUAllocationArena(), nullptr);
+  EXPECT_NE(c10::GetCPUAllocator(), &arena);
+}
+
+TEST(CPUAllocationArenaTest, BumpAllocationsAreDistinctAndWritable) {
+  c10::CPUAllocationArena arena;
+  auto a = arena.allocate(1024);
+  auto b = arena.allocate(1024);
+  ASSERT_NE(a.get(), nullptr);
+  ASSERT_NE(b.get(), nullptr);
+  EXPECT_NE(a.get(), b.get());
+  memset(a.get(), 0xaa, 1024);
+  memset(b.get(), 0xbb, 1024);
+  EXPECT_EQ(static_cast<unsigned char*>(a.get())[0], 0xaa);
+  EXPECT_EQ(static_cast<unsigned char*>(b.get())[1023], 0xbb);
+  EXPECT_GE(arena.allocated_bytes(), 2048u);
+}
+
+TEST(CPUAllocationArenaTest, OversizedAllocationGetsDedicatedSlab) {
+  c10::CPUAllocationArena arena(/*slab_bytes=*/4096);
+  auto big = arena.allocate(1 << 20);
+  ASSERT_NE(big.get(), nullptr);
+  memset(big.get(), 0, 1 << 20);
+}
+
+TEST(CPUAllocationArenaTest, NestedGuardsRestorePrevious) {
+  c10::CPUAllocationArena outer;
+  c10::CPUAllocationArena inner;
+  c10::CPUAllocationArenaGuard outer_guard(&outer);
+  {
+    c10::CPUAllocationArenaGuard inner_guard(&inner);
+    EXPECT_EQ(c10::ThreadLocalCPUAllocationArena(), &inner);
+  }
+  EXPECT_EQ(c10::ThreadLocalCPUAllocationArena(), &outer);
+}
+
+} // namespace
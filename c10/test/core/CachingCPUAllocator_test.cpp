@@ -0,0 +1,53 @@
+#include <c10/core/CachingCPUAllocator.h>
+
+#include <gtest/gtest.h>
+
+namespace {
+
+using namespace c10::caching_cpu_allocator;
+
+TEST(CachingCPUAllocatorTest, ReusesFreedBlock) {
+  auto* allocator = get();
+  void* first = nullptr;
+  {
+    auto ptr = allocator->allocate(4096);
+    first = ptr.get();
+    ASSERT_NE(first, nullptr);
+  }
+  auto before = getStats();
+  auto ptr = allocator->allocate(4096);
+  auto after = getStats();
+  EXPECT_EQ(ptr.get(), first);
+  EXPECT_EQ(after.hits, before.hits + 1);
+}
+
+TEST(CachingCPUAllocatorTest, RoundsWithinSizeClass) {
+  auto* allocator = get();
+  void* first = nullptr;
+  {
+    auto ptr = allocator->allocate(3000);
+    first = ptr.get();
+  }
+  // 3000 and 4096 share the 4096-byte size class.
+  auto ptr = allocator->allocate(4096);
+  EXPECT_EQ(ptr.get(), first);
+}
+
+TEST(CachingCPUAllocatorTest, EmptyCacheReleasesPooledBytes) {
+  auto* allocator = get();
+  { auto ptr = allocator->allocate(1 << 20); }
+  EXPECT_GT(getStats().cached_bytes, 0u);
+  emptyCache();
+  EXPECT_EQ(getStats().cached_bytes, 0u);
+}
+
+TEST(CachingCPUAllocatorTest, OversizedBypassesCache) {
+  auto* allocator = get();
+  auto before = getStats();
+  { auto ptr = allocator->allocate((64ULL << 20) + 1); }
+  auto after = getStats();
+  EXPECT_EQ(after.uncached_allocations, before.uncached_allocations + 1);
+  EXPECT_EQ(after.cached_bytes, before.cached_bytes);
+}
+
+} // namespace
@@ -23,6 +23,31 @@ TEST(SymIntTest, CheckRange) {
   EXPECT_FALSE(SymInt::check_range(INT64_MIN));
 }
 
+TEST(SymIntTest, ConcreteIntArithmetic) {
+  const auto a = SymInt(6);
+  const auto b = SymInt(4);
+  EXPECT_EQ((a + b).maybe_as_int(), c10::make_optional<int64_t>(10));
+  EXPECT_EQ((a - b).maybe_as_int(), c10::make_optional<int64_t>(2));
+  EXPECT_EQ((a * b).maybe_as_int(), c10::make_optional<int64_t>(24));
+  EXPECT_TRUE(a > b);
+  EXPECT_TRUE(a >= b);
+  EXPECT_FALSE(a < b);
+  EXPECT_FALSE(a <= b);
+  EXPECT_FALSE(a == b);
+  EXPECT_TRUE(a != b);
+
+  // Results that leave the packed range are promoted to heap-allocated
+  // constants but keep their integer value.
+  const auto big_neg = SymInt(SymInt::min_representable_int()) - SymInt(1);
+  EXPECT_TRUE(big_neg.is_heap_allocated());
+  EXPECT_EQ(
+      big_neg.maybe_as_int(),
+      c10::make_optional(SymInt::min_representable_int() - 1));
+  EXPECT_EQ(
+      (big_neg + SymInt(1)).maybe_as_int(),
+      c10::make_optional(SymInt::min_representable_int()));
+}
+
 TEST(SymIntTest, SingletonSymNode) {
   auto a = c10::SymInt(
       c10::SymNode(c10::make_intrusive<c10::SingletonSymNodeImpl>(1, 1)));
@@ -0,0 +1,71 @@
+#include <c10/core/WorkStealingThreadPool.h>
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+
+namespace {
+
+TEST(WorkStealingThreadPoolTest, RunsAllTasks) {
+  c10::WorkStealingThreadPool pool(4);
+  constexpr int kNumTasks = 1000;
+  std::atomic<int> count{0};
+  std::mutex mutex;
+  std::condition_variable cv;
+  for (int i = 0; i < kNumTasks; i++) {
+    pool.run([&]() {
+      if (count.fetch_add(1) + 1 == kNumTasks) {
+        std::lock_guard<std::mutex> lock(mutex);
+        cv.notify_one();
+      }
+    });
+  }
+  std::unique_lock<std::mutex> lock(mutex);
+  cv.wait(lock, [&]() { return count.load() == kNumTasks; });
+  EXPECT_EQ(count.load(), kNumTasks);
+}
+
+TEST(WorkStealingThreadPoolTest, SizeAndMembership) {
+  c10::WorkStealingThreadPool pool(2);
+  EXPECT_EQ(pool.size(), 2u);
+  EXPECT_FALSE(pool.inThreadPool());
+  std::atomic<bool> inside{false};
+  std::atomic<bool> done{false};
+  std::mutex mutex;
+  std::condition_variable cv;
+  pool.run([&]() {
+    inside.store(pool.inThreadPool());
+    std::lock_guard<std::mutex> lock(mutex);
+    done.store(true);
+    cv.notify_one();
+  });
+  std::unique_lock<std::mutex> lock(mutex);
+  cv.wait(lock, [&]() { return done.load(); });
+  EXPECT_TRUE(inside.load());
+}
+
+TEST(WorkStealingThreadPoolTest, CountersAreMonotonic) {
+  c10::WorkStealingThreadPool pool(4);
+  const auto steals_before = pool.steal_count();
+  const auto overflows_before = pool.overflow_count();
+  std::atomic<int> count{0};
+  std::mutex mutex;
+  std::condition_variable cv;
+  constexpr int kNumTasks = 4000;
+  for (int i = 0; i < kNumTasks; i++) {
+    pool.run([&]() {
+      if (count.fetch_add(1) + 1 == kNumTasks) {
+        std::lock_guard<std::mutex> lock(mutex);
+        cv.notify_one();
+      }
+    });
+  }
+  std::unique_lock<std::mutex> lock(mutex);
+  cv.wait(lock, [&]() { return count.load() == kNumTasks; });
+  EXPECT_GE(pool.steal_count(), steals_before);
+  EXPECT_GE(pool.overflow_count(), overflows_before);
+}
+
+} // namespace
@@ -0,0 +1,63 @@
+#include <c10/core/thread_pool.h>
+
+#include <gtest/gtest.h>
+
+#include <future>
+#include <vector>
+
+namespace {
+
+TEST(ThreadPoolTest, RunsAllTasks) {
+  c10::ThreadPool pool(2);
+  std::atomic<int> count{0};
+  constexpr int kNumTasks = 100;
+  for (int i = 0; i < kNumTasks; i++) {
+    pool.run([&]() { count++; });
+  }
+  pool.waitWorkComplete();
+  EXPECT_EQ(count.load(), kNumTasks);
+}
+
+TEST(ThreadPoolTest, HigherPriorityTasksRunFirst) {
+  c10::ThreadPool pool(1);
+
+  // Block the single worker so the queued tasks below cannot start until
+  // all of them have been submitted.
+  std::promise<void> gate;
+  std::shared_future<void> gate_future = gate.get_future().share();
+  pool.run([gate_future]() { gate_future.wait(); });
+
+  std::mutex mutex;
+  std::vector<uint8_t> order;
+  auto record = [&](uint8_t priority) {
+    return [&order, &mutex, priority]() {
+      std::lock_guard<std::mutex> lock(mutex);
+      order.push_back(priority);
+    };
+  };
+  pool.run_with_priority(
+      record(c10::ThreadPool::kLowPriority), c10::ThreadPool::kLowPriority);
+  pool.run_with_priority(
+      record(c10::ThreadPool::kNormalPriority),
+      c10::ThreadPool::kNormalPriority);
+  pool.run_with_priority(
+      record(c10::ThreadPool::kHighPriority), c10::ThreadPool::kHighPriority);
+
+  gate.set_value();
+  pool.waitWorkComplete();
+
+  ASSERT_EQ(order.size(), 3u);
+  EXPECT_EQ(order[0], c10::ThreadPool::kHighPriority);
+  EXPECT_EQ(order[1], c10::ThreadPool::kNormalPriority);
+  EXPECT_EQ(order[2], c10::ThreadPool::kLowPriority);
+}
+
+TEST(ThreadPoolTest, OutOfRangePriorityIsClamped) {
+  c10::ThreadPool pool(1);
+  std::atomic<bool> ran{false};
+  pool.run_with_priority([&]() { ran = true; }, 200);
+  pool.waitWorkComplete();
+  EXPECT_TRUE(ran.load());
+}
+
+} // namespace
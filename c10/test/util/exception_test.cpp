@@ -90,6 +90,26 @@ static void failInternalAssert() {
   TORCH_INTERNAL_ASSERT(false, "message ", getAssertionArgument());
 }
 
+TEST(ExceptionTest, LazyWhatRendering) {
+  try {
+    TORCH_CHECK(false, "lazy message");
+  } catch (const Error& e) {
+    // what() is rendered (and the backtrace symbolized) on first access and
+    // cached afterwards.
+    const char* first = e.what();
+    EXPECT_NE(std::string(first).find("lazy message"), std::string::npos);
+    EXPECT_EQ(first, e.what());
+
+    // add_context() invalidates the cached rendering.
+    Error copy = e;
+    copy.add_context("some context");
+    EXPECT_NE(std::string(copy.what()).find("some context"), std::string::npos);
+    EXPECT_NE(
+        std::string(copy.what_without_backtrace()).find("some context"),
+        std::string::npos);
+  }
+}
+
 TEST(ExceptionTest, DontCallArgumentFunctionsTwiceOnFailure) {
   assertionArgumentCounter = 0;
   // NOLINTNEXTLINE(cppcoreguidelines-avoid-goto,hicpp-avoid-goto)
@@ -0,0 +1,87 @@
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include <c10/util/Lazy.h>
+#include <gtest/gtest.h>
+
+namespace c10_test {
+
+// Long enough not to fit in typical SSO.
+const std::string kLongString = "I am a long enough string";
+
+TEST(LazyTest, OptimisticLazy) {
+  std::atomic<size_t> invocations{0};
+  auto factory = [&] {
+    ++invocations;
+    return kLongString;
+  };
+
+  c10::OptimisticLazy<std::string> s;
+
+  constexpr size_t kNumThreads = 16;
+  std::vector<std::thread> threads;
+  std::atomic<std::string*> address{nullptr};
+
+  for (size_t i = 0; i < kNumThreads; ++i) {
+    threads.emplace_back([&] {
+      auto* p = &s.ensure(factory);
+      auto old = address.exchange(p);
+      if (old != nullptr) {
+        // Even racing threads observe the same value.
+        EXPECT_EQ(old, p);
+      }
+    });
+  }
+
+  for (auto& t : threads) {
+    t.join();
+  }
+
+  // There may have been racing invocations, but the value was computed at
+  // least once and all threads saw it.
+  EXPECT_GE(invocations.load(), 1);
+  EXPECT_EQ(s.ensure(factory), kLongString);
+
+  invocations = 0;
+  s.reset();
+  EXPECT_EQ(s.ensure(factory), kLongString);
+  EXPECT_EQ(invocations.load(), 1);
+
+  invocations = 0;
+  auto copy = s;
+  EXPECT_EQ(copy.ensure(factory), kLongString);
+  EXPECT_EQ(invocations.load(), 0);
+
+  auto moved = std::move(s);
+  EXPECT_EQ(moved.ensure(factory), kLongString);
+  EXPECT_EQ(invocations.load(), 0);
+  // A moved-from value is empty and recomputes.
+  // NOLINTNEXTLINE(bugprone-use-after-move)
+  EXPECT_EQ(s.ensure(factory), kLongString);
+  EXPECT_EQ(invocations.load(), 1);
+}
+
+TEST(LazyTest, PrecomputedLazyValue) {
+  class LazyString : public c10::PrecomputedLazyValue<std::string> {
+   public:
+    using PrecomputedLazyValue::PrecomputedLazyValue;
+  };
+  EXPECT_EQ(LazyString(kLongString).get(), kLongString);
+}
+
+TEST(LazyTest, OptimisticLazyValue) {
+  class LazyString : public c10::OptimisticLazyValue<std::string> {
+    std::string compute() const override {
+      return kLongString;
+    }
+  };
+
+  LazyString s;
+  EXPECT_EQ(s.get(), kLongString);
+
+  // Returned references are stable.
+  EXPECT_EQ(&s.get(), &s.get());
+}
+
+} // namespace c10_test
@@ -173,75 +173,13 @@ c10::optional<FrameInformation> parse_frame_information(
   frame.function_name = demangle(mangled_function_name.c_str());
   return frame;
 }
-#endif /* !defined(C10_ANDROID) */
-} // anonymous namespace
-#elif defined(_MSC_VER)
-namespace {
-const int max_name_len = 256;
-std::string get_module_base_name(void* addr) {
-  HMODULE h_module;
-  char module[max_name_len];
-  strcpy(module, "");
-  GetModuleHandleEx(
-      GET_MODULE_HANDLE_EX_FLAG_FROM_ADDRESS |
-          GET_MODULE_HANDLE_EX_FLAG_UNCHANGED_REFCOUNT,
-      (LPCTSTR)addr,
-      &h_module);
-  if (h_module != NULL) {
-    GetModuleFileNameA(h_module, module, max_name_len);
-  }
-  char* last_slash_pos = strrchr(module, '\\');
-  if (last_slash_pos) {
-    std::string module_base_name(last_slash_pos + 1);
-    return module_base_name;
-  } else {
-    std::string module_base_name(module);
-    return module_base_name;
-  }
-}
-class SymbolHelper {
- public:
-  static SymbolHelper& getInstance() {
-    static SymbolHelper instance;
-    return instance;
-  }
-  bool inited = false;
-  HANDLE process;
 
- private:
-  SymbolHelper() {
-    process = GetCurrentProcess();
-    DWORD flags = SymGetOptions();
-    SymSetOptions(flags | SYMOPT_DEFERRED_LOADS);
-    inited = SymInitialize(process, NULL, TRUE);
-  }
-  ~SymbolHelper() {
-    if (inited) {
-      SymCleanup(process);
-    }
-  }
-
- public:
-  SymbolHelper(SymbolHelper const&) = delete;
-  void operator=(SymbolHelper const&) = delete;
-};
-} // anonymous namespace
-#endif // SUPPORTS_BACKTRACE
-
-std::string get_backtrace(
+// NOINLINE so that the number of frames to skip does not depend on whether
+// the compiler decided to inline this helper into its caller.
+C10_NOINLINE std::vector<void*> capture_callstack(
     size_t frames_to_skip,
-    size_t maximum_number_of_frames,
-    bool skip_python_frames) {
-#ifdef FBCODE_CAFFE2
-  // For some reason, the stacktrace implementation in fbcode is
-  // better than ours, see  https://github.com/pytorch/pytorch/issues/56399
-  // When it's available, just use that.
-  facebook::process::StackTrace st;
-  return st.toString();
-
-#elif SUPPORTS_BACKTRACE && !defined(C10_ANDROID)
-
-  // We always skip this frame (backtrace).
+    size_t maximum_number_of_frames) {
+  // We always skip this frame (capture_callstack).
   frames_to_skip += 1;
 
   std::vector<void*> callstack(
@@ -263,7 +201,12 @@ std::string get_backtrace(
   // `callstack`, so this is just a pointer subtraction and makes the subsequent
   // code safer.
   callstack.resize(static_cast<size_t>(number_of_frames));
+  return callstack;
+}
 
+std::string symbolize_callstack(
+    const std::vector<void*>& callstack,
+    bool skip_python_frames) {
   // `backtrace_symbols` takes the return addresses obtained from `backtrace()`
   // and fetches string representations of each stack. Unfortunately it doesn't
   // return a struct of individual pieces of information but a concatenated
@@ -309,6 +252,79 @@ std::string get_backtrace(
   }
 
   return stream.str();
+}
+#endif /* !defined(C10_ANDROID) */
+} // anonymous namespace
+#elif defined(_MSC_VER)
+namespace {
+const int max_name_len = 256;
+std::string get_module_base_name(void* addr) {
+  HMODULE h_module;
+  char module[max_name_len];
+  strcpy(module, "");
+  GetModuleHandleEx(
+      GET_MODULE_HANDLE_EX_FLAG_FROM_ADDRESS |
+          GET_MODULE_HANDLE_EX_FLAG_UNCHANGED_REFCOUNT,
+      (LPCTSTR)addr,
+      &h_module);
+  if (h_module != NULL) {
+    GetModuleFileNameA(h_module, module, max_name_len);
+  }
+  char* last_slash_pos = strrchr(module, '\\');
+  if (last_slash_pos) {
+    std::string module_base_name(last_slash_pos + 1);
+    return module_base_name;
+  } else {
+    std::string module_base_name(module);
+    return module_base_name;
+  }
+}
+class SymbolHelper {
+ public:
+  static SymbolHelper& getInstance() {
+    static SymbolHelper instance;
+    return instance;
+  }
+  bool inited = false;
+  HANDLE process;
+
+ private:
+  SymbolHelper() {
+    process = GetCurrentProcess();
+    DWORD flags = SymGetOptions();
+    SymSetOptions(flags | SYMOPT_DEFERRED_LOADS);
+    inited = SymInitialize(process, NULL, TRUE);
+  }
+  ~SymbolHelper() {
+    if (inited) {
+      SymCleanup(process);
+    }
+  }
+
+ public:
+  SymbolHelper(SymbolHelper const&) = delete;
+  void operator=(SymbolHelper const&) = delete;
+};
+} // anonymous namespace
+#endif // SUPPORTS_BACKTRACE
+
+std::string get_backtrace(
+    size_t frames_to_skip,
+    size_t maximum_number_of_frames,
+    bool skip_python_frames) {
+#ifdef FBCODE_CAFFE2
+  // For some reason, the stacktrace implementation in fbcode is
+  // better than ours, see  https://github.com/pytorch/pytorch/issues/56399
+  // When it's available, just use that.
+  facebook::process::StackTrace st;
+  return st.toString();
+
+#elif SUPPORTS_BACKTRACE && !defined(C10_ANDROID)
+
+  // We skip this frame (get_backtrace) on top of what the caller requested.
+  return symbolize_callstack(
+      capture_callstack(frames_to_skip + 1, maximum_number_of_frames),
+      skip_python_frames);
 
 #elif SUPPORTS_BACKTRACE && defined(C10_ANDROID)
 
@@ -401,4 +417,38 @@ std::string get_backtrace(
 #endif // SUPPORTS_BACKTRACE
 }
 
+Backtrace get_lazy_backtrace(
+    size_t frames_to_skip,
+    size_t maximum_number_of_frames,
+    bool skip_python_frames) {
+#if !defined(FBCODE_CAFFE2) && SUPPORTS_BACKTRACE && !defined(C10_ANDROID)
+  class LazySymbolizedBacktrace : public OptimisticLazyValue<std::string> {
+   public:
+    LazySymbolizedBacktrace(std::vector<void*> callstack, bool skip_python_frames)
+        : callstack_(std::move(callstack)),
+          skip_python_frames_(skip_python_frames) {}
+
+   private:
+    std::string compute() const override {
+      return symbolize_callstack(callstack_, skip_python_frames_);
+    }
+
+    std::vector<void*> callstack_;
+    bool skip_python_frames_;
+  };
+
+  // We skip this frame (get_lazy_backtrace) on top of what the caller
+  // requested; only the raw return addresses are collected here, the
+  // expensive symbolization runs when (if ever) the value is accessed.
+  return std::make_shared<LazySymbolizedBacktrace>(
+      capture_callstack(frames_to_skip + 1, maximum_number_of_frames),
+      skip_python_frames);
+#else
+  // Capture and symbolization cannot be separated on this platform; render
+  // the trace eagerly.
+  return std::make_shared<PrecomputedLazyValue<std::string>>(get_backtrace(
+      frames_to_skip + 1, maximum_number_of_frames, skip_python_frames));
+#endif
+}
+
 } // namespace c10
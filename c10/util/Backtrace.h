@@ -2,16 +2,33 @@
 #define C10_UTIL_BACKTRACE_H_
 
 #include <cstddef>
+#include <memory>
 #include <string>
 #include <typeinfo>
 
 #include <c10/macros/Macros.h>
+#include <c10/util/Lazy.h>
 
 namespace c10 {
+
+// Symbolizing the backtrace is expensive; pass around a LazyValue so the
+// string is only rendered if it is actually printed.
+using Backtrace = std::shared_ptr<const LazyValue<std::string>>;
+
 C10_API std::string get_backtrace(
     size_t frames_to_skip = 0,
     size_t maximum_number_of_frames = 64,
     bool skip_python_frames = true);
+
+// Captures the current callstack cheaply and defers symbolization until the
+// returned value is first accessed.  On platforms where capture and
+// symbolization cannot be separated, the trace is rendered eagerly and the
+// returned value simply holds it.
+C10_API Backtrace get_lazy_backtrace(
+    size_t frames_to_skip = 0,
+    size_t maximum_number_of_frames = 64,
+    bool skip_python_frames = true);
+
 } // namespace c10
 
 #endif // C10_UTIL_BACKTRACE_H_
@@ -8,11 +8,18 @@
 
 namespace c10 {
 
-Error::Error(std::string msg, std::string backtrace, const void* caller)
+Error::Error(std::string msg, Backtrace backtrace, const void* caller)
     : msg_(std::move(msg)), backtrace_(std::move(backtrace)), caller_(caller) {
   refresh_what();
 }
 
+Error::Error(std::string msg, std::string backtrace, const void* caller)
+    : Error(
+          std::move(msg),
+          std::make_shared<PrecomputedLazyValue<std::string>>(
+              std::move(backtrace)),
+          caller) {}
+
 // PyTorch-style error message
 // Error::Error(SourceLocation source_location, const std::string& msg)
 // NB: This is defined in Logging.cpp for access to GetFetchStackTrace
@@ -23,7 +30,7 @@ Error::Error(
     const uint32_t line,
     const char* condition,
     const std::string& msg,
-    const std::string& backtrace,
+    Backtrace backtrace,
     const void* caller)
     : Error(
           str("[enforce fail at ",
@@ -34,7 +41,7 @@ Error::Error(
               condition,
               ". ",
               msg),
-          backtrace,
+          std::move(backtrace),
           caller) {}
 
 std::string Error::compute_what(bool include_backtrace) const {
@@ -51,15 +58,37 @@ std::string Error::compute_what(bool include_backtrace) const {
     }
   }
 
-  if (include_backtrace) {
-    oss << "\n" << backtrace_;
+  if (include_backtrace && backtrace_) {
+    oss << "\n" << backtrace_->get();
   }
 
   return oss.str();
 }
 
+const std::string& Error::backtrace() const {
+  static const std::string empty;
+  return backtrace_ ? backtrace_->get() : empty;
+}
+
+const char* Error::what() const noexcept {
+  return what_
+      .ensure([this] {
+        try {
+          return compute_what(/*include_backtrace*/ true);
+        } catch (...) {
+          // The message is better than nothing if rendering the full string
+          // (e.g. symbolizing the backtrace) fails.
+          return msg_;
+        }
+      })
+      .c_str();
+}
+
 void Error::refresh_what() {
-  what_ = compute_what(/*include_backtrace*/ true);
+  // The full what() string is rendered on demand, since it symbolizes the
+  // backtrace; OptimisticLazy makes this safe to do from what(), which is
+  // expected to be thread safe even when accessed across multiple threads.
+  what_.reset();
   what_without_backtrace_ = compute_what(/*include_backtrace*/ false);
 }
 
@@ -68,9 +97,6 @@ void Error::add_context(std::string new_msg) {
   // TODO: Calling add_context O(n) times has O(n^2) cost.  We can fix
   // this perf problem by populating the fields lazily... if this ever
   // actually is a problem.
-  // NB: If you do fix this, make sure you do it in a thread safe way!
-  // what() is almost certainly expected to be thread safe even when
-  // accessed across multiple threads
   refresh_what();
 }
 
@@ -2,10 +2,13 @@
 #define C10_UTIL_EXCEPTION_H_
 
 #include <c10/macros/Macros.h>
+#include <c10/util/Backtrace.h>
+#include <c10/util/Lazy.h>
 #include <c10/util/StringUtil.h>
 
 #include <cstddef>
 #include <exception>
+#include <memory>
 #include <string>
 #include <variant>
 #include <vector>
@@ -33,16 +36,20 @@ class C10_API Error : public std::exception {
   std::vector<std::string> context_;
 
   // The C++ backtrace at the point when this exception was raised.  This
-  // may be empty if there is no valid backtrace.  (We don't use optional
-  // here to reduce the dependencies this file has.)
-  std::string backtrace_;
+  // may be empty if there is no valid backtrace.  The raw callstack is
+  // captured when the error is thrown, but symbolizing it is deferred until
+  // the trace is actually accessed: symbolization dominates the cost of
+  // raising an error, and many errors are caught and handled without their
+  // trace ever being printed.
+  Backtrace backtrace_;
 
   // These two are derived fields from msg_stack_ and backtrace_, but we need
   // fields for the strings so that we can return a const char* (as the
-  // signature of std::exception requires).  Currently, the invariant
-  // is that these fields are ALWAYS populated consistently with respect
-  // to msg_stack_ and backtrace_.
-  std::string what_;
+  // signature of std::exception requires).  what_without_backtrace_ is kept
+  // eagerly consistent with msg_ and context_; what_ is rendered lazily on
+  // first access, since it is the only consumer of the (expensive)
+  // symbolized backtrace.
+  mutable OptimisticLazy<std::string> what_;
   std::string what_without_backtrace_;
 
   // This is a little debugging trick: you can stash a relevant pointer
@@ -63,10 +70,14 @@ class C10_API Error : public std::exception {
       const uint32_t line,
       const char* condition,
       const std::string& msg,
-      const std::string& backtrace,
+      Backtrace backtrace,
       const void* caller = nullptr);
 
   // Base constructor
+  Error(std::string msg, Backtrace backtrace, const void* caller = nullptr);
+
+  // Convenience overload for callers that already have a rendered backtrace
+  // string (possibly empty).
   Error(std::string msg, std::string backtrace, const void* caller = nullptr);
 
   // Add some new context to the message stack.  The last added context
@@ -83,16 +94,14 @@ class C10_API Error : public std::exception {
     return context_;
   }
 
-  const std::string& backtrace() const {
-    return backtrace_;
-  }
+  /// Returns the symbolized backtrace, rendering it on first access.
+  const std::string& backtrace() const;
 
   /// Returns the complete error message, including the source location.
+  /// The backtrace is symbolized the first time this is called.
   /// The returned pointer is invalidated if you call add_context() on
   /// this object.
-  const char* what() const noexcept override {
-    return what_.c_str();
-  }
+  const char* what() const noexcept override;
 
   const void* caller() const noexcept {
     return caller_;
@@ -403,14 +412,14 @@ C10_API std::string GetExceptionString(const std::exception& e);
 // string literal.
 #define TORCH_INTERNAL_ASSERT(cond, ...)                                         \
   if (C10_UNLIKELY_OR_CONST(!(cond))) {                                          \
-    ::c10::detail::torchInternalAssertFail(                                      \
+    ::c10::detail::torchInternalAssertFailLazy(                                  \
         __func__,                                                                \
         __FILE__,                                                                \
         static_cast<uint32_t>(__LINE__),                                         \
         #cond                                                                    \
         " INTERNAL ASSERT FAILED at " C10_STRINGIZE(__FILE__) ":" C10_STRINGIZE( \
             __LINE__) ", please report a bug to PyTorch. ",                      \
-        c10::str(__VA_ARGS__));                                                  \
+        [&]() { return c10::str(__VA_ARGS__); });                                \
   }
 #endif
 
@@ -470,9 +479,13 @@ inline C10_API const char* torchCheckMsgImpl(
       "(Could this error message be improved?  If so, "    \
       "please report an enhancement request to PyTorch.)", \
       ##__VA_ARGS__))
-#define TORCH_CHECK_WITH_MSG(error_t, cond, type, ...)                  \
-  if (C10_UNLIKELY_OR_CONST(!(cond))) {                                 \
-    C10_THROW_ERROR(error_t, TORCH_CHECK_MSG(cond, type, __VA_ARGS__)); \
+#define TORCH_CHECK_WITH_MSG(error_t, cond, type, ...)              \
+  if (C10_UNLIKELY_OR_CONST(!(cond))) {                             \
+    ::c10::detail::torchCheckWithFailLazy<::c10::error_t>(          \
+        __func__,                                                   \
+        __FILE__,                                                   \
+        static_cast<uint32_t>(__LINE__),                            \
+        [&]() { return TORCH_CHECK_MSG(cond, type, __VA_ARGS__); }); \
   }
 #endif
 
@@ -516,6 +529,38 @@ namespace detail {
     const char* condMsg,
     const std::string& userMsg);
 
+// Outlined, cold wrappers that take the failure message as a callable.  The
+// c10::str() formatting machinery then gets instantiated inside a cold
+// function instead of being inlined at every call site of the check macros,
+// which keeps the hot path down to a test, a capture and a call.
+template <typename GetMsg>
+[[noreturn]] C10_NOINLINE C10_COLD void torchCheckFailLazy(
+    const char* func,
+    const char* file,
+    uint32_t line,
+    const GetMsg& getMsg) {
+  torchCheckFail(func, file, line, getMsg());
+}
+
+template <typename ErrorT, typename GetMsg>
+[[noreturn]] C10_NOINLINE C10_COLD void torchCheckWithFailLazy(
+    const char* func,
+    const char* file,
+    uint32_t line,
+    const GetMsg& getMsg) {
+  throw ErrorT({func, file, line}, getMsg());
+}
+
+template <typename GetMsg>
+[[noreturn]] C10_NOINLINE C10_COLD void torchInternalAssertFailLazy(
+    const char* func,
+    const char* file,
+    uint32_t line,
+    const char* condMsg,
+    const GetMsg& getMsg) {
+  torchInternalAssertFail(func, file, line, condMsg, getMsg());
+}
+
 } // namespace detail
 } // namespace c10
 
@@ -529,13 +574,13 @@ namespace detail {
         TORCH_CHECK_MSG(cond, "", __VA_ARGS__)); \
   }
 #else
-#define TORCH_CHECK(cond, ...)                     \
-  if (C10_UNLIKELY_OR_CONST(!(cond))) {            \
-    ::c10::detail::torchCheckFail(                 \
-        __func__,                                  \
-        __FILE__,                                  \
-        static_cast<uint32_t>(__LINE__),           \
-        TORCH_CHECK_MSG(cond, "", ##__VA_ARGS__)); \
+#define TORCH_CHECK(cond, ...)                                        \
+  if (C10_UNLIKELY_OR_CONST(!(cond))) {                               \
+    ::c10::detail::torchCheckFailLazy(                                \
+        __func__,                                                     \
+        __FILE__,                                                     \
+        static_cast<uint32_t>(__LINE__),                              \
+        [&]() { return TORCH_CHECK_MSG(cond, "", ##__VA_ARGS__); });  \
   }
 #endif
 
@@ -8,6 +8,7 @@
 #include <algorithm>
 #include <cstdlib>
 #include <iostream>
+#include <memory>
 
 // Common code that we use regardless of whether we use glog or not.
 
@@ -20,18 +21,26 @@ C10_DEFINE_bool(
 namespace c10 {
 
 namespace {
-std::function<string()>* GetFetchStackTrace() {
-  static std::function<string()> func = []() {
-    return get_backtrace(/*frames_to_skip=*/1);
+std::function<::c10::Backtrace()>* GetFetchStackTrace() {
+  static std::function<::c10::Backtrace()> func = []() {
+    return get_lazy_backtrace(/*frames_to_skip=*/1);
   };
   return &func;
 };
 } // namespace
 
-void SetStackTraceFetcher(std::function<string(void)> fetcher) {
+void SetStackTraceFetcher(std::function<::c10::Backtrace()> fetcher) {
   *GetFetchStackTrace() = std::move(fetcher);
 }
 
+void SetStackTraceFetcher(std::function<string(void)> fetcher) {
+  // A string fetcher must run eagerly (at the point the error is raised), so
+  // its result is wrapped rather than deferred.
+  SetStackTraceFetcher([fetcher = std::move(fetcher)]() -> ::c10::Backtrace {
+    return std::make_shared<PrecomputedLazyValue<std::string>>(fetcher());
+  });
+}
+
 void ThrowEnforceNotMet(
     const char* file,
     const int line,
@@ -72,15 +81,37 @@ void ThrowEnforceFiniteNotMet(
     const void* caller) {
   ThrowEnforceFiniteNotMet(file, line, condition, std::string(msg), caller);
 }
+namespace {
+
+// Wraps the fetched backtrace with the standard "Exception raised from ..."
+// header; the underlying trace is only symbolized if this is ever rendered.
+class PyTorchStyleBacktrace : public OptimisticLazyValue<std::string> {
+ public:
+  PyTorchStyleBacktrace(SourceLocation source_location)
+      : backtrace_((*GetFetchStackTrace())()),
+        source_location_(source_location) {}
+
+ private:
+  std::string compute() const override {
+    return str(
+        "Exception raised from ",
+        source_location_,
+        " (most recent call first):\n",
+        backtrace_->get());
+  }
+
+  ::c10::Backtrace backtrace_;
+  SourceLocation source_location_;
+};
+
+} // namespace
+
 // PyTorch-style error message
 // (This must be defined here for access to GetFetchStackTrace)
 Error::Error(SourceLocation source_location, std::string msg)
     : Error(
           std::move(msg),
-          str("Exception raised from ",
-              source_location,
-              " (most recent call first):\n",
-              (*GetFetchStackTrace())())) {}
+          std::make_shared<PyTorchStyleBacktrace>(source_location)) {}
 
 using APIUsageLoggerType = std::function<void(const std::string&)>;
 using APIUsageMetadataLoggerType = std::function<void(
@@ -126,6 +126,11 @@ constexpr bool IsUsingGoogleLogging() {
  */
 C10_API void ShowLogInfoToStderr();
 
+// Sets the function used to fetch the C++ stack trace when an error is
+// raised. The preferred overload returns a lazily-symbolized Backtrace so
+// that errors which are caught and handled never pay for symbolization; the
+// string overload is kept for fetchers that must render eagerly.
+C10_API void SetStackTraceFetcher(std::function<::c10::Backtrace()> fetcher);
 C10_API void SetStackTraceFetcher(std::function<string(void)> fetcher);
 
 using EnforceNotMet = ::c10::Error;
@@ -40,6 +40,33 @@ void NUMABind(int numa_node_id) {
   numa_bitmask_free(bm);
 }
 
+void NUMABindMemory(int numa_node_id) {
+  if (!IsNUMAEnabled()) {
+    return;
+  }
+  if (numa_node_id < 0) {
+    TORCH_CHECK(
+        set_mempolicy(MPOL_DEFAULT, nullptr, 0) == 0,
+        "Unable to reset memory policy, errno:",
+        errno);
+    return;
+  }
+
+  TORCH_CHECK(
+      numa_node_id <= numa_max_node(),
+      "NUMA node id ",
+      numa_node_id,
+      " is unavailable");
+
+  // Avoid extra dynamic allocation and NUMA api calls
+  AT_ASSERT(static_cast<unsigned>(numa_node_id) < sizeof(unsigned long) * 8);
+  unsigned long mask = 1UL << numa_node_id;
+  TORCH_CHECK(
+      set_mempolicy(MPOL_PREFERRED, &mask, sizeof(mask) * 8) == 0,
+      "Unable to set memory policy, errno:",
+      errno);
+}
+
 int GetNUMANode(const void* ptr) {
   if (!IsNUMAEnabled()) {
     return -1;
@@ -98,6 +125,50 @@ void NUMAMove(void* ptr, size_t size, int numa_node_id) {
       "Could not move memory to a NUMA node");
 }
 
+void NUMAInterleave(void* ptr, size_t size) {
+  if (!IsNUMAEnabled()) {
+    return;
+  }
+  AT_ASSERT(ptr);
+
+  uintptr_t page_start_ptr =
+      ((reinterpret_cast<uintptr_t>(ptr)) & ~(getpagesize() - 1));
+  // NOLINTNEXTLINE(*-conversions)
+  ptrdiff_t offset = reinterpret_cast<uintptr_t>(ptr) - page_start_ptr;
+  // NOLINTNEXTLINE(performance-no-int-to-ptr)
+  TORCH_CHECK(
+      mbind(
+          reinterpret_cast<void*>(page_start_ptr),
+          size + offset,
+          MPOL_INTERLEAVE,
+          numa_all_nodes_ptr->maskp,
+          numa_all_nodes_ptr->size + 1,
+          MPOL_MF_MOVE) == 0,
+      "Could not interleave memory across NUMA nodes");
+}
+
+void NUMARunOnNode(int numa_node_id) {
+  if (numa_node_id < 0) {
+    return;
+  }
+  if (!IsNUMAEnabled()) {
+    return;
+  }
+
+  TORCH_CHECK(
+      numa_node_id <= numa_max_node(),
+      "NUMA node id ",
+      numa_node_id,
+      " is unavailable");
+
+  TORCH_CHECK(
+      numa_run_on_node(numa_node_id) == 0,
+      "Could not run on NUMA node ",
+      numa_node_id,
+      ", errno:",
+      errno);
+}
+
 int GetCurrentNUMANode() {
   if (!IsNUMAEnabled()) {
     return -1;
@@ -115,6 +186,8 @@ bool IsNUMAEnabled() {
 
 void NUMABind(int numa_node_id) {}
 
+void NUMABindMemory(int numa_node_id) {}
+
 int GetNUMANode(const void* ptr) {
   return -1;
 }
@@ -125,6 +198,10 @@ int GetNumNUMANodes() {
 
 void NUMAMove(void* ptr, size_t size, int numa_node_id) {}
 
+void NUMAInterleave(void* ptr, size_t size) {}
+
+void NUMARunOnNode(int numa_node_id) {}
+
 int GetCurrentNUMANode() {
   return -1;
 }
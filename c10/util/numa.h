@@ -18,6 +18,16 @@ C10_API bool IsNUMAEnabled();
  */
 C10_API void NUMABind(int numa_node_id);
 
+/**
+ * Prefer a given NUMA node for new memory allocations made by the calling
+ * thread. Unlike NUMABind, this does not change CPU affinity, and uses a
+ * preferred (not strict) policy so allocation falls back to other nodes
+ * rather than failing when the node is full. Pass -1 to reset the calling
+ * thread to the default policy; note that this also clears any policy
+ * previously installed via NUMABind.
+ */
+C10_API void NUMABindMemory(int numa_node_id);
+
 /**
  * Get the NUMA id for a given pointer `ptr`
  */
@@ -33,6 +43,21 @@ C10_API int GetNumNUMANodes();
  */
 C10_API void NUMAMove(void* ptr, size_t size, int numa_node_id);
 
+/**
+ * Interleave the pages backing `ptr` of a given size round-robin across all
+ * NUMA nodes. Useful for large buffers that are consumed by threads on every
+ * socket, where any single-node placement turns one memory controller into
+ * the bottleneck.
+ */
+C10_API void NUMAInterleave(void* ptr, size_t size);
+
+/**
+ * Restrict the calling thread to run on the CPUs of a given NUMA node.
+ * Unlike NUMABind, this changes only CPU affinity, not the memory policy.
+ * No-op when NUMA is not enabled or `numa_node_id` is negative.
+ */
+C10_API void NUMARunOnNode(int numa_node_id);
+
 /**
  * Get the current NUMA node id
  */
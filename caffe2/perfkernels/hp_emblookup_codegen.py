@@ -7,11 +7,57 @@ import sys
 sizeof = {"float": 4, "at::Half": 2, "at::BFloat16": 2, "uint8_t": 1}
 
 
+def isa_regsize(isa):
+    return 16 if isa == "AVX512" else 8
+
+
+def isa_reg(isa):
+    return "__m512" if isa == "AVX512" else "__m256"
+
+
+def isa_pfx(isa):
+    return "_mm512" if isa == "AVX512" else "_mm256"
+
+
 def unroll(uf, IndexType, InType, OutType, use_weights, isa, fused, use_offsets):
     def compute(regid, InType, use_weights, isa, prefetch):
         code = []
 
-        if InType == "float":
+        if isa == "AVX512":
+            if InType == "float":
+                code.append(
+                    "        vop%d = _mm512_fmadd_ps(vwgt, _mm512_loadu_ps(ip + (%d)), vop%d);"  # noqa
+                    % (regid, regid, regid)
+                )
+            elif InType == "at::Half":
+                code.append(
+                    "        vop%d = _mm512_fmadd_ps(\n"
+                    "            vwgt,\n"
+                    "            _mm512_cvtph_ps(\n"
+                    "                _mm256_loadu_si256(reinterpret_cast<const __m256i*>(ip + (%d)))),\n"  # noqa
+                    "            vop%d);" % (regid, regid, regid)
+                )
+            elif InType == "at::BFloat16":
+                code.append(
+                    "        vop%d = _mm512_fmadd_ps(\n"
+                    "            vwgt,\n"
+                    "            _mm512_castsi512_ps(_mm512_slli_epi32(\n"
+                    "                _mm512_cvtepu16_epi32(_mm256_loadu_si256(\n"
+                    "                    reinterpret_cast<const __m256i*>(ip + (%d)))),\n"
+                    "                16)),\n"  # noqa
+                    "            vop%d);" % (regid, regid, regid)
+                )
+            elif InType == "uint8_t":
+                code.append(
+                    "        vop%d = _mm512_fmadd_ps(\n"
+                    "            vwgt,\n"
+                    "            _mm512_cvtepi32_ps(_mm512_cvtepu8_epi32(\n"
+                    "                _mm_loadu_si128(reinterpret_cast<const __m128i*>(ip + (%d))))),\n"  # noqa
+                    "            _mm512_add_ps(vop%d, vbio));" % (regid, regid, regid)
+                )
+            else:
+                assert False
+        elif InType == "float":
             code.append(
                 "        vop%d = _mm256_fmadd_ps(vwgt, _mm256_loadu_ps(ip + (%d)), vop%d);"  # noqa
                 % (regid, regid, regid)
@@ -58,6 +104,10 @@ def unroll(uf, IndexType, InType, OutType, use_weights, isa, fused, use_offsets)
 
         return code
 
+    regsize = isa_regsize(isa)
+    reg = isa_reg(isa)
+    pfx = isa_pfx(isa)
+
     code = []
     code.append("    // unrolling " + str(uf) + " times")
 
@@ -76,8 +126,8 @@ def unroll(uf, IndexType, InType, OutType, use_weights, isa, fused, use_offsets)
 
     code.append("      " + OutType + "* op = &out[rangeIndex * block_size];")
     for i in range(0, uf):
-        j = 8 * i
-        code.append("      __m256 vop" + str(j) + " = _mm256_setzero_ps();")
+        j = regsize * i
+        code.append("      " + reg + " vop" + str(j) + " = " + pfx + "_setzero_ps();")
 
     # inner loop
     if use_offsets:
@@ -131,7 +181,7 @@ def unroll(uf, IndexType, InType, OutType, use_weights, isa, fused, use_offsets)
         else:
             code.append("        bio = wgt * scale_bias[2 * idx + 1];")
             code.append("        wgt = wgt * scale_bias[2 * idx];")
-        code.append("        __m256 vbio = _mm256_set1_ps(bio);")
+        code.append("        " + reg + " vbio = " + pfx + "_set1_ps(bio);")
     else:
         code.append("        " + OutType + " wgt = 1.f;")
         code.append("        if (weights) {")
@@ -139,7 +189,7 @@ def unroll(uf, IndexType, InType, OutType, use_weights, isa, fused, use_offsets)
             "          wgt = weights[IS_WEIGHT_POSITIONAL ? (dataInd - start) : dataInd];"  # noqa
         )
         code.append("        }")
-    code.append("        __m256 vwgt = _mm256_set1_ps(wgt);")
+    code.append("        " + reg + " vwgt = " + pfx + "_set1_ps(wgt);")
 
     code.append("        const {}* ip = &input[idx * fused_block_size];".format(InType))
     code.append(
@@ -164,7 +214,7 @@ def unroll(uf, IndexType, InType, OutType, use_weights, isa, fused, use_offsets)
     )
 
     for i in range(0, uf):
-        j = 8 * i
+        j = regsize * i
         cachelinesize = 64
         byteoffset = sizeof[InType] * j
         prefetch = (byteoffset % cachelinesize) == 0
@@ -176,20 +226,20 @@ def unroll(uf, IndexType, InType, OutType, use_weights, isa, fused, use_offsets)
     else:
         code.append("      if (!normalize_by_lengths || lengths[rangeIndex] == 0) {")
     for i in range(0, uf):
-        j = 8 * i
-        code.append("        _mm256_storeu_ps(&op[" + str(j) + "], vop" + str(j) + ");")
+        j = regsize * i
+        code.append("        " + pfx + "_storeu_ps(&op[" + str(j) + "], vop" + str(j) + ");")
     code.append("      } else {")
     # inv of length
     if use_offsets:
-        code.append("        __m256 vlen_inv = _mm256_set1_ps(1.0f / length);")
+        code.append("        " + reg + " vlen_inv = " + pfx + "_set1_ps(1.0f / length);")
     else:
-        code.append("        __m256 vlen_inv = _mm256_set1_ps(1.0f / lengths[rangeIndex]);")
+        code.append("        " + reg + " vlen_inv = " + pfx + "_set1_ps(1.0f / lengths[rangeIndex]);")
     for i in range(0, uf):
-        j = 8 * i
+        j = regsize * i
         code.append(
-            "        _mm256_storeu_ps(&op["
+            "        " + pfx + "_storeu_ps(&op["
             + str(j)
-            + "], _mm256_mul_ps("
+            + "], " + pfx + "_mul_ps("
             + "vop"
             + str(j)
             + ", vlen_inv));"
@@ -203,7 +253,49 @@ def unroll(uf, IndexType, InType, OutType, use_weights, isa, fused, use_offsets)
 def generic(IndexType, InType, OutType, use_weights, isa, fused, use_offsets):
     def compute(InType, use_weights, isa):
         code = []
-        if InType == "float":
+        if isa == "AVX512":
+            if InType == "float":
+                code.append(
+                    "          _mm512_storeu_ps(\n"
+                    "              &op[j],\n"
+                    "              _mm512_fmadd_ps(\n"
+                    "                  vwgt, _mm512_loadu_ps(&ip[j]), _mm512_loadu_ps(&op[j])));"  # noqa
+                )
+            elif InType == "at::Half":
+                code.append(
+                    "          _mm512_storeu_ps(\n"
+                    "              &op[j],\n"
+                    "              _mm512_fmadd_ps(\n"
+                    "                  vwgt,\n"
+                    "                  _mm512_cvtph_ps(_mm256_loadu_si256(\n"
+                    "                      reinterpret_cast<const __m256i*>(&ip[j]))),\n"
+                    "                  _mm512_loadu_ps(&op[j])));"
+                )
+            elif InType == "at::BFloat16":
+                code.append(
+                    "          _mm512_storeu_ps(\n"
+                    "              &op[j],\n"
+                    "              _mm512_fmadd_ps(\n"
+                    "                  vwgt,\n"
+                    "                  _mm512_castsi512_ps(_mm512_slli_epi32(\n"
+                    "                      _mm512_cvtepu16_epi32(_mm256_loadu_si256(\n"
+                    "                          reinterpret_cast<const __m256i*>(&ip[j]))),\n"
+                    "                      16)),\n"
+                    "                  _mm512_loadu_ps(&op[j])));"
+                )
+            elif InType == "uint8_t":
+                code.append(
+                    "          _mm512_storeu_ps(\n"
+                    "              &op[j],\n"
+                    "              _mm512_fmadd_ps(\n"
+                    "                  vwgt,\n"
+                    "                  _mm512_cvtepi32_ps(_mm512_cvtepu8_epi32(_mm_loadu_si128(\n"  # noqa
+                    "                      reinterpret_cast<const __m128i*>(&ip[j])))),\n"
+                    "                  _mm512_add_ps(_mm512_loadu_ps(&op[j]), vbio)));"
+                )
+            else:
+                assert False
+        elif InType == "float":
             code.append(
                 "          _mm256_storeu_ps(\n"
                 "              &op[j],\n"
@@ -252,6 +344,10 @@ def generic(IndexType, InType, OutType, use_weights, isa, fused, use_offsets):
 
         return code
 
+    regsize = isa_regsize(isa)
+    reg = isa_reg(isa)
+    pfx = isa_pfx(isa)
+
     code = []
     if InType == "at::Half":
         code.append("    alignas(64) at::Half vtmp1[8] = {0};")
@@ -276,8 +372,8 @@ def generic(IndexType, InType, OutType, use_weights, isa, fused, use_offsets):
 
     # initialize to 0
     code.append("      int64_t j = 0;")
-    code.append("      for (; j + 8 <= block_size; j += 8) {")
-    code.append("        _mm256_storeu_ps(op + j, _mm256_setzero_ps());")
+    code.append("      for (; j + " + str(regsize) + " <= block_size; j += " + str(regsize) + ") {")
+    code.append("        " + pfx + "_storeu_ps(op + j, " + pfx + "_setzero_ps());")
     code.append("      }")
     code.append("      for (; j < block_size; j++) {")
     code.append("        op[j] = 0.0f;")
@@ -335,7 +431,7 @@ def generic(IndexType, InType, OutType, use_weights, isa, fused, use_offsets):
         else:
             code.append("        bio = wgt * scale_bias[2 * idx + 1];")
             code.append("        wgt = wgt * scale_bias[2 * idx];")
-        code.append("        __m256 vbio = _mm256_set1_ps(bio);")
+        code.append("        " + reg + " vbio = " + pfx + "_set1_ps(bio);")
     else:
         code.append("        " + OutType + " wgt = 1.f;")
         code.append("        if (weights) {")
@@ -343,7 +439,7 @@ def generic(IndexType, InType, OutType, use_weights, isa, fused, use_offsets):
             "          wgt = weights[IS_WEIGHT_POSITIONAL ? (dataInd - start) : dataInd];"  # noqa
         )
         code.append("        }")
-    code.append("        __m256 vwgt = _mm256_set1_ps(wgt);")
+    code.append("        " + reg + " vwgt = " + pfx + "_set1_ps(wgt);")
 
     code.append("        const {}* ip = &input[idx * fused_block_size];".format(InType))
     code.append(
@@ -368,7 +464,7 @@ def generic(IndexType, InType, OutType, use_weights, isa, fused, use_offsets):
 
     # compute and store main loop
     code.append("        j = 0;")
-    code.append("        for (; j + 8 <= block_size; j += 8) {")
+    code.append("        for (; j + " + str(regsize) + " <= block_size; j += " + str(regsize) + ") {")
     code.extend(compute(InType, use_weights, isa))
     code.append("        }")
     # leftover
@@ -405,12 +501,12 @@ def generic(IndexType, InType, OutType, use_weights, isa, fused, use_offsets):
     else:
         code.append("      if (normalize_by_lengths && lengths[rangeIndex]) {")
         code.append("        float len_inv = 1.0f / lengths[rangeIndex];")
-    code.append("        __m256 vlen_inv = _mm256_set1_ps(len_inv);")
+    code.append("        " + reg + " vlen_inv = " + pfx + "_set1_ps(len_inv);")
     code.append("        j = 0;")
-    code.append("        for (; j + 8 <= block_size; j += 8) {")
+    code.append("        for (; j + " + str(regsize) + " <= block_size; j += " + str(regsize) + ") {")
     code.append(
-        "          _mm256_storeu_ps(\n"
-        "              &op[j], _mm256_mul_ps(_mm256_loadu_ps(&op[j]), vlen_inv));"
+        "          " + pfx + "_storeu_ps(\n"
+        "              &op[j], " + pfx + "_mul_ps(" + pfx + "_loadu_ps(&op[j]), vlen_inv));"
     )
     code.append("        }")
     code.append("        for (; j < block_size; j++) {")
@@ -428,19 +524,26 @@ parser = argparse.ArgumentParser()
 parser.add_argument("-f", "--filename", help="file name")
 parser.add_argument("--fused", action="store_true")
 parser.add_argument("--use-offsets", action="store_true")
+parser.add_argument(
+    "--isa",
+    choices=["avx2", "avx512"],
+    default="avx2",
+    help="instruction set to generate for",
+)
 opts = parser.parse_args()
+isa = opts.isa.upper()
 if opts.filename:
     filename = opts.filename
 elif opts.fused:
     if opts.use_offsets:
-        filename = "embedding_lookup_fused_8bit_rowwise_idx_avx2.cc"
+        filename = "embedding_lookup_fused_8bit_rowwise_idx_{}.cc".format(opts.isa)
     else:
-        filename = "embedding_lookup_fused_8bit_rowwise_avx2.cc"
+        filename = "embedding_lookup_fused_8bit_rowwise_{}.cc".format(opts.isa)
 else:
     if opts.use_offsets:
-        filename = "embedding_lookup_idx_avx2.cc"
+        filename = "embedding_lookup_idx_{}.cc".format(opts.isa)
     else:
-        filename = "embedding_lookup_avx2.cc"
+        filename = "embedding_lookup_{}.cc".format(opts.isa)
 
 options = [
     ["int32_t", "int", "float", "float", "float", "float"],
@@ -480,7 +583,7 @@ for o in options:
         fn_base = "{}EmbeddingLookup_{}_{}_{}".format(
             prefix, IndexTypeName, InTypeName, OutTypeName
         )
-    suffix = "__avx2_fma"
+    suffix = "__avx512" if isa == "AVX512" else "__avx2_fma"
     fn = "static bool " + fn_base + suffix
     code.append(fn + "(")
 
@@ -517,18 +620,17 @@ for o in options:
 
     # code.append("printf(\"calling " + fn + "\\n\");");
 
-    code.append("  if (block_size == 128) {")
-    code += unroll(16, IndexType, InType, OutType, True, "AVX2", opts.fused, opts.use_offsets)
-    code.append("  } else if (block_size == 64) {")
-    code += unroll(8, IndexType, InType, OutType, True, "AVX2", opts.fused, opts.use_offsets)
-    code.append("  } else if (block_size == 32) {")
-    code += unroll(4, IndexType, InType, OutType, True, "AVX2", opts.fused, opts.use_offsets)
-    code.append("  } else if (block_size == 16) {")
-    code += unroll(2, IndexType, InType, OutType, True, "AVX2", opts.fused, opts.use_offsets)
+    regsize = isa_regsize(isa)
+    first = True
+    for block_size in [128, 64, 32, 16]:
+        cond = "if (block_size == " + str(block_size) + ") {"
+        code.append("  " + cond if first else "  } else " + cond)
+        first = False
+        code += unroll(block_size // regsize, IndexType, InType, OutType, True, isa, opts.fused, opts.use_offsets)
     code.append("  } else {")
     code.append("    // generic code")
     code.append("    // NOLINTNEXTLINE(modernize-avoid-c-arrays,cppcoreguidelines-avoid-magic-numbers,cppcoreguidelines-avoid-c-arrays)")
-    code += generic(IndexType, InType, OutType, True, "AVX2", opts.fused, opts.use_offsets)
+    code += generic(IndexType, InType, OutType, True, isa, opts.fused, opts.use_offsets)
     code.append("  }")
     code.append("  return dataInd == index_size;")
 
@@ -5,11 +5,25 @@
 #include <ostream>
 #include <fstream>
 #include <algorithm>
+#include <map>
+#include <mutex>
 #include <sstream>
 #include <sys/stat.h>
 #include <sys/types.h>
+#include <atomic>
 #include <thread>
 
+// Implemented in crc_alt.h, which is compiled into crc.cc and cannot be
+// included a second time.
+uint32_t crc32_fast(const void* data, size_t length, uint32_t previousCrc32);
+uint32_t crc32_combine(uint32_t crcA, uint32_t crcB, size_t lengthB);
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
 #include <c10/core/Allocator.h>
 #include <c10/core/Backend.h>
 #include <c10/core/CPUAllocator.h>
@@ -107,7 +121,8 @@ size_t PyTorchStreamReader::read(uint64_t pos, char* buf, size_t n) {
 // NOLINTNEXTLINE(cppcoreguidelines-pro-type-member-init)
 PyTorchStreamReader::PyTorchStreamReader(const std::string& file_name)
     : ar_(std::make_unique<mz_zip_archive>()),
-      in_(std::make_unique<FileAdapter>(file_name)) {
+      in_(std::make_unique<FileAdapter>(file_name)),
+      file_name_(file_name) {
   init();
 }
 
@@ -332,6 +347,162 @@ size_t PyTorchStreamReader::getRecordID(const std::string& name) {
   return result;
 }
 
+namespace {
+
+#ifndef _WIN32
+// Live archive mappings by base address, so callers holding only a data
+// pointer (e.g. a tensor storage) can find out whether it is backed by an
+// archive mapping. Guarded by its own mutex; regions register themselves on
+// construction and unregister on destruction.
+std::mutex& mmapRegionRegistryMutex() {
+  static std::mutex mutex;
+  return mutex;
+}
+
+std::map<const void*, size_t>& mmapRegionRegistry() {
+  static std::map<const void*, size_t> registry;
+  return registry;
+}
+
+// Whole-file read-only mapping shared by all mmap-backed records; unmapped
+// when the last referencing DataPtr (or the reader itself) lets go.
+struct MmapRegion {
+  void* base = nullptr;
+  size_t size = 0;
+  MmapRegion(void* base, size_t size) : base(base), size(size) {
+    std::lock_guard<std::mutex> guard(mmapRegionRegistryMutex());
+    mmapRegionRegistry().emplace(base, size);
+  }
+  C10_DISABLE_COPY_AND_ASSIGN(MmapRegion);
+  ~MmapRegion() {
+    if (base != nullptr) {
+      {
+        std::lock_guard<std::mutex> guard(mmapRegionRegistryMutex());
+        mmapRegionRegistry().erase(base);
+      }
+      munmap(base, size);
+    }
+  }
+};
+
+void delete_mmap_record_context(void* ctx) {
+  delete static_cast<std::shared_ptr<MmapRegion>*>(ctx);
+}
+#endif
+
+} // namespace
+
+c10::optional<std::pair<const void*, size_t>> findMmapRecordRegion(
+    const void* ptr) {
+#ifdef _WIN32
+  return c10::nullopt;
+#else
+  std::lock_guard<std::mutex> guard(mmapRegionRegistryMutex());
+  auto& registry = mmapRegionRegistry();
+  auto it = registry.upper_bound(ptr);
+  if (it == registry.begin()) {
+    return c10::nullopt;
+  }
+  --it;
+  if (static_cast<const char*>(ptr) <
+      static_cast<const char*>(it->first) + it->second) {
+    return std::make_pair(it->first, it->second);
+  }
+  return c10::nullopt;
+#endif
+}
+
+void PyTorchStreamReader::setEnableMmapRecords(bool enable) {
+#ifdef _WIN32
+  TORCH_CHECK(!enable, "mmap-backed records are not supported on Windows");
+#else
+  TORCH_CHECK(
+      !enable || !file_name_.empty(),
+      "mmap-backed records require a PyTorchStreamReader constructed from a file name");
+  use_mmap_records_ = enable;
+#endif
+}
+
+void PyTorchStreamReader::setMmapRecordsCopyOnWrite(bool enable) {
+#ifdef _WIN32
+  TORCH_CHECK(
+      !enable, "copy-on-write mmap records are not supported on Windows");
+#else
+  TORCH_CHECK(
+      mmap_region_ == nullptr,
+      "setMmapRecordsCopyOnWrite() must be called before any record is read");
+  mmap_records_cow_ = enable;
+#endif
+}
+
+c10::optional<std::tuple<at::DataPtr, size_t>>
+PyTorchStreamReader::getRecordMmapUnlocked(size_t record_id) {
+#ifdef _WIN32
+  return c10::nullopt;
+#else
+  mz_zip_archive_file_stat stat;
+  mz_zip_reader_file_stat(ar_.get(), record_id, &stat);
+  valid("retrieving file meta-data");
+  if (stat.m_method != 0) {
+    // Compressed record; must go through the extracting path.
+    return c10::nullopt;
+  }
+  if (mmap_region_ == nullptr) {
+    int fd = open(file_name_.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0) {
+      return c10::nullopt;
+    }
+    struct stat file_stat {};
+    if (fstat(fd, &file_stat) != 0) {
+      close(fd);
+      return c10::nullopt;
+    }
+    // A plain shared mapping faults on writes; the copy-on-write variant
+    // maps the file privately and writable, so pages stay shared with the
+    // page cache (and thus with every process mapping the same archive)
+    // until a process actually mutates them.
+    void* base = mmap_records_cow_
+        ? mmap(
+              nullptr,
+              file_stat.st_size,
+              PROT_READ | PROT_WRITE,
+              MAP_PRIVATE,
+              fd,
+              0)
+        : mmap(nullptr, file_stat.st_size, PROT_READ, MAP_SHARED, fd, 0);
+    // The mapping keeps the file alive; the descriptor is no longer needed.
+    close(fd);
+    if (base == MAP_FAILED) {
+      return c10::nullopt;
+    }
+    mmap_region_ = std::make_shared<MmapRegion>(
+        base, static_cast<size_t>(file_stat.st_size));
+  }
+  auto* region = static_cast<MmapRegion*>(mmap_region_.get());
+  size_t data_offset = getRecordOffsetUnlocked(record_id);
+  TORCH_CHECK(
+      data_offset + stat.m_uncomp_size <= region->size,
+      "record extends past the end of the archive file");
+  char* data = static_cast<char*>(region->base) + data_offset;
+  // Fault the record in the background rather than one page per access.
+  const size_t page_mask = ~(static_cast<size_t>(sysconf(_SC_PAGESIZE)) - 1);
+  char* advise_begin = reinterpret_cast<char*>(
+      reinterpret_cast<uintptr_t>(data) & page_mask);
+  madvise(
+      advise_begin,
+      stat.m_uncomp_size + static_cast<size_t>(data - advise_begin),
+      MADV_WILLNEED);
+  // Each record holds its own reference on the mapping (aliasing ctor keeps
+  // the shared control block of mmap_region_).
+  at::DataPtr retval(
+      data,
+      new std::shared_ptr<MmapRegion>(mmap_region_, region),
+      &delete_mmap_record_context,
+      at::Device(at::DeviceType::CPU));
+  return std::make_tuple(std::move(retval), stat.m_uncomp_size);
+#endif
+}
+
 // return dataptr, size
 std::tuple<at::DataPtr, size_t> PyTorchStreamReader::getRecord(const std::string& name) {
   std::lock_guard<std::mutex> guard(reader_lock_);
@@ -340,6 +511,12 @@ std::tuple<at::DataPtr, size_t> PyTorchStreamReader::getRecord(const std::string
     return std::make_tuple(std::move(retval), 0);
   }
   size_t key = getRecordID(name);
+  if (C10_UNLIKELY(use_mmap_records_)) {
+    auto mapped = getRecordMmapUnlocked(key);
+    if (mapped.has_value()) {
+      return std::move(*mapped);
+    }
+  }
   mz_zip_archive_file_stat stat;
   mz_zip_reader_file_stat(ar_.get(), key, &stat);
   valid("retrieving file meta-data for ", name.c_str());
@@ -556,11 +733,10 @@ static int64_t read_le_16(uint8_t* buf) {
   return buf[0] + (buf[1] << 8);
 }
 
-size_t PyTorchStreamReader::getRecordOffset(const std::string& name) {
-  std::lock_guard<std::mutex> guard(reader_lock_);
+size_t PyTorchStreamReader::getRecordOffsetUnlocked(size_t record_id) {
   mz_zip_archive_file_stat stat;
-  mz_zip_reader_file_stat(ar_.get(), getRecordID(name), &stat);
-  valid("retrieving file meta-data for ", name.c_str());
+  mz_zip_reader_file_stat(ar_.get(), record_id, &stat);
+  valid("retrieving file meta-data");
   // NOLINTNEXTLINE(cppcoreguidelines-avoid-c-arrays,modernize-avoid-c-arrays)
   uint8_t local_header[MZ_ZIP_LOCAL_DIR_HEADER_SIZE];
   in_->read(
@@ -573,6 +749,69 @@ size_t PyTorchStreamReader::getRecordOffset(const std::string& name) {
   return stat.m_local_header_ofs + MZ_ZIP_LOCAL_DIR_HEADER_SIZE + filename_len + extra_len;
 }
 
+size_t PyTorchStreamReader::getRecordOffset(const std::string& name) {
+  std::lock_guard<std::mutex> guard(reader_lock_);
+  return getRecordOffsetUnlocked(getRecordID(name));
+}
+
+bool PyTorchStreamReader::getRecordToDevice(
+    const std::string& name,
+    void* dst,
+    size_t n) {
+  std::lock_guard<std::mutex> guard(reader_lock_);
+  size_t key = getRecordID(name);
+  mz_zip_archive_file_stat stat;
+  mz_zip_reader_file_stat(ar_.get(), key, &stat);
+  valid("retrieving file meta-data for ", name.c_str());
+  if (stat.m_method != 0) {
+    // Compressed record; must go through the extracting path.
+    return false;
+  }
+  TORCH_CHECK(
+      n == stat.m_uncomp_size,
+      "record size ",
+      stat.m_uncomp_size,
+      " does not match destination size ",
+      n,
+      ": file ",
+      name);
+  size_t data_offset = getRecordOffsetUnlocked(key);
+  return in_->read_to_device(
+      data_offset, dst, n, "reading record directly to device");
+}
+
+size_t PyTorchStreamReader::getRecordSlice(
+    const std::string& name,
+    size_t offset,
+    void* dst,
+    size_t n) {
+  std::lock_guard<std::mutex> guard(reader_lock_);
+  if (n == 0) {
+    return 0;
+  }
+  size_t key = getRecordID(name);
+  mz_zip_archive_file_stat stat;
+  mz_zip_reader_file_stat(ar_.get(), key, &stat);
+  valid("retrieving file meta-data for ", name.c_str());
+  TORCH_CHECK(
+      stat.m_method == 0,
+      "getRecordSlice: record is compressed and cannot be sliced: file ",
+      name);
+  TORCH_CHECK(
+      offset + n <= stat.m_uncomp_size,
+      "getRecordSlice: range [",
+      offset,
+      ", ",
+      offset + n,
+      ") is out of bounds for record of size ",
+      stat.m_uncomp_size,
+      ": file ",
+      name);
+  size_t data_offset = getRecordOffsetUnlocked(key);
+  return in_->read(
+      data_offset + offset, static_cast<char*>(dst), n, "reading record slice");
+}
+
 size_t PyTorchStreamReader::getRecordSize(const std::string& name) {
   mz_zip_archive_file_stat stat;
   mz_zip_reader_file_stat(ar_.get(), getRecordID(name), &stat);
@@ -700,6 +939,106 @@ void PyTorchStreamWriter::writeRecord(
   files_written_.insert(name);
 }
 
+namespace {
+
+// CRC32 of [data, data + size), split across threads and merged with
+// crc32_combine. Falls back to a single pass for small buffers.
+uint32_t parallel_crc32(const void* data, size_t size, size_t num_threads) {
+  constexpr size_t kMinBytesPerThread = 1ULL << 22; // 4MiB
+  const size_t max_threads = std::max<size_t>(size / kMinBytesPerThread, 1);
+  num_threads = std::min(num_threads, max_threads);
+  if (num_threads <= 1) {
+    return crc32_fast(data, size, 0);
+  }
+  const size_t chunk = (size + num_threads - 1) / num_threads;
+  std::vector<uint32_t> partial(num_threads, 0);
+  std::vector<std::thread> workers;
+  workers.reserve(num_threads);
+  for (size_t t = 0; t < num_threads; t++) {
+    workers.emplace_back([&, t]() {
+      const size_t begin = t * chunk;
+      const size_t end = std::min(begin + chunk, size);
+      if (begin < end) {
+        partial[t] =
+            crc32_fast(static_cast<const char*>(data) + begin, end - begin, 0);
+      }
+    });
+  }
+  for (auto& worker : workers) {
+    worker.join();
+  }
+  uint32_t crc = partial[0];
+  for (size_t t = 1; t < num_threads; t++) {
+    const size_t begin = t * chunk;
+    const size_t end = std::min(begin + chunk, size);
+    if (begin < end) {
+      crc = crc32_combine(crc, partial[t], end - begin);
+    }
+  }
+  return crc;
+}
+
+} // namespace
+
+void PyTorchStreamWriter::writeRecordsParallel(
+    const std::vector<WriteableRecord>& records,
+    size_t num_threads) {
+  AT_ASSERT(!finalized_);
+  if (num_threads == 0) {
+    num_threads = std::max<size_t>(std::thread::hardware_concurrency(), 1);
+  }
+  // Stage 1: checksum every record in parallel. Small records are batched
+  // one-per-task; large records additionally fan out internally.
+  std::vector<uint32_t> crcs(records.size(), 0);
+  {
+    std::atomic<size_t> next{0};
+    const size_t nworkers = std::min(num_threads, records.size());
+    std::vector<std::thread> workers;
+    workers.reserve(nworkers);
+    for (size_t w = 0; w < nworkers; w++) {
+      workers.emplace_back([&]() {
+        size_t i = 0;
+        while ((i = next.fetch_add(1)) < records.size()) {
+          crcs[i] = parallel_crc32(records[i].data, records[i].size, 1);
+        }
+      });
+    }
+    for (auto& worker : workers) {
+      worker.join();
+    }
+  }
+  // Stage 2: append to the archive in order, handing miniz the precomputed
+  // CRC (MZ_ZIP_FLAG_COMPRESSED_DATA with level 0 stores the payload as-is
+  // and trusts the supplied uncomp_size/crc32).
+  for (size_t i = 0; i < records.size(); i++) {
+    const auto& record = records[i];
+    TORCH_INTERNAL_ASSERT(
+        files_written_.count(record.name) == 0,
+        "Tried to serialize file twice: ",
+        record.name);
+    std::string full_name = archive_name_plus_slash_ + record.name;
+    size_t padding_size = detail::getPadding(
+        ar_->m_archive_size, full_name.size(), record.size, padding_);
+    mz_zip_writer_add_mem_ex_v2(
+        ar_.get(),
+        full_name.c_str(),
+        record.data,
+        record.size,
+        nullptr,
+        0,
+        MZ_ZIP_FLAG_COMPRESSED_DATA,
+        record.size,
+        crcs[i],
+        nullptr,
+        padding_.c_str(),
+        padding_size,
+        nullptr,
+        0);
+    valid("writing file ", record.name.c_str());
+    files_written_.insert(record.name);
+  }
+}
+
 void PyTorchStreamWriter::writeEndOfFile() {
   // Ensurers that finalized is set to true even
   // exception is raised during the method call.
@@ -1,6 +1,8 @@
 #include <array>
 #include <cstdio>
 #include <cstring>
+#include <fstream>
+#include <iterator>
 #include <string>
 
 #include <gtest/gtest.h>
@@ -106,6 +108,106 @@ TEST(PyTorchStreamWriterAndReader, SaveAndLoad) {
   remove(file_name);
 }
 
+#ifndef _WIN32
+TEST(PyTorchStreamWriterAndReader, MmapRecords) {
+  std::ostringstream oss;
+  PyTorchStreamWriter writer([&](const void* b, size_t n) -> size_t {
+    oss.write(static_cast<const char*>(b), n);
+    return oss ? n : 0;
+  });
+  std::array<char, 256> data;
+  for (auto i : c10::irange(data.size())) {
+    data[i] = static_cast<char>(i);
+  }
+  writer.writeRecord("key1", data.data(), data.size());
+  writer.writeEndOfFile();
+
+  std::string the_file = oss.str();
+  const char* file_name = "output_mmap.zip";
+  std::ofstream foo(file_name, std::ios::binary);
+  foo.write(the_file.c_str(), the_file.size());
+  foo.close();
+
+  at::DataPtr mapped;
+  size_t size = 0;
+  {
+    PyTorchStreamReader reader(file_name);
+    reader.setEnableMmapRecords(true);
+    std::tie(mapped, size) = reader.getRecord("key1");
+    ASSERT_EQ(size, data.size());
+    // the record must survive the reader's destruction
+  }
+  ASSERT_EQ(memcmp(mapped.get(), data.data(), data.size()), 0);
+
+  // a stream-backed reader refuses mmap mode
+  std::istringstream iss(the_file);
+  PyTorchStreamReader stream_reader(&iss);
+  EXPECT_ANY_THROW(stream_reader.setEnableMmapRecords(true));
+
+  remove(file_name);
+}
+
+TEST(PyTorchStreamWriterAndReader, MmapRecordsCopyOnWrite) {
+  std::ostringstream oss;
+  PyTorchStreamWriter writer([&](const void* b, size_t n) -> size_t {
+    oss.write(static_cast<const char*>(b), n);
+    return oss ? n : 0;
+  });
+  std::array<char, 256> data;
+  for (auto i : c10::irange(data.size())) {
+    data[i] = static_cast<char>(i);
+  }
+  writer.writeRecord("key1", data.data(), data.size());
+  writer.writeEndOfFile();
+
+  std::string the_file = oss.str();
+  const char* file_name = "output_mmap_cow.zip";
+  std::ofstream foo(file_name, std::ios::binary);
+  foo.write(the_file.c_str(), the_file.size());
+  foo.close();
+
+  at::DataPtr mapped;
+  size_t size = 0;
+  {
+    PyTorchStreamReader reader(file_name);
+    reader.setEnableMmapRecords(true);
+    reader.setMmapRecordsCopyOnWrite(true);
+    std::tie(mapped, size) = reader.getRecord("key1");
+  }
+  ASSERT_EQ(size, data.size());
+  ASSERT_EQ(memcmp(mapped.get(), data.data(), data.size()), 0);
+
+  // the record is attributable to its archive mapping while it is alive
+  auto region = findMmapRecordRegion(mapped.get());
+  ASSERT_TRUE(region.has_value());
+  ASSERT_EQ(region->second, the_file.size());
+
+  // the mapping is writable; mutations stay private to this process
+  static_cast<char*>(mapped.get())[0] = 42;
+  ASSERT_EQ(static_cast<char*>(mapped.get())[0], 42);
+  std::ifstream check(file_name, std::ios::binary);
+  std::string on_disk(
+      (std::istreambuf_iterator<char>(check)),
+      std::istreambuf_iterator<char>());
+  ASSERT_EQ(on_disk, the_file);
+
+  // once the last record reference drops, the mapping is gone
+  void* data_ptr = mapped.get();
+  mapped = at::DataPtr();
+  ASSERT_FALSE(findMmapRecordRegion(data_ptr).has_value());
+
+  // enabling copy-on-write after a record was mapped is an error
+  {
+    PyTorchStreamReader reader(file_name);
+    reader.setEnableMmapRecords(true);
+    auto record = reader.getRecord("key1");
+    EXPECT_ANY_THROW(reader.setMmapRecordsCopyOnWrite(true));
+  }
+
+  remove(file_name);
+}
+#endif
+
 TEST(PyTorchStreamWriterAndReader, LoadWithMultiThreads) {
 
   std::ostringstream oss;
@@ -186,6 +288,40 @@ TEST(PyTorchStreamWriterAndReader, LoadWithMultiThreads) {
   remove(file_name);
 }
 
+TEST(PyTorchStreamWriterAndReader, ParallelRecordWrites) {
+  std::ostringstream oss;
+  PyTorchStreamWriter writer([&](const void* b, size_t n) -> size_t {
+    oss.write(static_cast<const char*>(b), n);
+    return oss ? n : 0;
+  });
+  std::vector<std::vector<char>> payloads;
+  std::vector<PyTorchStreamWriter::WriteableRecord> records;
+  for (int i = 0; i < 4; i++) {
+    payloads.emplace_back(1024 * (i + 1));
+    for (auto j : c10::irange(payloads.back().size())) {
+      payloads.back()[j] = static_cast<char>(i + j);
+    }
+  }
+  for (int i = 0; i < 4; i++) {
+    records.push_back({"rec" + std::to_string(i),
+                       payloads[i].data(),
+                       payloads[i].size()});
+  }
+  writer.writeRecordsParallel(records, /*num_threads=*/4);
+  writer.writeEndOfFile();
+
+  std::string the_file = oss.str();
+  std::istringstream iss(the_file);
+  PyTorchStreamReader reader(&iss);
+  for (int i = 0; i < 4; i++) {
+    at::DataPtr ptr;
+    size_t size = 0;
+    std::tie(ptr, size) = reader.getRecord("rec" + std::to_string(i));
+    ASSERT_EQ(size, payloads[i].size());
+    EXPECT_EQ(memcmp(ptr.get(), payloads[i].data(), size), 0);
+  }
+}
+
 TEST(PytorchStreamWriterAndReader, GetNonexistentRecordThrows) {
   std::ostringstream oss;
   // write records through writers
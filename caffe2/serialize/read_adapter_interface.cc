@@ -3,6 +3,18 @@
 namespace caffe2 {
 namespace serialize {
 
+bool ReadAdapterInterface::read_to_device(
+    uint64_t pos,
+    void* buf,
+    size_t n,
+    const char* what) const {
+  (void)pos;
+  (void)buf;
+  (void)n;
+  (void)what;
+  return false;
+}
+
 // NOLINTNEXTLINE(modernize-use-equals-default)
 ReadAdapterInterface::~ReadAdapterInterface() {}
 
@@ -16,6 +16,17 @@ class TORCH_API ReadAdapterInterface {
   virtual size_t size() const = 0;
   virtual size_t read(uint64_t pos, void* buf, size_t n, const char* what = "")
       const = 0;
+  // Copies `n` bytes starting at `pos` straight into `buf`, which may point
+  // to device (e.g. GPU) memory. Adapters backed by GPUDirect-capable
+  // storage can override this to skip the host bounce buffer entirely. The
+  // default implementation returns false, meaning this adapter has no
+  // direct path and the caller must fall back to read() into host memory
+  // followed by a host-to-device copy.
+  virtual bool read_to_device(
+      uint64_t pos,
+      void* buf,
+      size_t n,
+      const char* what = "") const;
   virtual ~ReadAdapterInterface();
 };
 
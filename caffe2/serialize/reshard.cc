@@ -0,0 +1,269 @@
+#include "caffe2/serialize/reshard.h"
+
+#include <algorithm>
+#include <atomic>
+#include <thread>
+
+#include <c10/util/Exception.h>
+#include <c10/util/irange.h>
+
+namespace caffe2 {
+namespace serialize {
+
+namespace {
+
+int64_t numel(const std::vector<int64_t>& sizes) {
+  int64_t n = 1;
+  for (int64_t s : sizes) {
+    n *= s;
+  }
+  return n;
+}
+
+// Row-major strides in elements.
+std::vector<int64_t> contiguousStrides(const std::vector<int64_t>& sizes) {
+  std::vector<int64_t> strides(sizes.size(), 1);
+  for (size_t d = sizes.size(); d-- > 1;) {
+    strides[d - 1] = strides[d] * sizes[d];
+  }
+  return strides;
+}
+
+// One contiguous byte range to move: `length` bytes at `source_offset`
+// within the source record, landing at `dst`.
+struct CopyRange {
+  size_t source_archive = 0;
+  const std::string* record_name = nullptr;
+  size_t source_offset = 0;
+  char* dst = nullptr;
+  size_t length = 0;
+};
+
+void validateShard(
+    const ReshardTensorSpec& spec,
+    const ReshardShard& shard,
+    size_t num_archives,
+    const char* kind) {
+  const size_t ndim = spec.global_sizes.size();
+  TORCH_CHECK(
+      shard.offsets.size() == ndim && shard.sizes.size() == ndim,
+      "reshardCheckpoint: ",
+      kind,
+      " shard of ",
+      spec.fqn,
+      " has rank ",
+      shard.sizes.size(),
+      " but the tensor is rank ",
+      ndim);
+  TORCH_CHECK(
+      shard.archive_index < num_archives,
+      "reshardCheckpoint: ",
+      kind,
+      " shard of ",
+      spec.fqn,
+      " names archive ",
+      shard.archive_index,
+      " but only ",
+      num_archives,
+      " were passed");
+  for (const auto d : c10::irange(ndim)) {
+    TORCH_CHECK(
+        shard.sizes[d] > 0 && shard.offsets[d] >= 0 &&
+            shard.offsets[d] + shard.sizes[d] <= spec.global_sizes[d],
+        "reshardCheckpoint: ",
+        kind,
+        " shard of ",
+        spec.fqn,
+        " is out of bounds in dimension ",
+        d);
+  }
+}
+
+// Appends the copy ranges moving the overlap of `src` and `tgt` into
+// `tgt_buffer`: one run per innermost row of the overlap, merged with the
+// previous run when the two are adjacent in both the source record and
+// the target buffer (e.g. a source shard falling entirely inside a target
+// shard's rows collapses into a single range).
+void appendOverlapRanges(
+    const ReshardTensorSpec& spec,
+    const ReshardShard& src,
+    const ReshardShard& tgt,
+    char* tgt_buffer,
+    std::vector<CopyRange>& out,
+    size_t& covered_bytes) {
+  const size_t ndim = spec.global_sizes.size();
+  std::vector<int64_t> lo(ndim);
+  std::vector<int64_t> hi(ndim);
+  for (const auto d : c10::irange(ndim)) {
+    lo[d] = std::max(src.offsets[d], tgt.offsets[d]);
+    hi[d] = std::min(src.offsets[d] + src.sizes[d], tgt.offsets[d] + tgt.sizes[d]);
+    if (hi[d] <= lo[d]) {
+      return;
+    }
+  }
+  const auto src_strides = contiguousStrides(src.sizes);
+  const auto tgt_strides = contiguousStrides(tgt.sizes);
+  const size_t esize = spec.element_size;
+  const size_t run_bytes =
+      (ndim == 0 ? 1 : static_cast<size_t>(hi[ndim - 1] - lo[ndim - 1])) *
+      esize;
+
+  std::vector<int64_t> idx(lo); // global coordinate; last dim stays at lo
+  while (true) {
+    int64_t src_elem = 0;
+    int64_t tgt_elem = 0;
+    for (const auto d : c10::irange(ndim)) {
+      src_elem += (idx[d] - src.offsets[d]) * src_strides[d];
+      tgt_elem += (idx[d] - tgt.offsets[d]) * tgt_strides[d];
+    }
+    const size_t src_off = static_cast<size_t>(src_elem) * esize;
+    char* dst = tgt_buffer + static_cast<size_t>(tgt_elem) * esize;
+    covered_bytes += run_bytes;
+    if (!out.empty() && out.back().record_name == &src.record_name &&
+        out.back().source_offset + out.back().length == src_off &&
+        out.back().dst + out.back().length == dst) {
+      out.back().length += run_bytes;
+    } else {
+      out.push_back(
+          {src.archive_index, &src.record_name, src_off, dst, run_bytes});
+    }
+    // odometer over the outer dimensions
+    if (ndim <= 1) {
+      break;
+    }
+    int64_t d = static_cast<int64_t>(ndim) - 2;
+    while (d >= 0) {
+      if (++idx[d] < hi[d]) {
+        break;
+      }
+      idx[d] = lo[d];
+      --d;
+    }
+    if (d < 0) {
+      break;
+    }
+  }
+}
+
+} // namespace
+
+ReshardStats reshardCheckpoint(
+    const std::vector<std::shared_ptr<PyTorchStreamReader>>& sources,
+    const std::vector<std::shared_ptr<PyTorchStreamWriter>>& targets,
+    const std::vector<ReshardTensorSpec>& tensors,
+    size_t num_threads) {
+  if (num_threads == 0) {
+    num_threads = std::max<size_t>(std::thread::hardware_concurrency(), 1);
+  }
+
+  // Plan phase: allocate one buffer per target record and compute the
+  // coalesced byte ranges that fill it. Buffers live on the heap, so
+  // growing target_records does not move them under the ranges.
+  struct TargetRecord {
+    size_t archive_index;
+    std::string name;
+    std::unique_ptr<char[]> data;
+    size_t size;
+  };
+  std::vector<TargetRecord> target_records;
+  std::vector<CopyRange> ranges;
+  for (const auto& spec : tensors) {
+    TORCH_CHECK(
+        spec.element_size > 0,
+        "reshardCheckpoint: element_size must be set for ",
+        spec.fqn);
+    for (const auto& src : spec.source_shards) {
+      validateShard(spec, src, sources.size(), "source");
+    }
+    for (const auto& tgt : spec.target_shards) {
+      validateShard(spec, tgt, targets.size(), "target");
+      const size_t nbytes =
+          static_cast<size_t>(numel(tgt.sizes)) * spec.element_size;
+      target_records.push_back(
+          {tgt.archive_index,
+           tgt.record_name,
+           std::make_unique<char[]>(nbytes),
+           nbytes});
+      char* buffer = target_records.back().data.get();
+      size_t covered = 0;
+      for (const auto& src : spec.source_shards) {
+        appendOverlapRanges(spec, src, tgt, buffer, ranges, covered);
+      }
+      TORCH_CHECK(
+          covered == nbytes,
+          "reshardCheckpoint: source shards cover ",
+          covered,
+          " of ",
+          nbytes,
+          " bytes of a target shard of ",
+          spec.fqn,
+          "; source shards must tile every target shard without overlap");
+    }
+  }
+
+  // Fetch phase: workers pull ranges off a shared counter. Reads on one
+  // reader serialize on its internal lock, so the win comes from reading
+  // the many source archives (and independent ranges of large records)
+  // concurrently.
+  {
+    std::atomic<size_t> next{0};
+    const size_t nworkers = std::min(num_threads, ranges.size());
+    std::vector<std::thread> workers;
+    workers.reserve(nworkers);
+    std::atomic<bool> failed{false};
+    std::exception_ptr first_error;
+    std::mutex error_lock;
+    for (size_t w = 0; w < nworkers; w++) {
+      workers.emplace_back([&]() {
+        size_t i = 0;
+        while (!failed.load(std::memory_order_relaxed) &&
+               (i = next.fetch_add(1)) < ranges.size()) {
+          const CopyRange& range = ranges[i];
+          try {
+            sources[range.source_archive]->getRecordSlice(
+                *range.record_name,
+                range.source_offset,
+                range.dst,
+                range.length);
+          } catch (...) {
+            std::lock_guard<std::mutex> guard(error_lock);
+            if (!failed.exchange(true)) {
+              first_error = std::current_exception();
+            }
+          }
+        }
+      });
+    }
+    for (auto& worker : workers) {
+      worker.join();
+    }
+    if (first_error) {
+      std::rethrow_exception(first_error);
+    }
+  }
+
+  // Write phase: append each target archive's records with the parallel
+  // writer (checksums fan out across threads; archive appends stay in
+  // order, so the output is byte-compatible with sequential writeRecord).
+  ReshardStats stats;
+  for (const auto& range : ranges) {
+    stats.bytes_read += range.length;
+  }
+  stats.read_ranges = ranges.size();
+  for (const auto target_index : c10::irange(targets.size())) {
+    std::vector<PyTorchStreamWriter::WriteableRecord> records;
+    for (const auto& record : target_records) {
+      if (record.archive_index == target_index) {
+        records.push_back({record.name, record.data.get(), record.size});
+        stats.bytes_written += record.size;
+      }
+    }
+    if (!records.empty()) {
+      targets[target_index]->writeRecordsParallel(records, num_threads);
+    }
+  }
+  return stats;
+}
+
+} // namespace serialize
+} // namespace caffe2
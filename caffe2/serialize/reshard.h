@@ -0,0 +1,69 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "caffe2/serialize/inline_container.h"
+
+namespace caffe2 {
+namespace serialize {
+
+// One shard of a logical tensor: the zip record holding its bytes and the
+// hyper-rectangle of the global tensor it covers. Shard payloads are
+// assumed row-major and densely packed within their record, which is how
+// tensor data is laid out by both the regular serializer and distributed
+// checkpointing.
+struct TORCH_API ReshardShard {
+  // Index into the readers (for a source shard) or writers (for a target
+  // shard) passed to reshardCheckpoint.
+  size_t archive_index = 0;
+  // Name of the record inside that archive.
+  std::string record_name;
+  // Position of this shard's first element in the global tensor.
+  std::vector<int64_t> offsets;
+  // Extent of this shard along each dimension.
+  std::vector<int64_t> sizes;
+};
+
+// Source and target sharding of one logical tensor. Source shards must
+// tile (cover without overlapping) every target shard.
+struct TORCH_API ReshardTensorSpec {
+  // Fully qualified tensor name; used in error messages only.
+  std::string fqn;
+  size_t element_size = 0;
+  std::vector<int64_t> global_sizes;
+  std::vector<ReshardShard> source_shards;
+  std::vector<ReshardShard> target_shards;
+};
+
+struct TORCH_API ReshardStats {
+  // Bytes fetched from source archives. With a well-formed spec this is
+  // the size of the target checkpoint's tensor data, not the source's.
+  size_t bytes_read = 0;
+  size_t bytes_written = 0;
+  // Distinct contiguous byte ranges fetched, after coalescing adjacent
+  // runs; the read-amplification indicator to watch when validating a
+  // resharding plan.
+  size_t read_ranges = 0;
+};
+
+// Reshards checkpointed tensors between archive layouts. For every target
+// shard the engine computes the minimal set of contiguous byte ranges of
+// the overlapping source records — runs along the innermost dimension,
+// merged whenever consecutive runs are adjacent in both the source record
+// and the target buffer — fetches them in parallel via
+// PyTorchStreamReader::getRecordSlice, and appends the assembled records
+// to the target writers with writeRecordsParallel. Only tensor data
+// moves; the caller emits the target checkpoint's metadata records and
+// calls writeEndOfFile() on each writer. num_threads == 0 means hardware
+// concurrency.
+TORCH_API ReshardStats reshardCheckpoint(
+    const std::vector<std::shared_ptr<PyTorchStreamReader>>& sources,
+    const std::vector<std::shared_ptr<PyTorchStreamWriter>>& targets,
+    const std::vector<ReshardTensorSpec>& tensors,
+    size_t num_threads = 0);
+
+} // namespace serialize
+} // namespace caffe2
@@ -0,0 +1,163 @@
+#include <cstring>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "caffe2/serialize/reshard.h"
+#include "c10/util/irange.h"
+
+namespace caffe2 {
+namespace serialize {
+namespace {
+
+// Serializes a row-major int32 shard of a 4x6 tensor into an in-memory
+// archive and returns the archive bytes.
+std::string makeSourceArchive(
+    const std::string& record_name,
+    const std::vector<int32_t>& values) {
+  std::ostringstream oss;
+  PyTorchStreamWriter writer([&](const void* b, size_t n) -> size_t {
+    oss.write(static_cast<const char*>(b), n);
+    return oss ? n : 0;
+  });
+  writer.writeRecord(
+      record_name, values.data(), values.size() * sizeof(int32_t));
+  writer.writeEndOfFile();
+  return oss.str();
+}
+
+TEST(ReshardCheckpoint, RowShardsToColumnShards) {
+  // Global tensor: 4x6, values 0..23, sharded by rows across two sources.
+  std::vector<int32_t> top; // rows 0-1
+  std::vector<int32_t> bottom; // rows 2-3
+  for (const auto i : c10::irange(24)) {
+    (i < 12 ? top : bottom).push_back(i);
+  }
+  auto archive0 = makeSourceArchive("shard0", top);
+  auto archive1 = makeSourceArchive("shard1", bottom);
+
+  std::istringstream iss0(archive0);
+  std::istringstream iss1(archive1);
+  std::vector<std::shared_ptr<PyTorchStreamReader>> sources = {
+      std::make_shared<PyTorchStreamReader>(&iss0),
+      std::make_shared<PyTorchStreamReader>(&iss1)};
+
+  // Reshard to three targets, each holding a 4x2 column slice.
+  std::vector<std::ostringstream> outs(3);
+  std::vector<std::shared_ptr<PyTorchStreamWriter>> targets;
+  for (const auto t : c10::irange(3)) {
+    targets.push_back(std::make_shared<PyTorchStreamWriter>(
+        [&outs, t](const void* b, size_t n) -> size_t {
+          outs[t].write(static_cast<const char*>(b), n);
+          return outs[t] ? n : 0;
+        }));
+  }
+
+  ReshardTensorSpec spec;
+  spec.fqn = "weight";
+  spec.element_size = sizeof(int32_t);
+  spec.global_sizes = {4, 6};
+  spec.source_shards = {
+      {0, "shard0", {0, 0}, {2, 6}},
+      {1, "shard1", {2, 0}, {2, 6}}};
+  for (const auto t : c10::irange(3)) {
+    spec.target_shards.push_back(
+        {static_cast<size_t>(t), "shard", {0, 2 * t}, {4, 2}});
+  }
+
+  auto stats = reshardCheckpoint(sources, targets, {spec});
+  // Every target byte is read exactly once, and nothing else.
+  EXPECT_EQ(stats.bytes_read, 24 * sizeof(int32_t));
+  EXPECT_EQ(stats.bytes_written, 24 * sizeof(int32_t));
+  // 4 rows x 3 column slices, no coalescing possible across rows here.
+  EXPECT_EQ(stats.read_ranges, 12);
+
+  for (const auto t : c10::irange(3)) {
+    targets[t]->writeEndOfFile();
+    std::istringstream iss(outs[t].str());
+    PyTorchStreamReader reader(&iss);
+    std::vector<int32_t> shard(8);
+    ASSERT_EQ(
+        reader.getRecord("shard", shard.data(), shard.size() * sizeof(int32_t)),
+        shard.size() * sizeof(int32_t));
+    for (const auto r : c10::irange(4)) {
+      for (const auto c : c10::irange(2)) {
+        EXPECT_EQ(shard[r * 2 + c], r * 6 + 2 * t + c);
+      }
+    }
+  }
+}
+
+TEST(ReshardCheckpoint, CoalescesWholeRowRuns) {
+  // One source holding the whole 4x6 tensor, one target taking rows 1-2:
+  // the target shard is a single contiguous byte range of the source.
+  std::vector<int32_t> all;
+  for (const auto i : c10::irange(24)) {
+    all.push_back(i);
+  }
+  auto archive = makeSourceArchive("full", all);
+  std::istringstream iss(archive);
+  std::vector<std::shared_ptr<PyTorchStreamReader>> sources = {
+      std::make_shared<PyTorchStreamReader>(&iss)};
+
+  std::ostringstream out;
+  std::vector<std::shared_ptr<PyTorchStreamWriter>> targets = {
+      std::make_shared<PyTorchStreamWriter>(
+          [&out](const void* b, size_t n) -> size_t {
+            out.write(static_cast<const char*>(b), n);
+            return out ? n : 0;
+          })};
+
+  ReshardTensorSpec spec;
+  spec.fqn = "weight";
+  spec.element_size = sizeof(int32_t);
+  spec.global_sizes = {4, 6};
+  spec.source_shards = {{0, "full", {0, 0}, {4, 6}}};
+  spec.target_shards = {{0, "middle", {1, 0}, {2, 6}}};
+
+  auto stats = reshardCheckpoint(sources, targets, {spec});
+  EXPECT_EQ(stats.read_ranges, 1);
+  EXPECT_EQ(stats.bytes_read, 12 * sizeof(int32_t));
+
+  targets[0]->writeEndOfFile();
+  std::istringstream result(out.str());
+  PyTorchStreamReader reader(&result);
+  std::vector<int32_t> shard(12);
+  reader.getRecord("middle", shard.data(), shard.size() * sizeof(int32_t));
+  for (const auto i : c10::irange(12)) {
+    EXPECT_EQ(shard[i], 6 + i);
+  }
+}
+
+TEST(ReshardCheckpoint, RejectsGappySourceShards) {
+  std::vector<int32_t> top(12, 0);
+  auto archive = makeSourceArchive("shard0", top);
+  std::istringstream iss(archive);
+  std::vector<std::shared_ptr<PyTorchStreamReader>> sources = {
+      std::make_shared<PyTorchStreamReader>(&iss)};
+  std::ostringstream out;
+  std::vector<std::shared_ptr<PyTorchStreamWriter>> targets = {
+      std::make_shared<PyTorchStreamWriter>(
+          [&out](const void* b, size_t n) -> size_t {
+            out.write(static_cast<const char*>(b), n);
+            return out ? n : 0;
+          })};
+
+  ReshardTensorSpec spec;
+  spec.fqn = "weight";
+  spec.element_size = sizeof(int32_t);
+  spec.global_sizes = {4, 6};
+  // Source only covers rows 0-1 but the target wants all four rows.
+  spec.source_shards = {{0, "shard0", {0, 0}, {2, 6}}};
+  spec.target_shards = {{0, "shard", {0, 0}, {4, 6}}};
+
+  // NOLINTNEXTLINE(cppcoreguidelines-avoid-goto,hicpp-avoid-goto)
+  EXPECT_THROW(reshardCheckpoint(sources, targets, {spec}), c10::Error);
+}
+
+} // namespace
+} // namespace serialize
+} // namespace caffe2
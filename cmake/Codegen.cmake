@@ -109,6 +109,19 @@ if(INTERN_BUILD_ATEN_OPS)
       --static_dispatch_backend ${STATIC_DISPATCH_BACKEND})
   endif()
 
+  # Server builds with a fixed op set can statically dispatch just those ops
+  # while keeping the dynamic dispatcher for everything else.
+  if(STATIC_DISPATCH_OP_ALLOWLIST)
+    if(NOT STATIC_DISPATCH_BACKEND)
+      message(FATAL_ERROR
+        "STATIC_DISPATCH_OP_ALLOWLIST requires STATIC_DISPATCH_BACKEND to be "
+        "set (e.g. -DSTATIC_DISPATCH_BACKEND='CPU;CUDA').")
+    endif()
+    message(STATUS "Static dispatch restricted to operator allowlist: ${STATIC_DISPATCH_OP_ALLOWLIST}")
+    list(APPEND CUSTOM_BUILD_FLAGS
+      --static_dispatch_op_allowlist_yaml_path ${STATIC_DISPATCH_OP_ALLOWLIST})
+  endif()
+
   # Codegen unboxing
   if(USE_LIGHTWEIGHT_DISPATCH)
     file(GLOB_RECURSE all_unboxing_script "${CMAKE_CURRENT_LIST_DIR}/../tools/jit/*.py")
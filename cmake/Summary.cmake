@@ -191,6 +191,9 @@ function(caffe2_print_configuration_summary)
   if(NOT "${SELECTED_OP_LIST}" STREQUAL "")
     message(STATUS "  SELECTED_OP_LIST    : ${SELECTED_OP_LIST}")
   endif()
+  if(NOT "${STATIC_DISPATCH_OP_ALLOWLIST}" STREQUAL "")
+    message(STATUS "  STATIC_DISPATCH_OP_ALLOWLIST : ${STATIC_DISPATCH_OP_ALLOWLIST}")
+  endif()
   message(STATUS "  Public Dependencies  : ${Caffe2_PUBLIC_DEPENDENCY_LIBS}")
   message(STATUS "  Private Dependencies : ${Caffe2_DEPENDENCY_LIBS}")
   message(STATUS "  Public CUDA Deps.    : ${Caffe2_PUBLIC_CUDA_DEPENDENCY_LIBS}")
@@ -6,6 +6,7 @@
 
 #include <torch/csrc/autograd/FunctionsManual.h>
 #include <torch/csrc/autograd/functions/basic_ops.h>
+#include <torch/csrc/autograd/functions/checkpoint.h>
 
 #include <test/cpp/api/support.h>
 
@@ -47,6 +48,23 @@ TEST(AutogradAPITests, RegisterHookTensorReturnAcceptsUndefinedTensor) {
   y[0].backward();
 }
 
+TEST(AutogradAPITests, CheckpointRecomputeTest) {
+  auto fn = [](const variable_list& inputs) -> variable_list {
+    return {inputs[0] * inputs[1] + inputs[0].sin()};
+  };
+  Variable x = torch::randn({2, 2}, torch::requires_grad());
+  Variable y = torch::randn({2, 2}, torch::requires_grad());
+  auto out = torch::autograd::checkpoint(fn, {x, y})[0];
+  ASSERT_EQ(graph_desc(out.grad_fn()).substr(0, 19), "CheckpointRecompute");
+  out.sum().backward();
+
+  Variable x2 = x.detach().requires_grad_(true);
+  Variable y2 = y.detach().requires_grad_(true);
+  fn({x2, y2})[0].sum().backward();
+  ASSERT_VARIABLE_EQ(x.grad(), x2.grad());
+  ASSERT_VARIABLE_EQ(y.grad(), y2.grad());
+}
+
 TEST(AutogradAPITests, BackwardSimpleTest) {
   Variable x = torch::randn({2, 2}, torch::requires_grad());
   Variable y = torch::randn({2, 2}, torch::requires_grad());
@@ -10,6 +10,7 @@
 
 #include <algorithm>
 #include <chrono>
+#include <fstream>
 #include <future>
 #include <iostream>
 #include <iterator>
@@ -47,6 +48,57 @@ TEST(DataTest, DatasetCallsGetCorrectly) {
   ASSERT_EQ(batch, expected);
 }
 
+TEST(DataTest, ReadCSVDecodesColumns) {
+  auto file = c10::make_tempfile(".csv");
+  {
+    std::ofstream stream(file.name);
+    stream << "price,count,city\n";
+    for (const auto i : c10::irange(100)) {
+      stream << (0.5 + i) << "," << (i * 10) << ","
+             << (i % 2 == 0 ? "tokyo" : "\"new,york\"") << "\n";
+    }
+  }
+
+  auto columns = datasets::read_csv(file.name);
+  ASSERT_EQ(columns.size(), 3);
+
+  ASSERT_EQ(columns[0].name, "price");
+  ASSERT_EQ(columns[0].type, datasets::CSVColumnType::kFloat32);
+  ASSERT_EQ(columns[0].values.dtype(), torch::kFloat32);
+  ASSERT_EQ(columns[0].values.size(0), 100);
+  ASSERT_EQ(columns[0].values[42].item<float>(), 42.5f);
+
+  ASSERT_EQ(columns[1].name, "count");
+  ASSERT_EQ(columns[1].type, datasets::CSVColumnType::kInt64);
+  ASSERT_EQ(columns[1].values[42].item<int64_t>(), 420);
+
+  ASSERT_EQ(columns[2].name, "city");
+  ASSERT_EQ(columns[2].type, datasets::CSVColumnType::kCategorical);
+  ASSERT_EQ(columns[2].values.dtype(), torch::kInt32);
+  std::vector<std::string> expected_dictionary = {"tokyo", "new,york"};
+  ASSERT_EQ(columns[2].dictionary, expected_dictionary);
+  ASSERT_EQ(columns[2].values[0].item<int32_t>(), 0);
+  ASSERT_EQ(columns[2].values[1].item<int32_t>(), 1);
+
+  // Explicit column types override inference.
+  datasets::CSVReadOptions options;
+  options.column_types = {
+      datasets::CSVColumnType::kFloat32,
+      datasets::CSVColumnType::kFloat32,
+      datasets::CSVColumnType::kCategorical};
+  auto typed = datasets::read_csv(file.name, options);
+  ASSERT_EQ(typed[1].values.dtype(), torch::kFloat32);
+  ASSERT_EQ(typed[1].values[42].item<float>(), 420.0f);
+
+  // Unparsable cells surface the row and column in the error.
+  options.column_types = {
+      datasets::CSVColumnType::kInt64,
+      datasets::CSVColumnType::kInt64,
+      datasets::CSVColumnType::kInt64};
+  ASSERT_THROWS_WITH(
+      datasets::read_csv(file.name, options), "Failed to parse");
+}
+
 TEST(DataTest, TransformCallsGetApplyCorrectly) {
   struct T : transforms::Transform<int, std::string> {
     std::string apply(int input) override {
@@ -1,7 +1,9 @@
 #include <gtest/gtest.h>
 
 #include "test/cpp/jit/test_utils.h"
+#include "torch/csrc/jit/ir/irparser.h"
 #include "torch/csrc/jit/runtime/graph_executor.h"
+#include "torch/csrc/jit/runtime/profiling_graph_executor_impl.h"
 #include "torch/jit.h"
 #include "torch/script.h"
 #include "torch/torch.h"
@@ -68,5 +70,40 @@ TEST(GraphExecutorTest, runAsync_executor) {
   ASSERT_TRUE(asyncCounter > 0);
 }
 
+TEST(GraphExecutorTest, SymbolicPlanCache) {
+  bool prev_flag = FLAGS_torch_jit_symbolic_plan_cache;
+  FLAGS_torch_jit_symbolic_plan_cache = true;
+
+  const auto src = R"IR(
+      graph(%a : Tensor, %b : Tensor):
+        %c : Tensor = aten::mul(%a, %b)
+        %d : Tensor = aten::relu(%c)
+        return (%d))IR";
+  auto graph = std::make_shared<Graph>();
+  parseIR(src, graph.get());
+  GraphExecutor executor(graph, "");
+
+  // Varying batch sizes all map to one symbolic signature; revisiting an
+  // earlier size must reuse the cached plan and still compute correctly.
+  for (int batch_size : {1, 8, 32, 8, 1}) {
+    auto a = at::randn({batch_size, 16});
+    auto b = at::randn({batch_size, 16});
+    auto stack = createStack({a, b});
+    executor.run(stack);
+    ASSERT_EQ(stack.size(), 1);
+    ASSERT_TRUE(almostEqual(stack[0].toTensor(), at::relu(a * b)));
+  }
+
+  // A rank change is a different signature and gets its own plan.
+  auto a = at::randn({4, 8, 16});
+  auto b = at::randn({4, 8, 16});
+  auto stack = createStack({a, b});
+  executor.run(stack);
+  ASSERT_EQ(stack.size(), 1);
+  ASSERT_TRUE(almostEqual(stack[0].toTensor(), at::relu(a * b)));
+
+  FLAGS_torch_jit_symbolic_plan_cache = prev_flag;
+}
+
 } // namespace jit
 } // namespace torch
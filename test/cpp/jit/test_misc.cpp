@@ -51,6 +51,7 @@
 #include <torch/csrc/jit/runtime/custom_operator.h>
 #include <torch/csrc/jit/runtime/decomposition_registry.h>
 #include <torch/csrc/jit/runtime/graph_executor.h>
+#include <torch/csrc/jit/runtime/inference_session.h>
 #include <torch/csrc/jit/runtime/interpreter.h>
 #include <torch/csrc/jit/runtime/jit_trace.h>
 #include <torch/csrc/jit/runtime/profiling_record.h>
@@ -2475,6 +2476,55 @@ TEST(FuturesTest, Then) {
   ASSERT_TRUE(done);
 }
 
+// then() with an explicit executor: the continuation must not run inline on
+// the completing thread.
+TEST(FuturesTest, ThenWithExecutor) {
+  std::vector<std::function<void()>> queue;
+  auto executor = [&queue](std::function<void()> task) {
+    queue.push_back(std::move(task));
+  };
+  auto f1 = c10::make_intrusive<Future>(IntType::get());
+  auto f2 = f1->then(
+      [](Future& f1) -> IValue { return f1.constValue().toInt() + 1; },
+      IntType::get(),
+      executor);
+  f1->markCompleted(42);
+  // Completing the parent only enqueued the continuation.
+  ASSERT_FALSE(f2->completed());
+  ASSERT_EQ(queue.size(), 1);
+  queue[0]();
+  ASSERT_TRUE(f2->completed());
+  ASSERT_EQ(f2->constValue().toInt(), 43);
+
+  // An executor-backed callback on an already-completed future is posted
+  // right away instead of running inline.
+  int sat = 0;
+  f2->addCallback([&sat](Future& /* unused */) { ++sat; }, executor);
+  ASSERT_EQ(sat, 0);
+  ASSERT_EQ(queue.size(), 2);
+  queue[1]();
+  ASSERT_EQ(sat, 1);
+}
+
+TEST(InferenceSessionTest, CpuWarmupAndRun) {
+  Module m("m");
+  m.define(R"(
+    def forward(self, x):
+        return x + x
+  )");
+
+  InferenceSession session(m, at::kCPU);
+  ASSERT_FALSE(session.stream().has_value());
+  ASSERT_FALSE(session.warmed_up());
+
+  session.addWarmupInputs({torch::ones({4})});
+  session.warmup();
+  ASSERT_TRUE(session.warmed_up());
+
+  auto out = session.run({torch::ones({4})}).toTensor();
+  ASSERT_TRUE(out.equal(2 * torch::ones({4})));
+}
+
 // collectAll()
 TEST(FuturesTest, CollectAll) {
   auto s1 = c10::make_intrusive<Future>(IntType::get());
@@ -0,0 +1,97 @@
+#include <gtest/gtest.h>
+
+#include <test/cpp/jit/test_utils.h>
+#include <torch/csrc/jit/ir/irparser.h>
+#include <torch/csrc/jit/passes/parallelize_independent_subgraphs.h>
+
+namespace torch {
+namespace jit {
+
+TEST(ParallelizeIndependentSubgraphsTest, TwoTowers) {
+  const auto src = R"IR(
+        graph(%a: Tensor, %b: Tensor):
+            %x1: Tensor = aten::relu(%a)
+            %x2: Tensor = aten::relu(%x1)
+            %y1: Tensor = aten::sigmoid(%b)
+            %y2: Tensor = aten::sigmoid(%y1)
+            %z: Tensor = aten::mul(%x2, %y2)
+            return (%z)
+    )IR";
+
+  auto graph = std::make_shared<Graph>();
+  parseIR(src, graph.get());
+  ParallelizeIndependentSubgraphs(graph);
+
+  // Both towers become forks whose results are awaited before the join.
+  testing::FileCheck()
+      .check_count("= prim::fork", 2, /*exactly*/ true)
+      ->check_count("= aten::wait", 2, /*exactly*/ true)
+      ->check("= aten::mul")
+      ->run(*graph);
+}
+
+TEST(ParallelizeIndependentSubgraphsTest, SingleBranchNotForked) {
+  const auto src = R"IR(
+        graph(%a: Tensor):
+            %x1: Tensor = aten::relu(%a)
+            %x2: Tensor = aten::relu(%x1)
+            return (%x2)
+    )IR";
+
+  auto graph = std::make_shared<Graph>();
+  parseIR(src, graph.get());
+  ParallelizeIndependentSubgraphs(graph);
+
+  // A lone branch would just make the caller wait on itself.
+  testing::FileCheck()
+      .check_count("= prim::fork", 0, /*exactly*/ true)
+      ->run(*graph);
+}
+
+TEST(ParallelizeIndependentSubgraphsTest, MutationBlocksForking) {
+  const auto src = R"IR(
+        graph(%a: Tensor, %b: Tensor):
+            %x1: Tensor = aten::relu(%a)
+            %x2: Tensor = aten::relu_(%x1)
+            %y1: Tensor = aten::sigmoid(%b)
+            %y2: Tensor = aten::sigmoid(%y1)
+            %z: Tensor = aten::mul(%x2, %y2)
+            return (%z)
+    )IR";
+
+  auto graph = std::make_shared<Graph>();
+  parseIR(src, graph.get());
+  ParallelizeIndependentSubgraphs(graph);
+
+  // The mutating tower is a join point, leaving only one forkable branch,
+  // so the graph must be left untouched.
+  testing::FileCheck()
+      .check_count("= prim::fork", 0, /*exactly*/ true)
+      ->run(*graph);
+}
+
+TEST(ParallelizeIndependentSubgraphsTest, MultipleOutputsGoThroughTuple) {
+  const auto src = R"IR(
+        graph(%a: Tensor, %b: Tensor):
+            %x1: Tensor = aten::relu(%a)
+            %x2: Tensor = aten::relu(%x1)
+            %y1: Tensor = aten::sigmoid(%b)
+            %y2: Tensor = aten::sigmoid(%y1)
+            %z: Tensor = aten::mul(%x2, %y2)
+            return (%z, %x1)
+    )IR";
+
+  auto graph = std::make_shared<Graph>();
+  parseIR(src, graph.get());
+  ParallelizeIndependentSubgraphs(graph);
+
+  // The first tower produces two values used outside of it (%x2 by the join
+  // and %x1 as a graph output), so its fork returns a tuple.
+  testing::FileCheck()
+      .check_count("= prim::fork", 2, /*exactly*/ true)
+      ->check_count("= prim::TupleUnpack", 1, /*exactly*/ true)
+      ->run(*graph);
+}
+
+} // namespace jit
+} // namespace torch
@@ -7,6 +7,7 @@
 #include <caffe2/serialize/inline_container.h>
 #include <torch/csrc/jit/mobile/module.h>
 #include <torch/csrc/jit/runtime/calculate_necessary_args.h>
+#include <torch/csrc/jit/serialization/constant_dedup.h>
 #include <torch/csrc/jit/serialization/export.h>
 #include <torch/csrc/jit/serialization/export_bytecode.h>
 #include <torch/csrc/jit/serialization/import.h>
@@ -319,6 +320,43 @@ TEST(TestSaveLoad, LoadWithoutDebugInfo) { // NOLINT (use =delete in gtest)
   ASSERT_THROWS_WITH_MESSAGE(m3.run_method("exception"), error2);
 }
 
+TEST(SerializationTest, DedupConstantTensorsAcrossModules) {
+  const auto value = at::arange(0, 64, at::TensorOptions().dtype(at::kFloat));
+
+  // Builds and saves a module whose forward returns `value` as a constant.
+  auto makeSaved = [&]() {
+    Module m("m", std::make_shared<CompilationUnit>());
+    m.define(R"(def forward(self): return 1)");
+    auto graph = m.get_method("forward").graph();
+    WithInsertPoint guard(graph->return_node());
+    Value* constant = graph->insertConstant(value);
+    graph->eraseOutput(0);
+    graph->registerOutput(constant);
+    std::stringstream ss;
+    m.save(ss);
+    return ss;
+  };
+
+  auto loadConstant = [&](bool enable) {
+    auto ss = makeSaved();
+    setConstantTensorDedupEnabled(enable);
+    Module loaded = torch::jit::load(ss);
+    setConstantTensorDedupEnabled(false);
+    return loaded.forward({}).toTensor();
+  };
+
+  auto first = loadConstant(/*enable=*/true);
+  auto second = loadConstant(/*enable=*/true);
+  // Identical constants from separately loaded modules share one copy.
+  EXPECT_EQ(first.const_data_ptr(), second.const_data_ptr());
+  EXPECT_TRUE(first.equal(second));
+
+  auto third = loadConstant(/*enable=*/false);
+  // With deduplication disabled, each module owns a private copy.
+  EXPECT_NE(first.const_data_ptr(), third.const_data_ptr());
+  EXPECT_TRUE(first.equal(third));
+}
+
 TEST(SerializationTest, TestPickleAppend) {
   auto data = std::vector<char>({'\x80', char(2), ']', 'K', char(2), 'a', '.'});
 
@@ -0,0 +1,88 @@
+#include <gtest/gtest.h>
+
+#include <c10/util/Exception.h>
+#include <torch/csrc/lazy/core/config.h>
+#include <torch/csrc/lazy/core/hash_cons.h>
+#include <torch/csrc/lazy/core/ir.h>
+#include <torch/csrc/lazy/core/ir_builder.h>
+#include <memory>
+
+namespace torch {
+namespace lazy {
+
+class HashConsNode : public Node {
+ public:
+  static OpKind ClassOpKind() {
+    return OpKind();
+  }
+
+  explicit HashConsNode(size_t id)
+      : Node(ClassOpKind(), /* num_outputs */ 1), hash_(Hash(id)) {}
+  ~HashConsNode() override = default;
+
+  hash_t hash() const override {
+    return hash_;
+  }
+  hash_t shapeHash() const override {
+    return hash_;
+  }
+
+ private:
+  hash_t hash_;
+};
+
+class OpaqueHashConsNode : public HashConsNode {
+ public:
+  explicit OpaqueHashConsNode(size_t id) : HashConsNode(id) {}
+
+  bool canBeHashConsed() const override {
+    return false;
+  }
+};
+
+TEST(HashConsTest, TestIntern) {
+  bool prior = FLAGS_torch_lazy_ir_hash_cons;
+  FLAGS_torch_lazy_ir_hash_cons = true;
+  HashConsCache::Get()->Clear();
+
+  NodePtr a = MakeNode<HashConsNode>(0);
+  NodePtr b = MakeNode<HashConsNode>(1);
+
+  // Hash-equal nodes are interned, regardless of creation order
+  EXPECT_EQ(MakeNode<HashConsNode>(0).get(), a.get());
+  EXPECT_EQ(MakeNode<HashConsNode>(1).get(), b.get());
+  EXPECT_EQ(MakeNode<HashConsNode>(0).get(), a.get());
+  EXPECT_NE(MakeNode<HashConsNode>(2).get(), a.get());
+
+  // MarkStep drops the interned nodes
+  HashConsCache::Get()->Clear();
+  EXPECT_NE(MakeNode<HashConsNode>(0).get(), a.get());
+
+  FLAGS_torch_lazy_ir_hash_cons = prior;
+}
+
+TEST(HashConsTest, TestOptOut) {
+  bool prior = FLAGS_torch_lazy_ir_hash_cons;
+  FLAGS_torch_lazy_ir_hash_cons = true;
+  HashConsCache::Get()->Clear();
+
+  // Nodes that opt out (e.g. DeviceData) are never shared
+  NodePtr a = MakeNode<OpaqueHashConsNode>(0);
+  EXPECT_NE(MakeNode<OpaqueHashConsNode>(0).get(), a.get());
+
+  HashConsCache::Get()->Clear();
+  FLAGS_torch_lazy_ir_hash_cons = prior;
+}
+
+TEST(HashConsTest, TestDisabled) {
+  bool prior = FLAGS_torch_lazy_ir_hash_cons;
+  FLAGS_torch_lazy_ir_hash_cons = false;
+
+  NodePtr a = MakeNode<HashConsNode>(0);
+  EXPECT_NE(MakeNode<HashConsNode>(0).get(), a.get());
+
+  FLAGS_torch_lazy_ir_hash_cons = prior;
+}
+
+} // namespace lazy
+} // namespace torch
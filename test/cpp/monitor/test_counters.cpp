@@ -279,6 +279,77 @@ TEST(MonitorTest, StatEvent) {
   ASSERT_EQ(e.data, data);
 }
 
+TEST(MonitorTest, HistogramStat) {
+  HandlerGuard<AggregatingEventHandler> guard;
+
+  {
+    HistogramStat<int64_t> a{
+        "a",
+        /*lower=*/0,
+        /*upper=*/100,
+        /*bucketCount=*/10,
+        std::chrono::milliseconds(100000),
+    };
+    for (int64_t i = 0; i < 100; i++) {
+      a.add(i);
+    }
+    ASSERT_EQ(a.count(), 100);
+    ASSERT_EQ(guard.handler->events.size(), 0);
+  }
+  // destruction logs the open window
+  ASSERT_EQ(guard.handler->events.size(), 1);
+
+  Event e = guard.handler->events.at(0);
+  ASSERT_EQ(e.name, "torch.monitor.Stat");
+  ASSERT_NE(e.timestamp, std::chrono::system_clock::time_point{});
+  std::unordered_map<std::string, data_value_t> data{
+      {"a.count", 100L},
+      {"a.p50", 50L},
+      {"a.p90", 90L},
+      {"a.p99", 100L},
+  };
+  ASSERT_EQ(e.data, data);
+}
+
+TEST(MonitorTest, HistogramStatClamp) {
+  HandlerGuard<AggregatingEventHandler> guard;
+
+  {
+    HistogramStat<int64_t> a{
+        "a",
+        /*lower=*/0,
+        /*upper=*/100,
+        /*bucketCount=*/10,
+        std::chrono::milliseconds(100000),
+    };
+    // out of range values count towards the first and last buckets
+    a.add(-10);
+    a.add(5000);
+    ASSERT_EQ(a.count(), 2);
+  }
+  ASSERT_EQ(guard.handler->events.size(), 1);
+
+  Event e = guard.handler->events.at(0);
+  std::unordered_map<std::string, data_value_t> data{
+      {"a.count", 2L},
+      {"a.p50", 10L},
+      {"a.p90", 100L},
+      {"a.p99", 100L},
+  };
+  ASSERT_EQ(e.data, data);
+}
+
+TEST(MonitorTest, HistogramStatInvalidArgs) {
+  ASSERT_THROW(
+      (HistogramStat<int64_t>{
+          "a", /*lower=*/10, /*upper=*/10, 1, std::chrono::milliseconds(1)}),
+      std::runtime_error);
+  ASSERT_THROW(
+      (HistogramStat<int64_t>{
+          "a", /*lower=*/0, /*upper=*/10, 0, std::chrono::milliseconds(1)}),
+      std::runtime_error);
+}
+
 TEST(MonitorTest, StatEventDestruction) {
   HandlerGuard<AggregatingEventHandler> guard;
 
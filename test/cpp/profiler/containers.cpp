@@ -8,6 +8,7 @@
 #include <c10/util/ApproximateClock.h>
 #include <c10/util/irange.h>
 #include <torch/csrc/profiler/containers.h>
+#include <torch/csrc/profiler/interning.h>
 #include <torch/csrc/profiler/util.h>
 
 TEST(ProfilerTest, AppendOnlyList) {
@@ -28,6 +29,17 @@ TEST(ProfilerTest, AppendOnlyList) {
   ASSERT_EQ(list.size(), 0);
 }
 
+TEST(ProfilerTest, StringInterner) {
+  auto& interner = torch::profiler::impl::StringInterner::singleton();
+  const auto a = interner.intern("aten::add");
+  const auto b = interner.intern(std::string("aten::mul"));
+  ASSERT_NE(a, b);
+  ASSERT_EQ(interner.intern("aten::add"), a);
+  ASSERT_EQ(interner.lookupString(a), "aten::add");
+  ASSERT_EQ(interner.lookupString(b), "aten::mul");
+  ASSERT_GE(interner.size(), 2);
+}
+
 TEST(ProfilerTest, AppendOnlyList_ref) {
   const int n = 512;
   torch::profiler::impl::AppendOnlyList<std::pair<int, int>, 64> list;
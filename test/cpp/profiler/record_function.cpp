@@ -46,6 +46,37 @@ TEST(RecordFunctionTest, AddRemove) {
   ASSERT_FALSE(at::hasCallbacks());
 }
 
+// Test that the empty-callback fast path stays in sync with registration.
+TEST(RecordFunctionTest, EmptyFastPath) {
+  at::clearCallbacks();
+  ASSERT_FALSE(at::hasCallbacks());
+
+  auto step_callbacks = [] {
+    return at::getStepCallbacksUnlessEmpty(at::RecordScope::FUNCTION);
+  };
+  ASSERT_FALSE(step_callbacks().has_value());
+
+  auto start_callback =
+      [](const at::RecordFunction& fn) -> std::unique_ptr<at::ObserverContext> {
+    return nullptr;
+  };
+  auto end_callback = [](const at::RecordFunction& fn, at::ObserverContext*) {};
+
+  auto handle = at::addThreadLocalCallback(
+      at::RecordFunctionCallback(start_callback, end_callback));
+  ASSERT_TRUE(step_callbacks().has_value());
+
+  at::removeCallback(handle);
+  ASSERT_FALSE(step_callbacks().has_value());
+
+  handle = at::addGlobalCallback(
+      at::RecordFunctionCallback(start_callback, end_callback));
+  ASSERT_TRUE(step_callbacks().has_value());
+
+  at::clearCallbacks();
+  ASSERT_FALSE(step_callbacks().has_value());
+}
+
 // Test that the callbacks that we register are actually run.
 TEST(RecordFunctionTest, ThreadLocalState) {
   at::clearCallbacks();
@@ -39,6 +39,34 @@ TEST(WireSerialize, Base) {
   run("more", {torch::randn({5, 5}), torch::rand({10, 10})});
 }
 
+TEST(WireSerialize, Segments) {
+  std::string payload("payload");
+  std::vector<char> mpayload(payload.begin(), payload.end());
+  std::vector<at::Tensor> tensors = {torch::randn({5, 5})};
+
+  auto buffers =
+      torch::distributed::rpc::wireSerializeSegments(mpayload, tensors);
+
+  // Concatenating the segments must yield exactly the flat wire format.
+  std::string gathered;
+  for (const auto& segment : buffers.segments()) {
+    gathered.append(segment.data, segment.size);
+  }
+  EXPECT_EQ(gathered, torch::distributed::rpc::wireSerialize(mpayload, tensors));
+  EXPECT_EQ(gathered.size(), buffers.totalSize());
+
+  // Tensor segments must alias tensor storage rather than a copy.
+  auto segments = buffers.segments();
+  EXPECT_EQ(
+      segments.back().data,
+      static_cast<const char*>(buffers.tensorData[0].storage().data()));
+
+  auto deser =
+      torch::distributed::rpc::wireDeserialize(gathered.data(), gathered.size());
+  EXPECT_EQ(payload.size(), deser.first.size());
+  EXPECT_TRUE(torch::equal(tensors[0], deser.second[0]));
+}
+
 TEST(WireSerialize, RecopySparseTensors) {
   // Take a 1K row of a 1M tensors, and make sure we don't send across 1M rows.
   constexpr size_t k1K = 1024;
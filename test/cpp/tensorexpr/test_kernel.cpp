@@ -2129,5 +2129,50 @@ TEST_F(Kernel, DoNotFuseLoopsWithMismatchingVariableDims) {
 #endif
 }
 
+TEST_F(Kernel, CodeCacheDedupsStructurallyIdenticalKernels) {
+  // See Note [NNC kernel code cache]: two statements that only differ in the
+  // identity of their Vars/Bufs must share one compiled artifact, while a
+  // structurally different statement must not.
+  auto make_loop = [](float scale) {
+    BufHandle a("a", {64}, kFloat);
+    BufHandle b("b", {64}, kFloat);
+    VarHandle i("i", kInt);
+    auto body = b.store({i}, a.load(i) * scale);
+    StmtPtr loop = For::make(i, 0, 64, body);
+    std::vector<CodeGen::BufferArg> args = {a, b};
+    return std::make_pair(loop, args);
+  };
+
+  bool old_enabled = getKernelCodeCacheEnabled();
+  getKernelCodeCacheEnabled() = true;
+
+  auto k1 = make_loop(2.f);
+  auto k2 = make_loop(2.f);
+  auto k3 = make_loop(3.f);
+  auto cg1 = TensorExprKernel::getCachedOrCreateCodeGen(
+      "simple_ir_eval", k1.first, k1.second, at::kCPU, "f1");
+  auto cg2 = TensorExprKernel::getCachedOrCreateCodeGen(
+      "simple_ir_eval", k2.first, k2.second, at::kCPU, "f2");
+  auto cg3 = TensorExprKernel::getCachedOrCreateCodeGen(
+      "simple_ir_eval", k3.first, k3.second, at::kCPU, "f3");
+  ASSERT_EQ(cg1.get(), cg2.get());
+  ASSERT_NE(cg1.get(), cg3.get());
+
+  // The shared artifact still computes the right answer for the second
+  // kernel's (distinct) buffers.
+  std::vector<float> in(64, 1.5f);
+  std::vector<float> out(64, 0.f);
+  cg2->call({in.data(), out.data()});
+  for (const auto j : c10::irange(64)) {
+    ASSERT_EQ(out[j], 3.f);
+  }
+
+  getKernelCodeCacheEnabled() = false;
+  auto cg4 = TensorExprKernel::getCachedOrCreateCodeGen(
+      "simple_ir_eval", k1.first, k1.second, at::kCPU, "f4");
+  ASSERT_NE(cg1.get(), cg4.get());
+  getKernelCodeCacheEnabled() = old_enabled;
+}
+
 } // namespace jit
 } // namespace torch
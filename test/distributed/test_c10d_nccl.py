@@ -2407,10 +2407,15 @@ class DistributedDataParallelTest(
         """
         process_group = self._get_process_group()
 
-        for comm_hook_type in [
+        builtin_comm_hook_types = [
             dist.BuiltinCommHookType.ALLREDUCE,
             dist.BuiltinCommHookType.FP16_COMPRESS,
-        ]:
+        ]
+        # BF16_COMPRESS allreduces in bfloat16, which needs NCCL 2.10+.
+        if BFLOAT16_AVAILABLE and torch.cuda.nccl.version() >= (2, 10):
+            builtin_comm_hook_types.append(dist.BuiltinCommHookType.BF16_COMPRESS)
+
+        for comm_hook_type in builtin_comm_hook_types:
             # Get GPU model with the built-in communication hook.
             gpu_model = self._gpu_model_with_builtin_ddp_comm_hook(
                 process_group, comm_hook_type, gradient_as_bucket_view
@@ -340,6 +340,48 @@ class TestFreezing(JitTestCase):
         output_f = mf.forward(input)
         self.assertEqual(output_s, output_f)
 
+    def test_freeze_module_dedups_constants_across_methods(self):
+        class TwoHeads(nn.Module):
+            def __init__(self):
+                super().__init__()
+                w = torch.randn(8, 8)
+                self.w1 = w.clone()
+                self.w2 = w.clone()
+
+            def forward(self, x):
+                return x @ self.w1
+
+            @torch.jit.export
+            def head2(self, x):
+                return x @ self.w2 + 1
+
+        m = torch.jit.script(TwoHeads())
+        m.eval()
+        input = torch.randn(2, 8)
+        expected_forward = m.forward(input)
+        expected_head2 = m.head2(input)
+
+        # The pass reports the bytes released by sharing the duplicated weight.
+        mf_c = torch._C._freeze_module(m._c, ["head2"])
+        deduped = torch._C._jit_pass_dedup_frozen_tensor_constants(mf_c)
+        self.assertEqual(deduped, m.w1.numel() * m.w1.element_size())
+
+        def constant_tensors(graph):
+            return [
+                node.t("value")
+                for node in graph.findAllNodes("prim::Constant")
+                if node.hasAttribute("value") and node.kindOf("value") == "t"
+            ]
+
+        # torch.jit.freeze runs the dedup, so the content-identical weight
+        # constants of the two entry points share a single storage.
+        mf = torch.jit.freeze(m, preserved_attrs=["head2"])
+        [w1] = constant_tensors(mf.forward.graph)
+        [w2] = constant_tensors(mf.head2.graph)
+        self.assertEqual(w1.data_ptr(), w2.data_ptr())
+        self.assertEqual(mf.forward(input), expected_forward)
+        self.assertEqual(mf.head2(input), expected_head2)
+
     def test_freeze_module_with_sharedclasstype(self):
         class SubModule(nn.Module):
             def __init__(self):
@@ -2571,6 +2613,25 @@ class TestFrozenOptimizations(JitTestCase):
         test_weight = torch.rand([30, 20])
         self.check_linear_optimizations_2(mod_eager, 1, 1, "transpose_frozen_linear", (test_val, test_weight))
 
+    def test_finalize_weight_layouts(self):
+        mod_eager = nn.Conv2d(8, 32, kernel_size=3).eval()
+        inp = torch.rand(2, 8, 14, 14).to(memory_format=torch.channels_last)
+
+        scripted_mod = torch.jit.trace(mod_eager, (inp,))
+        # successfully no-ops with non-const inputs
+        self.run_pass("finalize_frozen_weight_layouts", scripted_mod.graph)
+
+        scripted_mod = torch.jit.freeze(scripted_mod)
+        self.run_pass("finalize_frozen_weight_layouts", scripted_mod.graph)
+
+        # the weight constant is rewritten into the serving layout inferred
+        # from the channels-last strides of the traced input
+        conv_node = scripted_mod.graph.findNode("aten::conv2d")
+        weight = list(conv_node.inputs())[1].node().t("value")
+        self.assertTrue(weight.is_contiguous(memory_format=torch.channels_last))
+
+        self.assertEqual(mod_eager(inp), scripted_mod(inp))
+
     def check_linear_optimizations_2(self, eager_mod, orig_linears, new_linears, opt_pass, test_vals):
         # TODO: merge with check_linear_optimizations once both diffs land
         mod_to_device = eager_mod
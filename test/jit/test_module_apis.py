@@ -126,3 +126,37 @@ class TestModuleAPIs(JitTestCase):
         self.assertFalse(m2.sub.customized_load_state_dict_called)
         m2.load_state_dict(state_dict)
         self.assertTrue(m2.sub.customized_load_state_dict_called)
+
+    def test_double_buffered_parameter_swap(self):
+        """Tests the double-buffered weight refresh API on the C++ module"""
+
+        class Mod(torch.nn.Module):
+            def __init__(self):
+                super().__init__()
+                self.fc = torch.nn.Linear(4, 4)
+
+            def forward(self, x):
+                return self.fc(x)
+
+        m = torch.jit.script(Mod())
+        x = torch.randn(2, 4)
+        baseline = m(x)
+        self.assertEqual(m._c._parameter_generation(), 0)
+
+        new_weight = torch.randn(4, 4)
+        m._c._inactive_parameter("fc.weight").copy_(new_weight)
+        # The live weights are untouched until the flip.
+        self.assertEqual(m(x), baseline)
+
+        self.assertEqual(m._c._swap_parameter_generations(), 1)
+        self.assertEqual(m._c._parameter_generation(), 1)
+        expected = torch.nn.functional.linear(x, new_weight, m.fc.bias)
+        self.assertEqual(m(x), expected)
+
+        # Flipping again restores the original weights: repeated refreshes
+        # alternate between the same two storages.
+        m._c._swap_parameter_generations()
+        self.assertEqual(m(x), baseline)
+
+        with self.assertRaisesRegex(RuntimeError, "not a parameter"):
+            m._c._inactive_parameter("fc.not_a_param")
@@ -2424,6 +2424,40 @@ class TestConvolutionNNDeviceType(NNTestCase):
             else:
                 self.assertEqual(F.relu(conv2d_out + alpha * z), cudnn_out)
 
+    @onlyCUDA
+    @skipCUDAIfRocm
+    @skipCUDAIfNoCudnn
+    @dtypes(torch.float, torch.float16)
+    @precisionOverride({torch.half: 0.002, torch.float: 1e-4})
+    def test_cudnn_convolution_bn_relu(self, device, dtype):
+        for batch, groups, memory_format in \
+                product((1, 3),
+                        (1, 4),
+                        (torch.channels_last, torch.contiguous_format)):
+            inp = torch.rand(batch, groups, 8, 8, dtype=dtype, device=device)
+            w = torch.randn(8, groups, 3, 3, dtype=dtype, device=device)
+            bn = nn.BatchNorm2d(8, device=device).eval()
+            bn.running_mean.uniform_(-0.5, 0.5)
+            bn.running_var.uniform_(0.5, 1.5)
+            bn.weight.data.uniform_(0.5, 1.5)
+            bn.bias.data.uniform_(-0.5, 0.5)
+
+            conv2d_out = torch.conv2d(inp, w, None, (1, 1), (0, 0), (1, 1), 1)
+            with torch.no_grad():
+                ref = bn(conv2d_out.float()).relu().to(dtype)
+
+            inp = inp.to(memory_format=memory_format)
+            w = w.to(memory_format=memory_format)
+            cudnn_out = torch.cudnn_convolution_bn_relu(
+                inp, w, None, bn.weight, bn.bias, bn.running_mean,
+                bn.running_var, bn.eps, (1, 1), (0, 0), (1, 1), 1)
+
+            self.assertTrue(cudnn_out.is_contiguous(memory_format=memory_format))
+            if tf32_is_not_fp32() and dtype == torch.float:
+                self.assertEqual(ref, cudnn_out, atol=4e-3, rtol=0.006)
+            else:
+                self.assertEqual(ref, cudnn_out, atol=2e-3, rtol=0.006)
+
     @onlyCUDA
     @skipCUDAIfRocm
     @skipCUDAIfCudnnVersionLessThan(7603)
@@ -10,7 +10,8 @@ from torch.testing._internal.common_utils import run_tests, set_default_dtype, \
     instantiate_parametrized_tests, TEST_PRIVATEUSE1
 from torch.testing._internal.common_cuda import TEST_CUDA
 from torch.testing._internal.common_nn import NNTestCase, freeze_rng_state
-from torch.testing._internal.common_device_type import instantiate_device_type_tests, expectedFailureXLA
+from torch.testing._internal.common_device_type import instantiate_device_type_tests, expectedFailureXLA, \
+    dtypes, dtypesIfCUDA, onlyNativeDeviceTypes
 import torch.nn.functional as F
 import torch.nn as nn
 
@@ -280,6 +281,59 @@ class TestDropoutNNDeviceType(NNTestCase):
         out = torch.nn.functional.dropout(x)
         self.assertEqual(out.size(), x.size())
 
+    @onlyNativeDeviceTypes
+    @dtypes(torch.float32, torch.float64)
+    @dtypesIfCUDA(torch.float32, torch.float16, torch.bfloat16)
+    def test_fused_dropout_add_layer_norm(self, device, dtype):
+        if dtype == torch.float16:
+            atol, rtol = 1e-2, 1e-2
+        elif dtype == torch.bfloat16:
+            atol, rtol = 5e-2, 5e-2
+        else:
+            atol, rtol = 1e-5, 1.3e-6
+        M, D = 7, 30  # D not a multiple of 8, so the last mask byte is padded
+        mask_bytes = (D + 7) // 8
+        params = [torch.randn(M, D, device=device, dtype=dtype, requires_grad=True),
+                  torch.randn(M, D, device=device, dtype=dtype, requires_grad=True),
+                  torch.randn(D, device=device, dtype=dtype, requires_grad=True),
+                  torch.randn(D, device=device, dtype=dtype, requires_grad=True)]
+
+        for p, train in ((0.5, False), (0.0, True), (0.3, True)):
+            for t in params:
+                t.grad = None
+            ref_params = [t.detach().clone().requires_grad_() for t in params]
+            ref_input, ref_residual, ref_gamma, ref_beta = ref_params
+
+            out, mask, mean, rstd = torch._fused_dropout_add_layer_norm(*params, p, train)
+
+            if train and p > 0:
+                # One bit per element, rows padded to whole bytes, LSB first.
+                self.assertEqual(mask.shape, torch.Size([M, mask_bytes]))
+                self.assertEqual(mask.dtype, torch.uint8)
+                shifts = torch.arange(8, device=device, dtype=torch.uint8)
+                keep = (mask.unsqueeze(-1) >> shifts).bitwise_and(1)
+                keep = keep.flatten(-2)[:, :D].to(dtype)
+                pre = ref_input * keep / (1 - p) + ref_residual
+            else:
+                # In eval mode (or p=0) no mask is kept at all.
+                self.assertEqual(mask.numel(), 0)
+                pre = ref_input + ref_residual
+            ref, mean_ref, rstd_ref = torch.native_layer_norm(
+                pre, (D,), ref_gamma, ref_beta, 1e-5)
+
+            self.assertEqual(out, ref, atol=atol, rtol=rtol)
+            # Stats must match native_layer_norm's, dtype included: the
+            # backward feeds them straight into native_layer_norm_backward.
+            self.assertEqual(mean.dtype, mean_ref.dtype)
+            self.assertEqual(mean, mean_ref, atol=atol, rtol=rtol)
+            self.assertEqual(rstd, rstd_ref, atol=atol, rtol=rtol)
+
+            grad_out = torch.randn_like(out)
+            out.backward(grad_out)
+            ref.backward(grad_out)
+            for actual, expected in zip(params, ref_params):
+                self.assertEqual(actual.grad, expected.grad, atol=atol, rtol=rtol)
+
 instantiate_device_type_tests(TestDropoutNNDeviceType, globals())
 instantiate_parametrized_tests(TestDropoutNN)
 
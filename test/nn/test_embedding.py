@@ -1256,6 +1256,42 @@ class TestEmbeddingNNDeviceType(NNTestCase):
     def test_embedding_bag_half(self, device, dtypes):
         self._test_EmbeddingBag(device, 'sum', True, wdtype=torch.float16, dtype=dtypes[0], odtype=dtypes[1], test_backward=True)
 
+    @onlyNativeDeviceTypes
+    @dtypes(torch.float32, torch.float64)
+    @dtypesIfCUDA(torch.float32, torch.float16, torch.bfloat16)
+    def test_fused_embedding_layer_norm(self, device, dtype):
+        if dtype == torch.float16:
+            atol, rtol = 1e-2, 1e-2
+        elif dtype == torch.bfloat16:
+            atol, rtol = 5e-2, 5e-2
+        else:
+            atol, rtol = 1e-5, 1.3e-6
+        num_embeddings, batch, seq_len, dim = 17, 3, 5, 32
+        weight = torch.randn(num_embeddings, dim, device=device, dtype=dtype, requires_grad=True)
+        pos_weight = torch.randn(seq_len, dim, device=device, dtype=dtype, requires_grad=True)
+        gamma = torch.randn(dim, device=device, dtype=dtype, requires_grad=True)
+        beta = torch.randn(dim, device=device, dtype=dtype, requires_grad=True)
+        indices = torch.randint(num_embeddings, (batch, seq_len), device=device)
+        ref_params = [t.detach().clone().requires_grad_() for t in (weight, pos_weight, gamma, beta)]
+        ref_weight, ref_pos_weight, ref_gamma, ref_beta = ref_params
+
+        out, mean, rstd = torch._fused_embedding_layer_norm(weight, pos_weight, indices, gamma, beta)
+        x_ref = F.embedding(indices, ref_weight) + ref_pos_weight
+        ref, mean_ref, rstd_ref = torch.native_layer_norm(x_ref, (dim,), ref_gamma, ref_beta, 1e-5)
+
+        self.assertEqual(out, ref, atol=atol, rtol=rtol)
+        # Stats must match native_layer_norm's, dtype included: the backward
+        # feeds them straight into native_layer_norm_backward.
+        self.assertEqual(mean.dtype, mean_ref.dtype)
+        self.assertEqual(mean, mean_ref, atol=atol, rtol=rtol)
+        self.assertEqual(rstd, rstd_ref, atol=atol, rtol=rtol)
+
+        grad_out = torch.randn_like(ref)
+        out.backward(grad_out)
+        ref.backward(grad_out)
+        for actual, expected in zip((weight, pos_weight, gamma, beta), ref_params):
+            self.assertEqual(actual.grad, expected.grad, atol=atol, rtol=rtol)
+
 
 instantiate_device_type_tests(TestEmbeddingNNDeviceType, globals())
 instantiate_parametrized_tests(TestEmbeddingNN)
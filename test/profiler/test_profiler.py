@@ -1041,7 +1041,7 @@ class TestProfiler(TestCase):
             "TOP(C)::forward.A0(A)::forward.SELF(A)::forward_impl_.",
             "TOP(C)::forward.SELF(C)::call_b.B0(B)::forward.", "TOP(C)::forward."]
         with TemporaryFileName(mode="w+") as fname:
-            with profile(activities=[torch.profiler.ProfilerActivity.CPU], with_modules=True,) as prof:
+            with profile(activities=[ProfilerActivity.CPU], with_modules=True,) as prof:
                 model(input_a, input_b)
             prof.export_chrome_trace(fname)
             with open(fname) as f:
@@ -1441,6 +1441,33 @@ class TestProfiler(TestCase):
         if kineto_available():
             self._test_profiler_tracing(True)
 
+    def test_op_stats_aggregation(self):
+        torch._C._profiler._enable_op_stats_aggregation()
+        try:
+            with profile(activities=[ProfilerActivity.CPU]):
+                t1, t2 = torch.ones(16), torch.ones(16)
+                torch.add(t1, t2)
+
+            stats = torch._C._profiler._get_op_stats()
+            self.assertIn("aten::add", stats)
+            count, total_ns, self_ns, _ = stats["aten::add"]
+            self.assertEqual(count, 1)
+            self.assertGreater(total_ns, 0)
+            self.assertLessEqual(self_ns, total_ns)
+
+            # Stats accumulate across sessions.
+            with profile(activities=[ProfilerActivity.CPU]):
+                torch.add(t1, t2)
+            self.assertEqual(torch._C._profiler._get_op_stats()["aten::add"][0], 2)
+
+            with TemporaryFileName(mode="w+b") as fname:
+                torch._C._profiler._export_op_stats(fname)
+                with open(fname, "rb") as f:
+                    self.assertEqual(f.read(4), b"PTOP")
+        finally:
+            torch._C._profiler._disable_op_stats_aggregation()
+            torch._C._profiler._clear_op_stats()
+
     def test_profiler_op_event_args(self):
         torch._C._profiler._set_record_concrete_inputs_enabled_val(True)
         with _profile(record_shapes=True) as prof:
@@ -1569,6 +1596,31 @@ class TestProfiler(TestCase):
         finally:
             torch._C._profiler._set_cuda_sync_enabled_val(False)
 
+    def test_profiler_op_sampling(self):
+        x = torch.ones(2, 2)
+
+        def count_adds(rate: int) -> int:
+            with profile(
+                activities=[ProfilerActivity.CPU],
+                experimental_config=_ExperimentalConfig(op_sampling_rate=rate),
+            ) as prof:
+                for _ in range(100):
+                    torch.add(x, x)
+            return sum(1 for e in prof.events() if e.name == "aten::add")
+
+        # The default rate of 1 records every op.
+        self.assertEqual(count_adds(1), 100)
+
+        # With a rate of 10 only a (deterministic, per-thread) subset of the
+        # ops is recorded. Other record functions interleave with the adds,
+        # so only bound the count rather than pin it to exactly 10.
+        sampled = count_adds(10)
+        self.assertGreater(sampled, 0)
+        self.assertLessEqual(sampled, 50)
+
+        with self.assertRaisesRegex(RuntimeError, "op_sampling_rate"):
+            _ExperimentalConfig(op_sampling_rate=0)
+
     def test_profiler_type(self):
         profiler_type = torch._C._autograd._profiler_type
         ActiveProfilerType = torch._C._profiler.ActiveProfilerType
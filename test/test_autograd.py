@@ -10686,6 +10686,22 @@ class TestAutogradInferenceMode(TestCase):
             self.assertFalse(tmp.requires_grad)
             self.assertTrue(torch.is_inference(tmp))
 
+    def test_inference_mode_fast_path_count(self):
+        # tensor creation outside InferenceMode doesn't hit the fast path
+        before = torch._C._autograd._inference_tensor_fast_path_count()
+        torch.ones(1, 2, 3)
+        self.assertEqual(
+            torch._C._autograd._inference_tensor_fast_path_count(), before
+        )
+
+        # inference tensors are constructed without a version counter and
+        # bump the fast path counter
+        with torch.inference_mode():
+            torch.ones(1, 2, 3)
+        self.assertGreater(
+            torch._C._autograd._inference_tensor_fast_path_count(), before
+        )
+
     def test_inference_mode_existing_autograd_session(self):
         s = torch.ones(1, 2, 3, requires_grad=True)
         a = s.clone()
@@ -1238,6 +1238,39 @@ except RuntimeError as e:
             self.assertTrue(input.is_pinned())
             self.assertTrue(target.is_pinned())
 
+    @unittest.skipIf(not TEST_CUDA, "CUDA unavailable")
+    def test_pin_memory_batched(self):
+        from torch.utils.data._utils.pin_memory import _pin_memory_batched
+        batch = {'a': torch.randn(2, 3), 'b': [torch.randn(4), 'label'], 'c': 7}
+        pinned = _pin_memory_batched(batch)
+        self.assertTrue(pinned['a'].is_pinned())
+        self.assertTrue(pinned['b'][0].is_pinned())
+        self.assertEqual(pinned['a'], batch['a'])
+        self.assertEqual(pinned['b'][0], batch['b'][0])
+        self.assertEqual(pinned['b'][1], 'label')
+        self.assertEqual(pinned['c'], 7)
+
+    @unittest.skipIf(IS_WINDOWS, "flat batch transfer is POSIX-only")
+    def test_flat_batch_round_trip(self):
+        from torch.utils.data._utils import flat_batch
+        batch = {'x': [torch.randn(3, 4) for _ in range(20)],
+                 'y': torch.arange(20),
+                 'meta': 'labels'}
+        wrapped = flat_batch.maybe_flatten(batch)
+        self.assertIsInstance(wrapped, flat_batch._FlatTensorBatch)
+        rebuild_fn, rebuild_args = wrapped.__reduce__()
+        rebuilt = rebuild_fn(*rebuild_args)
+        self.assertEqual(rebuilt['x'], batch['x'])
+        self.assertEqual(rebuilt['y'], batch['y'])
+        self.assertEqual(rebuilt['meta'], 'labels')
+        # All rebuilt tensors view one shared-memory segment.
+        self.assertTrue(rebuilt['y'].is_shared())
+        self.assertEqual(rebuilt['x'][0].untyped_storage().data_ptr(),
+                         rebuilt['y'].untyped_storage().data_ptr())
+        # Too few tensors: the pickle path is kept.
+        small = {'x': torch.randn(2)}
+        self.assertIs(flat_batch.maybe_flatten(small), small)
+
     @unittest.skipIf(IS_JETSON, "Not working on Jetson")
     def test_multiple_dataloaders(self):
         for multiprocessing_context in supported_multiprocessing_contexts:
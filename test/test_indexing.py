@@ -14,7 +14,7 @@ from torch.testing import make_tensor
 from torch.testing._internal.common_utils import (
     TestCase, run_tests, skipIfTorchDynamo, DeterministicGuard)
 from torch.testing._internal.common_device_type import (
-    instantiate_device_type_tests, onlyCUDA, dtypes, dtypesIfCPU, dtypesIfCUDA,
+    instantiate_device_type_tests, onlyCPU, onlyCUDA, dtypes, dtypesIfCPU, dtypesIfCUDA,
     onlyNativeDeviceTypes, skipXLA)
 
 
@@ -650,6 +650,24 @@ class TestIndexing(TestCase):
         self.assertEqual(reference[[0, 123, 44488, 68807, 123343], ],
                          torch.tensor([0, 123, 44488, 68807, 123343], dtype=torch.int))
 
+    @onlyCPU
+    def test_index_select_cat(self, device):
+        tables = [torch.randn(10, 4, device=device), torch.randn(7, 6, device=device)]
+        indices = [torch.randint(10, (5,), device=device),
+                   torch.randint(7, (5,), device=device)]
+        fused = torch._index_select_cat(tables, indices)
+        reference = torch.cat(
+            [t.index_select(0, i) for t, i in zip(tables, indices)], dim=1)
+        self.assertEqual(fused, reference)
+
+        # int32 indices take the same path
+        fused32 = torch._index_select_cat(tables, [i.int() for i in indices])
+        self.assertEqual(fused32, reference)
+
+        with self.assertRaisesRegex(RuntimeError, "out of range"):
+            torch._index_select_cat(
+                [tables[0]], [torch.tensor([10], device=device)])
+
     def test_set_item_to_scalar_tensor(self, device):
         m = random.randint(1, 10)
         n = random.randint(1, 10)
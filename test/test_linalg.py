@@ -5827,14 +5827,16 @@ scipy_lobpcg  | {eq_err_scipy:10.2e}  | {eq_err_general_scipy:10.2e}  | {iters2:
 
     @unittest.skipIf(IS_WINDOWS, "Skipped on Windows!")
     @unittest.skipIf(IS_FBCODE and IS_REMOTE_GPU, "cublas runtime error")
-    @unittest.skipIf(not SM80OrLater, "need sm_80")
-    @onlyCUDA
+    @onlyNativeDeviceTypes
     @parametrize("m", [32, 64])
     @parametrize("k", [32, 64])
     @parametrize("n", [48, 64])
     def test__int4_mm(self, device, m, k, n):
-        if TEST_WITH_ROCM:
-            self.skipTest("_int4_mm not compiled for ROCM")
+        if self.device_type == 'cuda':
+            if TEST_WITH_ROCM:
+                self.skipTest("_int4_mm not compiled for ROCM")
+            if not SM80OrLater:
+                self.skipTest("requires SM80 or later")
 
         q_group = 32
         inner_k_tiles = 2
@@ -5902,6 +5904,31 @@ scipy_lobpcg  | {eq_err_scipy:10.2e}  | {eq_err_general_scipy:10.2e}  | {iters2:
         mean_err = ((res - ref).abs() / ref).mean()
         self.assertTrue(mean_err < 0.05)
 
+    @unittest.skipIf(IS_WINDOWS, "Skipped on Windows!")
+    @onlyCPU
+    @parametrize("m", [32, 64])
+    @parametrize("k", [32, 64])
+    @parametrize("n", [48, 64])
+    @parametrize("dtype", [torch.float32, torch.bfloat16, torch.half])
+    def test__int8_mm(self, device, m, k, n, dtype):
+        torch.manual_seed(1)
+        a = torch.rand((m, k), dtype=dtype, device=device)
+        b = torch.rand((n, k), dtype=dtype, device=device)
+
+        def convert_weight_to_int8pack(b):
+            # Symmetric per-channel quantization: B is [N, K], one scale per
+            # output channel.
+            scales = b.abs().amax(dim=-1, keepdim=True) / 127
+            b_int8 = torch.round(b / scales).to(torch.int8)
+            return b_int8, scales.squeeze(-1)
+
+        b_int8pack, b_scales = convert_weight_to_int8pack(b)
+        res = torch._weight_int8pack_mm(a, b_int8pack, b_scales)
+        ref = torch.mm(a, (b_int8pack.to(dtype) * b_scales.unsqueeze(-1)).t())
+
+        mean_err = ((res - ref).abs() / ref).mean()
+        self.assertTrue(mean_err < 0.05)
+
     @slowTest
     @onlyNativeDeviceTypes
     # bfloat16 doesn't have sufficient precision to pass this test
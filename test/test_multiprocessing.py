@@ -937,6 +937,40 @@ if __name__ == "__main__":
         t = torch.randn(5, 5).cuda()
         self.assertTrue(t.is_shared())
 
+    def test_shared_tensor_slot(self):
+        template = torch.randn(4, 3)
+        slot = mp.SharedTensorSlot(template)
+        self.assertEqual(slot.version, 0)
+
+        snapshot, version = slot.read()
+        self.assertEqual(snapshot, template)
+        self.assertEqual(version, 0)
+
+        update = torch.randn(4, 3)
+        self.assertEqual(slot.write(update), 1)
+        snapshot, version = slot.read()
+        self.assertEqual(snapshot, update)
+        self.assertEqual(version, 1)
+        self.assertEqual(slot.version, 1)
+
+        # A non-contiguous source is copied before publishing.
+        update_t = torch.randn(3, 4).t()
+        self.assertEqual(slot.write(update_t), 2)
+        snapshot, _ = slot.read()
+        self.assertEqual(snapshot, update_t)
+
+        # Reading into a caller-provided buffer.
+        out = torch.empty(4, 3)
+        result, version = slot.read(out=out)
+        self.assertIs(result, out)
+        self.assertEqual(out, update_t)
+        self.assertEqual(version, 2)
+
+        with self.assertRaisesRegex(ValueError, "shape"):
+            slot.write(torch.randn(3, 4))
+        with self.assertRaisesRegex(ValueError, "shape"):
+            slot.read(out=torch.empty(3, 4))
+
 
 if __name__ == '__main__':
     run_tests()
@@ -10011,6 +10011,51 @@ class TestNNDeviceType(NNTestCase):
         del x
         self.assertTrue(torch.allclose(out, out_ref))
 
+    @onlyCPU
+    def test_fused_image_preprocess(self, device):
+        torch.manual_seed(0)
+        mean = torch.tensor([123.675, 116.28, 103.53])
+        std = torch.tensor([58.395, 57.12, 57.375])
+        images = [
+            torch.randint(0, 256, (40, 48, 3), dtype=torch.uint8, device=device),
+            torch.randint(0, 256, (64, 40, 3), dtype=torch.uint8, device=device),
+        ]
+
+        def reference(images, top, left, crop_h, crop_w, out_h, out_w):
+            outs = []
+            for img in images:
+                crop = img[top:top + crop_h, left:left + crop_w]
+                chw = crop.permute(2, 0, 1).unsqueeze(0)
+                if (crop_h, crop_w) != (out_h, out_w):
+                    # The op resizes in uint8 (the PIL-compatible path), so
+                    # the reference must too.
+                    chw = F.interpolate(chw, size=(out_h, out_w), mode="bilinear",
+                                        align_corners=False)
+                outs.append(chw.float())
+            out = torch.cat(outs)
+            return (out - mean.reshape(1, 3, 1, 1)) / std.reshape(1, 3, 1, 1)
+
+        # Crop boxes covering the interior, the corners, a single-pixel crop
+        # and the full extent of the smallest image (no resize in one case).
+        for top, left, crop_h, crop_w, out_h, out_w in (
+            (4, 6, 32, 32, 16, 16),
+            (0, 0, 24, 24, 31, 17),
+            (39, 39, 1, 1, 8, 8),
+            (0, 0, 40, 40, 40, 40),
+        ):
+            out = torch._fused_image_preprocess(
+                images, top, left, crop_h, crop_w, out_h, out_w, mean, std)
+            self.assertEqual(out.dtype, torch.float32)
+            self.assertTrue(out.is_contiguous(memory_format=torch.channels_last))
+            self.assertEqual(
+                out, reference(images, top, left, crop_h, crop_w, out_h, out_w))
+
+        # Out-of-bounds crop boxes are rejected per image.
+        with self.assertRaisesRegex(RuntimeError, "out of bounds"):
+            torch._fused_image_preprocess(images, 0, 0, 48, 48, 16, 16, mean, std)
+        with self.assertRaisesRegex(RuntimeError, "out of bounds"):
+            torch._fused_image_preprocess(images, -1, 0, 8, 8, 16, 16, mean, std)
+
     def _slow_masked_softmax(self, input, mask):
         exp = torch.exp(input)
         exp = exp * mask
@@ -11913,6 +11958,45 @@ class TestNNDeviceType(NNTestCase):
         if reduction != "none":
             self.assertTrue(torch.allclose(logits.grad.cpu(), logits_cpu.grad, rtol=rtol, atol=atol))
 
+    @parametrize_test("reduction", ("mean", "sum"))
+    @parametrize_test("ignore_index", (-100, 2))
+    @parametrize_test("has_bias", (False, True))
+    def test_fused_linear_cross_entropy(self, device, reduction, ignore_index, has_bias):
+        N, D, V = 11, 16, 37
+        reduction_enum = {"mean": 1, "sum": 2}[reduction]
+        input = torch.randn(N, D, device=device, dtype=torch.float64)
+        weight = torch.randn(V, D, device=device, dtype=torch.float64)
+        bias = torch.randn(V, device=device, dtype=torch.float64) if has_bias else None
+        target = torch.randint(0, V, (N,), device=device)
+        target[0] = ignore_index
+        target[5] = ignore_index
+
+        # Chunk sizes around the tiling boundaries: exactly one chunk,
+        # a ragged final chunk, and a chunk larger than the vocab.
+        for chunk_size in (V, 10, 64):
+            inp = input.clone().requires_grad_()
+            w = weight.clone().requires_grad_()
+            b = bias.clone().requires_grad_() if has_bias else None
+            loss, lse = torch._fused_linear_cross_entropy(
+                inp, w, b, target, reduction_enum, ignore_index, chunk_size)
+
+            ref_inp = input.clone().requires_grad_()
+            ref_w = weight.clone().requires_grad_()
+            ref_b = bias.clone().requires_grad_() if has_bias else None
+            logits = F.linear(ref_inp, ref_w, ref_b)
+            ref_loss = F.cross_entropy(
+                logits, target, reduction=reduction, ignore_index=ignore_index)
+
+            self.assertEqual(loss, ref_loss)
+            self.assertEqual(lse, logits.logsumexp(1))
+
+            loss.backward()
+            ref_loss.backward()
+            self.assertEqual(inp.grad, ref_inp.grad)
+            self.assertEqual(w.grad, ref_w.grad)
+            if has_bias:
+                self.assertEqual(b.grad, ref_b.grad)
+
     def test_smoothl1loss_backward_zero_beta(self, device):
         input = torch.randn(300, 256, requires_grad=True, device=device)
         target = input.detach()
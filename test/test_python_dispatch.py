@@ -738,6 +738,34 @@ $1: f32[] = torch._ops.my_lib.weird.default(['None', '$0'])''')
                 torch.split(torch.tensor([0, 1]), 2)
             )
 
+    def test_declared_dispatch_ops_skip_python(self) -> None:
+        # Subclasses can advertise the ops they intercept via
+        # __torch_dispatch_ops__; other ops redispatch in C++ without
+        # entering __torch_dispatch__.
+        calls = []
+
+        class A(torch._C.TensorBase):
+            __torch_dispatch_ops__ = [torch.ops.aten.neg.default, "aten::abs"]
+
+            @staticmethod
+            def __new__(cls, elem):
+                return torch.Tensor._make_subclass(cls, elem, elem.requires_grad)
+
+            @classmethod
+            def __torch_dispatch__(cls, func, types, args=(), kwargs=None):
+                calls.append(func)
+                with no_dispatch():
+                    return func(*args, **(kwargs or {}))
+
+        a = A(torch.tensor([-1.0, 2.0]))
+        # Declared ops go through Python (and populate the override cache)
+        self.assertEqual(a.neg(), torch.tensor([1.0, -2.0]))
+        self.assertEqual(a.abs(), torch.tensor([1.0, 2.0]))
+        self.assertEqual(calls, [torch.ops.aten.neg.default, torch.ops.aten.abs.default])
+        # Undeclared ops skip __torch_dispatch__ entirely
+        self.assertEqual(a.mul(3), torch.tensor([-3.0, 6.0]))
+        self.assertEqual(len(calls), 2)
+
     def test_invalid_ret(self) -> None:
         # test invalid return gets reasonable error message
         class A(torch._C.TensorBase):
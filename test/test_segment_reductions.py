@@ -552,6 +552,56 @@ class TestSegmentReductions(TestCase):
                     check_backward,
                 )
 
+    @dtypes(*product((torch.float, torch.double), (torch.int64,)))
+    def test_large_input(self, device, dtypes):
+        val_dtype, length_type = dtypes
+        # Large inputs take the parallel CPU path, which splits long segments
+        # into chunks and combines the partial results; check every reduction
+        # against a straightforward per-segment reference.
+        torch.manual_seed(0)
+        inner = 32
+        lengths_list = [4096, 0, 1024, 0] + [64] * 48
+        data = (
+            torch.rand(sum(lengths_list), inner, device=device, dtype=val_dtype)
+            + 0.5
+        )
+        lengths = torch.tensor(lengths_list, device=device, dtype=length_type)
+        offsets = torch.cat(
+            [torch.zeros(1, device=device, dtype=length_type), lengths.cumsum(0)]
+        )
+        for reduction in reductions:
+            actual = torch._segment_reduce(
+                data, reduction, lengths=lengths, axis=0, unsafe=False
+            )
+            expected_rows = []
+            start = 0
+            for length in lengths_list:
+                seg = data[start:start + length]
+                start += length
+                if length == 0:
+                    default = get_default_value(None, reduction)
+                    expected_rows.append(
+                        torch.full((inner,), default, device=device, dtype=val_dtype)
+                    )
+                elif reduction == "max":
+                    expected_rows.append(seg.amax(0))
+                elif reduction == "mean":
+                    expected_rows.append(seg.mean(0))
+                elif reduction == "min":
+                    expected_rows.append(seg.amin(0))
+                elif reduction == "sum":
+                    expected_rows.append(seg.sum(0))
+                elif reduction == "prod":
+                    expected_rows.append(seg.prod(0))
+            expected_result = torch.stack(expected_rows)
+            self.assertEqual(actual, expected_result, rtol=1e-4, atol=1e-5)
+
+            # offsets and lengths must agree on the same segments
+            actual_offsets = torch._segment_reduce(
+                data, reduction, offsets=offsets, axis=0, unsafe=False
+            )
+            self.assertEqual(actual, actual_offsets)
+
     @dtypes(torch.int, torch.int64)
     def test_unsafe_flag(self, device, dtype):
         length_type = dtype
@@ -443,6 +443,42 @@ class TestSparse(TestSparseBase):
         ref = test_sparse_sum()
         self.assertTrue(ref.expired())
 
+    @dtypes(torch.double)
+    @skipIfTorchDynamo("tensor identity of cached results is not preserved")
+    def test_coalesce_cache(self, device, dtype):
+        # Repeated coalesce() calls on an unchanged tensor reuse a memoized
+        # result instead of re-sorting the indices, see
+        # NOTE [ Coalesce cache ] in ATen/SparseTensorImpl.h
+        i = torch.tensor([[1, 0, 1], [0, 0, 0]], dtype=torch.long, device=device)
+        v = torch.tensor([1., 2., 3.], dtype=dtype, device=device)
+        x = torch.sparse_coo_tensor(i, v, (2, 1))
+
+        y1 = x.coalesce()
+        y2 = x.coalesce()
+        self.assertEqual(y1._values().data_ptr(), y2._values().data_ptr())
+
+        # in-place mutation of the values invalidates the cache
+        x._values().mul_(2)
+        y3 = x.coalesce()
+        self.assertNotEqual(y1._values().data_ptr(), y3._values().data_ptr())
+        self.assertEqual(y3.to_dense(), x.to_dense())
+
+        # in-place mutation of a handed-out result must not poison the cache:
+        # later coalesce() calls on the unchanged source return the original
+        # values, not the mutated ones
+        y4 = x.coalesce()
+        y4._values().mul_(2)
+        y5 = x.coalesce()
+        self.assertNotEqual(y4._values().data_ptr(), y5._values().data_ptr())
+        self.assertEqual(y5.to_dense(), x.to_dense())
+
+        # results attached to the autograd graph are neither cached nor reused
+        xg = x.clone().requires_grad_(True)
+        z1 = xg.coalesce()
+        z2 = xg.coalesce()
+        self.assertIsNotNone(z1.grad_fn)
+        self.assertNotEqual(z1._values().data_ptr(), z2._values().data_ptr())
+
     @dtypes(torch.double)
     def test_ctor_large_sizes(self, device, dtype):
         # Test that integer overflow is detected when computing numel
@@ -3155,6 +3155,48 @@ else:
             out2 = out1.to(torch.float)
             self.assertEqual(out2, out1, atol=0, rtol=0, exact_dtype=False)
 
+    @onlyNativeDeviceTypes
+    def test_copy_stochastic(self, device):
+        # 1 + 2**-9 sits exactly halfway between the bf16 neighbours 1.0 and
+        # 1 + 2**-8, so stochastic rounding must pick each side about half the
+        # time and stay unbiased in the mean.
+        value = 1.0 + 2 ** -9
+        src = torch.full((100000,), value, dtype=torch.float, device=device)
+        dst = torch.empty_like(src, dtype=torch.bfloat16)
+        torch._copy_stochastic_(dst, src)
+        lo, hi = torch.tensor([1.0, 1.0 + 2 ** -8], dtype=torch.bfloat16, device=device)
+        self.assertTrue(((dst == lo) | (dst == hi)).all())
+        self.assertEqual(dst.float().mean().item(), value, atol=1e-4, rtol=0)
+
+        # Values exactly representable in bf16, and non-finite values, must
+        # come through unchanged.
+        exact = torch.tensor([0.0, -1.0, 2.0, float('inf'), -float('inf'), float('nan')],
+                             dtype=torch.float, device=device)
+        out = torch.empty_like(exact, dtype=torch.bfloat16)
+        torch._copy_stochastic_(out, exact)
+        self.assertEqual(out, exact.bfloat16(), atol=0, rtol=0)
+
+        # A seeded generator makes the rounding reproducible.
+        gen = torch.Generator(device=device).manual_seed(42)
+        a = torch.empty_like(src, dtype=torch.bfloat16)
+        torch._copy_stochastic_(a, src, generator=gen)
+        gen.manual_seed(42)
+        b = torch.empty_like(src, dtype=torch.bfloat16)
+        torch._copy_stochastic_(b, src, generator=gen)
+        self.assertEqual(a, b, atol=0, rtol=0)
+
+        # Non-contiguous destinations are supported; dtype and shape
+        # mismatches are not.
+        dst_t = torch.empty((64, 64), dtype=torch.bfloat16, device=device).t()
+        torch._copy_stochastic_(dst_t, torch.ones(64, 64, device=device))
+        self.assertEqual(dst_t, torch.ones(64, 64, dtype=torch.bfloat16, device=device))
+        with self.assertRaisesRegex(RuntimeError, "BFloat16 destination"):
+            torch._copy_stochastic_(torch.empty_like(src), src)
+        with self.assertRaisesRegex(RuntimeError, "Float source"):
+            torch._copy_stochastic_(dst, src.double())
+        with self.assertRaisesRegex(RuntimeError, "matching sizes"):
+            torch._copy_stochastic_(dst, src[:-1])
+
     # FIXME: move to data movement test suite
     @onlyNativeDeviceTypes
     def test_copy_math_view(self, device):
@@ -5491,6 +5533,52 @@ else:
                         check_equal(torch.tensor(True), y, x)
 
 
+    @onlyNativeDeviceTypes
+    def test_tensor_fingerprint(self, device):
+        # The fingerprint is defined over the little-endian byte image (see
+        # Note [Tensor fingerprint]), so the digests below are fixed across
+        # builds, devices and parallelism degrees; they were computed with a
+        # scalar reimplementation of the mixing scheme.
+        def as_int64(u):
+            return u - 2**64 if u >= 2**63 else u
+
+        known = [
+            (torch.arange(16, dtype=torch.int64, device=device),
+             as_int64(0x79bfc3e2f11faea2)),
+            # 13 bytes: exercises the zero-padded tail word.
+            (torch.arange(13, dtype=torch.uint8, device=device),
+             as_int64(0xe932ebb732af73cb)),
+            (torch.tensor([1.0, -2.5, 0.0, math.pi],
+                          dtype=torch.float32, device=device),
+             as_int64(0xbc2642ca35263698)),
+            (torch.empty(0, dtype=torch.float32, device=device), 0),
+        ]
+        for t, expected in known:
+            fp = torch._tensor_fingerprint(t)
+            self.assertEqual(fp.dim(), 0)
+            self.assertEqual(fp.dtype, torch.int64)
+            self.assertEqual(fp.device, t.device)
+            self.assertEqual(fp.item(), expected)
+
+        # Strided views hash through their contiguous image.
+        base = torch.arange(64, dtype=torch.int64, device=device)
+        view = base[::2]
+        self.assertEqual(torch._tensor_fingerprint(view),
+                         torch._tensor_fingerprint(view.contiguous()))
+
+        # A single flipped byte changes the digest.
+        a = torch.arange(256, dtype=torch.uint8, device=device)
+        b = a.clone()
+        b[100] ^= 1
+        self.assertNotEqual(torch._tensor_fingerprint(a).item(),
+                            torch._tensor_fingerprint(b).item())
+
+        # CPU and CUDA agree on equal bytes.
+        if self.device_type == 'cuda':
+            t = torch.randn(1000, 3, device=device)
+            self.assertEqual(torch._tensor_fingerprint(t).cpu(),
+                             torch._tensor_fingerprint(t.cpu()))
+
     @skipIfTorchInductor("FIXME")
     def test_hook_remove(self, device):
         # Reference: https://github.com/pytorch/pytorch/issues/58354
@@ -1663,12 +1663,11 @@ class TestSDPA(NNTestCase):
     @parametrize("dropout", [0.0, 0.7])
     @parametrize("dtype", [torch.float64, torch.float32, torch.bfloat16, torch.half])
     def test_fused_sdp_choice_cpu(self, device, type: str, dropout: float, dtype: torch.dtype):
-        # Test that cpu and nestedtensor cpu return MATH backend
+        # Test that cpu and nestedtensor cpu return FLASH_ATTENTION when supported
         make_tensor = partial(rand_sdpa_tensor, type=type, device=device, dtype=dtype)
         size = SdpaShape(2, 8, 128, 64)
         q, k, v = make_tensor(size), make_tensor(size), make_tensor(size)
-        if type == "nested" \
-                or dropout > 0.0 \
+        if dropout > 0.0 \
                 or dtype not in [torch.float32, torch.float64, torch.bfloat16]:
             assert torch._fused_sdp_choice(q, k, v, dropout_p=dropout) == SDPBackend.MATH.value
         else:
@@ -1751,6 +1750,155 @@ class TestSDPA(NNTestCase):
             self.assertEqual(grad_k_actual, grad_k_ref, atol=atol, rtol=rtol)
             self.assertEqual(grad_v_actual, grad_v_ref, atol=atol, rtol=rtol)
 
+    @onlyCPU
+    @parametrize("fused_kernel", [SDPBackend.FLASH_ATTENTION])
+    @parametrize("dtype", [torch.float64, torch.float32, torch.bfloat16])
+    @parametrize("n_head", [1, 3])
+    @parametrize("head_dim", [8, 16])
+    @parametrize("causal", [True, False])
+    def test_scaled_dot_product_fused_attention_vs_math_nested_cpu(
+        self,
+        device,
+        fused_kernel,
+        dtype,
+        n_head,
+        head_dim,
+        causal,
+    ):
+        atol = 1e-5
+        rtol = 5e-6
+        if dtype is torch.bfloat16:
+            atol = 2e-2
+            rtol = 2e-2
+
+        batch_size = 4
+        seq_lens = [67, 260, 15, 1030]
+        make_tensor = partial(rand_sdpa_tensor, type="nested", device=device, dtype=dtype)
+        shape = SdpaShape(batch_size, n_head, seq_lens, head_dim)
+
+        # (B, nh, T*, hs)
+        q = make_tensor(shape).transpose(1, 2)
+        k = make_tensor(shape).transpose(1, 2)
+        v = make_tensor(shape).transpose(1, 2)
+
+        with sdp_kernel(**backend_map[fused_kernel]):
+            actual = torch.nn.functional.scaled_dot_product_attention(
+                q, k, v, attn_mask=None, dropout_p=0.0, is_causal=causal)
+
+        # Compare against the math kernel applied to each sequence separately
+        with sdp_kernel(enable_flash=False, enable_math=True, enable_mem_efficient=False):
+            for actual_s, q_s, k_s, v_s in zip(
+                    actual.unbind(), q.unbind(), k.unbind(), v.unbind()):
+                math_ref = torch.nn.functional.scaled_dot_product_attention(
+                    q_s, k_s, v_s, attn_mask=None, dropout_p=0.0, is_causal=causal)
+                self.assertEqual(actual_s, math_ref, atol=atol, rtol=rtol)
+
+    @onlyCPU
+    @parametrize("dtype", [torch.float64, torch.float32])
+    @parametrize("n_head", [1, 3])
+    @parametrize("head_dim", [8, 16])
+    @parametrize("causal", [True, False])
+    def test_scaled_dot_product_attention_varlen_vs_math_cpu(
+        self,
+        device,
+        dtype,
+        n_head,
+        head_dim,
+        causal,
+    ):
+        q_lens = [5, 1, 12, 7]
+        k_lens = [9, 6, 12, 7]
+        q_offsets = [0]
+        k_offsets = [0]
+        for q_len, k_len in zip(q_lens, k_lens):
+            q_offsets.append(q_offsets[-1] + q_len)
+            k_offsets.append(k_offsets[-1] + k_len)
+        q = torch.randn(sum(q_lens), n_head, head_dim, device=device, dtype=dtype)
+        k = torch.randn(sum(k_lens), n_head, head_dim, device=device, dtype=dtype)
+        v = torch.randn(sum(k_lens), n_head, head_dim, device=device, dtype=dtype)
+        cum_seq_q = torch.tensor(q_offsets, device=device, dtype=torch.int32)
+        cum_seq_k = torch.tensor(k_offsets, device=device, dtype=torch.int32)
+
+        actual = torch._scaled_dot_product_attention_varlen(
+            q, k, v, cum_seq_q, cum_seq_k, max(q_lens), max(k_lens), is_causal=causal)
+        self.assertEqual(actual.shape, q.shape)
+
+        # Compare against per-sequence SDPA over slices of the packed buffers.
+        # is_causal must match the bottom-right aligned convention of the
+        # flash varlen kernels: the last query row attends to the full
+        # sequence even when q_len != k_len.
+        for b, (q_len, k_len) in enumerate(zip(q_lens, k_lens)):
+            q_s = q.narrow(0, q_offsets[b], q_len).transpose(0, 1)
+            k_s = k.narrow(0, k_offsets[b], k_len).transpose(0, 1)
+            v_s = v.narrow(0, k_offsets[b], k_len).transpose(0, 1)
+            attn_mask = None
+            if causal:
+                attn_mask = torch.ones(
+                    q_len, k_len, device=device, dtype=torch.bool).tril(k_len - q_len)
+            with sdp_kernel(enable_flash=False, enable_math=True, enable_mem_efficient=False):
+                math_ref = torch.nn.functional.scaled_dot_product_attention(
+                    q_s, k_s, v_s, attn_mask=attn_mask, dropout_p=0.0, is_causal=False)
+            self.assertEqual(
+                actual.narrow(0, q_offsets[b], q_len),
+                math_ref.transpose(0, 1))
+
+    @onlyCPU
+    @parametrize("dtype", [torch.float64, torch.float32])
+    def test_scaled_dot_product_attention_with_kv_cache(self, device, dtype):
+        batch, n_head, head_dim, max_len = 2, 3, 8, 16
+        make_tensor = partial(torch.randn, device=device, dtype=dtype)
+        key_cache = torch.full((batch, n_head, max_len, head_dim), -1.,
+                               device=device, dtype=dtype)
+        value_cache = torch.full_like(key_cache, -1.)
+
+        # Incremental decoding: a prompt chunk followed by single-token steps.
+        keys, values = [], []
+        cache_len = 0
+        for new_len in (4, 1, 1, 2):
+            q = make_tensor(batch, n_head, new_len, head_dim)
+            k = make_tensor(batch, n_head, new_len, head_dim)
+            v = make_tensor(batch, n_head, new_len, head_dim)
+            out = torch._scaled_dot_product_attention_with_kv_cache(
+                q, k, v, key_cache, value_cache, cache_len)
+            keys.append(k)
+            values.append(v)
+            cache_len += new_len
+
+            # The new tokens were appended in place; the tail is untouched.
+            k_all = torch.cat(keys, dim=2)
+            v_all = torch.cat(values, dim=2)
+            self.assertEqual(key_cache.narrow(2, 0, cache_len), k_all)
+            self.assertEqual(value_cache.narrow(2, 0, cache_len), v_all)
+            tail = max_len - cache_len
+            self.assertEqual(key_cache.narrow(2, cache_len, tail),
+                             torch.full((batch, n_head, tail, head_dim), -1.,
+                                        device=device, dtype=dtype))
+
+            # Equivalent to cat-then-SDPA over everything seen so far.
+            ref = F.scaled_dot_product_attention(q, k_all, v_all)
+            self.assertEqual(out, ref)
+
+        with self.assertRaisesRegex(RuntimeError, "cache overflow"):
+            torch._scaled_dot_product_attention_with_kv_cache(
+                q, k, v, key_cache, value_cache, max_len)
+
+        # The op mutates its cache arguments (Tensor(a!) schema); under
+        # functionalization the append must still land in the caller's caches.
+        q = make_tensor(batch, n_head, 2, head_dim)
+        k = make_tensor(batch, n_head, 2, head_dim)
+        v = make_tensor(batch, n_head, 2, head_dim)
+        key_cache.fill_(-1.)
+        value_cache.fill_(-1.)
+
+        def fn(q, k, v, key_cache, value_cache):
+            return torch._scaled_dot_product_attention_with_kv_cache(
+                q, k, v, key_cache, value_cache, 0)
+
+        out = torch.func.functionalize(fn)(q, k, v, key_cache, value_cache)
+        self.assertEqual(key_cache.narrow(2, 0, 2), k)
+        self.assertEqual(value_cache.narrow(2, 0, 2), v)
+        self.assertEqual(out, F.scaled_dot_product_attention(q, k, v))
+
     @parametrize("kernel", [SDPBackend.MATH])
     def test_scaled_dot_product_attention_math_with_negative_scale(self, device, kernel: SDPBackend):
         # https://github.com/pytorch/pytorch/issues/105190.
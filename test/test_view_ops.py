@@ -1256,6 +1256,31 @@ class TestOldViewOps(TestCase):
             self.assertEqual(tensor.narrow(dim, start, target_size[dim]), split, atol=0, rtol=0)
             start = start + target_size[dim]
 
+    def test_cat_view(self, device):
+        tensor = torch.rand(7, 4, device=device)
+        for dim in range(2):
+            splits = tensor.split(3, dim)
+            result = torch._cat_view(splits, dim)
+            self.assertEqual(result, tensor, atol=0, rtol=0)
+            self.assertTrue(self.is_view_of(tensor, result))
+
+        # Writes through the view hit the original buffer.
+        result = torch._cat_view(tensor.chunk(2, 0), 0)
+        result.zero_()
+        self.assertEqual(tensor, torch.zeros_like(tensor), atol=0, rtol=0)
+
+        # Reordered or unrelated inputs are not viewable: strict mode throws,
+        # non-strict mode falls back to a copying cat.
+        a, b = tensor.split([3, 4], 0)
+        with self.assertRaisesRegex(RuntimeError, 'adjacent views'):
+            torch._cat_view([b, a], 0)
+        other = torch.rand(2, 4, device=device)
+        with self.assertRaisesRegex(RuntimeError, 'adjacent views'):
+            torch._cat_view([a, other], 0)
+        fallback = torch._cat_view([b, a], 0, strict=False)
+        self.assertEqual(fallback, torch.cat([b, a], 0))
+        self.assertFalse(fallback._is_view())
+
     @onlyCPU
     def test_chunk(self, device):
         tensor = torch.rand(4, 7)
@@ -6375,7 +6375,10 @@ mz_bool mz_zip_writer_add_mem_ex_v2(mz_zip_archive *pZip, const char *pArchive_n
 
     MZ_CLEAR_OBJ(local_dir_header);
 
-    if (!store_data_uncompressed || (level_and_flags & MZ_ZIP_FLAG_COMPRESSED_DATA))
+    /* MZ_ZIP_FLAG_COMPRESSED_DATA with level 0 means the payload is stored
+       as-is with a caller-supplied crc32; the entry must be marked stored or
+       extraction would try to inflate it. */
+    if (!store_data_uncompressed || ((level_and_flags & MZ_ZIP_FLAG_COMPRESSED_DATA) && (level != 0)))
     {
         method = MZ_DEFLATED;
     }
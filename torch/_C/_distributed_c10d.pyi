@@ -33,6 +33,8 @@ class GradBucket:
     def is_last(self) -> bool: ...
     def set_buffer(self, tensor: Tensor) -> None: ...
     def parameters(self) -> List[Tensor]: ...
+    def offsets(self) -> List[int]: ...
+    def lengths(self) -> List[int]: ...
 
 class Reducer:
     def __init__(
@@ -54,6 +56,7 @@ class Reducer:
     def _install_post_backward_futures(self, futures: List[Future]) -> None: ...
     def _rebuild_buckets(self) -> bool: ...
     def _get_zeros_like_grad_buckets(self) -> List[GradBucket]: ...
+    def _get_grad_buckets(self) -> List[GradBucket]: ...
     def _push_all_rebuilt_params(self) -> None: ...
     def _set_forward_pass_work_handle(
         self,
@@ -521,6 +524,7 @@ class ProcessGroupNCCL(ProcessGroup):
     ): ...
     def _group_start(self) -> None: ...
     def _group_end(self) -> None: ...
+    def _aggregate_collective_profile(self) -> str: ...
 
 class ProcessGroupUCC(ProcessGroup):
     def __init__(
@@ -59,6 +59,8 @@ class _ExperimentalConfig:
         verbose: bool = ...,
         performance_events: List[str] = ...,
         enable_cuda_sync_events: bool = ...,
+        op_sampling_rate: int = ...,
+        profile_gpu_kernel_metrics: bool = ...,
     ) -> None: ...
 
 class ProfilerConfig:
@@ -219,6 +221,14 @@ def _add_execution_trace_observer(output_file_path: str) -> bool: ...
 def _remove_execution_trace_observer() -> None: ...
 def _enable_execution_trace_observer() -> None: ...
 def _disable_execution_trace_observer() -> None: ...
+def _enable_op_stats_aggregation(
+    export_path: str = ...,
+    export_every_n_traces: int = ...,
+) -> None: ...
+def _disable_op_stats_aggregation() -> None: ...
+def _export_op_stats(path: str) -> None: ...
+def _clear_op_stats() -> None: ...
+def _get_op_stats() -> Dict[str, Tuple[int, int, int, int]]: ...
 def _set_record_concrete_inputs_enabled_val(val: bool) -> None: ...
 def _set_fwd_bwd_enabled_val(val: bool) -> None: ...
 def _set_cuda_sync_enabled_val(val: bool) -> None: ...
@@ -2,6 +2,8 @@ import torch
 
 __all__ = [
     "get_cpu_capability",
+    "get_fast_math_transcendentals",
+    "set_fast_math_transcendentals",
 ]
 
 
@@ -17,3 +19,16 @@ def get_cpu_capability() -> str:
     - "AVX512"
     """
     return torch._C._get_cpu_capability()
+
+
+def get_fast_math_transcendentals() -> bool:
+    r"""Return whether CPU kernels may use relaxed-accuracy transcendentals."""
+    return torch._C._get_cpu_allow_fast_math_transcendentals()
+
+
+def set_fast_math_transcendentals(enable: bool) -> None:
+    r"""Allow CPU kernels such as softmax and gelu to use polynomial
+    approximations of exp/tanh/erf that are accurate to a few ulp instead of
+    the default ~1 ulp routines. Off by default.
+    """
+    torch._C._set_cpu_allow_fast_math_transcendentals(enable)
@@ -54,3 +54,32 @@ class verbose:
     def __exit__(self, exc_type, exc_val, exc_tb):
         torch._C._verbose.mkl_set_verbose(VERBOSE_OFF)
         return False
+
+
+class MklFftPlanCache:
+    r"""
+    Represents the oneMKL DFTI plan cache for CPU FFTs.
+
+    The attributes ``size`` and ``max_size``, and method ``clear``, can fetch
+    and/or change properties of the C++ MKL FFT plan cache, analogous to
+    :attr:`torch.backends.cuda.cufft_plan_cache` (the CPU cache is
+    process-wide rather than per-device).
+    """
+
+    @property
+    def size(self):
+        return torch._mkl_fft_get_plan_cache_size()
+
+    @property
+    def max_size(self):
+        return torch._mkl_fft_get_plan_cache_max_size()
+
+    @max_size.setter
+    def max_size(self, value):
+        torch._mkl_fft_set_plan_cache_max_size(value)
+
+    def clear(self):
+        return torch._mkl_fft_clear_plan_cache()
+
+
+fft_plan_cache = MklFftPlanCache()
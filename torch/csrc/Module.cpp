@@ -17,6 +17,7 @@
 #include <ATen/core/Vitals.h>
 #include <ATen/dlpack.h>
 #include <ATen/native/ConvUtils.h>
+#include <ATen/native/ElementwiseChainFusion.h>
 #include <ATen/native/ForeachUtils.h>
 #include <c10/core/DispatchKeySet.h>
 #include <c10/util/Backtrace.h>
@@ -878,6 +879,46 @@ PyObject* THPModule_allowBF16ReductionCuBLAS(
   Py_RETURN_FALSE;
 }
 
+PyObject* THPModule_setAllowFastMathTranscendentalsCPU(
+    PyObject* _unused,
+    PyObject* arg) {
+  THPUtils_assert(
+      PyBool_Check(arg),
+      "set_cpu_allow_fast_math_transcendentals expects a bool, "
+      "but got %s",
+      THPUtils_typename(arg));
+  at::globalContext().setAllowFastMathTranscendentalsCPU(arg == Py_True);
+  Py_RETURN_NONE;
+}
+
+PyObject* THPModule_allowFastMathTranscendentalsCPU(
+    PyObject* _unused,
+    PyObject* noargs) {
+  if (at::globalContext().allowFastMathTranscendentalsCPU()) {
+    Py_RETURN_TRUE;
+  }
+  Py_RETURN_FALSE;
+}
+
+PyObject* THPModule_setElementwiseChainFusion(
+    PyObject* _unused,
+    PyObject* arg) {
+  THPUtils_assert(
+      PyBool_Check(arg),
+      "set_cpu_elementwise_chain_fusion expects a bool, "
+      "but got %s",
+      THPUtils_typename(arg));
+  at::native::chain_fusion::setEnabled(arg == Py_True);
+  Py_RETURN_NONE;
+}
+
+PyObject* THPModule_elementwiseChainFusion(PyObject* _unused, PyObject* noargs) {
+  if (at::native::chain_fusion::enabled()) {
+    Py_RETURN_TRUE;
+  }
+  Py_RETURN_FALSE;
+}
+
 PyObject* THPModule_setFlushDenormal(PyObject* _unused, PyObject* arg) {
   THPUtils_assert(
       PyBool_Check(arg),
@@ -1241,6 +1282,22 @@ static PyMethodDef TorchMethods[] = { // NOLINT
      THPModule_setAllowBF16ReductionCuBLAS,
      METH_O,
      nullptr},
+    {"_get_cpu_allow_fast_math_transcendentals",
+     THPModule_allowFastMathTranscendentalsCPU,
+     METH_NOARGS,
+     nullptr},
+    {"_set_cpu_allow_fast_math_transcendentals",
+     THPModule_setAllowFastMathTranscendentalsCPU,
+     METH_O,
+     nullptr},
+    {"_get_cpu_elementwise_chain_fusion",
+     THPModule_elementwiseChainFusion,
+     METH_NOARGS,
+     nullptr},
+    {"_set_cpu_elementwise_chain_fusion",
+     THPModule_setElementwiseChainFusion,
+     METH_O,
+     nullptr},
     {"_vmapmode_increment_nesting",
      THPModule_vmapmode_increment_nesting,
      METH_NOARGS,
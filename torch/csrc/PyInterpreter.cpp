@@ -6,7 +6,13 @@
 #include <torch/csrc/utils/python_arg_parser.h>
 #include <torch/csrc/utils/python_dispatch.h>
 
+#include <c10/core/impl/TorchDispatchModeTLS.h>
+
+#include <memory>
+#include <mutex>
 #include <string>
+#include <unordered_map>
+#include <unordered_set>
 
 using namespace torch;
 using namespace at;
@@ -276,6 +282,157 @@ bool isPythonTensor(const at::Tensor& tensor) {
   return tensor.unsafeGetTensorImpl()->key_set().has(c10::DispatchKey::Python);
 }
 
+// Note [Per-subclass torch_dispatch override cache]
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// A __torch_dispatch__ subclass normally routes *every* operator through
+// Python, even ones its implementation just redispatches. A subclass that
+// only intercepts a known set of operators can advertise that set via a
+// __torch_dispatch_ops__ class attribute (an iterable of OpOverloads or
+// "aten::op.overload" strings). The first time such a type takes the slow
+// path we snapshot the advertised set from the class dict, in the spirit of
+// c10::PyHandleCache: compute once under the GIL, then serve cheap lookups
+// that do not need the GIL at all. Subsequent calls for operators outside
+// the set skip Python entirely and redispatch below the Python key in C++,
+// exactly as an implementation that immediately redispatched would behave
+// (in particular, outputs are not re-wrapped into the subclass). Types that
+// do not define the attribute are cached as "overrides everything", which
+// preserves the default behavior. The snapshot is taken at first use and is
+// not invalidated if the class dict is later mutated. Cached types are
+// pinned with an owning reference.
+struct TorchDispatchOverrideSet {
+  bool overrides_all = true;
+  std::unordered_set<std::string> ops;
+};
+
+std::mutex torch_dispatch_override_cache_mutex;
+std::unordered_map<
+    PyTypeObject*,
+    std::shared_ptr<const TorchDispatchOverrideSet>>
+    torch_dispatch_override_cache;
+
+std::string torchDispatchOpKey(const c10::OperatorHandle& op) {
+  const auto& op_name = op.operator_name();
+  if (op_name.overload_name.empty()) {
+    return op_name.name;
+  }
+  return op_name.name + "." + op_name.overload_name;
+}
+
+std::shared_ptr<const TorchDispatchOverrideSet> lookupOverrideSet(
+    PyTypeObject* tp) {
+  std::lock_guard<std::mutex> guard(torch_dispatch_override_cache_mutex);
+  auto it = torch_dispatch_override_cache.find(tp);
+  if (it == torch_dispatch_override_cache.end()) {
+    return nullptr;
+  }
+  return it->second;
+}
+
+// Snapshot __torch_dispatch_ops__ from the class. Must be called with the
+// GIL held.
+void cacheTorchDispatchOverrides(PyTypeObject* tp) {
+  {
+    std::lock_guard<std::mutex> guard(torch_dispatch_override_cache_mutex);
+    if (torch_dispatch_override_cache.count(tp)) {
+      return;
+    }
+  }
+  auto override_set = std::make_shared<TorchDispatchOverrideSet>();
+  auto type_obj =
+      py::reinterpret_borrow<py::object>(reinterpret_cast<PyObject*>(tp));
+  if (py::hasattr(type_obj, "__torch_dispatch_ops__")) {
+    override_set->overrides_all = false;
+    py::object declared_ops = type_obj.attr("__torch_dispatch_ops__");
+    for (py::handle entry : declared_ops) {
+      std::string key;
+      if (py::isinstance<py::str>(entry)) {
+        key = py::cast<std::string>(entry);
+      } else if (py::hasattr(entry, "_schema")) {
+        // torch._ops.OpOverload
+        auto schema_obj = entry.attr("_schema");
+        key = py::cast<std::string>(schema_obj.attr("name"));
+        auto overload = py::cast<std::string>(schema_obj.attr("overload_name"));
+        if (!overload.empty()) {
+          key += "." + overload;
+        }
+      } else {
+        TORCH_CHECK(
+            false,
+            "__torch_dispatch_ops__ entries must be OpOverloads or strings "
+            "like \"aten::add.Tensor\", but ",
+            tp->tp_name,
+            " contains a ",
+            Py_TYPE(entry.ptr())->tp_name);
+      }
+      override_set->ops.insert(std::move(key));
+    }
+  }
+  std::lock_guard<std::mutex> guard(torch_dispatch_override_cache_mutex);
+  if (torch_dispatch_override_cache.emplace(tp, std::move(override_set))
+          .second) {
+    Py_INCREF(reinterpret_cast<PyObject*>(tp));
+  }
+}
+
+// Try to run the operator below the Python key without leaving C++. Returns
+// false when any participating subclass may override this operator (or has
+// not been seen yet), in which case the Python slow path must run. Does not
+// require the GIL.
+bool maybeRedispatchInCpp(
+    const c10::OperatorHandle& op,
+    torch::jit::Stack* stack,
+    size_t num_arguments) {
+  c10::optional<std::string> op_key;
+  bool saw_python_tensor = false;
+
+  auto tensor_needs_python = [&](const at::Tensor& tensor) {
+    if (!isPythonTensor(tensor)) {
+      return false;
+    }
+    saw_python_tensor = true;
+    auto maybe_obj =
+        tensor.unsafeGetTensorImpl()->pyobj_slot()->check_pyobj(
+            getPyInterpreter());
+    if (!maybe_obj.has_value() || *maybe_obj == nullptr) {
+      return true;
+    }
+    auto override_set = lookupOverrideSet(Py_TYPE(*maybe_obj));
+    if (!override_set || override_set->overrides_all) {
+      return true;
+    }
+    if (!op_key.has_value()) {
+      op_key = torchDispatchOpKey(op);
+    }
+    return override_set->ops.count(*op_key) != 0;
+  };
+
+  for (const auto& ivalue : torch::jit::last(*stack, num_arguments)) {
+    if (ivalue.isTensor()) {
+      if (tensor_needs_python(ivalue.toTensor())) {
+        return false;
+      }
+    } else if (ivalue.isList()) {
+      for (const auto& nv : ivalue.toListRef()) {
+        if (nv.isTensor() && tensor_needs_python(nv.toTensor())) {
+          return false;
+        }
+      }
+    }
+  }
+  if (!saw_python_tensor) {
+    return false;
+  }
+
+  // Mirrors THPModule_disable_torch_dispatch: exclude the Python key and
+  // everything before it, so we go straight to the key after Python.
+  c10::impl::ExcludeDispatchKeyGuard guard(
+      c10::DispatchKeySet(c10::DispatchKeySet::FULL) -
+      c10::DispatchKeySet(
+          c10::DispatchKeySet::FULL_AFTER, c10::DispatchKey::Python));
+  op.callBoxed(stack);
+  return true;
+}
+
 void ConcretePyInterpreterVTable::reportErrorCallback(
     PyObject* callback,
     DispatchKey key) const {
@@ -291,6 +448,15 @@ void ConcretePyInterpreterVTable::dispatch(
     torch::jit::Stack* stack) const {
   const auto& schema = op.schema();
   const auto num_arguments = schema.arguments().size();
+
+  // Fast path: see Note [Per-subclass torch_dispatch override cache].
+  // Skipped when a TorchDispatchMode is active, since this method is also
+  // the entry point for mode dispatch and the mode must always run.
+  if (c10::impl::TorchDispatchModeTLS::stack_len() == 0 &&
+      maybeRedispatchInCpp(op, stack, num_arguments)) {
+    return;
+  }
+
   auto arguments = torch::jit::pop(*stack, num_arguments);
 
   // The plan: convert all the arguments back into PyObjects,
@@ -326,6 +492,12 @@ void ConcretePyInterpreterVTable::dispatch(
     }
   }
 
+  // Snapshot override declarations for any subclass types we haven't seen
+  // yet, so later calls can take the C++ fast path above.
+  for (PyObject* overloaded_arg : overloaded_args) {
+    cacheTorchDispatchOverrides(Py_TYPE(overloaded_arg));
+  }
+
   auto args_kwargs = parseIValuesToPyArgsKwargs(op, arguments);
   auto args = std::move(args_kwargs.first);
   auto kwargs = std::move(args_kwargs.second);
@@ -30,6 +30,7 @@
 #include <torch/csrc/utils/python_numbers.h>
 #include <atomic>
 #include <string>
+#include <thread>
 
 static PyObject* THPStorage_sharedDecref(PyObject* self, PyObject* noargs) {
   HANDLE_TH_ERRORS
@@ -581,6 +582,135 @@ static PyObject* THPStorage_newSharedCuda(PyObject* _unused, PyObject* args) {
 // pointer.
 //
 // NB: This does NOT preserve object identity when you call it multiple times
+// NOTE [ Seqlock-protected shared storages ]
+//
+// _seqlock_write_ and _seqlock_read_ implement a single-writer seqlock over a
+// pair of shared-memory storages: an 8-byte sequence counter and a data
+// region. The writer updates the data region in place, bracketing the copy
+// with counter increments (odd while a write is in flight); readers snapshot
+// the region into a private storage and retry if the counter was odd or
+// changed across the copy. This lets one process republish a large tensor to
+// many readers without re-sharing storages or pushing bytes through pipes.
+//
+// Exactly one writer may update a given counter at a time; _seqlock_write_
+// raises if it finds the counter odd. Readers spin (yielding) until they
+// observe a quiescent counter, so liveness depends on the writer finishing
+// its copy. Both storages must live in shared memory for cross-process use,
+// but the functions only require CPU storages.
+
+static std::atomic<int64_t>* THPStorage_seqlockCounter(
+    const c10::Storage& seq) {
+  TORCH_CHECK(
+      seq.device_type() == at::kCPU,
+      "seqlock counter storage must be a CPU storage");
+  TORCH_CHECK(
+      seq.nbytes() >= sizeof(std::atomic<int64_t>),
+      "seqlock counter storage must hold at least ",
+      sizeof(std::atomic<int64_t>),
+      " bytes");
+  return static_cast<std::atomic<int64_t>*>(seq.mutable_data());
+}
+
+static PyObject* THPStorage_seqlockWrite(PyObject* _unused, PyObject* args) {
+  HANDLE_TH_ERRORS
+  PyObject* seq_obj = nullptr;
+  PyObject* data_obj = nullptr;
+  PyObject* src_obj = nullptr;
+  if (!PyArg_ParseTuple(args, "OOO", &seq_obj, &data_obj, &src_obj)) {
+    return nullptr;
+  }
+  THPUtils_assert(
+      THPStorage_Check(seq_obj) && THPStorage_Check(data_obj) &&
+          THPStorage_Check(src_obj),
+      "_seqlock_write_(): arguments must be storages");
+  const auto& seq_storage = THPStorage_Unpack(seq_obj);
+  const auto& data_storage = THPStorage_Unpack(data_obj);
+  const auto& src_storage = THPStorage_Unpack(src_obj);
+  auto* seq = THPStorage_seqlockCounter(seq_storage);
+  TORCH_CHECK(
+      data_storage.device_type() == at::kCPU &&
+          src_storage.device_type() == at::kCPU,
+      "_seqlock_write_: only available on CPU storages");
+  TORCH_CHECK(
+      data_storage.nbytes() == src_storage.nbytes(),
+      "_seqlock_write_: source storage holds ",
+      src_storage.nbytes(),
+      " bytes, but the shared region holds ",
+      data_storage.nbytes());
+
+  void* dst = data_storage.mutable_data();
+  const void* src = src_storage.data();
+  const size_t nbytes = data_storage.nbytes();
+  int64_t v = 0;
+  bool locked_by_other = false;
+  Py_BEGIN_ALLOW_THREADS;
+  // The acquire increment keeps the data writes from being hoisted above it;
+  // the release increment keeps them from sinking below.
+  v = seq->fetch_add(1, std::memory_order_acquire);
+  if (v % 2 != 0) {
+    seq->fetch_sub(1, std::memory_order_relaxed);
+    locked_by_other = true;
+  } else {
+    memcpy(dst, src, nbytes);
+    seq->fetch_add(1, std::memory_order_release);
+  }
+  Py_END_ALLOW_THREADS;
+  TORCH_CHECK(
+      !locked_by_other,
+      "_seqlock_write_: another writer is mid-update (sequence counter is odd)");
+  return THPUtils_packInt64((v + 2) / 2);
+  END_HANDLE_TH_ERRORS
+}
+
+static PyObject* THPStorage_seqlockRead(PyObject* _unused, PyObject* args) {
+  HANDLE_TH_ERRORS
+  PyObject* seq_obj = nullptr;
+  PyObject* data_obj = nullptr;
+  PyObject* dst_obj = nullptr;
+  if (!PyArg_ParseTuple(args, "OOO", &seq_obj, &data_obj, &dst_obj)) {
+    return nullptr;
+  }
+  THPUtils_assert(
+      THPStorage_Check(seq_obj) && THPStorage_Check(data_obj) &&
+          THPStorage_Check(dst_obj),
+      "_seqlock_read_(): arguments must be storages");
+  const auto& seq_storage = THPStorage_Unpack(seq_obj);
+  const auto& data_storage = THPStorage_Unpack(data_obj);
+  const auto& dst_storage = THPStorage_Unpack(dst_obj);
+  auto* seq = THPStorage_seqlockCounter(seq_storage);
+  TORCH_CHECK(
+      data_storage.device_type() == at::kCPU &&
+          dst_storage.device_type() == at::kCPU,
+      "_seqlock_read_: only available on CPU storages");
+  TORCH_CHECK(
+      data_storage.nbytes() == dst_storage.nbytes(),
+      "_seqlock_read_: destination storage holds ",
+      dst_storage.nbytes(),
+      " bytes, but the shared region holds ",
+      data_storage.nbytes());
+
+  const void* src = data_storage.data();
+  void* dst = dst_storage.mutable_data();
+  const size_t nbytes = data_storage.nbytes();
+  int64_t version = 0;
+  Py_BEGIN_ALLOW_THREADS;
+  while (true) {
+    const int64_t v1 = seq->load(std::memory_order_acquire);
+    if (v1 % 2 == 0) {
+      memcpy(dst, src, nbytes);
+      std::atomic_thread_fence(std::memory_order_acquire);
+      if (seq->load(std::memory_order_relaxed) == v1) {
+        version = v1 / 2;
+        break;
+      }
+    }
+    std::this_thread::yield();
+  }
+  Py_END_ALLOW_THREADS;
+  return THPUtils_packInt64(version);
+  END_HANDLE_TH_ERRORS
+}
+
 static PyObject* THPStorage_weakRef(PyObject* self, PyObject* args) {
   HANDLE_TH_ERRORS
   c10::StorageImpl* storage = THPStorage_Unpack(self).unsafeGetStorageImpl();
@@ -684,6 +814,14 @@ static PyMethodDef THPStorage_sharingMethods[] = {
      THPStorage_pyNewFilenameStorage,
      METH_VARARGS | METH_STATIC,
      nullptr},
+    {"_seqlock_write_",
+     THPStorage_seqlockWrite,
+     METH_VARARGS | METH_STATIC,
+     nullptr},
+    {"_seqlock_read_",
+     THPStorage_seqlockRead,
+     METH_VARARGS | METH_STATIC,
+     nullptr},
     {"_weak_ref", THPStorage_weakRef, METH_NOARGS, nullptr},
     {"_free_weak_ref", THPStorage_freeWeakRef, METH_O | METH_STATIC, nullptr},
     {"_expired", THPStorage_expired, METH_O | METH_STATIC, nullptr},
@@ -0,0 +1,61 @@
+#pragma once
+
+#include <torch/types.h>
+
+#include <torch/csrc/Export.h>
+
+#include <string>
+#include <vector>
+
+namespace torch {
+namespace data {
+namespace datasets {
+
+/// How a CSV column is decoded into a tensor.
+enum class CSVColumnType {
+  /// Parsed as float and stored in a `kFloat32` tensor.
+  kFloat32,
+  /// Parsed as a decimal integer and stored in a `kInt64` tensor.
+  kInt64,
+  /// Dictionary-encoded: distinct cell values are assigned dense codes in
+  /// order of first appearance and stored in a `kInt32` tensor; the decoded
+  /// vocabulary is returned alongside the codes.
+  kCategorical,
+};
+
+/// One decoded CSV column.
+struct TORCH_API CSVColumn {
+  std::string name;
+  CSVColumnType type;
+  /// 1-D tensor with one entry per data row.
+  Tensor values;
+  /// Code -> cell value mapping; only populated for `kCategorical` columns.
+  std::vector<std::string> dictionary;
+};
+
+/// Options for `read_csv`.
+struct TORCH_API CSVReadOptions {
+  char delimiter = ',';
+  /// Whether the first line holds column names. Without a header, columns
+  /// are named "column_<index>".
+  bool header = true;
+  /// Per-column decode types. When empty, types are inferred from the first
+  /// data row: cells that parse fully as integers become `kInt64`, as
+  /// floats `kFloat32`, anything else `kCategorical`.
+  std::vector<CSVColumnType> column_types;
+};
+
+/// Decodes a CSV file into one preallocated tensor per column.
+///
+/// The file is read once, split into row chunks on line boundaries, and the
+/// chunks are parsed in parallel with `at::parallel_for`, each thread writing
+/// directly into its slice of the column tensors. Categorical columns are
+/// dictionary-encoded with chunk-local dictionaries that are merged and
+/// remapped after the parallel pass, so no lock is taken per cell.
+TORCH_API std::vector<CSVColumn> read_csv(
+    const std::string& path,
+    const CSVReadOptions& options = {});
+
+} // namespace datasets
+} // namespace data
+} // namespace torch
@@ -0,0 +1,342 @@
+#include <torch/data/datasets/csv.h>
+
+#include <torch/types.h>
+
+#include <ATen/Parallel.h>
+#include <c10/util/Exception.h>
+#include <c10/util/irange.h>
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace torch {
+namespace data {
+namespace datasets {
+namespace {
+
+// A cell is a view into the file buffer; nothing is copied until a value is
+// parsed or a categorical entry enters a dictionary.
+struct Cell {
+  const char* data;
+  size_t size;
+
+  std::string str() const {
+    return std::string(data, size);
+  }
+};
+
+std::string read_file(const std::string& path) {
+  std::ifstream file(path, std::ios::binary | std::ios::ate);
+  TORCH_CHECK(file, "Error opening CSV file at ", path);
+  const auto size = static_cast<size_t>(file.tellg());
+  file.seekg(0);
+  std::string buffer(size, '\0');
+  TORCH_CHECK(
+      size == 0 || file.read(&buffer[0], size),
+      "Error reading CSV file at ",
+      path);
+  return buffer;
+}
+
+// Splits one row into cells. Cells wrapped in double quotes may contain the
+// delimiter; a doubled quote inside a quoted cell is an escaped quote.
+void split_row(
+    const char* begin,
+    const char* end,
+    char delimiter,
+    std::vector<Cell>& out) {
+  out.clear();
+  const char* cell_start = begin;
+  const char* pos = begin;
+  bool quoted = false;
+  while (pos < end) {
+    if (*pos == '"') {
+      quoted = !quoted;
+    } else if (*pos == delimiter && !quoted) {
+      out.push_back({cell_start, static_cast<size_t>(pos - cell_start)});
+      cell_start = pos + 1;
+    }
+    ++pos;
+  }
+  out.push_back({cell_start, static_cast<size_t>(end - cell_start)});
+}
+
+// Strips surrounding quotes and collapses escaped quotes; returns the cell
+// unchanged when it is not quoted.
+std::string unquote(const Cell& cell) {
+  if (cell.size < 2 || cell.data[0] != '"' ||
+      cell.data[cell.size - 1] != '"') {
+    return cell.str();
+  }
+  std::string result;
+  result.reserve(cell.size - 2);
+  for (size_t i = 1; i + 1 < cell.size; ++i) {
+    result.push_back(cell.data[i]);
+    if (cell.data[i] == '"' && i + 2 < cell.size && cell.data[i + 1] == '"') {
+      ++i;
+    }
+  }
+  return result;
+}
+
+constexpr size_t kMaxNumericCell = 63;
+
+bool parse_float_cell(const Cell& cell, float& value) {
+  if (cell.size == 0 || cell.size > kMaxNumericCell) {
+    return false;
+  }
+  // strtof needs a terminated buffer; cells are views into the file.
+  // NOLINTNEXTLINE(*c-arrays*)
+  char buffer[kMaxNumericCell + 1];
+  std::memcpy(buffer, cell.data, cell.size);
+  buffer[cell.size] = '\0';
+  char* parse_end = nullptr;
+  value = std::strtof(buffer, &parse_end);
+  return parse_end == buffer + cell.size;
+}
+
+bool parse_int_cell(const Cell& cell, int64_t& value) {
+  if (cell.size == 0 || cell.size > kMaxNumericCell) {
+    return false;
+  }
+  // NOLINTNEXTLINE(*c-arrays*)
+  char buffer[kMaxNumericCell + 1];
+  std::memcpy(buffer, cell.data, cell.size);
+  buffer[cell.size] = '\0';
+  char* parse_end = nullptr;
+  value = std::strtoll(buffer, &parse_end, 10);
+  return parse_end == buffer + cell.size;
+}
+
+CSVColumnType infer_type(const Cell& cell) {
+  int64_t int_value = 0;
+  if (parse_int_cell(cell, int_value)) {
+    return CSVColumnType::kInt64;
+  }
+  float float_value = 0;
+  if (parse_float_cell(cell, float_value)) {
+    return CSVColumnType::kFloat32;
+  }
+  return CSVColumnType::kCategorical;
+}
+
+// Chunk-local dictionary for one categorical column, so the parallel pass
+// never takes a lock; local codes are remapped to global ones afterwards.
+struct LocalDictionary {
+  std::unordered_map<std::string, int32_t> codes;
+  std::vector<std::string> vocabulary;
+
+  int32_t encode(const Cell& cell) {
+    auto value = unquote(cell);
+    auto it = codes.find(value);
+    if (it != codes.end()) {
+      return it->second;
+    }
+    const auto code = static_cast<int32_t>(vocabulary.size());
+    codes.emplace(value, code);
+    vocabulary.push_back(std::move(value));
+    return code;
+  }
+};
+
+} // namespace
+
+std::vector<CSVColumn> read_csv(
+    const std::string& path,
+    const CSVReadOptions& options) {
+  const std::string buffer = read_file(path);
+
+  // Index row start/end offsets once; everything after parses row ranges.
+  std::vector<std::pair<const char*, const char*>> rows;
+  {
+    const char* pos = buffer.data();
+    const char* const end = buffer.data() + buffer.size();
+    while (pos < end) {
+      const char* line_end =
+          static_cast<const char*>(std::memchr(pos, '\n', end - pos));
+      if (line_end == nullptr) {
+        line_end = end;
+      }
+      const char* effective_end = line_end;
+      if (effective_end > pos && effective_end[-1] == '\r') {
+        --effective_end;
+      }
+      if (effective_end > pos) {
+        rows.emplace_back(pos, effective_end);
+      }
+      pos = line_end + 1;
+    }
+  }
+
+  std::vector<std::string> names;
+  std::vector<Cell> cells;
+  size_t first_data_row = 0;
+  if (options.header) {
+    TORCH_CHECK(!rows.empty(), "CSV file at ", path, " is empty");
+    split_row(rows[0].first, rows[0].second, options.delimiter, cells);
+    for (const auto& cell : cells) {
+      names.push_back(unquote(cell));
+    }
+    first_data_row = 1;
+  }
+
+  const int64_t num_rows =
+      static_cast<int64_t>(rows.size() - first_data_row);
+  TORCH_CHECK(num_rows > 0, "CSV file at ", path, " has no data rows");
+
+  split_row(
+      rows[first_data_row].first,
+      rows[first_data_row].second,
+      options.delimiter,
+      cells);
+  const size_t num_columns = names.empty() ? cells.size() : names.size();
+  for (size_t i = names.size(); i < num_columns; ++i) {
+    names.push_back("column_" + std::to_string(i));
+  }
+
+  std::vector<CSVColumnType> types = options.column_types;
+  if (types.empty()) {
+    for (const auto i : c10::irange(num_columns)) {
+      types.push_back(infer_type(cells[i]));
+    }
+  }
+  TORCH_CHECK(
+      types.size() == num_columns,
+      "Expected ",
+      num_columns,
+      " column types, but got ",
+      types.size());
+
+  std::vector<CSVColumn> columns(num_columns);
+  for (const auto i : c10::irange(num_columns)) {
+    columns[i].name = names[i];
+    columns[i].type = types[i];
+    switch (types[i]) {
+      case CSVColumnType::kFloat32:
+        columns[i].values = torch::empty({num_rows}, torch::kFloat32);
+        break;
+      case CSVColumnType::kInt64:
+        columns[i].values = torch::empty({num_rows}, torch::kInt64);
+        break;
+      case CSVColumnType::kCategorical:
+        columns[i].values = torch::empty({num_rows}, torch::kInt32);
+        break;
+    }
+  }
+
+  // Fixed row chunks so each parallel task owns a disjoint slice of every
+  // column tensor and one set of local dictionaries.
+  constexpr int64_t kRowsPerChunk = 4096;
+  const int64_t num_chunks = std::max<int64_t>(
+      1,
+      std::min<int64_t>(
+          at::get_num_threads(), at::divup(num_rows, kRowsPerChunk)));
+  const int64_t chunk_rows = at::divup(num_rows, num_chunks);
+  std::vector<void*> column_data;
+  column_data.reserve(num_columns);
+  for (const auto i : c10::irange(num_columns)) {
+    column_data.push_back(columns[i].values.data_ptr());
+  }
+  std::vector<std::vector<LocalDictionary>> local_dictionaries(
+      num_chunks, std::vector<LocalDictionary>(num_columns));
+
+  at::parallel_for(0, num_chunks, 1, [&](int64_t chunk_begin, int64_t chunk_end) {
+    std::vector<Cell> row_cells;
+    for (const auto chunk : c10::irange(chunk_begin, chunk_end)) {
+      auto& dictionaries = local_dictionaries[chunk];
+      const int64_t row_begin = chunk * chunk_rows;
+      const int64_t row_end = std::min(num_rows, row_begin + chunk_rows);
+      for (const auto row : c10::irange(row_begin, row_end)) {
+        const auto& line = rows[first_data_row + row];
+        split_row(line.first, line.second, options.delimiter, row_cells);
+        TORCH_CHECK(
+            row_cells.size() == num_columns,
+            "CSV row ",
+            row,
+            " has ",
+            row_cells.size(),
+            " cells, expected ",
+            num_columns);
+        for (const auto col : c10::irange(num_columns)) {
+          switch (types[col]) {
+            case CSVColumnType::kFloat32: {
+              float value = 0;
+              TORCH_CHECK(
+                  parse_float_cell(row_cells[col], value),
+                  "Failed to parse '",
+                  row_cells[col].str(),
+                  "' as float at row ",
+                  row,
+                  ", column ",
+                  names[col]);
+              static_cast<float*>(column_data[col])[row] = value;
+              break;
+            }
+            case CSVColumnType::kInt64: {
+              int64_t value = 0;
+              TORCH_CHECK(
+                  parse_int_cell(row_cells[col], value),
+                  "Failed to parse '",
+                  row_cells[col].str(),
+                  "' as int at row ",
+                  row,
+                  ", column ",
+                  names[col]);
+              static_cast<int64_t*>(column_data[col])[row] = value;
+              break;
+            }
+            case CSVColumnType::kCategorical: {
+              static_cast<int32_t*>(column_data[col])[row] =
+                  dictionaries[col].encode(row_cells[col]);
+              break;
+            }
+          }
+        }
+      }
+    }
+  });
+
+  // Merge the chunk-local dictionaries in chunk order (so codes follow first
+  // appearance in the file) and remap each chunk's slice of codes.
+  for (const auto col : c10::irange(num_columns)) {
+    if (types[col] != CSVColumnType::kCategorical) {
+      continue;
+    }
+    auto& column = columns[col];
+    std::unordered_map<std::string, int32_t> global_codes;
+    int32_t* codes = column.values.data_ptr<int32_t>();
+    for (const auto chunk : c10::irange(num_chunks)) {
+      auto& local = local_dictionaries[chunk][col];
+      std::vector<int32_t> remap(local.vocabulary.size());
+      for (const auto local_code : c10::irange(local.vocabulary.size())) {
+        auto& value = local.vocabulary[local_code];
+        auto it = global_codes.find(value);
+        if (it == global_codes.end()) {
+          const auto code = static_cast<int32_t>(column.dictionary.size());
+          global_codes.emplace(value, code);
+          column.dictionary.push_back(std::move(value));
+          remap[local_code] = code;
+        } else {
+          remap[local_code] = it->second;
+        }
+      }
+      const int64_t row_begin = chunk * chunk_rows;
+      const int64_t row_end = std::min(num_rows, row_begin + chunk_rows);
+      for (const auto row : c10::irange(row_begin, row_end)) {
+        codes[row] = remap[codes[row]];
+      }
+    }
+  }
+
+  return columns;
+}
+
+} // namespace datasets
+} // namespace data
+} // namespace torch
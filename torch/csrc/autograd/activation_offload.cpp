@@ -0,0 +1,237 @@
+#include <torch/csrc/autograd/activation_offload.h>
+
+#include <ATen/ATen.h>
+#include <c10/core/Event.h>
+#include <c10/core/StreamGuard.h>
+#include <c10/core/impl/VirtualGuardImpl.h>
+
+#include <atomic>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+namespace torch {
+namespace autograd {
+namespace {
+
+// One offloaded saved tensor. The pinned host copy is the source of truth;
+// `staged` holds the device copy between prefetch and unpack. Records are
+// owned by their OffloadSavedVariableHooks (so they live exactly as long as
+// the SavedVariable) and tracked by the engine through weak references for
+// prefetch ordering.
+struct OffloadRecord {
+  explicit OffloadRecord(c10::Device device)
+      : device(device),
+        d2h_done(device.type()),
+        h2d_done(device.type()) {}
+
+  c10::Device device;
+  at::Tensor host;
+  at::Tensor staged;
+  c10::Event d2h_done;
+  c10::Event h2d_done;
+  bool prefetched = false;
+  size_t nbytes = 0;
+  uint64_t id = 0;
+};
+
+class OffloadEngine {
+ public:
+  static OffloadEngine& get() {
+    static OffloadEngine engine;
+    return engine;
+  }
+
+  std::atomic<bool> enabled{false};
+
+  ActivationOffloadPolicy policy() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return policy_;
+  }
+
+  void set_policy(const ActivationOffloadPolicy& policy) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    policy_ = policy;
+  }
+
+  // Copies `tensor` to pinned host memory on the D2H side stream and returns
+  // the tracking record, or nullptr when the tensor should stay resident.
+  std::shared_ptr<OffloadRecord> pack(const at::Tensor& tensor) {
+    if (!tensor.defined() || !tensor.has_storage() ||
+        !tensor.device().is_cuda()) {
+      return nullptr;
+    }
+    // Unpack rebuilds the layout from sizes and strides; anything more
+    // exotic than a non-overlapping dense tensor stays resident.
+    if (!tensor.is_non_overlapping_and_dense()) {
+      return nullptr;
+    }
+    c10::impl::VirtualGuardImpl impl(tensor.device().type());
+    auto producer = impl.getStream(tensor.device());
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (tensor.nbytes() < policy_.min_tensor_nbytes) {
+      return nullptr;
+    }
+    auto record = std::make_shared<OffloadRecord>(tensor.device());
+    record->nbytes = tensor.nbytes();
+    record->id = next_id_++;
+
+    auto d2h = side_stream(d2h_streams_, tensor.device(), impl);
+    // Order the copy after whatever produced the activation.
+    c10::Event produced(tensor.device().type());
+    produced.record(producer);
+    produced.block(d2h);
+    {
+      c10::StreamGuard guard(d2h);
+      record->host = at::empty_strided(
+          tensor.sizes(),
+          tensor.strides(),
+          tensor.options().device(at::kCPU).pinned_memory(true));
+      record->host.copy_(tensor, /*non_blocking=*/true);
+    }
+    // The device allocation may be freed as soon as pack returns; make the
+    // caching allocator wait for the side-stream copy before reusing it.
+    impl.recordDataPtrOnStream(tensor.storage().data_ptr(), d2h);
+    record->d2h_done.record(d2h);
+
+    records_.emplace(record->id, record);
+    return record;
+  }
+
+  // Returns the device copy for `record`, staging it if the prefetcher has
+  // not already, and prefetches the records packed just before it up to the
+  // watermark. The calling (consumer) stream waits only on this record's
+  // copy-done event.
+  at::Tensor unpack(const std::shared_ptr<OffloadRecord>& record) {
+    c10::impl::VirtualGuardImpl impl(record->device.type());
+
+    std::unique_lock<std::mutex> lock(mutex_);
+    if (!record->prefetched) {
+      prefetch(*record, impl);
+    }
+    // Backward consumes records in roughly reverse pack order, so the ones
+    // needed next are those packed immediately before this one.
+    auto it = records_.find(record->id);
+    while (it != records_.begin() &&
+           staged_unconsumed_ < policy_.prefetch_watermark_nbytes) {
+      --it;
+      auto ahead = it->second.lock();
+      if (!ahead) {
+        it = records_.erase(it);
+        continue;
+      }
+      if (!ahead->prefetched && ahead->host.defined()) {
+        prefetch(*ahead, c10::impl::VirtualGuardImpl(ahead->device.type()));
+      }
+    }
+
+    at::Tensor staged = std::move(record->staged);
+    record->prefetched = false;
+    staged_unconsumed_ -= std::min(record->nbytes, staged_unconsumed_);
+    records_.erase(record->id);
+    lock.unlock();
+
+    auto consumer = impl.getStream(record->device);
+    record->h2d_done.block(consumer);
+    impl.recordDataPtrOnStream(staged.storage().data_ptr(), consumer);
+    return staged;
+  }
+
+ private:
+  OffloadEngine() = default;
+
+  // Issues the H2D copy for `record` on the prefetch side stream. Caller
+  // must hold mutex_.
+  void prefetch(OffloadRecord& record, const c10::impl::VirtualGuardImpl& impl) {
+    auto h2d = side_stream(h2d_streams_, record.device, impl);
+    // The host staging copy must have landed before we read it back.
+    record.d2h_done.block(h2d);
+    {
+      c10::StreamGuard guard(h2d);
+      record.staged = at::empty_strided(
+          record.host.sizes(),
+          record.host.strides(),
+          record.host.options().device(record.device));
+      record.staged.copy_(record.host, /*non_blocking=*/true);
+    }
+    record.h2d_done.record(h2d);
+    record.prefetched = true;
+    staged_unconsumed_ += record.nbytes;
+  }
+
+  // Lazily created per-device side streams. Caller must hold mutex_.
+  c10::Stream side_stream(
+      std::vector<c10::optional<c10::Stream>>& streams,
+      c10::Device device,
+      const c10::impl::VirtualGuardImpl& impl) {
+    auto index = static_cast<size_t>(device.index());
+    if (streams.size() <= index) {
+      streams.resize(index + 1);
+    }
+    if (!streams[index]) {
+      streams[index] = impl.getStreamFromGlobalPool(device);
+    }
+    return *streams[index];
+  }
+
+  std::mutex mutex_;
+  ActivationOffloadPolicy policy_;
+  uint64_t next_id_ = 0;
+  // Live records in pack order; expired entries are pruned as the prefetch
+  // scan walks over them.
+  std::map<uint64_t, std::weak_ptr<OffloadRecord>> records_;
+  size_t staged_unconsumed_ = 0;
+  std::vector<c10::optional<c10::Stream>> d2h_streams_;
+  std::vector<c10::optional<c10::Stream>> h2d_streams_;
+};
+
+struct OffloadSavedVariableHooks : public SavedVariableHooks {
+  void call_pack_hook(const at::Tensor& tensor) override {
+    record_ = OffloadEngine::get().pack(tensor);
+    if (!record_) {
+      tensor_ = tensor;
+    }
+  }
+
+  at::Tensor call_unpack_hook() override {
+    if (record_) {
+      return OffloadEngine::get().unpack(record_);
+    }
+    return tensor_;
+  }
+
+ private:
+  std::shared_ptr<OffloadRecord> record_;
+  at::Tensor tensor_;
+};
+
+} // namespace
+
+void setActivationOffloadEnabled(bool enabled) {
+  OffloadEngine::get().enabled.store(enabled, std::memory_order_relaxed);
+}
+
+bool isActivationOffloadEnabled() {
+  return OffloadEngine::get().enabled.load(std::memory_order_relaxed);
+}
+
+void setActivationOffloadPolicy(const ActivationOffloadPolicy& policy) {
+  OffloadEngine::get().set_policy(policy);
+}
+
+ActivationOffloadPolicy getActivationOffloadPolicy() {
+  return OffloadEngine::get().policy();
+}
+
+std::unique_ptr<SavedVariableHooks> getActivationOffloadHooks() {
+  if (!isActivationOffloadEnabled()) {
+    return nullptr;
+  }
+  return std::make_unique<OffloadSavedVariableHooks>();
+}
+
+} // namespace autograd
+} // namespace torch
@@ -0,0 +1,47 @@
+#pragma once
+
+#include <torch/csrc/Export.h>
+#include <torch/csrc/autograd/saved_variable_hooks.h>
+
+#include <cstddef>
+#include <memory>
+
+namespace torch {
+namespace autograd {
+
+// Asynchronous activation offload for saved tensors.
+//
+// When enabled, tensors saved for backward on an accelerator device are
+// copied to pinned host memory on a dedicated side stream right after they
+// are packed, freeing their device allocation for the rest of the forward
+// pass. During backward, each unpack stages the record back on a second side
+// stream and opportunistically prefetches the records packed just before it
+// (the ones backward will need next) until the staged-but-unconsumed bytes
+// reach the policy watermark, so host-to-device transfers overlap with
+// gradient computation. The consumer stream only waits on the copy-done
+// event of the record it actually unpacks.
+//
+// This is the native counterpart of torch.autograd.graph.save_on_cpu: no
+// per-tensor Python hook calls, copies are stream-ordered rather than
+// synchronous, and staging goes through the caching host allocator.
+struct TORCH_API ActivationOffloadPolicy {
+  // Tensors smaller than this stay resident; offloading them costs more in
+  // copy launch latency than the memory they hold.
+  size_t min_tensor_nbytes = 1024 * 1024;
+  // During backward, prefetch ahead until this many bytes are staged on
+  // device but not yet consumed.
+  size_t prefetch_watermark_nbytes = 64 * 1024 * 1024;
+};
+
+TORCH_API void setActivationOffloadEnabled(bool enabled);
+TORCH_API bool isActivationOffloadEnabled();
+TORCH_API void setActivationOffloadPolicy(const ActivationOffloadPolicy& policy);
+TORCH_API ActivationOffloadPolicy getActivationOffloadPolicy();
+
+// Returns offload hooks for the next SavedVariable when offload is enabled,
+// nullptr otherwise. Called from SavedVariable::get_default_hooks when no
+// user saved-tensor hooks are installed; user hooks take precedence.
+TORCH_API std::unique_ptr<SavedVariableHooks> getActivationOffloadHooks();
+
+} // namespace autograd
+} // namespace torch
@@ -27,8 +27,10 @@
 #include <c10/util/Exception.h>
 #include <c10/util/Optional.h>
 #include <c10/util/ThreadLocal.h>
+#include <c10/util/hash.h>
 #include <c10/util/irange.h>
 
+#include <algorithm>
 #include <atomic>
 #include <chrono>
 #include <condition_variable>
@@ -232,6 +234,145 @@ CheckpointValidGuard::~CheckpointValidGuard() {
   checkpoint_valid = prev_checkpoint_valid_state;
 }
 
+// Note [CPU work stealing]
+// ~~~~~~~~~~~~~~~~~~~~~~~~
+// Every backward call drains CPU NodeTasks from a single thread-local
+// ReadyQueue, so a wide CPU graph executes on one core no matter how many are
+// idle. When work stealing is enabled (Engine::set_cpu_work_stealing_enabled),
+// each CPU ready queue registers itself in a process-wide list; a thread whose
+// own queue is empty first tries a non-blocking pop of a *runnable* task
+// (fn_ set, not a shutdown/wake-up sentinel) from the other registered queues
+// before falling back to the blocking pop. Sentinels are never stolen: the
+// dummy task that wakes a sleeping graph owner must reach that owner, and
+// shutdown tasks only target device threads. Device ready queues do not
+// register, so device nodes keep their dedicated thread and stream semantics.
+namespace {
+std::atomic<bool> cpu_work_stealing_enabled_flag{false};
+std::atomic<uint64_t> cpu_steal_counter{0};
+std::mutex cpu_queue_registry_mutex;
+std::vector<std::weak_ptr<ReadyQueue>> cpu_queue_registry;
+
+void register_cpu_ready_queue(const std::shared_ptr<ReadyQueue>& queue) {
+  std::lock_guard<std::mutex> lock(cpu_queue_registry_mutex);
+  // Prune queues owned by threads that have exited.
+  cpu_queue_registry.erase(
+      std::remove_if(
+          cpu_queue_registry.begin(),
+          cpu_queue_registry.end(),
+          [](const std::weak_ptr<ReadyQueue>& weak) { return weak.expired(); }),
+      cpu_queue_registry.end());
+  cpu_queue_registry.emplace_back(queue);
+}
+
+c10::optional<NodeTask> try_steal_cpu_task(const ReadyQueue* own_queue) {
+  std::vector<std::shared_ptr<ReadyQueue>> victims;
+  {
+    std::lock_guard<std::mutex> lock(cpu_queue_registry_mutex);
+    victims.reserve(cpu_queue_registry.size());
+    for (auto& weak : cpu_queue_registry) {
+      if (auto queue = weak.lock()) {
+        if (queue.get() != own_queue) {
+          victims.push_back(std::move(queue));
+        }
+      }
+    }
+  }
+  for (auto& victim : victims) {
+    if (auto task = victim->pop_nowait(/*only_runnable=*/true)) {
+      cpu_steal_counter.fetch_add(1, std::memory_order_relaxed);
+      return task;
+    }
+  }
+  return c10::nullopt;
+}
+} // namespace
+
+void Engine::set_cpu_work_stealing_enabled(bool enabled) {
+  cpu_work_stealing_enabled_flag.store(enabled);
+}
+
+bool Engine::cpu_work_stealing_enabled() {
+  return cpu_work_stealing_enabled_flag.load(std::memory_order_relaxed);
+}
+
+uint64_t Engine::cpu_steal_count() {
+  return cpu_steal_counter.load(std::memory_order_relaxed);
+}
+
+// Note [Graph topology cache]
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// compute_dependencies rebuilds the per-node dependency counts from scratch on
+// every backward call, even when the same graph is replayed (retain_graph, or
+// repeated .grad() calls on one forward). When the cache is enabled
+// (Engine::set_graph_topology_cache_enabled), we remember the computed
+// dependency counts per root node together with a hash of the full
+// (node, edge) structure. A later backward over the same root revalidates
+// with a cheap hashing walk and, on a match, copies the cached counts instead
+// of rebuilding them. Because the hash covers every node pointer and edge in
+// the pruned traversal, a matching hash implies identical pointer-level
+// topology, so the cached counts are exact; any structural change (including a
+// freed node whose address was reused by a different graph) changes the hash
+// and falls back to the full computation.
+namespace {
+std::atomic<bool> graph_topology_cache_enabled_flag{false};
+std::atomic<uint64_t> graph_topology_cache_hit_counter{0};
+
+struct CachedTopology {
+  uint64_t structure_hash;
+  uint64_t min_topo_nr;
+  std::unordered_map<Node*, int> dependencies;
+  std::unordered_set<Node*> nodes_in_graph;
+  bool will_use_cuda;
+};
+
+constexpr size_t kMaxCachedTopologies = 16;
+std::mutex topology_cache_mutex;
+std::unordered_map<Node*, CachedTopology> topology_cache;
+
+// Walks the graph exactly like compute_dependencies (same pruning on
+// min_topo_nr, same DFS order) and folds every visited node pointer and edge
+// into a single hash.
+uint64_t hash_graph_topology(Node* root, uint64_t min_topo_nr) {
+  uint64_t hash = c10::hash_combine(
+      min_topo_nr, reinterpret_cast<uintptr_t>(root));
+  std::vector<Node*> queue{root};
+  std::unordered_set<Node*> seen;
+  while (!queue.empty()) {
+    auto fn = queue.back();
+    queue.pop_back();
+    if (fn->topological_nr() < min_topo_nr) {
+      continue;
+    }
+    for (const auto& edge : fn->next_edges()) {
+      if (auto next_ptr = edge.function.get()) {
+        hash = c10::hash_combine(hash, reinterpret_cast<uintptr_t>(next_ptr));
+        hash = c10::hash_combine(hash, edge.input_nr);
+        if (seen.insert(next_ptr).second) {
+          queue.push_back(next_ptr);
+        }
+      }
+    }
+  }
+  return hash;
+}
+} // namespace
+
+void Engine::set_graph_topology_cache_enabled(bool enabled) {
+  graph_topology_cache_enabled_flag.store(enabled);
+  if (!enabled) {
+    std::lock_guard<std::mutex> lock(topology_cache_mutex);
+    topology_cache.clear();
+  }
+}
+
+bool Engine::graph_topology_cache_enabled() {
+  return graph_topology_cache_enabled_flag.load(std::memory_order_relaxed);
+}
+
+uint64_t Engine::graph_topology_cache_hits() {
+  return graph_topology_cache_hit_counter.load(std::memory_order_relaxed);
+}
+
 auto ReadyQueue::push(NodeTask item, bool incrementOutstandingTasks) -> void {
   {
     // Lock mutex for writing to heap_
@@ -270,6 +411,21 @@ auto ReadyQueue::pop() -> NodeTask {
   return task;
 }
 
+auto ReadyQueue::pop_nowait(bool only_runnable) -> c10::optional<NodeTask> {
+  std::unique_lock<std::mutex> lock(mutex_);
+  if (heap_.empty()) {
+    return c10::nullopt;
+  }
+  const auto& top = heap_.top();
+  if (only_runnable && (!top.fn_ || top.isShutdownTask_)) {
+    return c10::nullopt;
+  }
+  // NOLINTNEXTLINE(cppcoreguidelines-pro-type-const-cast)
+  auto task = std::move(const_cast<NodeTask&>(heap_.top()));
+  heap_.pop();
+  return task;
+}
+
 bool ReadyQueue::empty() const {
   // Lock mutex for accesses to heap_
   std::unique_lock<std::mutex> lock(mutex_);
@@ -530,7 +686,22 @@ auto Engine::thread_main(const std::shared_ptr<GraphTask>& graph_task) -> void {
       // Scope this block of execution since NodeTask is not needed after this
       // block and can be deallocated (release any references to grad tensors
       // as part of inputs_).
-      NodeTask task = local_ready_queue->pop();
+      NodeTask task = [&]() -> NodeTask {
+        // With CPU work stealing on, try our own queue without blocking and
+        // then other registered CPU queues before sleeping on our own.
+        // See Note [CPU work stealing].
+        if (C10_UNLIKELY(cpu_work_stealing_enabled()) &&
+            worker_device == CPU_DEVICE) {
+          if (auto local = local_ready_queue->pop_nowait(
+                  /*only_runnable=*/false)) {
+            return std::move(*local);
+          }
+          if (auto stolen = try_steal_cpu_task(local_ready_queue.get())) {
+            return std::move(*stolen);
+          }
+        }
+        return local_ready_queue->pop();
+      }();
       // This will only work if the worker is running a non backward task
       // TODO Needs to be fixed this to work in all cases
       if (task.isShutdownTask_) {
@@ -597,7 +768,15 @@ auto Engine::thread_main(const std::shared_ptr<GraphTask>& graph_task) -> void {
       // before it gets to the task, but it's a no-op anyway.
       //
       // NB: This is not necessary if the current thread is the owning thread.
-      if (worker_device != base_owner) {
+      //
+      // With CPU work stealing, a stolen task can complete a graph whose
+      // owner is a *different* CPU thread sleeping on its own queue; the
+      // device check alone can't see that, so also wake the owner whenever we
+      // finished a task belonging to a foreign CPU queue.
+      const bool completed_foreign_cpu_graph =
+          cpu_work_stealing_enabled() &&
+          local_graph_task->cpu_ready_queue_ != local_ready_queue;
+      if (worker_device != base_owner || completed_foreign_cpu_graph) {
         // Synchronize outstanding_tasks_ with queue mutex
         std::atomic_thread_fence(std::memory_order_release);
         ready_queue_by_index(local_graph_task->cpu_ready_queue_, base_owner)
@@ -978,7 +1157,7 @@ void Engine::evaluate_function(
   auto& exec_info_ = graph_task->exec_info_;
   if (!exec_info_.empty()) {
     auto& fn_info = exec_info_.at(func);
-    variable_list new_inputs = inputs.buffer;
+    variable_list new_inputs;
     if (!fn_info.needed_) {
       // We always want to call tensor pre-hooks, but want to avoid calling it
       // twice. needed_ = True indicates that we will call tensor pre-hooks
@@ -989,12 +1168,17 @@ void Engine::evaluate_function(
           *func, InputBuffer::variables(std::move(inputs)));
     }
     if (auto* capture_vec = fn_info.captures_.get()) {
+      // When the function still runs below, borrow the grads straight out of
+      // the input buffer rather than refcounting a copy of the whole list;
+      // only the captured entries are copied into captured_vars_.
+      const variable_list& capture_inputs =
+          fn_info.needed_ ? inputs.buffer : new_inputs;
       const auto opt_parent_stream = (*func).stream(c10::DeviceType::CUDA);
       // Lock mutex for writing to graph_task->captured_vars_.
       std::lock_guard<std::mutex> lock(graph_task->mutex_);
       for (const auto& capture : *capture_vec) {
         auto& captured_grad = graph_task->captured_vars_[capture.output_idx_];
-        captured_grad = new_inputs[capture.input_idx_];
+        captured_grad = capture_inputs[capture.input_idx_];
         // NOTE [Deprecated capture hooks]
         for (const auto& hook :
              capture.DO_NOT_USE_DEPRECATED_get_capture_hooks()) {
@@ -1077,8 +1261,10 @@ void Engine::evaluate_function(
           continue;
         }
       }
-      // No buffers have been allocated for the function
-      InputBuffer input_buffer(next.function->num_inputs());
+      // No buffers have been allocated for the function; reuse storage from
+      // buffers this GraphTask has already consumed where possible.
+      InputBuffer input_buffer(
+          graph_task->input_buffer_pool_.acquire(next.function->num_inputs()));
 
       // Accumulates into buffer
       const auto opt_next_stream = next.function->stream(c10::DeviceType::CUDA);
@@ -1108,6 +1294,10 @@ void Engine::evaluate_function(
       }
     }
   }
+
+  // Each grad in `outputs` has been moved into an InputBuffer above, so its
+  // storage can be recycled into the next buffer this task allocates.
+  graph_task->input_buffer_pool_.release(std::move(outputs));
 }
 
 inline static uint64_t compute_min_topological_nr(const edge_list& outputs) {
@@ -1127,11 +1317,34 @@ auto Engine::compute_dependencies(
     Node* root,
     GraphTask& task,
     uint64_t min_topo_nr) -> void {
-  // Computes the number of dependencies for each function which requires grad
-  std::vector<Node*> queue{root};
   bool might_use_cuda = at::globalContext().hasCUDA();
   bool will_use_cuda = false;
 
+  // See Note [Graph topology cache]. The hashing walk revalidates the cached
+  // entry against the current graph; on a match we copy the cached counts and
+  // skip the dependency-building traversal below.
+  uint64_t structure_hash = 0;
+  if (graph_topology_cache_enabled()) {
+    structure_hash = hash_graph_topology(root, min_topo_nr);
+    std::lock_guard<std::mutex> lock(topology_cache_mutex);
+    auto it = topology_cache.find(root);
+    if (it != topology_cache.end() &&
+        it->second.structure_hash == structure_hash &&
+        it->second.min_topo_nr == min_topo_nr) {
+      task.dependencies_ = it->second.dependencies;
+      task.nodes_in_graph_ = it->second.nodes_in_graph;
+      graph_topology_cache_hit_counter.fetch_add(
+          1, std::memory_order_relaxed);
+      if (might_use_cuda && it->second.will_use_cuda) {
+        task.stash_current_streams();
+      }
+      return;
+    }
+  }
+
+  // Computes the number of dependencies for each function which requires grad
+  std::vector<Node*> queue{root};
+
   // Queue contains all nodes that will start propagating gradients.
   // We no longer have to expand functions that don't require grad.
   auto& dependencies = task.dependencies_;
@@ -1159,6 +1372,21 @@ auto Engine::compute_dependencies(
     // so GraphTask::exec_post_processing can sync them with leaf_streams.
     task.stash_current_streams();
   }
+
+  if (graph_topology_cache_enabled()) {
+    std::lock_guard<std::mutex> lock(topology_cache_mutex);
+    if (topology_cache.size() >= kMaxCachedTopologies &&
+        topology_cache.count(root) == 0) {
+      // Evict an arbitrary entry to keep the cache bounded.
+      topology_cache.erase(topology_cache.begin());
+    }
+    topology_cache[root] = CachedTopology{
+        structure_hash,
+        min_topo_nr,
+        task.dependencies_,
+        task.nodes_in_graph_,
+        will_use_cuda};
+  }
 }
 
 auto Engine::execute(
@@ -1405,6 +1633,11 @@ void Engine::init_local_ready_queue(std::shared_ptr<ReadyQueue> ready_queue) {
   } else if (!local_ready_queue) {
     // otherwise if local_ready_queue not allocated, allocate a new ready_queue
     local_ready_queue = std::make_shared<ReadyQueue>();
+    if (cpu_work_stealing_enabled()) {
+      // CPU queues created here belong to backward-calling threads; make them
+      // visible to stealers. See Note [CPU work stealing].
+      register_cpu_ready_queue(local_ready_queue);
+    }
   }
 }
 
@@ -122,6 +122,11 @@ struct ReadyQueue {
   void push(NodeTask item, bool incrementOutstandingTasks = true);
   void pushShutdownTask();
   NodeTask pop();
+  // Non-blocking pop used by CPU work stealing (see Note [CPU work stealing]
+  // in engine.cpp). If only_runnable is true, only returns tasks with a
+  // function to run, leaving shutdown and wake-up sentinel tasks for the
+  // queue's owner.
+  c10::optional<NodeTask> pop_nowait(bool only_runnable);
   bool empty() const;
   size_t size() const;
 };
@@ -195,6 +200,28 @@ struct TORCH_API Engine {
 
   bool is_checkpoint_valid();
 
+  // CPU work stealing: when enabled, threads draining a CPU ready queue that
+  // run dry opportunistically steal runnable NodeTasks from other live CPU
+  // ready queues, so wide CPU-heavy backward graphs (and concurrent backward
+  // calls) scale past one core. Device queues are never stolen from, keeping
+  // stream semantics for device nodes intact. See Note [CPU work stealing].
+  static void set_cpu_work_stealing_enabled(bool enabled);
+  static bool cpu_work_stealing_enabled();
+  // Cumulative number of stolen tasks, for monitoring.
+  static uint64_t cpu_steal_count();
+
+  // Graph topology cache: when enabled, the per-node dependency counts that
+  // compute_dependencies builds are cached per root node and reused on later
+  // backward calls over the same graph (validated with a hash of the full
+  // node/edge structure, so any graph change falls back to the full
+  // computation). Cuts backward launch overhead when the same graph is
+  // replayed, e.g. retain_graph or repeated .grad() calls. See
+  // Note [Graph topology cache] in engine.cpp.
+  static void set_graph_topology_cache_enabled(bool enabled);
+  static bool graph_topology_cache_enabled();
+  // Cumulative number of cache hits, for monitoring.
+  static uint64_t graph_topology_cache_hits();
+
   // Should be called after fork to notify that worker threads are gone
   void release_workers();
 
@@ -1,6 +1,9 @@
 #include <torch/csrc/autograd/functions/accumulate_grad.h>
 
+#include <ATen/Parallel.h>
 #include <ATen/core/dispatch/Dispatcher.h>
+#include <ATen/cpu/vec/vec.h>
+#include <c10/util/irange.h>
 #include <torch/csrc/autograd/functions/basic_ops.h>
 #include <torch/csrc/autograd/functions/tensor.h>
 #include <torch/csrc/autograd/functions/utils.h>
@@ -66,6 +69,116 @@ auto AccumulateGrad::apply(variable_list&& grads) -> variable_list {
   return variable_list();
 }
 
+namespace {
+
+bool fast_path_eligible(const at::Tensor& t) {
+  if (!t.device().is_cpu() || t.layout() != at::kStrided ||
+      !t.is_contiguous() || t.is_conj() || t.is_neg() || t._is_zerotensor()) {
+    return false;
+  }
+  // Wrapper subclasses (tensors made via _make_wrapper_subclass, functorch's
+  // batched tensors, ...) also report CPU/strided/contiguous, but must go
+  // through the dispatcher: a storage-less wrapper throws in data_ptr(), and
+  // one that does own storage would have its __torch_dispatch__/batching
+  // semantics silently bypassed by a raw pointer add. Only plain dense CPU
+  // tensors may take the raw-pointer path.
+  if (!t.unsafeGetTensorImpl()->has_storage()) {
+    return false;
+  }
+  constexpr auto plain_cpu_keys = c10::DispatchKeySet(
+      {c10::DispatchKey::CPU,
+       c10::DispatchKey::AutogradCPU,
+       c10::DispatchKey::ADInplaceOrView});
+  return (t.key_set() - plain_cpu_keys).empty();
+}
+
+// dst += src over contiguous buffers of one dtype. Matches the numerics of
+// the dispatched add kernel: Vectorized<Half>/<BFloat16> arithmetic goes
+// through float internally, like the TensorIterator path does.
+template <typename scalar_t>
+void accumulate_contiguous(scalar_t* dst, const scalar_t* src, int64_t numel) {
+  using Vec = at::vec::Vectorized<scalar_t>;
+  at::parallel_for(
+      0, numel, at::internal::GRAIN_SIZE, [&](int64_t begin, int64_t end) {
+        int64_t i = begin;
+        for (; i + static_cast<int64_t>(Vec::size()) <= end; i += Vec::size()) {
+          auto sum = Vec::loadu(dst + i) + Vec::loadu(src + i);
+          sum.store(dst + i);
+        }
+        for (; i < end; i++) {
+          dst[i] += src[i];
+        }
+      });
+}
+
+// dst(float) += src(Half/BFloat16), fusing the upcast into the accumulation
+// pass instead of materializing a float copy of src first.
+template <typename src_t>
+void accumulate_into_float(float* dst, const src_t* src, int64_t numel) {
+  at::parallel_for(
+      0, numel, at::internal::GRAIN_SIZE, [&](int64_t begin, int64_t end) {
+        for (const auto i : c10::irange(begin, end)) {
+          dst[i] += static_cast<float>(src[i]);
+        }
+      });
+}
+
+} // namespace
+
+bool accumulate_grad_cpu_fast_path(
+    at::Tensor& variable_grad,
+    const at::Tensor& new_grad) {
+  if (!fast_path_eligible(variable_grad) || !fast_path_eligible(new_grad) ||
+      variable_grad.sizes() != new_grad.sizes()) {
+    return false;
+  }
+  const auto numel = variable_grad.numel();
+  const auto dst_type = variable_grad.scalar_type();
+  const auto src_type = new_grad.scalar_type();
+  if (dst_type == src_type) {
+    switch (dst_type) {
+      case at::kFloat:
+        accumulate_contiguous(
+            variable_grad.data_ptr<float>(), new_grad.data_ptr<float>(), numel);
+        break;
+      case at::kDouble:
+        accumulate_contiguous(
+            variable_grad.data_ptr<double>(),
+            new_grad.data_ptr<double>(),
+            numel);
+        break;
+      case at::kHalf:
+        accumulate_contiguous(
+            variable_grad.data_ptr<at::Half>(),
+            new_grad.data_ptr<at::Half>(),
+            numel);
+        break;
+      case at::kBFloat16:
+        accumulate_contiguous(
+            variable_grad.data_ptr<at::BFloat16>(),
+            new_grad.data_ptr<at::BFloat16>(),
+            numel);
+        break;
+      default:
+        return false;
+    }
+  } else if (dst_type == at::kFloat && src_type == at::kHalf) {
+    accumulate_into_float(
+        variable_grad.data_ptr<float>(), new_grad.data_ptr<at::Half>(), numel);
+  } else if (dst_type == at::kFloat && src_type == at::kBFloat16) {
+    accumulate_into_float(
+        variable_grad.data_ptr<float>(),
+        new_grad.data_ptr<at::BFloat16>(),
+        numel);
+  } else {
+    return false;
+  }
+  // The in-place add it replaces would bump the version counter; keep that
+  // behavior so saved-variable checks still see the mutation.
+  variable_grad.unsafeGetTensorImpl()->bump_version();
+  return true;
+}
+
 void AccumulateGrad::compiled_args(CompiledNodeArgs& args) {
   if (args.cond(variable.defined() && variable.requires_grad())) {
     args.collect(variable);
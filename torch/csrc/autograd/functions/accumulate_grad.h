@@ -38,6 +38,18 @@ namespace autograd {
     }                                                                      \
   }
 
+// Accumulates new_grad into variable_grad in place without going through the
+// dispatcher or TensorIterator, for the common gradient-accumulation case:
+// both tensors are contiguous strided CPU tensors of the same shape with
+// matching floating dtypes, or a Half/BFloat16 new_grad accumulating into a
+// float variable_grad (master-grad setups), where the upcast is fused into
+// the same pass. Returns false (leaving variable_grad untouched) whenever the
+// tensors don't qualify, in which case the caller must fall back to
+// `variable_grad += new_grad`. Defined in accumulate_grad.cpp.
+TORCH_API bool accumulate_grad_cpu_fast_path(
+    at::Tensor& variable_grad,
+    const at::Tensor& new_grad);
+
 struct TORCH_API AccumulateGrad : public Node {
   explicit AccumulateGrad(Variable variable_);
 
@@ -215,7 +227,9 @@ struct TORCH_API AccumulateGrad : public Node {
         // work correctly if it is mutated out of place here, but DDP will
         // maintain one extra copy of grad tensors in buffer and thus
         // increase peak memory usage.
-        variable_grad += new_grad;
+        if (!accumulate_grad_cpu_fast_path(variable_grad, new_grad)) {
+          variable_grad += new_grad;
+        }
         CHECK_RESULT(variable_grad, variable);
         // ^ We could enforce the contract more aggressively here by writing:
         // if (variable_grad.is_sparse() || new_grad.is_sparse()) {
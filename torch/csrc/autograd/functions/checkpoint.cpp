@@ -0,0 +1,209 @@
+#include <torch/csrc/autograd/functions/checkpoint.h>
+
+#include <torch/csrc/autograd/autograd.h>
+#include <torch/csrc/autograd/grad_mode.h>
+#include <torch/csrc/autograd/functions/utils.h>
+
+#include <ATen/Context.h>
+#include <ATen/autocast_mode.h>
+#include <c10/util/irange.h>
+
+#include <mutex>
+
+namespace torch {
+namespace autograd {
+
+namespace {
+
+at::Tensor capture_generator_state(c10::Device device) {
+  auto gen = at::globalContext().defaultGenerator(device);
+  std::lock_guard<std::mutex> lock(gen.mutex());
+  return gen.get_state();
+}
+
+void restore_generator_state(c10::Device device, const at::Tensor& state) {
+  auto gen = at::globalContext().defaultGenerator(device);
+  std::lock_guard<std::mutex> lock(gen.mutex());
+  gen.set_state(state);
+}
+
+} // namespace
+
+CheckpointRecompute::CheckpointRecompute(
+    checkpoint_fn fn,
+    const variable_list& inputs)
+    : fn_(std::move(fn)),
+      autocast_gpu_enabled_(at::autocast::is_enabled()),
+      autocast_cpu_enabled_(at::autocast::is_cpu_enabled()),
+      autocast_gpu_dtype_(at::autocast::get_autocast_gpu_dtype()),
+      autocast_cpu_dtype_(at::autocast::get_autocast_cpu_dtype()),
+      autocast_cache_enabled_(at::autocast::is_autocast_cache_enabled()) {
+  saved_inputs_.reserve(inputs.size());
+  input_requires_grad_.reserve(inputs.size());
+  for (const auto& var : inputs) {
+    saved_inputs_.emplace_back(var, /*is_output=*/false);
+    input_requires_grad_.push_back(var.defined() && var.requires_grad());
+  }
+
+  rng_states_.emplace_back(
+      c10::Device(c10::kCPU), capture_generator_state(c10::kCPU));
+  for (const auto& var : inputs) {
+    if (!var.defined() || !var.is_cuda()) {
+      continue;
+    }
+    const auto device = var.device();
+    bool seen = false;
+    for (const auto& entry : rng_states_) {
+      if (entry.first == device) {
+        seen = true;
+        break;
+      }
+    }
+    if (!seen) {
+      rng_states_.emplace_back(device, capture_generator_state(device));
+    }
+  }
+}
+
+void CheckpointRecompute::release_variables() {
+  saved_inputs_.clear();
+  rng_states_.clear();
+  fn_ = nullptr;
+}
+
+variable_list CheckpointRecompute::apply(variable_list&& grads) {
+  TORCH_CHECK(
+      fn_ != nullptr,
+      "CheckpointRecompute: trying to recompute a checkpointed segment a "
+      "second time, but the saved state has been freed. Specify "
+      "retain_graph=True if you need to backward through it again.");
+
+  variable_list inputs;
+  inputs.reserve(saved_inputs_.size());
+  for (const auto i : c10::irange(saved_inputs_.size())) {
+    auto var = saved_inputs_[i].unpack();
+    if (var.defined()) {
+      // Detach from the outer graph; the recomputation builds a fresh local
+      // graph rooted at the inputs.
+      var = var.detach();
+      var.set_requires_grad(input_requires_grad_[i]);
+    }
+    inputs.push_back(std::move(var));
+  }
+
+  // Swap in the forward-time RNG and autocast state for the recomputation so
+  // stochastic ops (dropout etc.) and mixed-precision casts replay exactly,
+  // then put the ambient state back.
+  std::vector<std::pair<c10::Device, at::Tensor>> ambient_rng;
+  ambient_rng.reserve(rng_states_.size());
+  for (const auto& entry : rng_states_) {
+    ambient_rng.emplace_back(entry.first, capture_generator_state(entry.first));
+    restore_generator_state(entry.first, entry.second);
+  }
+  const bool prev_gpu_enabled = at::autocast::is_enabled();
+  const bool prev_cpu_enabled = at::autocast::is_cpu_enabled();
+  const auto prev_gpu_dtype = at::autocast::get_autocast_gpu_dtype();
+  const auto prev_cpu_dtype = at::autocast::get_autocast_cpu_dtype();
+  const bool prev_cache_enabled = at::autocast::is_autocast_cache_enabled();
+  at::autocast::set_enabled(autocast_gpu_enabled_);
+  at::autocast::set_cpu_enabled(autocast_cpu_enabled_);
+  at::autocast::set_autocast_gpu_dtype(autocast_gpu_dtype_);
+  at::autocast::set_autocast_cpu_dtype(autocast_cpu_dtype_);
+  at::autocast::set_autocast_cache_enabled(autocast_cache_enabled_);
+
+  variable_list outputs;
+  {
+    AutoGradMode grad_mode(true);
+    outputs = fn_(inputs);
+  }
+
+  at::autocast::set_enabled(prev_gpu_enabled);
+  at::autocast::set_cpu_enabled(prev_cpu_enabled);
+  at::autocast::set_autocast_gpu_dtype(prev_gpu_dtype);
+  at::autocast::set_autocast_cpu_dtype(prev_cpu_dtype);
+  at::autocast::set_autocast_cache_enabled(prev_cache_enabled);
+  for (const auto& entry : ambient_rng) {
+    restore_generator_state(entry.first, entry.second);
+  }
+
+  TORCH_CHECK(
+      outputs.size() == grads.size(),
+      "checkpointed function produced ",
+      outputs.size(),
+      " outputs on recomputation, expected ",
+      grads.size());
+
+  variable_list diff_outputs;
+  variable_list grad_outputs;
+  for (const auto i : c10::irange(outputs.size())) {
+    if (outputs[i].defined() && outputs[i].requires_grad() &&
+        grads[i].defined()) {
+      diff_outputs.push_back(outputs[i]);
+      grad_outputs.push_back(grads[i]);
+    }
+  }
+  variable_list diff_inputs;
+  for (const auto& var : inputs) {
+    if (var.defined() && var.requires_grad()) {
+      diff_inputs.push_back(var);
+    }
+  }
+  TORCH_CHECK(
+      !diff_outputs.empty(),
+      "none of the recomputed outputs of the checkpointed function requires "
+      "grad; the segment does not depend on its differentiable inputs");
+
+  // Reentrant backward over the freshly built local graph.  create_graph is
+  // intentionally false: like torch.utils.checkpoint, double backward
+  // through a checkpointed segment is not supported.
+  auto grad_inputs = torch::autograd::grad(
+      diff_outputs,
+      diff_inputs,
+      grad_outputs,
+      /*retain_graph=*/false,
+      /*create_graph=*/false,
+      /*allow_unused=*/true);
+
+  variable_list results(saved_inputs_.size());
+  size_t next = 0;
+  for (const auto i : c10::irange(saved_inputs_.size())) {
+    if (input_requires_grad_[i]) {
+      results[i] = grad_inputs[next++];
+    }
+  }
+  return results;
+}
+
+variable_list checkpoint(checkpoint_fn fn, const variable_list& inputs) {
+  TORCH_CHECK(fn != nullptr, "checkpoint: expected a callable");
+
+  // Capture RNG/autocast state before the forward run consumes it.
+  std::shared_ptr<CheckpointRecompute> node;
+  if (compute_requires_grad(inputs)) {
+    node = std::make_shared<CheckpointRecompute>(fn, inputs);
+  }
+
+  variable_list outputs;
+  {
+    AutoGradMode grad_mode(false);
+    outputs = fn(inputs);
+  }
+  if (!node) {
+    return outputs;
+  }
+
+  node->set_next_edges(collect_next_edges(inputs));
+  for (auto& output : outputs) {
+    if (output.defined() && isDifferentiableType(output.scalar_type())) {
+      set_history(output, node);
+    } else {
+      // Keep input-metadata indices aligned with output positions so the
+      // grads seen by apply() match the recomputed outputs one-to-one.
+      node->add_input_metadata(Node::undefined_input());
+    }
+  }
+  return outputs;
+}
+
+} // namespace autograd
+} // namespace torch
@@ -0,0 +1,61 @@
+#pragma once
+
+#include <torch/csrc/Export.h>
+#include <torch/csrc/autograd/function.h>
+#include <torch/csrc/autograd/saved_variable.h>
+#include <torch/csrc/autograd/variable.h>
+
+#include <ATen/core/Tensor.h>
+
+#include <functional>
+#include <utility>
+#include <vector>
+
+namespace torch {
+namespace autograd {
+
+using checkpoint_fn = std::function<variable_list(const variable_list&)>;
+
+// Backward node for native activation checkpointing.  The forward pass runs
+// the checkpointed callable with grad disabled and only this node (holding
+// the inputs as SavedVariables plus the RNG and autocast state in effect at
+// forward time) is kept; during backward the callable is re-run entirely in
+// C++ with grad enabled, under the captured RNG/autocast state, and the
+// input gradients are obtained by differentiating the recomputed segment.
+struct TORCH_API CheckpointRecompute : public Node {
+  // Captures RNG/autocast state; must be constructed before the forward run
+  // of `fn` so recomputation starts from the same generator state.
+  CheckpointRecompute(checkpoint_fn fn, const variable_list& inputs);
+
+  variable_list apply(variable_list&& grads) override;
+
+  std::string name() const override {
+    return "CheckpointRecompute";
+  }
+
+  void release_variables() override;
+
+ private:
+  checkpoint_fn fn_;
+  std::vector<SavedVariable> saved_inputs_;
+  std::vector<bool> input_requires_grad_;
+  // Default generator states (CPU first, then each distinct CUDA device
+  // appearing in the inputs) captured before the forward run.
+  std::vector<std::pair<c10::Device, at::Tensor>> rng_states_;
+  bool autocast_gpu_enabled_;
+  bool autocast_cpu_enabled_;
+  at::ScalarType autocast_gpu_dtype_;
+  at::ScalarType autocast_cpu_dtype_;
+  bool autocast_cache_enabled_;
+};
+
+/// Runs `fn` on `inputs` without recording an autograd graph, keeping only
+/// the inputs and enough ambient state to re-run it.  The gradient of every
+/// differentiable output is computed during backward by recomputing the
+/// segment in C++, avoiding both the memory for intermediate activations and
+/// the Python interpreter overhead of torch.utils.checkpoint.
+TORCH_API variable_list
+checkpoint(checkpoint_fn fn, const variable_list& inputs);
+
+} // namespace autograd
+} // namespace torch
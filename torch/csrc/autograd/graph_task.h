@@ -35,6 +35,46 @@ struct GraphTask : std::enable_shared_from_this<GraphTask> {
   std::unordered_map<Node*, InputBuffer> not_ready_;
   std::unordered_map<Node*, int> dependencies_;
 
+  // Recycles the variable_list storage behind InputBuffers so that the
+  // backward hot path (one InputBuffer per graph edge, one output list per
+  // node) stops hammering the global allocator. Buffers keep their capacity
+  // across reuse and everything in the pool dies with the GraphTask, so no
+  // storage outlives the backward pass that allocated it.
+  class InputBufferPool {
+   public:
+    // Returns a default-initialized list of `size` variables, reusing the
+    // capacity of a previously released list when one is available.
+    std::vector<Variable> acquire(size_t size) {
+      std::vector<Variable> buffer;
+      {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (!free_.empty()) {
+          buffer = std::move(free_.back());
+          free_.pop_back();
+        }
+      }
+      buffer.clear();
+      buffer.resize(size);
+      return buffer;
+    }
+
+    // Hands a consumed list's storage back to the pool. Elements are
+    // destroyed outside the pool lock; only the raw capacity is retained.
+    void release(std::vector<Variable>&& buffer) {
+      buffer.clear();
+      std::lock_guard<std::mutex> lock(mutex_);
+      if (free_.size() < kMaxPooledBuffers) {
+        free_.emplace_back(std::move(buffer));
+      }
+    }
+
+   private:
+    static constexpr size_t kMaxPooledBuffers = 64;
+    std::mutex mutex_;
+    std::vector<std::vector<Variable>> free_;
+  };
+  InputBufferPool input_buffer_pool_;
+
   // Records the nodes that are in the graph
   std::unordered_set<Node*> nodes_in_graph_;
   c10::SmallVector<Node*, 4> graph_roots_;
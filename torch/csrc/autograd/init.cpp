@@ -12,6 +12,7 @@
 #include <c10/core/impl/PythonDispatcherTLS.h>
 #include <torch/csrc/Exceptions.h>
 #include <torch/csrc/autograd/VariableTypeUtils.h>
+#include <torch/csrc/autograd/activation_offload.h>
 #include <torch/csrc/autograd/autograd.h>
 #include <torch/csrc/autograd/autograd_not_implemented_fallback.h>
 #include <torch/csrc/autograd/function.h>
@@ -366,6 +367,10 @@ PyObject* THPAutograd_initExtension(PyObject* _unused, PyObject* unused) {
     vc.set_version(i);
   });
 
+  m.def("_inference_tensor_fast_path_count", []() {
+    return c10::InferenceMode::tensor_fast_path_count();
+  });
+
   m.def("_enable_profiler_legacy", enableProfilerLegacy);
   py::class_<ProfilerDisableOptions>(m, "_ProfilerDisableOptions")
       .def(py::init<bool, bool>());
@@ -397,6 +402,20 @@ PyObject* THPAutograd_initExtension(PyObject* _unused, PyObject* unused) {
   m.def(
       "_saved_tensors_hooks_get_disabled_error_message",
       at::SavedTensorDefaultHooks::get_disabled_error_message);
+  m.def(
+      "_activation_offload_set_enabled",
+      torch::autograd::setActivationOffloadEnabled);
+  m.def(
+      "_activation_offload_is_enabled",
+      torch::autograd::isActivationOffloadEnabled);
+  m.def(
+      "_activation_offload_set_policy",
+      [](size_t min_tensor_nbytes, size_t prefetch_watermark_nbytes) {
+        torch::autograd::ActivationOffloadPolicy policy;
+        policy.min_tensor_nbytes = min_tensor_nbytes;
+        policy.prefetch_watermark_nbytes = prefetch_watermark_nbytes;
+        torch::autograd::setActivationOffloadPolicy(policy);
+      });
   m.def(
       "_push_saved_tensors_default_hooks",
       [](py::function& pack_hook, py::function& unpack_hook) {
@@ -717,6 +736,26 @@ static PyObject* set_autocast_cache_enabled(PyObject* _unused, PyObject* arg) {
   END_HANDLE_TH_ERRORS
 }
 
+static PyObject* is_autocast_frozen(PyObject* _unused, PyObject* arg) {
+  HANDLE_TH_ERRORS
+  if (at::autocast::is_autocast_frozen()) {
+    Py_RETURN_TRUE;
+  } else {
+    Py_RETURN_FALSE;
+  }
+  END_HANDLE_TH_ERRORS
+}
+
+static PyObject* set_autocast_frozen(PyObject* _unused, PyObject* arg) {
+  HANDLE_TH_ERRORS
+  if (!PyBool_Check(arg)) {
+    throw TypeError("frozen must be a bool (got %s)", Py_TYPE(arg)->tp_name);
+  }
+  at::autocast::set_autocast_frozen(arg == Py_True);
+  Py_RETURN_NONE;
+  END_HANDLE_TH_ERRORS
+}
+
 static PyObject* set_grad_enabled(
     PyObject* _unused,
     PyObject* args,
@@ -1161,6 +1200,8 @@ static PyMethodDef methods[] = { // NOLINT
      METH_NOARGS,
      nullptr},
     {"set_autocast_cache_enabled", set_autocast_cache_enabled, METH_O, nullptr},
+    {"_is_autocast_frozen", is_autocast_frozen, METH_NOARGS, nullptr},
+    {"_set_autocast_frozen", set_autocast_frozen, METH_O, nullptr},
     {"_increment_version", THPModule_increment_version, METH_O, nullptr},
     {"set_anomaly_enabled",
      castPyCFunctionWithKeywords(set_anomaly_mode_enabled),
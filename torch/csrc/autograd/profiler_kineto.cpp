@@ -14,6 +14,7 @@
 #include <torch/csrc/profiler/containers.h>
 #include <torch/csrc/profiler/events.h>
 #include <torch/csrc/profiler/kineto_shim.h>
+#include <torch/csrc/profiler/op_stats.h>
 #include <torch/csrc/profiler/orchestration/observer.h>
 #include <torch/csrc/profiler/perf.h>
 #include <torch/csrc/profiler/standalone/itt_observer.h>
@@ -385,6 +386,11 @@ struct KinetoThreadLocalState : public ProfilerStateBase {
 
     materializeOpEvents(records_and_trace.first);
 
+    // Fold the finalized events into the rolling per-op counters (no-op
+    // unless aggregation has been enabled).
+    torch::profiler::impl::OpStatsAggregator::get().consume(
+        records_and_trace.first);
+
     // `kineto_events_` does not include Python events. Instead it exposes them
     // via the `stacks` property.
     kineto_events_.erase(
@@ -457,7 +463,12 @@ void onFunctionExit(
   const auto& config = state_ptr->config();
   auto* kineto_ctx_ptr =
       static_cast<torch::profiler::impl::KinetoObserverContext*>(ctx_ptr);
-  TORCH_INTERNAL_ASSERT(kineto_ctx_ptr != nullptr);
+  if (kineto_ctx_ptr == nullptr) {
+    // The op was skipped by op sampling mode (see
+    // ThreadLocalSubqueue::begin_op), so there is nothing to finalize and no
+    // correlation id to pop.
+    return;
+  }
   kineto_ctx_ptr->event_->end_time_ = c10::getApproximateTime();
   if (!config.experimental_config.performance_events.empty()) {
     state_ptr->record_queue_.getSubqueue()->disable_perf_profiler(
@@ -1,5 +1,6 @@
 #include <torch/csrc/autograd/saved_variable.h>
 
+#include <torch/csrc/autograd/activation_offload.h>
 #include <torch/csrc/autograd/anomaly_mode.h>
 #include <torch/csrc/autograd/edge.h>
 #include <torch/csrc/autograd/engine.h>
@@ -109,7 +110,12 @@ void SavedVariable::save_metadata(const Variable& data) {
 }
 
 std::unique_ptr<SavedVariableHooks> SavedVariable::get_default_hooks() {
-  return Engine::get_default_engine().get_default_saved_variable_hooks();
+  auto hooks = Engine::get_default_engine().get_default_saved_variable_hooks();
+  if (hooks) {
+    return hooks;
+  }
+  // User saved-tensor hooks take precedence over the offload engine.
+  return getActivationOffloadHooks();
 }
 
 void SavedVariable::reset_data() {
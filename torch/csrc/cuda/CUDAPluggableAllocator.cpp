@@ -349,6 +349,32 @@ createCustomAllocator(
   return allocator;
 }
 
+static void* managed_raw_alloc(size_t size, int device, cudaStream_t stream) {
+  void* ptr = nullptr;
+  C10_CUDA_CHECK(cudaMallocManaged(&ptr, size, cudaMemAttachGlobal));
+  // Keep the pages on the allocating device while there is room, and let
+  // the CPU map them in place instead of forcing migrations when the
+  // device is oversubscribed.
+  C10_CUDA_CHECK(
+      cudaMemAdvise(ptr, size, cudaMemAdviseSetPreferredLocation, device));
+  C10_CUDA_CHECK(
+      cudaMemAdvise(ptr, size, cudaMemAdviseSetAccessedBy, cudaCpuDeviceId));
+  return ptr;
+}
+
+static void managed_raw_delete(
+    void* ptr,
+    size_t size,
+    int device,
+    cudaStream_t stream) {
+  C10_CUDA_CHECK(cudaFree(ptr));
+}
+
+std::shared_ptr<c10::cuda::CUDACachingAllocator::CUDAAllocator>
+createManagedAllocator() {
+  return createCustomAllocator(managed_raw_alloc, managed_raw_delete);
+}
+
 void changeCurrentAllocator(
     const std::shared_ptr<c10::cuda::CUDACachingAllocator::CUDAAllocator>&
         allocator) {
@@ -24,6 +24,12 @@ std::shared_ptr<c10::cuda::CUDACachingAllocator::CUDAAllocator>
 createCustomAllocator(
     std::function<void*(size_t, int, cudaStream_t)> alloc_fn,
     std::function<void(void*, size_t, int, cudaStream_t)> free_fn);
+// An allocator backed by cudaMallocManaged, for serving models that
+// oversubscribe device memory. Allocations prefer device residency but
+// remain CPU-accessible, so the driver pages cold data to the host instead
+// of failing; pair with cudaMemPrefetchAsync to stream data in ahead of use.
+std::shared_ptr<c10::cuda::CUDACachingAllocator::CUDAAllocator>
+createManagedAllocator();
 void changeCurrentAllocator(
     const std::shared_ptr<c10::cuda::CUDACachingAllocator::CUDAAllocator>&
         allocator);
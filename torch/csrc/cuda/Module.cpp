@@ -17,6 +17,7 @@
 #endif
 #include <ATen/cuda/CUDAContext.h>
 #include <ATen/cuda/CUDAGeneratorImpl.h>
+#include <ATen/cuda/CUDAStreamScheduler.h>
 #include <ATen/cuda/CachingHostAllocator.h>
 #include <ATen/cuda/Sleep.h>
 #include <ATen/cuda/detail/CUDAHooks.h>
@@ -31,6 +32,7 @@
 #include <torch/csrc/cuda/python_nccl.h>
 #endif
 #include <c10/util/CallOnce.h>
+#include <c10/util/env.h>
 #include <c10/util/irange.h>
 
 #include <torch/csrc/CudaIPCTypes.h>
@@ -38,6 +40,7 @@
 #include <torch/csrc/cuda/CUDAPluggableAllocator.h>
 #include <torch/csrc/cuda/THCP.h>
 #include <torch/csrc/cuda/memory_snapshot.h>
+#include <torch/csrc/cuda/memory_watermarks.h>
 #include <torch/csrc/cuda/python_comm.h>
 #include <torch/csrc/profiler/python/combined_traceback.h>
 #include <torch/csrc/python_headers.h>
@@ -1092,6 +1095,39 @@ static void registerCudaPluggableAllocator(PyObject* module) {
         malloc_fn, free_fn);
   });
 
+  m.def("_cuda_createManagedAllocator", []() {
+    return torch::cuda::CUDAPluggableAllocator::createManagedAllocator();
+  });
+
+  // Prefetches a managed-memory range to the given device (-1 prefetches
+  // back to host memory) on that device's current stream, so oversubscribed
+  // models can stream cold layers in ahead of use instead of faulting.
+  m.def(
+      "_cuda_memPrefetchAsync",
+      [](uint64_t data_ptr, uint64_t nbytes, int device) {
+        const int dst_device = device >= 0 ? device : cudaCpuDeviceId;
+        const auto stream =
+            at::cuda::getCurrentCUDAStream(device >= 0 ? device : -1);
+        C10_CUDA_CHECK(cudaMemPrefetchAsync(
+            // NOLINTNEXTLINE(performance-no-int-to-ptr)
+            reinterpret_cast<void*>(data_ptr),
+            nbytes,
+            dst_device,
+            stream));
+      });
+
+  // See Note [Eager stream scheduler] in
+  // aten/src/ATen/cuda/CUDAStreamScheduler.cpp.
+  m.def("_cuda_enableStreamScheduler", [](int64_t num_streams) {
+    at::cuda::enableStreamScheduler(num_streams);
+  });
+  m.def("_cuda_disableStreamScheduler", []() {
+    at::cuda::disableStreamScheduler();
+  });
+  m.def("_cuda_isStreamSchedulerEnabled", []() {
+    return at::cuda::isStreamSchedulerEnabled();
+  });
+
   py::class_<
       c10::cuda::CUDACachingAllocator::AllocatorState,
       std::shared_ptr<c10::cuda::CUDACachingAllocator::AllocatorState>>(
@@ -1270,6 +1306,9 @@ static PyObject* THCPModule_initExtension(PyObject* self, PyObject* noargs) {
   TORCH_INTERNAL_ASSERT(!in_bad_fork); // Handled at python level
   poison_fork();
   at::globalContext().lazyInitCUDA();
+  if (c10::utils::check_env("TORCH_CUDA_MEMORY_WATERMARKS") == true) {
+    torch::cuda::_enable_memory_watermarks();
+  }
 
   auto m = THPObjectPtr(PyImport_ImportModule("torch.cuda"));
   if (!m)
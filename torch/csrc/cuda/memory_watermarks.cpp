@@ -0,0 +1,190 @@
+#include <ATen/Context.h>
+#include <ATen/record_function.h>
+#include <c10/cuda/CUDACachingAllocator.h>
+#include <torch/csrc/cuda/memory_watermarks.h>
+
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+#include <sstream>
+#include <unordered_map>
+#include <vector>
+
+namespace torch::cuda {
+
+using c10::cuda::CUDACachingAllocator::format_size;
+using c10::cuda::CUDACachingAllocator::TraceEntry;
+
+namespace {
+
+struct OpEntry {
+  int64_t live_bytes = 0;
+  int64_t peak_live_bytes = 0;
+  int64_t total_allocated_bytes = 0;
+  int64_t allocation_count = 0;
+};
+
+struct LiveAllocation {
+  OpEntry* op; // node-stable pointer into WatermarkState::per_op
+  int64_t size;
+};
+
+struct WatermarkState {
+  std::mutex mutex;
+  // Keyed by RecordFunction name. unordered_map keeps OpEntry addresses
+  // stable across rehashes, so live allocations can point straight at
+  // their owner's counters.
+  std::unordered_map<std::string, OpEntry> per_op;
+  // Outstanding allocations by device pointer, for attributing frees.
+  std::unordered_map<int64_t, LiveAllocation> live;
+};
+
+WatermarkState& state() {
+  static WatermarkState s;
+  return s;
+}
+
+std::atomic<bool> watermarks_enabled{false};
+
+// Ops currently running on this thread, innermost last. Caching-allocator
+// allocations are synchronous, so the top of the stack is the op that asked
+// for the memory.
+thread_local std::vector<std::string> op_stack;
+
+std::unique_ptr<at::ObserverContext> onOpEnter(const at::RecordFunction& fn) {
+  op_stack.emplace_back(fn.name());
+  return nullptr;
+}
+
+void onOpExit(const at::RecordFunction& /* fn */, at::ObserverContext*) {
+  // The callback can be installed while ops are already running, so the
+  // first exits on a thread may have no matching entry.
+  if (!op_stack.empty()) {
+    op_stack.pop_back();
+  }
+}
+
+// Runs with the per-device allocator lock held: only the leaf state mutex
+// may be taken here, and the allocator must not be re-entered.
+void onTraceEntry(const TraceEntry& entry) {
+  auto& s = state();
+  switch (entry.action_) {
+    case TraceEntry::ALLOC: {
+      static const std::string kUnattributed = "[unattributed]";
+      const std::string& name =
+          op_stack.empty() ? kUnattributed : op_stack.back();
+      std::lock_guard<std::mutex> guard(s.mutex);
+      OpEntry& op = s.per_op[name];
+      op.live_bytes += entry.size_;
+      op.peak_live_bytes = std::max(op.peak_live_bytes, op.live_bytes);
+      op.total_allocated_bytes += entry.size_;
+      op.allocation_count += 1;
+      s.live[entry.addr_] = {&op, entry.size_};
+      break;
+    }
+    case TraceEntry::FREE_COMPLETED: {
+      std::lock_guard<std::mutex> guard(s.mutex);
+      auto it = s.live.find(entry.addr_);
+      // Allocations made before the tracker was attached are not in the
+      // table; their frees are dropped on the floor.
+      if (it != s.live.end()) {
+        it->second.op->live_bytes -= it->second.size;
+        s.live.erase(it);
+      }
+      break;
+    }
+    default:
+      // Segment traffic, snapshots and OOM events carry no op attribution.
+      break;
+  }
+}
+
+// Runs after the allocator lock has been released, right before the
+// OutOfMemoryError is thrown.
+void onOutOfMemory(
+    int64_t device,
+    int64_t alloc_size,
+    int64_t device_total,
+    int64_t device_free) {
+  TORCH_WARN(
+      "CUDA out of memory on device ",
+      device,
+      ": tried to allocate ",
+      format_size(alloc_size),
+      " with ",
+      format_size(device_free),
+      " free of ",
+      format_size(device_total),
+      ".\n",
+      _memory_watermark_report());
+}
+
+} // namespace
+
+void _enable_memory_watermarks() {
+  static std::once_flag once;
+  std::call_once(once, []() {
+    // Trace trackers attach to the per-device allocators, which only exist
+    // once the allocator has been initialized.
+    at::globalContext().lazyInitCUDA();
+    at::addGlobalCallback(at::RecordFunctionCallback(&onOpEnter, &onOpExit));
+    c10::cuda::CUDACachingAllocator::attachAllocatorTraceTracker(
+        &onTraceEntry);
+    c10::cuda::CUDACachingAllocator::attachOutOfMemoryObserver(&onOutOfMemory);
+    watermarks_enabled.store(true);
+  });
+}
+
+bool _memory_watermarks_enabled() {
+  return watermarks_enabled.load();
+}
+
+std::vector<OpMemoryStats> _memory_watermarks() {
+  auto& s = state();
+  std::vector<OpMemoryStats> result;
+  {
+    std::lock_guard<std::mutex> guard(s.mutex);
+    result.reserve(s.per_op.size());
+    for (const auto& kv : s.per_op) {
+      result.push_back(
+          {kv.first,
+           kv.second.live_bytes,
+           kv.second.peak_live_bytes,
+           kv.second.total_allocated_bytes,
+           kv.second.allocation_count});
+    }
+  }
+  std::sort(
+      result.begin(), result.end(), [](const auto& a, const auto& b) {
+        return a.peak_live_bytes > b.peak_live_bytes;
+      });
+  return result;
+}
+
+std::string _memory_watermark_report(size_t limit) {
+  auto stats = _memory_watermarks();
+  std::ostringstream ss;
+  if (!watermarks_enabled.load()) {
+    ss << "CUDA memory watermark tracking is disabled; set "
+          "TORCH_CUDA_MEMORY_WATERMARKS=1 or call "
+          "torch::cuda::_enable_memory_watermarks() to record per-op "
+          "allocator activity.";
+    return ss.str();
+  }
+  ss << "CUDA memory high-watermarks by op (top " << std::min(limit, stats.size())
+     << " of " << stats.size() << "):";
+  size_t shown = 0;
+  for (const auto& op : stats) {
+    if (shown++ == limit) {
+      break;
+    }
+    ss << "\n  " << op.op_name << ": peak "
+       << format_size(static_cast<uint64_t>(op.peak_live_bytes)) << ", live "
+       << format_size(static_cast<uint64_t>(op.live_bytes)) << ", "
+       << format_size(static_cast<uint64_t>(op.total_allocated_bytes))
+       << " over " << op.allocation_count << " allocations";
+  }
+  return ss.str();
+}
+
+} // namespace torch::cuda
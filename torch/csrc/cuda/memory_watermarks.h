@@ -0,0 +1,40 @@
+#pragma once
+
+#include <torch/csrc/Export.h>
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace torch::cuda {
+
+// Aggregate CUDA caching-allocator activity attributed to one op
+// (RecordFunction name).
+struct OpMemoryStats {
+  std::string op_name;
+  // Bytes allocated under the op that have not been freed yet.
+  int64_t live_bytes = 0;
+  // High watermark of live_bytes.
+  int64_t peak_live_bytes = 0;
+  int64_t total_allocated_bytes = 0;
+  int64_t allocation_count = 0;
+};
+
+// Starts attributing CUDA caching-allocator traffic to the innermost op
+// running on the allocating thread, and logs the top contributors when the
+// allocator throws an OutOfMemoryError. Unlike _record_memory_history this
+// keeps no per-allocation history or stack traces, only per-op counters, so
+// it is cheap enough to leave on in production. Idempotent; there is no way
+// to detach allocator trace trackers, so the tracker cannot be disabled
+// again. Set TORCH_CUDA_MEMORY_WATERMARKS=1 to enable it at startup.
+TORCH_CUDA_CU_API void _enable_memory_watermarks();
+TORCH_CUDA_CU_API bool _memory_watermarks_enabled();
+
+// Per-op table, ordered by descending peak_live_bytes.
+TORCH_CUDA_CU_API std::vector<OpMemoryStats> _memory_watermarks();
+
+// Human-readable top-`limit` slice of the table; this is what gets logged
+// on OOM.
+TORCH_CUDA_CU_API std::string _memory_watermark_report(size_t limit = 10);
+
+} // namespace torch::cuda
@@ -3,8 +3,11 @@
 #include <shared_mutex>
 
 #include <ATen/ATen.h>
+#include <ATen/core/dispatch/Dispatcher.h>
 #include <ATen/core/op_registration/op_registration.h>
 #include <c10/core/DispatchKey.h>
+#include <c10/util/irange.h>
+#include <torch/csrc/autograd/custom_function.h>
 #include <torch/csrc/autograd/function.h>
 #include <torch/csrc/distributed/c10d/GroupRegistry.hpp>
 #include <torch/csrc/distributed/c10d/ProcessGroup.hpp>
@@ -203,6 +206,187 @@ at::Tensor wait_tensor(const at::Tensor& tensor) {
   return tensor;
 }
 
+// Fused all-gather + linear for tensor parallelism. Computes
+//
+//   gathered = all_gather_into_tensor(input)
+//   output = gathered @ weight.t() + bias
+//
+// but splits `input` into `num_chunks` row chunks and enqueues all chunk
+// all-gathers up front, so the backend transfers chunk i+1 while the matmul
+// of chunk i runs on the compute stream. The sequential version exposes the
+// full all-gather latency before the first GEMM can start; here only the
+// first chunk's transfer is exposed.
+//
+// `weight` is the local shard of a column-parallel weight, so no collective
+// is needed for its gradient. Both outputs are returned: `gathered` is what
+// the backward pass needs for grad_weight and callers often want it anyway.
+std::tuple<at::Tensor, at::Tensor> fused_linear_all_gather(
+    const at::Tensor& input,
+    const at::Tensor& weight,
+    const c10::optional<at::Tensor>& bias,
+    const int64_t group_size,
+    const std::string& group_name,
+    int64_t num_chunks) {
+  TORCH_CHECK(
+      input.dim() == 2 && weight.dim() == 2,
+      "fused_linear_all_gather expects 2D input and weight, got ",
+      input.dim(),
+      "D and ",
+      weight.dim(),
+      "D");
+  TORCH_CHECK(
+      input.size(1) == weight.size(1),
+      "fused_linear_all_gather: input has ",
+      input.size(1),
+      " features but weight expects ",
+      weight.size(1));
+  TORCH_CHECK(
+      input.is_contiguous(), "fused_linear_all_gather expects contiguous input");
+  TORCH_CHECK(
+      num_chunks > 0, "num_chunks must be positive, got ", num_chunks);
+
+  auto group = c10d::resolve_process_group(group_name);
+  const int64_t n = input.size(0);
+  num_chunks = std::min(num_chunks, std::max<int64_t>(n, 1));
+
+  // Row chunks of a contiguous 2D tensor are contiguous, so each one can be
+  // gathered directly. All ranks derive the same chunk sizes from n.
+  auto input_chunks = input.chunk(num_chunks, 0);
+  std::vector<at::Tensor> gather_tmps;
+  std::vector<c10::intrusive_ptr<c10d::Work>> gather_works;
+  gather_tmps.reserve(input_chunks.size());
+  gather_works.reserve(input_chunks.size());
+  for (auto& chunk : input_chunks) {
+    auto tmp = allocate_all_gather_output(chunk, group_size);
+    gather_works.push_back(group->_allgather_base(tmp, chunk));
+    gather_tmps.push_back(std::move(tmp));
+  }
+
+  auto gathered = allocate_all_gather_output(input, group_size);
+  auto output = at::empty(
+      {group_size * n, weight.size(0)},
+      at::TensorOptions().dtype(input.dtype()).device(input.device()));
+  auto weight_t = weight.t();
+
+  int64_t row = 0;
+  for (const auto c : c10::irange(input_chunks.size())) {
+    // Blocks the compute stream on the chunk's gather; the remaining
+    // gathers keep progressing on the backend's stream underneath the GEMM.
+    gather_works[c]->wait();
+    auto& tmp = gather_tmps[c];
+    const int64_t chunk_rows = input_chunks[c].size(0);
+    auto partial = bias.has_value() ? at::addmm(*bias, tmp, weight_t)
+                                    : at::mm(tmp, weight_t);
+    // The gather temp holds rank-major rows of this chunk; scatter them into
+    // the canonical all-gather row order (rank-major over full shards).
+    for (const auto r : c10::irange(group_size)) {
+      gathered.narrow(0, r * n + row, chunk_rows)
+          .copy_(tmp.narrow(0, r * chunk_rows, chunk_rows));
+      output.narrow(0, r * n + row, chunk_rows)
+          .copy_(partial.narrow(0, r * chunk_rows, chunk_rows));
+    }
+    row += chunk_rows;
+  }
+  return {output, gathered};
+}
+
+class FusedLinearAllGather
+    : public torch::autograd::Function<FusedLinearAllGather> {
+ public:
+  static torch::autograd::variable_list forward(
+      torch::autograd::AutogradContext* ctx,
+      const at::Tensor& input,
+      const at::Tensor& weight,
+      const c10::optional<at::Tensor>& bias,
+      int64_t group_size,
+      const std::string& group_name,
+      int64_t num_chunks) {
+    at::AutoDispatchBelowADInplaceOrView guard;
+    static auto op =
+        c10::Dispatcher::singleton()
+            .findSchemaOrThrow("_c10d_functional::fused_linear_all_gather", "")
+            .typed<std::tuple<at::Tensor, at::Tensor>(
+                const at::Tensor&,
+                const at::Tensor&,
+                const c10::optional<at::Tensor>&,
+                int64_t,
+                const std::string&,
+                int64_t)>();
+    auto [output, gathered] =
+        op.call(input, weight, bias, group_size, group_name, num_chunks);
+    ctx->save_for_backward({weight, gathered});
+    ctx->saved_data["group_size"] = group_size;
+    ctx->saved_data["group_name"] = group_name;
+    ctx->saved_data["has_bias"] = bias.has_value();
+    return {output, gathered};
+  }
+
+  static torch::autograd::variable_list backward(
+      torch::autograd::AutogradContext* ctx,
+      torch::autograd::variable_list grads) {
+    auto saved = ctx->get_saved_variables();
+    const auto& weight = saved[0];
+    const auto& gathered = saved[1];
+    const auto group_size = ctx->saved_data["group_size"].toInt();
+    const auto group_name = ctx->saved_data["group_name"].toStringRef();
+    const auto has_bias = ctx->saved_data["has_bias"].toBool();
+    const auto& grad_output = grads[0];
+    const auto& grad_gathered = grads[1];
+
+    // Gradient flowing back to the gathered activation, from the linear and
+    // from any direct use of the second output.
+    at::Tensor grad_full;
+    if (grad_output.defined()) {
+      grad_full = grad_output.mm(weight);
+      if (grad_gathered.defined()) {
+        grad_full.add_(grad_gathered);
+      }
+    } else if (grad_gathered.defined()) {
+      grad_full = grad_gathered.contiguous();
+    }
+
+    // Enqueue the reduce-scatter first so it overlaps the grad_weight GEMM.
+    at::Tensor grad_input;
+    c10::intrusive_ptr<c10d::Work> work;
+    if (grad_full.defined()) {
+      grad_input = allocate_reduce_scatter_output(grad_full, group_size);
+      auto group = c10d::resolve_process_group(group_name);
+      work = group->_reduce_scatter_base(grad_input, grad_full);
+    }
+
+    at::Tensor grad_weight;
+    at::Tensor grad_bias;
+    if (grad_output.defined()) {
+      grad_weight = grad_output.t().mm(gathered);
+      if (has_bias) {
+        grad_bias = grad_output.sum(0);
+      }
+    }
+    if (work) {
+      work->wait();
+    }
+    return {
+        grad_input,
+        grad_weight,
+        grad_bias,
+        at::Tensor(),
+        at::Tensor(),
+        at::Tensor()};
+  }
+};
+
+std::tuple<at::Tensor, at::Tensor> fused_linear_all_gather_autograd(
+    const at::Tensor& input,
+    const at::Tensor& weight,
+    const c10::optional<at::Tensor>& bias,
+    const int64_t group_size,
+    const std::string& group_name,
+    const int64_t num_chunks) {
+  auto results = FusedLinearAllGather::apply(
+      input, weight, bias, group_size, group_name, num_chunks);
+  return {results[0], results[1]};
+}
+
 } // namespace
 
 TORCH_LIBRARY(_c10d_functional, m) {
@@ -262,4 +446,14 @@ TORCH_LIBRARY(_c10d_functional, m) {
       torch::dispatch(
           c10::DispatchKey::CompositeExplicitAutograd, ::wait_tensor),
       {at::Tag::pt2_compliant_tag});
+
+  m.def(
+      "fused_linear_all_gather(Tensor input, Tensor weight, Tensor? bias, int group_size, str group_name, int num_chunks=4) -> (Tensor, Tensor)",
+      torch::dispatch(
+          c10::DispatchKey::CompositeExplicitAutograd,
+          ::fused_linear_all_gather));
+}
+
+TORCH_LIBRARY_IMPL(_c10d_functional, Autograd, m) {
+  m.impl("fused_linear_all_gather", ::fused_linear_all_gather_autograd);
 }
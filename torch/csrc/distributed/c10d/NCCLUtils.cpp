@@ -5,7 +5,11 @@
 
 #ifdef USE_C10D_NCCL
 
+#include <unistd.h>
+
+#include <functional>
 #include <mutex>
+#include <string>
 
 namespace c10d {
 
@@ -60,6 +64,17 @@ std::string getNcclVersion() {
   return versionString;
 }
 
+uint64_t getHostHash() {
+  char hostname[1024];
+  if (gethostname(hostname, sizeof(hostname)) != 0) {
+    // Treat a failed lookup as "unknown host"; callers fall back to the
+    // flat (non-hierarchical) path when hosts cannot be distinguished.
+    return 0;
+  }
+  hostname[sizeof(hostname) - 1] = '\0';
+  return std::hash<std::string>{}(std::string(hostname));
+}
+
 bool nccl_use_nonblocking() {
   static bool nccl_use_nonblocking_ =
       c10::utils::check_env("TORCH_NCCL_USE_COMM_NONBLOCKING") == true;
@@ -5,6 +5,7 @@
 #include <stdio.h>
 #include <stdlib.h>
 
+#include <cstdint>
 #include <memory>
 #include <mutex>
 
@@ -165,6 +166,11 @@ namespace c10d {
 
 std::string getNcclVersion();
 std::string ncclGetErrorWithVersion(ncclResult_t error);
+
+// Hash of this machine's hostname, used to tell which ranks of a job share a
+// node. Returns 0 if the hostname cannot be determined, in which case every
+// rank looks like it lives on the same node.
+TORCH_API uint64_t getHostHash();
 bool nccl_use_nonblocking();
 int nccl_nonblocking_timeout();
 
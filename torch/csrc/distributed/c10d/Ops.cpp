@@ -19,7 +19,9 @@ TORCH_LIBRARY(c10d, m) {
   m.def(
       "broadcast_(Tensor[] tensors, __torch__.torch.classes.c10d.ProcessGroup process_group, int root_rank, int root_tensor, bool asyncOp, int timeout) -> (Tensor[], __torch__.torch.classes.c10d.Work)");
   m.def(
-      "allreduce_(Tensor[] tensors, __torch__.torch.classes.c10d.ProcessGroup process_group, __torch__.torch.classes.c10d.ReduceOp reduce_op, Tensor? sparse_indices, int timeout) -> (Tensor[], __torch__.torch.classes.c10d.Work)");
+      "broadcast_coalesced_(Tensor[] tensors, __torch__.torch.classes.c10d.ProcessGroup process_group, int root_rank, int timeout) -> __torch__.torch.classes.c10d.Work");
+  m.def(
+      "allreduce_(Tensor[] tensors, __torch__.torch.classes.c10d.ProcessGroup process_group, __torch__.torch.classes.c10d.ReduceOp reduce_op, Tensor? sparse_indices, int stream_hint, int timeout) -> (Tensor[], __torch__.torch.classes.c10d.Work)");
   m.def(
       "allreduce_coalesced_(Tensor[] tensors, __torch__.torch.classes.c10d.ProcessGroup process_group, __torch__.torch.classes.c10d.ReduceOp reduce_op, int timeout) -> __torch__.torch.classes.c10d.Work");
   m.def(
@@ -160,6 +162,24 @@ IMPL_BROADCAST(CPU)
 IMPL_BROADCAST(CUDA)
 IMPL_BROADCAST(PrivateUse1)
 
+#define IMPL_BROADCAST_COALESCED(DEV)                        \
+  c10::intrusive_ptr<Work> broadcast_coalesced_##DEV(        \
+      at::TensorList tensors,                                \
+      const c10::intrusive_ptr<ProcessGroup>& process_group, \
+      int64_t root_rank,                                     \
+      int64_t timeout) {                                     \
+    auto tensor_vec = tensors.vec();                         \
+    BroadcastOptions opts = BroadcastOptions{};              \
+    opts.rootRank = root_rank;                               \
+    opts.timeout = std::chrono::milliseconds(timeout);       \
+    return process_group->getBackend(c10::DeviceType::DEV)   \
+        ->broadcast_coalesced(tensor_vec, opts);             \
+  }
+
+IMPL_BROADCAST_COALESCED(CPU)
+IMPL_BROADCAST_COALESCED(CUDA)
+IMPL_BROADCAST_COALESCED(PrivateUse1)
+
 // Return input tensors as output tensors to make inplace allreduce look like
 // a functional API, so that make_fx can correctly build the dependencies in
 // the graph later.
@@ -170,14 +190,15 @@ IMPL_BROADCAST(PrivateUse1)
           const c10::intrusive_ptr<ProcessGroup>& process_group,            \
           const c10::intrusive_ptr<ReduceOp>& reduce_op,                    \
           const c10::optional<at::Tensor>& sparse_indices,                  \
+          int64_t stream_hint,                                              \
           int64_t timeout) {                                                \
     auto tensor_vec = tensors.vec();                                        \
+    AllreduceOptions opts = AllreduceOptions{                               \
+        *reduce_op.get(), std::chrono::milliseconds(timeout)};              \
+    opts.streamHint = stream_hint;                                          \
     auto work =                                                             \
         process_group->getBackend(c10::DeviceType::DEV)                     \
-            ->allreduce(                                                    \
-                tensor_vec,                                                 \
-                AllreduceOptions{                                           \
-                    *reduce_op.get(), std::chrono::milliseconds(timeout)}); \
+            ->allreduce(tensor_vec, opts);                                  \
     return std::tuple<std::vector<at::Tensor>, c10::intrusive_ptr<Work>>(   \
         std::move(tensor_vec), work);                                       \
   }
@@ -471,6 +492,7 @@ allreduce_sparse_cuda_(
     const c10::intrusive_ptr<ProcessGroup>& process_group,
     const c10::intrusive_ptr<ReduceOp>& reduce_op,
     const c10::optional<at::Tensor>& sparse_indices,
+    int64_t stream_hint,
     int64_t timeout) {
   auto tensor_vec = tensors.vec();
   auto work = process_group->getBackend(c10::DeviceType::CUDA)
@@ -510,6 +532,7 @@ REGISTER_C10D_OP(recv_)
 REGISTER_C10D_OP(recv_any_source_)
 REGISTER_C10D_OP(reduce_)
 REGISTER_C10D_OP(broadcast_)
+REGISTER_C10D_OP(broadcast_coalesced_)
 REGISTER_C10D_OP(allreduce_)
 REGISTER_C10D_OP(allreduce_coalesced_)
 REGISTER_C10D_OP(allgather_)
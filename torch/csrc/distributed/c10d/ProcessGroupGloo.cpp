@@ -780,13 +780,25 @@ ProcessGroupGloo::ProcessGroupGloo(
   // option is needed if you have a fast NIC that cannot be saturated
   // by a single I/O thread.
   //
-  contexts_.reserve(options->devices.size());
-  for (const auto i : c10::irange(options->devices.size())) {
+  // Each context performs its own full-mesh connect, so replicating a device
+  // connections_per_peer times yields that many independent socket sets per
+  // peer; getContext() round-robins collectives (e.g. DDP gradient buckets)
+  // across them. Contexts sharing a device object also share its I/O thread;
+  // pass the same logical device multiple times in `devices` if independent
+  // I/O threads are needed as well.
+  TORCH_CHECK(
+      options->connections_per_peer >= 1,
+      "ProcessGroupGloo: connections_per_peer must be positive, got ",
+      options->connections_per_peer);
+  const size_t numContexts =
+      options->devices.size() * options->connections_per_peer;
+  contexts_.reserve(numContexts);
+  for (const auto i : c10::irange(numContexts)) {
     auto context = std::make_shared<::gloo::rendezvous::Context>(rank_, size_);
     auto store = ::gloo::rendezvous::PrefixStore(std::to_string(i), *store_);
     context->setTimeout(options->timeout);
     try {
-      context->connectFullMesh(store, options->devices[i]);
+      context->connectFullMesh(store, options->devices[i % options->devices.size()]);
     } catch (const std::runtime_error& e) {
       auto err = e.what();
       // TORCH_CHECK to print the cpp stacktrace.
@@ -841,6 +853,15 @@ void ProcessGroupGloo::runLoop(int workerIndex) {
 
   while (!stop_) {
     if (workQueue_.empty()) {
+      if (options_->busy_poll) {
+        // Spin on the queue instead of sleeping on the condition variable;
+        // avoids the wake-up latency on small latency-critical collectives
+        // at the cost of burning a core per worker thread.
+        lock.unlock();
+        std::this_thread::yield();
+        lock.lock();
+        continue;
+      }
       workProduceCV_.wait(lock);
       continue;
     }
@@ -1795,6 +1816,31 @@ c10::intrusive_ptr<Work> ProcessGroupGloo::reduce(
 
 namespace {
 
+// Per-worker-thread cache of flat staging tensors, keyed by scalar type.
+// The collective thread pool is small and iterative workloads repeat the
+// same tensor shapes, so handing out one growing buffer per dtype keeps the
+// staging allocation stable across iterations instead of allocating a fresh
+// flat tensor every call; stable addresses also let transports with memory
+// registration caches (e.g. ibverbs) avoid re-registering new buffers.
+// Only safe for works executed on the worker threads, where one work runs
+// at a time per thread and the staging contents are consumed inside run().
+at::Tensor newLikeFlatCached(std::vector<at::Tensor>& tensors) {
+  TORCH_CHECK(!tensors.empty(), "Expected non-empty list of tensors");
+  if (!tensors[0].device().is_cpu()) {
+    return newLikeFlat(tensors);
+  }
+  static thread_local std::unordered_map<c10::ScalarType, at::Tensor> cache;
+  const auto numel = static_cast<int64_t>(tensors.size()) * tensors[0].numel();
+  auto& buf = cache[tensors[0].scalar_type()];
+  if (!buf.defined() || buf.numel() < numel) {
+    buf = at::empty({numel}, tensors[0].options());
+  }
+  std::vector<int64_t> sizes{static_cast<int64_t>(tensors.size())};
+  sizes.insert(
+      sizes.end(), tensors[0].sizes().begin(), tensors[0].sizes().end());
+  return buf.narrow(0, 0, numel).view(sizes);
+}
+
 class AsyncAllgatherWork : public ProcessGroupGloo::AsyncWork {
  public:
   AsyncAllgatherWork(
@@ -1826,14 +1872,21 @@ class AsyncAllgatherWork : public ProcessGroupGloo::AsyncWork {
     gloo::AllgatherOptions opts(context);
     opts.setTag(tag);
 
-    // Use single flattened input tensor.
-    at::Tensor flatInputTensor = flattenDenseTensors(inputs);
+    // Use the input tensor in place when it is already a single contiguous
+    // dense tensor; otherwise flatten into a single staging tensor.
+    at::Tensor flatInputTensor;
+    if (inputs.size() == 1 && inputs[0].layout() == c10::kStrided &&
+        inputs[0].is_contiguous()) {
+      flatInputTensor = inputs[0];
+    } else {
+      flatInputTensor = flattenDenseTensors(inputs);
+    }
     GENERATE_ALL_TYPES(scalarType, setInput, opts, flatInputTensor);
 
-    // Use single flat output tensor.
+    // Use single flat output tensor, reused across iterations.
     // The first dimension corresponds to the index into outputs[N],
     // so copying into the actual output later is easy.
-    at::Tensor flatOutputTensor = newLikeFlat(outputs[0]);
+    at::Tensor flatOutputTensor = newLikeFlatCached(outputs[0]);
     GENERATE_ALL_TYPES(scalarType, setOutput, opts, flatOutputTensor);
     gloo::allgather(opts);
 
@@ -238,6 +238,16 @@ class TORCH_API ProcessGroupGloo : public Backend {
 
     std::vector<std::shared_ptr<::gloo::transport::Device>> devices;
     int threads;
+    // Number of rendezvous contexts (and therefore full-mesh TCP connection
+    // sets) created per configured device. Successive collectives round-robin
+    // over all contexts, so pipelined workloads such as DDP gradient buckets
+    // stripe their traffic over this many sockets per peer. Useful when a
+    // single TCP stream cannot saturate the NIC.
+    int connections_per_peer{1};
+    // Busy-poll the internal work queue in the worker threads instead of
+    // blocking on a condition variable. Trades CPU for lower wake-up latency
+    // on small, latency-critical collectives.
+    bool busy_poll{false};
   };
 
   const std::string getBackendName() const override {
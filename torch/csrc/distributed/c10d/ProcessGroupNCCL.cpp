@@ -13,6 +13,7 @@
 
 #ifdef USE_C10D_NCCL
 
+#include <algorithm>
 #include <exception>
 #include <map>
 #include <stdexcept>
@@ -33,6 +34,7 @@
 #include <c10/util/irange.h>
 #include <torch/csrc/cuda/nccl.h>
 #include <torch/csrc/distributed/c10d/ParamCommsUtils.hpp>
+#include <torch/csrc/distributed/c10d/PrefixStore.hpp>
 #include <torch/csrc/distributed/c10d/TraceUtils.h>
 #include <torch/csrc/distributed/c10d/Utils.hpp>
 #include <torch/torch.h>
@@ -726,10 +728,15 @@ ProcessGroupNCCL::ProcessGroupNCCL(
       getCvarInt(TORCH_NCCL_HEARTBEAT_TIMEOUT_SEC, 60 * 2 /*2 Mins*/);
   ncclTraceBufferSize_ = getCvarInt(TORCH_NCCL_TRACE_BUFFER_SIZE, 0);
 #ifdef ENABLE_NCCL_ERROR_CHECKING
+  // The collective profiler needs the start/end events to compute durations,
+  // so it forces timing on just like desync debug does.
   enableTiming_.store(
-      getCvarBool(TORCH_NCCL_ENABLE_TIMING, false) || desyncDebug_);
+      getCvarBool(TORCH_NCCL_ENABLE_TIMING, false) || desyncDebug_ ||
+      CollectiveLatencyProfiler::get()->enabled_);
 #endif
   avoidRecordStreams_ = getCvarBool(TORCH_NCCL_AVOID_RECORD_STREAMS, false);
+  hierarchicalAllreduce_ =
+      getCvarBool(TORCH_NCCL_HIERARCHICAL_ALLREDUCE, false);
 #ifdef NCCL_HAS_COMM_REGISTER
   useTensorRegisterAllocatorHook_ =
       getCvarBool(TORCH_NCCL_USE_TENSOR_REGISTER_ALLOCATOR_HOOK, false);
@@ -778,6 +785,15 @@ ProcessGroupNCCL::ProcessGroupNCCL(
 #endif
 
   init();
+
+  // All ranks construct the process group by contract, so it is safe to
+  // exchange host information through the store here. Doing it lazily inside
+  // allreduce() would hang if ranks disagreed on whether to take the
+  // hierarchical path.
+  if (hierarchicalAllreduce_ && size_ > 1) {
+    initHierarchicalComms();
+  }
+
   const std::string OFF = "OFF";
   std::string torch_distributed_debug =
       getCvarString({"TORCH_DISTRIBUTED_DEBUG"}, OFF.c_str());
@@ -804,6 +820,9 @@ ProcessGroupNCCL::ProcessGroupNCCL(
             << monitorThreadEnabled_.load()
             << ", TORCH_NCCL_HEARTBEAT_TIMEOUT_SEC: " << heartbeatTimeoutInSec_
             << ", TORCH_NCCL_TRACE_BUFFER_SIZE: " << ncclTraceBufferSize_
+            << ", TORCH_NCCL_HIERARCHICAL_ALLREDUCE: " << hierarchicalAllreduce_
+            << ", TORCH_NCCL_COLLECTIVE_PROFILER: "
+            << CollectiveLatencyProfiler::get()->enabled_
             << ", NCCL_DEBUG: " << nccl_debug << ", ID=" << this->getID();
 
   RECORD_PARAM_COMMS(
@@ -983,6 +1002,14 @@ void ProcessGroupNCCL::enableCollectivesTiming() {
   enableTiming_.store(true);
 }
 
+std::string ProcessGroupNCCL::aggregateCollectiveProfile() {
+  auto* profiler = CollectiveLatencyProfiler::get();
+  TORCH_CHECK(
+      profiler->enabled_,
+      "aggregateCollectiveProfile requires TORCH_NCCL_COLLECTIVE_PROFILER=1");
+  return profiler->aggregate(store_, rank_, size_);
+}
+
 std::future<bool> ProcessGroupNCCL::launchAsyncDebugDump() {
   std::promise<bool> resultPromise;
   std::future<bool> resultFuture = resultPromise.get_future();
@@ -1449,6 +1476,23 @@ void ProcessGroupNCCL::workCleanupLoop() {
 
       // Clean up completed work
       if (work.isCompleted()) {
+        auto* profiler = CollectiveLatencyProfiler::get();
+        if (profiler->enabled_ && work.timingEnabled_ && !work.exception() &&
+            work.devices_.size() == 1) {
+          const float durationMs = work.getDuration();
+          const float wallMs =
+              std::chrono::duration_cast<
+                  std::chrono::duration<float, std::milli>>(
+                  std::chrono::steady_clock::now() - work.workStartTime_)
+                  .count();
+          profiler->sample(
+              work.seq_,
+              opTypeToString(work.retrieveOpType()),
+              work.numelIn_,
+              work.numelOut_,
+              durationMs,
+              std::max(0.0f, wallMs - durationMs));
+        }
         NCCLTraceBuffer::get()->retire_id(work.trace_id_);
         if (onCompletionHook_) {
           // Move Work object to completedWorkList_ to be consumed by the hook
@@ -2250,7 +2294,8 @@ c10::intrusive_ptr<Work> ProcessGroupNCCL::collective(
     PostProcess post,
     OpType opType,
     const char* profilingTitle,
-    bool avoidRecordStreams) {
+    bool avoidRecordStreams,
+    int64_t streamHint) {
   // Environment setting by the user may add onto collective call's option
   avoidRecordStreams |= avoidRecordStreams_;
   c10::cuda::CaptureStatus capture_status =
@@ -2269,7 +2314,17 @@ c10::intrusive_ptr<Work> ProcessGroupNCCL::collective(
   //    a single fused kernel.
   const auto devices = getDeviceList(inputs);
   const bool inputs_same_dev = (devices.size() == 1);
-  const auto key = getKeyFromDevices(devices);
+  auto key = getKeyFromDevices(devices);
+  // A non-negative stream hint selects a dedicated communicator/stream lane
+  // for this collective, so collectives with different hints can run in
+  // parallel instead of serializing on the single per-device NCCL stream.
+  // Lanes are keyed into the communicator/stream caches below; all ranks must
+  // use the same sequence of hints since lane communicators are created
+  // collectively on first use. Coalesced sequences keep the default lane so
+  // they group on one communicator.
+  if (streamHint >= 0 && !coalescing_state_) {
+    key += "|lane:" + std::to_string(streamHint);
+  }
   auto& ncclComms = getNCCLComm(key, devices, opType);
 
   if (coalescing_state_ & CoalActive) {
@@ -2613,7 +2668,8 @@ c10::intrusive_ptr<Work> ProcessGroupNCCL::collective(
     Fn fn,
     OpType opType,
     const char* profilingTitle,
-    bool avoidRecordStreams) {
+    bool avoidRecordStreams,
+    int64_t streamHint) {
   return collective(
       inputs,
       outputs,
@@ -2624,7 +2680,8 @@ c10::intrusive_ptr<Work> ProcessGroupNCCL::collective(
          c10::intrusive_ptr<ProcessGroupNCCL::WorkNCCL>& work) {},
       opType,
       profilingTitle,
-      avoidRecordStreams);
+      avoidRecordStreams,
+      streamHint);
 }
 
 template <typename Fn>
@@ -2721,6 +2778,139 @@ c10::intrusive_ptr<Work> ProcessGroupNCCL::allreduce_sparse(
 #endif
 }
 
+void ProcessGroupNCCL::initHierarchicalComms() {
+  // Exchange host hashes through the store to discover which ranks share a
+  // node. Every rank publishes its own hash and then reads all of them, so
+  // the topology view is identical across ranks.
+  const uint64_t hostHash = getHostHash();
+  store_->set(
+      "hierarchical_hosthash_" + std::to_string(rank_),
+      std::to_string(hostHash));
+  std::vector<uint64_t> hostHashes(size_);
+  for (const auto r : c10::irange(size_)) {
+    auto val = store_->get("hierarchical_hosthash_" + std::to_string(r));
+    hostHashes[r] = std::stoull(std::string(val.begin(), val.end()));
+  }
+
+  // Nodes are ordered by the first rank that appears on them; a rank's local
+  // rank is the number of lower global ranks on the same node.
+  std::vector<uint64_t> nodeOrder;
+  std::vector<int> nodeSizes;
+  localRank_ = 0;
+  for (const auto r : c10::irange(size_)) {
+    auto it = std::find(nodeOrder.begin(), nodeOrder.end(), hostHashes[r]);
+    if (it == nodeOrder.end()) {
+      nodeOrder.push_back(hostHashes[r]);
+      nodeSizes.push_back(1);
+    } else {
+      nodeSizes[it - nodeOrder.begin()] += 1;
+    }
+    if (r < rank_ && hostHashes[r] == hostHash) {
+      ++localRank_;
+    }
+  }
+  nodeIdx_ = static_cast<int>(
+      std::find(nodeOrder.begin(), nodeOrder.end(), hostHash) -
+      nodeOrder.begin());
+  numNodes_ = static_cast<int>(nodeOrder.size());
+  localSize_ = nodeSizes[nodeIdx_];
+
+  if (numNodes_ < 2 || localSize_ < 2) {
+    LOG(INFO) << "[Rank " << rank_
+              << "] TORCH_NCCL_HIERARCHICAL_ALLREDUCE requested but the job "
+              << "spans " << numNodes_ << " node(s) with " << localSize_
+              << " local rank(s); falling back to flat allreduce.";
+    return;
+  }
+  if (!std::all_of(nodeSizes.begin(), nodeSizes.end(), [&](int s) {
+        return s == localSize_;
+      })) {
+    LOG(INFO) << "[Rank " << rank_
+              << "] TORCH_NCCL_HIERARCHICAL_ALLREDUCE requires the same "
+              << "number of ranks on every node; falling back to flat "
+              << "allreduce.";
+    return;
+  }
+
+  // Scoped sub-groups over prefixed views of the parent store. The sub-group
+  // constructors run this same discovery and bail out before creating
+  // sub-groups of their own: the intra-node group spans a single node and
+  // each cross-node "rail" group has one rank per node.
+  auto intraOpts = Options::create(options_->is_high_priority_stream);
+  intraOpts->timeout = options_->timeout;
+  intraNodePG_ = c10::make_intrusive<ProcessGroupNCCL>(
+      c10::make_intrusive<PrefixStore>(
+          "hierarchical_intra_" + std::to_string(nodeIdx_) + "/", store_),
+      localRank_,
+      localSize_,
+      intraOpts);
+
+  auto crossOpts = Options::create(options_->is_high_priority_stream);
+  crossOpts->timeout = options_->timeout;
+  crossNodePG_ = c10::make_intrusive<ProcessGroupNCCL>(
+      c10::make_intrusive<PrefixStore>(
+          "hierarchical_rail_" + std::to_string(localRank_) + "/", store_),
+      nodeIdx_,
+      numNodes_,
+      crossOpts);
+
+  LOG(INFO) << "[Rank " << rank_
+            << "] Hierarchical allreduce enabled: " << numNodes_
+            << " nodes x " << localSize_ << " local ranks (node " << nodeIdx_
+            << ", local rank " << localRank_ << ").";
+}
+
+bool ProcessGroupNCCL::shouldUseHierarchicalAllreduce(
+    const std::vector<at::Tensor>& tensors,
+    const AllreduceOptions& opts) const {
+  if (!hierarchicalAllreduce_ || !intraNodePG_) {
+    return false;
+  }
+  // Only properties that are identical on every rank may be consulted here,
+  // otherwise ranks would diverge between the flat and hierarchical paths
+  // and deadlock.
+  if (tensors.size() != 1) {
+    return false;
+  }
+  if (opts.reduceOp == ReduceOp::PREMUL_SUM) {
+    // The scaling factor would be applied once per stage.
+    return false;
+  }
+  const auto& tensor = tensors[0];
+  return tensor.layout() == at::kStrided && tensor.is_contiguous() &&
+      tensor.numel() > 0 && tensor.numel() % localSize_ == 0;
+}
+
+c10::intrusive_ptr<Work> ProcessGroupNCCL::allreduce_hierarchical(
+    std::vector<at::Tensor>& tensors,
+    const AllreduceOptions& opts) {
+  auto& tensor = tensors[0];
+  auto flat = tensor.view({tensor.numel()});
+  auto chunk = at::empty({tensor.numel() / localSize_}, tensor.options());
+
+  // Stage 1: reduce-scatter inside the node so each local rank owns one
+  // chunk of the node-local reduction.
+  ReduceScatterOptions rsOpts;
+  rsOpts.reduceOp = opts.reduceOp;
+  rsOpts.timeout = opts.timeout;
+  intraNodePG_->_reduce_scatter_base(chunk, flat, rsOpts)->wait();
+
+  // Stage 2: allreduce each chunk across nodes on its own rail, so all
+  // NICs carry cross-node traffic concurrently. For AVG the intra-node
+  // stage divides by localSize_ and this one by numNodes_, which composes
+  // to the flat-world average.
+  AllreduceOptions arOpts;
+  arOpts.reduceOp = opts.reduceOp;
+  arOpts.timeout = opts.timeout;
+  std::vector<at::Tensor> chunkVec{chunk};
+  crossNodePG_->allreduce(chunkVec, arOpts)->wait();
+
+  // Stage 3: allgather the fully reduced chunks back inside the node.
+  AllgatherOptions agOpts;
+  agOpts.timeout = opts.timeout;
+  return intraNodePG_->_allgather_base(flat, chunk, agOpts);
+}
+
 c10::intrusive_ptr<Work> ProcessGroupNCCL::allreduce_impl(
     std::vector<at::Tensor>& tensors,
     const AllreduceOptions& opts) {
@@ -2745,7 +2935,9 @@ c10::intrusive_ptr<Work> ProcessGroupNCCL::allreduce_impl(
             stream.stream());
       },
       OpType::ALLREDUCE,
-      "nccl:all_reduce");
+      "nccl:all_reduce",
+      /*avoidRecordStreams=*/false,
+      opts.streamHint);
 }
 
 c10::intrusive_ptr<Work> ProcessGroupNCCL::allreduce(
@@ -2771,6 +2963,9 @@ c10::intrusive_ptr<Work> ProcessGroupNCCL::allreduce(
       this->getSize()); // worldSize
 
   // avoidRecordStreams_ note: collective() will stash tensors.
+  if (shouldUseHierarchicalAllreduce(tensors, opts)) {
+    return allreduce_hierarchical(tensors, opts);
+  }
   return allreduce_impl(tensors, opts);
 }
 
@@ -2846,6 +3041,52 @@ c10::intrusive_ptr<Work> ProcessGroupNCCL::broadcast(
       avoidRecordStreams);
 }
 
+c10::intrusive_ptr<Work> ProcessGroupNCCL::broadcast_coalesced(
+    std::vector<at::Tensor>& tensors,
+    const BroadcastOptions& opts) {
+  auto total_numel = check_gpu_tensors_same_device(tensors);
+
+  // @lint-ignore CLANGTIDY
+  RECORD_PARAM_COMMS_DATA(
+      static_cast<int>(
+          this->getSequenceNumberForGroup() + 1), // seq + 1 to match collective
+      this->getID(),
+      tensors, // inputTensors
+      tensors, // outputTensors
+      opts.rootRank, // root rank
+      "broadcast_coalesced", // colName
+      total_numel, // inNelems
+      total_numel, // outNelems
+      tensors[0].scalar_type(), // dType
+      std::vector<int64_t>(), // inSplitSizes
+      std::vector<int64_t>(), // outSplitSizes
+      this->getSize()); // worldSize
+
+  // avoidRecordStreams_ note: collective() will stash tensors.
+  bool avoidRecordStreams = avoidRecordStreams_ || (!opts.asyncOp);
+
+  return collective(
+      tensors,
+      tensors,
+      [&](at::Tensor& input,
+          at::Tensor& output,
+          ncclComm_t comm,
+          at::cuda::CUDAStream& stream) {
+        // The tensor list is coalesced onto a single device, so unlike
+        // broadcast() the root is not scaled by the tensor count.
+        return ncclBcast(
+            input.data_ptr(),
+            input.numel(),
+            getNcclDataType(input.scalar_type()),
+            opts.rootRank,
+            comm,
+            stream.stream());
+      },
+      OpType::BROADCAST,
+      "nccl:broadcast_coalesced",
+      avoidRecordStreams);
+}
+
 // _broadcast_oop adds an out-of-place broadcast in PGNCCL
 // Custom collectives may be implemented by coalescing broadcast operations
 // One use-case is implementing a vector all_gather (all_gather_v)
@@ -3701,6 +3942,128 @@ c10::intrusive_ptr<Work> ProcessGroupNCCL::recv(
       c10::str("nccl:recv ", rank_, "<-", srcRank).c_str());
   return ret;
 }
+
+std::unique_ptr<ProcessGroupNCCL::P2PChannel> ProcessGroupNCCL::
+    createP2PChannel(
+        int peer,
+        at::IntArrayRef bufferShape,
+        at::ScalarType dtype,
+        at::Device device,
+        int tag,
+        int ringSize) {
+  TORCH_CHECK(device.is_cuda(), "P2P channels require a CUDA device");
+  TORCH_CHECK(
+      peer != rank_, "P2P channels require a remote peer, got own rank ", peer);
+  TORCH_CHECK(
+      ringSize > 0, "P2P channel ring size must be positive, got ", ringSize);
+
+  // Each (peer, tag) pair gets a dedicated communicator, so traffic on
+  // different tags to the same peer cannot be reordered against each other
+  // on the device. Communicator setup rendezvous happens here, once, instead
+  // of on the first send/recv.
+  const std::string key =
+      getKeySendRecv(rank_, peer) + ":chan" + std::to_string(tag);
+  const int p2pRank = rank_ <= peer ? 0 : 1;
+  const int p2pTargetRank = 1 - p2pRank;
+  std::vector<at::Device> devices{device};
+  auto& ncclComms =
+      getNCCLComm(key, devices, OpType::SEND, p2pRank, /*isSendRecvSelf=*/false);
+  TORCH_INTERNAL_ASSERT(ncclComms.size() == 1);
+
+  std::vector<at::Tensor> buffers;
+  buffers.reserve(ringSize);
+  for (const auto i : c10::irange(ringSize)) {
+    (void)i;
+    buffers.push_back(at::empty(
+        bufferShape, at::TensorOptions().dtype(dtype).device(device)));
+  }
+
+  // Reuse the NCCL stream that getNCCLComm cached for this key, so channel
+  // traffic is ordered like any other work on this communicator.
+  at::cuda::CUDAStream stream = ncclStreams_[key][0];
+
+  return std::unique_ptr<P2PChannel>(new P2PChannel(
+      p2pTargetRank, std::move(buffers), ncclComms[0], stream));
+}
+
+ProcessGroupNCCL::P2PChannel::P2PChannel(
+    int p2pTargetRank,
+    std::vector<at::Tensor> buffers,
+    std::shared_ptr<NCCLComm> comm,
+    at::cuda::CUDAStream stream)
+    : p2pTargetRank_(p2pTargetRank),
+      comm_(std::move(comm)),
+      stream_(stream),
+      buffers_(std::move(buffers)),
+      recvEvents_(buffers_.size()),
+      sendEvents_(buffers_.size()) {}
+
+bool ProcessGroupNCCL::P2PChannel::Handle::isCompleted() const {
+  return event_ == nullptr || event_->query();
+}
+
+void ProcessGroupNCCL::P2PChannel::Handle::wait() const {
+  if (event_) {
+    event_->block(at::cuda::getCurrentCUDAStream());
+  }
+}
+
+ProcessGroupNCCL::P2PChannel::Handle ProcessGroupNCCL::P2PChannel::send(
+    const at::Tensor& tensor) {
+  TORCH_CHECK(
+      tensor.is_cuda() && tensor.is_contiguous(),
+      "P2P channel send expects a contiguous CUDA tensor");
+  std::lock_guard<std::mutex> lock(mutex_);
+  at::cuda::CUDAEvent& event = sendEvents_[sendCursor_];
+  sendCursor_ = (sendCursor_ + 1) % sendEvents_.size();
+
+  // Order the transfer after pending work on the caller's stream.
+  sendDepEvent_.record(at::cuda::getCurrentCUDAStream(tensor.get_device()));
+  sendDepEvent_.block(stream_);
+  torch::cuda::nccl::send(
+      tensor, comm_->getNcclComm(), stream_, p2pTargetRank_);
+  // Keep the tensor alive until the send completes on the channel stream.
+  c10::cuda::CUDACachingAllocator::recordStream(
+      tensor.storage().data_ptr(), stream_);
+  event.record(stream_);
+  return Handle(&event);
+}
+
+void ProcessGroupNCCL::P2PChannel::postReceivesLocked() {
+  if (numPosted_ == buffers_.size()) {
+    return;
+  }
+  // Reposting a slot overwrites its buffer. The consumer enqueued its reads
+  // of previously delivered slots on its current stream before asking for
+  // more receives, so ordering the new writes after that stream makes the
+  // reuse safe.
+  consumedEvent_.record(at::cuda::getCurrentCUDAStream(buffers_[0].get_device()));
+  consumedEvent_.block(stream_);
+  while (numPosted_ < buffers_.size()) {
+    const size_t slot = (recvHead_ + numPosted_) % buffers_.size();
+    torch::cuda::nccl::recv(
+        buffers_[slot], comm_->getNcclComm(), stream_, p2pTargetRank_);
+    recvEvents_[slot].record(stream_);
+    ++numPosted_;
+  }
+}
+
+void ProcessGroupNCCL::P2PChannel::postReceives() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  postReceivesLocked();
+}
+
+std::pair<at::Tensor, ProcessGroupNCCL::P2PChannel::Handle>
+ProcessGroupNCCL::P2PChannel::recv() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (numPosted_ == 0) {
+    postReceivesLocked();
+  }
+  const size_t slot = recvHead_;
+  recvHead_ = (recvHead_ + 1) % buffers_.size();
+  --numPosted_;
+  return {buffers_[slot], Handle(&recvEvents_[slot])};
+}
 #else
 c10::intrusive_ptr<Work> ProcessGroupNCCL::alltoall_base(
     at::Tensor& /* unused */,
@@ -3739,6 +4102,54 @@ c10::intrusive_ptr<Work> ProcessGroupNCCL::recv(
       NotImplementedError,
       "ProcessGroupNCCL only supports recv for NCCL lib version >= 2.7.0");
 }
+
+std::unique_ptr<ProcessGroupNCCL::P2PChannel> ProcessGroupNCCL::
+    createP2PChannel(
+        int /* unused */,
+        at::IntArrayRef /* unused */,
+        at::ScalarType /* unused */,
+        at::Device /* unused */,
+        int /* unused */,
+        int /* unused */) {
+  C10_THROW_ERROR(
+      NotImplementedError,
+      "ProcessGroupNCCL only supports P2P channels for NCCL lib version >= 2.7.0");
+}
+
+ProcessGroupNCCL::P2PChannel::P2PChannel(
+    int /* unused */,
+    std::vector<at::Tensor> /* unused */,
+    std::shared_ptr<NCCLComm> /* unused */,
+    at::cuda::CUDAStream stream)
+    : p2pTargetRank_(0), stream_(stream) {}
+
+bool ProcessGroupNCCL::P2PChannel::Handle::isCompleted() const {
+  return true;
+}
+
+void ProcessGroupNCCL::P2PChannel::Handle::wait() const {}
+
+ProcessGroupNCCL::P2PChannel::Handle ProcessGroupNCCL::P2PChannel::send(
+    const at::Tensor& /* unused */) {
+  C10_THROW_ERROR(
+      NotImplementedError,
+      "ProcessGroupNCCL only supports P2P channels for NCCL lib version >= 2.7.0");
+}
+
+void ProcessGroupNCCL::P2PChannel::postReceives() {
+  C10_THROW_ERROR(
+      NotImplementedError,
+      "ProcessGroupNCCL only supports P2P channels for NCCL lib version >= 2.7.0");
+}
+
+void ProcessGroupNCCL::P2PChannel::postReceivesLocked() {}
+
+std::pair<at::Tensor, ProcessGroupNCCL::P2PChannel::Handle>
+ProcessGroupNCCL::P2PChannel::recv() {
+  C10_THROW_ERROR(
+      NotImplementedError,
+      "ProcessGroupNCCL only supports P2P channels for NCCL lib version >= 2.7.0");
+}
 #endif
 
 void ProcessGroupNCCL::groupStart() {
@@ -110,6 +110,15 @@ static std::vector<std::string> TORCH_NCCL_USE_TENSOR_REGISTER_ALLOCATOR_HOOK =
     {"TORCH_NCCL_USE_TENSOR_REGISTER_ALLOCATOR_HOOK",
      "NCCL_USE_TENSOR_REGISTER_ALLOCATOR_HOOK"};
 
+// If set, allreduce on multi-node jobs runs hierarchically: an intra-node
+// reduce-scatter, a cross-node allreduce of each rank's chunk over the ranks
+// with the same node-local index (its "rail"), and an intra-node allgather.
+// The sub process groups are managed internally. This favors topologies with
+// fast intra-node links (e.g. NVLink) and several NICs per node; it requires
+// the same number of ranks on every node.
+static std::vector<std::string> TORCH_NCCL_HIERARCHICAL_ALLREDUCE = {
+    "TORCH_NCCL_HIERARCHICAL_ALLREDUCE"};
+
 // ProcessGroupNCCL implements NCCL bindings for c10d.
 //
 // All functions of the class are expected to be called in the same order
@@ -335,6 +344,85 @@ class TORCH_API ProcessGroupNCCL : public Backend {
     friend class ProcessGroupNCCL;
   };
 
+  // A persistent point-to-point channel for pipeline parallelism.
+  //
+  // send()/recv() build a Work object and look up the communicator on every
+  // call, which costs tens of microseconds of host time per microbatch. A
+  // channel resolves the communicator once at creation, reuses the NCCL
+  // stream cached for it, owns a fixed ring of reusable receive buffers, and
+  // hands out lightweight event-based completion handles instead of Work
+  // objects, so steady-state per-microbatch setup is a couple of event
+  // records.
+  //
+  // Channels are identified by (peer, tag). Each one owns a private
+  // communicator, so traffic on different tags to the same peer cannot be
+  // reordered against each other on the device. Both ranks must create the
+  // channel with a matching (peer, tag) pair, buffer shape, dtype and ring
+  // size. Messages are delivered in order. The buffer returned by recv() is
+  // owned by the channel: the consumer must enqueue its reads of that buffer
+  // (on its current stream) before the slot can be reposted, which happens
+  // after `ringSize` further receives have been requested.
+  class TORCH_API P2PChannel {
+   public:
+    // Completion handle for one enqueued transfer. Only valid until the
+    // originating ring slot is reused.
+    class TORCH_API Handle {
+     public:
+      Handle() = default;
+      // True once the transfer has finished on the device.
+      bool isCompleted() const;
+      // Makes the current CUDA stream wait for the transfer.
+      void wait() const;
+
+     private:
+      friend class P2PChannel;
+      explicit Handle(at::cuda::CUDAEvent* event) : event_(event) {}
+
+      at::cuda::CUDAEvent* event_{nullptr};
+    };
+
+    // Enqueues `tensor` to the peer. The tensor may be overwritten or freed
+    // once the handle completes.
+    Handle send(const at::Tensor& tensor);
+
+    // Enqueues receives into all free ring slots, so matching sends can
+    // progress before the consumer calls recv(). Must be called from the
+    // consumer thread; see the class comment for the reuse discipline.
+    void postReceives();
+
+    // Returns the ring buffer holding the next message together with its
+    // completion handle, posting the receive first if none is outstanding.
+    std::pair<at::Tensor, Handle> recv();
+
+   private:
+    friend class ProcessGroupNCCL;
+    P2PChannel(
+        int p2pTargetRank,
+        std::vector<at::Tensor> buffers,
+        std::shared_ptr<NCCLComm> comm,
+        at::cuda::CUDAStream stream);
+
+    void postReceivesLocked();
+
+    int p2pTargetRank_;
+    std::shared_ptr<NCCLComm> comm_;
+    at::cuda::CUDAStream stream_;
+    // Receive ring. Slots [recvHead_, recvHead_ + numPosted_) hold posted
+    // receives; the others are free (not yet posted, or handed out by
+    // recv() and awaiting reposting).
+    std::vector<at::Tensor> buffers_;
+    std::vector<at::cuda::CUDAEvent> recvEvents_;
+    std::vector<at::cuda::CUDAEvent> sendEvents_;
+    // Reusable events ordering channel traffic after the caller's stream.
+    at::cuda::CUDAEvent sendDepEvent_;
+    at::cuda::CUDAEvent consumedEvent_;
+    size_t recvHead_{0};
+    size_t numPosted_{0};
+    size_t sendCursor_{0};
+    // Serializes enqueues from multiple host threads.
+    std::mutex mutex_;
+  };
+
   struct Options : Backend::Options {
     // NOTE: timeout in ProcessGroupNCCL::Options denote the timeout for
     // operations. This is only used when blockingWait_ is enabled.
@@ -413,6 +501,10 @@ class TORCH_API ProcessGroupNCCL : public Backend {
       std::vector<at::Tensor>& tensors,
       const BroadcastOptions& opts = BroadcastOptions()) override;
 
+  c10::intrusive_ptr<Work> broadcast_coalesced(
+      std::vector<at::Tensor>& tensors,
+      const BroadcastOptions& opts = BroadcastOptions()) override;
+
   c10::intrusive_ptr<Work> _broadcast_oop(
       std::vector<at::Tensor>& outputTensors,
       std::vector<at::Tensor>& inputTensors,
@@ -500,6 +592,17 @@ class TORCH_API ProcessGroupNCCL : public Backend {
       int srcRank,
       int tag) override;
 
+  // Creates a persistent point-to-point channel to `peer`. Both ends must
+  // call this with a matching (peer, tag) pair, buffer shape, dtype and ring
+  // size; see P2PChannel for the usage contract.
+  std::unique_ptr<P2PChannel> createP2PChannel(
+      int peer,
+      at::IntArrayRef bufferShape,
+      at::ScalarType dtype,
+      at::Device device,
+      int tag = 0,
+      int ringSize = 2);
+
   void groupStart();
 
   void groupEnd();
@@ -540,6 +643,13 @@ class TORCH_API ProcessGroupNCCL : public Backend {
 
   void enableCollectivesTiming() override;
 
+  // Exchanges this rank's collective-profiler totals for the window since the
+  // previous call through the store and returns a report attributing the
+  // likely straggler rank. Collective-like: every rank must call it at the
+  // same point. Requires TORCH_NCCL_COLLECTIVE_PROFILER=1, see
+  // CollectiveLatencyProfiler in TraceUtils.h.
+  std::string aggregateCollectiveProfile();
+
   // Provide an API for users to define their own ways to store NCCL debug info.
   void registerDebugInfoWriter(std::unique_ptr<DebugInfoWriter> writer);
 
@@ -602,7 +712,8 @@ class TORCH_API ProcessGroupNCCL : public Backend {
       Fn fn,
       OpType opType,
       const char* profilingTitle = nullptr,
-      bool avoidRecordStreams = false);
+      bool avoidRecordStreams = false,
+      int64_t streamHint = -1);
 
   template <typename Fn, typename PreProcess, typename PostProcess>
   c10::intrusive_ptr<Work> collective(
@@ -613,7 +724,8 @@ class TORCH_API ProcessGroupNCCL : public Backend {
       PostProcess post,
       OpType opType,
       const char* profilingTitle = nullptr,
-      bool avoidRecordStreams = false);
+      bool avoidRecordStreams = false,
+      int64_t streamHint = -1);
 
   // Helper that encapsulates work shared across point-to-point communication
   // primitives. It is the same structure as the helper used for collective
@@ -639,6 +751,29 @@ class TORCH_API ProcessGroupNCCL : public Backend {
       std::vector<at::Tensor>& tensors,
       const AllreduceOptions& opts = AllreduceOptions());
 
+  // Discovers which ranks share this rank's node by exchanging host hashes
+  // through the store and, when the topology qualifies (more than one node,
+  // the same number of ranks per node), creates the intra-node and cross-node
+  // ("rail") sub process groups used by hierarchical allreduce. Called from
+  // the constructor when TORCH_NCCL_HIERARCHICAL_ALLREDUCE is set, so every
+  // rank of the group participates in the exchange.
+  void initHierarchicalComms();
+
+  // Whether this allreduce call can run through the hierarchical schedule.
+  // Only consults properties that are identical on every rank (tensor count,
+  // shape, layout, reduce op), so all ranks take the same branch.
+  bool shouldUseHierarchicalAllreduce(
+      const std::vector<at::Tensor>& tensors,
+      const AllreduceOptions& opts) const;
+
+  // Hierarchical allreduce: reduce-scatter within the node, allreduce of the
+  // resulting chunk across nodes on this rank's rail, allgather within the
+  // node. The stages are chained on the current stream, so the returned work
+  // has the same synchronization behavior as a flat allreduce.
+  c10::intrusive_ptr<Work> allreduce_hierarchical(
+      std::vector<at::Tensor>& tensors,
+      const AllreduceOptions& opts);
+
   // Checks for NCCL errors on each of the communicators and returns an
   // appropriate exception_ptr (nullptr if no errors).
   static std::exception_ptr checkForNCCLErrorsInternal(
@@ -913,6 +1048,18 @@ class TORCH_API ProcessGroupNCCL : public Backend {
   // Whether or not TORCH_NCCL_AVOID_RECORD_STREAMS was set
   bool avoidRecordStreams_ = false;
 
+  // Whether or not TORCH_NCCL_HIERARCHICAL_ALLREDUCE was set
+  bool hierarchicalAllreduce_ = false;
+
+  // Topology discovered by initHierarchicalComms(). The sub process groups
+  // stay null when the topology does not qualify for hierarchical allreduce.
+  int localRank_ = -1;
+  int localSize_ = -1;
+  int nodeIdx_ = -1;
+  int numNodes_ = -1;
+  c10::intrusive_ptr<ProcessGroupNCCL> intraNodePG_;
+  c10::intrusive_ptr<ProcessGroupNCCL> crossNodePG_;
+
   // Set of communicators that this process group has aborted and their
   // ncclUniqueId has been written to the store. We don't need a lock
   // for this map since only the watchdog thread accesses this set. The
@@ -3,6 +3,9 @@
 #include <fcntl.h>
 #include <algorithm>
 #include <array>
+#include <atomic>
+#include <memory>
+#include <mutex>
 #include <system_error>
 #include <unordered_map>
 #include <utility>
@@ -23,6 +26,7 @@
 #include <torch/csrc/distributed/c10d/UnixSockUtils.hpp>
 #endif
 
+#include <torch/csrc/distributed/c10d/Utils.hpp>
 #include <torch/csrc/distributed/c10d/socket.h>
 
 namespace c10d {
@@ -49,7 +53,118 @@ void BackgroundThread::start() {
   is_running_.store(true);
 }
 
-// Separate thread that is only launched on master
+// Key/value state shared by the daemon threads. Keys are hash-partitioned
+// into a fixed number of shards, each guarded by its own mutex, so that
+// operations on unrelated keys can proceed concurrently when the store runs
+// with more than one daemon thread (TORCH_TCPSTORE_NUM_DAEMON_THREADS). With
+// a single daemon thread the mutexes are uncontended and essentially free.
+class ShardedKVStore {
+ public:
+  void set(const std::string& key, const std::vector<uint8_t>& data) {
+    auto& shard = shardFor(key);
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    shard.kv[key] = data;
+  }
+
+  // Mirrors std::unordered_map::at - throws std::out_of_range for a missing
+  // key, which the caller surfaces as a failed query.
+  std::vector<uint8_t> at(const std::string& key) const {
+    auto& shard = shardFor(key);
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    return shard.kv.at(key);
+  }
+
+  bool contains(const std::string& key) const {
+    auto& shard = shardFor(key);
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    return shard.kv.count(key) > 0;
+  }
+
+  size_t erase(const std::string& key) {
+    auto& shard = shardFor(key);
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    return shard.kv.erase(key);
+  }
+
+  int64_t add(const std::string& key, int64_t addVal) {
+    auto& shard = shardFor(key);
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    auto it = shard.kv.find(key);
+    if (it != shard.kv.end()) {
+      auto buf = reinterpret_cast<const char*>(it->second.data());
+      auto len = it->second.size();
+      addVal += std::stoll(std::string(buf, len));
+    }
+    auto addValStr = std::to_string(addVal);
+    shard.kv[key] = std::vector<uint8_t>(addValStr.begin(), addValStr.end());
+    return addVal;
+  }
+
+  void append(const std::string& key, const std::vector<uint8_t>& data) {
+    auto& shard = shardFor(key);
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    auto it = shard.kv.find(key);
+    if (it != shard.kv.end()) {
+      it->second.insert(it->second.end(), data.begin(), data.end());
+    } else {
+      shard.kv[key] = data;
+    }
+  }
+
+  // Returns the value to send back to the client, preserving the
+  // compare-set semantics of the previous single-map implementation.
+  std::vector<uint8_t> compareSet(
+      const std::string& key,
+      const std::vector<uint8_t>& currentValue,
+      std::vector<uint8_t> newValue) {
+    auto& shard = shardFor(key);
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    auto pos = shard.kv.find(key);
+    if (pos == shard.kv.end()) {
+      if (currentValue.empty()) {
+        shard.kv[key] = newValue;
+        return newValue;
+      }
+      // TODO: This code path is not ideal as we are "lying" to the caller in
+      // case the key does not exist. We should come up with a working
+      // solution.
+      return currentValue;
+    }
+    if (pos->second == currentValue) {
+      pos->second = std::move(newValue);
+    }
+    return pos->second;
+  }
+
+  size_t numKeys() const {
+    size_t count = 0;
+    for (auto& shard : shards_) {
+      std::lock_guard<std::mutex> lock(shard.mutex);
+      count += shard.kv.size();
+    }
+    return count;
+  }
+
+ private:
+  static constexpr size_t kNumShards = 16;
+
+  struct Shard {
+    mutable std::mutex mutex;
+    std::unordered_map<std::string, std::vector<uint8_t>> kv;
+  };
+
+  Shard& shardFor(const std::string& key) const {
+    return shards_[std::hash<std::string>{}(key) % kNumShards];
+  }
+
+  mutable std::array<Shard, kNumShards> shards_;
+};
+
+// Separate thread that is only launched on master. By default it serves all
+// clients from its own poll loop; when TORCH_TCPSTORE_NUM_DAEMON_THREADS is
+// set to N > 1 it only accepts connections and hands them round-robin to N
+// worker threads, each running the same poll loop over its share of the
+// clients against the sharded key/value store.
 class TCPStoreMasterDaemon : public BackgroundThread {
  public:
   explicit TCPStoreMasterDaemon(Socket&& storeListenSocket);
@@ -66,13 +181,18 @@ class TCPStoreMasterDaemon : public BackgroundThread {
   void initStopSignal();
   void closeStopSignal();
 
-  void queryFds(std::vector<struct pollfd>& fds);
-  void query(int socket);
+  void queryFds(
+      std::vector<struct pollfd>& fds,
+      std::vector<Socket>& sockets,
+      std::unordered_set<int>& miscellaneousSockets,
+      size_t connectSocketOffset);
+  void query(int socket, std::unordered_set<int>& miscellaneousSockets);
 
   void clearSocketWaitState(int socket);
 
-  // The master runs on a single thread so only
-  // one handler can be executed at a time
+  // Handlers may run concurrently on several daemon threads; all shared
+  // state is guarded by the store shards and waitMutex_. A single socket is
+  // only ever serviced by the thread that owns it.
   void validateHandler(int socket);
   void setHandler(int socket);
   void compareSetHandler(int socket);
@@ -86,25 +206,45 @@ class TCPStoreMasterDaemon : public BackgroundThread {
   void multiGetHandler(int socket);
   void multiSetHandler(int socket);
   void cancelWaitHandler(int socket);
-  void addMiscellaneousSocket(int socket);
-  void removeMiscellaneousSocket(int socket);
-  bool isMiscellaneousSocket(int socket);
 
   bool checkKeys(const std::vector<std::string>& keys) const;
   // Helper function to alerts waiting workers, used in setHandler, getHandler
   void wakeupWaitingClients(const std::string& key);
   void doSet(const std::string& key, const std::vector<uint8_t>& newData);
 
-  std::unordered_map<std::string, std::vector<uint8_t>> tcpStore_;
+  ShardedKVStore store_;
+  // Guards waitingSockets_ and keysAwaited_; also taken across the key
+  // check and registration in waitHandler() so a concurrent set cannot
+  // slip in between them.
+  std::mutex waitMutex_;
   // From key -> the list of sockets waiting on the key
   std::unordered_map<std::string, std::vector<int>> waitingSockets_;
   // From socket -> number of keys awaited
   std::unordered_map<int, size_t> keysAwaited_;
-  // miscellaneous sockets
+  // miscellaneous sockets serviced by the master thread
   std::unordered_set<int> miscellaneousSockets_;
 
   Socket storeListenSocket_;
   std::vector<Socket> sockets_{};
+
+#ifndef _WIN32
+  // One entry per daemon thread when running in sharded mode.
+  struct Worker {
+    std::array<int, 2> wakePipeFd{{-1, -1}};
+    std::mutex pendingMutex;
+    std::vector<Socket> pendingSockets;
+    std::thread thread;
+  };
+
+  void workerLoop(Worker& worker);
+  void dispatchSocket(Socket&& socket);
+  void stopWorkers();
+
+  std::vector<std::unique_ptr<Worker>> workers_;
+  std::atomic<bool> workersStopRequested_{false};
+  size_t nextWorker_{0};
+#endif
+  const int numDaemonThreads_;
 #ifdef _WIN32
   const std::chrono::milliseconds checkTimeout_ = std::chrono::milliseconds{10};
   HANDLE ghStopEvent_{};
@@ -115,7 +255,9 @@ class TCPStoreMasterDaemon : public BackgroundThread {
 
 // Simply start the daemon thread
 TCPStoreMasterDaemon::TCPStoreMasterDaemon(Socket&& storeListenSocket)
-    : storeListenSocket_{std::move(storeListenSocket)} {
+    : storeListenSocket_{std::move(storeListenSocket)},
+      numDaemonThreads_(
+          std::max(1, getCvarInt({"TORCH_TCPSTORE_NUM_DAEMON_THREADS"}, 1))) {
   initStopSignal();
 }
 
@@ -193,18 +335,23 @@ void TCPStoreMasterDaemon::stop() {
 }
 #endif
 
-void TCPStoreMasterDaemon::queryFds(std::vector<struct pollfd>& fds) {
-  // Skipping the fds[0] and fds[1],
-  // fds[0] is master's listening socket
-  // fds[1] is control pipe's reading fd, it is not for Windows platform
-  for (size_t fdIdx = CONNECT_SOCKET_OFFSET; fdIdx < fds.size(); ++fdIdx) {
+void TCPStoreMasterDaemon::queryFds(
+    std::vector<struct pollfd>& fds,
+    std::vector<Socket>& sockets,
+    std::unordered_set<int>& miscellaneousSockets,
+    size_t connectSocketOffset) {
+  // The first connectSocketOffset entries of fds are not client sockets:
+  // for the master thread these are its listening socket and the control
+  // pipe's reading fd (the latter not on Windows); for a worker thread it
+  // is the wake pipe's reading fd.
+  for (size_t fdIdx = connectSocketOffset; fdIdx < fds.size(); ++fdIdx) {
     if (fds[fdIdx].revents == 0) {
       continue;
     }
 
     // Now query the socket that has the event
     try {
-      query(fds[fdIdx].fd);
+      query(fds[fdIdx].fd, miscellaneousSockets);
     } catch (...) {
       // There was an error when processing query. Probably an exception
       // occurred in recv/send what would indicate that socket on the other
@@ -216,7 +363,7 @@ void TCPStoreMasterDaemon::queryFds(std::vector<struct pollfd>& fds) {
       clearSocketWaitState(fds[fdIdx].fd);
 
       fds.erase(fds.begin() + fdIdx);
-      sockets_.erase(sockets_.begin() + fdIdx - CONNECT_SOCKET_OFFSET);
+      sockets.erase(sockets.begin() + fdIdx - connectSocketOffset);
       --fdIdx;
       continue;
     }
@@ -224,6 +371,7 @@ void TCPStoreMasterDaemon::queryFds(std::vector<struct pollfd>& fds) {
 }
 
 void TCPStoreMasterDaemon::clearSocketWaitState(int socket) {
+  std::lock_guard<std::mutex> lock(waitMutex_);
   // Remove all the tracking state of the close FD
   for (auto it = waitingSockets_.begin(); it != waitingSockets_.end();) {
     for (auto vecIt = it->second.begin(); vecIt != it->second.end();) {
@@ -253,12 +401,14 @@ void TCPStoreMasterDaemon::clearSocketWaitState(int socket) {
 // type of query | size of arg1 | arg1 | size of arg2 | arg2 | ...
 // or, in the case of wait
 // type of query | number of args | size of arg1 | arg1 | ...
-void TCPStoreMasterDaemon::query(int socket) {
+void TCPStoreMasterDaemon::query(
+    int socket,
+    std::unordered_set<int>& miscellaneousSockets) {
   QueryType qt;
   tcputil::recvBytes<QueryType>(socket, &qt, 1);
 
-  if (isMiscellaneousSocket(socket)) {
-    removeMiscellaneousSocket(socket);
+  if (miscellaneousSockets.find(socket) != miscellaneousSockets.end()) {
+    miscellaneousSockets.erase(socket);
     if (qt == QueryType::VALIDATE) {
       validateHandler(socket);
     } else {
@@ -303,6 +453,10 @@ void TCPStoreMasterDaemon::query(int socket) {
 }
 
 void TCPStoreMasterDaemon::wakeupWaitingClients(const std::string& key) {
+  // Sending to a waiting socket from another daemon thread is safe: the
+  // client is blocked on the wait response, so its owning thread is not
+  // writing to the socket concurrently.
+  std::lock_guard<std::mutex> lock(waitMutex_);
   auto socketsToWait = waitingSockets_.find(key);
   if (socketsToWait != waitingSockets_.end()) {
     for (int socket : socketsToWait->second) {
@@ -318,7 +472,7 @@ void TCPStoreMasterDaemon::wakeupWaitingClients(const std::string& key) {
 void TCPStoreMasterDaemon::doSet(
     const std::string& key,
     const std::vector<uint8_t>& newData) {
-  tcpStore_[key] = newData;
+  store_.set(key, newData);
   // On "set", wake up all clients that have been waiting
   wakeupWaitingClients(key);
 }
@@ -344,38 +498,15 @@ void TCPStoreMasterDaemon::compareSetHandler(int socket) {
   std::vector<uint8_t> currentValue = tcputil::recvVector<uint8_t>(socket);
   std::vector<uint8_t> newValue = tcputil::recvVector<uint8_t>(socket);
 
-  auto pos = tcpStore_.find(key);
-  if (pos == tcpStore_.end()) {
-    if (currentValue.empty()) {
-      tcpStore_[key] = newValue;
-      tcputil::sendVector<uint8_t>(socket, newValue);
-    } else {
-      // TODO: This code path is not ideal as we are "lying" to the caller in
-      // case the key does not exist. We should come up with a working solution.
-      tcputil::sendVector<uint8_t>(socket, currentValue);
-    }
-  } else {
-    if (pos->second == currentValue) {
-      pos->second = std::move(newValue);
-    }
-    tcputil::sendVector<uint8_t>(socket, pos->second);
-  }
+  auto response = store_.compareSet(key, currentValue, std::move(newValue));
+  tcputil::sendVector<uint8_t>(socket, response);
 }
 
 void TCPStoreMasterDaemon::addHandler(int socket) {
   std::string key = tcputil::recvString(socket);
   int64_t addVal = tcputil::recvValue<int64_t>(socket);
 
-  auto it = tcpStore_.find(key);
-  if (it != tcpStore_.end()) {
-    auto buf = reinterpret_cast<const char*>(it->second.data());
-    auto len = it->second.size();
-    addVal += std::stoll(std::string(buf, len));
-  }
-  auto addValStr = std::to_string(addVal);
-  std::vector<uint8_t> newData =
-      std::vector<uint8_t>(addValStr.begin(), addValStr.end());
-  tcpStore_[key] = newData;
+  addVal = store_.add(key, addVal);
   // Now send the new value
   tcputil::sendValue<int64_t>(socket, addVal);
   // On "add", wake up all clients that have been waiting
@@ -384,17 +515,17 @@ void TCPStoreMasterDaemon::addHandler(int socket) {
 
 void TCPStoreMasterDaemon::getHandler(int socket) const {
   std::string key = tcputil::recvString(socket);
-  auto data = tcpStore_.at(key);
+  auto data = store_.at(key);
   tcputil::sendVector<uint8_t>(socket, data);
 }
 
 void TCPStoreMasterDaemon::getNumKeysHandler(int socket) const {
-  tcputil::sendValue<int64_t>(socket, tcpStore_.size());
+  tcputil::sendValue<int64_t>(socket, store_.numKeys());
 }
 
 void TCPStoreMasterDaemon::deleteHandler(int socket) {
   std::string key = tcputil::recvString(socket);
-  auto numDeleted = tcpStore_.erase(key);
+  auto numDeleted = store_.erase(key);
   tcputil::sendValue<int64_t>(socket, numDeleted);
 }
 
@@ -420,6 +551,11 @@ void TCPStoreMasterDaemon::waitHandler(int socket) {
   for (const auto i : c10::irange(nargs)) {
     keys[i] = tcputil::recvString(socket);
   }
+  // Hold the wait mutex across the key check and the registration so a
+  // concurrent set from another daemon thread cannot slip in between and
+  // leave this client waiting forever; setters publish the value before
+  // taking the mutex in wakeupWaitingClients().
+  std::lock_guard<std::mutex> lock(waitMutex_);
   if (checkKeys(keys)) {
     tcputil::sendValue<WaitResponseType>(
         socket, WaitResponseType::STOP_WAITING);
@@ -427,7 +563,7 @@ void TCPStoreMasterDaemon::waitHandler(int socket) {
     int numKeysToAwait = 0;
     for (auto& key : keys) {
       // Only count keys that have not already been set
-      if (tcpStore_.find(key) == tcpStore_.end()) {
+      if (!store_.contains(key)) {
         waitingSockets_[key].push_back(socket);
         numKeysToAwait++;
       }
@@ -439,12 +575,7 @@ void TCPStoreMasterDaemon::waitHandler(int socket) {
 void TCPStoreMasterDaemon::appendHandler(int socket) {
   std::string key = tcputil::recvString(socket);
   std::vector<uint8_t> newData = tcputil::recvVector<uint8_t>(socket);
-  auto it = tcpStore_.find(key);
-  if (it != tcpStore_.end()) {
-    it->second.insert(it->second.end(), newData.begin(), newData.end());
-  } else {
-    tcpStore_[key] = newData;
-  }
+  store_.append(key, newData);
   // we should not have clients waiting if we're appending, so it's all fine
   wakeupWaitingClients(key);
 }
@@ -454,7 +585,7 @@ void TCPStoreMasterDaemon::multiGetHandler(int socket) {
   tcputil::recvBytes<SizeType>(socket, &nargs, 1);
   for (const auto i : c10::irange(nargs)) {
     auto key = tcputil::recvString(socket);
-    auto& data = tcpStore_.at(key);
+    auto data = store_.at(key);
     tcputil::sendVector<uint8_t>(socket, data, i < (nargs - 1));
   }
 }
@@ -481,27 +612,10 @@ void TCPStoreMasterDaemon::cancelWaitHandler(int socket) {
 bool TCPStoreMasterDaemon::checkKeys(
     const std::vector<std::string>& keys) const {
   return std::all_of(keys.begin(), keys.end(), [this](const std::string& s) {
-    return tcpStore_.count(s) > 0;
+    return store_.contains(s);
   });
 }
 
-void TCPStoreMasterDaemon::addMiscellaneousSocket(int socket) {
-  if (miscellaneousSockets_.find(socket) == miscellaneousSockets_.end()) {
-    miscellaneousSockets_.insert(socket);
-  }
-}
-
-void TCPStoreMasterDaemon::removeMiscellaneousSocket(int socket) {
-  auto it = miscellaneousSockets_.find(socket);
-  if (it != miscellaneousSockets_.end()) {
-    miscellaneousSockets_.erase(it);
-  }
-}
-
-bool TCPStoreMasterDaemon::isMiscellaneousSocket(int socket) {
-  return miscellaneousSockets_.find(socket) != miscellaneousSockets_.end();
-}
-
 #ifdef _WIN32
 void TCPStoreMasterDaemon::run() {
   std::vector<struct pollfd> fds;
@@ -540,11 +654,26 @@ void TCPStoreMasterDaemon::run() {
       sockets_.emplace_back(std::move(socket));
       tcputil::addPollfd(fds, rawSocket, POLLIN);
     }
-    queryFds(fds);
+    queryFds(fds, sockets_, miscellaneousSockets_, CONNECT_SOCKET_OFFSET);
   }
 }
 #else
 void TCPStoreMasterDaemon::run() {
+  if (numDaemonThreads_ > 1) {
+    workers_.reserve(numDaemonThreads_);
+    for (const auto i : c10::irange(numDaemonThreads_)) {
+      (void)i;
+      auto worker = std::make_unique<Worker>();
+      if (pipe(worker->wakePipeFd.data()) == -1) {
+        TORCH_CHECK(
+            false, "Failed to create the wake pipe of a TCPStore worker");
+      }
+      worker->thread = std::thread{
+          &TCPStoreMasterDaemon::workerLoop, this, std::ref(*worker)};
+      workers_.push_back(std::move(worker));
+    }
+  }
+
   std::vector<struct pollfd> fds;
   tcputil::addPollfd(fds, storeListenSocket_.handle(), POLLIN);
   // Although we haven't found any documentation or literature describing this,
@@ -577,11 +706,15 @@ void TCPStoreMasterDaemon::run() {
                 std::to_string(fds[0].revents));
       }
       Socket socket = storeListenSocket_.accept();
-      int rawSocket = socket.handle();
-      sockets_.emplace_back(std::move(socket));
-      tcputil::addPollfd(fds, rawSocket, POLLIN);
-      // all clients are miscellaneous before getting its validation query
-      addMiscellaneousSocket(rawSocket);
+      if (!workers_.empty()) {
+        dispatchSocket(std::move(socket));
+      } else {
+        int rawSocket = socket.handle();
+        sockets_.emplace_back(std::move(socket));
+        tcputil::addPollfd(fds, rawSocket, POLLIN);
+        // all clients are miscellaneous before getting its validation query
+        miscellaneousSockets_.insert(rawSocket);
+      }
     }
 
     // The pipe receives an event which tells us to shutdown the daemon
@@ -597,8 +730,106 @@ void TCPStoreMasterDaemon::run() {
       finished = true;
       break;
     }
-    queryFds(fds);
+    queryFds(fds, sockets_, miscellaneousSockets_, CONNECT_SOCKET_OFFSET);
+  }
+
+  stopWorkers();
+}
+
+void TCPStoreMasterDaemon::dispatchSocket(Socket&& socket) {
+  auto& worker = *workers_[nextWorker_];
+  nextWorker_ = (nextWorker_ + 1) % workers_.size();
+  {
+    std::lock_guard<std::mutex> lock(worker.pendingMutex);
+    worker.pendingSockets.emplace_back(std::move(socket));
+  }
+  // One byte per dispatched socket; the worker drains its whole pending
+  // list on every wake pipe event, so spurious wakeups are harmless.
+  while (true) {
+    ssize_t written = ::write(worker.wakePipeFd[1], "\0", 1);
+    if (written < 0 && errno == EAGAIN) {
+      continue;
+    }
+    TORCH_CHECK(
+        written == 1, "Failed to write the wake pipe of a TCPStore worker");
+    break;
+  }
+}
+
+void TCPStoreMasterDaemon::workerLoop(Worker& worker) {
+  std::vector<struct pollfd> fds;
+  tcputil::addPollfd(fds, worker.wakePipeFd[0], POLLIN | POLLHUP);
+
+  // Sockets owned and exclusively serviced by this worker thread.
+  std::vector<Socket> sockets;
+  std::unordered_set<int> miscellaneousSockets;
+
+  while (true) {
+    for (auto& fd : fds) {
+      fd.revents = 0;
+    }
+
+    SYSCHECK_ERR_RETURN_NEG1(::poll(fds.data(), fds.size(), -1));
+
+    if (fds[0].revents != 0) {
+      if (fds[0].revents & ~(POLLIN | POLLHUP)) {
+        C10_THROW_ERROR(
+            DistStoreError,
+            "Unexpected poll revent on the wake pipe of a TCPStore worker: " +
+                std::to_string(fds[0].revents));
+      }
+      char dummy = 0;
+      ssize_t bytesRead = -1;
+      while (bytesRead < 0) {
+        bytesRead = ::read(worker.wakePipeFd[0], &dummy, 1);
+        if (bytesRead < 0 && errno != EAGAIN && errno != EINTR) {
+          break;
+        }
+      }
+      if (workersStopRequested_.load()) {
+        return;
+      }
+      std::vector<Socket> pending;
+      {
+        std::lock_guard<std::mutex> lock(worker.pendingMutex);
+        pending = std::move(worker.pendingSockets);
+        worker.pendingSockets.clear();
+      }
+      for (auto& socket : pending) {
+        int rawSocket = socket.handle();
+        sockets.emplace_back(std::move(socket));
+        tcputil::addPollfd(fds, rawSocket, POLLIN);
+        // all clients are miscellaneous before getting its validation query
+        miscellaneousSockets.insert(rawSocket);
+      }
+    }
+    queryFds(fds, sockets, miscellaneousSockets, /*connectSocketOffset=*/1);
+  }
+}
+
+void TCPStoreMasterDaemon::stopWorkers() {
+  if (workers_.empty()) {
+    return;
+  }
+  workersStopRequested_.store(true);
+  for (auto& worker : workers_) {
+    while (true) {
+      ssize_t written = ::write(worker->wakePipeFd[1], "\0", 1);
+      if (written < 0 && errno == EAGAIN) {
+        continue;
+      }
+      break;
+    }
+  }
+  for (auto& worker : workers_) {
+    worker->thread.join();
+    for (int fd : worker->wakePipeFd) {
+      if (fd != -1) {
+        ::close(fd);
+      }
+    }
   }
+  workers_.clear();
 }
 #endif
 
@@ -10,6 +10,7 @@
 #include <sys/types.h>
 
 #include <cstdlib>
+#include <sstream>
 #include <string>
 #include <system_error>
 #include <vector>
@@ -539,5 +540,167 @@ struct NCCLTraceBuffer {
   }
 };
 
+/* A lightweight continuous profiler for collective latency and bandwidth
+   attribution, enabled with TORCH_NCCL_COLLECTIVE_PROFILER=1. Unlike the
+   flight recorder above, which keeps live event handles for post-mortem
+   dumps, every sample here is a fully resolved number recorded by the
+   watchdog once a collective completes, so keeping it on for whole training
+   runs costs a mutexed ring-buffer write per collective. */
+struct CollectiveLatencyProfiler {
+  static CollectiveLatencyProfiler* get() {
+    // intentionally leak on exit, like NCCLTraceBuffer
+    static CollectiveLatencyProfiler* instance = new CollectiveLatencyProfiler();
+    return instance;
+  }
+  CollectiveLatencyProfiler() {
+    enabled_ = getCvarBool({"TORCH_NCCL_COLLECTIVE_PROFILER"}, false);
+    max_samples_ =
+        getCvarInt({"TORCH_NCCL_COLLECTIVE_PROFILER_BUFFER_SIZE"}, 16384);
+  }
+
+  struct Sample {
+    uint64_t seq_id_; // as tracked by the process group
+    std::string op_name_;
+    // sizes on the first device, see WorkNCCL::numelIn_
+    size_t numel_in_;
+    size_t numel_out_;
+    float duration_ms_; // GPU time between the start and end events
+    // Wall time from enqueue to watchdog-observed completion minus
+    // duration_ms_; a proxy for launch backlog and peer-wait time,
+    // quantized by the watchdog poll interval.
+    float queue_delay_ms_;
+  };
+
+  bool enabled_ = false;
+  std::mutex mutex_;
+  std::vector<Sample> samples_;
+  size_t max_samples_ = 0;
+  size_t next_ = 0;
+
+  // Running totals since process start; aggregate() exchanges per-window
+  // deltas of these through the store.
+  uint64_t total_count_ = 0;
+  double total_duration_ms_ = 0.0;
+  double total_queue_delay_ms_ = 0.0;
+  // Snapshot taken by the previous aggregate() call, so that each
+  // aggregation window covers only the collectives since the last one.
+  uint64_t agg_epoch_ = 0;
+  uint64_t last_count_ = 0;
+  double last_duration_ms_ = 0.0;
+  double last_queue_delay_ms_ = 0.0;
+
+  void sample(
+      uint64_t seq_id,
+      std::string op_name,
+      size_t numel_in,
+      size_t numel_out,
+      float duration_ms,
+      float queue_delay_ms) {
+    std::lock_guard<std::mutex> guard(mutex_);
+    total_count_ += 1;
+    total_duration_ms_ += duration_ms;
+    total_queue_delay_ms_ += queue_delay_ms;
+    Sample s{
+        seq_id,
+        std::move(op_name),
+        numel_in,
+        numel_out,
+        duration_ms,
+        queue_delay_ms};
+    if (samples_.size() < max_samples_) {
+      samples_.emplace_back(std::move(s));
+    } else {
+      samples_[next_++] = std::move(s);
+      if (next_ == max_samples_) {
+        next_ = 0;
+      }
+    }
+  }
+
+  std::vector<Sample> dump_samples() {
+    std::lock_guard<std::mutex> guard(mutex_);
+    std::vector<Sample> result;
+    result.reserve(samples_.size());
+    result.insert(result.end(), samples_.begin() + next_, samples_.end());
+    result.insert(result.end(), samples_.begin(), samples_.begin() + next_);
+    return result;
+  }
+
+  // Publishes this rank's totals for the window since the previous call and
+  // reads every other rank's, so all ranks compute the same slowest-rank
+  // attribution with no external tooling. Collective-like: every rank must
+  // call this at the same point (e.g. once per training step). Store traffic
+  // is one set() and worldSize get()s per rank per call.
+  //
+  // The rank with the smallest GPU busy time is reported as the likely
+  // straggler: it is the last to join the collectives, so every other rank
+  // burns the missing time waiting inside the kernels.
+  std::string aggregate(
+      c10::intrusive_ptr<Store>& store,
+      int rank,
+      int worldSize) {
+    uint64_t epoch = 0;
+    uint64_t count = 0;
+    double durationMs = 0.0;
+    double queueDelayMs = 0.0;
+    {
+      std::lock_guard<std::mutex> guard(mutex_);
+      epoch = agg_epoch_++;
+      count = total_count_ - last_count_;
+      durationMs = total_duration_ms_ - last_duration_ms_;
+      queueDelayMs = total_queue_delay_ms_ - last_queue_delay_ms_;
+      last_count_ = total_count_;
+      last_duration_ms_ = total_duration_ms_;
+      last_queue_delay_ms_ = total_queue_delay_ms_;
+    }
+    auto key = [&](int r) {
+      return c10::str("collective_profiler/", epoch, "/", r);
+    };
+    const std::string payload =
+        c10::str(count, " ", durationMs, " ", queueDelayMs);
+    store->set(key(rank), std::vector<uint8_t>(payload.begin(), payload.end()));
+
+    int likelyStraggler = -1;
+    double minBusyMs = 0.0;
+    int mostQueuedRank = -1;
+    double maxQueueDelayMs = -1.0;
+    std::string report =
+        c10::str("Collective profile for aggregation window #", epoch, ":");
+    for (const auto r : c10::irange(worldSize)) {
+      store->wait({key(r)});
+      const auto raw = store->get(key(r));
+      uint64_t rCount = 0;
+      double rDurationMs = 0.0;
+      double rQueueDelayMs = 0.0;
+      std::istringstream(std::string(raw.begin(), raw.end())) >> rCount >>
+          rDurationMs >> rQueueDelayMs;
+      if (likelyStraggler == -1 || rDurationMs < minBusyMs) {
+        minBusyMs = rDurationMs;
+        likelyStraggler = r;
+      }
+      if (rQueueDelayMs > maxQueueDelayMs) {
+        maxQueueDelayMs = rQueueDelayMs;
+        mostQueuedRank = r;
+      }
+      report += c10::str(
+          "\n  rank ",
+          r,
+          ": ",
+          rCount,
+          " collectives, GPU busy ",
+          rDurationMs,
+          " ms, queued ",
+          rQueueDelayMs,
+          " ms");
+    }
+    report += c10::str(
+        "\n  likely straggler (last to join, smallest GPU busy time): rank ",
+        likelyStraggler,
+        "\n  largest queueing delay (local launch backlog): rank ",
+        mostQueuedRank);
+    return report;
+  }
+};
+
 #endif
 } // namespace c10d
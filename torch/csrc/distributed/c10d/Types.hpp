@@ -125,6 +125,14 @@ struct AllreduceOptions {
   ReduceOp reduceOp = ReduceOp::SUM;
   std::chrono::milliseconds timeout = kUnsetTimeout;
   c10::optional<at::Tensor> sparseIndices = c10::nullopt;
+  // Scheduling hint for backends that support parallel collectives. When
+  // non-negative, ProcessGroupNCCL runs the allreduce on a dedicated
+  // communicator/stream lane selected by the hint instead of the single
+  // serialized internal stream, so independent collectives (e.g. DDP
+  // gradient buckets) can overlap. All ranks must issue the same sequence of
+  // hints, since the per-lane communicators are created collectively on
+  // first use. Ignored by backends without lane support.
+  int64_t streamHint = -1;
 };
 
 struct AllreduceCoalescedOptions : AllreduceOptions {};
@@ -67,6 +67,20 @@ class TORCH_API GradBucket {
     return parameters_;
   }
 
+  // Returns the offset of each parameter's gradient in the flat buffer, in
+  // the same order as getParameters(). Together with getLengths() this lets
+  // a fused optimizer step over the whole bucket buffer with one kernel
+  // instead of iterating parameter-by-parameter.
+  const std::vector<size_t>& getOffsets() const {
+    return offsets_;
+  }
+
+  // Returns the length of each parameter's gradient in the flat buffer, in
+  // the same order as getParameters().
+  const std::vector<size_t>& getLengths() const {
+    return lengths_;
+  }
+
   // Returns whther this bucket is the last bucket to allreduce in an iteration.
   bool isLast() const {
     return index_ == bucket_count_ - 1;
@@ -16,12 +16,94 @@ c10::intrusive_ptr<c10::ivalue::Future> AllReduceCommHook::runHook(
   return state_->allreduce(tensors)->getFuture();
 }
 
+namespace {
+
+// Casts the flat bucket to the given low-precision dtype and divides it by
+// the process group size in a single elementwise pass. The division happens
+// in the computation type before the low-precision store, which also avoids
+// overflow, especially for FP16.
+at::Tensor compressBucketTo(GradBucket& bucket, c10::ScalarType dtype, int size) {
+  auto& buffer = bucket.getBufferRef();
+  auto compressed_tensor = at::empty_like(buffer, buffer.options().dtype(dtype));
+  at::div_out(
+      compressed_tensor,
+      buffer,
+      at::scalar_tensor(static_cast<double>(size), at::kDouble));
+  return compressed_tensor;
+}
+
+// Sparse allreduce composed from dense allgathers, for backends without a
+// native sparse implementation. Only the deduplicated non-zero rows travel:
+// ranks exchange their nnz counts, pad indices/values to the largest count
+// (padding rows use index 0 with zero values, which contribute nothing to the
+// sum), allgather both buffers, and sum the per-rank pieces by coalescing the
+// concatenated COO tensor. The final assembly is chained onto the allgather's
+// future, so the reduction overlaps with backward like dense buckets do; the
+// only CPU synchronization is reading back the tiny nnz-count exchange.
+c10::intrusive_ptr<c10::ivalue::Future> allreduceSparseComposed(
+    const c10::intrusive_ptr<ProcessGroup>& pg,
+    GradBucket& bucket) {
+  auto sparse = bucket.getBufferRef().coalesce();
+  const int64_t worldSize = pg->getSize();
+  auto indices = sparse.indices();
+  auto values = sparse.values();
+  const int64_t sparseDim = sparse.sparse_dim();
+  const int64_t nnz = sparse._nnz();
+
+  auto nnzTensor = at::full({1}, nnz, indices.options());
+  auto allNnz = at::empty({worldSize}, indices.options());
+  pg->_allgather_base(allNnz, nnzTensor)->wait();
+  const int64_t maxNnz = allNnz.max().item<int64_t>();
+
+  if (maxNnz == 0) {
+    auto fut = c10::make_intrusive<c10::ivalue::Future>(
+        c10::ListType::create(c10::TensorType::get()));
+    fut->markCompleted(c10::IValue(std::vector<at::Tensor>{sparse}));
+    return fut;
+  }
+
+  auto paddedIndices = indices.contiguous();
+  auto paddedValues = values.contiguous();
+  if (nnz < maxNnz) {
+    paddedIndices = at::zeros({sparseDim, maxNnz}, indices.options());
+    paddedIndices.narrow(1, 0, nnz).copy_(indices);
+    auto paddedValueSizes = values.sizes().vec();
+    paddedValueSizes[0] = maxNnz;
+    paddedValues = at::zeros(paddedValueSizes, values.options());
+    paddedValues.narrow(0, 0, nnz).copy_(values);
+  }
+
+  auto allIndices =
+      at::empty({worldSize * sparseDim, maxNnz}, indices.options());
+  pg->_allgather_base(allIndices, paddedIndices)->wait();
+  auto allValueSizes = paddedValues.sizes().vec();
+  allValueSizes[0] = worldSize * maxNnz;
+  auto allValues = at::empty(allValueSizes, paddedValues.options());
+  auto work = pg->_allgather_base(allValues, paddedValues);
+
+  auto sizes = sparse.sizes().vec();
+  auto assemble = [allIndices, allValues, worldSize, sparseDim, maxNnz, sizes](
+                      c10::ivalue::Future&) {
+    // Rank-major concatenation along the nnz dimension, matching the layout
+    // of the gathered values.
+    auto catIndices = allIndices.view({worldSize, sparseDim, maxNnz})
+                          .transpose(0, 1)
+                          .reshape({sparseDim, worldSize * maxNnz});
+    auto result =
+        at::sparse_coo_tensor(catIndices, allValues, sizes).coalesce();
+    return c10::IValue(std::vector<at::Tensor>{result});
+  };
+  auto allgatherFut = work->getFuture();
+  return allgatherFut->then(
+      assemble, c10::ListType::create(c10::TensorType::get()));
+}
+
+} // namespace
+
 c10::intrusive_ptr<c10::ivalue::Future> FP16CompressCommHook::runHook(
     GradBucket& bucket) {
-  auto compressed_tensor = bucket.getBufferRef().to(torch::kFloat16);
-  // Apply the division first to avoid overflow.
-  compressed_tensor /= state_->getSize();
-  std::vector<at::Tensor> tensors = {compressed_tensor};
+  std::vector<at::Tensor> tensors = {
+      compressBucketTo(bucket, torch::kFloat16, state_->getSize())};
 
   auto allreduce_fut = state_->allreduce(tensors)->getFuture();
   auto decompressed_tensor = bucket.getBufferRef();
@@ -43,19 +125,58 @@ c10::intrusive_ptr<c10::ivalue::Future> FP16CompressCommHook::runHook(
   return allreduce_fut->then(decompress, allreduce_fut->elementType());
 }
 
+c10::intrusive_ptr<c10::ivalue::Future> BF16CompressCommHook::runHook(
+    GradBucket& bucket) {
+  std::vector<at::Tensor> tensors = {
+      compressBucketTo(bucket, torch::kBFloat16, state_->getSize())};
+
+  auto allreduce_fut = state_->allreduce(tensors)->getFuture();
+  auto decompressed_tensor = bucket.getBufferRef();
+  auto decompress = [decompressed_tensor](c10::ivalue::Future& allreduce_fut) {
+    auto result = allreduce_fut.value();
+    TORCH_INTERNAL_ASSERT(
+        result.isTensorList(),
+        "ProcessGroup::allreduce should return TensorList");
+
+    auto reduce_tensor = result.toTensorVector()[0];
+    TORCH_INTERNAL_ASSERT_DEBUG_ONLY(
+        reduce_tensor.scalar_type() == at::ScalarType::BFloat16,
+        "Expected reduced tensor to be bf16 in BF16CompressHook, but got type ",
+        reduce_tensor.scalar_type());
+    decompressed_tensor.copy_(reduce_tensor);
+    return c10::IValue(decompressed_tensor);
+  };
+
+  return allreduce_fut->then(decompress, allreduce_fut->elementType());
+}
+
 c10::intrusive_ptr<c10::ivalue::Future> _AllReduceBySumCommHook::runHook(
     GradBucket& bucket) {
+#ifndef IS_NCCL_EXP
+  // NCCL has no native sparse allreduce outside the experimental branch;
+  // exchange the deduplicated rows through allgathers instead of erroring
+  // out or densifying the gradient.
+  if (bucket.getBufferRef().layout() == c10::kSparse &&
+      state_->getBackendName() == "nccl") {
+    return allreduceSparseComposed(state_, bucket);
+  }
+#endif
   std::vector<at::Tensor> tensors = {bucket.getBufferRef()};
+  AllreduceOptions opts = AllreduceOptions();
+  if (comm_stream_lanes_ > 0) {
+    // Buckets complete in backward order, so a round-robin assignment keeps
+    // consecutive buckets on distinct lanes. Bucket indices are identical on
+    // all ranks, which keeps the lane sequence collective-safe.
+    opts.streamHint =
+        static_cast<int64_t>(bucket.getIndex()) % comm_stream_lanes_;
+  }
 #ifdef IS_NCCL_EXP
   // case with sparse_metadata_ set and using indices from there
   if (bucket.getSparseGradIndices().has_value()) {
-    AllreduceOptions opts = AllreduceOptions();
     opts.sparseIndices = bucket.getSparseGradIndices().value();
-    return state_->allreduce(tensors, opts)->getFuture();
   }
-#else
-  return state_->allreduce(tensors)->getFuture();
 #endif
+  return state_->allreduce(tensors, opts)->getFuture();
 }
 
 } // namespace c10d
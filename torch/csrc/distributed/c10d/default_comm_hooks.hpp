@@ -8,6 +8,7 @@ namespace c10d {
 enum class BuiltinCommHookType {
   ALLREDUCE = 1,
   FP16_COMPRESS = 2,
+  BF16_COMPRESS = 3,
 };
 
 class AllReduceCommHook
@@ -32,6 +33,17 @@ class FP16CompressCommHook
   c10::intrusive_ptr<c10::ivalue::Future> runHook(GradBucket& bucket) override;
 };
 
+class BF16CompressCommHook
+    : public CppCommHookInterface<c10::intrusive_ptr<ProcessGroup>> {
+ public:
+  explicit BF16CompressCommHook(const c10::intrusive_ptr<ProcessGroup>& state)
+      : CppCommHookInterface<c10::intrusive_ptr<ProcessGroup>>(state) {}
+
+  ~BF16CompressCommHook() override = default;
+
+  c10::intrusive_ptr<c10::ivalue::Future> runHook(GradBucket& bucket) override;
+};
+
 // Almost same as AllReduceCommHook, but without division inside the hook.
 // This enables the optimization of fusing copy and division and saves one scan
 // over all the input parameters, when no communication hook is provided by the
@@ -41,12 +53,20 @@ class _AllReduceBySumCommHook
     : public CppCommHookInterface<c10::intrusive_ptr<ProcessGroup>> {
  public:
   explicit _AllReduceBySumCommHook(
-      const c10::intrusive_ptr<ProcessGroup>& state)
-      : CppCommHookInterface<c10::intrusive_ptr<ProcessGroup>>(state) {}
+      const c10::intrusive_ptr<ProcessGroup>& state,
+      int64_t comm_stream_lanes = 0)
+      : CppCommHookInterface<c10::intrusive_ptr<ProcessGroup>>(state),
+        comm_stream_lanes_(comm_stream_lanes) {}
 
   ~_AllReduceBySumCommHook() override = default;
 
   c10::intrusive_ptr<c10::ivalue::Future> runHook(GradBucket& bucket) override;
+
+ private:
+  // When positive, gradient buckets are spread round-robin over this many
+  // parallel communicator/stream lanes via AllreduceOptions::streamHint, so
+  // a large bucket does not serialize behind earlier ones.
+  int64_t comm_stream_lanes_;
 };
 
 } // namespace c10d
@@ -445,12 +445,36 @@ Returns:
           py::call_guard<py::gil_scoped_release>(),
           R"(
 Replaces the tensor in the bucket with the input tensor buffer.
+)")
+      .def(
+          "offsets",
+          &::c10d::GradBucket::getOffsets,
+          py::call_guard<py::gil_scoped_release>(),
+          R"(
+Returns:
+    A list of ``int``. Each entry is the offset of a parameter's gradient in
+    the flat buffer returned by :meth:`~torch.distributed.GradBucket.buffer`,
+    in the same order as :meth:`~torch.distributed.GradBucket.parameters`.
+    Together with :meth:`~torch.distributed.GradBucket.lengths`, this allows
+    a fused optimizer to step over the whole bucket buffer at once.
+)")
+      .def(
+          "lengths",
+          &::c10d::GradBucket::getLengths,
+          py::call_guard<py::gil_scoped_release>(),
+          R"(
+Returns:
+    A list of ``int``. Each entry is the number of elements of a parameter's
+    gradient in the flat buffer returned by
+    :meth:`~torch.distributed.GradBucket.buffer`, in the same order as
+    :meth:`~torch.distributed.GradBucket.parameters`.
 )");
 
   py::enum_<::c10d::BuiltinCommHookType>(module, "BuiltinCommHookType", R"(
-An enum-like class for built-in communication hooks: ``ALLREDUCE`` and ``FP16_COMPRESS``.)")
+An enum-like class for built-in communication hooks: ``ALLREDUCE``, ``FP16_COMPRESS`` and ``BF16_COMPRESS``.)")
       .value("ALLREDUCE", ::c10d::BuiltinCommHookType::ALLREDUCE)
-      .value("FP16_COMPRESS", ::c10d::BuiltinCommHookType::FP16_COMPRESS);
+      .value("FP16_COMPRESS", ::c10d::BuiltinCommHookType::FP16_COMPRESS)
+      .value("BF16_COMPRESS", ::c10d::BuiltinCommHookType::BF16_COMPRESS);
 
   shared_ptr_class_<::c10d::Reducer>(module, "Reducer")
       .def(
@@ -509,12 +533,30 @@ An enum-like class for built-in communication hooks: ``ALLREDUCE`` and ``FP16_CO
           "_rebuild_buckets",
           &::c10d::Reducer::rebuild_buckets,
           py::call_guard<py::gil_scoped_release>())
+      .def(
+          "_set_sharded_grad_reduction",
+          &::c10d::Reducer::set_sharded_grad_reduction,
+          py::call_guard<py::gil_scoped_release>())
+      .def(
+          "_get_local_shards",
+          &::c10d::Reducer::get_local_shards,
+          py::call_guard<py::gil_scoped_release>())
+      .def(
+          "_allgather_updated_params",
+          &::c10d::Reducer::allgather_updated_params,
+          py::call_guard<py::gil_scoped_release>())
       .def(
           "_get_zeros_like_grad_buckets",
           [](::c10d::Reducer& reducer) {
             return reducer.get_grad_buckets(/* return_zero_tensors */ true);
           },
           py::call_guard<py::gil_scoped_release>())
+      .def(
+          "_get_grad_buckets",
+          [](::c10d::Reducer& reducer) {
+            return reducer.get_grad_buckets(/* return_zero_tensors */ false);
+          },
+          py::call_guard<py::gil_scoped_release>())
       .def(
           "_set_optimizer_in_backward",
           [](::c10d::Reducer& reducer) { reducer.set_optimizer_in_backward(); },
@@ -842,7 +884,8 @@ This class does not support ``__members__`` property.)");
   py::class_<::c10d::AllreduceOptions>(module, "AllreduceOptions")
       .def(py::init<>())
       .def_readwrite("reduceOp", &::c10d::AllreduceOptions::reduceOp)
-      .def_readwrite("timeout", &::c10d::AllreduceOptions::timeout);
+      .def_readwrite("timeout", &::c10d::AllreduceOptions::timeout)
+      .def_readwrite("streamHint", &::c10d::AllreduceOptions::streamHint);
 
   py::class_<::c10d::AllreduceCoalescedOptions>(
       module, "AllreduceCoalescedOptions")
@@ -1447,6 +1490,12 @@ Arguments:
               py::arg("tensor"),
               py::arg("root"),
               py::call_guard<py::gil_scoped_release>())
+          .def(
+              "broadcast_coalesced",
+              &::c10d::ProcessGroup::broadcast_coalesced,
+              py::arg("tensors"),
+              py::arg("opts") = ::c10d::BroadcastOptions(),
+              py::call_guard<py::gil_scoped_release>())
           .def(
               "allreduce",
               &::c10d::ProcessGroup::allreduce,
@@ -1898,6 +1947,12 @@ options :class:`~torch.distributed.ProcessGroupNCCL.Options`).
               py::arg("tensor"),
               py::arg("root"),
               py::call_guard<py::gil_scoped_release>())
+          .def(
+              "broadcast_coalesced",
+              &::c10d::Backend::broadcast_coalesced,
+              py::arg("tensors"),
+              py::arg("opts") = ::c10d::BroadcastOptions(),
+              py::call_guard<py::gil_scoped_release>())
           .def(
               "allreduce",
               &::c10d::Backend::allreduce,
@@ -2177,7 +2232,12 @@ options :class:`~torch.distributed.ProcessGroupNCCL.Options`).
       processGroupGloo, "_Options", processGroupOptions)
       .def(py::init<>())
       .def_readwrite("_devices", &::c10d::ProcessGroupGloo::Options::devices)
-      .def_readwrite("_threads", &::c10d::ProcessGroupGloo::Options::threads);
+      .def_readwrite("_threads", &::c10d::ProcessGroupGloo::Options::threads)
+      .def_readwrite(
+          "_connections_per_peer",
+          &::c10d::ProcessGroupGloo::Options::connections_per_peer)
+      .def_readwrite(
+          "_busy_poll", &::c10d::ProcessGroupGloo::Options::busy_poll);
 
   processGroupGloo
       .def_static(
@@ -2302,6 +2362,10 @@ options :class:`~torch.distributed.ProcessGroupNCCL.Options`).
           .def(
               "comm_split_count",
               &::c10d::ProcessGroupNCCL::getCommSplitCounter)
+          .def(
+              "_aggregate_collective_profile",
+              &::c10d::ProcessGroupNCCL::aggregateCollectiveProfile,
+              py::call_guard<py::gil_scoped_release>())
           .def(
               "_set_default_timeout",
               [](const c10::intrusive_ptr<::c10d::ProcessGroupNCCL>& self,
@@ -3,6 +3,7 @@
 #include <torch/csrc/distributed/c10d/Utils.hpp>
 #include <torch/csrc/distributed/c10d/default_comm_hooks.hpp>
 
+#include <cmath>
 #include <functional>
 
 #include <c10/core/DeviceGuard.h>
@@ -116,6 +117,7 @@ Reducer::Reducer(
       div_factor_(kUnsetDivFactor),
       static_graph_(false),
       comm_hook_(nullptr),
+      comm_stream_lanes_(getCvarInt({"DDP_COMM_STREAM_LANES"}, 0)),
       ddp_debug_level_(debug_level()),
       param_names_(std::move(param_names)),
       first_bucket_bytes_cap_(first_bucket_bytes_cap) {
@@ -127,6 +129,13 @@ Reducer::Reducer(
               << bucket_bytes_cap_
               << " first_bucket_bytes_cap: " << first_bucket_bytes_cap;
   }
+  adaptive_bucket_sizing_iterations_ =
+      getCvarInt({"DDP_ADAPTIVE_BUCKET_SIZING"}, 0);
+  if (adaptive_bucket_sizing_iterations_ > 0) {
+    LOG(INFO) << "Reducer adaptive bucket sizing enabled, measuring "
+              << adaptive_bucket_sizing_iterations_
+              << " backward passes after the first bucket rebuild.";
+  }
   // Check whether the module is multi_device_module
   {
     std::set<int> unique_devices;
@@ -442,9 +451,14 @@ void Reducer::mark_variable_ready_sparse(size_t variable_index) {
         logger_,
         "Expected variable to have sparse gradient.");
 
+    // Coalesce before communicating. Embedding backwards emit one row per
+    // lookup, so the raw sparse gradient typically repeats the same index
+    // many times over; deduplicating locally shrinks the exchanged
+    // indices/values proportionally.
+    grad = grad.coalesce();
+
     // Copy the indices of sparse metadata
     if (sparse_metadata_) {
-      grad = grad.coalesce();
       REDUCER_CHECK(
           param_names_.size() != 0, logger_, "No parameter names were found");
       std::string& param_name = param_names_[variable_index];
@@ -935,11 +949,15 @@ c10::intrusive_ptr<c10::ivalue::Future> Reducer::run_comm_hook(
 
 c10::intrusive_ptr<c10::ivalue::Future> Reducer::run_allreduce_hook(
     GradBucket& grad_bucket) {
-  _AllReduceBySumCommHook allreduce_hook(process_group_);
+  _AllReduceBySumCommHook allreduce_hook(process_group_, comm_stream_lanes_);
   return allreduce_hook.runHook(grad_bucket);
 }
 
 void Reducer::all_reduce_bucket(Bucket& bucket) {
+  if (sharded_grad_reduction_ && !bucket.expect_sparse_gradient) {
+    reduce_scatter_bucket(bucket);
+    return;
+  }
   auto variables_for_bucket = get_variables_for_bucket(next_bucket_, bucket);
   // TODO(@pietern): Ensure proper synchronization with the CUDA events
   // that recorded copies into this `gradients` tensor. If these copies are
@@ -960,9 +978,142 @@ void Reducer::all_reduce_bucket(Bucket& bucket) {
       bucket.sizes_vec,
       variables_for_bucket,
       bucket.sparse_tensor_indices);
+  if (adaptive_measurement_active()) {
+    if (adaptive_launch_times_.size() != buckets_.size()) {
+      adaptive_launch_times_.resize(buckets_.size());
+    }
+    adaptive_launch_times_[&bucket - buckets_.data()] =
+        std::chrono::steady_clock::now();
+  }
   bucket.future_work = run_comm_hook(grad_bucket);
 }
 
+void Reducer::reduce_scatter_bucket(Bucket& bucket) {
+  const int64_t world_size = process_group_->getSize();
+  const int64_t length = bucket.gradients.numel();
+  if (bucket.padded_length == 0) {
+    bucket.padded_length = (length + world_size - 1) / world_size * world_size;
+  }
+  const auto shard_length = bucket.padded_length / world_size;
+  if (!bucket.grad_shard.defined()) {
+    bucket.grad_shard = at::empty({shard_length}, bucket.gradients.options());
+  }
+  at::Tensor input = bucket.gradients;
+  if (bucket.padded_length != length) {
+    // Gradients were already divided by the world size on copy-in, so
+    // padding with zeros keeps the tail shard correct.
+    input = at::zeros({bucket.padded_length}, bucket.gradients.options());
+    input.narrow(0, 0, length).copy_(bucket.gradients);
+  }
+  auto work = process_group_->_reduce_scatter_base(bucket.grad_shard, input);
+  bucket.future_work = work->getFuture();
+}
+
+void Reducer::set_sharded_grad_reduction(bool enabled) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (enabled) {
+    REDUCER_CHECK(
+        comm_hook_ == nullptr,
+        logger_,
+        "Sharded gradient reduction cannot be combined with a DDP "
+        "communication hook.");
+    REDUCER_CHECK(
+        !gradient_as_bucket_view_,
+        logger_,
+        "Sharded gradient reduction requires gradient_as_bucket_view=False, "
+        "since per-parameter gradients are not materialized.");
+    for (const auto& bucket : buckets_) {
+      REDUCER_CHECK(
+          !bucket.expect_sparse_gradient,
+          logger_,
+          "Sharded gradient reduction does not support sparse gradients.");
+    }
+  }
+  sharded_grad_reduction_ = enabled;
+}
+
+std::vector<std::pair<at::Tensor, at::Tensor>> Reducer::get_local_shards() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  REDUCER_CHECK(
+      sharded_grad_reduction_,
+      logger_,
+      "get_local_shards() requires sharded gradient reduction to be enabled.");
+  const int64_t world_size = process_group_->getSize();
+  const int64_t rank = process_group_->getRank();
+  std::vector<std::pair<at::Tensor, at::Tensor>> shards;
+  shards.reserve(buckets_.size());
+  for (auto& bucket : buckets_) {
+    const int64_t length = bucket.gradients.numel();
+    if (bucket.padded_length == 0) {
+      bucket.padded_length =
+          (length + world_size - 1) / world_size * world_size;
+    }
+    const auto shard_length = bucket.padded_length / world_size;
+    if (!bucket.grad_shard.defined()) {
+      bucket.grad_shard =
+          at::zeros({shard_length}, bucket.gradients.options());
+    }
+    if (!bucket.flat_params.defined()) {
+      bucket.flat_params =
+          at::zeros({bucket.padded_length}, bucket.gradients.options());
+      bucket.flat_param_views.clear();
+      // Views follow the same layout logic as initialize_bucket_views so
+      // the flat copy matches the gradient bucket element for element.
+      for (const auto i : c10::irange(bucket.variables.size())) {
+        const auto& v = bucket.variables[i];
+        const auto offset = bucket.offsets[i];
+        const auto var_length = bucket.lengths[i];
+        if (v.is_non_overlapping_and_dense()) {
+          bucket.flat_param_views.push_back(
+              bucket.flat_params.as_strided(v.sizes(), v.strides(), offset));
+        } else {
+          bucket.flat_param_views.push_back(
+              bucket.flat_params.narrow(0, offset, var_length)
+                  .view(v.sizes()));
+        }
+        bucket.flat_param_views.back().copy_(v.detach());
+      }
+    }
+    shards.emplace_back(
+        bucket.flat_params.narrow(0, rank * shard_length, shard_length),
+        bucket.grad_shard);
+  }
+  return shards;
+}
+
+void Reducer::allgather_updated_params() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  REDUCER_CHECK(
+      sharded_grad_reduction_,
+      logger_,
+      "allgather_updated_params() requires sharded gradient reduction to be "
+      "enabled.");
+  const int64_t world_size = process_group_->getSize();
+  const int64_t rank = process_group_->getRank();
+  std::vector<c10::intrusive_ptr<c10d::Work>> works;
+  works.reserve(buckets_.size());
+  // Launch all gathers before waiting on any, so later gathers overlap the
+  // earlier buckets' copy-back to the real parameters.
+  for (auto& bucket : buckets_) {
+    REDUCER_CHECK(
+        bucket.flat_params.defined(),
+        logger_,
+        "get_local_shards() must be called before "
+        "allgather_updated_params().");
+    const auto shard_length = bucket.padded_length / world_size;
+    auto shard =
+        bucket.flat_params.narrow(0, rank * shard_length, shard_length);
+    works.push_back(process_group_->_allgather_base(bucket.flat_params, shard));
+  }
+  for (const auto i : c10::irange(buckets_.size())) {
+    works[i]->wait();
+    auto& bucket = buckets_[i];
+    for (const auto j : c10::irange(bucket.variables.size())) {
+      bucket.variables[j].detach().copy_(bucket.flat_param_views[j]);
+    }
+  }
+}
+
 std::vector<at::Tensor> Reducer::get_variables_for_bucket(
     size_t bucket_index,
     const Bucket& bucket) const {
@@ -1570,6 +1721,10 @@ void Reducer::finalize_backward() {
 
   // Wait for asynchronous reduction to complete, and unflatten the bucket's
   // flattened `gradients` tensor.
+  const bool measure_adaptive = adaptive_measurement_active() &&
+      adaptive_launch_times_.size() == buckets_.size();
+  c10::optional<std::chrono::time_point<std::chrono::steady_clock>>
+      prev_adaptive_completion;
   for (auto& bucket : buckets_) {
     // See Note [DDP Communication Hook]
     TORCH_INTERNAL_ASSERT(
@@ -1577,6 +1732,32 @@ void Reducer::finalize_backward() {
         "Expected bucket.future_work not to be null. "
         "This may indicate that communication hook was not properly installed.");
     bucket.future_work->wait();
+    if (measure_adaptive && !bucket.expect_sparse_gradient) {
+      // Allreduces of consecutive buckets are serialized on the comm stream,
+      // so the time each bucket occupied it is bounded below by the span from
+      // the later of (its launch, the previous completion) to its completion.
+      // The CPU observes completions late when it is not actually blocked
+      // here, which shrinks some samples toward zero; the regression in
+      // finish_adaptive_bucket_sizing tolerates that noise and degenerate
+      // fits are discarded there.
+      const auto completion = std::chrono::steady_clock::now();
+      auto started = adaptive_launch_times_[&bucket - buckets_.data()];
+      if (prev_adaptive_completion && *prev_adaptive_completion > started) {
+        started = *prev_adaptive_completion;
+      }
+      adaptive_comm_samples_.emplace_back(
+          static_cast<int64_t>(bucket.gradients.nbytes()),
+          std::chrono::duration<double, std::milli>(completion - started)
+              .count());
+      prev_adaptive_completion = completion;
+    }
+    if (sharded_grad_reduction_ && !bucket.expect_sparse_gradient) {
+      // See Note [Sharded gradient reduction (ZeRO-1)]: per-parameter
+      // gradients are not materialized; the local shard is consumed
+      // directly by the sharded optimizer.
+      div_factor_ = kUnsetDivFactor;
+      continue;
+    }
     auto future_result = comm_hook_ == nullptr
         ? detail::parseCppCommHookResult(bucket.future_work->value())
         : comm_hook_->parseHookResult(bucket.future_work->value());
@@ -1614,6 +1795,11 @@ void Reducer::finalize_backward() {
     }
   }
 
+  if (measure_adaptive &&
+      ++adaptive_measured_iterations_ >= adaptive_bucket_sizing_iterations_) {
+    finish_adaptive_bucket_sizing();
+  }
+
   if (installed_futures_ != c10::nullopt) {
     c10::collectAll(*installed_futures_)->wait();
     installed_futures_ = c10::nullopt;
@@ -1778,8 +1964,12 @@ bool Reducer::rebuild_buckets() {
           rebuilt_param_indices_.size()));
   std::vector<std::vector<size_t>> rebuilt_bucket_indices;
   std::vector<size_t> bucket_size_limits;
-  bucket_size_limits.push_back(first_bucket_bytes_cap_);
-  bucket_size_limits.push_back(bucket_bytes_cap_);
+  const int64_t bytes_cap = adaptive_bucket_bytes_cap_ > 0
+      ? adaptive_bucket_bytes_cap_
+      : bucket_bytes_cap_;
+  bucket_size_limits.push_back(
+      std::min<int64_t>(first_bucket_bytes_cap_, bytes_cap));
+  bucket_size_limits.push_back(bytes_cap);
   std::vector<size_t> per_bucket_size_limits;
   auto ddp_set_last_bucket_as_small =
       (getCvarString({"DDP_SET_LAST_BUCKET_CAP"}, "N/A") == "1");
@@ -1830,6 +2020,80 @@ bool Reducer::rebuild_buckets() {
   return true;
 }
 
+// Turns the measured (bucket bytes, allreduce ms) samples into a new bucket
+// cap and schedules one more bucket rebuild with it. A least-squares fit of
+// time = overhead + bytes / bandwidth splits each allreduce into a
+// size-independent launch cost and a bandwidth term; the end-to-end cost a
+// cap controls is then roughly the exposed tail allreduce (cap / bandwidth,
+// nothing overlaps it) plus the total launch overhead
+// (overhead * total_bytes / cap), which is minimized at
+// cap = sqrt(overhead * bandwidth * total_bytes). Every rank runs the same
+// deterministic schedule, and the rebuild itself still syncs bucket indices
+// from rank 0, so ranks whose fits disagree converge to rank 0's buckets.
+void Reducer::finish_adaptive_bucket_sizing() {
+  adaptive_rebuild_done_ = true;
+  auto samples = std::move(adaptive_comm_samples_);
+  adaptive_comm_samples_.clear();
+  adaptive_launch_times_.clear();
+
+  int64_t total_bytes = 0;
+  for (const auto& bucket : buckets_) {
+    total_bytes += static_cast<int64_t>(bucket.gradients.nbytes());
+  }
+  if (samples.size() < 4 || buckets_.size() < 2 || total_bytes == 0) {
+    LOG(INFO) << "Adaptive bucket sizing: not enough measurements ("
+              << samples.size() << " samples over " << buckets_.size()
+              << " buckets), keeping bucket_bytes_cap " << bucket_bytes_cap_;
+    return;
+  }
+
+  double mean_bytes = 0.0;
+  double mean_ms = 0.0;
+  for (const auto& sample : samples) {
+    mean_bytes += static_cast<double>(sample.first);
+    mean_ms += sample.second;
+  }
+  mean_bytes /= static_cast<double>(samples.size());
+  mean_ms /= static_cast<double>(samples.size());
+  double var_bytes = 0.0;
+  double cov = 0.0;
+  for (const auto& sample : samples) {
+    const double db = static_cast<double>(sample.first) - mean_bytes;
+    var_bytes += db * db;
+    cov += db * (sample.second - mean_ms);
+  }
+  if (var_bytes == 0.0) {
+    LOG(INFO) << "Adaptive bucket sizing: all measured buckets have the same "
+              << "size, cannot fit a bandwidth model; keeping "
+              << "bucket_bytes_cap " << bucket_bytes_cap_;
+    return;
+  }
+  const double ms_per_byte = cov / var_bytes;
+  const double overhead_ms = mean_ms - ms_per_byte * mean_bytes;
+  if (ms_per_byte <= 0.0 || overhead_ms <= 0.0) {
+    LOG(INFO) << "Adaptive bucket sizing: degenerate fit (bandwidth term "
+              << ms_per_byte << " ms/byte, overhead " << overhead_ms
+              << " ms), keeping bucket_bytes_cap " << bucket_bytes_cap_;
+    return;
+  }
+
+  const double cap = std::sqrt(
+      overhead_ms * static_cast<double>(total_bytes) / ms_per_byte);
+  adaptive_bucket_bytes_cap_ = std::min(
+      kMaxAdaptiveBucketBytes,
+      std::max(kMinAdaptiveBucketBytes, static_cast<int64_t>(cap)));
+  // Let the next backward pass collect gradient arrival order again; the
+  // rebuild_buckets call DDP issues before the following forward then
+  // rebuilds with the new cap.
+  has_rebuilt_bucket_ = false;
+  LOG(INFO) << "Adaptive bucket sizing: rebuilding with bucket_bytes_cap "
+            << adaptive_bucket_bytes_cap_ << " (was " << bucket_bytes_cap_
+            << "), fitted bandwidth "
+            << (1.0 / ms_per_byte) * 1e3 / (1024.0 * 1024.0 * 1024.0)
+            << " GiB/s, per-bucket overhead " << overhead_ms << " ms over "
+            << samples.size() << " samples.";
+}
+
 void Reducer::setSparseMetadata(std::map<std::string, at::Tensor>& metadata) {
   sparse_metadata_ =
       std::make_unique<std::map<std::string, at::Tensor>>(metadata);
@@ -1862,6 +2126,10 @@ void Reducer::register_builtin_comm_hook(
       comm_hook_ = std::make_unique<c10d::FP16CompressCommHook>(process_group_);
       LOG(INFO) << "Built-in communication hook FP16_COMPRESS is registered.";
       break;
+    case c10d::BuiltinCommHookType::BF16_COMPRESS:
+      comm_hook_ = std::make_unique<c10d::BF16CompressCommHook>(process_group_);
+      LOG(INFO) << "Built-in communication hook BF16_COMPRESS is registered.";
+      break;
     default:
       TORCH_WARN_ONCE(
           "Unknown built-in DDP comm hook type is provided. No comm hook will be used.");
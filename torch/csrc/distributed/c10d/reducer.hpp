@@ -2,10 +2,12 @@
 
 #include <c10/core/ScalarType.h>
 #include <atomic>
+#include <chrono>
 #include <memory>
 #include <mutex>
 #include <tuple>
 #include <unordered_map>
+#include <utility>
 #include <vector>
 
 #include <ATen/core/ivalue_inl.h>
@@ -30,6 +32,10 @@ constexpr int kDefaultFirstBucketBytes = int(1024 * 1024);
 constexpr int kDefaultBucketBytesCap = int(25 * 1024 * 1024);
 // Collect runtime stats once for every kDDPRuntimeLoggingSampleRate iterations.
 constexpr int kDDPRuntimeLoggingSampleRate = 100;
+// Bounds for the bucket cap picked by adaptive bucket sizing
+// (DDP_ADAPTIVE_BUCKET_SIZING), see Reducer::finish_adaptive_bucket_sizing.
+constexpr int64_t kMinAdaptiveBucketBytes = int64_t(1024 * 1024);
+constexpr int64_t kMaxAdaptiveBucketBytes = int64_t(512) * 1024 * 1024;
 
 // Forward declaration
 class Logger;
@@ -105,6 +111,34 @@ class TORCH_API Reducer {
     optim_in_backward_ = true;
   };
 
+  // Note [Sharded gradient reduction (ZeRO-1)]
+  // ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+  // When enabled, dense buckets are reduce-scattered instead of allreduced:
+  // each rank receives only its contiguous shard of the summed (pre-divided)
+  // flattened gradient, and per-parameter .grad fields are NOT materialized.
+  // A sharded optimizer consumes the shards via get_local_shards(), which
+  // returns one flat (param_shard, grad_shard) pair per bucket; the param
+  // shard is a view into a persistent flattened copy of the bucket's
+  // parameters kept in the bucket's own layout. After the optimizer step,
+  // allgather_updated_params() gathers the updated shards back into the flat
+  // copies (launched for all buckets up front so the gathers overlap the
+  // per-bucket copy-back) and writes them through to the real parameters.
+  // Shards are slices of the flattened bucket, padded up to a multiple of
+  // the world size, and do not respect parameter boundaries. Cannot be
+  // combined with a communication hook, sparse gradients, or
+  // gradient_as_bucket_view. Since rebuilding buckets reassigns shard
+  // layouts, get_local_shards() should be called after the first backward
+  // pass (once buckets have been rebuilt).
+  void set_sharded_grad_reduction(bool enabled);
+
+  // One flat (param_shard, grad_shard) pair per bucket for this rank.
+  // See Note [Sharded gradient reduction (ZeRO-1)].
+  std::vector<std::pair<at::Tensor, at::Tensor>> get_local_shards();
+
+  // Fused post-step parameter all-gather.
+  // See Note [Sharded gradient reduction (ZeRO-1)].
+  void allgather_updated_params();
+
   // Runs allreduce or installed communication hook given GradBucket instance.
   c10::intrusive_ptr<c10::ivalue::Future> run_comm_hook(
       GradBucket& grad_bucket);
@@ -386,6 +420,16 @@ class TORCH_API Reducer {
     // If no hook is registered, a temporary vanilla allreduce hook is used.
     c10::intrusive_ptr<at::ivalue::Future> future_work;
 
+    // State for sharded gradient reduction, unused otherwise.
+    // See Note [Sharded gradient reduction (ZeRO-1)]: this rank's
+    // reduce-scattered gradient shard, the persistent flattened copy of the
+    // bucket's parameters with per-variable views into it, and the
+    // communication length padded up to a multiple of the world size.
+    at::Tensor grad_shard;
+    at::Tensor flat_params;
+    std::vector<at::Tensor> flat_param_views;
+    int64_t padded_length = 0;
+
     // If this bucket should expect a single sparse gradient
     // If `true`, then this implies that `bucket.variables.size() == 1`.
     bool expect_sparse_gradient = false;
@@ -461,6 +505,30 @@ class TORCH_API Reducer {
   std::vector<int64_t> rebuilt_param_indices_;
   const int64_t bucket_bytes_cap_;
 
+  // Adaptive bucket sizing (DDP_ADAPTIVE_BUCKET_SIZING=N): after the standard
+  // arrival-order rebuild, measure per-bucket allreduce wall time for N
+  // backward passes, fit time = overhead + bytes / bandwidth, and rebuild the
+  // buckets once more with the cap that minimizes the exposed tail allreduce
+  // plus the total per-bucket launch overhead. See
+  // finish_adaptive_bucket_sizing.
+  int adaptive_bucket_sizing_iterations_ = 0;
+  bool adaptive_rebuild_done_ = false;
+  int adaptive_measured_iterations_ = 0;
+  // Cap picked by the measurement; used by rebuild_buckets instead of
+  // bucket_bytes_cap_ once set.
+  int64_t adaptive_bucket_bytes_cap_ = -1;
+  // (bucket payload bytes, allreduce service-time ms) over the measured passes
+  std::vector<std::pair<int64_t, double>> adaptive_comm_samples_;
+  // Per-bucket allreduce launch times for the current backward pass
+  std::vector<std::chrono::time_point<std::chrono::steady_clock>>
+      adaptive_launch_times_;
+
+  bool adaptive_measurement_active() const {
+    return adaptive_bucket_sizing_iterations_ > 0 && !adaptive_rebuild_done_ &&
+        has_rebuilt_bucket_;
+  }
+  void finish_adaptive_bucket_sizing();
+
 #ifndef _WIN32
   struct RpcContext {
     using ContextPtr = torch::distributed::autograd::ContextPtr;
@@ -513,6 +581,14 @@ class TORCH_API Reducer {
   void set_divide_factor();
   // kick off all reduce for the ready bucket
   void all_reduce_bucket(Bucket& bucket);
+
+  // Reduce-scatters a dense bucket into its local gradient shard.
+  // See Note [Sharded gradient reduction (ZeRO-1)].
+  void reduce_scatter_bucket(Bucket& bucket);
+
+  // Whether dense buckets are reduce-scattered into rank-local shards.
+  // See Note [Sharded gradient reduction (ZeRO-1)].
+  bool sharded_grad_reduction_ = false;
   // kick off all reduce to local used map, it can help find global unused
   // parameters
   void all_reduce_local_used_map();
@@ -527,6 +603,11 @@ class TORCH_API Reducer {
   // comm_hook_ is used to access the DDP communication hook if registered.
   std::unique_ptr<CommHookInterface> comm_hook_;
 
+  // Number of parallel communicator/stream lanes used by the default
+  // allreduce hook, read from DDP_COMM_STREAM_LANES (0 disables laning).
+  // See AllreduceOptions::streamHint.
+  int64_t comm_stream_lanes_;
+
   // Sparse metadata contains the indices that will be used
   // when calling into sparse allreduce.
   // This is only used in the sparse allreduce collective calls
@@ -84,6 +84,12 @@ enum MessageType {
   RREF_BACKWARD_REQ = 0x17 | MessageTypeFlags::REQUEST_TYPE,
   RREF_BACKWARD_RESP = 0x18 | MessageTypeFlags::RESPONSE_TYPE,
 
+  // An envelope bundling several small tensor-less request messages into one
+  // transport write; unpacked by the receiving agent, which responds to each
+  // inner message individually. See Note [RPC message coalescing] in
+  // tensorpipe_agent.cpp.
+  COALESCED_MESSAGE = 0x19 | MessageTypeFlags::REQUEST_TYPE,
+
   // Other internal message types
   EXCEPTION = 0x37 | MessageTypeFlags::RESPONSE_TYPE,
   UNKNOWN = 0x3c
@@ -2,6 +2,9 @@
 #include <torch/csrc/distributed/rpc/script_call.h>
 #include <torch/csrc/jit/serialization/pickle.h>
 
+#include <mutex>
+#include <unordered_map>
+
 namespace torch {
 namespace distributed {
 namespace rpc {
@@ -142,12 +145,27 @@ std::shared_ptr<Operator> ScriptCall::matchOperator(
   // TODO: This is a temporary solution. We should pass enough information to
   // allow deterministically matched to one operator.
 
+  // Every inbound builtin RPC resolves its operator from the serialized
+  // schema string; memoize the resolution so only the first message per
+  // schema pays for the parse and the overload scan.
+  static std::mutex cacheMutex;
+  static std::unordered_map<std::string, std::shared_ptr<Operator>> opCache;
+  {
+    std::lock_guard<std::mutex> lock(cacheMutex);
+    auto it = opCache.find(str_schema);
+    if (it != opCache.end()) {
+      return it->second;
+    }
+  }
+
   // extract symbol from the schema
   auto schema = torch::jit::parseSchema(str_schema);
   auto symbol = at::Symbol::fromQualString(schema.name());
 
   for (auto op : torch::jit::getAllOperatorsFor(symbol)) {
     if (toString(op->schema()) == str_schema) {
+      std::lock_guard<std::mutex> lock(cacheMutex);
+      opCache.emplace(str_schema, op);
       return op;
     }
   }
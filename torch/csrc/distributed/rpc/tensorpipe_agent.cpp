@@ -2,6 +2,8 @@
 
 #ifdef USE_TENSORPIPE
 
+#include <cstdlib>
+#include <cstring>
 #include <limits>
 #include <tuple>
 #include <utility>
@@ -30,6 +32,89 @@ namespace {
 const std::string kSocketIfnameEnvVar = "TP_SOCKET_IFNAME";
 const std::string kDefaultUvAddress = "127.0.0.1";
 
+// Note [RPC message coalescing]
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// Workloads that issue very many tiny RPCs (e.g. RRef fetches against a
+// parameter server) end up bound by per-message transport overhead: every
+// request is a separate pipe write and hence at least one syscall. When
+// TORCH_RPC_BATCH_WINDOW_USECS is set to a nonzero number of microseconds,
+// tensor-less request messages are parked in a per-destination batch and
+// flushed as a single COALESCED_MESSAGE envelope once the window elapses (or
+// earlier, if the batch grows past a size threshold). The receiver unpacks
+// the envelope and runs every inner request through the regular
+// RequestCallback path, responding to each one individually, so RPC
+// semantics are unchanged: each request keeps its own message id, future,
+// and timeout. Requests carrying tensors (or explicit device maps) bypass
+// coalescing since they are large enough to amortize the write and need the
+// device/stream handling of the regular path.
+const std::string kBatchWindowEnvVar = "TORCH_RPC_BATCH_WINDOW_USECS";
+constexpr size_t kBatchFlushThresholdBytes = 64 * 1024;
+
+// Packs tensor-less messages into one envelope payload: a count followed by
+// (id, type, payload size, payload bytes) per message.
+c10::intrusive_ptr<Message> coalesceMessages(
+    std::vector<c10::intrusive_ptr<Message>> messages) {
+  size_t numBytes = sizeof(uint64_t);
+  for (const auto& message : messages) {
+    numBytes += 3 * sizeof(uint64_t) + message->payload().size();
+  }
+  std::vector<char> payload;
+  payload.reserve(numBytes);
+  auto appendUint64 = [&](uint64_t value) {
+    const char* data = reinterpret_cast<const char*>(&value);
+    payload.insert(payload.end(), data, data + sizeof(uint64_t));
+  };
+  appendUint64(messages.size());
+  for (const auto& message : messages) {
+    TORCH_INTERNAL_ASSERT(
+        message->tensors().empty(),
+        "Cannot coalesce messages carrying tensors");
+    appendUint64(message->id());
+    appendUint64(static_cast<uint64_t>(message->type()));
+    appendUint64(message->payload().size());
+    payload.insert(
+        payload.end(), message->payload().begin(), message->payload().end());
+  }
+  return c10::make_intrusive<Message>(
+      std::move(payload),
+      std::vector<torch::Tensor>(),
+      MessageType::COALESCED_MESSAGE);
+}
+
+std::vector<c10::intrusive_ptr<Message>> splitCoalescedMessage(
+    const Message& envelope) {
+  const auto& payload = envelope.payload();
+  size_t offset = 0;
+  auto readUint64 = [&]() {
+    TORCH_CHECK(
+        offset + sizeof(uint64_t) <= payload.size(),
+        "Truncated coalesced RPC message");
+    uint64_t value = 0;
+    std::memcpy(&value, payload.data() + offset, sizeof(uint64_t));
+    offset += sizeof(uint64_t);
+    return value;
+  };
+  const uint64_t numMessages = readUint64();
+  std::vector<c10::intrusive_ptr<Message>> messages;
+  messages.reserve(numMessages);
+  for (uint64_t i = 0; i < numMessages; ++i) {
+    const uint64_t id = readUint64();
+    const auto type = static_cast<MessageType>(readUint64());
+    const uint64_t payloadSize = readUint64();
+    TORCH_CHECK(
+        offset + payloadSize <= payload.size(),
+        "Truncated coalesced RPC message");
+    std::vector<char> innerPayload(
+        payload.begin() + offset, payload.begin() + offset + payloadSize);
+    offset += payloadSize;
+    auto message = c10::make_intrusive<Message>(
+        std::move(innerPayload), std::vector<torch::Tensor>(), type);
+    message->setId(id);
+    messages.push_back(std::move(message));
+  }
+  return messages;
+}
+
 const std::string kGilAverageWaitTime = "agent.gil_average_wait_time_us";
 const std::string kThreadPoolSize = "agent.thread_pool_size";
 const std::string kNumIdleThreads = "agent.num_idle_threads";
@@ -419,6 +504,12 @@ TensorPipeAgent::TensorPipeAgent(
 
   // Initialize the time-series metrics tracking map
   timeSeriesMetrics_.emplace(kGilAverageWaitTime, TimeSeriesMetricsTracker());
+
+  // See Note [RPC message coalescing].
+  const char* batchWindowStr = std::getenv(kBatchWindowEnvVar.c_str());
+  if (batchWindowStr != nullptr) {
+    batchWindow_ = std::chrono::microseconds(std::stoi(batchWindowStr));
+  }
 }
 
 TensorPipeAgent::~TensorPipeAgent() {
@@ -509,6 +600,13 @@ void TensorPipeAgent::startImpl() {
   // Start the Timeout Thread
   timeoutThread_ = std::thread(&TensorPipeAgent::pollTimeoutRpcs, this);
 
+  // Start the batch flush thread if coalescing is enabled. See
+  // Note [RPC message coalescing].
+  if (batchWindow_.count() > 0) {
+    batchFlushThread_ =
+        std::thread(&TensorPipeAgent::pollOutgoingBatches, this);
+  }
+
   listener_->accept([this](
                         const tensorpipe::Error& error,
                         std::shared_ptr<tensorpipe::Pipe> pipe) {
@@ -731,58 +829,73 @@ void TensorPipeAgent::respond(std::shared_ptr<tensorpipe::Pipe>& pipe) {
         // Arm for next read
         respond(pipe);
 
-        uint64_t messageId = requestMessage->id();
-        increaseCallCount(serverActiveCalls_);
-
-        VLOG(1) << "RPC agent for " << workerInfo_.name_
-                << " received request #" << messageId << " from "
-                << pipe->getRemoteName();
-
-        // Defer user RPC UDF run to thread pool
-        threadPool_.run([this,
-                         pipe,
-                         messageId,
-                         requestMessage{std::move(requestMessage)},
-                         streams{std::move(streams)}]() mutable {
-          VLOG(1) << "RPC agent for " << workerInfo_.name_
-                  << " is running request #" << messageId << " from "
-                  << pipe->getRemoteName() << " in thread pool";
-
-          c10::intrusive_ptr<JitFuture> futureResponseMessage;
-          try {
-            // Instead of creating a MultiStreamGuard here, the ctx is passed
-            // to the callback and the MultiStreamGuard is created there,
-            // because subsequent processing can switch threads due to 1)
-            // waiting for RRef arguments to become ready 2) async_execution.
-            // Besides, the `ctx` also needs to be propagated to
-            // `process***Call` methods to synchronize CUDA streams there
-            // to make sure that we fetch the correct value from `to_here()`
-            // call.
-            futureResponseMessage =
-                cb_->operator()(*requestMessage, std::move(streams));
-          } catch (const std::exception& /* unused */) {
-            futureResponseMessage =
-                c10::make_intrusive<JitFuture>(at::AnyClassType::get());
-            futureResponseMessage->setError(std::current_exception());
+        if (requestMessage->type() == MessageType::COALESCED_MESSAGE) {
+          // Unpack the envelope and process each inner request as if it had
+          // arrived on its own. See Note [RPC message coalescing].
+          for (auto& innerMessage : splitCoalescedMessage(*requestMessage)) {
+            processIncomingRequest(pipe, std::move(innerMessage), streams);
           }
+          return;
+        }
 
-          increaseCallCount(serverActiveAsyncCalls_);
-          futureResponseMessage->addCallback(
-              [this, pipe, messageId](
-                  JitFuture& futureResponseMessage) mutable {
-                decreaseCallCount(serverActiveCalls_);
-                decreaseCallCount(serverActiveAsyncCalls_);
-                auto streams = getCurrentStreamsForDevices(
-                    futureResponseMessage.devices());
-                sendCompletedResponseMessage(
-                    pipe, futureResponseMessage, messageId, std::move(streams));
-              });
+        processIncomingRequest(
+            pipe, std::move(requestMessage), std::move(streams));
+      });
+}
 
-          VLOG(1) << "RPC agent for " << workerInfo_.name_
-                  << " done running request #" << messageId << " from "
-                  << pipe->getRemoteName() << " in thread pool";
+void TensorPipeAgent::processIncomingRequest(
+    std::shared_ptr<tensorpipe::Pipe> pipe,
+    c10::intrusive_ptr<Message> requestMessage,
+    std::vector<c10::Stream> streams) {
+  uint64_t messageId = requestMessage->id();
+  increaseCallCount(serverActiveCalls_);
+
+  VLOG(1) << "RPC agent for " << workerInfo_.name_ << " received request #"
+          << messageId << " from " << pipe->getRemoteName();
+
+  // Defer user RPC UDF run to thread pool
+  threadPool_.run([this,
+                   pipe,
+                   messageId,
+                   requestMessage{std::move(requestMessage)},
+                   streams{std::move(streams)}]() mutable {
+    VLOG(1) << "RPC agent for " << workerInfo_.name_ << " is running request #"
+            << messageId << " from " << pipe->getRemoteName()
+            << " in thread pool";
+
+    c10::intrusive_ptr<JitFuture> futureResponseMessage;
+    try {
+      // Instead of creating a MultiStreamGuard here, the ctx is passed
+      // to the callback and the MultiStreamGuard is created there,
+      // because subsequent processing can switch threads due to 1)
+      // waiting for RRef arguments to become ready 2) async_execution.
+      // Besides, the `ctx` also needs to be propagated to
+      // `process***Call` methods to synchronize CUDA streams there
+      // to make sure that we fetch the correct value from `to_here()`
+      // call.
+      futureResponseMessage =
+          cb_->operator()(*requestMessage, std::move(streams));
+    } catch (const std::exception& /* unused */) {
+      futureResponseMessage =
+          c10::make_intrusive<JitFuture>(at::AnyClassType::get());
+      futureResponseMessage->setError(std::current_exception());
+    }
+
+    increaseCallCount(serverActiveAsyncCalls_);
+    futureResponseMessage->addCallback(
+        [this, pipe, messageId](JitFuture& futureResponseMessage) mutable {
+          decreaseCallCount(serverActiveCalls_);
+          decreaseCallCount(serverActiveAsyncCalls_);
+          auto streams =
+              getCurrentStreamsForDevices(futureResponseMessage.devices());
+          sendCompletedResponseMessage(
+              pipe, futureResponseMessage, messageId, std::move(streams));
         });
-      });
+
+    VLOG(1) << "RPC agent for " << workerInfo_.name_
+            << " done running request #" << messageId << " from "
+            << pipe->getRemoteName() << " in thread pool";
+  });
 }
 
 c10::intrusive_ptr<JitFuture> TensorPipeAgent::send(
@@ -890,6 +1003,48 @@ c10::intrusive_ptr<JitFuture> TensorPipeAgent::send(
   VLOG(1) << "RPC agent for " << workerInfo_.name_ << " is sending request #"
           << messageId << " to " << clientPipe.pipe_->getRemoteName();
 
+  // Small tensor-less requests can be parked and flushed in one coalesced
+  // pipe write. See Note [RPC message coalescing].
+  if (batchWindow_.count() > 0 && requestMessage->tensors().empty() &&
+      devices.empty()) {
+    c10::optional<OutgoingBatch> fullBatch;
+    {
+      std::lock_guard<std::mutex> lock(batchMutex_);
+      auto& batch = outgoingBatches_[toWorkerInfo.id_];
+      if (batch.messages.empty()) {
+        batch.flushTime = std::chrono::steady_clock::now() + batchWindow_;
+      }
+      batch.numBytes += requestMessage->payload().size();
+      batch.messages.push_back(std::move(requestMessage));
+      if (batch.numBytes >= kBatchFlushThresholdBytes) {
+        fullBatch = std::move(batch);
+        outgoingBatches_.erase(toWorkerInfo.id_);
+      }
+    }
+    if (fullBatch.has_value()) {
+      flushOutgoingBatch(toWorkerInfo.id_, std::move(*fullBatch));
+    } else {
+      batchCV_.notify_one();
+    }
+    return futureResponseMessage->jitFuture;
+  }
+
+  writeRequest(
+      clientPipe,
+      std::move(requestMessage),
+      std::move(devices),
+      /*expectedResponses=*/1);
+
+  return futureResponseMessage->jitFuture;
+}
+
+void TensorPipeAgent::writeRequest(
+    ClientPipe& clientPipe,
+    c10::intrusive_ptr<Message> requestMessage,
+    std::vector<c10::Device> devices,
+    size_t expectedResponses) {
+  uint64_t messageId = requestMessage->id();
+
   std::vector<c10::Stream> streams;
   {
     GroupMembershipLockGuard guard(groupMembershipMutex_, isStaticGroup_);
@@ -904,7 +1059,8 @@ c10::intrusive_ptr<JitFuture> TensorPipeAgent::send(
       std::move(requestMessage),
       std::move(devices),
       std::move(streams),
-      [this, &clientPipe, messageId](const tensorpipe::Error& error) mutable {
+      [this, &clientPipe, messageId, expectedResponses](
+          const tensorpipe::Error& error) mutable {
         if (error) {
           if (error.isOfType<tensorpipe::PipeClosedError>() &&
               !rpcAgentRunning_.load()) {
@@ -923,70 +1079,112 @@ c10::intrusive_ptr<JitFuture> TensorPipeAgent::send(
         VLOG(1) << "RPC agent for " << workerInfo_.name_ << " sent request #"
                 << messageId << " to " << clientPipe.pipe_->getRemoteName();
 
-        pipeRead(
-            clientPipe.pipe_,
-            [this, &clientPipe](
-                const tensorpipe::Error& error,
-                c10::intrusive_ptr<Message> responseMessage,
-                std::vector<c10::Stream> streams) {
-              if (error) {
-                if (error.isOfType<tensorpipe::PipeClosedError>() &&
-                    !rpcAgentRunning_.load()) {
-                  // This is expected.
-                } else {
-                  LOG(WARNING)
-                      << "RPC agent for " << workerInfo_.name_
-                      << " encountered error when reading incoming response from "
-                      << clientPipe.pipe_->getRemoteName() << ": "
-                      << error.what();
-                }
-                handleClientError(clientPipe, error);
-                return;
-              }
-
-              // Identify future response message by message ID
-              uint64_t messageId = responseMessage->id();
-
-              VLOG(1) << "RPC agent for " << workerInfo_.name_
-                      << " received response #" << messageId << " from "
-                      << clientPipe.pipe_->getRemoteName();
-
-              std::shared_ptr<AtomicJitFuture> futureResponseMessage;
-              {
-                std::lock_guard<std::mutex> lock(clientPipe.mutex_);
-                // A read error will lead all following callbacks to be
-                // invoked with error, and shouldn't reach here.
-                TORCH_INTERNAL_ASSERT(
-                    !clientPipe.inError_, "Shouldn't be in error state");
-                auto it = clientPipe.pendingResponseMessage_.find(messageId);
-                TORCH_INTERNAL_ASSERT(
-                    it != clientPipe.pendingResponseMessage_.end(),
-                    "message ID ",
-                    messageId,
-                    " is not recognized");
-                futureResponseMessage = std::move(it->second);
-                clientPipe.pendingResponseMessage_.erase(it);
-              }
-
-              // Remove entry from timeoutMap_.
-              removeFromTimeoutMap(messageId);
-
-              if (responseMessage->type() == MessageType::EXCEPTION) {
-                markFutureWithError(
-                    std::move(futureResponseMessage),
-                    std::string(
-                        responseMessage->payload().begin(),
-                        responseMessage->payload().end()));
-              } else {
-                markFutureAsComplete(
-                    std::move(futureResponseMessage),
-                    std::move(responseMessage),
-                    std::move(streams));
-              }
-            });
+        // A coalesced write carries several requests, each of which will get
+        // its own response, so arm one read per expected response.
+        for (size_t i = 0; i < expectedResponses; ++i) {
+          armClientReadForResponse(clientPipe);
+        }
       });
+}
 
-  return futureResponseMessage->jitFuture;
+void TensorPipeAgent::armClientReadForResponse(ClientPipe& clientPipe) {
+  pipeRead(
+      clientPipe.pipe_,
+      [this, &clientPipe](
+          const tensorpipe::Error& error,
+          c10::intrusive_ptr<Message> responseMessage,
+          std::vector<c10::Stream> streams) {
+        if (error) {
+          if (error.isOfType<tensorpipe::PipeClosedError>() &&
+              !rpcAgentRunning_.load()) {
+            // This is expected.
+          } else {
+            LOG(WARNING)
+                << "RPC agent for " << workerInfo_.name_
+                << " encountered error when reading incoming response from "
+                << clientPipe.pipe_->getRemoteName() << ": " << error.what();
+          }
+          handleClientError(clientPipe, error);
+          return;
+        }
+
+        // Identify future response message by message ID
+        uint64_t messageId = responseMessage->id();
+
+        VLOG(1) << "RPC agent for " << workerInfo_.name_
+                << " received response #" << messageId << " from "
+                << clientPipe.pipe_->getRemoteName();
+
+        std::shared_ptr<AtomicJitFuture> futureResponseMessage;
+        {
+          std::lock_guard<std::mutex> lock(clientPipe.mutex_);
+          // A read error will lead all following callbacks to be
+          // invoked with error, and shouldn't reach here.
+          TORCH_INTERNAL_ASSERT(
+              !clientPipe.inError_, "Shouldn't be in error state");
+          auto it = clientPipe.pendingResponseMessage_.find(messageId);
+          TORCH_INTERNAL_ASSERT(
+              it != clientPipe.pendingResponseMessage_.end(),
+              "message ID ",
+              messageId,
+              " is not recognized");
+          futureResponseMessage = std::move(it->second);
+          clientPipe.pendingResponseMessage_.erase(it);
+        }
+
+        // Remove entry from timeoutMap_.
+        removeFromTimeoutMap(messageId);
+
+        if (responseMessage->type() == MessageType::EXCEPTION) {
+          markFutureWithError(
+              std::move(futureResponseMessage),
+              std::string(
+                  responseMessage->payload().begin(),
+                  responseMessage->payload().end()));
+        } else {
+          markFutureAsComplete(
+              std::move(futureResponseMessage),
+              std::move(responseMessage),
+              std::move(streams));
+        }
+      });
+}
+
+void TensorPipeAgent::flushOutgoingBatch(worker_id_t to, OutgoingBatch batch) {
+  decltype(connectedPipes_)::iterator it;
+  {
+    std::unique_lock<std::mutex> lock(connectedPipesMutex_);
+    it = connectedPipes_.find(to);
+    // The pipe was created by the send() call that parked these messages, and
+    // pipes are never removed from the map while the agent is running.
+    TORCH_INTERNAL_ASSERT(
+        it != connectedPipes_.end(),
+        "No connected pipe for worker id ",
+        to,
+        " while flushing a batch of outgoing requests");
+  }
+  ClientPipe& clientPipe = it->second;
+
+  const size_t numMessages = batch.messages.size();
+  if (numMessages == 1) {
+    // No point paying for the envelope when there is nothing to share it.
+    writeRequest(
+        clientPipe,
+        std::move(batch.messages.front()),
+        /*devices=*/{},
+        /*expectedResponses=*/1);
+    return;
+  }
+
+  VLOG(1) << "RPC agent for " << workerInfo_.name_ << " is flushing a batch of "
+          << numMessages << " requests to "
+          << clientPipe.pipe_->getRemoteName();
+
+  writeRequest(
+      clientPipe,
+      coalesceMessages(std::move(batch.messages)),
+      /*devices=*/{},
+      /*expectedResponses=*/numMessages);
 }
 
 void TensorPipeAgent::handleClientError(
@@ -1061,6 +1259,56 @@ void TensorPipeAgent::pollTimeoutRpcs() {
   }
 }
 
+void TensorPipeAgent::pollOutgoingBatches() {
+  while (rpcAgentRunning_.load()) {
+    std::unique_lock<std::mutex> lock(batchMutex_);
+
+    // Sleep until the earliest batch is due for flushing, while also handling
+    // an empty map and agent shutdown, mirroring pollTimeoutRpcs.
+    for (;;) {
+      if (!rpcAgentRunning_.load()) {
+        break;
+      }
+
+      if (!outgoingBatches_.empty()) {
+        steady_clock_time_point earliestFlush = steady_clock_time_point::max();
+        for (const auto& entry : outgoingBatches_) {
+          earliestFlush = std::min(earliestFlush, entry.second.flushTime);
+        }
+        if (std::chrono::steady_clock::now() >= earliestFlush) {
+          break;
+        }
+        batchCV_.wait_until(lock, earliestFlush);
+      } else {
+        batchCV_.wait(lock);
+      }
+    }
+
+    // Move due batches out of the map so we can write them outside the lock.
+    // On shutdown flush everything so no parked request is silently dropped.
+    const auto now = std::chrono::steady_clock::now();
+    const bool flushAll = !rpcAgentRunning_.load();
+    std::vector<std::pair<worker_id_t, OutgoingBatch>> dueBatches;
+    for (auto it = outgoingBatches_.begin(); it != outgoingBatches_.end();) {
+      if (flushAll || now >= it->second.flushTime) {
+        dueBatches.emplace_back(it->first, std::move(it->second));
+        it = outgoingBatches_.erase(it);
+      } else {
+        ++it;
+      }
+    }
+    lock.unlock();
+
+    for (auto& dueBatch : dueBatches) {
+      flushOutgoingBatch(dueBatch.first, std::move(dueBatch.second));
+    }
+
+    if (flushAll) {
+      return;
+    }
+  }
+}
+
 void TensorPipeAgent::leaveGroup() {
   std::unique_lock<std::mutex> lock(callCountMutex_);
   // local worker ActiveCallCount is 0 at this point and we will shutdown
@@ -1146,6 +1394,12 @@ void TensorPipeAgent::shutdownImpl() {
   VLOG(1) << "RPC agent for " << workerInfo_.name_
           << " done waiting for timeout thread to join";
 
+  // Join the batch flush thread, if coalescing was enabled.
+  batchCV_.notify_one();
+  if (batchFlushThread_.joinable()) {
+    batchFlushThread_.join();
+  }
+
   // This will close all the pipes and listeners, invoke all callbacks with
   // errors, turn down the I/O event loops and wait for everything to terminate.
   context_->join();
@@ -271,6 +271,35 @@ class TORCH_API TensorPipeAgent : public RpcAgent {
   // Respond to a call from a peer
   void respond(std::shared_ptr<tensorpipe::Pipe>& pipe);
 
+  // Run one inbound request (possibly unpacked from a coalesced envelope)
+  // through the request callback and schedule its response.
+  void processIncomingRequest(
+      std::shared_ptr<tensorpipe::Pipe> pipe,
+      c10::intrusive_ptr<Message> requestMessage,
+      std::vector<c10::Stream> streams);
+
+  struct ClientPipe;
+  struct OutgoingBatch;
+
+  // Arm a read on the client side of the pipe for one response message.
+  void armClientReadForResponse(ClientPipe& clientPipe);
+
+  // Write one request message over the pipe and, once the write completes,
+  // arm reads for the expected responses (more than one if the message is a
+  // coalesced envelope). See Note [RPC message coalescing].
+  void writeRequest(
+      ClientPipe& clientPipe,
+      c10::intrusive_ptr<Message> requestMessage,
+      std::vector<c10::Device> devices,
+      size_t expectedResponses);
+
+  // Flush a pending batch of coalesced messages to its destination.
+  void flushOutgoingBatch(worker_id_t to, OutgoingBatch batch);
+
+  // Function run by the batchFlushThread_ to flush batches whose coalescing
+  // window has elapsed.
+  void pollOutgoingBatches();
+
   void sendCompletedResponseMessage(
       std::shared_ptr<tensorpipe::Pipe>& pipe,
       JitFuture& futureResponseMessage,
@@ -389,6 +418,31 @@ class TORCH_API TensorPipeAgent : public RpcAgent {
   // Condition Variable to signal population of the timeoutMap_
   std::condition_variable timeoutThreadCV_;
 
+  // Outgoing coalescing state; see Note [RPC message coalescing]. Tensor-less
+  // requests are parked here per destination until their window elapses or
+  // the batch grows large enough to flush eagerly.
+  struct OutgoingBatch {
+    std::vector<c10::intrusive_ptr<Message>> messages;
+    size_t numBytes{0};
+    steady_clock_time_point flushTime;
+  };
+
+  // Coalescing window; zero disables coalescing entirely.
+  std::chrono::microseconds batchWindow_{0};
+
+  // Map of pending batches, keyed by destination worker id; guarded by
+  // batchMutex_.
+  std::unordered_map<worker_id_t, OutgoingBatch> outgoingBatches_;
+
+  // Thread that flushes pending batches once their window has elapsed.
+  std::thread batchFlushThread_;
+
+  // Mutex to guard outgoingBatches_
+  std::mutex batchMutex_;
+
+  // Condition Variable to signal population of outgoingBatches_
+  std::condition_variable batchCV_;
+
   // Returns the expiration time for an RPC by adding the current time to the
   // passed in timeout.
   inline steady_clock_time_point computeRpcMessageExpiryTime(
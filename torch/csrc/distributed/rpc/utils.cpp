@@ -344,7 +344,39 @@ c10::List<at::Tensor> cloneSparseTensors(
   return pTensors;
 }
 
-std::string wireSerialize(
+std::vector<WireSegments::Segment> WireSegments::segments() const {
+  std::vector<Segment> result;
+  result.reserve(2 + tensorData.size());
+  result.push_back({header.data(), header.size()});
+  if (payloadSize != 0) {
+    result.push_back({payloadData, payloadSize});
+  }
+  if (!metaEntry.empty()) {
+    result.push_back({metaEntry.data(), metaEntry.size()});
+  }
+  for (const auto& tensor : tensorData) {
+    // The data() pointers stay valid for CPU tensors because tensorData keeps
+    // the storages alive; getWriteableTensorData just records the tensor.
+    // Note that RPC serde doesn't support CUDA tensors yet, if we should
+    // support CUDA tensor, we need to be careful since getWritableTensorData
+    // converts CUDA tensor to cpu and data() might get destructed as we go
+    // out of scope of this loop.
+    auto writeableTensorData = jit::getWriteableTensorData(tensor);
+    result.push_back(
+        {writeableTensorData.data(), writeableTensorData.sizeInBytes()});
+  }
+  return result;
+}
+
+size_t WireSegments::totalSize() const {
+  size_t tot = 0;
+  for (const auto& segment : segments()) {
+    tot += segment.size;
+  }
+  return tot;
+}
+
+WireSegments wireSerializeSegments(
     const std::vector<char>& payload,
     const std::vector<at::Tensor>& tensors) {
   for (const auto& tensor : tensors) {
@@ -356,61 +388,57 @@ std::string wireSerialize(
         tensor.device());
   }
 
+  WireSegments buffers;
+
   struct Ent {
     std::string name;
-    const char* data;
     size_t size;
   };
   std::vector<Ent> entries;
-  std::string metaEntry;
-  std::vector<at::Tensor> tensorData;
 
   if (!payload.empty()) {
-    entries.push_back({kPayload, payload.data(), payload.size()});
+    buffers.payloadData = payload.data();
+    buffers.payloadSize = payload.size();
+    entries.push_back({kPayload, payload.size()});
   }
 
   if (!tensors.empty()) {
     torch::jit::Pickler pickler([&](const void* buf, size_t sz) -> size_t {
-      metaEntry.append(static_cast<const char*>(buf), sz);
+      buffers.metaEntry.append(static_cast<const char*>(buf), sz);
       return sz;
     });
     pickler.protocol();
     pickler.pushIValue(cloneSparseTensors(tensors));
     pickler.stop();
-    tensorData = pickler.tensorData();
-    entries.push_back({kMeta, metaEntry.data(), metaEntry.size()});
-    for (const auto i : c10::irange(tensorData.size())) {
-      // Construct WritableTensorData for each tensor in the pickler tensorData
-      // Since tensorData is in function scope, and getWritableTensorData just
-      // record the tensors, the data() pointers stay valid for CPU tensors
-      // Note that RPC serde doesn't support CUDA tensors yet, if we should
-      // support CUDA tensor, we need to be careful since getWritableTensorData
-      // converts CUDA tensor to cpu and data() might get destructed as we go
-      // out of scope of this loop.
-      auto writeableTensorData = jit::getWriteableTensorData(tensorData[i]);
-      entries.push_back(
-          {c10::to_string(i),
-           writeableTensorData.data(),
-           writeableTensorData.sizeInBytes()});
+    buffers.tensorData = pickler.tensorData();
+    entries.push_back({kMeta, buffers.metaEntry.size()});
+    for (const auto i : c10::irange(buffers.tensorData.size())) {
+      auto writeableTensorData =
+          jit::getWriteableTensorData(buffers.tensorData[i]);
+      entries.push_back({c10::to_string(i), writeableTensorData.sizeInBytes()});
     }
   }
 
-  std::string header;
-  size_t tot = 0;
   for (const auto& e : entries) {
-    tot += e.size;
-    header.append(e.name)
+    buffers.header.append(e.name)
         .append(" ")
         .append(c10::to_string(e.size))
         .append("\n");
   }
-  header.push_back('\n');
+  buffers.header.push_back('\n');
+
+  return buffers;
+}
+
+std::string wireSerialize(
+    const std::vector<char>& payload,
+    const std::vector<at::Tensor>& tensors) {
+  auto buffers = wireSerializeSegments(payload, tensors);
 
   std::string out;
-  out.reserve(header.size() + tot);
-  out.append(header);
-  for (const auto& e : entries) {
-    out.append(e.data, e.size);
+  out.reserve(buffers.totalSize());
+  for (const auto& segment : buffers.segments()) {
+    out.append(segment.data, segment.size);
   }
   return out;
 }
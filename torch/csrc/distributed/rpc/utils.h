@@ -48,6 +48,36 @@ TORCH_API std::string wireSerialize(
     const std::vector<char>& payload,
     const std::vector<at::Tensor>& tensors);
 
+// Out-of-band form of wireSerialize: rather than flattening the message into
+// a single string, the serialized bytes are exposed as an ordered list of
+// segments so a transport can scatter-gather them (writev-style) without an
+// intermediate copy. Tensor segments point directly into tensor storage;
+// `tensorData` keeps the referenced storages alive and `header`/`metaEntry`
+// own the remaining bytes, so this struct must outlive any write consuming
+// the segments. The payload segment aliases the caller's payload buffer,
+// which must stay alive as well.
+struct TORCH_API WireSegments {
+  struct Segment {
+    const char* data;
+    size_t size;
+  };
+
+  // Assembles the segment views in wire order. Built on demand so the views
+  // stay valid even after this struct has been moved.
+  std::vector<Segment> segments() const;
+  size_t totalSize() const;
+
+  std::string header;
+  const char* payloadData{nullptr};
+  size_t payloadSize{0};
+  std::string metaEntry;
+  std::vector<at::Tensor> tensorData;
+};
+
+TORCH_API WireSegments wireSerializeSegments(
+    const std::vector<char>& payload,
+    const std::vector<at::Tensor>& tensors);
+
 TORCH_API std::pair<std::vector<char>, std::vector<at::Tensor>> wireDeserialize(
     const void* data,
     size_t data_size);
@@ -20,6 +20,22 @@ struct SizeInput {
   int64_t value;
 };
 
+struct ScalarInput {
+  // The SizeInput analog for int/float scalars stored on the nodes (e.g.
+  // clip thresholds rescaled every step): static until the value changes,
+  // dynamic (a runtime input to the graph) from then on.
+  enum DynType : uint8_t { STATIC = 0, DYNAMIC = 1 };
+  ScalarInput(DynType dt, const at::Scalar& v) : dyn_type(dt), value(v) {}
+  bool same_value(const at::Scalar& other) const {
+    // only called on scalars of the same type, since the type tag is
+    // already part of the cache key
+    return value.isFloatingPoint() ? value.toDouble() == other.toDouble()
+                                   : value.toLong() == other.toLong();
+  }
+  DynType dyn_type;
+  at::Scalar value;
+};
+
 struct CacheKeyBuffer {
   CacheKeyBuffer(const uint8_t* key, uint16_t len) : data(new uint8_t[len]) {
     std::memcpy(data.get(), key, len);
@@ -165,6 +181,16 @@ struct AutogradCompilerCall {
         SizeInput(default_dyn_type, s.guard_int(__FILE__, __LINE__)));
   }
 
+  void add_scalar_input(const at::Scalar& s) {
+    // guard symbolic scalars to their concrete value, mirroring
+    // add_size_input above
+    all_scalar_inputs.emplace_back(ScalarInput(
+        ScalarInput::STATIC,
+        s.isFloatingPoint()
+            ? at::Scalar(s.toDouble())
+            : at::Scalar(s.toLong())));
+  }
+
   int emplace_hook(c10::SafePyObject&& fn) {
     hooks.emplace_back(std::move(fn));
     return hooks.size() - 1;
@@ -173,6 +199,8 @@ struct AutogradCompilerCall {
   TensorArgs tensor_args;
   std::vector<SizeInput> all_size_inputs;
   std::vector<int64_t> dyn_size_inputs;
+  std::vector<ScalarInput> all_scalar_inputs;
+  std::vector<at::Scalar> dyn_scalar_inputs;
   std::vector<c10::SafePyObject> hooks;
   NodeCalls node_calls;
   SizeInput::DynType default_dyn_type = SizeInput::STATIC;
@@ -182,9 +210,9 @@ class CompiledNodeArgs {
   // CompiledNodeArgs builds a representation of the constant values found
   // across all the nodes in the compiled graph, via 'collect' overloads. The
   // collected constants are specialized on by concatenation into a cache key.
-  // Tensor, symint arguments (which are lifted to become graph inputs rather
-  // than specialized on) are forwarded to the compiler and not included in the
-  // key.
+  // Tensor, symint and int/float scalar arguments (which are lifted to become
+  // graph inputs rather than specialized on) are forwarded to the compiler and
+  // not included in the key.
  public:
   void collect(const TensorArg& t) {
     collect_size(t.id);
@@ -239,10 +267,13 @@ class CompiledNodeArgs {
   void collect(const c10::Scalar& t) {
     auto type = t.type();
     specialize_on_bytes(type);
-    if (type == c10::ScalarType::Double) {
-      collect(t.toDouble());
-    } else if (type == c10::ScalarType::Long) {
-      collect(t.toLong());
+    if (type == c10::ScalarType::Double || type == c10::ScalarType::Long) {
+      // int/float scalar values are lifted to inputs rather than
+      // specialized on, so that scalar hyperparameters (e.g. a grad clip
+      // threshold rescaled by the lr schedule) changing between steps do
+      // not force a retrace.  Keep this in sync with
+      // SwapSavedVariables::before(at::Scalar&).
+      _compiler.add_scalar_input(t);
     } else if (type == c10::ScalarType::Bool) {
       collect(t.toBool());
     } else if (type == c10::ScalarType::ComplexDouble) {
@@ -460,26 +491,39 @@ class CompiledNodeArgs {
 struct TraceState {
   TraceState(
       const std::vector<c10::optional<c10::SymInt>>& ss,
+      const std::vector<c10::optional<at::Scalar>>& sc,
       size_t num_outputs)
-      : sym_sizes_index(0), sym_sizes(ss), outputs(num_outputs) {}
+      : sym_sizes_index(0),
+        sym_sizes(ss),
+        sym_scalars_index(0),
+        sym_scalars(sc),
+        outputs(num_outputs) {}
 
   void debug_asserts() {
     TORCH_INTERNAL_ASSERT(sym_sizes_index == sym_sizes.size());
+    TORCH_INTERNAL_ASSERT(sym_scalars_index == sym_scalars.size());
   }
   c10::optional<c10::SymInt> next_sym_size() {
     TORCH_INTERNAL_ASSERT(sym_sizes_index < sym_sizes.size());
     return sym_sizes[sym_sizes_index++];
   }
+  c10::optional<at::Scalar> next_sym_scalar() {
+    TORCH_INTERNAL_ASSERT(sym_scalars_index < sym_scalars.size());
+    return sym_scalars[sym_scalars_index++];
+  }
 
   size_t sym_sizes_index;
   std::vector<c10::optional<c10::SymInt>> sym_sizes;
+  size_t sym_scalars_index;
+  std::vector<c10::optional<at::Scalar>> sym_scalars;
   variable_list outputs;
 };
 
 class SwapSavedVariables {
   // SwapSavedVariables is used during the tracing/compilation phase after a
-  // cache-miss. It swaps any 'lifted' inputs (tensors, symints) to proxy nodes,
-  // allows tracing to happen, then swaps them back afterwards.
+  // cache-miss. It swaps any 'lifted' inputs (tensors, symints, int/float
+  // scalars) to proxy nodes, allows tracing to happen, then swaps them back
+  // afterwards.
  public:
   void before(at::Tensor& t) {
     TensorArg& arg = compiler.tensor_args.lookup(t);
@@ -516,6 +560,27 @@ class SwapSavedVariables {
     stashed_symints.restore(&t);
   }
 
+  void before(at::Scalar& t) {
+    auto type = t.type();
+    if (type != c10::ScalarType::Double && type != c10::ScalarType::Long) {
+      // only int/float scalars are lifted, see
+      // CompiledNodeArgs::collect(const c10::Scalar&)
+      return;
+    }
+    stashed_scalars.save(&t, at::Scalar(t));
+    auto opt_value = state.next_sym_scalar();
+    if (opt_value.has_value()) {
+      t = *opt_value; // dynamic scalar
+    }
+  }
+  void after(at::Scalar& t) {
+    auto type = t.type();
+    if (type != c10::ScalarType::Double && type != c10::ScalarType::Long) {
+      return;
+    }
+    stashed_scalars.restore(&t);
+  }
+
   void before(Edge& t) {
     if (t.is_valid()) {
       // need for symints used by validate_outputs
@@ -616,7 +681,6 @@ class SwapSavedVariables {
   NO_OP_VISIT(c10::Layout);
   NO_OP_VISIT(c10::MemoryFormat);
   NO_OP_VISIT(c10::ScalarType);
-  NO_OP_VISIT(c10::Scalar);
   NO_OP_VISIT(c10::TensorOptions);
   NO_OP_VISIT(std::string);
   NO_OP_VISIT(int64_t);
@@ -643,6 +707,7 @@ class SwapSavedVariables {
     stashed_variables.debug_assert();
     stashed_tensors.debug_assert();
     stashed_symints.debug_assert();
+    stashed_scalars.debug_assert();
   }
 
  private:
@@ -693,6 +758,7 @@ class SwapSavedVariables {
   StashedVars<SavedVariable> stashed_variables;
   StashedVars<at::Tensor> stashed_tensors;
   StashedVars<c10::SymInt> stashed_symints;
+  StashedVars<at::Scalar> stashed_scalars;
 };
 
 } // namespace torch::dynamo::autograd
@@ -154,9 +154,34 @@ class TensorCheck {
 
 typedef std::vector<TensorCheck> ChecksList;
 
+// Scalar guard state for one tensor, packed so the hot loop in
+// TensorGuards_check walks flat arrays instead of chasing TensorCheck
+// objects (which each own two std::vectors). Guards whose sizes/strides are
+// all concrete ints additionally have them flattened into a shared int64
+// array; guards with dynamic dims fall back to TensorCheck::check.
+struct PackedTensorCheck {
+  uint64_t dispatch_key;
+  int64_t dim;
+  uint32_t shape_offset; // into CompiledChecks::shape_data: sizes, strides
+  at::ScalarType dtype;
+  at::DeviceIndex device_index;
+  bool requires_grad;
+  bool fully_static;
+};
+
+struct CompiledChecks {
+  std::vector<PackedTensorCheck> packed;
+  std::vector<int64_t> shape_data;
+  // Check order; on a failed check the failing guard is swapped one slot
+  // toward the front (self-organizing list), so the guards observed to fail
+  // most often are tried first and recompilation checks fast-fail.
+  std::vector<uint32_t> order;
+};
+
 typedef struct {
   PyObject_HEAD;
   ChecksList* checks;
+  CompiledChecks* compiled;
 } TensorGuards;
 
 static void TensorGuards_dealloc(TensorGuards* self) {
@@ -164,6 +189,10 @@ static void TensorGuards_dealloc(TensorGuards* self) {
     delete self->checks;
     self->checks = nullptr;
   }
+  if (self->compiled != nullptr) {
+    delete self->compiled;
+    self->compiled = nullptr;
+  }
   Py_TYPE(self)->tp_free((PyObject*)self);
 }
 
@@ -174,6 +203,7 @@ static PyObject* TensorGuards_new(
   TensorGuards* self = (TensorGuards*)type->tp_alloc(type, 0);
   if (self != nullptr) {
     self->checks = new ChecksList();
+    self->compiled = new CompiledChecks();
   }
   return (PyObject*)self;
 }
@@ -259,8 +289,11 @@ static int TensorGuards_init(
           get_dynamic_dims(dynamic_dims_strides_py);
 
   auto& checks = *self->checks;
+  auto& compiled = *self->compiled;
   auto len = PyTuple_GET_SIZE(args);
   checks.reserve(len);
+  compiled.packed.reserve(len);
+  compiled.order.reserve(len);
   LocalState state;
 
   for (auto i : c10::irange(len)) {
@@ -279,6 +312,36 @@ static int TensorGuards_init(
         ? wrapIntegersInOptional(tensor.sym_strides())
         : per_tensor_dynamic_dims_strides[i];
 
+    PackedTensorCheck packed{};
+    packed.dispatch_key = state.apply(tensor.key_set()).raw_repr();
+    packed.dim = static_cast<int64_t>(tensor_dims_size.size());
+    packed.shape_offset = static_cast<uint32_t>(compiled.shape_data.size());
+    packed.dtype = tensor.dtype().toScalarType();
+    packed.device_index = tensor.device().index();
+    packed.requires_grad = tensor.requires_grad();
+    packed.fully_static =
+        tensor_dims_size.size() == tensor_dims_stride.size();
+    for (auto* dims : {&tensor_dims_size, &tensor_dims_stride}) {
+      if (!packed.fully_static) {
+        break;
+      }
+      for (auto& d : *dims) {
+        auto concrete =
+            d.has_value() ? d->maybe_as_int() : c10::optional<int64_t>();
+        if (!concrete.has_value()) {
+          packed.fully_static = false;
+          break;
+        }
+        compiled.shape_data.push_back(*concrete);
+      }
+    }
+    if (!packed.fully_static) {
+      // drop any partially flattened shape data
+      compiled.shape_data.resize(packed.shape_offset);
+    }
+    compiled.packed.push_back(packed);
+    compiled.order.push_back(static_cast<uint32_t>(i));
+
     checks.emplace_back(
         state,
         Py_TYPE(item),
@@ -308,24 +371,64 @@ PyObject* TensorGuards_check(
   }
 
   LocalState state;
+  auto& compiled = *self->compiled;
   // Note - all the tensors that make it to guards must be unique. Dynamo
   // builder handles guarding for positive aliases (X is Y). However, we do not
   // create guards for negative alias (X is not Y) as that is an N^2
   // relationship. Instead, we rely on the uniqueness upstream to verify, at
   // check_fn time (this function).
   ska::flat_hash_map<PyObject*, std::nullptr_t> unique_tensors;
-  for (auto i : c10::irange(len)) {
+  // Guards are visited in compiled.order (most-failing first); every guard
+  // is still checked, so the uniqueness set is complete by the end.
+  for (auto oi : c10::irange(len)) {
+    uint32_t i = compiled.order[oi];
     PyObject* item = PyTuple_GET_ITEM(args, i);
 
-    if (Py_TYPE(item) != checks[i].pytype) {
-      Py_RETURN_FALSE;
-    }
-    auto insertion = unique_tensors.insert({item, nullptr});
-    if (!insertion.second) {
-      // Violates uniqueness
-      Py_RETURN_FALSE;
+    bool ok = Py_TYPE(item) == checks[i].pytype;
+    if (ok) {
+      auto insertion = unique_tensors.insert({item, nullptr});
+      if (!insertion.second) {
+        // Violates uniqueness
+        Py_RETURN_FALSE;
+      }
+      const auto& v = THPVariable_Unpack(item);
+      const PackedTensorCheck& p = compiled.packed[i];
+      if (p.fully_static &&
+          !v.unsafeGetTensorImpl()->has_symbolic_sizes_strides()) {
+        // Compare all scalar properties with accumulated differences rather
+        // than a branch per field; a single well-predicted branch decides
+        // the common all-match case.
+        uint64_t mismatch =
+            p.dispatch_key ^ state.apply(v.key_set()).raw_repr();
+        mismatch |= static_cast<uint64_t>(p.dtype != v.dtype().toScalarType());
+        mismatch |=
+            static_cast<uint64_t>(p.device_index != v.device().index());
+        mismatch |=
+            static_cast<uint64_t>(p.requires_grad != v.requires_grad());
+        mismatch |= static_cast<uint64_t>(p.dim != v.ndimension());
+        if (mismatch == 0 && p.dim > 0) {
+          const int64_t* expected = compiled.shape_data.data() + p.shape_offset;
+          auto sizes = v.sizes();
+          auto strides = v.strides();
+          int64_t diff = 0;
+          for (int64_t j = 0; j < p.dim; ++j) {
+            diff |= sizes[j] ^ expected[j];
+            diff |= strides[j] ^ expected[p.dim + j];
+          }
+          mismatch |= static_cast<uint64_t>(diff != 0);
+        }
+        ok = mismatch == 0;
+      } else {
+        // Guards with dynamic dims keep the original SymInt-aware check.
+        ok = checks[i].check(state, v);
+      }
     }
-    if (!checks[i].check(state, THPVariable_Unpack(item))) {
+    if (!ok) {
+      // Self-organizing order: promote the failing guard one slot so the
+      // most discriminating guards migrate to the front over time.
+      if (oi > 0) {
+        std::swap(compiled.order[oi], compiled.order[oi - 1]);
+      }
       Py_RETURN_FALSE;
     }
   }
@@ -20,9 +20,13 @@ CacheKey for each original node to find the next edge in the shadow graph.
 Two different graphs might have a shared common prefix in the shadow
 graph, but then diverge at the first difference. Tensors, SavedVariables,
 and SymInt found stored on the nodes in the autograd graph are lifted to
-become inputs to the graph. All other properties (ints, floats, types,
-etc.) are specialized using the CacheKey and will result in landing on
-a different cache node in the shadow graph if some property differs.
+become inputs to the graph. Int/float scalars stored on the nodes start
+out specialized, but are promoted to inputs the first time their value
+changes (see CacheNode::check_dynamic_scalars), so steady-state training
+replays one compiled graph as scalar hyperparameters vary. All other
+properties (types, bools, etc.) are specialized using the CacheKey and
+will result in landing on a different cache node in the shadow graph if
+some property differs.
 
 To interact with the (hundreds) of different autograd::Node types,
 we use a visitor pattern that walks each Node structure recursively.
@@ -57,6 +61,19 @@ static PyObject* wrap_int_list(const std::vector<int64_t>& inputs) {
   return pyinput;
 }
 
+static PyObject* wrap_scalar(const at::Scalar& scalar) {
+  return scalar.isFloatingPoint() ? PyFloat_FromDouble(scalar.toDouble())
+                                  : PyLong_FromSsize_t(scalar.toLong());
+}
+
+static PyObject* wrap_scalar_list(const std::vector<at::Scalar>& inputs) {
+  PyObject* pyinput = PyTuple_New(static_cast<Py_ssize_t>(inputs.size()));
+  for (const auto i : c10::irange(inputs.size())) {
+    PyTuple_SET_ITEM(pyinput, i, wrap_scalar(inputs[i]));
+  }
+  return pyinput;
+}
+
 static PyObject* convert_hook_list(std::vector<c10::SafePyObject>& inputs) {
   // inplace, consumes the input hooks
   PyObject* pyinput = PyTuple_New(static_cast<Py_ssize_t>(inputs.size()));
@@ -105,6 +122,7 @@ struct CacheNode {
     next.clear();
     key_storage.clear();
     expected_sizes.clear();
+    expected_scalars.clear();
     compiled_fn = nullptr;
   }
 
@@ -165,6 +183,45 @@ struct CacheNode {
     return cache_hit;
   }
 
+  bool check_dynamic_scalars(AutogradCompilerCall& call) {
+    // Same policy as check_dynamic_sizes, for the int/float scalars lifted
+    // off the nodes: assumed static until their value changes, then marked
+    // dynamic (a runtime input) so further changes reuse the compiled graph.
+    bool cache_hit = compiled_fn.get() != nullptr;
+    auto len = call.all_scalar_inputs.size();
+    const ScalarInput* data = call.all_scalar_inputs.data();
+    if (expected_scalars.empty()) {
+      expected_scalars.reserve(len);
+      for (const auto i : c10::irange(len)) {
+        expected_scalars.emplace_back(data[i]);
+      }
+    }
+
+    TORCH_INTERNAL_ASSERT(
+        expected_scalars.size() == call.all_scalar_inputs.size());
+    for (const auto i : c10::irange(len)) {
+      auto& expected = expected_scalars[i];
+      bool changed = !expected.same_value(data[i].value);
+      if (expected.dyn_type == ScalarInput::DYNAMIC || changed) {
+        cache_hit = cache_hit && expected.dyn_type == ScalarInput::DYNAMIC;
+        if (changed) {
+          expected = ScalarInput(ScalarInput::DYNAMIC, data[i].value);
+        }
+        if (call.dyn_scalar_inputs.empty()) {
+          call.dyn_scalar_inputs.reserve(len);
+        }
+        call.dyn_scalar_inputs.emplace_back(data[i].value);
+      }
+    }
+
+    if (!cache_hit) {
+      // we missed cache because static scalar inputs didn't match; force
+      // recompilation with the varying scalar input as dynamic
+      compiled_fn = nullptr;
+    }
+    return cache_hit;
+  }
+
   PyObject* wrap_dynamic_inputs() {
     size_t dynamic_count = 0;
     size_t idx = 0;
@@ -203,9 +260,55 @@ struct CacheNode {
     return result;
   }
 
+  PyObject* wrap_dynamic_scalars() {
+    size_t dynamic_count = 0;
+    size_t idx = 0;
+    for (const auto& i : expected_scalars) {
+      if (i.dyn_type == ScalarInput::DYNAMIC) {
+        ++dynamic_count;
+      }
+    }
+    PyObject* pyinput = PyTuple_New(static_cast<Py_ssize_t>(dynamic_count));
+    for (const auto& i : expected_scalars) {
+      if (i.dyn_type == ScalarInput::DYNAMIC) {
+        PyTuple_SET_ITEM(pyinput, idx++, wrap_scalar(i.value));
+      }
+    }
+    TORCH_INTERNAL_ASSERT(idx == dynamic_count);
+    return pyinput;
+  }
+
+  std::vector<c10::optional<at::Scalar>> unwrap_dynamic_scalars(
+      PyObject* pyresult) {
+    TORCH_INTERNAL_ASSERT(PyList_CheckExact(pyresult));
+    size_t idx = 0;
+    size_t result_len = PyList_GET_SIZE(pyresult);
+    std::vector<c10::optional<at::Scalar>> result;
+    result.reserve(expected_scalars.size());
+    for (const auto& i : expected_scalars) {
+      if (i.dyn_type == ScalarInput::DYNAMIC) {
+        TORCH_INTERNAL_ASSERT(idx < result_len);
+        PyObject* item = PyList_GET_ITEM(pyresult, idx++);
+        // dynamic scalars are traced as symfloats/symints, matching the
+        // type recorded in the cache key
+        if (i.value.isFloatingPoint()) {
+          result.emplace_back(at::Scalar(py::cast<c10::SymFloat>(item)));
+        } else {
+          result.emplace_back(at::Scalar(py::cast<c10::SymInt>(item)));
+        }
+      } else {
+        result.emplace_back();
+      }
+    }
+    TORCH_INTERNAL_ASSERT(
+        idx == result_len && result.size() == expected_scalars.size());
+    return result;
+  }
+
   std::unordered_map<CacheKey, std::unique_ptr<CacheNode>> next;
   std::vector<CacheKeyBuffer> key_storage;
   std::vector<SizeInput> expected_sizes;
+  std::vector<ScalarInput> expected_scalars;
 
   THPObjectPtr compiled_fn;
 };
@@ -260,11 +363,19 @@ static TraceState call_begin_capture(
   static PyObject* method_name = PyUnicode_InternFromString("begin_capture");
   THPObjectPtr pyinput(THPVariable_WrapList(compiler_call.tensor_args.inputs));
   THPObjectPtr pysizeinput(cache.wrap_dynamic_inputs());
+  THPObjectPtr pyscalarinput(cache.wrap_dynamic_scalars());
   THPObjectPtr pyresult(check(PyObject_CallMethodObjArgs(
-      self, method_name, pyinput.get(), pysizeinput.get(), nullptr)));
-
-  PyObject *fake_inputs{nullptr}, *fake_sizes{nullptr};
-  check(PyArg_ParseTuple(pyresult.get(), "OO", &fake_inputs, &fake_sizes));
+      self,
+      method_name,
+      pyinput.get(),
+      pysizeinput.get(),
+      pyscalarinput.get(),
+      nullptr)));
+
+  PyObject *fake_inputs{nullptr}, *fake_sizes{nullptr},
+      *fake_scalars{nullptr};
+  check(PyArg_ParseTuple(
+      pyresult.get(), "OOO", &fake_inputs, &fake_sizes, &fake_scalars));
 
   variable_list proxy_inputs = THPVariable_UnpackList(fake_inputs);
   TORCH_INTERNAL_ASSERT(
@@ -275,7 +386,10 @@ static TraceState call_begin_capture(
     arg.proxy_tensor = proxy_inputs[i];
   }
 
-  return TraceState(cache.unwrap_dynamic_inputs(fake_sizes), num_outputs);
+  return TraceState(
+      cache.unwrap_dynamic_inputs(fake_sizes),
+      cache.unwrap_dynamic_scalars(fake_scalars),
+      num_outputs);
 }
 
 static PyObject* call_end_capture(PyObject* self, const variable_list& inputs) {
@@ -367,7 +481,11 @@ variable_list compiled_autograd(
   }
 
   // TODO(jansel): some dynamic sizes seem to be ints not symints
-  if (!cache->check_dynamic_sizes(compiler_call)) {
+  // note: both checks must always run, they promote changed inputs to
+  // dynamic and populate the runtime input lists as side effects
+  bool cache_hit = cache->check_dynamic_sizes(compiler_call);
+  cache_hit = cache->check_dynamic_scalars(compiler_call) && cache_hit;
+  if (!cache_hit) {
     // cache miss, need to capture FX graph
     ClosingTHPObjectPtr py_compiler(
         check(PyObject_CallNoArgs((the_autograd_compiler))));
@@ -475,9 +593,15 @@ variable_list compiled_autograd(
 
   THPObjectPtr inputs(THPVariable_WrapList(compiler_call.tensor_args.inputs));
   THPObjectPtr sizes(wrap_int_list(compiler_call.dyn_size_inputs));
+  THPObjectPtr scalars(wrap_scalar_list(compiler_call.dyn_scalar_inputs));
   THPObjectPtr hooks(convert_hook_list(compiler_call.hooks));
   THPObjectPtr pyresult(check(PyObject_CallFunctionObjArgs(
-      cache->compiled_fn.get(), inputs.get(), sizes.get(), hooks.get(), NULL)));
+      cache->compiled_fn.get(),
+      inputs.get(),
+      sizes.get(),
+      scalars.get(),
+      hooks.get(),
+      NULL)));
   variable_list outputs = THPVariable_UnpackList(pyresult);
   TORCH_INTERNAL_ASSERT(outputs.size() == output_edges.size());
   return outputs;
@@ -4,6 +4,8 @@
 #include <torch/csrc/inductor/aoti_model_container_runner.h>
 #include <torch/csrc/inductor/aoti_torch/tensor_converter.h>
 
+#include <sstream>
+
 namespace torch::inductor {
 
 AOTIModelContainerRunner::AOTIModelContainerRunner(
@@ -87,5 +89,63 @@ std::vector<const char*> AOTIModelContainerRunner::get_call_spec() {
   return call_spec;
 }
 
+void AOTIModelVariantRunner::add_variant(
+    DimSpec input_sizes,
+    std::unique_ptr<AOTIModelContainerRunner> runner) {
+  TORCH_CHECK(runner != nullptr, "add_variant expects a loaded model runner");
+  variants_.push_back(Variant{std::move(input_sizes), std::move(runner)});
+}
+
+void AOTIModelVariantRunner::share_constant_buffer(
+    const TensorConstantMap& const_map) {
+  for (auto& variant : variants_) {
+    variant.runner->update_inactive_constant_buffer(const_map);
+    variant.runner->swap_constant_buffer();
+  }
+}
+
+bool AOTIModelVariantRunner::matches(
+    const DimSpec& spec,
+    const std::vector<at::Tensor>& inputs) {
+  if (spec.size() != inputs.size()) {
+    return false;
+  }
+  for (size_t i = 0; i < spec.size(); i++) {
+    const auto sizes = inputs[i].sizes();
+    if (spec[i].size() != static_cast<size_t>(sizes.size())) {
+      return false;
+    }
+    for (size_t d = 0; d < spec[i].size(); d++) {
+      if (spec[i][d] != -1 && spec[i][d] != sizes[d]) {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+std::vector<at::Tensor> AOTIModelVariantRunner::run(
+    std::vector<at::Tensor> inputs,
+    AOTInductorStreamHandle cuda_stream_handle,
+    AOTIProxyExecutorHandle proxy_executor_handle) {
+  for (auto& variant : variants_) {
+    if (matches(variant.input_sizes, inputs)) {
+      return variant.runner->run(
+          std::move(inputs), cuda_stream_handle, proxy_executor_handle);
+    }
+  }
+  std::ostringstream dims;
+  for (const auto& input : inputs) {
+    dims << input.sizes() << " ";
+  }
+  TORCH_CHECK(
+      false,
+      "No compiled variant matches input dims ",
+      dims.str(),
+      "among ",
+      variants_.size(),
+      " registered variants");
+}
+
 } // namespace torch::inductor
 #endif
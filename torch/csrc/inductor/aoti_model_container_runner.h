@@ -71,5 +71,50 @@ class TORCH_API AOTIModelContainerRunnerCpu : public AOTIModelContainerRunner {
   }
 };
 
+// Dispatches each call to one of several compiled variants of the same model,
+// e.g. one artifact per sequence-length bucket. All variants can be pointed
+// at one set of weight tensors through share_constant_buffer, so adding
+// buckets does not multiply the resident weight footprint.
+class TORCH_API AOTIModelVariantRunner {
+ public:
+  // One entry per model input, each holding the sizes the variant was
+  // compiled for; -1 entries match any extent of that dimension.
+  using DimSpec = std::vector<std::vector<int64_t>>;
+
+  // Variants are matched in registration order; register the most specific
+  // spec first when specs overlap.
+  void add_variant(
+      DimSpec input_sizes,
+      std::unique_ptr<AOTIModelContainerRunner> runner);
+
+  size_t num_variants() const {
+    return variants_.size();
+  }
+
+  // Swaps every variant's constant buffer to the given tensors, so all
+  // variants read the same weight blob and duplicate per-artifact weight
+  // loads can be freed.
+  void share_constant_buffer(const TensorConstantMap& const_map);
+
+  // Runs the first variant whose spec matches the input dims; throws if no
+  // variant matches.
+  std::vector<at::Tensor> run(
+      std::vector<at::Tensor> inputs,
+      AOTInductorStreamHandle cuda_stream_handle = nullptr,
+      AOTIProxyExecutorHandle proxy_executor_handle = nullptr);
+
+ private:
+  struct Variant {
+    DimSpec input_sizes;
+    std::unique_ptr<AOTIModelContainerRunner> runner;
+  };
+
+  static bool matches(
+      const DimSpec& spec,
+      const std::vector<at::Tensor>& inputs);
+
+  std::vector<Variant> variants_;
+};
+
 } // namespace torch::inductor
 #endif
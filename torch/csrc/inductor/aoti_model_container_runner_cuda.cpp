@@ -1,18 +1,59 @@
+#include <ATen/cuda/CUDAEvent.h>
 #include <c10/cuda/CUDAStream.h>
 #include <torch/csrc/inductor/aoti_model_container_runner_cuda.h>
 
 namespace torch::inductor {
 
+AOTIModelContainerRunnerCuda::AOTIModelContainerRunnerCuda(
+    const char* model_path,
+    size_t num_models,
+    const char* cubin_dir,
+    size_t num_concurrent_streams)
+    : AOTIModelContainerRunner(model_path, num_models, false, cubin_dir) {
+  streams_.reserve(num_concurrent_streams);
+  for (size_t i = 0; i < num_concurrent_streams; ++i) {
+    streams_.push_back(c10::cuda::getStreamFromPool());
+  }
+}
+
 std::vector<at::Tensor> AOTIModelContainerRunnerCuda::run(
     std::vector<at::Tensor> inputs,
     AOTInductorStreamHandle cuda_stream_handle,
     AOTIProxyExecutorHandle proxy_executor_handle) {
   if (cuda_stream_handle == nullptr) {
-    cudaStream_t stream_id = c10::cuda::getCurrentCUDAStream().stream();
-    cuda_stream_handle = reinterpret_cast<AOTInductorStreamHandle>(stream_id);
+    if (streams_.empty()) {
+      cudaStream_t stream_id = c10::cuda::getCurrentCUDAStream().stream();
+      cuda_stream_handle = reinterpret_cast<AOTInductorStreamHandle>(stream_id);
+    } else {
+      // Pool mode: round-robin over the runner-owned streams so concurrent
+      // callers overlap on the device. An explicit stream argument always
+      // takes precedence over the pool.
+      c10::cuda::CUDAStream run_stream = streams_
+          [next_stream_.fetch_add(1, std::memory_order_relaxed) %
+           streams_.size()];
+      c10::cuda::CUDAStream current_stream =
+          c10::cuda::getCurrentCUDAStream(run_stream.device_index());
+
+      // Inputs may still be pending on the caller's stream; order the run
+      // stream after it, and afterwards order the caller's stream after the
+      // run, so outputs can be consumed without explicit synchronization.
+      at::cuda::CUDAEvent inputs_ready;
+      inputs_ready.record(current_stream);
+      inputs_ready.block(run_stream);
+
+      auto outputs = AOTIModelContainerRunner::run(
+          std::move(inputs),
+          reinterpret_cast<AOTInductorStreamHandle>(run_stream.stream()),
+          proxy_executor_handle);
+
+      at::cuda::CUDAEvent outputs_ready;
+      outputs_ready.record(run_stream);
+      outputs_ready.block(current_stream);
+      return outputs;
+    }
   }
   return AOTIModelContainerRunner::run(
-      inputs, cuda_stream_handle, proxy_executor_handle);
+      std::move(inputs), cuda_stream_handle, proxy_executor_handle);
 }
 
 } // namespace torch::inductor
@@ -1,21 +1,38 @@
 #pragma once
 
+#include <c10/cuda/CUDAStream.h>
 #include <torch/csrc/inductor/aoti_model_container_runner.h>
 
+#include <atomic>
+#include <vector>
+
 namespace torch::inductor {
 
 class TORCH_API AOTIModelContainerRunnerCuda : public AOTIModelContainerRunner {
  public:
+  // num_concurrent_streams > 0 enables pool mode: the runner owns that many
+  // CUDA streams drawn from the per-device stream pool and round-robins
+  // run() calls across them, so up to num_concurrent_streams requests can be
+  // in flight on the device at once. The model instances inside the
+  // container already share one constant (weight) blob and only activation
+  // buffers are private, so num_models should be at least
+  // num_concurrent_streams to avoid checkout stalls. With the default of 0,
+  // run() executes on the caller's current stream as before.
   AOTIModelContainerRunnerCuda(
       const char* model_path,
       size_t num_models = 1,
-      const char* cubin_dir = nullptr)
-      : AOTIModelContainerRunner(model_path, num_models, false, cubin_dir) {}
+      const char* cubin_dir = nullptr,
+      size_t num_concurrent_streams = 0);
 
   std::vector<at::Tensor> run(
       std::vector<at::Tensor> inputs,
       AOTInductorStreamHandle cuda_stream_handle = nullptr,
       AOTIProxyExecutorHandle proxy_executor_handle = nullptr);
+
+ private:
+  // Pool-mode streams; empty when pool mode is disabled.
+  std::vector<c10::cuda::CUDAStream> streams_;
+  std::atomic<size_t> next_stream_{0};
 };
 
 } // namespace torch::inductor
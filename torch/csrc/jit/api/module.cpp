@@ -12,10 +12,12 @@
 #include <torch/csrc/jit/jit_log.h>
 #include <torch/csrc/jit/passes/dead_code_elimination.h>
 #include <torch/csrc/jit/passes/freeze_module.h>
+#include <torch/csrc/jit/passes/frozen_constant_dedup.h>
 #include <torch/csrc/jit/passes/frozen_conv_add_relu_fusion.h>
 #include <torch/csrc/jit/passes/frozen_graph_optimizations.h>
 #include <torch/csrc/jit/passes/frozen_linear_transpose.h>
 #include <torch/csrc/jit/passes/frozen_ops_to_mkldnn.h>
+#include <torch/csrc/jit/passes/frozen_weight_layouts.h>
 #include <torch/csrc/jit/passes/inliner.h>
 #include <torch/csrc/jit/runtime/operator.h>
 
@@ -315,7 +317,10 @@ Module Module::copy() const {
 }
 
 Module Module::deepcopy(c10::optional<at::Device> device) const {
-  return Module(_ivalue()->deepcopy(device));
+  // Modules are exactly the "tensors live and die together" shape the bulk
+  // path is for: parameters and buffers are copied into per-device arenas
+  // instead of one allocation per tensor.
+  return Module(IValue(_ivalue()).deepcopy_bulk(device).toObject());
 }
 
 Module Module::clone(bool inplace) const {
@@ -443,6 +448,75 @@ void Module::train(bool on) {
   }
 }
 
+namespace {
+// Resolves a dotted name from named_parameters() ("layer1.weight") to the
+// object owning the leaf slot and the leaf attribute name.
+std::pair<ModulePtr, std::string> resolve_parameter_owner(
+    const ModulePtr& root,
+    const std::string& name) {
+  auto obj = root;
+  size_t pos = 0;
+  while (true) {
+    auto dot = name.find('.', pos);
+    if (dot == std::string::npos) {
+      return {obj, name.substr(pos)};
+    }
+    auto field = name.substr(pos, dot - pos);
+    TORCH_CHECK(
+        obj->type()->hasAttribute(field) &&
+            obj->getAttr(field).isObject(),
+        "Module has no submodule '",
+        field,
+        "' while resolving parameter '",
+        name,
+        "'");
+    obj = obj->getAttr(field).toObject();
+    pos = dot + 1;
+  }
+}
+} // namespace
+
+// See Note [Double-buffered parameter storage] in module.h
+at::Tensor Module::inactive_parameter(const std::string& name) {
+  std::lock_guard<std::mutex> lock(parameter_buffer_->mutex);
+  auto it = parameter_buffer_->inactive.find(name);
+  if (it != parameter_buffer_->inactive.end()) {
+    return it->second;
+  }
+  auto [owner, field] = resolve_parameter_owner(_ivalue(), name);
+  auto slot = owner->type()->findAttributeSlot(field);
+  TORCH_CHECK(
+      slot.has_value() &&
+          (owner->type()->is_parameter(*slot) ||
+           owner->type()->is_buffer(*slot)),
+      "'",
+      name,
+      "' is not a parameter or buffer of this module");
+  auto shadow = owner->getSlot(*slot).toTensor().clone();
+  parameter_buffer_->inactive.emplace(name, shadow);
+  return shadow;
+}
+
+uint64_t Module::swap_parameter_generations() {
+  std::lock_guard<std::mutex> lock(parameter_buffer_->mutex);
+  for (auto& entry : parameter_buffer_->inactive) {
+    auto [owner, field] = resolve_parameter_owner(_ivalue(), entry.first);
+    auto slot = owner->type()->findAttributeSlot(field);
+    TORCH_INTERNAL_ASSERT(slot.has_value());
+    auto live = owner->getSlot(*slot).toTensor();
+    owner->setSlot(*slot, entry.second);
+    // The replaced tensor becomes the next inactive generation, so repeated
+    // refreshes alternate between the same two storages.
+    entry.second = std::move(live);
+  }
+  return parameter_buffer_->generation.fetch_add(1, std::memory_order_acq_rel) +
+      1;
+}
+
+uint64_t Module::parameter_generation() const {
+  return parameter_buffer_->generation.load(std::memory_order_acquire);
+}
+
 IValue Module::create_class(const c10::QualifiedName& name, Stack stack) const {
   // Look up the class
   const auto classType =
@@ -483,6 +557,7 @@ Module freeze(
       module, preserved_attrs.value_or(std::vector<std::string>({})));
   auto graph = out_mod.get_method("forward").graph();
   OptimizeFrozenGraph(graph, optimize_numerics);
+  DedupFrozenTensorConstants(out_mod);
   return out_mod;
 }
 
@@ -491,6 +566,7 @@ void optimize_for_inference(std::shared_ptr<Graph> graph) {
   FuseFrozenConvAddRelu(graph);
   ConvertFrozenOpsToMKLDNN(graph);
   FrozenLinearTranspose(graph);
+  FrozenFinalizeWeightLayouts(graph);
 }
 } // namespace
 
@@ -18,6 +18,7 @@
 #include <c10/util/Optional.h>
 #include <c10/util/irange.h>
 
+#include <atomic>
 #include <functional>
 #include <memory>
 #include <mutex>
@@ -216,6 +217,26 @@ struct TORCH_API Module : public Object {
   /// effect.
   void to(at::Device device, bool non_blocking = false);
 
+  // Note [Double-buffered parameter storage]
+  // ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+  // Serving processes refresh weights without pausing traffic by writing new
+  // values into an inactive shadow generation and flipping generations
+  // between requests. inactive_parameter() resolves a dotted name from
+  // named_parameters() and lazily clones the live tensor the first time the
+  // parameter is touched, so an incremental update (e.g. an mmap'ed diff
+  // applied with copy_ onto sub-ranges) only materializes the parameters
+  // that actually change. swap_parameter_generations() installs every
+  // touched shadow tensor as the live value and keeps the replaced tensors
+  // as the next inactive generation, so repeated refreshes alternate
+  // between the same two storages instead of allocating. The flip is one
+  // refcounted slot store per touched parameter; run it between requests
+  // (or quiesce inference) if a single request must never observe mixed
+  // generations. parameter_generation() is a monotonic flip count, cheap
+  // enough for inference code to read per request.
+  at::Tensor inactive_parameter(const std::string& name);
+  uint64_t swap_parameter_generations();
+  uint64_t parameter_generation() const;
+
   void save(
       std::ostream& out,
       const ExtraFilesMap& extra_files = ExtraFilesMap()) const;
@@ -327,6 +348,17 @@ struct TORCH_API Module : public Object {
 
   // Mutex to keep registring buffer or parameter thread safe.
   std::shared_ptr<std::mutex> register_mutex_ = std::make_shared<std::mutex>();
+
+  // See Note [Double-buffered parameter storage]. Shared between copies of
+  // the handle, like register_mutex_.
+  struct ParameterBuffer {
+    std::mutex mutex;
+    std::atomic<uint64_t> generation{0};
+    // dotted parameter name -> shadow tensor of the inactive generation
+    std::unordered_map<std::string, at::Tensor> inactive;
+  };
+  std::shared_ptr<ParameterBuffer> parameter_buffer_ =
+      std::make_shared<ParameterBuffer>();
 };
 
 // C++ equivalent api of `torch.jit.freeze`. See documentation there for
@@ -13,6 +13,26 @@ namespace jit {
 namespace xnnpack {
 namespace delegate {
 
+namespace {
+
+// Workspace shared by every runtime compiled in this process. XNNPACK grows
+// the workspace to the largest requirement among the runtimes attached to it,
+// so delegated subgraphs share one scratch arena instead of each holding a
+// private one. The workspace is reference counted by the runtimes; this handle
+// intentionally lives for the duration of the process.
+xnn_workspace_t getSharedWorkspace() {
+  static xnn_workspace_t workspace = []() {
+    xnn_workspace_t workspace_ptr = nullptr;
+    xnn_status status = xnn_create_workspace(&workspace_ptr);
+    TORCH_CHECK(
+        xnn_status_success == status, "Failed to create xnn workspace");
+    return workspace_ptr;
+  }();
+  return workspace;
+}
+
+} // namespace
+
 void XNNCompiler::compileModel(
     const void* buffer_pointer,
     size_t num_bytes,
@@ -99,7 +119,13 @@ void XNNCompiler::compileModel(
   }
 
   xnn_runtime_t runtime_ptr = nullptr;
-  status = xnn_create_runtime_v2(subgraph_ptr, nullptr, 0, &runtime_ptr);
+  status = xnn_create_runtime_v4(
+      subgraph_ptr,
+      /*weights_cache=*/nullptr,
+      /*workspace=*/getSharedWorkspace(),
+      /*threadpool=*/nullptr,
+      /*flags=*/0,
+      &runtime_ptr);
   TORCH_CHECK(xnn_status_success == status);
 
   executor->runtime_ =
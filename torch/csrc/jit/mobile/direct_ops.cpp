@@ -0,0 +1,516 @@
+#include <torch/csrc/jit/mobile/direct_ops.h>
+
+#include <ATen/Functions.h>
+#include <ATen/core/stack.h>
+
+#include <unordered_map>
+
+namespace torch {
+namespace jit {
+namespace mobile {
+namespace {
+
+// Note [Mobile direct op calls]
+// The generic lite-interpreter call path resolves an operator to
+// OperatorHandle::callBoxed, which routes every argument through the
+// dispatcher's boxed calling convention before the kernel's unboxing
+// adapter takes them apart again. For sub-millisecond models the repeated
+// IValue shuffling is a measurable share of the run time. The table below
+// provides hand-written implementations for the operators that dominate
+// mobile inference workloads: each one reads its arguments in place from
+// the stack (c10::ArrayRef<IValue> via last()), calls the ordinary unboxed
+// at:: entry point, and pushes the result. Dispatch semantics are
+// unchanged - the at:: functions go through the regular dispatcher, so
+// backend selection, autograd and torch function handling behave exactly
+// as on the boxed path.
+//
+// A direct implementation is only selected at bytecode load time
+// (makeOperatorFunction) when the serialized argument count equals the
+// operator's full arity, so default-argument padding and out-variant
+// handling stay on the boxed fallback, as does every operator not listed
+// here.
+
+void direct_add_Tensor(Stack& stack) {
+  auto args = last(stack, 3);
+  auto result =
+      at::add(args[0].toTensor(), args[1].toTensor(), args[2].toScalar());
+  drop(stack, 3);
+  pack(stack, std::move(result));
+}
+
+void direct_add__Tensor(Stack& stack) {
+  auto args = last(stack, 3);
+  auto self = args[0].toTensor();
+  self.add_(args[1].toTensor(), args[2].toScalar());
+  drop(stack, 3);
+  pack(stack, std::move(self));
+}
+
+void direct_sub_Tensor(Stack& stack) {
+  auto args = last(stack, 3);
+  auto result =
+      at::sub(args[0].toTensor(), args[1].toTensor(), args[2].toScalar());
+  drop(stack, 3);
+  pack(stack, std::move(result));
+}
+
+void direct_mul_Tensor(Stack& stack) {
+  auto args = last(stack, 2);
+  auto result = at::mul(args[0].toTensor(), args[1].toTensor());
+  drop(stack, 2);
+  pack(stack, std::move(result));
+}
+
+void direct_mul__Tensor(Stack& stack) {
+  auto args = last(stack, 2);
+  auto self = args[0].toTensor();
+  self.mul_(args[1].toTensor());
+  drop(stack, 2);
+  pack(stack, std::move(self));
+}
+
+void direct_div_Tensor(Stack& stack) {
+  auto args = last(stack, 2);
+  auto result = at::div(args[0].toTensor(), args[1].toTensor());
+  drop(stack, 2);
+  pack(stack, std::move(result));
+}
+
+#define DEFINE_DIRECT_UNARY_OP(aten_op)              \
+  void direct_##aten_op(Stack& stack) {              \
+    auto result = at::aten_op(pop(stack).toTensor()); \
+    pack(stack, std::move(result));                  \
+  }
+
+#define DEFINE_DIRECT_UNARY_INPLACE_OP(aten_op)      \
+  void direct_##aten_op(Stack& stack) {              \
+    auto self = pop(stack).toTensor();               \
+    at::aten_op(self);                               \
+    pack(stack, std::move(self));                    \
+  }
+
+DEFINE_DIRECT_UNARY_OP(relu)
+DEFINE_DIRECT_UNARY_OP(sigmoid)
+DEFINE_DIRECT_UNARY_OP(tanh)
+DEFINE_DIRECT_UNARY_OP(exp)
+DEFINE_DIRECT_UNARY_OP(log)
+DEFINE_DIRECT_UNARY_OP(sqrt)
+DEFINE_DIRECT_UNARY_OP(rsqrt)
+DEFINE_DIRECT_UNARY_OP(neg)
+DEFINE_DIRECT_UNARY_OP(abs)
+DEFINE_DIRECT_UNARY_OP(hardswish)
+DEFINE_DIRECT_UNARY_OP(hardsigmoid)
+DEFINE_DIRECT_UNARY_OP(t)
+
+DEFINE_DIRECT_UNARY_INPLACE_OP(relu_)
+DEFINE_DIRECT_UNARY_INPLACE_OP(hardswish_)
+DEFINE_DIRECT_UNARY_INPLACE_OP(hardsigmoid_)
+
+#undef DEFINE_DIRECT_UNARY_OP
+#undef DEFINE_DIRECT_UNARY_INPLACE_OP
+
+void direct_hardtanh(Stack& stack) {
+  auto args = last(stack, 3);
+  auto result = at::hardtanh(
+      args[0].toTensor(), args[1].toScalar(), args[2].toScalar());
+  drop(stack, 3);
+  pack(stack, std::move(result));
+}
+
+void direct_hardtanh_(Stack& stack) {
+  auto args = last(stack, 3);
+  auto self = args[0].toTensor();
+  at::hardtanh_(self, args[1].toScalar(), args[2].toScalar());
+  drop(stack, 3);
+  pack(stack, std::move(self));
+}
+
+void direct_gelu(Stack& stack) {
+  auto args = last(stack, 2);
+  auto result = at::gelu(args[0].toTensor(), args[1].toStringView());
+  drop(stack, 2);
+  pack(stack, std::move(result));
+}
+
+void direct_clamp(Stack& stack) {
+  auto args = last(stack, 3);
+  auto result = at::clamp(
+      args[0].toTensor(),
+      args[1].toOptional<at::Scalar>(),
+      args[2].toOptional<at::Scalar>());
+  drop(stack, 3);
+  pack(stack, std::move(result));
+}
+
+void direct_pow_Tensor_Scalar(Stack& stack) {
+  auto args = last(stack, 2);
+  auto result = at::pow(args[0].toTensor(), args[1].toScalar());
+  drop(stack, 2);
+  pack(stack, std::move(result));
+}
+
+void direct_conv2d(Stack& stack) {
+  auto args = last(stack, 7);
+  auto result = at::conv2d(
+      args[0].toTensor(),
+      args[1].toTensor(),
+      args[2].toOptional<at::Tensor>(),
+      args[3].toIntVector(),
+      args[4].toIntVector(),
+      args[5].toIntVector(),
+      args[6].toInt());
+  drop(stack, 7);
+  pack(stack, std::move(result));
+}
+
+void direct_linear(Stack& stack) {
+  auto args = last(stack, 3);
+  auto result = at::linear(
+      args[0].toTensor(), args[1].toTensor(), args[2].toOptional<at::Tensor>());
+  drop(stack, 3);
+  pack(stack, std::move(result));
+}
+
+void direct_matmul(Stack& stack) {
+  auto args = last(stack, 2);
+  auto result = at::matmul(args[0].toTensor(), args[1].toTensor());
+  drop(stack, 2);
+  pack(stack, std::move(result));
+}
+
+void direct_mm(Stack& stack) {
+  auto args = last(stack, 2);
+  auto result = at::mm(args[0].toTensor(), args[1].toTensor());
+  drop(stack, 2);
+  pack(stack, std::move(result));
+}
+
+void direct_bmm(Stack& stack) {
+  auto args = last(stack, 2);
+  auto result = at::bmm(args[0].toTensor(), args[1].toTensor());
+  drop(stack, 2);
+  pack(stack, std::move(result));
+}
+
+void direct_addmm(Stack& stack) {
+  auto args = last(stack, 5);
+  auto result = at::addmm(
+      args[0].toTensor(),
+      args[1].toTensor(),
+      args[2].toTensor(),
+      args[3].toScalar(),
+      args[4].toScalar());
+  drop(stack, 5);
+  pack(stack, std::move(result));
+}
+
+void direct_batch_norm(Stack& stack) {
+  auto args = last(stack, 9);
+  auto result = at::batch_norm(
+      args[0].toTensor(),
+      args[1].toOptional<at::Tensor>(),
+      args[2].toOptional<at::Tensor>(),
+      args[3].toOptional<at::Tensor>(),
+      args[4].toOptional<at::Tensor>(),
+      args[5].toBool(),
+      args[6].toDouble(),
+      args[7].toDouble(),
+      args[8].toBool());
+  drop(stack, 9);
+  pack(stack, std::move(result));
+}
+
+void direct_layer_norm(Stack& stack) {
+  auto args = last(stack, 6);
+  auto result = at::layer_norm(
+      args[0].toTensor(),
+      args[1].toIntVector(),
+      args[2].toOptional<at::Tensor>(),
+      args[3].toOptional<at::Tensor>(),
+      args[4].toDouble(),
+      args[5].toBool());
+  drop(stack, 6);
+  pack(stack, std::move(result));
+}
+
+void direct_max_pool2d(Stack& stack) {
+  auto args = last(stack, 6);
+  auto result = at::max_pool2d(
+      args[0].toTensor(),
+      args[1].toIntVector(),
+      args[2].toIntVector(),
+      args[3].toIntVector(),
+      args[4].toIntVector(),
+      args[5].toBool());
+  drop(stack, 6);
+  pack(stack, std::move(result));
+}
+
+void direct_avg_pool2d(Stack& stack) {
+  auto args = last(stack, 7);
+  auto result = at::avg_pool2d(
+      args[0].toTensor(),
+      args[1].toIntVector(),
+      args[2].toIntVector(),
+      args[3].toIntVector(),
+      args[4].toBool(),
+      args[5].toBool(),
+      args[6].toOptional<int64_t>());
+  drop(stack, 7);
+  pack(stack, std::move(result));
+}
+
+void direct_adaptive_avg_pool2d(Stack& stack) {
+  auto args = last(stack, 2);
+  auto result =
+      at::adaptive_avg_pool2d(args[0].toTensor(), args[1].toIntVector());
+  drop(stack, 2);
+  pack(stack, std::move(result));
+}
+
+void direct_softmax_int(Stack& stack) {
+  auto args = last(stack, 3);
+  auto result = at::softmax(
+      args[0].toTensor(),
+      args[1].toInt(),
+      args[2].toOptional<at::ScalarType>());
+  drop(stack, 3);
+  pack(stack, std::move(result));
+}
+
+void direct_log_softmax_int(Stack& stack) {
+  auto args = last(stack, 3);
+  auto result = at::log_softmax(
+      args[0].toTensor(),
+      args[1].toInt(),
+      args[2].toOptional<at::ScalarType>());
+  drop(stack, 3);
+  pack(stack, std::move(result));
+}
+
+void direct_cat(Stack& stack) {
+  auto args = last(stack, 2);
+  auto result = at::cat(args[0].toTensorVector(), args[1].toInt());
+  drop(stack, 2);
+  pack(stack, std::move(result));
+}
+
+void direct_stack(Stack& stack) {
+  auto args = last(stack, 2);
+  auto result = at::stack(args[0].toTensorVector(), args[1].toInt());
+  drop(stack, 2);
+  pack(stack, std::move(result));
+}
+
+void direct_flatten_using_ints(Stack& stack) {
+  auto args = last(stack, 3);
+  auto result =
+      at::flatten(args[0].toTensor(), args[1].toInt(), args[2].toInt());
+  drop(stack, 3);
+  pack(stack, std::move(result));
+}
+
+void direct_view(Stack& stack) {
+  auto args = last(stack, 2);
+  auto result = args[0].toTensor().view(args[1].toIntVector());
+  drop(stack, 2);
+  pack(stack, std::move(result));
+}
+
+void direct_reshape(Stack& stack) {
+  auto args = last(stack, 2);
+  auto result = at::reshape(args[0].toTensor(), args[1].toIntVector());
+  drop(stack, 2);
+  pack(stack, std::move(result));
+}
+
+void direct_permute(Stack& stack) {
+  auto args = last(stack, 2);
+  auto result = at::permute(args[0].toTensor(), args[1].toIntVector());
+  drop(stack, 2);
+  pack(stack, std::move(result));
+}
+
+void direct_transpose_int(Stack& stack) {
+  auto args = last(stack, 3);
+  auto result =
+      at::transpose(args[0].toTensor(), args[1].toInt(), args[2].toInt());
+  drop(stack, 3);
+  pack(stack, std::move(result));
+}
+
+void direct_contiguous(Stack& stack) {
+  auto args = last(stack, 2);
+  auto result = args[0].toTensor().contiguous(args[1].toMemoryFormat());
+  drop(stack, 2);
+  pack(stack, std::move(result));
+}
+
+void direct_unsqueeze(Stack& stack) {
+  auto args = last(stack, 2);
+  auto result = at::unsqueeze(args[0].toTensor(), args[1].toInt());
+  drop(stack, 2);
+  pack(stack, std::move(result));
+}
+
+void direct_squeeze_dim(Stack& stack) {
+  auto args = last(stack, 2);
+  auto result = at::squeeze(args[0].toTensor(), args[1].toInt());
+  drop(stack, 2);
+  pack(stack, std::move(result));
+}
+
+void direct_select_int(Stack& stack) {
+  auto args = last(stack, 3);
+  auto result =
+      at::select(args[0].toTensor(), args[1].toInt(), args[2].toInt());
+  drop(stack, 3);
+  pack(stack, std::move(result));
+}
+
+void direct_slice_Tensor(Stack& stack) {
+  auto args = last(stack, 5);
+  auto result = at::slice(
+      args[0].toTensor(),
+      args[1].toInt(),
+      args[2].toOptional<int64_t>(),
+      args[3].toOptional<int64_t>(),
+      args[4].toInt());
+  drop(stack, 5);
+  pack(stack, std::move(result));
+}
+
+void direct_expand(Stack& stack) {
+  auto args = last(stack, 3);
+  auto result =
+      args[0].toTensor().expand(args[1].toIntVector(), args[2].toBool());
+  drop(stack, 3);
+  pack(stack, std::move(result));
+}
+
+void direct_expand_as(Stack& stack) {
+  auto args = last(stack, 2);
+  auto result = args[0].toTensor().expand_as(args[1].toTensor());
+  drop(stack, 2);
+  pack(stack, std::move(result));
+}
+
+void direct_embedding(Stack& stack) {
+  auto args = last(stack, 5);
+  auto result = at::embedding(
+      args[0].toTensor(),
+      args[1].toTensor(),
+      args[2].toInt(),
+      args[3].toBool(),
+      args[4].toBool());
+  drop(stack, 5);
+  pack(stack, std::move(result));
+}
+
+void direct_dropout(Stack& stack) {
+  auto args = last(stack, 3);
+  auto result =
+      at::dropout(args[0].toTensor(), args[1].toDouble(), args[2].toBool());
+  drop(stack, 3);
+  pack(stack, std::move(result));
+}
+
+void direct_clone(Stack& stack) {
+  auto args = last(stack, 2);
+  auto result =
+      at::clone(args[0].toTensor(), args[1].toOptional<at::MemoryFormat>());
+  drop(stack, 2);
+  pack(stack, std::move(result));
+}
+
+struct DirectOpEntry {
+  // The operator's full argument count; the direct implementation expects
+  // exactly this many values on the stack.
+  int num_args;
+  DirectOpFunction fn;
+};
+
+const std::unordered_map<std::string, DirectOpEntry>& directOpTable() {
+  static const std::unordered_map<std::string, DirectOpEntry> table = {
+      {"aten::add.Tensor", {3, direct_add_Tensor}},
+      {"aten::add_.Tensor", {3, direct_add__Tensor}},
+      {"aten::sub.Tensor", {3, direct_sub_Tensor}},
+      {"aten::mul.Tensor", {2, direct_mul_Tensor}},
+      {"aten::mul_.Tensor", {2, direct_mul__Tensor}},
+      {"aten::div.Tensor", {2, direct_div_Tensor}},
+      {"aten::relu", {1, direct_relu}},
+      {"aten::relu_", {1, direct_relu_}},
+      {"aten::sigmoid", {1, direct_sigmoid}},
+      {"aten::tanh", {1, direct_tanh}},
+      {"aten::exp", {1, direct_exp}},
+      {"aten::log", {1, direct_log}},
+      {"aten::sqrt", {1, direct_sqrt}},
+      {"aten::rsqrt", {1, direct_rsqrt}},
+      {"aten::neg", {1, direct_neg}},
+      {"aten::abs", {1, direct_abs}},
+      {"aten::hardswish", {1, direct_hardswish}},
+      {"aten::hardswish_", {1, direct_hardswish_}},
+      {"aten::hardsigmoid", {1, direct_hardsigmoid}},
+      {"aten::hardsigmoid_", {1, direct_hardsigmoid_}},
+      {"aten::hardtanh", {3, direct_hardtanh}},
+      {"aten::hardtanh_", {3, direct_hardtanh_}},
+      {"aten::gelu", {2, direct_gelu}},
+      {"aten::clamp", {3, direct_clamp}},
+      {"aten::pow.Tensor_Scalar", {2, direct_pow_Tensor_Scalar}},
+      {"aten::conv2d", {7, direct_conv2d}},
+      {"aten::linear", {3, direct_linear}},
+      {"aten::matmul", {2, direct_matmul}},
+      {"aten::mm", {2, direct_mm}},
+      {"aten::bmm", {2, direct_bmm}},
+      {"aten::addmm", {5, direct_addmm}},
+      {"aten::batch_norm", {9, direct_batch_norm}},
+      {"aten::layer_norm", {6, direct_layer_norm}},
+      {"aten::max_pool2d", {6, direct_max_pool2d}},
+      {"aten::avg_pool2d", {7, direct_avg_pool2d}},
+      {"aten::adaptive_avg_pool2d", {2, direct_adaptive_avg_pool2d}},
+      {"aten::softmax.int", {3, direct_softmax_int}},
+      {"aten::log_softmax.int", {3, direct_log_softmax_int}},
+      {"aten::cat", {2, direct_cat}},
+      {"aten::stack", {2, direct_stack}},
+      {"aten::flatten.using_ints", {3, direct_flatten_using_ints}},
+      {"aten::view", {2, direct_view}},
+      {"aten::reshape", {2, direct_reshape}},
+      {"aten::permute", {2, direct_permute}},
+      {"aten::transpose.int", {3, direct_transpose_int}},
+      {"aten::t", {1, direct_t}},
+      {"aten::contiguous", {2, direct_contiguous}},
+      {"aten::unsqueeze", {2, direct_unsqueeze}},
+      {"aten::squeeze.dim", {2, direct_squeeze_dim}},
+      {"aten::select.int", {3, direct_select_int}},
+      {"aten::slice.Tensor", {5, direct_slice_Tensor}},
+      {"aten::expand", {3, direct_expand}},
+      {"aten::expand_as", {2, direct_expand_as}},
+      {"aten::embedding", {5, direct_embedding}},
+      {"aten::dropout", {3, direct_dropout}},
+      {"aten::clone", {2, direct_clone}},
+  };
+  return table;
+}
+
+} // namespace
+
+DirectOpFunction findDirectOpFunction(
+    const std::string& name,
+    const c10::optional<int>& num_specified_args) {
+  const auto& table = directOpTable();
+  auto it = table.find(name);
+  if (it == table.end()) {
+    return nullptr;
+  }
+  // Only take the direct path when the bytecode carries the operator's full
+  // argument list; shorter lists from older models need the boxed path's
+  // default-argument padding.
+  if (!num_specified_args || *num_specified_args != it->second.num_args) {
+    return nullptr;
+  }
+  return it->second.fn;
+}
+
+} // namespace mobile
+} // namespace jit
+} // namespace torch
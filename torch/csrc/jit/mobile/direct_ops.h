@@ -0,0 +1,27 @@
+#pragma once
+
+#include <ATen/core/ivalue.h>
+#include <c10/util/Optional.h>
+#include <string>
+#include <vector>
+
+namespace torch {
+namespace jit {
+namespace mobile {
+
+using Stack = std::vector<c10::IValue>;
+
+using DirectOpFunction = void (*)(Stack&);
+
+// Returns a direct implementation for the operator if one is registered and
+// the bytecode specifies exactly the operator's full argument count, or
+// nullptr otherwise. Direct implementations call the unboxed at:: API on
+// arguments read in place from the stack, bypassing the dispatcher's boxed
+// calling convention. See Note [Mobile direct op calls] in direct_ops.cpp.
+DirectOpFunction findDirectOpFunction(
+    const std::string& name,
+    const c10::optional<int>& num_specified_args);
+
+} // namespace mobile
+} // namespace jit
+} // namespace torch
@@ -1,4 +1,5 @@
 #include <ATen/core/dynamic_type.h>
+#include <torch/csrc/jit/mobile/direct_ops.h>
 #include <torch/csrc/jit/mobile/function.h>
 #include <torch/csrc/jit/mobile/interpreter.h>
 #include <torch/csrc/jit/mobile/parse_bytecode.h>
@@ -8,6 +9,9 @@
 #include <torch/csrc/jit/runtime/instruction.h>
 #include <torch/csrc/jit/runtime/operator.h>
 
+#include <mutex>
+#include <unordered_map>
+
 namespace torch {
 namespace jit {
 
@@ -165,15 +169,68 @@ const std::vector<int64_t>& Function::getExceptionDebugHandles() const {
   return getInterpretersExceptionDebugHandles();
 }
 
+static std::mutex& operatorFunctionCacheMutex() {
+  static std::mutex mutex;
+  return mutex;
+}
+
+static std::unordered_map<uint64_t, std::function<void(Stack&)>>&
+operatorFunctionCache() {
+  static std::unordered_map<uint64_t, std::function<void(Stack&)>> cache;
+  return cache;
+}
+
+// Resolving an operator walks several global registries and builds a
+// closure over the result. The same (operator, num_specified_args) pairs
+// recur across repeated loads of model variants, so resolved functions are
+// memoized process-wide and later loads skip the registry lookups entirely.
+// Failed resolutions are not cached, since the operator may be provided by
+// a library that is loaded later.
+static c10::optional<std::function<void(Stack&)>> findCachedOperatorFunction(
+    uint64_t key) {
+  std::lock_guard<std::mutex> guard(operatorFunctionCacheMutex());
+  auto& cache = operatorFunctionCache();
+  auto it = cache.find(key);
+  if (it == cache.end()) {
+    return c10::nullopt;
+  }
+  return it->second;
+}
+
+static void cacheOperatorFunction(
+    uint64_t key,
+    const std::function<void(Stack&)>& fn) {
+  std::lock_guard<std::mutex> guard(operatorFunctionCacheMutex());
+  operatorFunctionCache().emplace(key, fn);
+}
+
 c10::optional<std::function<void(Stack&)>> makeOperatorFunction(
     c10::OperatorName opname,
     c10::optional<int> num_specified_args) {
   std::function<void(Stack&)> fn;
+  // The cache is keyed on the interned operator id plus the argument count,
+  // so repeated loads neither build nor hash a schema string. See
+  // Note [Interned operator names] in ATen/core/dispatch/Dispatcher.cpp.
+  const auto interned_id =
+      c10::Dispatcher::singleton().internOperatorName(opname);
+  const uint64_t cache_key = (static_cast<uint64_t>(interned_id) << 32) |
+      static_cast<uint32_t>(num_specified_args.value_or(-1));
+  if (auto cached = findCachedOperatorFunction(cache_key)) {
+    return cached;
+  }
   const auto full_name = c10::toString(opname);
   const std::vector<c10::Argument>* pArgs = nullptr;
   bool promoted_op = mobile::hasPrimOpsFn(full_name);
   if (promoted_op) {
     fn = mobile::getPrimOpsFn(full_name);
+  } else if (auto direct_fn = findDirectOpFunction(full_name, num_specified_args)) {
+    // Unboxed fast path for the operators that dominate mobile inference.
+    // The table only matches when the bytecode specifies the operator's
+    // full argument count, so no default-argument wrapper is needed. See
+    // Note [Mobile direct op calls] in direct_ops.cpp.
+    fn = direct_fn;
+    cacheOperatorFunction(cache_key, fn);
+    return fn;
   } else {
     std::shared_ptr<Operator> jit_op = findOperatorFor(opname);
     if (jit_op) {
@@ -234,6 +291,7 @@ c10::optional<std::function<void(Stack&)>> makeOperatorFunction(
       };
     }
   }
+  cacheOperatorFunction(cache_key, fn);
   return fn;
 }
 
@@ -23,6 +23,17 @@
 #include <torch/csrc/jit/serialization/import_export_functions.h>
 #include <torch/csrc/jit/serialization/import_read.h>
 #include <torch/custom_class.h>
+
+#ifndef BUILD_LITE_INTERPRETER
+#include <torch/csrc/jit/api/module.h>
+#include <torch/csrc/jit/passes/fold_conv_bn.h>
+#include <torch/csrc/jit/passes/freeze_module.h>
+#include <torch/csrc/jit/passes/xnnpack_rewrite.h>
+#include <torch/csrc/jit/serialization/import.h>
+
+#include <sys/stat.h>
+#endif
+
 #include <string>
 #include <vector>
 
@@ -599,6 +610,59 @@ mobile::Module _load_mobile_from_bytes(
   }
 }
 
+#ifndef BUILD_LITE_INTERPRETER
+// Support for MobileModuleLoadOptions::FOLD_CONV_BN: rewrite the full
+// TorchScript module shipped alongside the bytecode and cache the folded
+// archive next to the original, so the fold cost is paid once per device
+// per model instead of re-exporting the catalog.
+
+bool isFoldedCacheFresh(const std::string& src, const std::string& cache) {
+  struct stat src_stat {};
+  struct stat cache_stat {};
+  if (stat(cache.c_str(), &cache_stat) != 0 ||
+      stat(src.c_str(), &src_stat) != 0) {
+    return false;
+  }
+  // A cache older than the archive it was derived from is stale (e.g. the
+  // model file was replaced in an app update).
+  return cache_stat.st_mtime >= src_stat.st_mtime;
+}
+
+c10::optional<std::string> prepareFoldedConvBnModule(
+    const std::string& filename) {
+  const std::string cache = filename + ".conv-bn-folded";
+  if (isFoldedCacheFresh(filename, cache)) {
+    return cache;
+  }
+  try {
+    // Needs the TorchScript code in the archive; bytecode alone cannot be
+    // graph-rewritten.
+    Module module = torch::jit::load(filename);
+    module.eval();
+    module = FoldConvBatchNorm(module);
+#ifdef USE_XNNPACK
+    // Same ordering as optimizeForMobile: folding needs an unfrozen
+    // module, prepacking a frozen one.
+    module = freeze_module(module);
+    insertPrePackedOps(module);
+    module = freeze_module(module);
+    fusePrePackedLinearConvWithClamp(module);
+    FoldPrePackingOps(module);
+#endif
+    module._save_for_mobile(cache);
+    return cache;
+  } catch (const std::exception& e) {
+    TORCH_WARN(
+        "FOLD_CONV_BN: could not fold '",
+        filename,
+        "': ",
+        e.what(),
+        "; loading the unmodified module");
+    return c10::nullopt;
+  }
+}
+#endif // !BUILD_LITE_INTERPRETER
+
 } // namespace
 
 mobile::Module _load_for_mobile(
@@ -659,6 +723,22 @@ mobile::Module _load_for_mobile(
         data, size, device, extra_files, module_load_options);
   }
 
+  if (module_load_options & MobileModuleLoadOptions::FOLD_CONV_BN) {
+    module_load_options &= ~uint64_t(MobileModuleLoadOptions::FOLD_CONV_BN);
+#ifndef BUILD_LITE_INTERPRETER
+    if (auto cached = prepareFoldedConvBnModule(filename)) {
+      std::unique_ptr<FileAdapter> cached_rai =
+          std::make_unique<FileAdapter>(*cached);
+      return _load_for_mobile_impl(
+          std::move(cached_rai), device, extra_files, module_load_options);
+    }
+#else
+    TORCH_WARN(
+        "FOLD_CONV_BN requires a build with the full JIT; "
+        "loading the unmodified module");
+#endif
+  }
+
   std::unique_ptr<FileAdapter> rai = std::make_unique<FileAdapter>(filename);
   return _load_for_mobile_impl(
       std::move(rai), device, extra_files, module_load_options);
@@ -11,6 +11,13 @@ enum MobileModuleLoadOptions {
   // files automatically without explicit entries mapping. Refer to PR for a
   // detail: https://github.com/pytorch/pytorch/pull/99747
   PARSE_ALL_EXTRA_FILE_MAPS = 2,
+  // FOLD_CONV_BN folds conv+batchnorm (and, with XNNPACK, prepacks weights)
+  // at load time for zip archives that were exported without
+  // optimize_for_mobile, and caches the rewritten archive next to the
+  // original so the fold cost is paid once per device. Requires a build
+  // with the full JIT and the TorchScript code in the archive; otherwise
+  // the unmodified module is loaded with a warning.
+  FOLD_CONV_BN = 4,
 };
 
 const uint64_t kDefaultMobileLoadOptions =
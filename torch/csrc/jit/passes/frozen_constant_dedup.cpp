@@ -0,0 +1,97 @@
+#include <torch/csrc/jit/passes/frozen_constant_dedup.h>
+
+#include <c10/util/hash.h>
+#include <torch/csrc/jit/ir/ir.h>
+#include <torch/csrc/jit/jit_log.h>
+
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+namespace torch {
+namespace jit {
+
+namespace {
+
+// Mirrors the exclusions of the per-graph ConstantPooling pass: mkldnn
+// tensors do layout transformations based on usage, and nested tensors
+// cannot be compared with equal().
+bool isDedupableTensor(const at::Tensor& t) {
+  return !t.is_mkldnn() && !t.is_nested();
+}
+
+// Cheap metadata key; candidates landing in the same bucket are confirmed
+// with a full content comparison before any sharing happens.
+size_t tensorKey(const at::Tensor& t) {
+  size_t key = std::hash<int64_t>{}(static_cast<int64_t>(t.scalar_type()));
+  for (auto size : t.sizes()) {
+    key = c10::hash_combine(key, std::hash<int64_t>{}(size));
+  }
+  return key;
+}
+
+struct FrozenConstantDedup {
+  void run(Block* block) {
+    for (Node* node : block->nodes()) {
+      for (Block* sub : node->blocks()) {
+        run(sub);
+      }
+      if (node->kind() != prim::Constant ||
+          !node->hasAttribute(attr::value) ||
+          node->kindOf(attr::value) != AttributeKind::t) {
+        continue;
+      }
+      at::Tensor tensor = node->t(attr::value);
+      if (!isDedupableTensor(tensor)) {
+        continue;
+      }
+      auto& bucket = buckets_[tensorKey(tensor)];
+      bool found = false;
+      for (const at::Tensor& canonical : bucket) {
+        if (canonical.is_same(tensor)) {
+          // Already shared with a previously seen constant.
+          found = true;
+          break;
+        }
+        // equal() throws when devices differ, so check that first.
+        if (canonical.device() == tensor.device() &&
+            canonical.options().type_equal(tensor.options()) &&
+            canonical.equal(tensor)) {
+          node->t_(attr::value, canonical);
+          deduped_bytes_ += tensor.storage().nbytes();
+          found = true;
+          break;
+        }
+      }
+      if (!found) {
+        bucket.emplace_back(std::move(tensor));
+      }
+    }
+  }
+
+  std::unordered_map<size_t, std::vector<at::Tensor>> buckets_;
+  size_t deduped_bytes_ = 0;
+};
+
+} // namespace
+
+size_t DedupFrozenTensorConstants(Module& module) {
+  FrozenConstantDedup dedup;
+  std::unordered_set<Graph*> visited;
+  for (const Module& submodule : module.modules()) {
+    for (const Method& method : submodule.get_methods()) {
+      auto graph = method.graph();
+      if (visited.insert(graph.get()).second) {
+        dedup.run(graph->block());
+      }
+    }
+  }
+  GRAPH_DEBUG(
+      "DedupFrozenTensorConstants released ",
+      dedup.deduped_bytes_,
+      " bytes of duplicated constants");
+  return dedup.deduped_bytes_;
+}
+
+} // namespace jit
+} // namespace torch
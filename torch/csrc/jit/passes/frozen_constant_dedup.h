@@ -0,0 +1,23 @@
+#pragma once
+
+#include <torch/csrc/jit/api/module.h>
+
+/** \brief Deduplicate tensor constants across the methods of a frozen module.
+ *
+ * Freezing materializes attribute values as per-graph constants, so a weight
+ * reachable from several entry points ends up as several content-identical
+ * tensors, one per method. This pass rebinds such constants to a single
+ * canonical tensor so that all methods share one storage, and returns the
+ * number of bytes released by deduplication.
+ *
+ * Only run this on frozen modules: it assumes tensor constants are never
+ * mutated, since deduplicated constants alias each other afterwards.
+ */
+
+namespace torch {
+namespace jit {
+
+TORCH_API size_t DedupFrozenTensorConstants(Module& module);
+
+} // namespace jit
+} // namespace torch
@@ -0,0 +1,151 @@
+#include <c10/core/MemoryFormat.h>
+#include <torch/csrc/jit/ir/ir.h>
+#include <torch/csrc/jit/jit_log.h>
+#include <torch/csrc/jit/passes/frozen_weight_layouts.h>
+#include <torch/csrc/jit/passes/utils/optimization_utils.h>
+#include <torch/csrc/jit/runtime/graph_iterator.h>
+
+#include <utility>
+
+namespace torch {
+namespace jit {
+namespace {
+
+using Tensor = at::Tensor;
+
+bool isConvOp(Node* node) {
+  return node->kind() == aten::conv1d || node->kind() == aten::conv2d ||
+      node->kind() == aten::conv3d || node->kind() == aten::conv_transpose1d ||
+      node->kind() == aten::conv_transpose2d ||
+      node->kind() == aten::conv_transpose3d;
+}
+
+bool isHandledOp(Node* node) {
+  return isConvOp(node) || node->kind() == aten::linear ||
+      node->kind() == aten::batch_norm;
+}
+
+// The channels-last format matching the rank of the given conv weight, or
+// nullopt for weights that have no channels-last representation (e.g. the
+// 3-d weights of conv1d).
+c10::optional<at::MemoryFormat> channelsLastFormatFor(const Tensor& weight) {
+  if (weight.dim() == 4) {
+    return at::MemoryFormat::ChannelsLast;
+  }
+  if (weight.dim() == 5) {
+    return at::MemoryFormat::ChannelsLast3d;
+  }
+  return c10::nullopt;
+}
+
+// Infers the serving memory format from the strides recorded on the graph's
+// input types. Freezing a traced or profiled module leaves complete
+// TensorTypes on the inputs; if any of them carries channels-last strides the
+// convs in the graph will run their channels-last kernels, and pre-converting
+// the weights removes the per-call conversion. Returns nullopt when the input
+// types don't pin down a layout.
+c10::optional<at::MemoryFormat> inferServingMemoryFormat(
+    const std::shared_ptr<Graph>& graph) {
+  for (Value* input : graph->inputs()) {
+    auto tensor_type = input->type()->cast<TensorType>();
+    if (!tensor_type) {
+      continue;
+    }
+    auto sizes = tensor_type->sizes().concrete_sizes();
+    auto strides = tensor_type->strides().concrete_sizes();
+    if (!sizes || !strides) {
+      continue;
+    }
+    if (sizes->size() == 4 && c10::is_channels_last_strides_2d(*sizes, *strides)) {
+      return at::MemoryFormat::ChannelsLast;
+    }
+    if (sizes->size() == 5 && c10::is_channels_last_strides_3d(*sizes, *strides)) {
+      return at::MemoryFormat::ChannelsLast3d;
+    }
+  }
+  return c10::nullopt;
+}
+
+class FinalizeFrozenWeightLayouts {
+ public:
+  FinalizeFrozenWeightLayouts(
+      std::shared_ptr<Graph> graph,
+      c10::optional<at::MemoryFormat> memory_format)
+      : graph_(std::move(graph)), memory_format_(memory_format) {}
+
+  bool run() {
+    DepthFirstGraphNodeIterator graph_it(graph_);
+    for (Node* node = graph_it.next(); node != nullptr;
+         node = graph_it.next()) {
+      if (!isHandledOp(node) || nonConstantParameters(node)) {
+        continue;
+      }
+      finalizeNodeInputs(node);
+    }
+    return graph_modified_;
+  }
+
+ private:
+  void finalizeNodeInputs(Node* node) {
+    for (size_t i = 1; i < node->inputs().size(); ++i) {
+      auto tensor_opt = constant_as<Tensor>(node->input(i));
+      if (!tensor_opt) {
+        continue;
+      }
+      const Tensor& tensor = *tensor_opt;
+
+      // The weight of a conv is converted to the requested serving format;
+      // every other constant parameter is merely densified in the format it
+      // already suggests, so intentionally channels-last constants are left
+      // alone.
+      c10::optional<at::MemoryFormat> format;
+      const bool channels_last_target = memory_format_ &&
+          *memory_format_ != at::MemoryFormat::Contiguous;
+      if (i == 1 && isConvOp(node) && channels_last_target) {
+        format = channelsLastFormatFor(tensor);
+      }
+      if (!format) {
+        format = tensor.suggest_memory_format();
+      }
+      if (tensor.is_contiguous(*format)) {
+        continue;
+      }
+
+      WithInsertPoint insert_guard(node);
+      Value* finalized = graph_->insertConstant(tensor.contiguous(*format));
+      node->replaceInput(i, finalized);
+      graph_modified_ = true;
+    }
+  }
+
+  std::shared_ptr<Graph> graph_;
+  c10::optional<at::MemoryFormat> memory_format_;
+  bool graph_modified_ = false;
+};
+
+bool runPass(
+    std::shared_ptr<Graph>& graph,
+    c10::optional<at::MemoryFormat> memory_format) {
+  FinalizeFrozenWeightLayouts pass(graph, memory_format);
+  GRAPH_DUMP("Before FrozenFinalizeWeightLayouts", graph);
+  bool changed = pass.run();
+  if (changed) {
+    GRAPH_DUMP("After FrozenFinalizeWeightLayouts", graph);
+  }
+  return changed;
+}
+
+} // namespace
+
+TORCH_API bool FrozenFinalizeWeightLayouts(
+    std::shared_ptr<Graph>& graph,
+    at::MemoryFormat memory_format) {
+  return runPass(graph, memory_format);
+}
+
+TORCH_API bool FrozenFinalizeWeightLayouts(std::shared_ptr<Graph>& graph) {
+  return runPass(graph, inferServingMemoryFormat(graph));
+}
+
+} // namespace jit
+} // namespace torch
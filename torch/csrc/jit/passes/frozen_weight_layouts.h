@@ -0,0 +1,27 @@
+#pragma once
+
+#include <torch/csrc/jit/ir/ir.h>
+
+namespace torch {
+namespace jit {
+
+// Rewrites the constant weights of a frozen graph into the memory format the
+// serving kernels will use, so layout conversions happen once at load time
+// instead of on the first batches.
+//
+// The two-argument form converts the weights of constant-parameter conv ops
+// into the given memory format (at::MemoryFormat::ChannelsLast /
+// ChannelsLast3d / Contiguous). The single-argument form infers the target
+// from the strides recorded on the graph's input types and only converts conv
+// weights when those identify a channels-last serving layout. Both forms also
+// densify any non-contiguous constant parameters of conv, linear and
+// batch_norm ops (e.g. weights that were frozen from transposed or sliced
+// views and would otherwise be copied on every call).
+TORCH_API bool FrozenFinalizeWeightLayouts(
+    std::shared_ptr<Graph>& graph,
+    at::MemoryFormat memory_format);
+
+TORCH_API bool FrozenFinalizeWeightLayouts(std::shared_ptr<Graph>& graph);
+
+} // namespace jit
+} // namespace torch
@@ -0,0 +1,312 @@
+#include <torch/csrc/jit/passes/memory_planning.h>
+
+#include <torch/csrc/jit/ir/alias_analysis.h>
+#include <torch/csrc/jit/jit_log.h>
+
+#include <c10/util/irange.h>
+
+#include <algorithm>
+#include <unordered_set>
+
+namespace torch {
+namespace jit {
+
+namespace {
+
+// Offsets inside an arena are aligned so that any planned value can be
+// reinterpreted as any dtype and so that vectorized kernels see aligned
+// pointers, matching the caching allocator's own alignment.
+constexpr size_t kArenaAlignment = 64;
+
+size_t align_up(size_t n) {
+  return (n + kArenaAlignment - 1) & ~(kArenaAlignment - 1);
+}
+
+// Ops that are safe to rewrite to their out= overload: single fresh tensor
+// output and an out variant whose arguments are the functional arguments
+// followed by out. Ops outside this set keep their regular allocation.
+bool has_out_variant(const Node* n) {
+  static const std::unordered_set<Symbol> out_variant_ops = {
+      aten::mm,
+      aten::addmm,
+      aten::bmm,
+      aten::matmul,
+      aten::add,
+      aten::sub,
+      aten::mul,
+      aten::div,
+      aten::tanh,
+      aten::sigmoid,
+      aten::exp,
+      aten::clamp,
+      aten::gelu,
+      aten::softmax,
+      aten::cat,
+  };
+  return out_variant_ops.count(n->kind()) > 0;
+}
+
+struct Candidate {
+  Value* value;
+  c10::Device device;
+  c10::ScalarType dtype;
+  std::vector<int64_t> sizes;
+  size_t nbytes; // exact, unpadded
+  // Lifetime as topological node indices: the producing node and the last
+  // node that reads the value.
+  size_t def;
+  size_t end;
+};
+
+// Returns the concrete (device, dtype, sizes, nbytes) of a value if its type
+// pins all of them down and the value is contiguous; nullopt otherwise.
+c10::optional<Candidate> describe(Value* v) {
+  auto ttype = v->type()->cast<TensorType>();
+  if (!ttype) {
+    return c10::nullopt;
+  }
+  auto device = ttype->device();
+  auto dtype = ttype->scalarType();
+  auto sizes = ttype->sizes().concrete_sizes();
+  auto strides = ttype->strides().concrete_sizes();
+  if (!device || !dtype || !sizes || !strides) {
+    return c10::nullopt;
+  }
+  // Only plan contiguous tensors; the arena views are created contiguous.
+  int64_t expected_stride = 1;
+  for (int64_t i = static_cast<int64_t>(sizes->size()) - 1; i >= 0; i--) {
+    if ((*strides)[i] != expected_stride) {
+      return c10::nullopt;
+    }
+    expected_stride *= (*sizes)[i];
+  }
+  const auto elem_size = c10::elementSize(*dtype);
+  int64_t numel = 1;
+  for (auto s : *sizes) {
+    numel *= s;
+  }
+  if (numel == 0) {
+    return c10::nullopt;
+  }
+  Candidate c;
+  c.value = v;
+  c.device = *device;
+  c.dtype = *dtype;
+  c.sizes = std::move(*sizes);
+  c.nbytes = static_cast<size_t>(numel) * elem_size;
+  return c;
+}
+
+std::vector<Candidate> collect_candidates(
+    const std::shared_ptr<Graph>& graph,
+    AliasDb& alias_db) {
+  // Topological index of every top-level node.
+  std::unordered_map<const Node*, size_t> topo_index;
+  size_t index = 0;
+  for (const Node* n : graph->block()->nodes()) {
+    topo_index[n] = index++;
+  }
+
+  std::unordered_set<const Value*> graph_outputs(
+      graph->outputs().begin(), graph->outputs().end());
+
+  std::vector<Candidate> candidates;
+  for (Node* n : graph->block()->nodes()) {
+    if (n->outputs().size() != 1 || !has_out_variant(n)) {
+      continue;
+    }
+    Value* v = n->output();
+    if (graph_outputs.count(v) || v->uses().empty()) {
+      continue;
+    }
+    auto candidate = describe(v);
+    if (!candidate) {
+      continue;
+    }
+    // The lifetime interval below is only sound if nothing aliases or writes
+    // the value: a view or in-place use would let the bytes be observed after
+    // the last direct use.
+    if (alias_db.hasWriters(v)) {
+      continue;
+    }
+    bool escapes = false;
+    size_t last_use = topo_index[n];
+    for (const Use& use : v->uses()) {
+      if (use.user->owningBlock() != graph->block()) {
+        escapes = true;
+        break;
+      }
+      for (Value* user_output : use.user->outputs()) {
+        if (alias_db.mayContainAlias(v, user_output)) {
+          escapes = true;
+          break;
+        }
+      }
+      if (escapes) {
+        break;
+      }
+      last_use = std::max(last_use, topo_index[use.user]);
+    }
+    if (escapes) {
+      continue;
+    }
+    candidate->def = topo_index[n];
+    candidate->end = last_use;
+    candidates.push_back(std::move(*candidate));
+  }
+  return candidates;
+}
+
+bool lifetimes_overlap(const Candidate& a, const Candidate& b) {
+  return !(a.end < b.def || b.end < a.def);
+}
+
+} // namespace
+
+MemoryPlan BuildMemoryPlan(const std::shared_ptr<Graph>& graph) {
+  AliasDb alias_db(graph);
+  auto candidates = collect_candidates(graph, alias_db);
+
+  MemoryPlan plan;
+  std::unordered_map<c10::Device, size_t> arena_of_device;
+
+  // Place large values first; ties broken by definition order so the result
+  // is deterministic.
+  std::vector<size_t> order(candidates.size());
+  for (const auto i : c10::irange(candidates.size())) {
+    order[i] = i;
+  }
+  std::sort(order.begin(), order.end(), [&](size_t a, size_t b) {
+    if (candidates[a].nbytes != candidates[b].nbytes) {
+      return candidates[a].nbytes > candidates[b].nbytes;
+    }
+    return candidates[a].def < candidates[b].def;
+  });
+
+  // For each arena, the already-placed candidate indices.
+  std::vector<std::vector<size_t>> placed_per_arena;
+
+  for (const size_t i : order) {
+    const Candidate& c = candidates[i];
+    auto arena_it = arena_of_device.find(c.device);
+    if (arena_it == arena_of_device.end()) {
+      arena_it =
+          arena_of_device.emplace(c.device, plan.arenas.size()).first;
+      plan.arenas.emplace_back(c.device, 0);
+      placed_per_arena.emplace_back();
+    }
+    const size_t arena = arena_it->second;
+
+    // Collect the occupied intervals of lifetime-overlapping neighbors and
+    // take the first gap that fits (best-fit would also work; first-fit on
+    // size-sorted input gives the same packing in practice).
+    std::vector<std::pair<size_t, size_t>> occupied;
+    for (const size_t j : placed_per_arena[arena]) {
+      if (lifetimes_overlap(c, candidates[j])) {
+        const auto& alloc = plan.allocations.at(candidates[j].value);
+        occupied.emplace_back(alloc.offset, alloc.offset + alloc.size);
+      }
+    }
+    std::sort(occupied.begin(), occupied.end());
+
+    const size_t needed = align_up(c.nbytes);
+    size_t offset = 0;
+    for (const auto& interval : occupied) {
+      if (interval.first >= offset + needed) {
+        break;
+      }
+      offset = std::max(offset, interval.second);
+    }
+
+    plan.allocations.emplace(
+        c.value, MemoryAllocation{offset, needed, arena});
+    plan.arenas[arena].second =
+        std::max(plan.arenas[arena].second, offset + needed);
+    placed_per_arena[arena].push_back(i);
+  }
+  return plan;
+}
+
+size_t PlanMemoryArenas(std::shared_ptr<Graph>& graph) {
+  AliasDb alias_db(graph);
+  auto candidates = collect_candidates(graph, alias_db);
+  const auto plan = BuildMemoryPlan(graph);
+  if (plan.allocations.empty()) {
+    return 0;
+  }
+
+  // Materialize one arena per device at the top of the graph.
+  std::vector<Value*> arena_values;
+  {
+    WithInsertPoint guard(*graph->block()->nodes().begin());
+    for (const auto& arena : plan.arenas) {
+      arena_values.push_back(graph->insert(
+          aten::empty,
+          {std::vector<int64_t>{static_cast<int64_t>(arena.second)}},
+          {NamedValue("dtype", static_cast<int64_t>(c10::ScalarType::Byte)),
+           NamedValue("device", arena.first)}));
+    }
+  }
+
+  // Rewrite producers in definition order so inserted view chains stay
+  // topologically valid.
+  std::sort(candidates.begin(), candidates.end(), [](const auto& a, const auto& b) {
+    return a.def < b.def;
+  });
+
+  size_t planned = 0;
+  for (const Candidate& c : candidates) {
+    auto alloc_it = plan.allocations.find(c.value);
+    if (alloc_it == plan.allocations.end()) {
+      continue;
+    }
+    const MemoryAllocation& alloc = alloc_it->second;
+    Node* producer = c.value->node();
+
+    WithInsertPoint guard(producer);
+    // Carve the value's bytes out of the arena and view them with the
+    // value's dtype and shape. Slices and views only adjust metadata.
+    Value* flat = graph->insert(
+        aten::slice,
+        {arena_values[alloc.arena],
+         0,
+         static_cast<int64_t>(alloc.offset),
+         static_cast<int64_t>(alloc.offset + c.nbytes),
+         1});
+    Value* typed =
+        graph->insert(aten::view, {flat, static_cast<int64_t>(c.dtype)});
+    Value* shaped = graph->insert(aten::view, {typed, c.sizes});
+
+    Node* out_node = graph->create(producer->kind(), 0);
+    for (Value* input : producer->inputs()) {
+      out_node->addInput(input);
+    }
+    out_node->addInput(shaped);
+    out_node->addOutput()->setType(c.value->type());
+    out_node->insertBefore(producer);
+    if (!out_node->maybeOperator()) {
+      // No out overload matches this particular argument combination (e.g.
+      // a Scalar variant); keep the functional node.
+      out_node->destroy();
+      shaped->node()->destroy();
+      typed->node()->destroy();
+      flat->node()->destroy();
+      continue;
+    }
+    c.value->replaceAllUsesWith(out_node->output());
+    producer->destroy();
+    planned++;
+    GRAPH_UPDATE(
+        "memory_planning: placed ",
+        out_node->kind().toQualString(),
+        " output at arena ",
+        alloc.arena,
+        " offset ",
+        alloc.offset);
+  }
+  GRAPH_DUMP("After PlanMemoryArenas: ", graph);
+  return planned;
+}
+
+} // namespace jit
+} // namespace torch
@@ -0,0 +1,48 @@
+#pragma once
+
+#include <torch/csrc/jit/ir/ir.h>
+
+#include <unordered_map>
+#include <vector>
+
+namespace torch {
+namespace jit {
+
+// Memory planning for frozen inference graphs.
+//
+// BuildMemoryPlan computes the lifetime of every intermediate tensor value
+// with statically known shape, dtype and device, and greedily colors values
+// whose lifetimes do not overlap into shared offsets of one arena per device.
+//
+// PlanMemoryArenas applies the plan to the graph: it materializes each arena
+// as a single aten::empty at the top of the graph and rewrites eligible
+// producers to their out= overloads writing into views of the arena, so the
+// interpreter executes one large allocation per invocation instead of one
+// allocation per intermediate. Only ops with a matching out variant are
+// rewritten; everything else keeps its regular allocation. This pass must run
+// after freezing and after all other graph optimizations, since the inserted
+// out= ops introduce writes that earlier passes do not expect.
+
+struct MemoryAllocation {
+  // Byte offset of this value inside its device's arena.
+  size_t offset;
+  // Size of the value in bytes, rounded up to the arena alignment.
+  size_t size;
+  // Index of the arena (one arena per distinct device in the graph).
+  size_t arena;
+};
+
+struct MemoryPlan {
+  std::unordered_map<const Value*, MemoryAllocation> allocations;
+  // Device and total byte size of each arena.
+  std::vector<std::pair<c10::Device, size_t>> arenas;
+};
+
+TORCH_API MemoryPlan BuildMemoryPlan(const std::shared_ptr<Graph>& graph);
+
+// Builds a plan and rewrites the graph to allocate through it. Returns the
+// number of values that were moved into arenas.
+TORCH_API size_t PlanMemoryArenas(std::shared_ptr<Graph>& graph);
+
+} // namespace jit
+} // namespace torch
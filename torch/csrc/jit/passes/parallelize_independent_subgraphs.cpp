@@ -0,0 +1,239 @@
+#include <torch/csrc/jit/passes/parallelize_independent_subgraphs.h>
+
+#include <torch/csrc/jit/ir/alias_analysis.h>
+#include <torch/csrc/jit/jit_log.h>
+
+#include <functional>
+#include <unordered_map>
+#include <unordered_set>
+
+namespace torch {
+namespace jit {
+
+namespace {
+
+// Component ids assigned to nodes of the top-level block. kJoint marks nodes
+// that merge two components, are unsafe to move, or depend on such a node;
+// they act as barriers and are never forked.
+constexpr int kJoint = -1;
+
+bool isSafeToFork(Node* node, AliasDb& alias_db) {
+  if (node->hasSideEffects()) {
+    return false;
+  }
+  // Control flow captures values from enclosing scopes, which the component
+  // analysis below does not track; treat it as a join point.
+  if (!node->blocks().empty()) {
+    return false;
+  }
+  // Moving a node into an asynchronous task reorders it with respect to the
+  // join nodes, which is only safe if none of the values it touches
+  // participate in mutation anywhere in the graph.
+  if (alias_db.isMutable(node) || alias_db.hasWriters(node)) {
+    return false;
+  }
+  return true;
+}
+
+// Walks up from `node` to the node at the level of `block` that contains it.
+Node* ancestorInBlock(Node* node, Block* block) {
+  Node* cur = node;
+  while (cur->owningBlock() != block) {
+    cur = cur->owningBlock()->owningNode();
+    TORCH_INTERNAL_ASSERT(cur != nullptr);
+  }
+  return cur;
+}
+
+// Assigns every non-constant node of `block` to a component. A node that
+// depends (directly) on nodes from two different components, or that is not
+// safe to fork, becomes kJoint; jointness is inherited by all downstream
+// nodes. The resulting non-joint components are closed under in-block
+// producers: all of a component's external inputs are graph inputs or
+// constants, so the whole component can be forked at the position of its
+// first node.
+std::unordered_map<Node*, int> assignComponents(
+    Block* block,
+    AliasDb& alias_db) {
+  std::unordered_map<Node*, int> components;
+  int next_id = 0;
+  for (Node* node : block->nodes()) {
+    if (node->kind() == prim::Constant) {
+      // Constants are cloned into the forked subgraphs as needed and never
+      // tie components together.
+      continue;
+    }
+    constexpr int kUnassigned = -2;
+    int id = kUnassigned;
+    for (Value* input : node->inputs()) {
+      auto it = components.find(input->node());
+      if (it == components.end()) {
+        // Graph input or constant; does not constrain the component.
+        continue;
+      }
+      if (id == kUnassigned) {
+        id = it->second;
+      } else if (id != it->second) {
+        id = kJoint;
+      }
+    }
+    if (!isSafeToFork(node, alias_db)) {
+      id = kJoint;
+    }
+    if (id == kUnassigned) {
+      id = next_id++;
+    }
+    components[node] = id;
+  }
+  return components;
+}
+
+// Moves `nodes` (a component in topological order) into a prim::fork and
+// replaces their external uses with the result of an aten::wait inserted
+// before the earliest external consumer.
+void forkComponent(Graph* graph, Block* block, const std::vector<Node*>& nodes) {
+  std::unordered_set<Node*> node_set(nodes.begin(), nodes.end());
+
+  // Values produced by the component but consumed outside of it (including
+  // graph outputs and uses from inner blocks of join nodes).
+  std::vector<Value*> external_outputs;
+  for (Node* node : nodes) {
+    for (Value* output : node->outputs()) {
+      for (const Use& use : output->uses()) {
+        if (!node_set.count(use.user)) {
+          external_outputs.push_back(output);
+          break;
+        }
+      }
+    }
+  }
+  if (external_outputs.empty()) {
+    // Dead component; leave it for DCE.
+    return;
+  }
+
+  auto subgraph = std::make_shared<Graph>();
+  Node* fork_node = graph->create(prim::fork, /*num_outputs=*/1);
+  fork_node->g_(attr::Subgraph, subgraph);
+  fork_node->insertBefore(nodes.front());
+
+  std::unordered_map<Value*, Value*> value_map;
+  std::function<Value*(Value*)> env = [&](Value* v) -> Value* {
+    auto it = value_map.find(v);
+    if (it != value_map.end()) {
+      return it->second;
+    }
+    if (v->node()->kind() == prim::Constant) {
+      Value* cloned =
+          subgraph->insertNode(subgraph->createClone(v->node(), env))
+              ->outputs()
+              .at(v->offset());
+      value_map[v] = cloned;
+      return cloned;
+    }
+    // Graph input: pass it into the fork.
+    Value* input = subgraph->addInput()->copyMetadata(v);
+    fork_node->addInput(v);
+    value_map[v] = input;
+    return input;
+  };
+
+  for (Node* node : nodes) {
+    Node* cloned = subgraph->insertNode(subgraph->createClone(node, env));
+    for (const auto i : c10::irange(node->outputs().size())) {
+      value_map[node->output(i)] = cloned->output(i);
+    }
+  }
+
+  const bool multiple_outputs = external_outputs.size() > 1;
+  if (multiple_outputs) {
+    std::vector<Value*> mapped;
+    mapped.reserve(external_outputs.size());
+    for (Value* output : external_outputs) {
+      mapped.push_back(value_map.at(output));
+    }
+    Value* tuple = subgraph->appendNode(subgraph->createTuple(mapped))->output();
+    subgraph->registerOutput(tuple);
+  } else {
+    subgraph->registerOutput(value_map.at(external_outputs[0]));
+  }
+  fork_node->output()->setType(
+      FutureType::create(subgraph->outputs().at(0)->type()));
+
+  // Wait as late as possible: right before the earliest external consumer,
+  // so the forked work overlaps with everything in between.
+  Node* earliest = nullptr;
+  for (Value* output : external_outputs) {
+    for (const Use& use : output->uses()) {
+      if (node_set.count(use.user)) {
+        continue;
+      }
+      Node* user = ancestorInBlock(use.user, block);
+      if (user == block->return_node()) {
+        continue;
+      }
+      if (earliest == nullptr || user->isBefore(earliest)) {
+        earliest = user;
+      }
+    }
+  }
+  WithInsertPoint insert_guard(
+      earliest != nullptr ? earliest : block->return_node());
+  Value* waited = graph->insert(aten::wait, {fork_node->output()});
+  if (multiple_outputs) {
+    Node* unpack = graph->insertNode(graph->createTupleUnpack(waited));
+    for (const auto i : c10::irange(external_outputs.size())) {
+      external_outputs[i]->replaceAllUsesWith(unpack->output(i));
+    }
+  } else {
+    external_outputs[0]->replaceAllUsesWith(waited);
+  }
+
+  for (auto it = nodes.rbegin(); it != nodes.rend(); ++it) {
+    (*it)->destroy();
+  }
+}
+
+} // namespace
+
+void ParallelizeIndependentSubgraphs(
+    const std::shared_ptr<Graph>& graph,
+    size_t min_subgraph_size) {
+  Block* block = graph->block();
+  AliasDb alias_db(graph);
+  auto components = assignComponents(block, alias_db);
+
+  // Group the nodes of each non-joint component in topological order.
+  std::unordered_map<int, std::vector<Node*>> grouped;
+  for (Node* node : block->nodes()) {
+    auto it = components.find(node);
+    if (it == components.end() || it->second == kJoint) {
+      continue;
+    }
+    grouped[it->second].push_back(node);
+  }
+
+  std::vector<std::vector<Node*>> candidates;
+  for (auto& entry : grouped) {
+    if (entry.second.size() >= min_subgraph_size) {
+      candidates.emplace_back(std::move(entry.second));
+    }
+  }
+  // With fewer than two branches there is nothing to overlap; the main
+  // thread would fork and then immediately wait.
+  if (candidates.size() < 2) {
+    return;
+  }
+
+  GRAPH_DEBUG(
+      "ParallelizeIndependentSubgraphs: forking ",
+      candidates.size(),
+      " independent branches");
+  for (const auto& component : candidates) {
+    forkComponent(graph.get(), block, component);
+  }
+  GRAPH_DUMP("After ParallelizeIndependentSubgraphs: ", graph);
+}
+
+} // namespace jit
+} // namespace torch
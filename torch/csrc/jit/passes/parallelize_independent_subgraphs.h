@@ -0,0 +1,24 @@
+#pragma once
+
+#include <torch/csrc/jit/ir/ir.h>
+
+namespace torch {
+namespace jit {
+
+// Detects independent branches in the top-level block of the graph (e.g.
+// parallel feature towers that only meet at a final concat) and rewrites
+// each branch into a prim::fork whose result is awaited right before its
+// first consumer. The forked subgraphs then run concurrently on the
+// inter-op thread pool without any model changes or Python-side threading.
+//
+// Only side-effect-free nodes whose values do not participate in any
+// mutation are moved into forks; everything else acts as a join point and
+// stays in place. The rewrite is skipped unless at least two branches with
+// `min_subgraph_size` nodes each are found, since a single fork would just
+// make the main thread wait.
+TORCH_API void ParallelizeIndependentSubgraphs(
+    const std::shared_ptr<Graph>& graph,
+    size_t min_subgraph_size = 2);
+
+} // namespace jit
+} // namespace torch
@@ -0,0 +1,197 @@
+#include <torch/csrc/jit/passes/reorder_for_locality.h>
+
+#include <torch/csrc/jit/ir/alias_analysis.h>
+#include <torch/csrc/jit/jit_log.h>
+
+#include <c10/util/irange.h>
+
+#include <algorithm>
+#include <unordered_map>
+#include <vector>
+
+namespace torch {
+namespace jit {
+
+namespace {
+
+// The greedy scheduler below is quadratic in the number of nodes; graphs past
+// this size keep their original order.
+constexpr size_t kMaxNodesToSchedule = 8192;
+
+// Bytes produced by a value, taken from its (profiled or static) TensorType.
+// Values without concrete shape and dtype information weigh nothing, so they
+// neither attract nor repel the scheduler.
+size_t value_bytes(const Value* v) {
+  auto ttype = v->type()->cast<TensorType>();
+  if (!ttype) {
+    return 0;
+  }
+  auto dtype = ttype->scalarType();
+  auto sizes = ttype->sizes().concrete_sizes();
+  if (!dtype || !sizes) {
+    return 0;
+  }
+  int64_t numel = 1;
+  for (auto s : *sizes) {
+    numel *= s;
+  }
+  return static_cast<size_t>(numel) * c10::elementSize(*dtype);
+}
+
+struct Scheduler {
+  explicit Scheduler(Block* block) : block_(block) {
+    for (Node* n : block->nodes()) {
+      index_of_[n] = nodes_.size();
+      nodes_.push_back(n);
+    }
+  }
+
+  // A node is movable only if executing it in a different (topologically
+  // valid) position cannot be observed.
+  bool is_safe_to_schedule(AliasDb& alias_db) const {
+    for (Node* n : nodes_) {
+      if (!n->blocks().empty() || n->hasSideEffects() ||
+          alias_db.hasWriters(n)) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  std::vector<Node*> run() {
+    const size_t num_nodes = nodes_.size();
+    // Number of not-yet-scheduled producers of each node, and number of
+    // not-yet-scheduled consumers of each value.
+    std::vector<size_t> pending_deps(num_nodes, 0);
+    std::unordered_map<const Value*, size_t> pending_uses;
+    for (const auto i : c10::irange(num_nodes)) {
+      for (Value* input : nodes_[i]->inputs()) {
+        auto it = index_of_.find(input->node());
+        if (it != index_of_.end()) {
+          pending_deps[i]++;
+          pending_uses[input]++;
+        }
+      }
+    }
+
+    std::vector<bool> scheduled(num_nodes, false);
+    std::vector<size_t> ready;
+    for (const auto i : c10::irange(num_nodes)) {
+      if (pending_deps[i] == 0) {
+        ready.push_back(i);
+      }
+    }
+
+    std::vector<Node*> schedule;
+    schedule.reserve(num_nodes);
+    Node* last_scheduled = nullptr;
+    while (!ready.empty()) {
+      // Pick the ready node with the best net effect on the live set: bytes
+      // whose last consumer this node is, minus bytes its outputs allocate.
+      // Ties prefer consumers of the node scheduled right before (keeping
+      // producer and consumer adjacent while the output is still hot), then
+      // the original order for determinism.
+      size_t best_pos = 0;
+      int64_t best_score = 0;
+      bool best_adjacent = false;
+      bool have_best = false;
+      for (const auto pos : c10::irange(ready.size())) {
+        Node* n = nodes_[ready[pos]];
+        int64_t score = 0;
+        bool adjacent = false;
+        for (Value* input : n->inputs()) {
+          auto it = pending_uses.find(input);
+          if (it != pending_uses.end() && it->second == 1) {
+            score += static_cast<int64_t>(value_bytes(input));
+          }
+          if (last_scheduled != nullptr && input->node() == last_scheduled) {
+            adjacent = true;
+          }
+        }
+        for (Value* output : n->outputs()) {
+          score -= static_cast<int64_t>(value_bytes(output));
+        }
+        const bool better = !have_best || score > best_score ||
+            (score == best_score && adjacent && !best_adjacent) ||
+            (score == best_score && adjacent == best_adjacent &&
+             ready[pos] < ready[best_pos]);
+        if (better) {
+          best_pos = pos;
+          best_score = score;
+          best_adjacent = adjacent;
+          have_best = true;
+        }
+      }
+
+      const size_t chosen = ready[best_pos];
+      ready.erase(ready.begin() + best_pos);
+      Node* n = nodes_[chosen];
+      scheduled[chosen] = true;
+      schedule.push_back(n);
+      last_scheduled = n;
+
+      for (Value* input : n->inputs()) {
+        auto it = pending_uses.find(input);
+        if (it != pending_uses.end()) {
+          it->second--;
+        }
+      }
+      for (Value* output : n->outputs()) {
+        for (const Use& use : output->uses()) {
+          auto it = index_of_.find(use.user);
+          if (it != index_of_.end() && --pending_deps[it->second] == 0) {
+            ready.push_back(it->second);
+          }
+        }
+      }
+    }
+    return schedule;
+  }
+
+  const std::vector<Node*>& nodes() const {
+    return nodes_;
+  }
+
+ private:
+  Block* block_;
+  std::vector<Node*> nodes_;
+  std::unordered_map<const Node*, size_t> index_of_;
+};
+
+} // namespace
+
+bool ReorderForLocality(std::shared_ptr<Graph>& graph) {
+  Block* block = graph->block();
+  Scheduler scheduler(block);
+  if (scheduler.nodes().size() < 3 ||
+      scheduler.nodes().size() > kMaxNodesToSchedule) {
+    return false;
+  }
+  AliasDb alias_db(graph);
+  if (!scheduler.is_safe_to_schedule(alias_db)) {
+    GRAPH_DEBUG(
+        "ReorderForLocality: graph has side effects, writers or sub-blocks; ",
+        "keeping the original order");
+    return false;
+  }
+
+  auto schedule = scheduler.run();
+  // A node can only be unscheduled if the dependency counting above missed an
+  // edge; in that case leave the graph alone.
+  if (schedule.size() != scheduler.nodes().size()) {
+    return false;
+  }
+  if (std::equal(
+          schedule.begin(), schedule.end(), scheduler.nodes().begin())) {
+    return false;
+  }
+
+  for (Node* n : schedule) {
+    n->moveBefore(block->return_node());
+  }
+  GRAPH_DUMP("After ReorderForLocality: ", graph);
+  return true;
+}
+
+} // namespace jit
+} // namespace torch
@@ -0,0 +1,21 @@
+#pragma once
+
+#include <torch/csrc/jit/ir/ir.h>
+
+namespace torch {
+namespace jit {
+
+// Reorders the nodes of a graph, within dependency constraints, to shrink the
+// live set of intermediate tensors and keep producers adjacent to their
+// consumers. The interpreter emits instructions in node order, so this
+// directly controls execution order and with it cache locality and peak
+// memory. Sizes recorded by the profiling executor (or static shapes) are
+// used as weights; values without concrete shape information weigh nothing.
+//
+// The pass only touches flat, side-effect-free blocks: if any top-level node
+// has sub-blocks, side effects, or writers, the graph is left unchanged.
+// Returns true if the order was changed.
+TORCH_API bool ReorderForLocality(std::shared_ptr<Graph>& graph);
+
+} // namespace jit
+} // namespace torch
@@ -36,12 +36,14 @@
 #include <torch/csrc/jit/passes/fold_conv_bn.h>
 #include <torch/csrc/jit/passes/freeze_module.h>
 #include <torch/csrc/jit/passes/frozen_concat_linear.h>
+#include <torch/csrc/jit/passes/frozen_constant_dedup.h>
 #include <torch/csrc/jit/passes/frozen_conv_add_relu_fusion.h>
 #include <torch/csrc/jit/passes/frozen_conv_folding.h>
 #include <torch/csrc/jit/passes/frozen_graph_optimizations.h>
 #include <torch/csrc/jit/passes/frozen_linear_folding.h>
 #include <torch/csrc/jit/passes/frozen_linear_transpose.h>
 #include <torch/csrc/jit/passes/frozen_ops_to_mkldnn.h>
+#include <torch/csrc/jit/passes/frozen_weight_layouts.h>
 #include <torch/csrc/jit/passes/fuse_linear.h>
 #include <torch/csrc/jit/passes/fuse_relu.h>
 #include <torch/csrc/jit/passes/graph_fuser.h>
@@ -50,7 +52,9 @@
 #include <torch/csrc/jit/passes/integer_value_refinement.h>
 #include <torch/csrc/jit/passes/loop_unrolling.h>
 #include <torch/csrc/jit/passes/lower_graph.h>
+#include <torch/csrc/jit/passes/parallelize_independent_subgraphs.h>
 #include <torch/csrc/jit/passes/lower_tuples.h>
+#include <torch/csrc/jit/passes/memory_planning.h>
 #include <torch/csrc/jit/passes/metal_rewrite.h>
 #include <torch/csrc/jit/passes/mobile_optimizer_type.h>
 #include <torch/csrc/jit/passes/normalize_ops.h>
@@ -64,6 +68,7 @@
 #include <torch/csrc/jit/passes/quantization/quantization_type.h>
 #include <torch/csrc/jit/passes/refine_tuple_types.h>
 #include <torch/csrc/jit/passes/remove_dropout.h>
+#include <torch/csrc/jit/passes/reorder_for_locality.h>
 #include <torch/csrc/jit/passes/remove_expands.h>
 #include <torch/csrc/jit/passes/remove_inplace_ops.h>
 #include <torch/csrc/jit/passes/remove_mutation.h>
@@ -417,7 +422,14 @@ void initJITBindings(PyObject* module) {
       .def("_jit_pass_convert_frozen_ops_to_mkldnn", &ConvertFrozenOpsToMKLDNN)
       .def("_jit_pass_fuse_frozen_conv_add_relu", &FuseFrozenConvAddRelu)
       .def("_jit_pass_transpose_frozen_linear", &FrozenLinearTranspose)
+      .def(
+          "_jit_pass_finalize_frozen_weight_layouts",
+          static_cast<bool (*)(std::shared_ptr<Graph>&)>(
+              &FrozenFinalizeWeightLayouts))
       .def("_jit_pass_optimize_frozen_graph", &OptimizeFrozenGraph)
+      .def(
+          "_jit_pass_dedup_frozen_tensor_constants",
+          [](Module& module) { return DedupFrozenTensorConstants(module); })
       .def(
           "_jit_pass_optimize_for_inference",
           [](Module& module, std::vector<std::string> other_methods) {
@@ -425,6 +437,16 @@ void initJITBindings(PyObject* module) {
           },
           py::arg("module"),
           py::arg("other_methods") = std::vector<std::string>())
+      .def(
+          "_jit_pass_reorder_for_locality",
+          [](std::shared_ptr<Graph>& graph) {
+            return ReorderForLocality(graph);
+          })
+      .def(
+          "_jit_pass_plan_memory_arenas",
+          [](std::shared_ptr<Graph>& graph) {
+            return PlanMemoryArenas(graph);
+          })
       .def("_jit_pass_fuse_linear", &FuseLinear)
       .def(
           "_jit_pass_fuse_add_relu",
@@ -628,6 +650,11 @@ void initJITBindings(PyObject* module) {
       .def("_jit_pass_remove_expands", RemoveExpands)
       .def("_jit_pass_erase_number_types", EraseNumberTypes)
       .def("_jit_pass_inline_fork_wait", InlineForkWait)
+      .def(
+          "_jit_pass_parallelize_independent_subgraphs",
+          ParallelizeIndependentSubgraphs,
+          py::arg("graph"),
+          py::arg("min_subgraph_size") = 2)
       .def("_jit_pass_inline", Inline)
       .def(
           "_jit_pass_lower_graph",
@@ -1009,6 +1036,18 @@ void initJITBindings(PyObject* module) {
             using namespace torch::jit::tensorexpr;
             getOptConditionals() = opt_conds;
           })
+      .def(
+          "_jit_set_te_kernel_code_cache_enabled",
+          [](bool enabled) {
+            using namespace torch::jit::tensorexpr;
+            getKernelCodeCacheEnabled() = enabled;
+          })
+      .def(
+          "_jit_te_kernel_code_cache_enabled",
+          []() {
+            using namespace torch::jit::tensorexpr;
+            return getKernelCodeCacheEnabled();
+          })
       .def(
           "_llvm_enabled",
           []() {
@@ -1145,6 +1145,13 @@ void initJitScriptBindings(PyObject* module) {
              py::handle value) {
             m.register_attribute(name, type, toIValue(value, type));
           })
+      // See Note [Double-buffered parameter storage] in module.h
+      .def("_inactive_parameter", &Module::inactive_parameter)
+      .def(
+          "_swap_parameter_generations",
+          &Module::swap_parameter_generations,
+          py::call_guard<py::gil_scoped_release>())
+      .def("_parameter_generation", &Module::parameter_generation)
       .def(
           "_create_method_from_trace",
           [](Module& self,
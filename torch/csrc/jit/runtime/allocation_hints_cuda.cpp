@@ -0,0 +1,29 @@
+// Registers the CUDA sink for the profiling executor's allocation hints
+// (see getGraphAllocationHintsEnabled): predicted allocation sizes are
+// forwarded to the caching allocator for the device, pinned to the
+// thread's current stream — the stream the upcoming run allocates on.
+#include <torch/csrc/jit/runtime/profiling_graph_executor_impl.h>
+
+#include <c10/cuda/CUDACachingAllocator.h>
+#include <c10/cuda/CUDAStream.h>
+
+namespace torch::jit {
+namespace {
+
+void forwardHintsToCudaAllocator(
+    c10::DeviceIndex device,
+    const std::vector<size_t>& sizes) {
+  auto stream = c10::cuda::getCurrentCUDAStream(device);
+  c10::cuda::CUDACachingAllocator::setAllocationHints(
+      device, stream.stream(), sizes);
+}
+
+struct SinkRegistration {
+  SinkRegistration() {
+    detail::setAllocationHintSink(&forwardHintsToCudaAllocator);
+  }
+};
+SinkRegistration registration;
+
+} // namespace
+} // namespace torch::jit
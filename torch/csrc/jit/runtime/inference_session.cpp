@@ -0,0 +1,101 @@
+#include <torch/csrc/jit/runtime/inference_session.h>
+
+#include <c10/core/InferenceMode.h>
+#include <c10/core/StreamGuard.h>
+#include <c10/util/irange.h>
+#include <torch/csrc/jit/runtime/graph_executor.h>
+
+#include <utility>
+
+namespace torch::jit {
+
+namespace detail {
+namespace {
+
+InferenceSessionCudaBackend& cudaBackend() {
+  static InferenceSessionCudaBackend backend;
+  return backend;
+}
+
+} // namespace
+
+void setInferenceSessionCudaBackend(InferenceSessionCudaBackend backend) {
+  cudaBackend() = backend;
+}
+
+const InferenceSessionCudaBackend& getInferenceSessionCudaBackend() {
+  return cudaBackend();
+}
+
+} // namespace detail
+
+InferenceSession::InferenceSession(
+    Module module,
+    c10::Device device,
+    InferenceSessionOptions options)
+    : module_(std::move(module)), device_(device), options_(options) {
+  TORCH_CHECK(
+      device_.is_cpu() || device_.is_cuda(),
+      "InferenceSession supports CPU and CUDA devices, got ",
+      device_);
+  module_.eval();
+  if (device_.is_cuda()) {
+    const auto& backend = detail::getInferenceSessionCudaBackend();
+    TORCH_CHECK(
+        backend.acquire_stream != nullptr,
+        "InferenceSession on a CUDA device requires a CUDA build of torch");
+    stream_ = backend.acquire_stream(device_, options_.private_cuda_pool);
+    owns_pool_ = options_.private_cuda_pool;
+  }
+}
+
+InferenceSession::~InferenceSession() {
+  if (stream_.has_value()) {
+    detail::getInferenceSessionCudaBackend().release_stream(
+        *stream_, owns_pool_);
+  }
+}
+
+void InferenceSession::addWarmupInputs(std::vector<IValue> inputs) {
+  warmup_inputs_.emplace_back(std::move(inputs));
+}
+
+IValue InferenceSession::runOnSessionStream(std::vector<IValue> inputs) {
+  c10::InferenceMode inference_guard;
+  if (stream_.has_value()) {
+    c10::StreamGuard stream_guard(*stream_);
+    return module_.forward(std::move(inputs));
+  }
+  return module_.forward(std::move(inputs));
+}
+
+void InferenceSession::warmup() {
+  if (device_.is_cuda() && options_.pinned_pool_bytes > 0) {
+    detail::getInferenceSessionCudaBackend().pre_warm_pinned(
+        options_.pinned_pool_bytes, options_.pinned_block_bytes);
+  }
+  // The profiling executor only swaps in its optimized plan after
+  // getNumProfiledRuns() profiled executions, so run each bucket past that
+  // point: the final runs execute exactly the plan the first real request
+  // of that shape will see, and fill every shape-keyed cache underneath it
+  // (allocator blocks in the session pool, cuDNN benchmark results,
+  // cublasLt heuristics). Extra runs on an already-settled executor are
+  // cheap, so this over-counts harmlessly under the simple executor.
+  const size_t runs = getNumProfiledRuns() + 1 + options_.extra_warmup_runs;
+  for (const auto& inputs : warmup_inputs_) {
+    for (const auto i : c10::irange(runs)) {
+      (void)i;
+      (void)runOnSessionStream(inputs);
+    }
+  }
+  if (stream_.has_value()) {
+    stream_->synchronize();
+  }
+  warmed_up_ = true;
+}
+
+IValue InferenceSession::run(std::vector<IValue> inputs) {
+  return runOnSessionStream(std::move(inputs));
+}
+
+} // namespace torch::jit
@@ -0,0 +1,112 @@
+#pragma once
+
+#include <c10/core/Device.h>
+#include <c10/core/Stream.h>
+#include <c10/util/Optional.h>
+#include <torch/csrc/jit/api/module.h>
+
+#include <vector>
+
+namespace torch::jit {
+
+struct InferenceSessionOptions {
+  // Route every allocation made on the session stream to a private CUDA
+  // memory pool (see CUDACachingAllocator::assignStreamToPool), so
+  // concurrent sessions never exchange blocks or inherit the cross-stream
+  // event dependencies block reuse creates. Ignored on CPU.
+  bool private_cuda_pool = true;
+  // Grow the pinned host allocator's free list to this many bytes during
+  // warmup(), so the first request's H2D staging does not pay for pinning.
+  // Zero leaves the pinned pool to fill lazily.
+  size_t pinned_pool_bytes = 0;
+  size_t pinned_block_bytes = 1ULL << 20;
+  // Warm-up runs per shape bucket beyond what the profiling executor needs
+  // to settle on its optimized plan.
+  size_t extra_warmup_runs = 1;
+};
+
+/// Bundles the per-model state a serving process otherwise warms up
+/// implicitly (and therefore on the first real request): a dedicated
+/// stream backed by a private CUDA memory pool, a pre-grown pinned host
+/// pool, and every lazily filled shape-keyed cache reached by executing
+/// the module (profiling-executor plans, cuDNN benchmark results,
+/// cublasLt heuristics). Register one example input vector per shape
+/// bucket the service expects, call warmup() once at startup, then serve
+/// with run(); the first real request of each registered shape runs at
+/// steady state.
+///
+/// The session is not thread-safe; use one session per serving thread
+/// (they may share the Module's parameters, which are read-only here).
+class TORCH_API InferenceSession {
+ public:
+  InferenceSession(
+      Module module,
+      c10::Device device,
+      InferenceSessionOptions options = InferenceSessionOptions());
+  ~InferenceSession();
+  InferenceSession(const InferenceSession&) = delete;
+  InferenceSession& operator=(const InferenceSession&) = delete;
+
+  /// Registers one example input vector for warmup(). Call once per
+  /// distinct shape bucket; inputs must already live on the session
+  /// device.
+  void addWarmupInputs(std::vector<IValue> inputs);
+
+  /// Runs every registered shape bucket on the session stream until the
+  /// executor and the backend caches below it are at steady state, grows
+  /// the pinned pool if requested, and synchronizes the stream.
+  void warmup();
+
+  /// Runs the module's forward on the session stream under InferenceMode.
+  IValue run(std::vector<IValue> inputs);
+
+  Module& module() {
+    return module_;
+  }
+  const c10::optional<c10::Stream>& stream() const {
+    return stream_;
+  }
+  bool warmed_up() const {
+    return warmed_up_;
+  }
+
+ private:
+  IValue runOnSessionStream(std::vector<IValue> inputs);
+
+  Module module_;
+  c10::Device device_;
+  InferenceSessionOptions options_;
+  // Set iff the device is CUDA; bound to a private allocator pool when
+  // options_.private_cuda_pool is set.
+  c10::optional<c10::Stream> stream_;
+  bool owns_pool_ = false;
+  std::vector<std::vector<IValue>> warmup_inputs_;
+  bool warmed_up_ = false;
+};
+
+namespace detail {
+
+// Filled in at load time by inference_session_cuda.cpp in CUDA builds.
+// Keeps the session itself free of c10::cuda dependencies so it can live
+// in the CPU library, the same split register_cuda_ops.cpp uses for the
+// TorchScript CUDA API.
+struct InferenceSessionCudaBackend {
+  // Returns a fresh stream on `device`, routed to a freshly minted
+  // private memory pool when `private_pool` is set.
+  c10::Stream (*acquire_stream)(c10::Device device, bool private_pool) =
+      nullptr;
+  // Detaches the stream from its pool (if any); the last detach makes the
+  // pool's cached segments releasable.
+  void (*release_stream)(c10::Stream stream, bool private_pool) = nullptr;
+  // Grows the pinned host allocator's free list; see
+  // at::cuda::CachingHostAllocator_preWarm.
+  void (*pre_warm_pinned)(size_t bytes, size_t block_bytes) = nullptr;
+};
+
+TORCH_API void setInferenceSessionCudaBackend(
+    InferenceSessionCudaBackend backend);
+TORCH_API const InferenceSessionCudaBackend& getInferenceSessionCudaBackend();
+
+} // namespace detail
+
+} // namespace torch::jit
@@ -0,0 +1,47 @@
+// Registers the CUDA backend for InferenceSession: session streams come
+// from the CUDA stream pool and, when requested, get routed to a private
+// caching-allocator pool for their lifetime.
+#include <torch/csrc/jit/runtime/inference_session.h>
+
+#include <ATen/cuda/CUDAGraph.h>
+#include <ATen/cuda/CachingHostAllocator.h>
+#include <c10/cuda/CUDACachingAllocator.h>
+#include <c10/cuda/CUDAStream.h>
+
+namespace torch::jit {
+namespace {
+
+c10::Stream acquireStream(c10::Device device, bool private_pool) {
+  auto stream =
+      c10::cuda::getStreamFromPool(/*isHighPriority=*/false, device.index());
+  if (private_pool) {
+    c10::cuda::CUDACachingAllocator::assignStreamToPool(
+        stream.device_index(), stream.stream(), at::cuda::graph_pool_handle());
+  }
+  return stream.unwrap();
+}
+
+void releaseStream(c10::Stream stream, bool private_pool) {
+  if (private_pool) {
+    c10::cuda::CUDAStream cuda_stream(stream);
+    // Dropping the last reference also releases the pool's cached
+    // segments; see unassignStreamFromPool.
+    c10::cuda::CUDACachingAllocator::unassignStreamFromPool(
+        cuda_stream.device_index(), cuda_stream.stream());
+  }
+}
+
+void preWarmPinned(size_t bytes, size_t block_bytes) {
+  at::cuda::CachingHostAllocator_preWarm(bytes, block_bytes);
+}
+
+struct BackendRegistration {
+  BackendRegistration() {
+    detail::setInferenceSessionCudaBackend(
+        {&acquireStream, &releaseStream, &preWarmPinned});
+  }
+};
+BackendRegistration registration;
+
+} // namespace
+} // namespace torch::jit
@@ -1,6 +1,8 @@
 #include <torch/csrc/jit/runtime/profiling_graph_executor_impl.h>
 
+#include <c10/core/ScalarType.h>
 #include <c10/util/Optional.h>
+#include <c10/util/hash.h>
 #include <c10/util/irange.h>
 #include <torch/csrc/jit/jit_log.h>
 #include <torch/csrc/jit/passes/add_if_then_else.h>
@@ -35,6 +37,7 @@
 #include <torch/csrc/jit/passes/tensorexpr_fuser.h>
 #include <torch/csrc/jit/passes/update_differentiable_graph_requires_grad.h>
 #include <torch/csrc/jit/passes/utils/subgraph_utils.h>
+#include <algorithm>
 #include <mutex>
 
 C10_DEFINE_bool(
@@ -57,6 +60,13 @@ C10_DEFINE_bool(
     false,
     "fuse on 12 dynamic compilations");
 
+C10_DEFINE_bool(
+    torch_jit_symbolic_plan_cache,
+    false,
+    "cache one optimized plan per symbolic input signature (tensor "
+    "rank/dtype/device, ignoring concrete dimension values) instead of a "
+    "single plan, so shape-polymorphic traffic does not keep deoptimizing");
+
 constexpr size_t kDefaultNumProfiledRuns = 1;
 constexpr size_t kDefaultBailoutDepth = 20;
 
@@ -81,6 +91,29 @@ static std::atomic<bool> profiling_mode{true};
 
 static std::mutex fusion_strategy_lock;
 
+static std::atomic<bool> graph_allocation_hints_enabled{false};
+
+std::atomic<bool>& getGraphAllocationHintsEnabled() {
+  return graph_allocation_hints_enabled;
+}
+
+namespace detail {
+
+static AllocationHintSink& allocationHintSink() {
+  static AllocationHintSink sink = nullptr;
+  return sink;
+}
+
+void setAllocationHintSink(AllocationHintSink sink) {
+  allocationHintSink() = sink;
+}
+
+AllocationHintSink getAllocationHintSink() {
+  return allocationHintSink();
+}
+
+} // namespace detail
+
 static FusionStrategy getInitialStrategy() {
   if (FLAGS_torch_jit_always_dynamic) {
     return {{FusionBehavior::DYNAMIC, 12}};
@@ -665,9 +698,160 @@ const ExecutionPlan& ProfilingGraphExecutorImpl::getOptimizedPlanFor(
   CheckStrictFusion(copy);
   GRAPH_DUMP("Optimized Graph: ", copy);
   optimized_plan_ = ExecutionPlan(copy, function_name_);
+  // the first run after planning allocates too
+  maybeForwardAllocationHints();
   return *optimized_plan_;
 }
 
+// Hashes the properties of the inputs that the symbolic plan cache
+// specializes on. Concrete dimension values are deliberately left out: two
+// calls that differ only in, say, batch size or sequence length map to the
+// same signature and share one plan. Within that plan, dynamic-shape fusion
+// (FusionBehavior::DYNAMIC) generalizes the profiled shapes symbolically,
+// and the usual fallback functions cover anything the guards reject.
+static size_t symbolicInputSignature(Stack& stack, size_t num_inputs) {
+  if (stack.size() < num_inputs) {
+    // e.g. the warm-up call for a fallback function's executor passes an
+    // empty stack; all such calls share one signature.
+    return 0;
+  }
+  size_t sig = num_inputs;
+  for (const IValue& input : last(stack, num_inputs)) {
+    if (input.isTensor()) {
+      const at::Tensor& t = input.toTensor();
+      if (!t.defined()) {
+        sig = c10::hash_combine(sig, 1);
+        continue;
+      }
+      sig = c10::hash_combine(sig, static_cast<size_t>(t.dim()));
+      sig = c10::hash_combine(sig, static_cast<size_t>(t.scalar_type()));
+      sig = c10::hash_combine(sig, static_cast<size_t>(t.device().type()));
+      sig = c10::hash_combine(sig, static_cast<size_t>(t.requires_grad()));
+    } else {
+      sig = c10::hash_combine(sig, std::hash<std::string>()(input.tagKind()));
+    }
+  }
+  return sig;
+}
+
+const ExecutionPlan& ProfilingGraphExecutorImpl::getPlanForSymbolicSignature(
+    Stack& stack,
+    c10::optional<size_t> remaining_bailout_depth) {
+  auto& entry = symbolic_plan_cache_[symbolicInputSignature(
+      stack, graph->inputs().size())];
+  if (entry.optimized_plan) {
+    return *entry.optimized_plan;
+  }
+  GRAPH_DEBUG(
+      "Running ProfilingGraphExecutorImpl (symbolic plan cache) ", this);
+
+  // see getOptimizedPlanFor for why the depth is persisted here
+  if (!remaining_bailout_depth_.has_value() || !tensorExprFuserEnabled()) {
+    if (remaining_bailout_depth.has_value()) {
+      remaining_bailout_depth_ = *remaining_bailout_depth;
+    } else {
+      remaining_bailout_depth_ = getInstantiatedBailoutDepth();
+    }
+  }
+
+  // simple executor
+  if (*remaining_bailout_depth_ == 0) {
+    auto copy = graph->copy();
+    runProfilingInsensitiveOptimizations(copy);
+    GRAPH_DUMP("Optimized SimpleExecutor Graph: ", copy);
+    entry.optimized_plan = ExecutionPlan(copy, function_name_);
+    return *entry.optimized_plan;
+  }
+
+  // Each signature profiles under its own record, so specializing for a
+  // newly seen signature never invalidates the plans already compiled for
+  // the others.
+  if (!entry.pr) {
+    auto copy = graph->copy();
+    runProfilingInsensitiveOptimizations(copy);
+    entry.pr = ProfilingRecord::instrumentGraph(copy);
+    // see getOptimizedPlanFor for the pass-ordering constraint
+    InsertProfileNodesForSpecializeAutogradZero(entry.pr.get());
+    GRAPH_DUMP("Profiled Graph: ", entry.pr->graph());
+    entry.profiling_plan = ExecutionPlan(entry.pr->graph(), function_name_);
+    // fall-through
+  }
+
+  // profile until a graph is ready
+  if (!entry.pr->ready()) {
+    return *entry.profiling_plan;
+  }
+
+  auto copy = entry.pr->graph()->copy();
+  ProfilingRecord::removeProfileCounter(copy->block());
+  runProfilingOptimizations(copy, *remaining_bailout_depth_);
+  replaceFallbackGraphWithFallbackFunction(copy->block());
+  runFinalOptimizations(copy);
+  CheckStrictFusion(copy);
+  GRAPH_DUMP("Optimized Graph: ", copy);
+  entry.optimized_plan = ExecutionPlan(copy, function_name_);
+  return *entry.optimized_plan;
+}
+
+// Predicted allocation sequence for one run of an optimized graph: the
+// size in bytes of every CUDA tensor with fully known shape and dtype
+// that a top-level node produces, grouped by device in execution order.
+// Values inside sub-blocks (loops, ifs, fallback paths) are skipped —
+// those allocations are not certain to happen.
+static std::vector<std::pair<c10::DeviceIndex, std::vector<size_t>>>
+collectAllocationHints(Block* block) {
+  std::vector<std::pair<c10::DeviceIndex, std::vector<size_t>>> hints;
+  for (Node* n : block->nodes()) {
+    for (Value* output : n->outputs()) {
+      auto tt = output->type()->cast<TensorType>();
+      if (!tt || !tt->device() || !tt->device()->is_cuda() ||
+          !tt->scalarType()) {
+        continue;
+      }
+      auto sizes = tt->sizes().concrete_sizes();
+      if (!sizes) {
+        continue;
+      }
+      size_t nbytes = c10::elementSize(*tt->scalarType());
+      for (int64_t s : *sizes) {
+        nbytes *= static_cast<size_t>(std::max<int64_t>(s, 0));
+      }
+      if (nbytes == 0) {
+        continue;
+      }
+      const c10::DeviceIndex index =
+          tt->device()->has_index() ? tt->device()->index() : 0;
+      auto it = std::find_if(
+          hints.begin(), hints.end(), [index](const auto& device_hints) {
+            return device_hints.first == index;
+          });
+      if (it == hints.end()) {
+        hints.emplace_back(index, std::vector<size_t>{});
+        it = std::prev(hints.end());
+      }
+      it->second.push_back(nbytes);
+    }
+  }
+  return hints;
+}
+
+void ProfilingGraphExecutorImpl::maybeForwardAllocationHints() {
+  if (C10_LIKELY(!graph_allocation_hints_enabled.load())) {
+    return;
+  }
+  auto sink = detail::getAllocationHintSink();
+  if (sink == nullptr) {
+    return;
+  }
+  if (!allocation_hints_computed_) {
+    allocation_hints_ = collectAllocationHints(optimized_plan_->graph->block());
+    allocation_hints_computed_ = true;
+  }
+  for (const auto& device_hints : allocation_hints_) {
+    sink(device_hints.first, device_hints.second);
+  }
+}
+
 const ExecutionPlan& ProfilingGraphExecutorImpl::getPlanFor(
     Stack& stack,
     c10::optional<size_t> remaining_bailout_depth) {
@@ -676,8 +860,15 @@ const ExecutionPlan& ProfilingGraphExecutorImpl::getPlanFor(
   // IMPORTANT: This is a hot path of calling a torchscript function. Try not to
   // add any code above this.
   if (optimized_plan_) {
+    // Prime the allocator for the upcoming run; single relaxed load when
+    // allocation hints are off.
+    maybeForwardAllocationHints();
     return *optimized_plan_;
   }
+  if (C10_UNLIKELY(FLAGS_torch_jit_symbolic_plan_cache) &&
+      getGraphExecutorOptimize() && getProfilingMode()) {
+    return getPlanForSymbolicSignature(stack, remaining_bailout_depth);
+  }
   // if depth is not set, use
   return getOptimizedPlanFor(stack, remaining_bailout_depth);
 }
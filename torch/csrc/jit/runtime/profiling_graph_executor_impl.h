@@ -3,14 +3,42 @@
 #include <torch/csrc/jit/api/module.h>
 #include <torch/csrc/jit/runtime/graph_executor_impl.h>
 
+#include <atomic>
+#include <unordered_map>
+#include <vector>
+
 C10_DECLARE_bool(torch_jit_static_then_dynamic);
 
 C10_DECLARE_bool(torch_jit_always_dynamic);
 
+C10_DECLARE_bool(torch_jit_symbolic_plan_cache);
+
 namespace torch::jit {
 
 TORCH_API void runNooptPassPipeline(std::shared_ptr<Graph>& graph);
 
+// When set, an executor whose optimized plan is ready forwards the plan's
+// predicted allocation sequence (sizes of the tensors its nodes produce,
+// in execution order) to the caching allocator before each run, so the
+// allocator can pre-split cached blocks into exact fits. Off by default;
+// a no-op unless a sink is registered (CUDA builds register one at load
+// time, see allocation_hints_cuda.cpp). Hit-rate counters live in
+// CUDACachingAllocator::getAllocationHintStats.
+TORCH_API std::atomic<bool>& getGraphAllocationHintsEnabled();
+
+namespace detail {
+
+// Receives one device's predicted allocation sizes for the upcoming run.
+// Filled in at load time in CUDA builds, keeping this file free of
+// c10::cuda dependencies — the same split inference_session.h uses.
+using AllocationHintSink =
+    void (*)(c10::DeviceIndex device, const std::vector<size_t>& sizes);
+
+TORCH_API void setAllocationHintSink(AllocationHintSink sink);
+TORCH_API AllocationHintSink getAllocationHintSink();
+
+} // namespace detail
+
 struct TORCH_API ProfilingGraphExecutorImpl : public GraphExecutorImplBase {
   ProfilingGraphExecutorImpl(
       const std::shared_ptr<Graph>& graph,
@@ -28,6 +56,9 @@ struct TORCH_API ProfilingGraphExecutorImpl : public GraphExecutorImplBase {
     fallback_plan_.reset();
     profiling_plan_.reset();
     optimized_plan_.reset();
+    allocation_hints_.clear();
+    allocation_hints_computed_ = false;
+    symbolic_plan_cache_.clear();
     // prevent memory leaks
     fallback_functions_.clear();
     remaining_bailout_depth_.reset();
@@ -36,13 +67,36 @@ struct TORCH_API ProfilingGraphExecutorImpl : public GraphExecutorImplBase {
   }
 
   bool isOptimized() const override {
-    return optimized_plan_.has_value();
+    if (optimized_plan_.has_value()) {
+      return true;
+    }
+    for (const auto& entry : symbolic_plan_cache_) {
+      if (entry.second.optimized_plan.has_value()) {
+        return true;
+      }
+    }
+    return false;
   }
 
  private:
+  // Per-signature compilation state used when
+  // FLAGS_torch_jit_symbolic_plan_cache is set. A signature abstracts over
+  // the concrete dimension values of the tensor inputs (it keeps rank,
+  // dtype, device and requires_grad), so all concrete lengths of, say, a
+  // (batch, seqlen) input share one profiling record and one optimized
+  // plan instead of repeatedly deoptimizing a single cached plan.
+  struct SymbolicPlanCacheEntry {
+    std::unique_ptr<ProfilingRecord> pr;
+    c10::optional<ExecutionPlan> profiling_plan;
+    c10::optional<ExecutionPlan> optimized_plan;
+  };
+
   const ExecutionPlan& getOptimizedPlanFor(
       Stack& stack,
       c10::optional<size_t> remaining_bailout_depth);
+  const ExecutionPlan& getPlanForSymbolicSignature(
+      Stack& stack,
+      c10::optional<size_t> remaining_bailout_depth);
   void runProfilingInsensitiveOptimizations(std::shared_ptr<Graph>& graph);
   void runProfilingOptimizations(
       std::shared_ptr<Graph>& graph,
@@ -54,10 +108,19 @@ struct TORCH_API ProfilingGraphExecutorImpl : public GraphExecutorImplBase {
       std::shared_ptr<Graph>& graph,
       size_t remaining_bailout_depth);
   void runFinalOptimizations(std::shared_ptr<Graph>& graph);
+  // Forwards optimized_plan_'s predicted allocation sequence to the
+  // registered sink; cheap no-op unless getGraphAllocationHintsEnabled().
+  // Requires compile_mutex and a set optimized_plan_.
+  void maybeForwardAllocationHints();
   std::unique_ptr<ProfilingRecord> pr_;
   c10::optional<ExecutionPlan>
       profiling_plan_; // plan to run in order to profiling the code
   c10::optional<ExecutionPlan> optimized_plan_;
+  // Per-device predicted allocation sizes for one run of optimized_plan_,
+  // computed lazily by maybeForwardAllocationHints.
+  std::vector<std::pair<c10::DeviceIndex, std::vector<size_t>>>
+      allocation_hints_;
+  bool allocation_hints_computed_ = false;
   FusionStrategy fusion_strategy_;
 
   // this plan is used if getGraphExecutorOptimize is unset
@@ -72,6 +135,11 @@ struct TORCH_API ProfilingGraphExecutorImpl : public GraphExecutorImplBase {
   // of the GraphExecutor and only shared with InterpreterState
   std::vector<std::unique_ptr<Function>> fallback_functions_;
   c10::optional<size_t> remaining_bailout_depth_;
+  // guarded by compile_mutex; empty unless
+  // FLAGS_torch_jit_symbolic_plan_cache is set. Signatures are coarse
+  // (rank/dtype/device per input), so the map stays small even under
+  // highly shape-polymorphic traffic.
+  std::unordered_map<size_t, SymbolicPlanCacheEntry> symbolic_plan_cache_;
 };
 
 } // namespace torch::jit
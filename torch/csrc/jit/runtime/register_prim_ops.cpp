@@ -33,7 +33,7 @@ namespace torch::jit {
 namespace {
 
 std::string stringSlice(
-    std::string string,
+    const std::string& string,
     c10::optional<int64_t> start,
     c10::optional<int64_t> end,
     int64_t step) {
@@ -43,8 +43,14 @@ std::string stringSlice(
   const int64_t num_vals =
       slice_indices_adjust(string.size(), &start_val, &end_val, step);
 
+  if (step == 1) {
+    // The common contiguous slice is a single copy of the selected range.
+    return string.substr(start_val, num_vals);
+  }
+
   int64_t i = start_val;
-  std::string result = "";
+  std::string result;
+  result.reserve(num_vals);
   for (const auto j : c10::irange(num_vals)) {
     (void)j; // Suppress unused variable warning
     result += string[i];
@@ -61,7 +67,7 @@ c10::List<std::string> splitNoneSeparator(const std::string& string) {
   c10::List<std::string> splits;
   // whitespaces includes tab, space and
   // the delimiters defined in the implementation of splitlines
-  std::string whitespaces =
+  static const std::string whitespaces =
       " \t\n\r\r\n\v\x0b\f\x0c\x1c\x1d\x1e\x85\u2028\u2029";
   std::string::size_type prev_pos = 0;
   std::string::size_type pos = 0;
@@ -70,7 +76,7 @@ c10::List<std::string> splitNoneSeparator(const std::string& string) {
     auto substr = string.substr(prev_pos, pos - prev_pos);
     // skip the whitespaces as the Python split() method
     if (!substr.empty()) {
-      splits.emplace_back(substr);
+      splits.emplace_back(std::move(substr));
     }
     pos++;
     prev_pos = pos;
@@ -1652,8 +1658,10 @@ static const std::vector<OperatorGeneratorArgs> stringOpGenArgs{
           int64_t step = pop(stack).toInt();
           c10::optional<int64_t> end = pop(stack).toOptional<int64_t>();
           c10::optional<int64_t> start = pop(stack).toOptional<int64_t>();
-          std::string string = pop(stack).toStringRef();
-          push(stack, stringSlice(string, start, end, step));
+          // Keeps the popped IValue alive so the string is sliced in place
+          // instead of being copied off the stack first.
+          IValue self = pop(stack);
+          push(stack, stringSlice(self.toStringRef(), start, end, step));
         },
         aliasAnalysisFromSchema()),
     OperatorGeneratorArgs(
@@ -1661,20 +1669,16 @@ static const std::vector<OperatorGeneratorArgs> stringOpGenArgs{
             "aten::strip(str self, str chars=' \\n\\t\\f\\v') -> str"),
         [](Stack& stack) {
           std::string chars = pop(stack).toStringRef();
-          std::string string = pop(stack).toStringRef();
+          IValue self = pop(stack);
+          const std::string& string = self.toStringRef();
+          std::string result;
           auto rindex = string.find_last_not_of(chars);
           if (rindex != std::string::npos) {
-            string = string.substr(0, rindex + 1);
-          } else {
-            string = "";
+            // rindex found a kept character, so lindex cannot be npos.
+            auto lindex = string.find_first_not_of(chars);
+            result = string.substr(lindex, rindex - lindex + 1);
           }
-          auto lindex = string.find_first_not_of(chars);
-          if (lindex != std::string::npos) {
-            string = string.substr(lindex, string.size());
-          } else {
-            string = "";
-          }
-          push(stack, string);
+          push(stack, std::move(result));
         },
         aliasAnalysisFromSchema()),
     OperatorGeneratorArgs(
@@ -1683,7 +1687,8 @@ static const std::vector<OperatorGeneratorArgs> stringOpGenArgs{
         [](Stack& stack) {
           int64_t max = pop(stack).toInt();
           IValue ivalue = pop(stack);
-          std::string string = pop(stack).toStringRef();
+          IValue self = pop(stack);
+          const std::string& string = self.toStringRef();
 
           std::string::size_type prev_pos = 0;
           std::string::size_type pos = 0;
@@ -1724,8 +1729,9 @@ static const std::vector<OperatorGeneratorArgs> stringOpGenArgs{
             "aten::splitlines(str self, bool keepends=False) -> str[]"),
         [](Stack& stack) {
           bool keepends = pop(stack).toBool();
-          std::string string = pop(stack).toStringRef();
-          std::string delimiters =
+          IValue self = pop(stack);
+          const std::string& string = self.toStringRef();
+          static const std::string delimiters =
               "\n\r\r\n\v\x0b\f\x0c\x1c\x1d\x1e\x85\u2028\u2029";
           c10::List<std::string> splits;
 
@@ -7,7 +7,9 @@
 #include <c10/core/InferenceMode.h>
 #include <c10/macros/Macros.h>
 #include <c10/util/MaybeOwned.h>
+#include <c10/util/hash.h>
 #include <c10/util/irange.h>
+#include <c10/util/llvmMathExtras.h>
 #include <caffe2/core/scope_guard.h>
 #include <caffe2/core/timer.h>
 #include <torch/csrc/jit/ir/alias_analysis.h>
@@ -1083,6 +1085,58 @@ void BlockRunner::create_memory_planner() {
 
 namespace {
 
+// Hashes the shapes of all tensor arguments, rounding each dimension up to
+// the next power of two so that nearby input sizes (e.g. batch sizes 100
+// and 128) fall into the same bucket and share one memory plan. Tensors
+// passed via kwargs do not participate in the signature; a collision only
+// costs plan quality, never correctness, since plans tolerate size
+// mismatches.
+uint64_t inputShapeSignature(const std::vector<c10::IValue>& args) {
+  uint64_t signature = args.size();
+  for (const auto& arg : args) {
+    if (!arg.isTensor()) {
+      continue;
+    }
+    const auto& tensor = arg.toTensor();
+    signature = c10::hash_combine(signature, tensor.dim());
+    for (const auto dim : tensor.sizes()) {
+      signature = c10::hash_combine(
+          signature, c10::llvm::PowerOf2Ceil(static_cast<uint64_t>(dim)));
+    }
+  }
+  return signature;
+}
+
+} // namespace
+
+void BlockRunner::swap_plan_for_input_shapes(
+    const std::vector<c10::IValue>& args) {
+  const uint64_t signature = inputShapeSignature(args);
+  if (C10_LIKELY(signature == cur_plan_signature_)) {
+    return;
+  }
+  if (cur_plan_signature_ == 0) {
+    // First call with a planner in place; adopt the plan recorded so far as
+    // belonging to this signature instead of throwing the warmup away.
+    cur_plan_signature_ = signature;
+    return;
+  }
+  plan_size_cache_[cur_plan_signature_] = planner_->planSizes();
+  auto it = plan_size_cache_.find(signature);
+  if (it != plan_size_cache_.end()) {
+    planner_->setPlanSizes(it->second);
+  } else {
+    // New bucket: start from zero sizes so this bucket records its own
+    // footprint. The next run falls back to the default allocator for
+    // managed tensors, like a first run, and the run after that reuses
+    // the arena sized for this bucket.
+    planner_->setPlanSizes({});
+  }
+  cur_plan_signature_ = signature;
+}
+
+namespace {
+
 void destroyNodeOutputs(ProcessedNode& p_node) {
   const auto borrows_outputs = borrowsOutputs(p_node.node()->kind());
   const auto num_outputs = static_cast<uint32_t>(p_node.num_outputs());
@@ -1304,6 +1358,9 @@ c10::IValue BlockRunner::run_impl(
 
     if (planner_) {
       DCHECK(!manage_output_tensors_enabled_ || checkOutputTensorMemoryLeaks());
+      if (C10_UNLIKELY(static_module_.opts().enable_shape_plan_cache)) {
+        swap_plan_for_input_shapes(args);
+      }
       planner_->allocate();
     }
 
@@ -172,6 +172,13 @@ struct TORCH_API StaticModuleOptions {
   bool use_maybe_copy_variants{true};
   // enable TensorExpr fusion of ops at model loading time
   bool enable_tensorexpr_fusion{false};
+  // cache memory-plan sizes per input shape signature so workloads with a
+  // few recurring input shapes (e.g. variable batch sizes) keep arena reuse
+  // for each shape instead of planning for the largest shape ever seen.
+  // Shapes are bucketed by rounding each dimension up to the next power of
+  // two, so nearby batch sizes share one plan (enable_out_variant must be
+  // true).
+  bool enable_shape_plan_cache{false};
 };
 
 /*
@@ -739,6 +746,12 @@ class TORCH_API BlockRunner {
 
   void create_memory_planner();
 
+  // Swaps the memory planner's recorded sizes when the input shape bucket
+  // changes, stashing the plan for the outgoing bucket and restoring (or
+  // starting fresh) the plan for the incoming one. Only called when
+  // `enable_shape_plan_cache` is set.
+  void swap_plan_for_input_shapes(const std::vector<c10::IValue>& args);
+
   float benchmark_model(
       const std::vector<std::vector<c10::IValue>>& args_list,
       const std::vector<KeywordArgs>& kwargs_list,
@@ -760,6 +773,11 @@ class TORCH_API BlockRunner {
 
   bool manage_output_tensors_enabled_ = false;
   std::unique_ptr<MemoryPlanner> planner_;
+  // Maps an input shape signature to the memory-plan sizes recorded for
+  // that bucket; only populated when `enable_shape_plan_cache` is set.
+  c10::FastMap<uint64_t, std::vector<size_t>> plan_size_cache_;
+  // Shape signature the current plan was recorded under.
+  uint64_t cur_plan_signature_ = 0;
   // [Shared values array]
   // ProcessedNodes reference their inputs and outputs with
   // offsets into this array, which saves memory.
@@ -353,6 +353,27 @@ void MemoryPlanner::deallocate() {
   buffer_ = {};
 }
 
+void MemoryPlanner::setPlanSizes(const std::vector<size_t>& sizes) {
+  if (storages_nbytes_.empty()) {
+    // deallocate() has not recorded any sizes yet; nothing to swap.
+    return;
+  }
+  TORCH_CHECK(
+      sizes.empty() || sizes.size() == storages_nbytes_.size(),
+      "setPlanSizes expects one size per storage group");
+  managed_bytes_ = 0;
+  for (const auto i : c10::irange(storages_nbytes_.size())) {
+    const size_t new_size = sizes.empty() ? 0 : sizes[i];
+    if (new_size == 0 && storages_nbytes_[i] != 0) {
+      // allocate() skips zero-sized groups, so reset the storage here to
+      // make sure a stale nbytes can't point an op at the old arena.
+      storages_[i].reset();
+    }
+    storages_nbytes_[i] = new_size;
+    managed_bytes_ += new_size;
+  }
+}
+
 void MemoryPlanner::deallocateOutputTensors() {
   size_t output_buffer_bytes = 0;
   for (auto& ms : managed_output_tensors_) {
@@ -397,6 +418,19 @@ StandardMemoryPlanner::StandardMemoryPlanner(
   }
 }
 
+void StandardMemoryPlanner::setPlanSizes(const std::vector<size_t>& sizes) {
+  MemoryPlanner::setPlanSizes(sizes);
+  if (storages_nbytes_.empty()) {
+    return;
+  }
+  TORCH_INTERNAL_ASSERT(storages_nbytes_.size() == managed_tensors_.size());
+  // Keep the per-group maximums in sync so the next deallocate() grows the
+  // restored plan instead of the one that was just swapped out.
+  for (const auto i : c10::irange(managed_tensors_.size())) {
+    managed_tensors_[i].setMaxTensorSize(storages_nbytes_[i]);
+  }
+}
+
 void StandardMemoryPlanner::allocateManagedTensors() {
   if (managed_bytes_ == 0) {
     return;
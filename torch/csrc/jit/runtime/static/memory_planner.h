@@ -230,6 +230,19 @@ class MemoryPlanner {
     return buffer_start_ <= data_ptr && data_ptr < buffer_end_;
   }
 
+  // Returns the per-storage-group sizes (in bytes) currently recorded for
+  // this plan. Empty until the first call to deallocate().
+  const std::vector<size_t>& planSizes() const {
+    return storages_nbytes_;
+  }
+
+  // Replaces the recorded per-storage-group sizes, e.g. when restoring a
+  // cached plan for a different input shape bucket. `sizes` must have one
+  // entry per storage group; an empty vector resets every group to zero,
+  // which makes the next run behave like a first run for sizing purposes.
+  // Virtual because subclasses keep their own size bookkeeping in sync.
+  virtual void setPlanSizes(const std::vector<size_t>& sizes);
+
  protected:
   uint8_t* allocateBuffer(size_t num_bytes);
 
@@ -288,6 +301,9 @@ class StandardMemoryPlanner : public MemoryPlanner {
       bool manage_output_tensors,
       bool optimize_memory);
 
+ public:
+  void setPlanSizes(const std::vector<size_t>& sizes) override;
+
  protected:
   void allocateManagedTensors() override;
   void deallocateManagedTensors() override;
@@ -102,6 +102,15 @@ void addFormattedArg(
 
 void tupleUnpack(Stack& stack) {
   auto tuple = pop(stack).toTuple();
+  if (tuple.use_count() == 1) {
+    // The stack held the only reference, so the elements can be moved onto
+    // the stack instead of doing a refcount bump on each of them.
+    auto elements = std::move(*tuple).elements();
+    for (auto& element : elements) {
+      stack.push_back(std::move(element));
+    }
+    return;
+  }
   stack.insert(stack.end(), tuple->elements().begin(), tuple->elements().end());
 }
 
@@ -268,6 +277,14 @@ void listUnpack(Stack& stack, size_t num_outputs) {
       num_outputs,
       " elements in a list but found ",
       list.size());
+  if (list.use_count() == 1) {
+    // Sole owner of the list: extract the elements instead of copying them,
+    // which skips a refcount bump per element.
+    for (const auto i : c10::irange(num_outputs)) {
+      stack.push_back(list.extract(i));
+    }
+    return;
+  }
   stack.insert(stack.end(), list.begin(), list.end());
 }
 
@@ -352,12 +369,12 @@ void dictConstruct(
       dict_type.containedType(0), dict_type.containedType(1));
   vals.reserve(num_inputs / 2);
   // loop from the bottom of the stack to ensure the dictConstruct preserve
-  // the inputs order.
-  auto inputs = last(stack, num_inputs);
+  // the inputs order. The stack entries are consumed here, so they can be
+  // moved into the dict rather than copied.
+  const auto offset = stack.size() - num_inputs;
   for (size_t i = 0; i < num_inputs; i += 2) {
-    auto key = inputs[i];
-    auto val = inputs[i + 1];
-    vals.insert_or_assign(std::move(key), std::move(val));
+    vals.insert_or_assign(
+        std::move(stack[offset + i]), std::move(stack[offset + i + 1]));
   }
   drop(stack, num_inputs);
   push(stack, std::move(vals));
@@ -0,0 +1,119 @@
+#include <torch/csrc/jit/serialization/constant_dedup.h>
+
+#include <c10/util/irange.h>
+
+#include <atomic>
+#include <cstdlib>
+#include <cstring>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+namespace torch {
+namespace jit {
+
+namespace {
+
+bool dedupEnabledDefault() {
+  const char* env = std::getenv("TORCH_JIT_DEDUP_CONSTANT_TENSORS");
+  return env != nullptr && std::strcmp(env, "1") == 0;
+}
+
+std::atomic<bool>& dedupEnabledFlag() {
+  static std::atomic<bool> enabled{dedupEnabledDefault()};
+  return enabled;
+}
+
+// Only dense, contiguous CPU tensors participate: they cover the serving use
+// case (host-resident constants), their content hash is a plain byte scan,
+// and sharing their storage has no cross-device implications.
+bool isEligible(const at::Tensor& tensor) {
+  return tensor.defined() && tensor.device().is_cpu() &&
+      tensor.layout() == at::kStrided && tensor.is_contiguous() &&
+      !tensor.is_quantized() && tensor.numel() > 0;
+}
+
+// FNV-1a over the dtype, shape and raw bytes.
+size_t contentHash(const at::Tensor& tensor) {
+  constexpr uint64_t kPrime = 1099511628211ULL;
+  uint64_t hash = 14695981039346656037ULL;
+  auto mix = [&](const char* data, size_t size) {
+    for (const auto i : c10::irange(size)) {
+      hash = (hash ^ static_cast<uint8_t>(data[i])) * kPrime;
+    }
+  };
+  const auto dtype = static_cast<int16_t>(tensor.scalar_type());
+  mix(reinterpret_cast<const char*>(&dtype), sizeof(dtype));
+  for (const auto size : tensor.sizes()) {
+    mix(reinterpret_cast<const char*>(&size), sizeof(size));
+  }
+  mix(static_cast<const char*>(tensor.const_data_ptr()),
+      tensor.numel() * tensor.element_size());
+  return static_cast<size_t>(hash);
+}
+
+bool contentEqual(const at::Tensor& a, const at::Tensor& b) {
+  return a.scalar_type() == b.scalar_type() && a.sizes().equals(b.sizes()) &&
+      std::memcmp(
+          a.const_data_ptr(),
+          b.const_data_ptr(),
+          a.numel() * a.element_size()) == 0;
+}
+
+class ConstantTensorRegistry {
+ public:
+  static ConstantTensorRegistry& get() {
+    static ConstantTensorRegistry registry;
+    return registry;
+  }
+
+  at::Tensor dedup(const at::Tensor& tensor) {
+    const size_t hash = contentHash(tensor);
+    std::lock_guard<std::mutex> guard(mutex_);
+    auto& bucket = buckets_[hash];
+    // Look for a live entry with identical content, pruning expired weak
+    // references along the way so the registry does not accumulate tombstones
+    // as modules are unloaded.
+    for (auto it = bucket.begin(); it != bucket.end();) {
+      auto impl = it->lock();
+      if (!impl) {
+        it = bucket.erase(it);
+        continue;
+      }
+      at::Tensor candidate(std::move(impl));
+      if (contentEqual(tensor, candidate)) {
+        return candidate;
+      }
+      ++it;
+    }
+    bucket.emplace_back(tensor.getIntrusivePtr());
+    return tensor;
+  }
+
+ private:
+  using WeakTensorImpl =
+      c10::weak_intrusive_ptr<c10::TensorImpl, c10::UndefinedTensorImpl>;
+
+  std::mutex mutex_;
+  std::unordered_map<size_t, std::vector<WeakTensorImpl>> buckets_;
+};
+
+} // namespace
+
+void setConstantTensorDedupEnabled(bool enabled) {
+  dedupEnabledFlag().store(enabled);
+}
+
+bool constantTensorDedupEnabled() {
+  return dedupEnabledFlag().load();
+}
+
+at::Tensor dedupConstantTensor(const at::Tensor& tensor) {
+  if (!constantTensorDedupEnabled() || !isEligible(tensor)) {
+    return tensor;
+  }
+  return ConstantTensorRegistry::get().dedup(tensor);
+}
+
+} // namespace jit
+} // namespace torch
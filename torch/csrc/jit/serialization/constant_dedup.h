@@ -0,0 +1,33 @@
+#pragma once
+
+#include <ATen/core/Tensor.h>
+#include <torch/csrc/Export.h>
+
+namespace torch {
+namespace jit {
+
+// Process-wide, content-addressed deduplication of constant tensors.
+//
+// When enabled, tensors loaded into a module's constants table during import
+// are looked up in a global registry by content hash; a tensor whose dtype,
+// shape and bytes match an already-registered constant is replaced by the
+// registered one, so all loaded modules share a single copy of identical
+// constants (vocabulary masks, positional tables, ...). The registry holds
+// only weak references, so it never extends the lifetime of a constant past
+// its last module.
+//
+// Sharing is safe because TorchScript treats constants as immutable; only
+// dense, contiguous CPU tensors are deduplicated.
+//
+// Disabled by default; can also be enabled by setting the environment
+// variable TORCH_JIT_DEDUP_CONSTANT_TENSORS=1.
+TORCH_API void setConstantTensorDedupEnabled(bool enabled);
+TORCH_API bool constantTensorDedupEnabled();
+
+// Returns a previously registered tensor with identical content, or registers
+// and returns `tensor` if it is the first of its kind (or not eligible for
+// deduplication). Returns `tensor` unchanged when deduplication is disabled.
+TORCH_API at::Tensor dedupConstantTensor(const at::Tensor& tensor);
+
+} // namespace jit
+} // namespace torch
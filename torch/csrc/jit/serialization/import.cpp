@@ -25,6 +25,7 @@
 #include <torch/csrc/jit/operator_upgraders/upgraders_entry.h>
 #include <torch/csrc/jit/passes/shape_analysis.h>
 #include <torch/csrc/jit/passes/subgraph_rewrite.h>
+#include <torch/csrc/jit/serialization/constant_dedup.h>
 #include <torch/csrc/jit/serialization/import_read.h>
 #include <torch/csrc/jit/serialization/import_source.h>
 #include <torch/csrc/jit/serialization/source_range_serialization.h>
@@ -33,8 +34,12 @@
 #include <ATen/ATen.h>
 #include <fmt/format.h>
 
+#include <cstdio>
+#include <fstream>
+#include <set>
 #include <string>
 #include <unordered_map>
+#include <unordered_set>
 #include <vector>
 
 namespace torch::jit {
@@ -154,7 +159,8 @@ class ScriptModuleDeserializer final {
   Module deserialize(
       c10::optional<at::Device> device,
       ExtraFilesMap& extra_files,
-      bool restore_shapes = false);
+      bool restore_shapes = false,
+      bool pin_host_memory = false);
 
  private:
   IValue readArchive(const std::string& archive_name);
@@ -163,6 +169,7 @@ class ScriptModuleDeserializer final {
   std::shared_ptr<PyTorchStreamReader> reader_;
   std::shared_ptr<DeserializationStorageContext> storage_context_;
   c10::optional<at::Device> device_;
+  bool pin_host_memory_ = false;
   std::vector<at::IValue> constants_table_;
   std::string code_prefix_;
   std::string pickle_dir_prefix_;
@@ -185,7 +192,8 @@ IValue ScriptModuleDeserializer::readArchive(const std::string& archive_name) {
       device_,
       *reader_.get(),
       nullptr,
-      storage_context_);
+      storage_context_,
+      pin_host_memory_);
 }
 
 void rewriteQuantizedConvForBC(const Module& module) {
@@ -250,12 +258,14 @@ graph(%x, %packed_params, %stride, %padding, %dilation, %groups, %r_scale, %r_ze
 Module ScriptModuleDeserializer::deserialize(
     c10::optional<at::Device> device,
     ExtraFilesMap& extra_files,
-    bool restore_shapes) {
+    bool restore_shapes,
+    bool pin_host_memory) {
   // we populate the upgraders map before any load starts
   populate_upgraders_graph_map();
 
   C10_LOG_API_USAGE_ONCE("torch.script.load");
   device_ = device;
+  pin_host_memory_ = pin_host_memory;
   // Load extra files.
   for (const auto& kv : extra_files) {
     const std::string& key = "extra/" + kv.first;
@@ -277,7 +287,13 @@ Module ScriptModuleDeserializer::deserialize(
   }
   auto tuple = readArchive("constants").toTuple();
   for (auto constant : tuple->elements()) {
-    constants_table_.push_back(constant.toIValue());
+    IValue value = constant.toIValue();
+    if (value.isTensor()) {
+      // Share storage with identical constants from previously loaded
+      // modules (no-op unless constant deduplication is enabled).
+      value = dedupConstantTensor(value.toTensor());
+    }
+    constants_table_.push_back(std::move(value));
   }
   auto m_ivalue = readArchive("data");
   auto m = Module(m_ivalue.toObject());
@@ -373,7 +389,8 @@ Module import_ir_module(
     c10::optional<at::Device> device,
     ExtraFilesMap& extra_files,
     bool load_debug_files,
-    bool restore_shapes) {
+    bool restore_shapes,
+    bool pin_host_memory) {
   in.seekg(0, in.beg);
   // NOTE: Zipformat can be large files. So using stream version directly
   // instead of reading the file all at once.
@@ -381,7 +398,8 @@ Module import_ir_module(
     auto reader = std::make_unique<PyTorchStreamReader>(&in);
     reader->setShouldLoadDebugSymbol(load_debug_files);
     ScriptModuleDeserializer deserializer(std::move(cu), std::move(reader));
-    return deserializer.deserialize(device, extra_files, restore_shapes);
+    return deserializer.deserialize(
+        device, extra_files, restore_shapes, pin_host_memory);
   }
   std::shared_ptr<char> data;
   size_t size = 0;
@@ -423,14 +441,16 @@ Module import_ir_module(
     c10::optional<at::Device> device,
     ExtraFilesMap& extra_files,
     bool load_debug_files,
-    bool restore_shapes) {
+    bool restore_shapes,
+    bool pin_host_memory) {
   // NOTE: Zipformat can be large files. So using stream version directly
   // instead of reading the file all at once.
   if (getFileFormat(filename) != FileFormat::FlatbufferFileFormat) {
     auto reader = std::make_unique<PyTorchStreamReader>(filename);
     reader->setShouldLoadDebugSymbol(load_debug_files);
     ScriptModuleDeserializer deserializer(std::move(cu), std::move(reader));
-    return deserializer.deserialize(device, extra_files, restore_shapes);
+    return deserializer.deserialize(
+        device, extra_files, restore_shapes, pin_host_memory);
   }
   std::shared_ptr<char> data;
   size_t size = 0;
@@ -484,10 +504,17 @@ Module load(
     std::istream& in,
     c10::optional<at::Device> device,
     ExtraFilesMap& extra_files,
-    bool load_debug_files) {
+    bool load_debug_files,
+    bool pin_host_memory) {
   auto cu = std::make_shared<CompilationUnit>();
   return import_ir_module(
-      std::move(cu), in, device, extra_files, load_debug_files);
+      std::move(cu),
+      in,
+      device,
+      extra_files,
+      load_debug_files,
+      /*restore_shapes=*/false,
+      pin_host_memory);
 }
 
 Module load(
@@ -502,10 +529,17 @@ Module load(
     const std::string& filename,
     c10::optional<at::Device> device,
     ExtraFilesMap& extra_files,
-    bool load_debug_files) {
+    bool load_debug_files,
+    bool pin_host_memory) {
   auto cu = std::make_shared<CompilationUnit>();
   return import_ir_module(
-      std::move(cu), filename, device, extra_files, load_debug_files);
+      std::move(cu),
+      filename,
+      device,
+      extra_files,
+      load_debug_files,
+      /*restore_shapes=*/false,
+      pin_host_memory);
 }
 
 Module load(
@@ -528,6 +562,100 @@ Module load(
       std::move(cu), std::move(rai), device, extra_files, load_debug_files);
 }
 
+Module load_shared_weights(
+    const std::string& filename,
+    c10::optional<c10::Device> device,
+    ExtraFilesMap* extra_files) {
+  TORCH_CHECK(
+      !device.has_value() || device->is_cpu(),
+      "load_shared_weights() keeps weights in the host page cache and only "
+      "supports CPU loads; got device ",
+      device.has_value() ? device->str() : "");
+  TORCH_CHECK(
+      getFileFormat(filename) != FileFormat::FlatbufferFileFormat,
+      "load_shared_weights() requires the zip archive format");
+  auto reader = std::make_shared<PyTorchStreamReader>(filename);
+  reader->setEnableMmapRecords(true);
+  reader->setMmapRecordsCopyOnWrite(true);
+  auto cu = std::make_shared<CompilationUnit>();
+  ScriptModuleDeserializer deserializer(std::move(cu), std::move(reader));
+  ExtraFilesMap default_extra_files;
+  return deserializer.deserialize(
+      device, extra_files ? *extra_files : default_extra_files);
+}
+
+#ifdef __linux__
+namespace {
+// Splits the resident pages of one VMA into bytes still shared with the page
+// cache and bytes privately copied by this process, from /proc/self/smaps.
+// The whole-archive mapping is a single VMA whose start matches the region
+// base; copy-on-write faults dirty pages in place without splitting it.
+std::pair<size_t, size_t> mappingResidency(const void* base, size_t size) {
+  std::ifstream smaps("/proc/self/smaps");
+  std::string line;
+  size_t shared = 0;
+  size_t priv = 0;
+  bool in_vma = false;
+  const auto begin = reinterpret_cast<uintptr_t>(base);
+  const auto end = begin + size;
+  while (std::getline(smaps, line)) {
+    unsigned long long vma_begin = 0;
+    unsigned long long vma_end = 0;
+    if (std::sscanf(line.c_str(), "%llx-%llx", &vma_begin, &vma_end) == 2) {
+      in_vma = vma_begin < end && vma_end > begin;
+    } else if (in_vma) {
+      size_t kb = 0;
+      if (std::sscanf(line.c_str(), "Shared_Clean: %zu kB", &kb) == 1 ||
+          std::sscanf(line.c_str(), "Shared_Dirty: %zu kB", &kb) == 1) {
+        shared += kb * 1024;
+      } else if (
+          std::sscanf(line.c_str(), "Private_Clean: %zu kB", &kb) == 1 ||
+          std::sscanf(line.c_str(), "Private_Dirty: %zu kB", &kb) == 1) {
+        priv += kb * 1024;
+      }
+    }
+  }
+  return {shared, priv};
+}
+} // namespace
+#endif
+
+SharedWeightsStats shared_weights_stats(const Module& module) {
+  SharedWeightsStats stats;
+  std::unordered_set<const void*> seen_storages;
+  std::set<std::pair<const void*, size_t>> regions;
+  auto account = [&](const at::Tensor& tensor) {
+    if (!tensor.defined() || !tensor.device().is_cpu() ||
+        !tensor.has_storage()) {
+      return;
+    }
+    const auto& storage = tensor.storage();
+    const void* data = storage.data();
+    if (data == nullptr || !seen_storages.insert(data).second) {
+      return;
+    }
+    auto region = caffe2::serialize::findMmapRecordRegion(data);
+    if (region.has_value()) {
+      stats.mapped_bytes += storage.nbytes();
+      regions.insert(*region);
+    }
+  };
+  for (const auto& parameter : module.parameters()) {
+    account(parameter);
+  }
+  for (const auto& buffer : module.buffers()) {
+    account(buffer);
+  }
+#ifdef __linux__
+  for (const auto& region : regions) {
+    auto residency = mappingResidency(region.first, region.second);
+    stats.shared_bytes += residency.first;
+    stats.private_bytes += residency.second;
+  }
+#endif
+  return stats;
+}
+
 Module _load_jit_module_from_bytes(
     std::shared_ptr<char> data,
     size_t size,
@@ -42,7 +42,8 @@ TORCH_API Module import_ir_module(
     c10::optional<c10::Device> device,
     ExtraFilesMap& extra_files,
     bool load_debug_files = true,
-    bool restore_shapes = false);
+    bool restore_shapes = false,
+    bool pin_host_memory = false);
 
 // For reading unified serialization format from torch.Package
 TORCH_API Module import_ir_module(
@@ -58,7 +59,8 @@ TORCH_API Module import_ir_module(
     c10::optional<c10::Device> device,
     ExtraFilesMap& extra_files,
     bool load_debug_files = true,
-    bool restore_shapes = false);
+    bool restore_shapes = false,
+    bool pin_host_memory = false);
 
 TORCH_API Module import_ir_module(
     std::shared_ptr<CompilationUnit> cu,
@@ -83,11 +85,17 @@ TORCH_API Module load(
     c10::optional<c10::Device> device = c10::nullopt,
     bool load_debug_files = true);
 
+/// When `pin_host_memory` is true, tensor storages that stay on the host are
+/// allocated from the CUDA caching host (pinned) allocator instead of
+/// pageable memory, so a later copy to the GPU can be asynchronous and
+/// skips the usual staging pass. Requires a CUDA-enabled build; tensors
+/// loaded straight to a CUDA `device` are unaffected.
 TORCH_API Module load(
     std::istream& in,
     c10::optional<c10::Device> device,
     ExtraFilesMap& extra_files,
-    bool load_debug_files = true);
+    bool load_debug_files = true,
+    bool pin_host_memory = false);
 
 /// Loads a serialized `Module` from the given `filename`.
 ///
@@ -103,7 +111,8 @@ TORCH_API Module load(
     const std::string& filename,
     c10::optional<c10::Device> device,
     ExtraFilesMap& extra_files,
-    bool load_debug_files = true);
+    bool load_debug_files = true,
+    bool pin_host_memory = false);
 
 /// Loads a serialized `Module` from the given shared_ptr `rai`.
 ///
@@ -121,6 +130,36 @@ TORCH_API Module load(
     ExtraFilesMap& extra_files,
     bool load_debug_files = true);
 
+/// Breakdown of a module's weight memory for modules loaded with
+/// `load_shared_weights()`. `mapped_bytes` counts parameter and buffer
+/// storages backed by archive mappings; of the resident pages in those
+/// mappings, `shared_bytes` are still shared with the page cache (and with
+/// every other process mapping the same archive) while `private_bytes` have
+/// been copied into this process by writes. The residency split is reported
+/// on Linux only and is zero elsewhere.
+struct TORCH_API SharedWeightsStats {
+  size_t mapped_bytes = 0;
+  size_t shared_bytes = 0;
+  size_t private_bytes = 0;
+};
+
+/// Loads a serialized `Module` with its weights backed by a copy-on-write
+/// mapping of the archive file, instead of private copies of every tensor.
+/// Processes on the same host loading the same file share one set of
+/// physical pages through the page cache; a process that mutates a weight
+/// pays for just the pages it touches. CPU loads only (POSIX, zip format);
+/// weights of compressed archives fall back to private allocations.
+TORCH_API Module load_shared_weights(
+    const std::string& filename,
+    c10::optional<c10::Device> device = c10::nullopt,
+    ExtraFilesMap* extra_files = nullptr);
+
+/// Reports how much of `module`'s weight memory is backed by archive
+/// mappings and how much of it is still shared versus privately copied; see
+/// `SharedWeightsStats`. Modules loaded without `load_shared_weights()`
+/// report all zeros.
+TORCH_API SharedWeightsStats shared_weights_stats(const Module& module);
+
 TORCH_API Module jitModuleFromSourceAndConstants(
     const IValue& ivalue,
     const ExtraFilesMap& source,
@@ -1,3 +1,5 @@
+#include <ATen/ATen.h>
+#include <ATen/detail/CUDAHooksInterface.h>
 #include <caffe2/serialize/inline_container.h>
 #include <torch/csrc/jit/serialization/import_read.h>
 
@@ -12,7 +14,8 @@ IValue readArchiveAndTensors(
     c10::optional<at::Device> device,
     caffe2::serialize::PyTorchStreamReader& stream_reader,
     c10::TypePtr (*type_parser)(const std::string&),
-    std::shared_ptr<DeserializationStorageContext> storage_context) {
+    std::shared_ptr<DeserializationStorageContext> storage_context,
+    bool pin_host_memory) {
   std::string picklename = pickle_prefix + archive_name + ".pkl";
   at::DataPtr pickle_ptr;
   size_t pickle_size = 0;
@@ -35,11 +38,48 @@ IValue readArchiveAndTensors(
   std::string tensor_dir_path =
       (!tensor_prefix.empty()) ? tensor_prefix : archive_name + "/";
 
-  auto read_record = [&](const std::string& name) {
+  auto read_record = [&](const std::string& name) -> at::DataPtr {
     std::string ss = tensor_dir_path + name;
+    if (pin_host_memory) {
+      // Serving processes that copy loaded weights to the GPU themselves
+      // otherwise pay for a pageable read plus a staging copy into pinned
+      // memory. Back the record's storage with the caching host allocator
+      // directly so the subsequent H2D transfer can be asynchronous.
+      const size_t nbytes = stream_reader.getRecordSize(ss);
+      at::DataPtr ptr =
+          at::detail::getCUDAHooks().getPinnedMemoryAllocator()->allocate(
+              nbytes);
+      stream_reader.getRecord(ss, ptr.get(), nbytes);
+      return ptr;
+    }
     return std::get<0>(stream_reader.getRecord(ss));
   };
 
+  // For CUDA-destined tensors, fill the device storage directly instead of
+  // materializing a pageable host tensor and moving it with a blocking
+  // .to(device). Adapters with a GPUDirect path write into device memory
+  // straight from storage; everything else stages through pinned memory and
+  // issues an asynchronous copy, so the transfer of one record overlaps the
+  // disk read of the next. The pinned buffer may be freed immediately: the
+  // caching host allocator holds the block until the copy's event completes.
+  auto read_record_to_device = [&](const std::string& name,
+                                   at::Device device,
+                                   size_t nbytes) -> c10::Storage {
+    std::string ss = tensor_dir_path + name;
+    auto bytes = at::empty(
+        {static_cast<int64_t>(nbytes)},
+        at::TensorOptions().dtype(at::kByte).device(device));
+    if (stream_reader.getRecordToDevice(ss, bytes.mutable_data_ptr(), nbytes)) {
+      return bytes.storage();
+    }
+    auto staging = at::empty(
+        {static_cast<int64_t>(nbytes)},
+        at::TensorOptions().dtype(at::kByte).pinned_memory(true));
+    stream_reader.getRecord(ss, staging.mutable_data_ptr(), nbytes);
+    bytes.copy_(staging, /*non_blocking=*/true);
+    return bytes.storage();
+  };
+
   Unpickler unpickler(
       reader,
       type_resolver ? std::move(*type_resolver) : nullptr,
@@ -49,6 +89,7 @@ IValue readArchiveAndTensors(
       false,
       type_parser,
       storage_context);
+  unpickler.set_device_record_reader(read_record_to_device);
   unpickler.set_version(stream_reader.version());
   return unpickler.parse_ivalue();
 }
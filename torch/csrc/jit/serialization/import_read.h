@@ -22,7 +22,8 @@ TORCH_API IValue readArchiveAndTensors(
     caffe2::serialize::PyTorchStreamReader& stream_reader,
     c10::TypePtr (*type_parser)(const std::string&) =
         Unpickler::defaultTypeParser,
-    std::shared_ptr<DeserializationStorageContext> storage_context = nullptr);
+    std::shared_ptr<DeserializationStorageContext> storage_context = nullptr,
+    bool pin_host_memory = false);
 
 bool check_zip_file(
     std::shared_ptr<caffe2::serialize::ReadAdapterInterface> rai);
@@ -585,28 +585,37 @@ PickleOpCode Unpickler::readInstruction() {
         int64_t numel = args.at(4).toInt();
         caffe2::TypeMeta dtype = at::CPU(type).typeMeta();
 
-        at::DataPtr storage_ptr;
-        if (numel > 0) {
-          // If there are no elements in the tensor, there's no point in
-          // reading a zero (0) byte file from the input stream and paying
-          // that cost.
-          storage_ptr = read_record_(key);
+        if (read_record_to_device_ && numel > 0 && device.is_cuda()) {
+          // Stream the record straight into device memory, skipping the
+          // pageable host tensor and the synchronous .to(device) below.
+          storage =
+              read_record_to_device_(key, device, numel * dtype.itemsize());
         }
+        if (!storage) {
+          at::DataPtr storage_ptr;
+          if (numel > 0) {
+            // If there are no elements in the tensor, there's no point in
+            // reading a zero (0) byte file from the input stream and paying
+            // that cost.
+            storage_ptr = read_record_(key);
+          }
 
-        storage = at::Storage(
-            c10::Storage::use_byte_size_t(),
-            numel * dtype.itemsize(),
-            std::move(storage_ptr),
-            /*allocator=*/nullptr,
-            /*resizable=*/false); // NB: we didn't set any allocator for the
-                                  // tensor
+          storage = at::Storage(
+              c10::Storage::use_byte_size_t(),
+              numel * dtype.itemsize(),
+              std::move(storage_ptr),
+              /*allocator=*/nullptr,
+              /*resizable=*/false); // NB: we didn't set any allocator for the
+                                    // tensor
+        }
         if (storage_context_ != nullptr) {
           storage_context_->addStorage(key, storage);
         }
       }
 
       auto options = at::CPU(type).options();
-      if (use_storage_device_) {
+      if (use_storage_device_ ||
+          (storage.device().is_cuda() && storage.device() == device)) {
         options = options.device(storage.device());
         device = storage.device();
       }
@@ -109,6 +109,17 @@ class TORCH_API Unpickler {
     return parser.parseType(str);
   }
 
+  // Optional direct-to-device storage read, used for tensor records destined
+  // for accelerator devices. When set and it returns a non-null storage, the
+  // record bypasses the pageable host staging tensor and the blocking
+  // .to(device) copy that read_record_ otherwise implies. Returning a null
+  // storage falls back to the host read path.
+  void set_device_record_reader(
+      std::function<c10::Storage(const std::string&, at::Device, size_t)>
+          read_record_to_device) {
+    read_record_to_device_ = std::move(read_record_to_device);
+  }
+
  private:
   // No arguments ensures that a template argument must be specified
   // so that the number of bytes read / type read is explicit
@@ -178,6 +189,8 @@ class TORCH_API Unpickler {
   IValue empty_tuple_;
 
   std::function<at::DataPtr(const std::string&)> read_record_;
+  std::function<c10::Storage(const std::string&, at::Device, size_t)>
+      read_record_to_device_;
   c10::optional<at::Device> device_;
   // When set to true, Unpickler will ignore the pickled device and use the
   // device of the DataPtr returned by the read_record_ function. The default
@@ -13,12 +13,16 @@
 #include <torch/csrc/jit/tensorexpr/analysis.h>
 #include <torch/csrc/jit/tensorexpr/expr.h>
 #include <torch/csrc/jit/tensorexpr/graph_opt.h>
+#include <torch/csrc/jit/tensorexpr/hash_provider.h>
 #include <torch/csrc/jit/tensorexpr/ir_printer.h>
 #include <torch/csrc/jit/tensorexpr/ir_simplifier.h>
 #include <torch/csrc/jit/tensorexpr/loopnest.h>
 #include <torch/csrc/jit/tensorexpr/loopnest_randomization.h>
 #include <torch/csrc/jit/tensorexpr/operators/operators.h>
 
+#include <mutex>
+#include <sstream>
+
 using namespace torch::jit;
 using namespace torch::jit::tensorexpr;
 
@@ -45,6 +49,7 @@ static bool te_generate_block_code = false;
 static bool te_must_use_llvm_on_cpu = true;
 static bool cat_wo_conditionals = true; // NOLINT
 static bool opt_conditionals = false; // NOLINT
+static bool te_kernel_code_cache_enabled = true; // NOLINT
 
 bool setFallbackAllowed(bool value) {
   bool old_value = fallback_allowed;
@@ -128,6 +133,10 @@ bool& getOptConditionals() {
   return opt_conditionals;
 }
 
+bool& getKernelCodeCacheEnabled() {
+  return te_kernel_code_cache_enabled;
+}
+
 c10::optional<at::Device> pickDeviceType(
     const at::ArrayRef<torch::jit::Value*>& inputs) {
   c10::optional<at::Device> device = c10::nullopt;
@@ -1846,7 +1855,7 @@ void TensorExprKernel::compile() {
   }
 
   // Generate code.
-  codegen_ = CreateCodeGen(
+  codegen_ = getCachedOrCreateCodeGen(
       getCodeGenName(backendType),
       stmt_,
       bufferArgs_,
@@ -1854,8 +1863,84 @@ void TensorExprKernel::compile() {
       kernel_func_name_);
 }
 
+// Note [NNC kernel code cache]
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// Fleets routinely compile thousands of fusions whose lowered loop nests are
+// identical modulo the numeric suffixes of variable and buffer names (the
+// same gelu+add body fused under many graphs). Since CodeGen::call binds
+// buffers positionally, any two kernels with structurally identical
+// statements and the same positional argument signature can share one
+// compiled artifact. The cache below keys on the HashProvider hash of the
+// lowered Stmt — whose UniqueNameManager renames variables in first-use
+// order, normalizing the suffixes — plus the backend, device and per-arg
+// dtype/kind signature, and guards against hash collisions by comparing the
+// canonically printed IR (a fresh IRPrinter also renames in first-use
+// order). Entries live for the process, like the fusion kernel specs
+// themselves; a shared artifact reports the function name it was first
+// compiled under in getCodeText. Disable with getKernelCodeCacheEnabled()
+// when per-kernel artifacts are needed (e.g. for profiling by symbol).
+namespace {
+
+struct KernelCodeCacheEntry {
+  std::string canonical_ir;
+  std::shared_ptr<CodeGen> codegen;
+};
+
+std::mutex kernel_code_cache_mutex;
+std::unordered_map<size_t, std::vector<KernelCodeCacheEntry>>&
+kernelCodeCache() {
+  static auto* cache =
+      new std::unordered_map<size_t, std::vector<KernelCodeCacheEntry>>();
+  return *cache;
+}
+
+} // namespace
+
+std::shared_ptr<CodeGen> TensorExprKernel::getCachedOrCreateCodeGen(
+    const std::string& codegen_name,
+    StmtPtr stmt,
+    const std::vector<CodeGen::BufferArg>& buffer_args,
+    at::Device device,
+    const std::string& kernel_func_name) {
+  if (!getKernelCodeCacheEnabled()) {
+    return CreateCodeGen(
+        codegen_name, stmt, buffer_args, device, kernel_func_name);
+  }
+
+  HashProvider hasher;
+  auto stmt_hash = hasher.hash(stmt);
+  std::ostringstream canonical;
+  canonical << codegen_name << '\n' << device << '\n';
+  for (const auto& arg : buffer_args) {
+    canonical << (arg.isVar() ? 's' : 'b') << arg.dtype() << ' ';
+  }
+  canonical << '\n' << *stmt;
+  auto canonical_ir = canonical.str();
+
+  {
+    std::lock_guard<std::mutex> guard(kernel_code_cache_mutex);
+    auto it = kernelCodeCache().find(stmt_hash._h);
+    if (it != kernelCodeCache().end()) {
+      for (const auto& entry : it->second) {
+        if (entry.canonical_ir == canonical_ir) {
+          return entry.codegen;
+        }
+      }
+    }
+  }
+
+  std::shared_ptr<CodeGen> codegen = CreateCodeGen(
+      codegen_name, stmt, buffer_args, device, kernel_func_name);
+  {
+    std::lock_guard<std::mutex> guard(kernel_code_cache_mutex);
+    kernelCodeCache()[stmt_hash._h].push_back(
+        {std::move(canonical_ir), codegen});
+  }
+  return codegen;
+}
+
 void TensorExprKernel::recompile() {
-  codegen_ = CreateCodeGen(
+  codegen_ = getCachedOrCreateCodeGen(
       "llvm_codegen", stmt_, bufferArgs_, device_, kernel_func_name_);
 }
 
@@ -162,6 +162,17 @@ class TORCH_API TensorExprKernel {
   }
   void recompile();
 
+  // Returns a process-wide cached CodeGen when an artifact compiled from a
+  // structurally identical statement with the same argument signature
+  // exists, compiling (and caching) one otherwise. See
+  // Note [NNC kernel code cache] in kernel.cpp.
+  static std::shared_ptr<CodeGen> getCachedOrCreateCodeGen(
+      const std::string& codegen_name,
+      StmtPtr stmt,
+      const std::vector<CodeGen::BufferArg>& buffer_args,
+      at::Device device,
+      const std::string& kernel_func_name);
+
   StmtPtr getCodeGenStmt();
 
   std::string getCodeText(const std::string& attr = "") {
@@ -316,7 +327,9 @@ class TORCH_API TensorExprKernel {
   std::unordered_map<const torch::jit::Value*, BufPtr> bufs_;
   std::unordered_map<const torch::jit::Value*, VarHandle> scalars_;
   std::unordered_map<const torch::jit::Value*, std::string> input_name_map_;
-  std::unique_ptr<CodeGen> codegen_;
+  // Shared because structurally identical kernels reuse one compiled
+  // artifact; see Note [NNC kernel code cache] in kernel.cpp.
+  std::shared_ptr<CodeGen> codegen_;
   at::Device device_ = at::kCPU;
   std::shared_ptr<Graph> graph_;
   Code code_;
@@ -369,6 +382,7 @@ TORCH_API bool fallbackAllowed();
 TORCH_API bool setFallbackAllowed(bool value);
 TORCH_API bool& getCatWoConditionals();
 TORCH_API bool& getOptConditionals();
+TORCH_API bool& getKernelCodeCacheEnabled();
 
 TORCH_API c10::optional<at::Device> pickDeviceType(
     const at::ArrayRef<torch::jit::Value*>& inputs);
@@ -36,6 +36,7 @@
 #pragma GCC diagnostic pop
 
 #include <llvm/Support/Host.h>
+#include <llvm/Support/MD5.h>
 #include <llvm/Support/TargetSelect.h>
 #include <llvm/Transforms/IPO/AlwaysInliner.h>
 #include <llvm/Transforms/Scalar/DCE.h>
@@ -70,6 +71,7 @@
 #include <torch/csrc/jit/jit_log.h>
 
 #include <memory>
+#include <sstream>
 
 using namespace torch::jit::tensorexpr;
 
@@ -530,6 +532,23 @@ LLVMCodeGenImpl::LLVMCodeGenImpl(
   module_->setDataLayout(jit_->getDataLayout());
   module_->setTargetTriple(jit_->getTargetMachine().getTargetTriple().str());
 
+  if (!kernelObjectCacheDir().empty()) {
+    // Rename the module to a fingerprint of the kernel and target so the
+    // persistent object cache (see llvm_jit.cpp) can key the compiled
+    // object by it across process restarts. The kernel symbol name is part
+    // of the key because it is baked into the object.
+    std::ostringstream keyMaterial;
+    keyMaterial << *stmt << '\0' << kernel_func_name_ << '\0' << *triple
+                << '\0' << *cpu << '\0' << *attrs << '\0'
+                << LLVM_VERSION_STRING;
+    llvm::MD5 hasher;
+    hasher.update(keyMaterial.str());
+    llvm::MD5::MD5Result fingerprint;
+    hasher.final(fingerprint);
+    module_->setModuleIdentifier(
+        kTEKernelObjectCachePrefix + fingerprint.digest().str().str());
+  }
+
   // We support float16 ops by casting expr inputs to float32
   // and then casting the result back to float16
 
@@ -725,6 +744,13 @@ void LLVMCodeGenImpl::emitKernel(
     throw std::runtime_error("Function verification failed");
   }
 
+  if (kernelObjectCacheContains(module_->getModuleIdentifier())) {
+    // Warm start: the JIT will load the compiled object from the persistent
+    // cache, so module optimization and the assembly printout below would
+    // be wasted work. The debug text accessors stay empty for such kernels.
+    return;
+  }
+
   optimize(*module_);
 
   asmBuffer.clear();
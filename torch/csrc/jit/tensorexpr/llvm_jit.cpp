@@ -22,13 +22,16 @@ C10_DIAGNOSTIC_POP()
 #pragma GCC diagnostic pop
 #include <llvm/ExecutionEngine/Orc/RTDyldObjectLinkingLayer.h>
 #include <llvm/ExecutionEngine/Orc/SymbolStringPool.h>
+#include <llvm/ExecutionEngine/ObjectCache.h>
 #include <llvm/ExecutionEngine/RTDyldMemoryManager.h>
 #include <llvm/ExecutionEngine/SectionMemoryManager.h>
 #include <llvm/IR/DataLayout.h>
 #include <llvm/IR/Mangler.h>
 #include <llvm/Support/CFGUpdate.h>
 #include <llvm/Support/DynamicLibrary.h>
+#include <llvm/Support/FileSystem.h>
 #include <llvm/Support/Host.h>
+#include <llvm/Support/MemoryBuffer.h>
 #include <llvm/Support/raw_ostream.h>
 #include <llvm/Target/TargetMachine.h>
 
@@ -37,11 +40,36 @@ C10_DIAGNOSTIC_POP()
 #include <c10/util/Half.h>
 
 #include <algorithm>
+#include <cstdlib>
 #include <memory>
 #include <string>
 #include <unordered_set>
 #include <vector>
 
+namespace torch {
+namespace jit {
+namespace tensorexpr {
+
+const std::string& kernelObjectCacheDir() {
+  static const std::string dir = []() {
+    const char* env = std::getenv("PYTORCH_TENSOREXPR_KERNEL_CACHE_DIR");
+    return env ? std::string(env) : std::string();
+  }();
+  return dir;
+}
+
+bool kernelObjectCacheContains(const std::string& moduleId) {
+  const auto& dir = kernelObjectCacheDir();
+  if (dir.empty() || moduleId.rfind(kTEKernelObjectCachePrefix, 0) != 0) {
+    return false;
+  }
+  return llvm::sys::fs::exists(dir + "/" + moduleId + ".o");
+}
+
+} // namespace tensorexpr
+} // namespace jit
+} // namespace torch
+
 using namespace torch::jit::tensorexpr;
 
 template <typename T>
@@ -145,6 +173,78 @@ static void registerIntrinsics(
 namespace llvm {
 namespace orc {
 
+// Persists compiled kernel objects under PYTORCH_TENSOREXPR_KERNEL_CACHE_DIR
+// so that warm process starts load them from disk (mmapped by MemoryBuffer)
+// instead of re-running LLVM optimization and instruction selection. Objects
+// are keyed by the module identifier, which LLVMCodeGenImpl sets to a
+// fingerprint of the lowered stmt, the kernel symbol name and the target
+// triple/cpu/attrs; modules without the fingerprint prefix are passed
+// through uncached.
+class PytorchTEObjectCache : public ObjectCache {
+ public:
+  explicit PytorchTEObjectCache(std::string dir) : dir_(std::move(dir)) {}
+
+  void notifyObjectCompiled(const Module* M, MemoryBufferRef Obj) override {
+    auto path = objectPath(M->getModuleIdentifier());
+    if (path.empty()) {
+      return;
+    }
+    // Write to a unique temporary and rename, so concurrent processes
+    // warming the same cache only ever observe complete objects.
+    SmallString<128> tmpPath;
+    int fd = 0;
+    if (sys::fs::createUniqueFile(path + ".tmp%%%%%%", fd, tmpPath)) {
+      return;
+    }
+    {
+      raw_fd_ostream os(fd, /*shouldClose=*/true);
+      os << Obj.getBuffer();
+    }
+    if (sys::fs::rename(tmpPath, path)) {
+      sys::fs::remove(tmpPath);
+    }
+  }
+
+  std::unique_ptr<MemoryBuffer> getObject(const Module* M) override {
+    auto path = objectPath(M->getModuleIdentifier());
+    if (path.empty()) {
+      return nullptr;
+    }
+    auto buffer = MemoryBuffer::getFile(path);
+    if (!buffer) {
+      // Cache miss (or unreadable entry); fall back to compiling.
+      return nullptr;
+    }
+    return std::move(*buffer);
+  }
+
+ private:
+  std::string objectPath(const std::string& moduleId) const {
+    if (moduleId.rfind(kTEKernelObjectCachePrefix, 0) != 0) {
+      return std::string();
+    }
+    return dir_ + "/" + moduleId + ".o";
+  }
+
+  std::string dir_;
+};
+
+// Returns the process-wide object cache, or nullptr when
+// PYTORCH_TENSOREXPR_KERNEL_CACHE_DIR is unset.
+static PytorchTEObjectCache* getTEObjectCache() {
+  static std::unique_ptr<PytorchTEObjectCache> cache =
+      []() -> std::unique_ptr<PytorchTEObjectCache> {
+    const auto& dir = kernelObjectCacheDir();
+    if (dir.empty()) {
+      return nullptr;
+    }
+    // Best effort; a failure here surfaces as cache misses, not errors.
+    sys::fs::create_directories(dir);
+    return std::make_unique<PytorchTEObjectCache>(dir);
+  }();
+  return cache.get();
+}
+
 // Lightly modified implementation from LLVM's Kaleidoscope JIT tutorial:
 // https://llvm.org/docs/tutorial/BuildingAJIT1.html
 #if LLVM_VERSION_MAJOR >= 9
@@ -165,6 +265,16 @@ class TORCH_API PytorchLLVMJITImpl {
             LLJITBuilder()
                 .setJITTargetMachineBuilder(
                     makeTargetMachineBuilder(triple, cpu, attrs))
+                .setCompileFunctionCreator(
+                    [](JITTargetMachineBuilder JTMB)
+                        -> Expected<
+                            std::unique_ptr<IRCompileLayer::IRCompiler>> {
+                      // A null cache makes this equivalent to the default
+                      // compiler; otherwise compiled objects are persisted
+                      // and warm starts are served from disk.
+                      return std::make_unique<ConcurrentIRCompiler>(
+                          std::move(JTMB), getTEObjectCache());
+                    })
 #if LLVM_VERSION_MAJOR >= 17
                 .setObjectLinkingLayerCreator([&](ExecutionSession& ES,
                                                   const Triple& TT) {
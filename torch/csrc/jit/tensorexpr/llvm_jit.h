@@ -39,6 +39,21 @@ inline void assertSuccess(llvm::Error err, const char* msg = nullptr) {
   TORCH_INTERNAL_ASSERT(!err, formatError(std::move(err), msg));
 }
 
+// Modules whose identifier starts with this prefix carry a content
+// fingerprint and participate in the persistent kernel object cache; see
+// llvm_jit.cpp. Plain module names (e.g. "pytorch") are never cached.
+constexpr const char* kTEKernelObjectCachePrefix = "te_obj_";
+
+// Directory holding the persistent cache of compiled kernel objects, from
+// the PYTORCH_TENSOREXPR_KERNEL_CACHE_DIR environment variable. An empty
+// string means the cache is disabled.
+TORCH_API const std::string& kernelObjectCacheDir();
+
+// True if a compiled object for the given module identifier is already
+// present in the on-disk cache (always false when the cache is disabled or
+// the identifier carries no fingerprint).
+TORCH_API bool kernelObjectCacheContains(const std::string& moduleId);
+
 } // namespace tensorexpr
 } // namespace jit
 } // namespace torch
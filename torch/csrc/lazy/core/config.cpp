@@ -22,6 +22,11 @@ C10_DEFINE_bool(
     false,
     "Reuse IR nodes from previous tracing when possible");
 
+C10_DEFINE_bool(
+    torch_lazy_ir_hash_cons,
+    false,
+    "Intern IR nodes by hash so identical subtrees are shared within a tracing step");
+
 C10_DEFINE_bool(
     torch_lazy_use_thread_pool,
     false,
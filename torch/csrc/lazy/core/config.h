@@ -7,6 +7,7 @@ C10_DECLARE_bool(torch_lazy_handle_special_scalars);
 C10_DECLARE_bool(torch_lazy_all_numbers_special_scalars);
 C10_DECLARE_bool(torch_lazy_param_aliasing);
 C10_DECLARE_bool(torch_lazy_reuse_ir);
+C10_DECLARE_bool(torch_lazy_ir_hash_cons);
 C10_DECLARE_bool(torch_lazy_use_thread_pool);
 C10_DECLARE_bool(torch_lazy_enable_device_data_cache);
 
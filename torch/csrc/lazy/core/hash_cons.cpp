@@ -0,0 +1,36 @@
+#include <torch/csrc/lazy/core/hash_cons.h>
+
+#include <torch/csrc/lazy/core/metrics.h>
+
+namespace torch {
+namespace lazy {
+
+HashConsCache* HashConsCache::Get() {
+  static thread_local HashConsCache* cache = new HashConsCache();
+  return cache;
+}
+
+NodePtr HashConsCache::GetOrIntern(NodePtr node) {
+  if (!node->canBeHashConsed()) {
+    return node;
+  }
+  auto emplaced = interned_.emplace(node->hash(), node);
+  if (!emplaced.second) {
+    const NodePtr& existing = emplaced.first->second;
+    // The hash already covers op, operands, attributes and shapes; the op
+    // comparison only guards against cross-kind hash collisions.
+    if (existing->op() == node->op() &&
+        existing->num_outputs() == node->num_outputs()) {
+      TORCH_LAZY_COUNTER("IrNodeHashConsed", 1);
+      return existing;
+    }
+  }
+  return node;
+}
+
+void HashConsCache::Clear() {
+  interned_.clear();
+}
+
+} // namespace lazy
+} // namespace torch
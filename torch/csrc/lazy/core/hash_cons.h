@@ -0,0 +1,38 @@
+#pragma once
+
+#include <unordered_map>
+
+#include <torch/csrc/lazy/core/hash.h>
+#include <torch/csrc/lazy/core/ir.h>
+
+namespace torch {
+namespace lazy {
+
+// A per-step hash-consing table: nodes are interned by their dag hash, so
+// identical subtrees (same op, operands and attributes, which all feed the
+// hash) are built once per step and shared. Unlike the TrieCache, which
+// replays nodes from the previous step by trace position, hash-consing
+// deduplicates within the current step no matter where a subtree appears
+// in the trace.
+//
+// The table is cleared in MarkStep, so interned nodes are released at the
+// end of each step and the table never outgrows a single trace.
+class TORCH_API HashConsCache {
+ public:
+  static HashConsCache* Get();
+
+  // Returns the previously interned node with the same hash, if any,
+  // otherwise interns and returns the given node.
+  NodePtr GetOrIntern(NodePtr node);
+
+  // Used in MarkStep to indicate the end of one tracing
+  void Clear();
+
+ private:
+  HashConsCache() = default;
+
+  std::unordered_map<hash_t, NodePtr, HashReducer> interned_;
+};
+
+} // namespace lazy
+} // namespace torch
@@ -143,6 +143,13 @@ class TORCH_API Node {
   // Returns the hash of the dag used to for shape caching
   virtual hash_t shapeHash() const = 0;
 
+  // Whether this node may be shared by hash-consing (see HashConsCache).
+  // Nodes carrying state that does not feed the node hash (e.g. DeviceData's
+  // backing buffer) must opt out, since interning is keyed on hash() alone.
+  virtual bool canBeHashConsed() const {
+    return true;
+  }
+
   const MetaData& metadata() const {
     return metadata_;
   }
@@ -4,6 +4,7 @@
 #include <c10/util/Optional.h>
 #include <torch/csrc/lazy/backend/backend_interface.h>
 #include <torch/csrc/lazy/core/config.h>
+#include <torch/csrc/lazy/core/hash_cons.h>
 #include <torch/csrc/lazy/core/ir.h>
 #include <torch/csrc/lazy/core/tensor.h>
 #include <torch/csrc/lazy/core/trie.h>
@@ -33,6 +34,10 @@ static inline void CacheNode(NodePtr node) {
 
 template <typename T, typename... Args>
 NodePtr MakeNode(Args&&... args) {
+  if (FLAGS_torch_lazy_ir_hash_cons) {
+    return HashConsCache::Get()->GetOrIntern(
+        std::make_shared<T>(std::forward<Args>(args)...));
+  }
   return std::make_shared<T>(std::forward<Args>(args)...);
 }
 
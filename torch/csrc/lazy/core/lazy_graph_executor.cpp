@@ -12,6 +12,7 @@
 #include <torch/csrc/lazy/core/unique.h>
 
 #include <torch/csrc/lazy/core/debug_util.h>
+#include <torch/csrc/lazy/core/hash_cons.h>
 #include <torch/csrc/lazy/core/ir_builder.h>
 #include <torch/csrc/lazy/core/metrics.h>
 #include <torch/csrc/lazy/core/ops/arithmetic_ir_ops.h>
@@ -430,6 +431,8 @@ void LazyGraphExecutor::MarkStep(const BackendDevice& device) {
   ResetTrimCounter();
   // Move TrieCache's current pointer back to its root
   TrieCache::Get()->ResetCurrent();
+  // Release the nodes interned during the step that just ended
+  HashConsCache::Get()->Clear();
 }
 
 void LazyGraphExecutor::WaitDeviceOps(c10::ArrayRef<BackendDevice> devices) {
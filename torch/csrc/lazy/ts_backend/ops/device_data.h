@@ -22,6 +22,12 @@ class TORCH_API DeviceData : public TsNode {
     return data_->shape() == data->shape();
   }
 
+  // The hash covers only the shape while data_ points at a specific
+  // buffer, so hash-equal DeviceData nodes are not interchangeable.
+  bool canBeHashConsed() const override {
+    return false;
+  }
+
   std::string ToString() const override;
 
   const std::shared_ptr<BackendData>& data() const {
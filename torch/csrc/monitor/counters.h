@@ -1,8 +1,13 @@
 #pragma once
 
+#include <algorithm>
+#include <array>
+#include <atomic>
 #include <bitset>
 #include <mutex>
 #include <sstream>
+#include <stdexcept>
+#include <thread>
 #include <unordered_map>
 #include <vector>
 
@@ -275,5 +280,181 @@ class Stat {
   const std::chrono::milliseconds windowSize_;
   const int64_t maxSamples_;
 };
+
+// HistogramStat aggregates values into a fixed number of equal width buckets
+// spanning [lower, upper) and logs interpolated percentiles (p50, p90, p99)
+// plus the sample count once every `windowSize`, using the same windowing and
+// event format as Stat so the data flows through the registered event
+// handlers unchanged.
+//
+// Unlike Stat, `add` takes no lock: samples land in one of a fixed set of
+// per-thread bucket shards with relaxed atomic increments, and the shards are
+// only merged, under a mutex, by whichever `add` first observes that the
+// window elapsed. This keeps high rate instrumentation (e.g. per request
+// latency) from contending on a single stat mutex.
+//
+// Values below `lower` count towards the first bucket and values at or above
+// `upper` towards the last, so the extreme percentiles are clamped to the
+// configured range. A sample racing with a window flush may be attributed to
+// the neighboring window, which is harmless at the intended window sizes.
+template <typename T>
+class HistogramStat {
+  // Threads hash onto the shards, so this only needs to cover a typical
+  // number of concurrently adding threads.
+  static constexpr size_t kShards = 16;
+
+ public:
+  HistogramStat(
+      std::string name,
+      T lower,
+      T upper,
+      size_t bucketCount,
+      std::chrono::milliseconds windowSize)
+      : name_(std::move(name)),
+        lower_(lower),
+        upper_(upper),
+        bucketCount_(bucketCount),
+        windowSize_(windowSize) {
+    if (upper <= lower || bucketCount == 0) {
+      throw std::runtime_error(
+          "HistogramStat requires lower < upper and at least one bucket");
+    }
+    for (auto& shard : shards_) {
+      shard.buckets = std::vector<std::atomic<int64_t>>(bucketCount);
+    }
+  }
+
+  virtual ~HistogramStat() {
+    // on destruction log if there's unlogged data
+    std::lock_guard<std::mutex> guard(mu_);
+    logLocked();
+  }
+
+  // add adds the value v to the current window. Lock free unless the window
+  // elapsed.
+  void add(T v) {
+    maybeLog();
+    auto& shard = shards_[shardIdx()];
+    shard.buckets[bucketFor(v)].fetch_add(1, std::memory_order_relaxed);
+  }
+
+  const std::string& name() const noexcept {
+    return name_;
+  }
+
+  // count returns the number of items in the current open window.
+  int64_t count() const noexcept {
+    int64_t total = 0;
+    for (auto& shard : shards_) {
+      for (auto& bucket : shard.buckets) {
+        total += bucket.load(std::memory_order_relaxed);
+      }
+    }
+    return total;
+  }
+
+ protected:
+  virtual uint64_t currentWindowId() const {
+    std::chrono::milliseconds now =
+        std::chrono::duration_cast<std::chrono::milliseconds>(
+            std::chrono::steady_clock::now().time_since_epoch());
+
+    // always returns a currentWindowId of at least 1 to avoid 0 window issues
+    return (now / windowSize_) + 1;
+  }
+
+ private:
+  struct Shard {
+    std::vector<std::atomic<int64_t>> buckets;
+  };
+
+  size_t shardIdx() const {
+    return std::hash<std::thread::id>()(std::this_thread::get_id()) % kShards;
+  }
+
+  size_t bucketFor(T v) const {
+    if (v <= lower_) {
+      return 0;
+    }
+    if (v >= upper_) {
+      return bucketCount_ - 1;
+    }
+    auto idx = static_cast<size_t>(
+        static_cast<double>(v - lower_) / static_cast<double>(upper_ - lower_) *
+        static_cast<double>(bucketCount_));
+    return std::min(idx, bucketCount_ - 1);
+  }
+
+  T bucketUpperEdge(size_t idx) const {
+    return lower_ +
+        static_cast<T>(
+               static_cast<double>(upper_ - lower_) *
+               static_cast<double>(idx + 1) /
+               static_cast<double>(bucketCount_));
+  }
+
+  void maybeLog() {
+    auto windowId = currentWindowId();
+    if (C10_LIKELY(windowId == windowId_.load(std::memory_order_relaxed))) {
+      return;
+    }
+    std::lock_guard<std::mutex> guard(mu_);
+    if (windowId == windowId_.load(std::memory_order_relaxed)) {
+      // another thread flushed the window first
+      return;
+    }
+    logLocked();
+    windowId_.store(windowId, std::memory_order_relaxed);
+  }
+
+  void logLocked() {
+    // Merge the shards, resetting them for the next window.
+    std::vector<int64_t> merged(bucketCount_, 0);
+    int64_t total = 0;
+    for (auto& shard : shards_) {
+      for (size_t i = 0; i < bucketCount_; ++i) {
+        auto v = shard.buckets[i].exchange(0, std::memory_order_relaxed);
+        merged[i] += v;
+        total += v;
+      }
+    }
+
+    // don't log event if there's no data
+    if (total == 0) {
+      return;
+    }
+
+    Event e;
+    e.name = "torch.monitor.Stat";
+    e.timestamp = std::chrono::system_clock::now();
+    e.data[name_ + ".count"] = total;
+    for (auto percentile : {50, 90, 99}) {
+      const int64_t threshold = (total * percentile + 99) / 100;
+      int64_t cumulative = 0;
+      for (size_t i = 0; i < bucketCount_; ++i) {
+        cumulative += merged[i];
+        if (cumulative >= threshold) {
+          e.data[name_ + ".p" + std::to_string(percentile)] =
+              bucketUpperEdge(i);
+          break;
+        }
+      }
+    }
+
+    logEvent(e);
+  }
+
+  const std::string name_;
+  const T lower_;
+  const T upper_;
+  const size_t bucketCount_;
+  const std::chrono::milliseconds windowSize_;
+
+  std::array<Shard, kShards> shards_;
+
+  // Guards window flushes; the add fast path never takes it.
+  std::mutex mu_;
+  std::atomic<uint64_t> windowId_{0};
+};
 } // namespace monitor
 } // namespace torch
@@ -1,4 +1,5 @@
 #include <torch/csrc/profiler/collection.h>
+#include <torch/csrc/profiler/interning.h>
 #include <torch/csrc/profiler/orchestration/vulkan.h>
 
 #include <algorithm>
@@ -305,6 +306,15 @@ uint64_t ThreadLocalSubqueue::TorchOpStorage::EventBlock<T, ChunkSize>::
 // ---------------------------------
 std::unique_ptr<KinetoObserverContext> ThreadLocalSubqueue::begin_op(
     const at::RecordFunction& fn) {
+  if (C10_UNLIKELY(config_.experimental_config.op_sampling_rate > 1)) {
+    // In sampling mode only every Nth op is recorded. Skipped ops get no
+    // observer context; the exit callback sees a nullptr and bails out, so
+    // they pay neither the event storage nor the correlation id push/pop.
+    if (op_sample_counter_++ % config_.experimental_config.op_sampling_rate !=
+        0) {
+      return nullptr;
+    }
+  }
   auto [event, corr_id] = torch_ops_.op_events_.emplace_back(
       torch::profiler::impl::TorchOpBasicFields{
           fn.seqNr(),
@@ -312,7 +322,8 @@ std::unique_ptr<KinetoObserverContext> ThreadLocalSubqueue::begin_op(
           fn.scope(),
           fn.isAsync(),
           fn.debugHandle(),
-          fn.name()});
+          /*name_=*/std::string(),
+          StringInterner::singleton().intern(fn.name())});
   if (config_.report_input_shapes) {
     torch_ops_.inputs_outputs_.push(fn.inputs());
   }
@@ -403,6 +414,14 @@ void ThreadLocalSubqueue::TorchOpStorage::materialize(
     const std::function<c10::time_t(c10::approx_time_t)>& time_converter,
     const uint64_t tid,
     const kineto::DeviceAndResource& kineto_info) {
+  // Events only carry 32-bit refs into the string table while collection is
+  // running; resolve them to strings before any name-based fixups below.
+  auto& interner = StringInterner::singleton();
+  for (auto& event : op_events_) {
+    event.basic_fields_.name_ =
+        interner.lookupString(event.basic_fields_.interned_name_);
+  }
+
   // Plumb Autograd info to the top level annotation.
   auto it = op_events_.begin();
   for (C10_UNUSED const auto _ :
@@ -109,6 +109,11 @@ struct TorchOpBasicFields {
   int64_t debug_handle_{0};
   std::string name_;
 
+  // While collection is running, events hold only a 32-bit ref into the
+  // profiler string table; `name_` is materialized from it during
+  // finalization. See torch/csrc/profiler/interning.h.
+  uint32_t interned_name_{0};
+
   // Set in the exit callback.
   uint64_t end_tid_{0};
 };
@@ -547,6 +552,11 @@ class TORCH_API ThreadLocalSubqueue {
   kineto::DeviceAndResource kineto_info_;
   std::unique_ptr<perf_profiler_t> perf_profiler_;
 
+  // Ops seen by `begin_op` on this thread, used to select every Nth op when
+  // `experimental_config.op_sampling_rate` is set. Subqueues are thread
+  // local, so no synchronization is needed.
+  int64_t op_sample_counter_{0};
+
   friend class RecordQueue;
   // See `containers.h` for block size benchmarks.
   static constexpr size_t BlockSize = 512;
@@ -12,7 +12,7 @@ namespace profiler {
 using perf_counters_t = std::vector<uint64_t>;
 
 /* Standard list of performance events independent of hardware or backend */
-constexpr std::array<const char*, 2> ProfilerPerfEvents = {
+constexpr std::array<const char*, 5> ProfilerPerfEvents = {
     /*
      * Number of Processing Elelement (PE) cycles between two points of interest
      * in time. This should correlate positively with wall-time. Measured in
@@ -26,6 +26,24 @@ constexpr std::array<const char*, 2> ProfilerPerfEvents = {
      * (i.e. work). Across repeat executions, the number of instructions should
      * be more or less invariant. Measured in uint64_t. PE can be non cpu.
      */
-    "instructions"};
+    "instructions",
+
+    /* Number of misses in the last level of the PE data cache hierarchy
+     * between two points of interest in time. A high miss count relative to
+     * `instructions` points at memory bound sections. Measured in uint64_t.
+     */
+    "cache-misses",
+
+    /* Number of mispredicted branch instructions between two points of
+     * interest in time. Measured in uint64_t.
+     */
+    "branch-misses",
+
+    /* Number of cycles the PE backend was stalled (e.g. waiting on memory)
+     * between two points of interest in time. Together with `cache-misses`
+     * this attributes memory induced slowdowns to a section. Measured in
+     * uint64_t. Not exposed by every PMU.
+     */
+    "backend-stall-cycles"};
 } // namespace profiler
 } // namespace torch
@@ -0,0 +1,49 @@
+#include <torch/csrc/profiler/interning.h>
+
+#include <c10/util/Exception.h>
+
+#include <limits>
+
+namespace torch {
+namespace profiler {
+namespace impl {
+
+StringInterner& StringInterner::singleton() {
+  static auto& interner = *new StringInterner(); // Leak (avoid static dtor)
+  return interner;
+}
+
+uint32_t StringInterner::intern(const std::string& s) {
+  std::lock_guard<std::mutex> guard(mutex_);
+  auto it = ids_.find(s);
+  if (it != ids_.end()) {
+    return it->second;
+  }
+  const auto id = static_cast<uint32_t>(strings_.size());
+  TORCH_INTERNAL_ASSERT(
+      strings_.size() < std::numeric_limits<uint32_t>::max(),
+      "StringInterner overflow");
+  strings_.emplace_back(s);
+  ids_.emplace(s, id);
+  return id;
+}
+
+uint32_t StringInterner::intern(const char* s) {
+  return intern(std::string(s ? s : ""));
+}
+
+const std::string& StringInterner::lookupString(uint32_t id) const {
+  std::lock_guard<std::mutex> guard(mutex_);
+  TORCH_INTERNAL_ASSERT(
+      id < strings_.size(), "Invalid interned string id: ", id);
+  return strings_[id];
+}
+
+size_t StringInterner::size() const {
+  std::lock_guard<std::mutex> guard(mutex_);
+  return strings_.size();
+}
+
+} // namespace impl
+} // namespace profiler
+} // namespace torch
@@ -0,0 +1,39 @@
+#pragma once
+
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+#include <c10/macros/Macros.h>
+
+namespace torch {
+namespace profiler {
+namespace impl {
+
+// Deduplicating, append-only string table. Long collections record the same
+// op names over and over; storing a 32-bit ref per event instead of a heap
+// string keeps the steady-state footprint proportional to the number of
+// distinct names rather than the number of events. Ids are never recycled,
+// and the backing deque never relocates entries, so a reference returned by
+// lookupString stays valid for the lifetime of the process.
+class TORCH_API StringInterner {
+ public:
+  static StringInterner& singleton();
+
+  uint32_t intern(const char* s);
+  uint32_t intern(const std::string& s);
+
+  const std::string& lookupString(uint32_t id) const;
+  size_t size() const;
+
+ private:
+  mutable std::mutex mutex_;
+  std::unordered_map<std::string, uint32_t> ids_;
+  std::deque<std::string> strings_;
+};
+
+} // namespace impl
+} // namespace profiler
+} // namespace torch
@@ -160,7 +160,8 @@ class ExperimentalConfigWrapper {
       : config_(config) {}
 
   bool assertValid() {
-    return !config_.profiler_metrics.empty();
+    return !config_.profiler_metrics.empty() ||
+        config_.profile_gpu_kernel_metrics;
   }
 
   void prepareTraceWithExperimentalOptions(bool add_cpu_activity) {
@@ -168,12 +169,25 @@ class ExperimentalConfigWrapper {
     std::set<libkineto::ActivityType> k_activities{
         libkineto::ActivityType::CUDA_PROFILER_RANGE};
 
+    // profile_gpu_kernel_metrics is a per-kernel preset of occupancy and
+    // DRAM throughput metrics for triaging launch-bound vs bandwidth-bound
+    // kernels; explicitly listed metrics take precedence.
+    std::vector<std::string> metrics = config_.profiler_metrics;
+    bool measure_per_kernel = config_.profiler_measure_per_kernel;
+    if (metrics.empty() && config_.profile_gpu_kernel_metrics) {
+      metrics = {
+          "sm__warps_active.avg.pct_of_peak_sustained_active",
+          "dram__bytes_read.sum.per_second",
+          "dram__bytes_write.sum.per_second"};
+      measure_per_kernel = true;
+    }
+
     // Only add CPU activities if we are measuring per kernel ranges
-    if (add_cpu_activity && config_.profiler_measure_per_kernel) {
+    if (add_cpu_activity && measure_per_kernel) {
       k_activities.insert(kCpuTypes.begin(), kCpuTypes.end());
     }
 
-    const size_t num_metrics = config_.profiler_metrics.size();
+    const size_t num_metrics = metrics.size();
     std::stringstream configss;
 
     LOG(INFO) << "CUPTI profiler metrics size = " << num_metrics;
@@ -182,14 +196,13 @@ class ExperimentalConfigWrapper {
              << "CUPTI_PROFILER_METRICS=";
 
     for (size_t i = 0; i < num_metrics; i++) {
-      configss << config_.profiler_metrics[i];
+      configss << metrics[i];
       if (num_metrics > 1 && i < (num_metrics - 1)) {
         configss << ",";
       }
     }
     configss << "\nCUPTI_PROFILER_ENABLE_PER_KERNEL="
-             << (config_.profiler_measure_per_kernel ? "true" : "false")
-             << "\n";
+             << (measure_per_kernel ? "true" : "false") << "\n";
     LOG(INFO) << "Generated config = " << configss.str();
 
     libkineto::api().activityProfiler().prepareTrace(
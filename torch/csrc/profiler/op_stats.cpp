@@ -0,0 +1,133 @@
+#include <torch/csrc/profiler/op_stats.h>
+
+#include <algorithm>
+#include <fstream>
+#include <utility>
+
+#include <c10/util/Exception.h>
+#include <c10/util/overloaded.h>
+#include <torch/csrc/profiler/collection.h>
+
+namespace torch {
+namespace profiler {
+namespace impl {
+namespace {
+
+int64_t wallDuration(const Result& event) {
+  return event.endTimeNS() - event.start_time_ns_;
+}
+
+template <typename T>
+void writeScalar(std::ostream& out, T value) {
+  out.write(reinterpret_cast<const char*>(&value), sizeof(value));
+}
+
+} // namespace
+
+OpStatsAggregator& OpStatsAggregator::get() {
+  static auto* singleton = new OpStatsAggregator();
+  return *singleton;
+}
+
+void OpStatsAggregator::enable(
+    std::string export_path,
+    uint64_t export_every_n_traces) {
+  std::lock_guard<std::mutex> guard(mutex_);
+  TORCH_CHECK(
+      export_every_n_traces == 0 || !export_path.empty(),
+      "OpStatsAggregator: periodic export requested without an export path.");
+  export_path_ = std::move(export_path);
+  export_every_n_ = export_every_n_traces;
+  traces_since_export_ = 0;
+  enabled_ = true;
+}
+
+void OpStatsAggregator::disable() {
+  std::lock_guard<std::mutex> guard(mutex_);
+  enabled_ = false;
+}
+
+bool OpStatsAggregator::enabled() const {
+  std::lock_guard<std::mutex> guard(mutex_);
+  return enabled_;
+}
+
+void OpStatsAggregator::consume(
+    const std::vector<std::shared_ptr<Result>>& events) {
+  std::lock_guard<std::mutex> guard(mutex_);
+  if (!enabled_) {
+    return;
+  }
+  for (const auto& event : events) {
+    if (event->tag() != EventType::TorchOp) {
+      continue;
+    }
+    auto& entry = stats_[event->name()];
+    const auto total = wallDuration(*event);
+    ++entry.count;
+    entry.total_time_ns += total;
+
+    // Self time discounts nested op calls; allocations are attributed to the
+    // op which directly triggered them.
+    int64_t child_time = 0;
+    for (const auto& child : event->children_) {
+      if (child->tag() == EventType::TorchOp) {
+        child_time += wallDuration(*child);
+      } else {
+        child->visit(c10::overloaded(
+            [&](const ExtraFields<EventType::Allocation>& alloc) {
+              if (alloc.alloc_size_ > 0) {
+                entry.alloc_bytes += alloc.alloc_size_;
+              }
+            },
+            [](const auto&) {}));
+      }
+    }
+    entry.self_time_ns += std::max<int64_t>(0, total - child_time);
+  }
+  if (export_every_n_ != 0 && ++traces_since_export_ >= export_every_n_) {
+    traces_since_export_ = 0;
+    exportLocked(export_path_);
+  }
+}
+
+void OpStatsAggregator::exportTo(const std::string& path) const {
+  std::lock_guard<std::mutex> guard(mutex_);
+  exportLocked(path);
+}
+
+// Compact binary layout (host endian): "PTOP" magic, uint32 format version,
+// uint64 entry count, then per entry a uint32 name length, the raw name
+// bytes, and the four counters (uint64 count, int64 total/self time in ns,
+// int64 allocated bytes).
+void OpStatsAggregator::exportLocked(const std::string& path) const {
+  std::ofstream out(path, std::ios::binary | std::ios::trunc);
+  TORCH_CHECK(
+      out, "OpStatsAggregator: could not open ", path, " for writing.");
+  out.write("PTOP", 4);
+  writeScalar<uint32_t>(out, 1);
+  writeScalar<uint64_t>(out, stats_.size());
+  for (const auto& it : stats_) {
+    writeScalar<uint32_t>(out, static_cast<uint32_t>(it.first.size()));
+    out.write(it.first.data(), static_cast<std::streamsize>(it.first.size()));
+    writeScalar<uint64_t>(out, it.second.count);
+    writeScalar<int64_t>(out, it.second.total_time_ns);
+    writeScalar<int64_t>(out, it.second.self_time_ns);
+    writeScalar<int64_t>(out, it.second.alloc_bytes);
+  }
+}
+
+std::unordered_map<std::string, OpStats> OpStatsAggregator::snapshot() const {
+  std::lock_guard<std::mutex> guard(mutex_);
+  return stats_;
+}
+
+void OpStatsAggregator::clear() {
+  std::lock_guard<std::mutex> guard(mutex_);
+  stats_.clear();
+  traces_since_export_ = 0;
+}
+
+} // namespace impl
+} // namespace profiler
+} // namespace torch
@@ -0,0 +1,65 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <c10/macros/Export.h>
+
+namespace torch {
+namespace profiler {
+namespace impl {
+
+struct Result;
+
+// Rolling aggregation of the profiler's finalized `Result` tree into per-op
+// counters. Raw Kineto traces grow with runtime and become too large to ship
+// off production hosts, so instead of exporting events we fold every trace
+// into a fixed-size table keyed by op name (flamegraph style: total and self
+// time plus allocation volume) and optionally rewrite a compact binary export
+// every few traces for offline collection.
+
+struct OpStats {
+  uint64_t count{0};
+  int64_t total_time_ns{0};
+  int64_t self_time_ns{0};
+  int64_t alloc_bytes{0};
+};
+
+class TORCH_API OpStatsAggregator {
+ public:
+  static OpStatsAggregator& get();
+
+  // Start folding finalized traces into the rolling counters. If
+  // `export_every_n_traces` is nonzero, the aggregate is rewritten to
+  // `export_path` each time that many traces have been consumed.
+  void enable(std::string export_path, uint64_t export_every_n_traces);
+  void disable();
+  bool enabled() const;
+
+  // Called by the profiler with the flat list of finalized events.
+  void consume(const std::vector<std::shared_ptr<Result>>& events);
+
+  void exportTo(const std::string& path) const;
+  std::unordered_map<std::string, OpStats> snapshot() const;
+  void clear();
+
+ private:
+  OpStatsAggregator() = default;
+
+  void exportLocked(const std::string& path) const;
+
+  mutable std::mutex mutex_;
+  bool enabled_{false};
+  std::string export_path_;
+  uint64_t export_every_n_{0};
+  uint64_t traces_since_export_{0};
+  std::unordered_map<std::string, OpStats> stats_;
+};
+
+} // namespace impl
+} // namespace profiler
+} // namespace torch
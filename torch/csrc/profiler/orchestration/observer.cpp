@@ -19,16 +19,23 @@ ExperimentalConfig::ExperimentalConfig(
     bool verbose,
     std::vector<std::string> performance_events,
     bool enable_cuda_sync_events,
+    int64_t op_sampling_rate,
+    bool profile_gpu_kernel_metrics,
     bool adjust_timestamps)
     : profiler_metrics{std::move(profiler_metrics)},
       profiler_measure_per_kernel{profiler_measure_per_kernel},
       verbose{verbose},
       performance_events(std::move(performance_events)),
       enable_cuda_sync_events{enable_cuda_sync_events},
-      adjust_timestamps{adjust_timestamps} {}
+      op_sampling_rate{op_sampling_rate},
+      profile_gpu_kernel_metrics{profile_gpu_kernel_metrics},
+      adjust_timestamps{adjust_timestamps} {
+  TORCH_CHECK(
+      op_sampling_rate >= 1, "op_sampling_rate must be a positive integer");
+}
 
 /*explicit*/ ExperimentalConfig::operator bool() const {
-  return !profiler_metrics.empty();
+  return !profiler_metrics.empty() || profile_gpu_kernel_metrics;
 }
 
 ProfilerConfig::ProfilerConfig(
@@ -48,6 +48,8 @@ struct TORCH_API ExperimentalConfig {
       bool verbose = false,
       std::vector<std::string> performance_events = {},
       bool enable_cuda_sync_events = false,
+      int64_t op_sampling_rate = 1,
+      bool profile_gpu_kernel_metrics = false,
       bool adjust_timestamps = false);
   explicit operator bool() const;
 
@@ -65,6 +67,24 @@ struct TORCH_API ExperimentalConfig {
    * This feature is new and currently disabled by default.
    */
   bool enable_cuda_sync_events;
+  /*
+   * Record only every Nth torch op; 1 (the default) records every op.
+   * Sampling trades trace completeness for lower overhead, which makes
+   * long-running or always-on profiling affordable. Skipped ops leave no
+   * trace at all, so event trees built from a sampled run will be sparse.
+   */
+  int64_t op_sampling_rate;
+  /*
+   * Collect a per-kernel occupancy/bandwidth preset through the CUPTI
+   * profiler: achieved occupancy plus DRAM read/write throughput, attached
+   * to each kernel's profiler range in the trace. Shorthand for passing the
+   * corresponding nvperf metric names in profiler_metrics together with
+   * profiler_measure_per_kernel; explicitly listed profiler_metrics take
+   * precedence over the preset. CUPTI replays kernels to gather metrics, so
+   * this mode is meant for short, scheduled profiling windows rather than
+   * whole runs.
+   */
+  bool profile_gpu_kernel_metrics;
   /*
    * Controls whether or not timestamp adjustment occurs after profiling.
    * The purpose of this is to adjust Vulkan event timelines to align with those
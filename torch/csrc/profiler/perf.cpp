@@ -39,9 +39,14 @@ static const std::unordered_map<
         {"instructions",
          std::make_pair(PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS)},
 
-        // Non Standard events for testing
-        {"pagefaults",
-         std::make_pair(PERF_TYPE_SOFTWARE, PERF_COUNT_SW_PAGE_FAULTS)},
+        // Memory hierarchy and speculation events, for attributing stalls
+        // to specific ops
+        {"cache-references",
+         std::make_pair(PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_REFERENCES)},
+        {"cache-misses",
+         std::make_pair(PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES)},
+        {"branch-misses",
+         std::make_pair(PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES)},
         {"backend-stall-cycles",
          std::make_pair(
              PERF_TYPE_HARDWARE,
@@ -49,7 +54,11 @@ static const std::unordered_map<
         {"frontend-stall-cycles",
          std::make_pair(
              PERF_TYPE_HARDWARE,
-             PERF_COUNT_HW_STALLED_CYCLES_FRONTEND)}};
+             PERF_COUNT_HW_STALLED_CYCLES_FRONTEND)},
+
+        // Non Standard events for testing
+        {"pagefaults",
+         std::make_pair(PERF_TYPE_SOFTWARE, PERF_COUNT_SW_PAGE_FAULTS)}};
 
 PerfEvent::~PerfEvent() {
   if (fd_ > -1) {
@@ -105,16 +114,19 @@ uint64_t PerfEvent::ReadCounter() const {
       name_,
       ", error: ",
       std::strerror(errno));
-  TORCH_CHECK(
-      counter.time_enabled == counter.time_running,
-      "Hardware performance counter time multiplexing is not handled yet",
-      ", name: ",
-      name_,
-      ", enabled: ",
-      counter.time_enabled,
-      ", running: ",
+  if (counter.time_enabled == counter.time_running) {
+    return counter.value;
+  }
+  if (counter.time_running == 0) {
+    // The event was never scheduled onto the PMU, nothing was counted.
+    return 0;
+  }
+  // The kernel time multiplexed this event with others competing for the
+  // PMU, so only a fraction of the interval was measured. Scale the count
+  // by the enabled / running ratio for an estimated total, as perf(1) does.
+  return static_cast<uint64_t>(
+      static_cast<double>(counter.value) * counter.time_enabled /
       counter.time_running);
-  return counter.value;
 }
 
 #else /* __ANDROID__ || __linux__ */
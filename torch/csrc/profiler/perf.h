@@ -20,12 +20,11 @@ namespace linux_perf {
 
 /*
  * Maximum number of events supported
- * This stems from the hardware limitation on CPU performance counters, and the
- * fact that we don't support time multiplexing just yet.
- * Time multiplexing involves scaling the counter values proportional to
- * the enabled and running time or running the workload multiple times.
+ * This is a sanity bound rather than a hardware limit: when more events are
+ * requested than the PMU has counters, the kernel time multiplexes them and
+ * the reported values are scaled estimates (see PerfEvent::ReadCounter).
  */
-constexpr uint8_t MAX_EVENTS = 4;
+constexpr uint8_t MAX_EVENTS = 8;
 
 struct PerfCounter {
   uint64_t value; /* The value of the event */
@@ -6,6 +6,7 @@
 #include <torch/csrc/autograd/utils/wrap_outputs.h>
 #include <torch/csrc/jit/python/pybind_utils.h>
 #include <torch/csrc/profiler/collection.h>
+#include <torch/csrc/profiler/op_stats.h>
 #include <torch/csrc/profiler/python/combined_traceback.h>
 #include <torch/csrc/profiler/standalone/execution_trace_observer.h>
 #include <torch/csrc/utils/pybind.h>
@@ -269,7 +270,9 @@ void initPythonBindings(PyObject* module) {
               bool /* profiler_measure_per_kernel */,
               bool /* verbose */,
               std::vector<std::string> /* performance_events  */,
-              bool /* enable_cuda_sync_events */
+              bool /* enable_cuda_sync_events */,
+              int64_t /* op_sampling_rate */,
+              bool /* profile_gpu_kernel_metrics */
               >(),
           "An experimental config for Kineto features. Please note that"
           "backward compatibility is not guaranteed.\n"
@@ -282,12 +285,22 @@ void initPythonBindings(PyObject* module) {
           "    performance_events : a list of profiler events to be used for measurement.\n"
           "    enable_cuda_sync_events : for CUDA profiling mode, enable adding CUDA synchronization events\n"
           "       that expose CUDA device, stream and event synchronization activities. This feature is new\n"
-          "       and currently disabled by default.\n",
+          "       and currently disabled by default.\n"
+          "    op_sampling_rate (int) : record only every Nth torch op. The default of 1 records\n"
+          "       every op; larger values trade trace completeness for lower overhead, which is\n"
+          "       intended for long-running or always-on profiling.\n"
+          "    profile_gpu_kernel_metrics (bool) : collect achieved occupancy and DRAM read/write\n"
+          "       throughput per kernel through the CUPTI profiler, for triaging launch-bound vs\n"
+          "       bandwidth-bound kernels. Shorthand for the corresponding profiler_metrics with\n"
+          "       profiler_measure_per_kernel; kernels are replayed to gather metrics, so use\n"
+          "       short, scheduled profiling windows.\n",
           py::arg("profiler_metrics") = std::vector<std::string>(),
           py::arg("profiler_measure_per_kernel") = false,
           py::arg("verbose") = false,
           py::arg("performance_events") = std::vector<std::string>(),
-          py::arg("enable_cuda_sync_events") = false)
+          py::arg("enable_cuda_sync_events") = false,
+          py::arg("op_sampling_rate") = 1,
+          py::arg("profile_gpu_kernel_metrics") = false)
       .def(py::pickle(
           [](const ExperimentalConfig& p) { // __getstate__
             py::list py_metrics;
@@ -514,6 +527,32 @@ void initPythonBindings(PyObject* module) {
   m.def(
       "_disable_execution_trace_observer",
       &torch::profiler::impl::disableExecutionTraceObserver);
+  // Rolling per-op statistics aggregated across profiler sessions.
+  m.def(
+      "_enable_op_stats_aggregation",
+      [](const std::string& export_path, uint64_t export_every_n_traces) {
+        OpStatsAggregator::get().enable(export_path, export_every_n_traces);
+      },
+      py::arg("export_path") = "",
+      py::arg("export_every_n_traces") = 0);
+  m.def("_disable_op_stats_aggregation", []() {
+    OpStatsAggregator::get().disable();
+  });
+  m.def("_export_op_stats", [](const std::string& path) {
+    OpStatsAggregator::get().exportTo(path);
+  });
+  m.def("_clear_op_stats", []() { OpStatsAggregator::get().clear(); });
+  m.def("_get_op_stats", []() {
+    py::dict out;
+    for (const auto& it : OpStatsAggregator::get().snapshot()) {
+      out[py::str(it.first)] = py::make_tuple(
+          it.second.count,
+          it.second.total_time_ns,
+          it.second.self_time_ns,
+          it.second.alloc_bytes);
+    }
+    return out;
+  });
   m.def(
       "_set_record_concrete_inputs_enabled_val",
       &torch::profiler::impl::set_record_concrete_inputs_enabled_val);
@@ -570,6 +570,28 @@ def set_stream(stream: Stream):
     )
 
 
+@contextlib.contextmanager
+def _stream_scheduler(num_streams: int = 4):
+    r"""Experimental context manager that schedules eager CUDA ops onto a
+    small pool of streams so independent op chains overlap on the GPU.
+
+    Tensor dependencies are tracked per op: an op runs on the stream that
+    produced its inputs when possible, and an event wait is inserted only
+    when an input crosses streams. On exit the surrounding stream waits for
+    all scheduled work. Only ops launched from the calling thread are
+    scheduled, so this does not compose with backward passes.
+
+    Args:
+        num_streams (int): size of the stream pool to schedule onto.
+    """
+    _lazy_init()
+    torch._C._cuda_enableStreamScheduler(num_streams)
+    try:
+        yield
+    finally:
+        torch._C._cuda_disableStreamScheduler()
+
+
 def _parse_visible_devices() -> Union[List[int], List[str]]:
     r"""Parse CUDA_VISIBLE_DEVICES environment variable."""
     var = os.getenv("CUDA_VISIBLE_DEVICES")
@@ -1355,6 +1377,7 @@ __all__ = [
     "empty_cache",
     "get_allocator_backend",
     "CUDAPluggableAllocator",
+    "CUDAManagedAllocator",
     "change_current_allocator",
     "get_arch_list",
     "get_device_capability",
@@ -42,6 +42,7 @@ __all__ = [
     "mem_get_info",
     "get_allocator_backend",
     "CUDAPluggableAllocator",
+    "CUDAManagedAllocator",
     "change_current_allocator",
 ]
 
@@ -891,6 +892,77 @@ class CUDAPluggableAllocator(_CUDAAllocator):
         self._allocator = torch._C._cuda_customAllocator(alloc_fn, free_fn)
 
 
+class CUDAManagedAllocator(_CUDAAllocator):
+    r"""CUDA allocator backed by managed (unified) memory.
+
+    Allocations are made with ``cudaMallocManaged`` and advised to prefer
+    device residency while remaining CPU-accessible, so models slightly
+    larger than device memory page cold data to host instead of failing to
+    allocate. Use :func:`torch.cuda.memory._memory_prefetch_async` or
+    :func:`torch.cuda.memory._register_module_prefetch_hooks` to stream
+    data in ahead of use instead of relying on demand paging.
+
+    To change the active allocator use the
+    :func:`torch.cuda.memory.change_current_allocator` function.
+    """
+
+    def __init__(self):
+        self._allocator = torch._C._cuda_createManagedAllocator()
+
+
+def _memory_prefetch_async(tensor: torch.Tensor, device: Device = None) -> None:
+    r"""Asynchronously prefetch the managed memory backing ``tensor``.
+
+    Enqueues a ``cudaMemPrefetchAsync`` of the tensor's whole storage on the
+    target device's current stream. Only meaningful when the storage was
+    allocated by :class:`CUDAManagedAllocator`; demand paging makes it
+    correct (just not useful) otherwise.
+
+    Args:
+        tensor (torch.Tensor): tensor whose storage should be prefetched.
+        device (torch.device or int, optional): destination device. Defaults
+            to the tensor's device; pass ``"cpu"`` to evict to host memory.
+    """
+    if device is None:
+        device = tensor.device
+    device = torch.device(device)
+    device_index = -1 if device.type == "cpu" else _get_device_index(device)
+    storage = tensor.untyped_storage()
+    torch._C._cuda_memPrefetchAsync(
+        storage.data_ptr(), storage.nbytes(), device_index
+    )
+
+
+def _register_module_prefetch_hooks(module, device: Device = None):
+    r"""Register hooks prefetching each submodule's memory one layer ahead.
+
+    Walks the direct children of ``module`` in registration order, which is
+    the execution order for sequential-style modules: entering ``module``
+    prefetches the first child's parameters and buffers, and entering child
+    ``i`` prefetches child ``i + 1``, so cold layers of a model served with
+    :class:`CUDAManagedAllocator` stream in while the previous layer runs.
+
+    Returns the list of hook handles; call ``handle.remove()`` on each to
+    stop prefetching.
+    """
+    children = list(module.children())
+    handles = []
+
+    def prefetch(m):
+        for param in m.parameters():
+            _memory_prefetch_async(param, device)
+        for buf in m.buffers():
+            _memory_prefetch_async(buf, device)
+
+    for current, upcoming in zip([module] + children[:-1], children):
+        handles.append(
+            current.register_forward_pre_hook(
+                lambda mod, inputs, m=upcoming: prefetch(m)
+            )
+        )
+    return handles
+
+
 def change_current_allocator(allocator: _CUDAAllocator) -> None:
     r"""Change the currently used memory allocator to be the one provided.
 
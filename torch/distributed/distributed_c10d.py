@@ -1814,11 +1814,19 @@ def _coalescing_manager(
         # Collectives supporting "Fast Path" coalescing are captured.
         # See implementation in corresponding collective APIs.
         # Currently supported:
+        # - coalesced `broadcast`
         # - coalesced `all_reduce`
         # - coalesced `all_gather_into_tensor`
         # - coalesced `reduce_scatter_tensor`
         op0 = op_list[0].op
-        if op0 == all_reduce:
+        if op0 == broadcast:
+            tensors = []
+            for op in op_list:
+                tensors.append(op.tensor)
+            broadcast_opts = BroadcastOptions()
+            broadcast_opts.rootRank = not_none(op_list[0].root)
+            work = group.broadcast_coalesced(tensors, broadcast_opts)
+        elif op0 == all_reduce:
             tensors = []
             for op in op_list:
                 tensors.append(op.tensor)
@@ -1948,12 +1956,20 @@ def broadcast(tensor, src, group=None, async_op=False):
     opts.asyncOp = async_op
 
     if group is None or group is GroupMember.WORLD:
-        default_pg = _get_default_group()
-        work = default_pg.broadcast([tensor], opts)
+        group = _get_default_group()
     else:
-        group_src_rank = get_group_rank(group, src)
-        opts.rootRank = group_src_rank
-        work = group.broadcast([tensor], opts)
+        opts.rootRank = get_group_rank(group, src)
+
+    if group in _world.pg_coalesce_state.keys():
+        # We are in coalescing context, do not issue single operation, just append a collective representation
+        coll = _CollOp(broadcast, tensor, None, None, opts.rootRank)
+        _world.pg_coalesce_state[group].append(coll)
+        if async_op:
+            return _IllegalWork()
+        else:
+            return None
+
+    work = group.broadcast([tensor], opts)
     if async_op:
         return work
     else:
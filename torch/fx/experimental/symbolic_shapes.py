@@ -2319,6 +2319,24 @@ class ShapeEnv:
             source=source,
         )
 
+    @record_shapeenv_event()
+    def create_unspecified_symfloat(self, val, source):
+        # The float analog of create_unspecified_symint_and_symbol.
+        # create_symbol only mints integer symbols, so the symbol is built
+        # directly here, following create_unbacked_symfloat but with a hint
+        # so the value can be used where a backed float is required.
+        symbol: sympy.Symbol = sympy.Symbol(f"zf{next(self.unbacked_symfloat_counter)}")
+        self.counter["create_unspecified_symfloat"] += 1
+        self.var_to_val[symbol] = sympy.Float(val)
+        self.var_to_stack[symbol] = CapturedTraceback.extract(skip=1)
+        self.var_to_range[symbol] = ValueRanges.unknown()
+        self.var_to_sources[symbol] = [source]
+
+        # Create a new FX placeholder and Z3 variable for 'symbol'.
+        fx_node = self.create_fx_placeholder_and_z3var(symbol, float)
+
+        return SymFloat(SymNode(symbol, self, float, val, fx_node=fx_node))
+
     def create_symboolnode(self, sym: "sympy.Expr"):
         # This function is only being used in serialization, so we do not track it
         # for validation.
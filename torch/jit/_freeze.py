@@ -119,6 +119,10 @@ def freeze(
     preserved_methods = [x for x in preserved_attrs if mod._c._has_method(x)]
     run_frozen_optimizations(out, optimize_numerics, preserved_methods)
 
+    # Share content-identical tensor constants across the frozen methods, so
+    # modules with multiple entry points do not pay per-method weight copies.
+    torch._C._jit_pass_dedup_frozen_tensor_constants(out._c)
+
     return out
 
 
@@ -44,6 +44,8 @@ from .spawn import (
     start_processes,
 )
 
+from .shared_tensor import SharedTensorSlot
+
 
 if sys.platform == "darwin" or sys.platform == "win32":
     _sharing_strategy = "file_system"
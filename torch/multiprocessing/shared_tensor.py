@@ -0,0 +1,82 @@
+"""Versioned shared-memory tensor region with seqlock-protected updates."""
+import torch
+
+__all__ = ["SharedTensorSlot"]
+
+
+class SharedTensorSlot:
+    r"""A shared-memory tensor region that one process updates in place.
+
+    The writer republishes a tensor with :meth:`write`; any number of reader
+    processes take consistent snapshots with :meth:`read`. A sequence counter
+    in shared memory guards the region as a seqlock: the counter is odd while
+    a write is in flight, and readers retry their copy if the counter was odd
+    or changed across it, so torn reads are never surfaced. Readers never
+    block the writer.
+
+    The slot pickles like any shared-memory tensor, so it can be handed to
+    workers through ``torch.multiprocessing`` queues or :func:`~torch.multiprocessing.spawn`
+    once and updated in place afterwards, instead of re-sharing or copying the
+    payload through pipes on every refresh.
+
+    Only a single writer process may call :meth:`write` on a given slot at a
+    time; a second concurrent writer raises an error.
+
+    Args:
+        template (Tensor): CPU tensor whose shape, dtype and initial contents
+            define the region.
+    """
+
+    def __init__(self, template):
+        if template.device.type != 'cpu':
+            raise ValueError(
+                f"SharedTensorSlot only supports CPU tensors, but the template is on '{template.device}'")
+        self._data = template.detach().clone(memory_format=torch.contiguous_format).share_memory_()
+        self._seq = torch.zeros(1, dtype=torch.int64).share_memory_()
+
+    def write(self, src):
+        r"""Publish the contents of ``src`` to all readers.
+
+        Returns the version number of the published update (the number of
+        completed writes, counting the initial contents as version 0).
+        """
+        if src.shape != self._data.shape or src.dtype != self._data.dtype:
+            raise ValueError(
+                f"expected a {self._data.dtype} tensor of shape {tuple(self._data.shape)}, "
+                f"but got a {src.dtype} tensor of shape {tuple(src.shape)}")
+        src = src.detach()
+        if (not src.is_contiguous() or src.storage_offset() != 0
+                or src.untyped_storage().nbytes() != self._data.untyped_storage().nbytes()):
+            src = src.contiguous().clone()
+        return torch.UntypedStorage._seqlock_write_(
+            self._seq.untyped_storage(),
+            self._data.untyped_storage(),
+            src.untyped_storage())
+
+    def read(self, out=None):
+        r"""Take a consistent snapshot of the region.
+
+        Copies the shared contents into ``out`` (a new tensor when omitted),
+        retrying until the copy did not overlap a write. Returns a tuple of
+        the snapshot tensor and the version number it corresponds to.
+        """
+        if out is None:
+            out = torch.empty_like(self._data)
+        else:
+            if out.shape != self._data.shape or out.dtype != self._data.dtype:
+                raise ValueError(
+                    f"expected a {self._data.dtype} tensor of shape {tuple(self._data.shape)}, "
+                    f"but got a {out.dtype} tensor of shape {tuple(out.shape)}")
+            if (not out.is_contiguous() or out.storage_offset() != 0
+                    or out.untyped_storage().nbytes() != self._data.untyped_storage().nbytes()):
+                raise ValueError("out must be a contiguous tensor that owns its whole storage")
+        version = torch.UntypedStorage._seqlock_read_(
+            self._seq.untyped_storage(),
+            self._data.untyped_storage(),
+            out.untyped_storage())
+        return out, version
+
+    @property
+    def version(self):
+        r"""Number of completed writes (approximate while a write is in flight)."""
+        return int(self._seq[0].item()) // 2
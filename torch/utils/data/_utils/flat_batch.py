@@ -0,0 +1,127 @@
+r"""Chunked worker->main batch transfers through one shared-memory segment.
+
+A batch put on the worker result queue is normally pickled with every tensor
+reduced separately: one fd-passed storage plus a pickled metadata record per
+tensor. For dict batches with hundreds of small tensors, those per-tensor
+reductions and the main-process unpickling of their metadata dominate the
+transfer cost. :func:`maybe_flatten` replaces the tensors of such a batch
+with a single placeholder-carrying structure plus ONE shared-memory segment
+and a fixed binary header (built by ``torch._C._flatten_tensor_batch``); on
+unpickling, the tensors are rebuilt in C++ as views into that segment
+without a Python round-trip per tensor.
+
+Like ordinary worker batches, the rebuilt tensors live in shared memory; in
+addition they share one segment, so they cannot be resized in place (which
+the DataLoader docs already discourage for worker output).
+"""
+
+import collections
+
+import torch
+from . import IS_WINDOWS
+
+# Flattening has a fixed cost (a structure walk and one header decode), so it
+# only pays off once enough per-tensor pickle records are avoided.
+MIN_TENSORS_TO_FLATTEN = 16
+
+
+class _TensorSlot:
+    r"""Placeholder standing in for one tensor inside a flattened batch."""
+
+    __slots__ = ()
+
+
+_TENSOR_SLOT = _TensorSlot()
+
+
+def _replace_tensors(data, predicate, replacement):
+    r"""Rebuilds ``data`` with ``replacement(item)`` for items matching ``predicate``.
+
+    Mirrors the container handling of :func:`~torch.utils.data._utils.pin_memory.pin_memory`
+    so that the flatten and rebuild walks visit tensors in the same order.
+    """
+    if predicate(data):
+        return replacement(data)
+    elif isinstance(data, (str, bytes)):
+        return data
+    elif isinstance(data, collections.abc.Mapping):
+        samples = {k: _replace_tensors(sample, predicate, replacement) for k, sample in data.items()}
+        try:
+            return type(data)(samples)  # type: ignore[call-arg]
+        except TypeError:
+            # The mapping type may not support `__init__(iterable)`.
+            return samples
+    elif isinstance(data, tuple) and hasattr(data, '_fields'):  # namedtuple
+        return type(data)(*(_replace_tensors(sample, predicate, replacement) for sample in data))
+    elif isinstance(data, tuple):
+        return [_replace_tensors(sample, predicate, replacement) for sample in data]  # Backwards compatibility.
+    elif isinstance(data, collections.abc.Sequence):
+        samples = [_replace_tensors(sample, predicate, replacement) for sample in data]
+        try:
+            return type(data)(samples)  # type: ignore[call-arg]
+        except TypeError:
+            # The sequence type may not support `__init__(iterable)` (e.g., `range`).
+            return samples
+    else:
+        return data
+
+
+def _is_flattenable(tensor):
+    return (
+        tensor.device.type == "cpu"
+        and tensor.layout == torch.strided
+        and not tensor.is_quantized
+        and not tensor.requires_grad
+    )
+
+
+def _rebuild_flat_batch(structure, flat, header):
+    tensors = iter(torch._C._unflatten_tensor_batch(flat, header))
+    return _replace_tensors(
+        structure, lambda d: isinstance(d, _TensorSlot), lambda d: next(tensors))
+
+
+class _FlatTensorBatch:
+    r"""Pickles as one shared-memory segment plus a binary header.
+
+    Unpickling yields the original batch directly (not this wrapper), so the
+    main-process loop needs no changes.
+    """
+
+    __slots__ = ['_structure', '_flat', '_header']
+
+    def __init__(self, batch, tensors):
+        self._flat, self._header = torch._C._flatten_tensor_batch(tensors)
+        self._structure = _replace_tensors(
+            batch, lambda d: isinstance(d, torch.Tensor), lambda d: _TENSOR_SLOT)
+
+    def __reduce__(self):
+        return (_rebuild_flat_batch, (self._structure, self._flat, self._header))
+
+
+def maybe_flatten(batch):
+    r"""Wraps ``batch`` for chunked transfer when that is a clear win.
+
+    Falls back to returning ``batch`` unchanged when it holds too few
+    tensors, a tensor the flat protocol cannot carry, or the same tensor
+    object twice (separate reductions preserve that aliasing; a flat copy
+    would not). Windows workers share storages by filename rather than fd,
+    which would re-copy the flat segment, so the fast path is POSIX-only.
+    """
+    if IS_WINDOWS:
+        return batch
+    tensors = []
+    seen = set()
+    try:
+        _replace_tensors(
+            batch,
+            lambda d: isinstance(d, torch.Tensor),
+            lambda d: tensors.append(d) or seen.add(id(d)) or d)
+    except Exception:
+        # A container we cannot walk (or rebuild) keeps the pickle path.
+        return batch
+    if len(tensors) < MIN_TENSORS_TO_FLATTEN or len(seen) != len(tensors):
+        return batch
+    if not all(_is_flattenable(t) for t in tensors):
+        return batch
+    return _FlatTensorBatch(batch, tensors)
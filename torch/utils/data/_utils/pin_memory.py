@@ -33,7 +33,7 @@ def _pin_memory_loop(in_queue, out_queue, device_id, done_event, device):
         idx, data = r
         if not done_event.is_set() and not isinstance(data, ExceptionWrapper):
             try:
-                data = pin_memory(data, device)
+                data = _pin_memory_batched(data, device)
             except Exception:
                 data = ExceptionWrapper(
                     where=f"in pin memory thread for device {device_id}")
@@ -52,6 +52,69 @@ def _pin_memory_loop(in_queue, out_queue, device_id, done_event, device):
         # to the next
         do_one_step()
 
+def _collect_tensors(data, out):
+    r"""Gathers every tensor that :func:`pin_memory` would pin, in traversal order."""
+    if isinstance(data, torch.Tensor):
+        out.append(data)
+    elif isinstance(data, (str, bytes)):
+        return
+    elif isinstance(data, collections.abc.Mapping):
+        for sample in data.values():
+            _collect_tensors(sample, out)
+    elif isinstance(data, collections.abc.Sequence):
+        for sample in data:
+            _collect_tensors(sample, out)
+
+
+def _with_pinned_tensors(data, pinned_iter, device):
+    r"""Rebuilds ``data`` with each tensor replaced by the next pinned tensor.
+
+    Mirrors the structure handling of :func:`pin_memory`; tensors are consumed
+    from ``pinned_iter`` in the order :func:`_collect_tensors` found them.
+    """
+    if isinstance(data, torch.Tensor):
+        return next(pinned_iter)
+    elif isinstance(data, (str, bytes)):
+        return data
+    elif isinstance(data, collections.abc.Mapping):
+        samples = {k: _with_pinned_tensors(sample, pinned_iter, device) for k, sample in data.items()}
+        try:
+            return type(data)(samples)  # type: ignore[call-arg]
+        except TypeError:
+            # The mapping type may not support `__init__(iterable)`.
+            return samples
+    elif isinstance(data, tuple) and hasattr(data, '_fields'):  # namedtuple
+        return type(data)(*(_with_pinned_tensors(sample, pinned_iter, device) for sample in data))
+    elif isinstance(data, tuple):
+        return [_with_pinned_tensors(sample, pinned_iter, device) for sample in data]  # Backwards compatibility.
+    elif isinstance(data, collections.abc.Sequence):
+        samples = [_with_pinned_tensors(sample, pinned_iter, device) for sample in data]
+        try:
+            return type(data)(samples)  # type: ignore[call-arg]
+        except TypeError:
+            # The sequence type may not support `__init__(iterable)` (e.g., `range`).
+            return samples
+    elif hasattr(data, "pin_memory"):
+        return data.pin_memory()
+    else:
+        return data
+
+
+def _pin_memory_batched(data, device=None):
+    r"""Like :func:`pin_memory`, but pins all tensors of the batch at once.
+
+    The tensors are pinned through a single native call that releases the GIL
+    once for the whole batch instead of once per tensor, which matters in the
+    pin-memory thread where per-tensor GIL round-trips cap throughput.
+    """
+    tensors = []
+    _collect_tensors(data, tensors)
+    if not tensors:
+        return pin_memory(data, device)
+    pinned = iter(torch._C._pin_memory_batch(tensors, device))
+    return _with_pinned_tensors(data, pinned, device)
+
+
 def pin_memory(data, device=None):
     if isinstance(data, torch.Tensor):
         return data.pin_memory(device)
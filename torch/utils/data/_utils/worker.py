@@ -11,7 +11,7 @@ import queue
 from dataclasses import dataclass
 from torch._utils import ExceptionWrapper
 from typing import Optional, Union, TYPE_CHECKING
-from . import signal_handling, MP_STATUS_CHECK_INTERVAL, IS_WINDOWS, HAS_NUMPY
+from . import signal_handling, flat_batch, MP_STATUS_CHECK_INTERVAL, IS_WINDOWS, HAS_NUMPY
 if TYPE_CHECKING:
     from torch.utils.data import Dataset
 
@@ -319,7 +319,9 @@ def _worker_loop(dataset_kind, dataset, index_queue, data_queue, done_event,
                         # See NOTE [ Python Traceback Reference Cycle Problem ]
                         data = ExceptionWrapper(
                             where=f"in DataLoader worker process {worker_id}")
-            data_queue.put((idx, data))
+            # Many-tensor batches go through one shared-memory segment
+            # instead of a per-tensor pickle reduction; see flat_batch.py.
+            data_queue.put((idx, flat_batch.maybe_flatten(data)))
             del data, idx, index, r  # save memory
     except KeyboardInterrupt:
         # Main process will raise KeyboardInterrupt anyways.
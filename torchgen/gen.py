@@ -9,6 +9,7 @@ from typing import (
     Any,
     Callable,
     Dict,
+    FrozenSet,
     List,
     Literal,
     Optional,
@@ -568,6 +569,22 @@ class RegisterSchema:
 class ComputeOperators:
     target: Literal[Target.DECLARATION, Target.DEFINITION]
     static_dispatch_backend_indices: List[BackendIndex]
+    # If set, only the listed ops (with or without overload name, optionally
+    # prefixed with "aten::") get static dispatch; every other op keeps the
+    # dynamic dispatcher body, so autograd and other interposed functionality
+    # still work for it.
+    static_dispatch_op_allowlist: Optional[FrozenSet[str]] = None
+
+    def use_static_dispatch(self, f: NativeFunction) -> bool:
+        if len(self.static_dispatch_backend_indices) == 0:
+            return False
+        if self.static_dispatch_op_allowlist is None:
+            return True
+        name = f.func.name
+        return (
+            str(name) in self.static_dispatch_op_allowlist
+            or str(name.name) in self.static_dispatch_op_allowlist
+        )
 
     @method_with_native_function
     def __call__(self, f: NativeFunction) -> str:
@@ -640,10 +657,7 @@ static C10_NOINLINE c10::TypedOperatorHandle<{name}::schema> create_{name}_typed
     static auto op = create_{name}_typed_handle();
     return op.{dispatcher_call}({dispatcher_exprs_str});"""
 
-                if (
-                    not is_redispatching_fn
-                    and len(self.static_dispatch_backend_indices) > 0
-                ):
+                if not is_redispatching_fn and self.use_static_dispatch(f):
                     # call() should go through static dispatch
                     fn_body = static_dispatch(
                         sig, f, backend_indices=self.static_dispatch_backend_indices
@@ -2190,6 +2204,7 @@ def gen_source_files(
     force_schema_registration: bool,
     per_operator_headers: bool,
     skip_dispatcher_op_registration: bool,
+    static_dispatch_op_allowlist: Optional[FrozenSet[str]] = None,
 ) -> None:
     extra_cuda_headers = """\
 #include <c10/cuda/CUDAGuard.h>
@@ -2411,6 +2426,7 @@ def gen_source_files(
                 ComputeOperators(
                     Target.DEFINITION,
                     static_dispatch_backend_indices=static_dispatch_idx,
+                    static_dispatch_op_allowlist=static_dispatch_op_allowlist,
                 )(fn)
             ],
         },
@@ -2699,6 +2715,18 @@ def main() -> None:
         nargs="*",
         help="generate static dispatch code for the specific backend (if set)",
     )
+    parser.add_argument(
+        "--static-dispatch-op-allowlist-yaml-path",
+        "--static_dispatch_op_allowlist_yaml_path",
+        help="Provide a path to a YAML list of operators for which static "
+        "dispatch code should be generated; all other operators keep going "
+        "through the dynamic dispatcher. Each entry is either a full operator "
+        "name with overload or just a bare operator name, with or without the "
+        "namespace prefix (e.g. aten::add.Tensor, add.Tensor, add). Listed "
+        "operators bypass the dispatcher entirely, including autograd, so "
+        "only list ops that are called for inference. Requires "
+        "--static-dispatch-backend.",
+    )
     parser.add_argument(
         "--skip-dispatcher-op-registration",
         "--skip_dispatcher_op_registration",
@@ -2815,6 +2843,25 @@ def main() -> None:
             if dp_key not in functions_keys:
                 functions_keys.add(dp_key)
 
+    static_dispatch_op_allowlist: Optional[FrozenSet[str]] = None
+    if options.static_dispatch_op_allowlist_yaml_path:
+        assert options.static_dispatch_backend, (
+            "--static-dispatch-op-allowlist-yaml-path requires "
+            "--static-dispatch-backend to specify which backend(s) the listed "
+            "operators should be called into directly"
+        )
+        with open(options.static_dispatch_op_allowlist_yaml_path) as allowlist_file:
+            allowlist_entries = yaml.safe_load(allowlist_file)
+        assert isinstance(allowlist_entries, list), (
+            "expected a YAML list of operator names in "
+            f"{options.static_dispatch_op_allowlist_yaml_path}, got "
+            f"{type(allowlist_entries)}"
+        )
+        static_dispatch_op_allowlist = frozenset(
+            entry[len("aten::") :] if entry.startswith("aten::") else entry
+            for entry in allowlist_entries
+        )
+
     if "sources" in options.generate:
         gen_source_files(
             native_functions=native_functions,
@@ -2834,6 +2881,7 @@ def main() -> None:
             force_schema_registration=options.force_schema_registration,
             per_operator_headers=options.per_operator_headers,
             skip_dispatcher_op_registration=options.skip_dispatcher_op_registration,
+            static_dispatch_op_allowlist=static_dispatch_op_allowlist,
         )
 
     if "headers" in options.generate: